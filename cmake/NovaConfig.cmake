@@ -1 +1,5 @@
+# static builds with OpenMP need its runtime
+if(NOT TARGET OpenMP::OpenMP_C)
+    find_package(OpenMP QUIET COMPONENTS C)
+endif()
 include("${CMAKE_CURRENT_LIST_DIR}/NovaTargets.cmake")
@@ -23,4 +23,6 @@
 #cmakedefine01 HAVE_PUTENV_S
 
 #cmakedefine01 HAVE_SYS_STAT_H
+#cmakedefine01 HAVE_SYS_MMAN_H
+#cmakedefine01 HAVE_PTHREAD_H
 #cmakedefine01 HAVE_DLFCN_H
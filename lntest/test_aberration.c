@@ -27,6 +27,8 @@
 
 #include <unity.h>
 
+#include <math.h>
+
 double JD;
 struct ln_equ_posn object;
 
@@ -63,11 +65,44 @@ void test_ln_get_equ_aber(void)
   );
 }
 
+void test_ln_get_equ_aber_earth_vel(void)
+{
+  struct ln_rect_posn velocity;
+  struct ln_equ_posn pos, star;
+  double speed;
+  int i;
+
+  ln_get_earth_bary_vel(JD, &velocity);
+
+  /* about 2 pi au per year */
+  speed = sqrt(velocity.X * velocity.X + velocity.Y * velocity.Y + velocity.Z * velocity.Z);
+  TEST_ASSERT_DOUBLE_WITHIN(0.0005, 0.0172, speed);
+
+  ln_get_equ_aber_earth_vel(&object, &velocity, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    1.0e-8, 41.06238352, pos.ra, "RA aberration"
+  );
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    1.0e-8, 49.22962359, pos.dec, "DEC aberration"
+  );
+
+  /* same as ln_get_equ_aber() for any star */
+  for (i = 0; i < 12; i++) {
+    struct ln_equ_posn mean = {.ra = 30.0 * i, .dec = 15.0 * i - 85.0};
+
+    ln_get_equ_aber(&mean, JD, &star);
+    ln_get_equ_aber_earth_vel(&mean, &velocity, &pos);
+    TEST_ASSERT_EQUAL_DOUBLE(star.ra, pos.ra);
+    TEST_ASSERT_EQUAL_DOUBLE(star.dec, pos.dec);
+  }
+}
+
 int main(int argc, char **argv)
 {
   UNITY_BEGIN();
 
   RUN_TEST(test_ln_get_equ_aber);
+  RUN_TEST(test_ln_get_equ_aber_earth_vel);
 
   return UNITY_END();
 }
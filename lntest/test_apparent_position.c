@@ -60,11 +60,41 @@ void test_ln_get_apparent_posn(void)
   );
 }
 
+void test_ln_get_apparent_posn_batch(void)
+{
+  struct ln_equ_posn mean[3], motion[3], pos[3], single;
+  int i;
+
+  for (i = 0; i < 3; i++) {
+    mean[i] = object;
+    mean[i].ra += 120.0 * i;
+    mean[i].dec -= 40.0 * i;
+    motion[i] = pm;
+  }
+
+  ln_get_apparent_posn_batch(mean, motion, JD, pos, 3, 2);
+
+  TEST_ASSERT_DOUBLE_WITHIN(2 * MARCSEC, 41.5599646, pos[0].ra);
+  TEST_ASSERT_DOUBLE_WITHIN(2 * MARCSEC, 49.3520685, pos[0].dec);
+
+  for (i = 1; i < 3; i++) {
+    ln_get_apparent_posn(&mean[i], &motion[i], JD, &single);
+    TEST_ASSERT_DOUBLE_WITHIN(2 * MARCSEC, 0.0, ln_get_angular_separation(&single, &pos[i]));
+  }
+
+  /* no proper motion */
+  ln_get_apparent_posn_batch(mean, NULL, JD, pos, 1, 0);
+  motion[0].ra = motion[0].dec = 0.0;
+  ln_get_apparent_posn(&mean[0], &motion[0], JD, &single);
+  TEST_ASSERT_DOUBLE_WITHIN(2 * MARCSEC, 0.0, ln_get_angular_separation(&single, &pos[0]));
+}
+
 int main(int argc, char **argv)
 {
   UNITY_BEGIN();
 
   RUN_TEST(test_ln_get_apparent_posn);
+  RUN_TEST(test_ln_get_apparent_posn_batch);
 
   return UNITY_END();
 }
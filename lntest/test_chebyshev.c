@@ -0,0 +1,163 @@
+/*
+ * test_chebyshev.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ */
+
+#include "config.h"
+
+#include <libnova/libnova.h>
+
+#include <unity.h>
+
+#define ARCSECTHOUSANDTH (0.001 / 3600.0)
+
+double JD;
+
+void setUp()
+{
+  JD = 2451545.0; /* 2000-01-01 12:00:00 TDB */
+}
+
+void tearDown()
+{
+}
+
+static void check_helio_cheb(void (*get_helio_coords)(double, struct ln_helio_posn *),
+  double span, const char *body)
+{
+  struct ln_helio_cheb cheb;
+  struct ln_helio_posn pos, fit;
+  struct ln_rect_posn rect, rect_fit;
+  double day;
+  int i;
+
+  TEST_ASSERT_EQUAL_INT_MESSAGE(
+    0, ln_helio_cheb_init(&cheb, get_helio_coords, JD, JD + 365.25, span, 12), body
+  );
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(ARCSECTHOUSANDTH, 0.0, cheb.max_error.L, body);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(ARCSECTHOUSANDTH, 0.0, cheb.max_error.B, body);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, 0.0, cheb.max_error.R, body);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, 0.0, cheb.max_rect_error, body);
+
+  for (i = 0; i <= 1000; i++) {
+    day = JD + i * 0.36525;
+    get_helio_coords(day, &pos);
+    ln_get_rect_from_helio(&pos, &rect);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, ln_get_helio_cheb_coords(&cheb, day, &fit), body);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, ln_get_helio_cheb_rect(&cheb, day, &rect_fit), body);
+
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(ARCSECTHOUSANDTH, pos.L, fit.L, body);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(ARCSECTHOUSANDTH, pos.B, fit.B, body);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, pos.R, fit.R, body);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, rect.X, rect_fit.X, body);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, rect.Y, rect_fit.Y, body);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, rect.Z, rect_fit.Z, body);
+  }
+
+  ln_helio_cheb_free(&cheb);
+}
+
+void test_ln_helio_cheb_mercury(void)
+{
+  check_helio_cheb(ln_get_mercury_helio_coords, 8.0, "Mercury Chebyshev");
+}
+
+void test_ln_helio_cheb_earth(void)
+{
+  check_helio_cheb(ln_get_earth_helio_coords, 16.0, "Earth Chebyshev");
+}
+
+void test_ln_helio_cheb_mars(void)
+{
+  check_helio_cheb(ln_get_mars_helio_coords, 32.0, "Mars Chebyshev");
+}
+
+void test_ln_helio_cheb_pluto(void)
+{
+  check_helio_cheb(ln_get_pluto_helio_coords, 32.0, "Pluto Chebyshev");
+}
+
+void test_ln_helio_cheb_range(void)
+{
+  struct ln_helio_cheb cheb;
+  struct ln_helio_posn pos;
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_helio_cheb_init(&cheb, ln_get_mars_helio_coords, JD, JD, 8.0, 12));
+  TEST_ASSERT_EQUAL_INT(-1, ln_helio_cheb_init(&cheb, ln_get_mars_helio_coords, JD, JD + 10.0, 0.0, 12));
+
+  TEST_ASSERT_EQUAL_INT(0, ln_helio_cheb_init(&cheb, ln_get_mars_helio_coords, JD, JD + 10.0, 8.0, 12));
+  TEST_ASSERT_EQUAL_INT(2, cheb.segments);
+  TEST_ASSERT_EQUAL_INT(0, ln_get_helio_cheb_coords(&cheb, JD, &pos));
+  TEST_ASSERT_EQUAL_INT(0, ln_get_helio_cheb_coords(&cheb, JD + 10.0, &pos));
+  TEST_ASSERT_EQUAL_INT(-1, ln_get_helio_cheb_coords(&cheb, JD - 0.1, &pos));
+  TEST_ASSERT_EQUAL_INT(-1, ln_get_helio_cheb_coords(&cheb, JD + 10.1, &pos));
+  ln_helio_cheb_free(&cheb);
+  TEST_ASSERT_NULL(cheb.coeff);
+}
+
+void test_ln_lunar_cheb(void)
+{
+  struct ln_lunar_cheb cheb;
+  struct ln_rect_posn pos, fit, vel, before, after;
+  double day, h = 0.001;
+  int i;
+
+  TEST_ASSERT_EQUAL_INT(0, ln_lunar_cheb_init(&cheb, JD, JD + 30.0, 4.0, 12, 0.0));
+  TEST_ASSERT_EQUAL_INT(8, cheb.segments);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-4, 0.0, cheb.max_error);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-2, 0.0, cheb.max_vel_error);
+
+  for (i = 0; i <= 60; i++) {
+    day = JD + i * 0.5;
+    ln_get_lunar_geo_posn(day, &pos, 0.0);
+    TEST_ASSERT_EQUAL_INT(0, ln_get_lunar_cheb_posn(&cheb, day, &fit));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4, pos.X, fit.X);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4, pos.Y, fit.Y);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4, pos.Z, fit.Z);
+
+    /* central difference of the theory, good to about 0.01 km/day */
+    ln_get_lunar_geo_posn(day - h, &before, 0.0);
+    ln_get_lunar_geo_posn(day + h, &after, 0.0);
+    TEST_ASSERT_EQUAL_INT(0, ln_get_lunar_cheb_vel(&cheb, day, &vel));
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, (after.X - before.X) / (2.0 * h), vel.X);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, (after.Y - before.Y) / (2.0 * h), vel.Y);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, (after.Z - before.Z) / (2.0 * h), vel.Z);
+  }
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_get_lunar_cheb_posn(&cheb, JD - 0.1, &fit));
+  TEST_ASSERT_EQUAL_INT(-1, ln_get_lunar_cheb_vel(&cheb, JD + 30.1, &vel));
+  ln_lunar_cheb_free(&cheb);
+  TEST_ASSERT_NULL(cheb.coeff);
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_lunar_cheb_init(&cheb, JD, JD, 4.0, 12, 0.0));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ln_helio_cheb_mercury);
+  RUN_TEST(test_ln_helio_cheb_earth);
+  RUN_TEST(test_ln_helio_cheb_mars);
+  RUN_TEST(test_ln_helio_cheb_pluto);
+  RUN_TEST(test_ln_helio_cheb_range);
+  RUN_TEST(test_ln_lunar_cheb);
+
+  return UNITY_END();
+}
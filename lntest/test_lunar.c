@@ -27,6 +27,13 @@
 
 #include <unity.h>
 
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "elp-file.h"
+
 double JD;
 
 void setUp()
@@ -72,11 +79,218 @@ void test_ln_get_lunar_geo_posn(void)
   );
 }
 
+void test_ln_get_lunar_geo_posn_prec(void)
+{
+  /* truncation level and documented error as a multiple of it */
+  static const double precision[] = {1e-8, 1e-6, 1e-4};
+  static const double bound[] = {50.0, 25.0, 10.0};
+  struct ln_rect_posn full, moon;
+  double day, r_full, r_moon, lng, lat, dist;
+  int i, p;
+
+  for (i = 0; i < 20; i++) {
+    day = JD - 36525.0 + i * 3652.5 + 0.37;
+    ln_get_lunar_geo_posn(day, &full, 0);
+    r_full = sqrt(full.X * full.X + full.Y * full.Y + full.Z * full.Z);
+
+    for (p = 0; p < 3; p++) {
+      ln_get_lunar_geo_posn(day, &moon, precision[p]);
+      r_moon = sqrt(moon.X * moon.X + moon.Y * moon.Y + moon.Z * moon.Z);
+
+      lng = remainder(atan2(moon.Y, moon.X) - atan2(full.Y, full.X),
+        2.0 * M_PI);
+      lat = asin(moon.Z / r_moon) - asin(full.Z / r_full);
+      dist = (r_moon - r_full) / 384747.98;
+
+      TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+        bound[p] * precision[p], 0.0, lng, "lunar truncated longitude"
+      );
+      TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+        bound[p] * precision[p], 0.0, lat, "lunar truncated latitude"
+      );
+      TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+        bound[p] * precision[p], 0.0, dist, "lunar truncated distance"
+      );
+    }
+  }
+}
+
+/* central difference of the lunar position with step h, combined for two
+ * steps to cancel the h^2 error */
+static void lunar_geo_diff(double day, double h, struct ln_rect_posn *vel)
+{
+  struct ln_rect_posn a, b, c, d;
+
+  ln_get_lunar_geo_posn(day - h, &a, 0);
+  ln_get_lunar_geo_posn(day + h, &b, 0);
+  ln_get_lunar_geo_posn(day - 2.0 * h, &c, 0);
+  ln_get_lunar_geo_posn(day + 2.0 * h, &d, 0);
+
+  vel->X = (8.0 * (b.X - a.X) - (d.X - c.X)) / (12.0 * h);
+  vel->Y = (8.0 * (b.Y - a.Y) - (d.Y - c.Y)) / (12.0 * h);
+  vel->Z = (8.0 * (b.Z - a.Z) - (d.Z - c.Z)) / (12.0 * h);
+}
+
+void test_ln_get_lunar_geo_posn_vel(void)
+{
+  struct ln_rect_posn moon, pos, vel, diff;
+  struct ln_lnlat_posn ecl, rate, before, after;
+  double day, h = 0.01;
+  int i;
+
+  for (i = 0; i < 5; i++) {
+    /* includes J2000, where the t^n series vanish but not their rates */
+    day = JD - 36525.0 + i * 18262.5;
+    ln_get_lunar_geo_posn(day, &moon, 0);
+    ln_get_lunar_geo_posn_vel(day, &pos, &vel, 0);
+    lunar_geo_diff(day, h, &diff);
+
+    TEST_ASSERT_EQUAL_DOUBLE(moon.X, pos.X);
+    TEST_ASSERT_EQUAL_DOUBLE(moon.Y, pos.Y);
+    TEST_ASSERT_EQUAL_DOUBLE(moon.Z, pos.Z);
+
+    /* the difference is good to a few m per day */
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, diff.X, vel.X);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, diff.Y, vel.Y);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, diff.Z, vel.Z);
+
+    ln_get_lunar_ecl_coords_vel(day, &ecl, &rate, 0);
+    ln_get_lunar_ecl_coords(day - h, &before, 0);
+    ln_get_lunar_ecl_coords(day + h, &after, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5,
+      remainder(after.lng - before.lng, 360.0) / (2.0 * h), rate.lng);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, (after.lat - before.lat) / (2.0 * h),
+      rate.lat);
+  }
+}
+
+void test_ln_set_lunar_threads(void)
+{
+  struct ln_rect_posn single, moon;
+  int threads;
+
+  ln_get_lunar_geo_posn(JD, &single, 0);
+
+  for (threads = 2; threads <= 4; threads++) {
+    TEST_ASSERT_EQUAL_INT(0, ln_set_lunar_threads(threads));
+    ln_get_lunar_geo_posn(JD, &moon, 0);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(
+      &single, &moon, sizeof(moon), "lunar position with threads"
+    );
+  }
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_set_lunar_threads(-1));
+  TEST_ASSERT_EQUAL_INT(0, ln_set_lunar_threads(0));
+}
+
+void test_ln_get_lunar_phase(void)
+{
+  /* Meeus example 48.a, 69.0756 and 0.6786 from the truncated theory of
+   * Meeus. The values of the full ELP series are pinned, truncating the
+   * series moves the phase angle by up to 0.04 degrees. */
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, 69.086237135958, ln_get_lunar_phase(JD));
+  TEST_ASSERT_DOUBLE_WITHIN(1e-8, 0.678481195876, ln_get_lunar_disk(JD));
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, 117.340220505937,
+    ln_get_lunar_phase(2460000.5));
+  TEST_ASSERT_DOUBLE_WITHIN(1e-8, 0.270363383410,
+    ln_get_lunar_disk(2460000.5));
+}
+
+/* write a coefficient file whose only row is a constant distance R of
+ * elp3, with a multiplier m of the first Delaunay argument */
+static int write_elp_file(const char *file, double R, int m)
+{
+  struct elp_file_header hdr;
+  static const int args[ELP_FILE_TYPES] = {4, 5, 12};
+  char block[8 * ELP_FILE_ALIGN];
+  uint16_t id = 0;
+  double s = R, zero = 0.0;
+  size_t offset = sizeof(hdr) + ELP_FILE_ALIGN - sizeof(hdr) % ELP_FILE_ALIGN;
+  FILE *fd;
+  int i;
+
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, ELP_FILE_MAGIC, sizeof(hdr.magic));
+  hdr.version = ELP_FILE_VERSION;
+  hdr.byte_order = ELP_FILE_BYTE_ORDER;
+  hdr.tables = ELP_FILE_TABLES;
+  hdr.types = ELP_FILE_TYPES;
+
+  /* arrays at the end of the header, one per aligned block */
+  memset(block, 0, sizeof(block));
+  memcpy(block, &id, sizeof(id));
+  memcpy(block + ELP_FILE_ALIGN, &id, sizeof(id));
+  memcpy(block + 2 * ELP_FILE_ALIGN, &s, sizeof(s));
+  memcpy(block + 3 * ELP_FILE_ALIGN, &zero, sizeof(zero));
+  memcpy(block + 4 * ELP_FILE_ALIGN, &s, sizeof(s));
+  block[5 * ELP_FILE_ALIGN] = m;
+
+  hdr.table[2].arg = offset;
+  hdr.table[2].max_arg = offset + ELP_FILE_ALIGN;
+  hdr.table[2].amp = offset + 2 * ELP_FILE_ALIGN;
+  hdr.table[2].c = offset + 3 * ELP_FILE_ALIGN;
+  hdr.table[2].s = offset + 4 * ELP_FILE_ALIGN;
+  hdr.table[2].size = 1;
+  for (i = 0; i < ELP_FILE_TYPES; i++) {
+    hdr.dict[i].offset = offset + (5 + i) * ELP_FILE_ALIGN;
+    hdr.dict[i].args = args[i];
+    hdr.dict[i].size = 1;
+  }
+
+  fd = fopen(file, "wb");
+  if (fd == NULL)
+    return -1;
+  fwrite(&hdr, sizeof(hdr), 1, fd);
+  fwrite(block, 1, offset - sizeof(hdr), fd);
+  fwrite(block, 1, sizeof(block), fd);
+  fclose(fd);
+  return 0;
+}
+
+void test_ln_lunar_load_tables(void)
+{
+  const char *file = "test_lunar.bin", *bad = "test_lunar_bad.bin";
+  struct ln_rect_posn builtin, moon;
+
+  ln_get_lunar_geo_posn(JD, &builtin, 0);
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_lunar_load_tables("no_such_file.bin"));
+  TEST_ASSERT_EQUAL_INT(0, write_elp_file(file, 400000.0, 0));
+  TEST_ASSERT_EQUAL_INT(0, ln_lunar_load_tables(file));
+
+  /* the distance is the only term, scaled from ATH to A0 */
+  ln_get_lunar_geo_posn(JD, &moon, 0);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, 400000.0 * (1.0 - 7.6469e-11),
+    sqrt(moon.X * moon.X + moon.Y * moon.Y + moon.Z * moon.Z));
+
+  /* loading a bad file keeps the current tables, a multiplier beyond
+   * the compiled in theory is rejected */
+  TEST_ASSERT_EQUAL_INT(-1, ln_lunar_load_tables(__FILE__));
+  TEST_ASSERT_EQUAL_INT(0, write_elp_file(bad, 300000.0, 99));
+  TEST_ASSERT_EQUAL_INT(-1, ln_lunar_load_tables(bad));
+  ln_get_lunar_geo_posn(JD + 1.0, &moon, 0);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-6, 400000.0 * (1.0 - 7.6469e-11),
+    sqrt(moon.X * moon.X + moon.Y * moon.Y + moon.Z * moon.Z));
+
+  ln_lunar_unload_tables();
+  ln_get_lunar_geo_posn(JD, &moon, 0);
+  TEST_ASSERT_EQUAL_MEMORY(&builtin, &moon, sizeof(moon));
+
+  remove(file);
+  remove(bad);
+}
+
 int main(int argc, char **argv)
 {
   UNITY_BEGIN();
 
   RUN_TEST(test_ln_get_lunar_geo_posn);
+  RUN_TEST(test_ln_get_lunar_geo_posn_prec);
+  RUN_TEST(test_ln_get_lunar_geo_posn_vel);
+  RUN_TEST(test_ln_set_lunar_threads);
+  RUN_TEST(test_ln_get_lunar_phase);
+  RUN_TEST(test_ln_lunar_load_tables);
 
   return UNITY_END();
 }
@@ -77,12 +77,78 @@ void test_ln_get_nutation(void)
   TEST_ASSERT_DOUBLE_WITHIN(MARCSEC,  2.34355372e+1, nutation.ecliptic);
 }
 
+void test_ln_get_nutation_ctx(void)
+{
+  struct ln_nutation_ctx ctx, series;
+  struct ln_nutation nutation, exact;
+  double JD;
+  int i;
+
+  ln_nutation_ctx_init(&ctx);
+
+  /* tracking over three days, against the series of an empty context */
+  for (i = 0; i < 3000; i++) {
+    JD = 2460000.5 + i * 0.001;
+    ln_get_nutation_ctx(&ctx, JD, &nutation);
+
+    ln_nutation_ctx_init(&series);
+    ln_get_nutation_ctx(&series, JD, &exact);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6 * MARCSEC, exact.longitude, nutation.longitude);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6 * MARCSEC, exact.obliquity, nutation.obliquity);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6 * MARCSEC, exact.ecliptic, nutation.ecliptic);
+  }
+  TEST_ASSERT_TRUE(ctx.fitted);
+
+  /* steps of 0.7 days would not pay for a fit, the series is used */
+  ln_nutation_ctx_init(&ctx);
+  for (i = 0; i < 100; i++) {
+    JD = 2460000.5 + i * 0.7;
+    ln_get_nutation_ctx(&ctx, JD, &nutation);
+
+    ln_nutation_ctx_init(&series);
+    ln_get_nutation_ctx(&series, JD, &exact);
+
+    TEST_ASSERT_FALSE(ctx.fitted);
+    TEST_ASSERT_EQUAL_MEMORY(&exact, &nutation, sizeof(nutation));
+  }
+
+  /* Meeus example 22.a */
+  ln_get_nutation_ctx(&ctx, 2446895.5, &nutation);
+  ln_get_nutation_ctx(&ctx, 2446895.6, &nutation);
+  ln_get_nutation_ctx(&ctx, 2446895.5, &nutation);
+
+  TEST_ASSERT_DOUBLE_WITHIN(MARCSEC, -1.052222222e-3, nutation.longitude);
+  TEST_ASSERT_DOUBLE_WITHIN(MARCSEC,  2.623055556e-3, nutation.obliquity);
+  TEST_ASSERT_DOUBLE_WITHIN(MARCSEC,  2.344094639e+1, nutation.ecliptic);
+}
+
+void test_ln_get_nutation_iau2000b(void)
+{
+  struct ln_nutation nutation;
+  double JDE = 2453736.5;  /* 2006/1/1 00:00:0.0 TT, SOFA iauNut00b test */
+  double JD = JDE - ln_get_dynamical_time_diff(JDE) / 86400.0;
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_set_nutation_model(2));
+  TEST_ASSERT_EQUAL_INT(0, ln_set_nutation_model(LN_NUTATION_IAU2000B));
+  TEST_ASSERT_EQUAL_INT(LN_NUTATION_IAU2000B, ln_get_nutation_model());
+
+  ln_get_nutation(JD, &nutation);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-13, -0.9632552291148362783e-5, ln_deg_to_rad(nutation.longitude));
+  TEST_ASSERT_DOUBLE_WITHIN(1e-13, 0.4063197106621159367e-4, ln_deg_to_rad(nutation.obliquity));
+
+  ln_set_nutation_model(LN_NUTATION_IAU1980);
+}
+
 int main(int argc, char **argv)
 {
   UNITY_BEGIN();
 
   RUN_TEST(test_ln_get_equ_nut);
   RUN_TEST(test_ln_get_nutation);
+  RUN_TEST(test_ln_get_nutation_ctx);
+  RUN_TEST(test_ln_get_nutation_iau2000b);
 
   return UNITY_END();
 }
@@ -0,0 +1,196 @@
+/*
+ * test_planets.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ */
+
+#include "config.h"
+
+#include <libnova/libnova.h>
+
+#include <unity.h>
+
+#include <math.h>
+
+double JD;
+
+void setUp()
+{
+  int i;
+
+  JD = 2451545.0; /* 2000-01-01 12:00:00 TDB */
+  for (i = 0; i < LN_PLANET_COUNT; i++) {
+    ln_set_helio_cache_size(i, LN_HELIO_CACHE_DEFAULT);
+    ln_reset_helio_cache(i);
+  }
+}
+
+void tearDown()
+{
+}
+
+void test_ln_helio_cache_hits(void)
+{
+  struct ln_helio_posn pos, cached;
+  struct ln_cache_stats stats;
+  int i;
+
+  ln_get_mars_helio_coords(JD, &pos);
+  ln_get_mars_helio_coords(JD, &cached);
+  TEST_ASSERT_EQUAL_MEMORY(&pos, &cached, sizeof(pos));
+
+  ln_get_helio_cache_stats(LN_MARS, &stats);
+  TEST_ASSERT_EQUAL_INT(LN_HELIO_CACHE_DEFAULT, stats.size);
+  TEST_ASSERT_EQUAL_INT(1, stats.hits);
+  TEST_ASSERT_EQUAL_INT(1, stats.misses);
+
+  /* rise and set pattern, JD - 1, JD, JD + 1 */
+  ln_reset_helio_cache(LN_MARS);
+  for (i = 0; i < 9; i++)
+    ln_get_mars_helio_coords(JD + i % 3 - 1, &pos);
+
+  ln_get_helio_cache_stats(LN_MARS, &stats);
+  TEST_ASSERT_EQUAL_INT(6, stats.hits);
+  TEST_ASSERT_EQUAL_INT(3, stats.misses);
+}
+
+void test_ln_helio_cache_size(void)
+{
+  struct ln_helio_posn pos;
+  struct ln_cache_stats stats;
+  int i;
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_set_helio_cache_size(LN_EARTH, -1));
+  TEST_ASSERT_EQUAL_INT(-1, ln_set_helio_cache_size(LN_EARTH, LN_HELIO_CACHE_MAX + 1));
+  TEST_ASSERT_EQUAL_INT(-1, ln_set_helio_cache_size(LN_PLANET_COUNT, 1));
+  TEST_ASSERT_EQUAL_INT(-1, ln_reset_helio_cache(LN_PLANET_COUNT));
+  TEST_ASSERT_EQUAL_INT(-1, ln_get_helio_cache_stats(LN_PLANET_COUNT, &stats));
+  TEST_ASSERT_EQUAL_INT(0, stats.size);
+  TEST_ASSERT_EQUAL_INT(0, stats.hits);
+  TEST_ASSERT_EQUAL_INT(0, stats.misses);
+
+  /* disabled cache */
+  TEST_ASSERT_EQUAL_INT(0, ln_set_helio_cache_size(LN_EARTH, 0));
+  for (i = 0; i < 4; i++)
+    ln_get_earth_helio_coords(JD, &pos);
+  ln_get_helio_cache_stats(LN_EARTH, &stats);
+  TEST_ASSERT_EQUAL_INT(0, stats.hits);
+  TEST_ASSERT_EQUAL_INT(4, stats.misses);
+
+  /* two entries, the oldest one is replaced */
+  ln_reset_helio_cache(LN_EARTH);
+  TEST_ASSERT_EQUAL_INT(0, ln_set_helio_cache_size(LN_EARTH, 2));
+  ln_get_earth_helio_coords(JD, &pos);
+  ln_get_earth_helio_coords(JD + 1, &pos);
+  ln_get_earth_helio_coords(JD + 2, &pos);
+  ln_get_earth_helio_coords(JD + 1, &pos);
+  ln_get_earth_helio_coords(JD, &pos);
+  ln_get_helio_cache_stats(LN_EARTH, &stats);
+  TEST_ASSERT_EQUAL_INT(1, stats.hits);
+  TEST_ASSERT_EQUAL_INT(4, stats.misses);
+}
+
+void test_ln_helio_cache_results(void)
+{
+  struct ln_equ_posn equ, cached;
+  int i;
+
+  /* light time iteration alternates Earth and Mars */
+  for (i = 0; i < LN_PLANET_COUNT; i++)
+    ln_set_helio_cache_size(i, 0);
+  ln_get_mars_equ_coords(JD, &equ);
+
+  for (i = 0; i < LN_PLANET_COUNT; i++)
+    ln_set_helio_cache_size(i, LN_HELIO_CACHE_MAX);
+  ln_get_mars_equ_coords(JD, &cached);
+  ln_get_mars_equ_coords(JD, &cached);
+  TEST_ASSERT_EQUAL_MEMORY(&equ, &cached, sizeof(equ));
+}
+
+void test_ln_get_planets_posn(void)
+{
+  void (*equ_coords[LN_PLANET_COUNT])(double, struct ln_equ_posn *) = {
+    ln_get_mercury_equ_coords, ln_get_venus_equ_coords, NULL,
+    ln_get_mars_equ_coords, ln_get_jupiter_equ_coords,
+    ln_get_saturn_equ_coords, ln_get_uranus_equ_coords,
+    ln_get_neptune_equ_coords, ln_get_pluto_equ_coords
+  };
+  void (*helio_coords[LN_PLANET_COUNT])(double, struct ln_helio_posn *) = {
+    ln_get_mercury_helio_coords, ln_get_venus_helio_coords, NULL,
+    ln_get_mars_helio_coords, ln_get_jupiter_helio_coords,
+    ln_get_saturn_helio_coords, ln_get_uranus_helio_coords,
+    ln_get_neptune_helio_coords, ln_get_pluto_helio_coords
+  };
+  struct ln_planet_posn pos[LN_PLANET_COUNT], threaded[LN_PLANET_COUNT];
+  struct ln_helio_posn h_earth, h_planet, h_sol;
+  struct ln_equ_posn equ;
+  double x, y, z, L, B;
+  int i;
+
+  JD = 2460000.5;
+  ln_get_planets_posn(JD, pos, 1);
+  ln_get_planets_posn(JD, threaded, 4);
+  TEST_ASSERT_EQUAL_MEMORY(pos, threaded, sizeof(pos));
+
+  ln_get_earth_helio_coords(JD, &h_earth);
+  ln_get_solar_geom_coords(JD, &h_sol);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, h_sol.L, pos[LN_EARTH].ecl.lng);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, h_sol.R, pos[LN_EARTH].earth_dist);
+
+  for (i = 0; i < LN_PLANET_COUNT; i++) {
+    if (i == LN_EARTH)
+      continue;
+
+    equ_coords[i](JD, &equ);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, equ.ra, pos[i].equ.ra);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, equ.dec, pos[i].equ.dec);
+
+    /* ecliptical coordinates of the light time corrected position */
+    helio_coords[i](JD - pos[i].light_time, &h_planet);
+    L = ln_deg_to_rad(h_planet.L);
+    B = ln_deg_to_rad(h_planet.B);
+    x = h_planet.R * cos(B) * cos(L);
+    y = h_planet.R * cos(B) * sin(L);
+    z = h_planet.R * sin(B);
+    L = ln_deg_to_rad(h_earth.L);
+    B = ln_deg_to_rad(h_earth.B);
+    x -= h_earth.R * cos(B) * cos(L);
+    y -= h_earth.R * cos(B) * sin(L);
+    z -= h_earth.R * sin(B);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6,
+      ln_range_degrees(ln_rad_to_deg(atan2(y, x))), pos[i].ecl.lng);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6,
+      ln_rad_to_deg(atan2(z, sqrt(x * x + y * y))), pos[i].ecl.lat);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, sqrt(x * x + y * y + z * z),
+      pos[i].earth_dist);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, h_planet.R, pos[i].solar_dist);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ln_helio_cache_hits);
+  RUN_TEST(test_ln_helio_cache_size);
+  RUN_TEST(test_ln_helio_cache_results);
+  RUN_TEST(test_ln_get_planets_posn);
+
+  return UNITY_END();
+}
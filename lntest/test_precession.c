@@ -80,6 +80,42 @@ void test_ln_get_equ_prec(void)
   );
 }
 
+void test_ln_get_equ_prec_centuries(void)
+{
+  /* the t^3 terms of z reach 3 arcsec five centuries from J2000 */
+  object = (struct ln_equ_posn) {
+    .ra  = 41.05406123525553,
+    .dec = 49.22774899973002
+  };
+  struct ln_equ_posn pos, pos2;
+
+  JD = JD2000 + 5.0 * 36525.0;
+  ln_get_equ_prec(&object, JD, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, 49.84929800768105, pos.ra, "RA precession on J2500"
+  );
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, 51.17820152142167, pos.dec, "DEC precession on J2500"
+  );
+  ln_get_equ_prec2(&object, JD2000, JD, &pos2);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, pos2.ra, pos.ra, "RA precession and precession 2 on J2500"
+  );
+
+  JD = JD2000 - 5.0 * 36525.0;
+  ln_get_equ_prec(&object, JD, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, 32.79027568252683, pos.ra, "RA precession on J1500"
+  );
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, 47.00052041958249, pos.dec, "DEC precession on J1500"
+  );
+  ln_get_equ_prec2(&object, JD2000, JD, &pos2);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+    MARCSEC, pos2.ra, pos.ra, "RA precession and precession 2 on J1500"
+  );
+}
+
 void test_ln_get_equ_prec2(void)
 {
   /* Mean position after proper motion applied */
@@ -177,6 +213,7 @@ int main(int argc, char **argv)
 
   RUN_TEST(test_ln_get_equ_pm);
   RUN_TEST(test_ln_get_equ_prec);
+  RUN_TEST(test_ln_get_equ_prec_centuries);
   RUN_TEST(test_ln_get_equ_prec2);
   RUN_TEST(test_ln_get_equ_ra_out_0_360);
   RUN_TEST(test_ln_get_equ_prec_close_pole);
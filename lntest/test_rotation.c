@@ -0,0 +1,147 @@
+/*
+ * test_rotation.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ */
+
+#include "config.h"
+
+#include <libnova/libnova.h>
+
+#include <unity.h>
+
+#define MARCSEC  (0.001 / 3600.0)
+
+double JD;
+struct ln_equ_posn object;
+
+void setUp()
+{
+  object = (struct ln_equ_posn) {.ra = 41.054063, .dec = 49.227750}; /* Theta Persei */
+  JD = 2462088.69;  /* 2028/11/13.19 TD */
+}
+
+void tearDown()
+{
+}
+
+void test_ln_rot_matrix_mul(void)
+{
+  struct ln_rot_matrix prec, inverse, product;
+  int i, j;
+
+  ln_get_prec_matrix(JD, &prec);
+  ln_rot_matrix_transpose(&prec, &inverse);
+  ln_rot_matrix_mul(&inverse, &prec, &product);
+
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 3; j++)
+      TEST_ASSERT_DOUBLE_WITHIN(1e-15, i == j ? 1.0 : 0.0, product.m[i][j]);
+
+  /* rotations of one epoch combine into one */
+  ln_get_prec2_matrix(JD2000, B1950, &product);
+  ln_get_prec2_matrix(B1950, JD, &prec);
+  ln_rot_matrix_mul(&prec, &product, &product);
+  ln_get_prec_matrix(JD, &prec);
+
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 3; j++)
+      TEST_ASSERT_DOUBLE_WITHIN(1e-8, prec.m[i][j], product.m[i][j]);
+}
+
+void test_ln_get_prec_matrix(void)
+{
+  struct ln_rot_matrix matrix;
+  struct ln_equ_posn position, rotated;
+
+  ln_get_prec_matrix(JD, &matrix);
+  ln_get_equ_prec2(&object, JD2000, JD, &position);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, position.ra, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, position.dec, rotated.dec);
+
+  ln_get_prec2_matrix(JD2000, JD, &matrix);
+  ln_get_equ_prec2(&object, JD2000, JD, &position);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, position.ra, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, position.dec, rotated.dec);
+}
+
+void test_ln_get_nutation_matrix(void)
+{
+  struct ln_rot_matrix matrix;
+  struct ln_equ_posn position, rotated;
+
+  ln_get_nutation_matrix(JD, &matrix);
+  ln_get_equ_nut(&object, JD, &position);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  /* ln_get_equ_nut() is first order */
+  TEST_ASSERT_DOUBLE_WITHIN(MARCSEC, position.ra, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(MARCSEC, position.dec, rotated.dec);
+}
+
+void test_ln_get_ecl_matrix(void)
+{
+  struct ln_rot_matrix matrix;
+  struct ln_lnlat_posn ecl;
+  struct ln_equ_posn rotated;
+
+  ln_get_ecl_matrix(JD, &matrix);
+  ln_get_ecl_from_equ(&object, JD, &ecl);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, ecl.lng, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, ecl.lat, rotated.dec);
+}
+
+void test_ln_get_gal_matrix(void)
+{
+  struct ln_rot_matrix matrix;
+  struct ln_gal_posn gal;
+  struct ln_equ_posn rotated;
+
+  ln_get_gal_matrix(&matrix);
+  ln_get_gal_from_equ(&object, &gal);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, gal.l, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, gal.b, rotated.dec);
+
+  ln_get_gal2000_matrix(&matrix);
+  ln_get_gal_from_equ2000(&object, &gal);
+  ln_rot_matrix_apply_equ(&matrix, &object, &rotated);
+
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, gal.l, rotated.ra);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3 * MARCSEC, gal.b, rotated.dec);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ln_rot_matrix_mul);
+  RUN_TEST(test_ln_get_prec_matrix);
+  RUN_TEST(test_ln_get_nutation_matrix);
+  RUN_TEST(test_ln_get_ecl_matrix);
+  RUN_TEST(test_ln_get_gal_matrix);
+
+  return UNITY_END();
+}
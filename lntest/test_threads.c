@@ -0,0 +1,130 @@
+/*
+ * test_threads.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ *
+ *
+ */
+
+#include "config.h"
+
+#include <libnova/libnova.h>
+
+#include <unity.h>
+
+#include <pthread.h>
+#include <string.h>
+
+#define THREADS 8
+#define DAYS 16
+#define ROUNDS 20
+#define BODIES 9
+
+static void (*const bodies[BODIES])(double, struct ln_helio_posn *) = {
+  ln_get_mercury_helio_coords,
+  ln_get_venus_helio_coords,
+  ln_get_earth_helio_coords,
+  ln_get_mars_helio_coords,
+  ln_get_jupiter_helio_coords,
+  ln_get_saturn_helio_coords,
+  ln_get_uranus_helio_coords,
+  ln_get_neptune_helio_coords,
+  ln_get_pluto_helio_coords
+};
+
+double JD;
+
+static double days[DAYS];
+static struct ln_helio_posn helio[BODIES][DAYS];
+static struct ln_equ_posn mars_equ[DAYS];
+static struct ln_nutation nutation[DAYS];
+
+void setUp()
+{
+  JD = 2451545.0; /* 2000-01-01 12:00:00 TDB */
+}
+
+void tearDown()
+{
+}
+
+/* every thread walks the days in its own order, so the caches of the
+ * threads hold different epochs all the time */
+static void *worker(void *arg)
+{
+  long id = (long)arg;
+  long errors = 0;
+  struct ln_helio_posn pos;
+  struct ln_equ_posn equ;
+  struct ln_nutation nut;
+  int round, i, d, b;
+
+  for (round = 0; round < ROUNDS; round++) {
+    for (i = 0; i < DAYS; i++) {
+      d = (int)((i * (id + 1) + round) % DAYS);
+
+      for (b = 0; b < BODIES; b++) {
+        /* second call is served from the cache */
+        bodies[b](days[d], &pos);
+        errors += memcmp(&pos, &helio[b][d], sizeof(pos)) != 0;
+        bodies[b](days[d], &pos);
+        errors += memcmp(&pos, &helio[b][d], sizeof(pos)) != 0;
+      }
+
+      ln_get_mars_equ_coords(days[d], &equ);
+      errors += memcmp(&equ, &mars_equ[d], sizeof(equ)) != 0;
+
+      ln_get_nutation(days[d], &nut);
+      errors += memcmp(&nut, &nutation[d], sizeof(nut)) != 0;
+    }
+  }
+
+  return (void *)errors;
+}
+
+void test_thread_caches(void)
+{
+  pthread_t threads[THREADS];
+  void *errors;
+  long i;
+  int b, d;
+
+  /* single threaded reference results */
+  for (d = 0; d < DAYS; d++) {
+    days[d] = JD + d * 1.7;
+    for (b = 0; b < BODIES; b++)
+      bodies[b](days[d], &helio[b][d]);
+    ln_get_mars_equ_coords(days[d], &mars_equ[d]);
+    ln_get_nutation(days[d], &nutation[d]);
+  }
+
+  for (i = 0; i < THREADS; i++)
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, worker, (void *)i));
+
+  for (i = 0; i < THREADS; i++) {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], &errors));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, (long)errors, "results differ from single threaded run");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+
+  RUN_TEST(test_thread_caches);
+
+  return UNITY_END();
+}
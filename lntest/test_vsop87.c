@@ -27,6 +27,11 @@
 
 #include <unity.h>
 
+#include <stdio.h>
+#include <string.h>
+
+#include "vsop87-file.h"
+
 #define ARCSECTENTH (0.1 / 3600.0)
 
 double JD;
@@ -56,6 +61,47 @@ void test_ln_get_solar_equ_coords(void)
 
 /* Mercury */
 
+/* compare a batch of positions with the single position function, also
+ * for batches of zero and one position */
+static void check_helio_coords_batch(
+  void (*get_batch)(const double *, struct ln_helio_posn *, int),
+  void (*get_coords)(double, struct ln_helio_posn *),
+  double step, const char *planet)
+{
+  struct ln_helio_posn batch[300], pos, zero;
+  double days[300];
+  char msg[64];
+  int i;
+
+  for (i = 0; i < 300; i++)
+    days[i] = JD - 36525.0 + i * step;
+
+  /* no position is written for an empty batch */
+  memset(batch, 0, sizeof(batch));
+  memset(&zero, 0, sizeof(zero));
+  get_batch(days, batch, 0);
+  TEST_ASSERT_EQUAL_MEMORY(&zero, &batch[0], sizeof(zero));
+
+  get_batch(days, batch, 1);
+  get_coords(days[0], &pos);
+  snprintf(msg, sizeof(msg), "(%s Position) batch of one", planet);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, pos.L, batch[0].L, msg);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, pos.B, batch[0].B, msg);
+  TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-12, pos.R, batch[0].R, msg);
+  TEST_ASSERT_EQUAL_MEMORY(&zero, &batch[1], sizeof(zero));
+
+  get_batch(days, batch, 300);
+  for (i = 0; i < 300; i++) {
+    get_coords(days[i], &pos);
+    snprintf(msg, sizeof(msg), "(%s Position) batch L", planet);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, pos.L, batch[i].L, msg);
+    snprintf(msg, sizeof(msg), "(%s Position) batch B", planet);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-9, pos.B, batch[i].B, msg);
+    snprintf(msg, sizeof(msg), "(%s Position) batch R (AU)", planet);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(1e-12, pos.R, batch[i].R, msg);
+  }
+}
+
 void test_ln_get_mercury_helio_coords(void)
 {
   struct ln_helio_posn pos;
@@ -71,6 +117,13 @@ void test_ln_get_mercury_helio_coords(void)
   );
 }
 
+void test_ln_get_mercury_helio_coords_batch(void)
+{
+  /* steps of 13.7 days sample the fast terms of the 88 day orbit */
+  check_helio_coords_batch(ln_get_mercury_helio_coords_batch,
+    ln_get_mercury_helio_coords, 13.7, "Mercury");
+}
+
 void test_ln_get_mercury_equ_coords(void)
 {
   TEST_IGNORE();
@@ -242,6 +295,213 @@ void test_ln_get_mars_helio_coords(void)
   );
 }
 
+void test_ln_get_mars_helio_coords_batch(void)
+{
+  check_helio_coords_batch(ln_get_mars_helio_coords_batch,
+    ln_get_mars_helio_coords, 243.5, "Mars");
+}
+
+void test_ln_get_mars_helio_coords_prec(void)
+{
+  struct ln_helio_posn full, pos;
+  double day;
+  int i;
+
+  for (i = 0; i < 40; i++) {
+    day = JD - 36525.0 * 5 + i * 9131.25;
+    ln_get_mars_helio_coords(day, &full);
+
+    ln_get_mars_helio_coords_prec(day, &pos, 0.0);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.L, pos.L, "(Mars Position) L full precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.B, pos.B, "(Mars Position) B full precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-12, full.R, pos.R, "(Mars Position) R (AU) full precision"
+    );
+
+    ln_get_mars_helio_coords_prec(day, &pos, 6.0);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      60.0 / 3600.0, full.L, pos.L, "(Mars Position) L arcminute precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      60.0 / 3600.0, full.B, pos.B, "(Mars Position) B arcminute precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      full.R * ln_deg_to_rad(60.0 / 3600.0), full.R, pos.R,
+      "(Mars Position) R (AU) arcminute precision"
+    );
+  }
+}
+
+void test_ln_get_mars_helio_coords_vel(void)
+{
+  struct ln_helio_posn full, pos, vel, before, after;
+  double day, dt, h = 0.02;
+  int i;
+
+  for (i = 0; i < 40; i++) {
+    day = JD - 36525.0 * 5 + i * 9131.25;
+    ln_get_mars_helio_coords(day, &full);
+    ln_get_mars_helio_coords(day - h, &before);
+    ln_get_mars_helio_coords(day + h, &after);
+
+    dt = (day + h) - (day - h);
+
+    ln_get_mars_helio_coords_vel(day, &pos, &vel);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.L, pos.L, "(Mars Position) L"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.B, pos.B, "(Mars Position) B"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-12, full.R, pos.R, "(Mars Position) R (AU)"
+    );
+
+    /* compare against central differences, dt is the exact step */
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      3e-8, (after.L - before.L) / dt, vel.L, "(Mars Velocity) L"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, (after.B - before.B) / dt, vel.B, "(Mars Velocity) B"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-10, (after.R - before.R) / dt, vel.R, "(Mars Velocity) R (AU)"
+    );
+  }
+}
+
+void test_ln_get_helio_coords_simd(void)
+{
+  struct ln_helio_posn pos, scalar, vel;
+  double day;
+  int i;
+
+  /* the velocity functions sum the series with ln_calc_series() */
+  for (i = 0; i < 40; i++) {
+    day = JD - 36525.0 * 20 + i * 36525.0;
+
+    ln_get_mercury_helio_coords(day, &pos);
+    ln_get_mercury_helio_coords_vel(day, &scalar, &vel);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-13, scalar.L, pos.L);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-13, scalar.B, pos.B);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-14, scalar.R, pos.R);
+
+    ln_get_neptune_helio_coords(day, &pos);
+    ln_get_neptune_helio_coords_vel(day, &scalar, &vel);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-13, scalar.L, pos.L);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-13, scalar.B, pos.B);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-14, scalar.R, pos.R);
+  }
+}
+
+void test_ln_vsop87_stepper(void)
+{
+  struct ln_vsop87_stepper stepper;
+  struct ln_helio_posn full, pos;
+  double day;
+  int i;
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_vsop87_stepper_init(&stepper, LN_PLUTO, JD, 1.0, 0));
+
+  TEST_ASSERT_EQUAL_INT(0, ln_vsop87_stepper_init(&stepper, LN_MERCURY, JD - 36525.0, 0.5, 100));
+  for (i = 0; i < 1000; i++) {
+    day = ln_vsop87_stepper_next(&stepper, &pos);
+    TEST_ASSERT_EQUAL_DOUBLE(JD - 36525.0 + i * 0.5, day);
+
+    ln_get_mercury_helio_coords(day, &full);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.L, pos.L, "(Mercury Position) L stepper"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.B, pos.B, "(Mercury Position) B stepper"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-12, full.R, pos.R, "(Mercury Position) R (AU) stepper"
+    );
+  }
+  ln_vsop87_stepper_free(&stepper);
+}
+
+/* write a coefficient file where every planet has a circular orbit of
+ * radius R at longitude 1 radian */
+static int write_vsop87_file(const char *file, double R)
+{
+  struct vsop87_file_header hdr;
+  double L0[4] = {1.0, 0.0, 0.0, 0.0}, R0[4] = {0.0, 0.0, 0.0, 0.0};
+  char pad[32];
+  size_t offset = sizeof(hdr) + 32 - sizeof(hdr) % 32;
+  FILE *fd;
+  int p;
+
+  R0[0] = R;
+  memset(pad, 0, sizeof(pad));
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, VSOP87_FILE_MAGIC, sizeof(hdr.magic));
+  hdr.version = VSOP87_FILE_VERSION;
+  hdr.byte_order = VSOP87_FILE_BYTE_ORDER;
+  hdr.planets = VSOP87_FILE_PLANETS;
+  hdr.powers = VSOP87_FILE_POWERS;
+
+  /* tables at the end of the header, padded to the alignment */
+  for (p = 0; p < VSOP87_FILE_PLANETS; p++) {
+    hdr.series[p][0][0].offset = offset;
+    hdr.series[p][0][0].size = 1;
+    hdr.series[p][2][0].offset = offset + sizeof(L0);
+    hdr.series[p][2][0].size = 1;
+  }
+
+  fd = fopen(file, "wb");
+  if (fd == NULL)
+    return -1;
+  fwrite(&hdr, sizeof(hdr), 1, fd);
+  fwrite(pad, 1, offset - sizeof(hdr), fd);
+  fwrite(L0, sizeof(L0), 1, fd);
+  fwrite(R0, sizeof(R0), 1, fd);
+  fclose(fd);
+  return 0;
+}
+
+void test_ln_vsop87_load_tables(void)
+{
+  const char *file = "test_vsop87.bin";
+  struct ln_helio_posn builtin, pos;
+
+  ln_get_mars_helio_coords(JD, &builtin);
+
+  TEST_ASSERT_EQUAL_INT(-1, ln_vsop87_load_tables("no_such_file.bin"));
+  TEST_ASSERT_EQUAL_INT(0, write_vsop87_file(file, 1.5));
+  TEST_ASSERT_EQUAL_INT(0, ln_vsop87_load_tables(file));
+
+  /* cached position of the compiled in tables is not used */
+  ln_get_mars_helio_coords(JD, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-3, ln_rad_to_deg(1.0), pos.L);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-4, 0.0, pos.B);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.5, pos.R);
+
+  ln_get_jupiter_helio_coords(JD, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.5, pos.R);
+
+  /* loading a bad file keeps the current tables */
+  TEST_ASSERT_EQUAL_INT(-1, ln_vsop87_load_tables(__FILE__));
+  ln_get_mars_helio_coords(JD + 1.0, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.5, pos.R);
+
+  TEST_ASSERT_EQUAL_INT(0, write_vsop87_file(file, 2.5));
+  TEST_ASSERT_EQUAL_INT(0, ln_vsop87_load_tables(file));
+  ln_get_mars_helio_coords(JD, &pos);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-12, 2.5, pos.R);
+
+  ln_vsop87_unload_tables();
+  ln_get_mars_helio_coords(JD, &pos);
+  TEST_ASSERT_EQUAL_MEMORY(&builtin, &pos, sizeof(pos));
+
+  remove(file);
+}
+
 void test_ln_get_mars_equ_coords(void)
 {
   TEST_IGNORE();
@@ -477,6 +737,12 @@ void test_ln_get_uranus_helio_coords(void)
   );
 }
 
+void test_ln_get_uranus_helio_coords_batch(void)
+{
+  check_helio_coords_batch(ln_get_uranus_helio_coords_batch,
+    ln_get_uranus_helio_coords, 243.5, "Uranus");
+}
+
 void test_ln_get_uranus_equ_coords(void)
 {
   TEST_IGNORE();
@@ -550,6 +816,41 @@ void test_ln_get_neptune_helio_coords(void)
   );
 }
 
+void test_ln_get_neptune_helio_coords_prec(void)
+{
+  struct ln_helio_posn full, pos;
+  double day;
+  int i;
+
+  for (i = 0; i < 40; i++) {
+    day = JD - 36525.0 * 5 + i * 9131.25;
+    ln_get_neptune_helio_coords(day, &full);
+
+    ln_get_neptune_helio_coords_prec(day, &pos, 0.0);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.L, pos.L, "(Neptune Position) L full precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-9, full.B, pos.B, "(Neptune Position) B full precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      1e-12, full.R, pos.R, "(Neptune Position) R (AU) full precision"
+    );
+
+    ln_get_neptune_helio_coords_prec(day, &pos, 6.0);
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      60.0 / 3600.0, full.L, pos.L, "(Neptune Position) L arcminute precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      60.0 / 3600.0, full.B, pos.B, "(Neptune Position) B arcminute precision"
+    );
+    TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(
+      full.R * ln_deg_to_rad(60.0 / 3600.0), full.R, pos.R,
+      "(Neptune Position) R (AU) arcminute precision"
+    );
+  }
+}
+
 void test_ln_get_neptune_equ_coords(void)
 {
   TEST_IGNORE();
@@ -688,6 +989,7 @@ int main(int argc, char **argv)
 
   /* Mercury */
   RUN_TEST(test_ln_get_mercury_helio_coords);
+  RUN_TEST(test_ln_get_mercury_helio_coords_batch);
   RUN_TEST(test_ln_get_mercury_equ_coords);
   RUN_TEST(test_ln_get_mercury_earth_dist);
   RUN_TEST(test_ln_get_mercury_solar_dist);
@@ -712,6 +1014,12 @@ int main(int argc, char **argv)
 
   /* Mars */
   RUN_TEST(test_ln_get_mars_helio_coords);
+  RUN_TEST(test_ln_get_mars_helio_coords_batch);
+  RUN_TEST(test_ln_get_mars_helio_coords_prec);
+  RUN_TEST(test_ln_get_mars_helio_coords_vel);
+  RUN_TEST(test_ln_get_helio_coords_simd);
+  RUN_TEST(test_ln_vsop87_stepper);
+  RUN_TEST(test_ln_vsop87_load_tables);
   RUN_TEST(test_ln_get_mars_equ_coords);
   RUN_TEST(test_ln_get_mars_earth_dist);
   RUN_TEST(test_ln_get_mars_solar_dist);
@@ -744,6 +1052,7 @@ int main(int argc, char **argv)
 
   /* Uranus */
   RUN_TEST(test_ln_get_uranus_helio_coords);
+  RUN_TEST(test_ln_get_uranus_helio_coords_batch);
   RUN_TEST(test_ln_get_uranus_equ_coords);
   RUN_TEST(test_ln_get_uranus_earth_dist);
   RUN_TEST(test_ln_get_uranus_solar_dist);
@@ -754,6 +1063,7 @@ int main(int argc, char **argv)
 
   /* Neptune */
   RUN_TEST(test_ln_get_neptune_helio_coords);
+  RUN_TEST(test_ln_get_neptune_helio_coords_prec);
   RUN_TEST(test_ln_get_neptune_equ_coords);
   RUN_TEST(test_ln_get_neptune_earth_dist);
   RUN_TEST(test_ln_get_neptune_solar_dist);
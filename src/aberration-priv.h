@@ -0,0 +1,7 @@
+#ifndef _LN_ABERRATION_PRIV_H
+#define _LN_ABERRATION_PRIV_H
+
+/* speed of light in au per day */
+#define ABERRATION_LIGHT_SPEED	173.14463350
+
+#endif
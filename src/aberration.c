@@ -23,6 +23,8 @@
 #include <libnova/aberration.h>
 #include <libnova/solar.h>
 #include <libnova/utility.h>
+#include "aberration-priv.h"
+#include "implementation.h"
 
 #include <math.h>
 
@@ -209,26 +211,34 @@ const static struct XYZ z_coefficients[TERMS] = {
     {0, 0, -2, 0}
 };
 
-/*! \fn void ln_get_equ_aber(struct ln_equ_posn *mean_position, double JD, struct ln_equ_posn *position)
-* \param mean_position Mean position of object
+/* last Earth velocity, one per thread */
+static LN_THREAD_LOCAL double cache_JD;
+static LN_THREAD_LOCAL int cache_valid;
+static LN_THREAD_LOCAL struct ln_rect_posn cache_velocity;
+
+/*! \fn void ln_get_earth_bary_vel(double JD, struct ln_rect_posn *velocity)
 * \param JD Julian Day
-* \param position Pointer to store new object position.
+* \param velocity Pointer to store the velocity of the Earth
 *
-* Calculate a stars equatorial coordinates from it's mean equatorial coordinates
-* with the effects of aberration for a given Julian Day.
-*/
-/* Equ 22.3, 22.4
+* Calculate the velocity of the Earth relative to the barycentre of the
+* solar system in au per day, referred to the mean equator and equinox of
+* J2000.0, from the 36 terms of the Ron-Vondrak expression.
+*
+* The velocity is all of the annual aberration that depends on the julian
+* day. Pass it to ln_get_equ_aber_earth_vel() to correct many stars at the
+* same julian day. The last velocity is remembered, a second call for the
+* same julian day in the same thread costs nothing.
 */
-void ln_get_equ_aber(struct ln_equ_posn *mean_position, double JD,
-    struct ln_equ_posn *position)
+/* Chapter 23 pg 151-153 */
+void ln_get_earth_bary_vel(double JD, struct ln_rect_posn *velocity)
 {
-    long double mean_ra, mean_dec, delta_ra, delta_dec;
     long double L2, L3, L4, L5, L6, L7, L8, LL, D, MM , F, T, X, Y, Z, A;
-    long double c;
     int i;
 
-    /* speed of light in 10-8 au per day */
-    c = 17314463350.0;
+    if (cache_valid && cache_JD == JD) {
+        *velocity = cache_velocity;
+        return;
+    }
 
     /* calc T */
     T = (JD - 2451545.0) / 36525.0;
@@ -270,6 +280,60 @@ void ln_get_equ_aber(struct ln_equ_posn *mean_position, double JD,
             cos(A);
     }
 
+    /* terms are in 10-8 au per day */
+    velocity->X = X / 1e8;
+    velocity->Y = Y / 1e8;
+    velocity->Z = Z / 1e8;
+
+    cache_JD = JD;
+    cache_velocity = *velocity;
+    cache_valid = 1;
+}
+
+/*! \fn void ln_get_equ_aber(struct ln_equ_posn *mean_position, double JD, struct ln_equ_posn *position)
+* \param mean_position Mean position of object
+* \param JD Julian Day
+* \param position Pointer to store new object position.
+*
+* Calculate a stars equatorial coordinates from it's mean equatorial coordinates
+* with the effects of aberration for a given Julian Day.
+*/
+/* Equ 22.3, 22.4
+*/
+void ln_get_equ_aber(struct ln_equ_posn *mean_position, double JD,
+    struct ln_equ_posn *position)
+{
+    struct ln_rect_posn velocity;
+
+    ln_get_earth_bary_vel(JD, &velocity);
+    ln_get_equ_aber_earth_vel(mean_position, &velocity, position);
+}
+
+/*! \fn void ln_get_equ_aber_earth_vel(struct ln_equ_posn *mean_position, const struct ln_rect_posn *velocity, struct ln_equ_posn *position)
+* \param mean_position Mean position of object
+* \param velocity Velocity of the Earth from ln_get_earth_bary_vel()
+* \param position Pointer to store new object position.
+*
+* Calculate a stars equatorial coordinates from it's mean equatorial coordinates
+* with the effects of aberration for the given velocity of the Earth, the same
+* as ln_get_equ_aber() for the julian day of the velocity.
+*/
+/* Equ 22.3, 22.4
+*/
+void ln_get_equ_aber_earth_vel(struct ln_equ_posn *mean_position,
+    const struct ln_rect_posn *velocity, struct ln_equ_posn *position)
+{
+    long double mean_ra, mean_dec, delta_ra, delta_dec;
+    long double X, Y, Z;
+    long double c;
+
+    /* speed of light in au per day */
+    c = ABERRATION_LIGHT_SPEED;
+
+    X = velocity->X;
+    Y = velocity->Y;
+    Z = velocity->Z;
+
     /* Equ 22.4 */
     mean_ra = ln_deg_to_rad(mean_position->ra);
     mean_dec = ln_deg_to_rad(mean_position->dec);
@@ -23,6 +23,11 @@
 #include <libnova/aberration.h>
 #include <libnova/precession.h>
 #include <libnova/nutation.h>
+#include <libnova/rotation.h>
+#include <libnova/utility.h>
+#include "aberration-priv.h"
+
+#include <math.h>
 
 /*
 ** Apparent place of an Object
@@ -52,3 +57,86 @@ void ln_get_apparent_posn(struct ln_equ_posn *mean_position,
     ln_get_equ_prec(&aberration_position, JD, &precession_position);
     ln_get_equ_nut(&precession_position, JD, position);
 }
+
+/*! \fn void ln_get_apparent_posn_batch(const struct ln_equ_posn *mean_position, const struct ln_equ_posn *proper_motion, double JD, struct ln_equ_posn *position, int n, int threads)
+* \param mean_position Array of n mean positions of objects
+* \param proper_motion Array of n proper motions of objects, or NULL
+* \param JD Julian Day
+* \param position Array to store the n apparent positions
+* \param n Number of objects
+* \param threads Number of threads to use, 0 or 1 to use the calling thread
+*
+* Calculate the apparent equatorial positions of many stars at one julian
+* day, with the same effects as ln_get_apparent_posn(). A NULL proper_motion
+* means no proper motion.
+*
+* The Earth velocity, the precession angles and the nutation are evaluated
+* once for all stars. Every star is then moved by its proper motion,
+* aberration is added to its unit vector and the vector is rotated by the
+* product of the precession and nutation matrices. Aberration and nutation
+* are applied rigorously rather than to first order. Positions differ from
+* ln_get_apparent_posn() by about 1 milliarcsec near the equator, the
+* difference grows towards the poles where the first order formulas lose
+* accuracy.
+*
+* When libnova is built with OpenMP support the stars are spread over up to
+* threads threads, otherwise threads is ignored.
+*/
+void ln_get_apparent_posn_batch(const struct ln_equ_posn *mean_position,
+    const struct ln_equ_posn *proper_motion, double JD,
+    struct ln_equ_posn *position, int n, int threads)
+{
+    struct ln_rect_posn velocity;
+    struct ln_rot_matrix prec, nut, rot;
+    double vx, vy, vz, years;
+    int i;
+
+    /* Earth velocity in units of the speed of light */
+    ln_get_earth_bary_vel(JD, &velocity);
+    vx = velocity.X / ABERRATION_LIGHT_SPEED;
+    vy = velocity.Y / ABERRATION_LIGHT_SPEED;
+    vz = velocity.Z / ABERRATION_LIGHT_SPEED;
+
+    /* precession and nutation as one rotation */
+    ln_get_prec_matrix(JD, &prec);
+    ln_get_nutation_matrix(JD, &nut);
+    ln_rot_matrix_mul(&nut, &prec, &rot);
+
+    /* years of proper motion */
+    years = (JD - JD2000) / 365.25;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(threads > 1) num_threads(threads > 1 ? threads : 1)
+#endif
+    for (i = 0; i < n; i++) {
+        double ra, dec, cos_dec, x, y, z, r, px, py, pz;
+
+        ra = mean_position[i].ra;
+        dec = mean_position[i].dec;
+        if (proper_motion) {
+            ra += years * proper_motion[i].ra;
+            dec += years * proper_motion[i].dec;
+        }
+        ra = ln_deg_to_rad(ra);
+        dec = ln_deg_to_rad(dec);
+
+        /* unit vector plus the Earth velocity, normalised */
+        cos_dec = cos(dec);
+        x = cos_dec * cos(ra) + vx;
+        y = cos_dec * sin(ra) + vy;
+        z = sin(dec) + vz;
+        r = 1.0 / sqrt(x * x + y * y + z * z);
+        x *= r;
+        y *= r;
+        z *= r;
+
+        /* rotate to the true equator and equinox of date */
+        px = rot.m[0][0] * x + rot.m[0][1] * y + rot.m[0][2] * z;
+        py = rot.m[1][0] * x + rot.m[1][1] * y + rot.m[1][2] * z;
+        pz = rot.m[2][0] * x + rot.m[2][1] * y + rot.m[2][2] * z;
+
+        ra = ln_rad_to_deg(atan2(py, px));
+        position[i].ra = ra < 0.0 ? ra + 360.0 : ra;
+        position[i].dec = ln_rad_to_deg(atan2(pz, sqrt(px * px + py * py)));
+    }
+}
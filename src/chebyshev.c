@@ -0,0 +1,479 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <libnova/chebyshev.h>
+#include <libnova/lunar.h>
+#include <libnova/transform.h>
+#include <libnova/utility.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+/* coordinates fitted on every segment, L B R X Y Z */
+#define HELIO_COORDS		6
+
+/* coordinates fitted on every lunar segment, X Y Z */
+#define LUNAR_COORDS		3
+
+/* fit n Chebyshev coefficients to the samples f taken at the n nodes
+ * x = cos(pi * (j + 0.5) / n) */
+static void cheb_fit(const double *f, double *coeff, int n)
+{
+    double sum;
+    int j, k;
+
+    for (k = 0; k < n; k++) {
+        sum = 0.0;
+        for (j = 0; j < n; j++)
+            sum += f[j] * cos(M_PI * k * (j + 0.5) / n);
+        coeff[k] = 2.0 * sum / n;
+    }
+
+    coeff[0] *= 0.5;
+}
+
+/* evaluate a Chebyshev series for -1 <= x <= 1 using Clenshaw recurrence */
+static double cheb_eval(const double *coeff, int n, double x)
+{
+    double b0 = 0.0, b1 = 0.0, b2, x2 = 2.0 * x;
+    int k;
+
+    for (k = n - 1; k >= 1; k--) {
+        b2 = b1;
+        b1 = b0;
+        b0 = x2 * b1 - b2 + coeff[k];
+    }
+
+    return x * b0 - b1 + coeff[0];
+}
+
+/* derivative with respect to x of a Chebyshev series, the sum of
+ * k * coeff[k] * U(k - 1, x) using Clenshaw recurrence */
+static double cheb_deriv(const double *coeff, int n, double x)
+{
+    double b0 = 0.0, b1 = 0.0, b2, x2 = 2.0 * x;
+    int k;
+
+    for (k = n - 1; k >= 1; k--) {
+        b2 = b1;
+        b1 = b0;
+        b0 = x2 * b1 - b2 + k * coeff[k];
+    }
+
+    return b0;
+}
+
+/* difference of two angles in degrees, in range -180 .. 180 */
+static double angle_diff(double a, double b)
+{
+    double diff = a - b;
+
+    return diff - 360.0 * floor((diff + 180.0) / 360.0);
+}
+
+/* find segment of JD and its normalised time within the segment */
+static int cheb_segment(const double *coeff, double JD_start, double JD_end,
+    double span, int segments, double JD, double *x)
+{
+    int seg;
+
+    if (coeff == NULL || JD < JD_start || JD > JD_end)
+        return -1;
+
+    seg = (int)((JD - JD_start) / span);
+    if (seg >= segments)
+        seg = segments - 1;
+
+    *x = 2.0 * (JD - JD_start - seg * span) / span - 1.0;
+    return seg;
+}
+
+static int helio_cheb_segment(const struct ln_helio_cheb *cheb, double JD,
+    double *x)
+{
+    return cheb_segment(cheb->coeff, cheb->JD_start, cheb->JD_end,
+        cheb->span, cheb->segments, JD, x);
+}
+
+static int lunar_cheb_segment(const struct ln_lunar_cheb *cheb, double JD,
+    double *x)
+{
+    return cheb_segment(cheb->coeff, cheb->JD_start, cheb->JD_end,
+        cheb->span, cheb->segments, JD, x);
+}
+
+/*! \fn int ln_helio_cheb_init(struct ln_helio_cheb *cheb, void (*get_helio_coords)(double, struct ln_helio_posn *), double JD_start, double JD_end, double span, int order)
+* \param cheb Chebyshev ephemeris to initialise
+* \param get_helio_coords Pointer to the body heliocentric coordinates function, e.g. ln_get_mars_helio_coords
+* \param JD_start First julian day of the ephemeris
+* \param JD_end Last julian day of the ephemeris
+* \param span Maximum length of a segment in days
+* \param order Number of Chebyshev coefficients per coordinate and segment
+* \return 0 for success, -1 for invalid arguments or when out of memory.
+*
+* Fit Chebyshev polynomials to the heliocentric coordinates of a body over
+* the window JD_start to JD_end. The window is divided into segments of at
+* most span days and every coordinate of every segment is fitted by order
+* coefficients sampled at the Chebyshev nodes.
+*
+* After the fit the ephemeris is compared against get_helio_coords on a grid
+* of 2 * order points per segment, between the nodes, and the largest
+* differences are stored in max_error and max_rect_error. They estimate
+* the error of the fit, the error between the grid points can be larger.
+*
+* With 12 coefficients the error stays below 1e-8 degrees for segments of
+* 8 days for Mercury, 16 days for Earth and 32 days for Venus, Mars and
+* the outer planets.
+*
+* The coefficients must be released with ln_helio_cheb_free().
+*/
+int ln_helio_cheb_init(struct ln_helio_cheb *cheb,
+    void (*get_helio_coords)(double, struct ln_helio_posn *),
+    double JD_start, double JD_end, double span, int order)
+{
+    struct ln_helio_posn pos, fit;
+    struct ln_rect_posn rect, rect_fit;
+    double *samples, *coeff, JD, start, half, diff;
+    int seg, i, j;
+
+    cheb->coeff = NULL;
+    if (JD_end <= JD_start || span <= 0.0 || order < 1)
+        return -1;
+
+    cheb->JD_start = JD_start;
+    cheb->JD_end = JD_end;
+    cheb->order = order;
+    cheb->segments = (int)ceil((JD_end - JD_start) / span);
+    cheb->span = (JD_end - JD_start) / cheb->segments;
+
+    coeff = malloc(sizeof(double) * cheb->segments * HELIO_COORDS * order);
+    samples = malloc(sizeof(double) * HELIO_COORDS * order);
+    if (coeff == NULL || samples == NULL) {
+        free(coeff);
+        free(samples);
+        return -1;
+    }
+
+    half = cheb->span / 2.0;
+
+    for (seg = 0; seg < cheb->segments; seg++) {
+        start = JD_start + seg * cheb->span;
+
+        /* sample the body at the Chebyshev nodes */
+        for (j = 0; j < order; j++) {
+            get_helio_coords(start + half *
+                (1.0 + cos(M_PI * (j + 0.5) / order)), &pos);
+            ln_get_rect_from_helio(&pos, &rect);
+
+            /* keep longitude continuous over the segment */
+            if (j > 0)
+                pos.L = samples[j - 1] + angle_diff(pos.L, samples[j - 1]);
+
+            samples[j] = pos.L;
+            samples[order + j] = pos.B;
+            samples[2 * order + j] = pos.R;
+            samples[3 * order + j] = rect.X;
+            samples[4 * order + j] = rect.Y;
+            samples[5 * order + j] = rect.Z;
+        }
+
+        for (i = 0; i < HELIO_COORDS; i++)
+            cheb_fit(samples + i * order,
+                coeff + (seg * HELIO_COORDS + i) * order, order);
+    }
+
+    free(samples);
+    cheb->coeff = coeff;
+
+    /* measure the fit error between the nodes */
+    cheb->max_error.L = 0.0;
+    cheb->max_error.B = 0.0;
+    cheb->max_error.R = 0.0;
+    cheb->max_rect_error = 0.0;
+
+    for (i = 0; i < 2 * order * cheb->segments; i++) {
+        JD = JD_start + (i + 0.5) * cheb->span / (2 * order);
+        get_helio_coords(JD, &pos);
+        ln_get_rect_from_helio(&pos, &rect);
+        ln_get_helio_cheb_coords(cheb, JD, &fit);
+        ln_get_helio_cheb_rect(cheb, JD, &rect_fit);
+
+        diff = fabs(angle_diff(fit.L, pos.L));
+        if (diff > cheb->max_error.L)
+            cheb->max_error.L = diff;
+        diff = fabs(fit.B - pos.B);
+        if (diff > cheb->max_error.B)
+            cheb->max_error.B = diff;
+        diff = fabs(fit.R - pos.R);
+        if (diff > cheb->max_error.R)
+            cheb->max_error.R = diff;
+
+        diff = sqrt((rect_fit.X - rect.X) * (rect_fit.X - rect.X) +
+            (rect_fit.Y - rect.Y) * (rect_fit.Y - rect.Y) +
+            (rect_fit.Z - rect.Z) * (rect_fit.Z - rect.Z));
+        if (diff > cheb->max_rect_error)
+            cheb->max_rect_error = diff;
+    }
+
+    return 0;
+}
+
+/*! \fn void ln_helio_cheb_free(struct ln_helio_cheb *cheb)
+* \param cheb Chebyshev ephemeris
+*
+* Release the coefficients allocated by ln_helio_cheb_init().
+*/
+void ln_helio_cheb_free(struct ln_helio_cheb *cheb)
+{
+    free(cheb->coeff);
+    cheb->coeff = NULL;
+}
+
+/*! \fn int ln_get_helio_cheb_coords(const struct ln_helio_cheb *cheb, double JD, struct ln_helio_posn *position)
+* \param cheb Chebyshev ephemeris
+* \param JD Julian day
+* \param position Pointer to store heliocentric position
+* \return 0 for success, -1 when JD is outside of the ephemeris.
+*
+* Calculate heliocentric coordinates of the body from the Chebyshev
+* ephemeris. Longitude and Latitude are in degrees, whilst radius vector
+* is in AU. cheb->max_error is the largest error sampled by
+* ln_helio_cheb_init(), an estimate of the error rather than a bound.
+*/
+int ln_get_helio_cheb_coords(const struct ln_helio_cheb *cheb, double JD,
+    struct ln_helio_posn *position)
+{
+    const double *coeff;
+    double x;
+    int seg, n = cheb->order;
+
+    seg = helio_cheb_segment(cheb, JD, &x);
+    if (seg < 0)
+        return -1;
+
+    coeff = cheb->coeff + seg * HELIO_COORDS * n;
+    position->L = ln_range_degrees(cheb_eval(coeff, n, x));
+    position->B = cheb_eval(coeff + n, n, x);
+    position->R = cheb_eval(coeff + 2 * n, n, x);
+    return 0;
+}
+
+/*! \fn int ln_get_helio_cheb_rect(const struct ln_helio_cheb *cheb, double JD, struct ln_rect_posn *position)
+* \param cheb Chebyshev ephemeris
+* \param JD Julian day
+* \param position Pointer to store rectangular position
+* \return 0 for success, -1 when JD is outside of the ephemeris.
+*
+* Calculate rectangular heliocentric coordinates of the body, as returned
+* by ln_get_rect_from_helio(), from the Chebyshev ephemeris. Coordinates
+* are in AU. cheb->max_rect_error is the largest error sampled by
+* ln_helio_cheb_init(), an estimate of the error rather than a bound.
+*/
+int ln_get_helio_cheb_rect(const struct ln_helio_cheb *cheb, double JD,
+    struct ln_rect_posn *position)
+{
+    const double *coeff;
+    double x;
+    int seg, n = cheb->order;
+
+    seg = helio_cheb_segment(cheb, JD, &x);
+    if (seg < 0)
+        return -1;
+
+    coeff = cheb->coeff + (seg * HELIO_COORDS + 3) * n;
+    position->X = cheb_eval(coeff, n, x);
+    position->Y = cheb_eval(coeff + n, n, x);
+    position->Z = cheb_eval(coeff + 2 * n, n, x);
+    return 0;
+}
+
+/*! \fn int ln_lunar_cheb_init(struct ln_lunar_cheb *cheb, double JD_start, double JD_end, double span, int order, double precision)
+* \param cheb Chebyshev ephemeris to initialise
+* \param JD_start First julian day of the ephemeris
+* \param JD_end Last julian day of the ephemeris
+* \param span Maximum length of a segment in days
+* \param order Number of Chebyshev coefficients per coordinate and segment
+* \param precision Truncation level of the ELP series, see ln_get_lunar_geo_posn()
+* \return 0 for success, -1 for invalid arguments or when out of memory.
+*
+* Fit Chebyshev polynomials to the rectangular geocentric lunar coordinates
+* returned by ln_get_lunar_geo_posn() over the window JD_start to JD_end.
+* The window is divided into segments of at most span days and every
+* coordinate of every segment is fitted by order coefficients sampled at
+* the Chebyshev nodes.
+*
+* After the fit the ephemeris is compared against
+* ln_get_lunar_geo_posn_vel() on a grid of 2 * order points per segment,
+* between the nodes, and the largest differences of the position and of
+* the velocity, the derivative of the fit, are stored in max_error and
+* max_vel_error. They estimate the error of the fit, the error between the
+* grid points can be larger.
+*
+* With segments of 4 days 12 coefficients keep the position within 1e-4
+* km of the theory, close to the lunar motion during the rounding error of
+* a julian day. The fit needs 3 * order evaluations of the theory per
+* segment, searches that evaluate the Moon many times within a window, such
+* as the lunar phase, apsis and node searches, are much cheaper from the
+* ephemeris.
+*
+* The coefficients must be released with ln_lunar_cheb_free().
+*/
+int ln_lunar_cheb_init(struct ln_lunar_cheb *cheb, double JD_start,
+    double JD_end, double span, int order, double precision)
+{
+    struct ln_rect_posn pos, fit, vel, vel_fit;
+    double *samples, *coeff, JD, start, half, diff;
+    int seg, i, j;
+
+    cheb->coeff = NULL;
+    if (JD_end <= JD_start || span <= 0.0 || order < 1)
+        return -1;
+
+    cheb->JD_start = JD_start;
+    cheb->JD_end = JD_end;
+    cheb->order = order;
+    cheb->segments = (int)ceil((JD_end - JD_start) / span);
+    cheb->span = (JD_end - JD_start) / cheb->segments;
+
+    coeff = malloc(sizeof(double) * cheb->segments * LUNAR_COORDS * order);
+    samples = malloc(sizeof(double) * LUNAR_COORDS * order);
+    if (coeff == NULL || samples == NULL) {
+        free(coeff);
+        free(samples);
+        return -1;
+    }
+
+    half = cheb->span / 2.0;
+
+    for (seg = 0; seg < cheb->segments; seg++) {
+        start = JD_start + seg * cheb->span;
+
+        /* sample the Moon at the Chebyshev nodes */
+        for (j = 0; j < order; j++) {
+            ln_get_lunar_geo_posn(start + half *
+                (1.0 + cos(M_PI * (j + 0.5) / order)), &pos, precision);
+            samples[j] = pos.X;
+            samples[order + j] = pos.Y;
+            samples[2 * order + j] = pos.Z;
+        }
+
+        for (i = 0; i < LUNAR_COORDS; i++)
+            cheb_fit(samples + i * order,
+                coeff + (seg * LUNAR_COORDS + i) * order, order);
+    }
+
+    free(samples);
+    cheb->coeff = coeff;
+
+    /* measure the fit error between the nodes */
+    cheb->max_error = 0.0;
+    cheb->max_vel_error = 0.0;
+
+    for (i = 0; i < 2 * order * cheb->segments; i++) {
+        JD = JD_start + (i + 0.5) * cheb->span / (2 * order);
+        ln_get_lunar_geo_posn_vel(JD, &pos, &vel, precision);
+        ln_get_lunar_cheb_posn(cheb, JD, &fit);
+        ln_get_lunar_cheb_vel(cheb, JD, &vel_fit);
+
+        diff = sqrt((fit.X - pos.X) * (fit.X - pos.X) +
+            (fit.Y - pos.Y) * (fit.Y - pos.Y) +
+            (fit.Z - pos.Z) * (fit.Z - pos.Z));
+        if (diff > cheb->max_error)
+            cheb->max_error = diff;
+
+        diff = sqrt((vel_fit.X - vel.X) * (vel_fit.X - vel.X) +
+            (vel_fit.Y - vel.Y) * (vel_fit.Y - vel.Y) +
+            (vel_fit.Z - vel.Z) * (vel_fit.Z - vel.Z));
+        if (diff > cheb->max_vel_error)
+            cheb->max_vel_error = diff;
+    }
+
+    return 0;
+}
+
+/*! \fn void ln_lunar_cheb_free(struct ln_lunar_cheb *cheb)
+* \param cheb Chebyshev ephemeris
+*
+* Release the coefficients allocated by ln_lunar_cheb_init().
+*/
+void ln_lunar_cheb_free(struct ln_lunar_cheb *cheb)
+{
+    free(cheb->coeff);
+    cheb->coeff = NULL;
+}
+
+/*! \fn int ln_get_lunar_cheb_posn(const struct ln_lunar_cheb *cheb, double JD, struct ln_rect_posn *position)
+* \param cheb Chebyshev ephemeris
+* \param JD Julian day
+* \param position Pointer to store the geocentric position
+* \return 0 for success, -1 when JD is outside of the ephemeris.
+*
+* Calculate the rectangular geocentric lunar coordinates, as returned by
+* ln_get_lunar_geo_posn(), from the Chebyshev ephemeris. Coordinates are
+* in km. cheb->max_error is the largest error sampled by
+* ln_lunar_cheb_init(), an estimate of the error rather than a bound.
+*/
+int ln_get_lunar_cheb_posn(const struct ln_lunar_cheb *cheb, double JD,
+    struct ln_rect_posn *position)
+{
+    const double *coeff;
+    double x;
+    int seg, n = cheb->order;
+
+    seg = lunar_cheb_segment(cheb, JD, &x);
+    if (seg < 0)
+        return -1;
+
+    coeff = cheb->coeff + seg * LUNAR_COORDS * n;
+    position->X = cheb_eval(coeff, n, x);
+    position->Y = cheb_eval(coeff + n, n, x);
+    position->Z = cheb_eval(coeff + 2 * n, n, x);
+    return 0;
+}
+
+/*! \fn int ln_get_lunar_cheb_vel(const struct ln_lunar_cheb *cheb, double JD, struct ln_rect_posn *velocity)
+* \param cheb Chebyshev ephemeris
+* \param JD Julian day
+* \param velocity Pointer to store the geocentric velocity
+* \return 0 for success, -1 when JD is outside of the ephemeris.
+*
+* Calculate the geocentric velocity of the Moon in km per day, in the
+* frame of ln_get_lunar_geo_posn(), as the derivative of the Chebyshev
+* ephemeris. cheb->max_vel_error is the largest error sampled by
+* ln_lunar_cheb_init(), an estimate of the error rather than a bound.
+*/
+int ln_get_lunar_cheb_vel(const struct ln_lunar_cheb *cheb, double JD,
+    struct ln_rect_posn *velocity)
+{
+    const double *coeff;
+    double x, scale;
+    int seg, n = cheb->order;
+
+    seg = lunar_cheb_segment(cheb, JD, &x);
+    if (seg < 0)
+        return -1;
+
+    /* dx / dJD */
+    scale = 2.0 / cheb->span;
+
+    coeff = cheb->coeff + seg * LUNAR_COORDS * n;
+    velocity->X = cheb_deriv(coeff, n, x) * scale;
+    velocity->Y = cheb_deriv(coeff + n, n, x) * scale;
+    velocity->Z = cheb_deriv(coeff + 2 * n, n, x) * scale;
+    return 0;
+}
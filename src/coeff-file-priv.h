@@ -0,0 +1,19 @@
+#ifndef _LN_COEFF_FILE_PRIV_H
+#define _LN_COEFF_FILE_PRIV_H
+
+#include <stddef.h>
+
+/* contents of a binary coefficient file, mapped read only where
+ * <sys/mman.h> is available and otherwise read into memory */
+struct coeff_file
+{
+	void *data;
+	size_t size;
+	int mapped;
+};
+
+int coeff_file_open(const char *filename, struct coeff_file *file);
+
+void coeff_file_close(struct coeff_file *file);
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include "coeff-file-priv.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* read the whole file into memory, when it cannot be mapped */
+static void *coeff_file_read(const char *filename, size_t *size)
+{
+    FILE *fd;
+    void *data;
+    long len;
+
+    fd = fopen(filename, "rb");
+    if (fd == NULL)
+        return NULL;
+
+    if (fseek(fd, 0, SEEK_END) != 0 || (len = ftell(fd)) <= 0 ||
+        fseek(fd, 0, SEEK_SET) != 0) {
+        fclose(fd);
+        return NULL;
+    }
+
+    data = malloc(len);
+    if (data != NULL && fread(data, 1, len, fd) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+
+    fclose(fd);
+    *size = len;
+    return data;
+}
+
+#if HAVE_SYS_MMAN_H
+/* map the file read only, the pages are shared by all processes */
+static void *coeff_file_map(const char *filename, size_t *size)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    *size = st.st_size;
+    return data;
+}
+#endif
+
+/* open a coefficient file, returns 0 for success and -1 when the file
+ * cannot be read */
+int coeff_file_open(const char *filename, struct coeff_file *file)
+{
+    file->data = NULL;
+    file->size = 0;
+    file->mapped = 0;
+
+#if HAVE_SYS_MMAN_H
+    file->data = coeff_file_map(filename, &file->size);
+    file->mapped = file->data != NULL;
+#endif
+    if (file->data == NULL)
+        file->data = coeff_file_read(filename, &file->size);
+
+    return file->data != NULL ? 0 : -1;
+}
+
+/* release a coefficient file, does nothing when none is open */
+void coeff_file_close(struct coeff_file *file)
+{
+    if (file->data == NULL)
+        return;
+
+#if HAVE_SYS_MMAN_H
+    if (file->mapped)
+        munmap(file->data, file->size);
+    else
+#endif
+        free(file->data);
+
+    file->data = NULL;
+    file->size = 0;
+    file->mapped = 0;
+}
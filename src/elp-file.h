@@ -0,0 +1,59 @@
+#ifndef _LN_ELP_FILE_H
+#define _LN_ELP_FILE_H
+
+#include <stdint.h>
+
+/* Binary ELP 2000-82B coefficient file written by tools/elp82 -b and
+ * mapped by ln_lunar_load_tables(). The file holds a header followed by
+ * the packed tables of struct elp_table and the argument dictionaries of
+ * struct elp_args, in native byte order. Every array starts at a multiple
+ * of ELP_FILE_ALIGN bytes. The rows of every table are sorted by
+ * decreasing amplitude and refer to arguments of the dictionary of their
+ * row type, numbered by decreasing importance. */
+
+#define ELP_FILE_MAGIC		"LNELP82B"
+#define ELP_FILE_VERSION	1
+#define ELP_FILE_BYTE_ORDER	0x01020304
+
+/* alignment of every array in the file, same as ELP_ALIGNED */
+#define ELP_FILE_ALIGN		64
+
+/* elp1 to elp36 */
+#define ELP_FILE_TABLES		36
+
+/* main problem, Earth figure and planetary perturbations */
+#define ELP_FILE_TYPES		3
+
+/* location of the arrays of a table, size is the number of rows. arg and
+ * max_arg are arrays of uint16_t, amp, c and s arrays of double. */
+struct elp_file_table
+{
+	uint64_t arg;
+	uint64_t max_arg;
+	uint64_t amp;
+	uint64_t c;
+	uint64_t s;
+	uint32_t size;
+	uint32_t reserved;
+};
+
+/* location of a dictionary, size arguments of args int8_t multipliers */
+struct elp_file_args
+{
+	uint64_t offset;
+	uint32_t args;
+	uint32_t size;
+};
+
+struct elp_file_header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t tables;
+	uint32_t types;
+	struct elp_file_table table[ELP_FILE_TABLES];
+	struct elp_file_args dict[ELP_FILE_TYPES];
+};
+
+#endif
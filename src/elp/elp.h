@@ -34,3 +34,6 @@
 #define ELP34_SIZE	28
 #define ELP35_SIZE	13
 #define ELP36_SIZE	19
+#define ELP_MAIN_ARGS	1953
+#define ELP_EARTH_ARGS	681
+#define ELP_PLANET_ARGS	21476
@@ -1,1026 +1,994 @@
 #include "lunar-priv.h"
-const struct main_problem  elp1[] = {
-{{0.000000, 0.000000, 0.000000, 2.000000}, -411.602870, {168.480000, -18433.810000, -121.620000, 0.400000, -0.180000, 0.000000}},
-{{0.000000, 0.000000, 0.000000, 4.000000}, 0.420340, {-0.390000, 37.650000, 0.570000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 0.000000, 6.000000}, -0.000590, {0.000000, -0.080000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -6.000000}, 0.000160, {0.000000, 0.020000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -4.000000}, -0.080190, {0.770000, -7.220000, -1.460000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -2.000000}, 39.533930, {-395.240000, 1788.330000, 720.910000, -2.600000, 0.900000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 0.000000}, 22639.550000, {0.000000, 0.000000, 412529.610000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 2.000000}, -45.100320, {17.410000, -2019.780000, -830.200000, 0.090000, -0.020000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 4.000000}, 0.090920, {-0.070000, 8.140000, 1.730000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 6.000000}, -0.000190, {0.000000, -0.020000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -4.000000}, 0.000680, {0.070000, 0.060000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -2.000000}, -1.372590, {-7.580000, -62.490000, -50.120000, -0.070000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 0.000000}, 769.023260, {-257.510000, -47.390000, 28008.990000, -6.830000, -0.560000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 2.000000}, -3.997670, {2.400000, -178.940000, -146.180000, 0.050000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 4.000000}, 0.012970, {-0.010000, 1.160000, 0.480000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 6.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -4.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -2.000000}, -0.056840, {0.380000, -2.650000, -3.130000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 0.000000}, 36.123640, {-28.420000, -5.100000, 1972.740000, -0.930000, -0.080000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 2.000000}, -0.328660, {0.320000, -14.700000, -17.990000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 4.000000}, 0.001530, {0.000000, 0.140000, 0.080000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, -2.000000}, -0.003540, {0.040000, -0.170000, -0.260000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 0.000000}, 1.933670, {-2.650000, -0.440000, 140.750000, -0.100000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 2.000000}, -0.026020, {0.040000, -1.160000, -1.900000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 4.000000}, 0.000160, {0.000000, 0.010000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, -2.000000}, -0.000230, {0.000000, -0.010000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 0.000000}, 0.111000, {-0.230000, -0.040000, 10.100000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 2.000000}, -0.002010, {0.000000, -0.090000, -0.180000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, 0.000000}, 0.006650, {-0.020000, 0.000000, 0.730000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, 2.000000}, -0.000150, {0.000000, 0.000000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 7.000000, 0.000000}, 0.000410, {0.000000, 0.000000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 7.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 8.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -7.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -6.000000, 0.000000}, -0.000240, {0.000000, 0.000000, -0.030000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -5.000000, -2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -5.000000, 0.000000}, -0.003320, {-0.070000, 0.000000, -0.300000, -0.200000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, -2.000000}, 0.000640, {0.010000, 0.030000, 0.050000, 0.040000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, 0.000000}, -0.047020, {-1.040000, 0.030000, -3.420000, -2.820000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, -4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, -2.000000}, 0.006230, {0.140000, 0.280000, 0.340000, 0.370000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 0.000000}, -0.669400, {-15.550000, 0.380000, -36.530000, -40.100000, -0.020000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 2.000000}, 0.001060, {0.020000, 0.050000, 0.060000, 0.070000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, -4.000000}, -0.000170, {0.000000, -0.020000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, -2.000000}, 0.051650, {1.170000, 2.290000, 1.890000, 3.090000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 0.000000}, -9.679380, {-235.290000, 4.900000, -352.520000, -579.940000, -0.150000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 2.000000}, 0.024290, {0.740000, 1.090000, 0.890000, 1.460000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 4.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -4.000000}, -0.000630, {-0.010000, -0.060000, -0.010000, -0.040000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -2.000000}, 0.301570, {6.600000, 13.340000, 5.610000, 18.070000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 0.000000}, -147.326540, {-3778.620000, 68.680000, -2688.530000, -8829.170000, -0.760000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 2.000000}, -0.080490, {0.250000, -3.630000, -1.390000, -4.820000, -0.010000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 4.000000}, 0.000130, {0.000000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, -4.000000}, -0.000230, {0.010000, -0.020000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, -2.000000}, 0.075010, {-6.720000, 3.040000, 0.850000, 4.460000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 0.000000}, -666.441860, {-5206.840000, 258.790000, -555.980000, -39887.790000, 1.730000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 2.000000}, 0.413420, {1.500000, 18.150000, 1.190000, 24.720000, 0.010000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 4.000000}, -0.000830, {0.000000, -0.070000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -4.000000}, 0.000110, {0.000000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -2.000000}, -0.082820, {1.730000, -3.730000, -1.500000, -4.950000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 0.000000}, -109.384190, {-2193.780000, 51.640000, -2018.130000, -6556.100000, 0.540000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 2.000000}, 0.263380, {4.530000, 11.650000, 5.030000, 15.780000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 4.000000}, -0.000620, {0.000000, -0.060000, -0.010000, -0.040000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -2.000000}, 0.026770, {1.100000, 1.200000, 0.970000, 1.600000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 0.000000}, -7.630410, {-156.070000, 4.090000, -279.890000, -457.410000, 0.120000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 2.000000}, 0.043380, {0.810000, 1.920000, 1.610000, 2.600000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 4.000000}, -0.000150, {0.000000, -0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, -2.000000}, 0.001660, {0.060000, 0.080000, 0.090000, 0.100000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 0.000000}, -0.545940, {-11.180000, 0.340000, -29.970000, -32.730000, 0.010000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 2.000000}, 0.005260, {0.100000, 0.230000, 0.290000, 0.320000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, -2.000000}, 0.000140, {0.000000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, 0.000000}, -0.039470, {-0.800000, 0.030000, -2.890000, -2.370000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, 2.000000}, 0.000550, {0.010000, 0.020000, 0.040000, 0.030000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, 0.000000}, -0.002870, {-0.060000, 0.000000, -0.260000, -0.170000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 6.000000, 0.000000}, -0.000210, {0.000000, 0.000000, -0.020000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 7.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -5.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -4.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -4.000000, 0.000000}, -0.001190, {-0.040000, 0.000000, -0.090000, -0.140000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, -2.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, 0.000000}, -0.015140, {-0.500000, 0.010000, -0.830000, -1.810000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, -2.000000}, 0.001000, {0.030000, 0.040000, 0.040000, 0.120000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 0.000000}, -0.193110, {-6.230000, 0.130000, -7.040000, -23.130000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 2.000000}, 0.000600, {0.020000, 0.030000, 0.020000, 0.070000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, -2.000000}, 0.004730, {0.120000, 0.210000, 0.090000, 0.570000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 0.000000}, -2.568130, {-81.060000, 1.440000, -46.940000, -307.620000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 2.000000}, 0.000130, {0.050000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, -2.000000}, -0.003550, {-0.260000, -0.160000, 0.020000, -0.420000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 0.000000}, -7.448040, {-12.640000, 2.980000, -9.320000, -891.270000, 0.030000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 2.000000}, 0.005190, {-0.030000, 0.230000, 0.020000, 0.620000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, -2.000000}, -0.000400, {0.080000, -0.020000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 0.000000}, -1.161770, {-19.750000, 0.430000, -21.520000, -139.130000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 2.000000}, 0.002700, {0.030000, 0.120000, 0.050000, 0.320000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, -2.000000}, 0.000400, {0.020000, 0.020000, 0.020000, 0.050000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, 0.000000}, -0.065130, {-0.790000, 0.020000, -2.390000, -7.800000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, 2.000000}, 0.000350, {0.000000, 0.020000, 0.010000, 0.040000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, 0.000000}, -0.003410, {0.000000, 0.000000, -0.190000, -0.410000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 4.000000, 0.000000}, -0.000150, {0.000000, 0.000000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -4.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -3.000000, 0.000000}, -0.000350, {-0.010000, 0.000000, -0.020000, -0.060000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, 0.000000}, -0.004160, {-0.150000, 0.000000, -0.150000, -0.750000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, 0.000000}, -0.051420, {-1.820000, 0.030000, -0.940000, -9.240000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, -2.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, 0.000000}, -0.101360, {1.160000, 0.040000, -0.200000, -18.190000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, 0.000000}, -0.017960, {-0.300000, 0.000000, -0.330000, -3.230000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 2.000000, 0.000000}, -0.000950, {-0.010000, 0.000000, -0.030000, -0.170000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 3.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -2.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -1.000000, 0.000000}, -0.001080, {-0.040000, 0.000000, -0.020000, -0.260000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 0.000000, 0.000000}, -0.001280, {0.060000, 0.000000, 0.000000, -0.300000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 1.000000, 0.000000}, -0.000320, {0.000000, 0.000000, 0.000000, -0.080000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 2.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 5.000000, -1.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -4.000000, 0.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.030000, 0.040000, 0.000000}},
-{{1.000000, -3.000000, -2.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -3.000000, -1.000000, 0.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.040000, 0.080000, 0.000000}},
-{{1.000000, -3.000000, 0.000000, 0.000000}, 0.002540, {0.030000, 0.000000, 0.000000, 0.450000, 0.990000, 0.000000}},
-{{1.000000, -3.000000, 1.000000, 0.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.010000, 0.030000, 0.000000}},
-{{1.000000, -3.000000, 2.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, -3.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, -2.000000, -2.000000, 0.000000}, 0.000250, {0.000000, 0.000000, 0.010000, 0.030000, 0.100000, 0.000000}},
-{{1.000000, -2.000000, -1.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, -2.000000, -1.000000, 0.000000}, 0.002290, {0.060000, 0.000000, 0.050000, 0.270000, 0.890000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, -2.000000}, -0.000320, {0.000000, -0.010000, 0.000000, -0.040000, -0.120000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, 0.000000}, 0.043040, {-0.010000, 0.000000, 0.060000, 5.140000, 16.740000, -0.090000}},
-{{1.000000, -2.000000, 0.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, -2.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, 0.000000}, -0.000330, {-0.160000, 0.000000, -0.010000, -0.040000, -0.130000, 0.000000}},
-{{1.000000, -2.000000, 2.000000, 0.000000}, -0.000370, {-0.030000, 0.000000, -0.020000, -0.040000, -0.140000, 0.000000}},
-{{1.000000, -2.000000, 3.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, -1.000000, -5.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, -4.000000, 0.000000}, 0.000140, {0.000000, 0.000000, 0.010000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, 0.000000}, 0.000690, {0.020000, 0.000000, 0.040000, 0.040000, 0.270000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, -2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, 0.000000}, -0.006940, {-0.250000, 0.000000, -0.230000, -0.420000, -2.700000, 0.010000}},
-{{1.000000, -1.000000, -2.000000, 2.000000}, 0.000130, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, -2.000000}, -0.001000, {0.000000, -0.040000, -0.020000, -0.060000, -0.390000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, 0.000000}, -0.136360, {-3.240000, 0.190000, -2.410000, -8.170000, -53.020000, 0.280000}},
-{{1.000000, -1.000000, -1.000000, 2.000000}, 0.000130, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, -1.000000, 0.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 0.000000, -2.000000}, -0.012810, {-0.130000, -0.570000, 0.000000, -0.770000, -4.980000, 0.030000}},
-{{1.000000, -1.000000, 0.000000, 0.000000}, -0.556940, {-40.230000, 1.700000, -0.010000, -33.620000, -216.550000, 1.140000}},
-{{1.000000, -1.000000, 0.000000, 2.000000}, 0.001550, {0.090000, 0.070000, 0.000000, 0.090000, 0.600000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, -2.000000}, -0.002120, {-0.020000, -0.090000, -0.040000, -0.130000, -0.830000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, 0.000000}, -0.120730, {-6.320000, 0.250000, -2.380000, -7.230000, -46.940000, 0.250000}},
-{{1.000000, -1.000000, 1.000000, 2.000000}, 0.000600, {0.030000, 0.030000, 0.010000, 0.040000, 0.230000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, -2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, 0.000000}, -0.014830, {-0.720000, 0.030000, -0.560000, -0.890000, -5.770000, 0.030000}},
-{{1.000000, -1.000000, 2.000000, 2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, -1.000000, 3.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 3.000000, 0.000000}, -0.001490, {-0.070000, 0.000000, -0.080000, -0.090000, -0.580000, 0.000000}},
-{{1.000000, -1.000000, 3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 4.000000, 0.000000}, -0.000140, {0.000000, 0.000000, -0.010000, 0.000000, -0.050000, 0.000000}},
-{{1.000000, -1.000000, 5.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -6.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, 0.000000, -5.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -5.000000, 0.000000}, -0.000720, {-0.020000, 0.000000, -0.060000, 0.000000, -0.280000, 0.000000}},
-{{1.000000, 0.000000, -4.000000, -2.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, 0.000000, -4.000000, 0.000000}, -0.009550, {-0.280000, 0.010000, -0.700000, 0.000000, -3.710000, 0.020000}},
-{{1.000000, 0.000000, -4.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -3.000000, -2.000000}, 0.000690, {0.020000, 0.030000, 0.040000, 0.000000, 0.270000, 0.000000}},
-{{1.000000, 0.000000, -3.000000, 0.000000}, -0.128120, {-3.660000, 0.130000, -7.030000, -0.050000, -49.820000, 0.260000}},
-{{1.000000, 0.000000, -3.000000, 2.000000}, 0.000380, {0.060000, 0.020000, 0.030000, 0.000000, 0.140000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, -2.000000}, 0.002890, {0.140000, 0.120000, 0.110000, 0.000000, 1.120000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, 0.000000}, -1.752960, {-48.870000, 1.670000, -64.280000, -0.510000, -681.600000, 3.590000}},
-{{1.000000, 0.000000, -2.000000, 2.000000}, -0.001420, {0.050000, -0.070000, -0.050000, 0.000000, -0.550000, 0.000000}},
-{{1.000000, 0.000000, -1.000000, -4.000000}, 0.000190, {0.000000, 0.020000, 0.000000, 0.000000, 0.070000, 0.000000}},
-{{1.000000, 0.000000, -1.000000, -2.000000}, -0.023790, {0.120000, -1.090000, -0.420000, 0.000000, -9.250000, 0.050000}},
-{{1.000000, 0.000000, -1.000000, 0.000000}, -18.584670, {-437.660000, 18.910000, -346.510000, -1.000000, -7226.220000, 38.100000}},
-{{1.000000, 0.000000, -1.000000, 2.000000}, 0.015980, {0.320000, 0.690000, 0.300000, 0.000000, 6.210000, -0.030000}},
-{{1.000000, 0.000000, -1.000000, 4.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{1.000000, 0.000000, 0.000000, -4.000000}, 0.001230, {0.010000, 0.110000, 0.000000, 0.000000, 0.480000, 0.000000}},
-{{1.000000, 0.000000, 0.000000, -2.000000}, -0.583320, {-5.890000, -25.980000, -0.120000, 0.000000, -226.810000, 1.200000}},
-{{1.000000, 0.000000, 0.000000, 0.000000}, -124.988060, {-2831.880000, 136.180000, -86.600000, -2.680000, -48598.150000, 256.210000}},
-{{1.000000, 0.000000, 0.000000, 2.000000}, 0.254290, {5.730000, 11.110000, 0.260000, 0.000000, 98.870000, -0.520000}},
-{{1.000000, 0.000000, 0.000000, 4.000000}, -0.000540, {-0.010000, -0.050000, 0.000000, 0.000000, -0.210000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -4.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -2.000000}, -0.040120, {-0.220000, -1.800000, -0.720000, 0.000000, -15.600000, 0.080000}},
-{{1.000000, 0.000000, 1.000000, 0.000000}, -8.453080, {-187.780000, 10.100000, -158.620000, 0.770000, -3286.750000, 17.330000}},
-{{1.000000, 0.000000, 1.000000, 2.000000}, 0.044500, {0.980000, 1.940000, 0.840000, 0.000000, 17.300000, -0.090000}},
-{{1.000000, 0.000000, 1.000000, 4.000000}, -0.000150, {0.000000, -0.010000, 0.000000, 0.000000, -0.060000, 0.000000}},
-{{1.000000, 0.000000, 2.000000, -2.000000}, -0.000770, {0.030000, -0.030000, -0.030000, 0.000000, -0.300000, 0.000000}},
-{{1.000000, 0.000000, 2.000000, 0.000000}, -0.583990, {-12.360000, 0.750000, -21.520000, 0.130000, -227.070000, 1.200000}},
-{{1.000000, 0.000000, 2.000000, 2.000000}, 0.005400, {0.120000, 0.240000, 0.200000, 0.000000, 2.100000, -0.010000}},
-{{1.000000, 0.000000, 2.000000, 4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, -2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, 0.000000}, -0.040740, {-0.810000, 0.060000, -2.240000, 0.020000, -15.840000, 0.080000}},
-{{1.000000, 0.000000, 3.000000, 2.000000}, 0.000560, {0.010000, 0.020000, 0.030000, 0.000000, 0.220000, 0.000000}},
-{{1.000000, 0.000000, 4.000000, 0.000000}, -0.002850, {-0.050000, 0.000000, -0.210000, 0.000000, -1.110000, 0.000000}},
-{{1.000000, 0.000000, 4.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, 0.000000, 5.000000, 0.000000}, -0.000200, {0.000000, 0.000000, -0.020000, 0.000000, -0.080000, 0.000000}},
-{{1.000000, 0.000000, 6.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, -5.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.010000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, 1.000000, -4.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, -4.000000, 0.000000}, 0.001550, {0.020000, 0.000000, 0.110000, 0.090000, 0.600000, 0.000000}},
-{{1.000000, 1.000000, -3.000000, -2.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{1.000000, 1.000000, -3.000000, 0.000000}, 0.022960, {0.300000, 0.000000, 1.260000, 1.380000, 8.930000, -0.050000}},
-{{1.000000, 1.000000, -3.000000, 2.000000}, -0.000060, {0.020000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, -2.000000}, -0.000710, {0.000000, -0.030000, -0.030000, -0.040000, -0.270000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, 0.000000}, 0.349660, {5.360000, -0.110000, 12.830000, 20.950000, 135.950000, -0.720000}},
-{{1.000000, 1.000000, -2.000000, 2.000000}, 0.000630, {0.000000, 0.030000, 0.020000, 0.040000, 0.250000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, -2.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, 0.000000}, 1.077730, {9.380000, -1.150000, 21.490000, 64.240000, 418.880000, -2.210000}},
-{{1.000000, 1.000000, -1.000000, 2.000000}, 0.000000, {0.030000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 0.000000, -2.000000}, 0.000170, {0.030000, 0.000000, 0.070000, 0.000000, 0.070000, 0.000000}},
-{{1.000000, 1.000000, 0.000000, 0.000000}, 17.955120, {6.590000, -11.640000, 21.840000, 1074.240000, 6981.340000, -36.800000}},
-{{1.000000, 1.000000, 0.000000, 2.000000}, -0.035870, {0.000000, -1.580000, -0.050000, -2.150000, -13.950000, 0.070000}},
-{{1.000000, 1.000000, 0.000000, 4.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, -2.000000}, -0.001570, {0.360000, -0.040000, -0.040000, -0.070000, -0.560000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, 0.000000}, 1.261860, {1.830000, -0.900000, 24.500000, 75.500000, 490.640000, -2.590000}},
-{{1.000000, 1.000000, 1.000000, 2.000000}, -0.006590, {0.000000, -0.290000, -0.130000, -0.390000, -2.560000, 0.010000}},
-{{1.000000, 1.000000, 1.000000, 4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, -2.000000}, 0.000280, {0.030000, 0.010000, 0.000000, 0.020000, 0.110000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, 0.000000}, 0.092050, {0.220000, -0.070000, 3.460000, 5.510000, 35.790000, -0.190000}},
-{{1.000000, 1.000000, 2.000000, 2.000000}, -0.000840, {0.000000, -0.040000, -0.030000, -0.050000, -0.330000, 0.000000}},
-{{1.000000, 1.000000, 3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 3.000000, 0.000000}, 0.006790, {0.020000, 0.000000, 0.380000, 0.410000, 2.640000, -0.010000}},
-{{1.000000, 1.000000, 3.000000, 2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{1.000000, 1.000000, 4.000000, 0.000000}, 0.000500, {0.000000, 0.000000, 0.040000, 0.030000, 0.200000, 0.000000}},
-{{1.000000, 1.000000, 5.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, 2.000000, -4.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, 2.000000, -3.000000, 0.000000}, 0.000380, {0.020000, 0.000000, 0.020000, 0.050000, 0.150000, 0.000000}},
-{{1.000000, 2.000000, -2.000000, 0.000000}, 0.003610, {0.160000, 0.000000, 0.130000, 0.430000, 1.400000, 0.000000}},
-{{1.000000, 2.000000, -1.000000, 0.000000}, -0.003000, {-0.180000, 0.000000, -0.050000, -0.360000, -1.160000, 0.000000}},
-{{1.000000, 2.000000, -1.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.010000, 0.010000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, 0.000000}, -0.039680, {-0.610000, 0.040000, -0.070000, -4.750000, -15.430000, 0.080000}},
-{{1.000000, 2.000000, 0.000000, 2.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.010000, 0.040000, 0.000000}},
-{{1.000000, 2.000000, 1.000000, -2.000000}, 0.000020, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, 1.000000, 0.000000}, -0.008490, {-0.160000, 0.000000, -0.170000, -1.020000, -3.300000, 0.020000}},
-{{1.000000, 2.000000, 1.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, 2.000000, 2.000000, 0.000000}, -0.001020, {-0.020000, 0.000000, -0.040000, -0.120000, -0.400000, 0.000000}},
-{{1.000000, 2.000000, 2.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, 3.000000, 0.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.010000, -0.040000, 0.000000}},
-{{1.000000, 2.000000, 4.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 3.000000, -2.000000, 0.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.010000, 0.030000, 0.000000}},
-{{1.000000, 3.000000, -1.000000, 0.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.020000, -0.040000, 0.000000}},
-{{1.000000, 3.000000, 0.000000, -2.000000}, 0.000000, {0.020000, -0.010000, 0.010000, 0.020000, 0.000000, 0.000000}},
-{{1.000000, 3.000000, 0.000000, 0.000000}, -0.000560, {-0.010000, 0.000000, 0.000000, -0.100000, -0.220000, 0.000000}},
-{{1.000000, 3.000000, 1.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, -0.030000, 0.000000}},
-{{1.000000, 4.000000, 0.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -6.000000, 0.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, -2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, -1.000000, 0.000000}, 0.000270, {0.000000, 0.000000, 0.000000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 0.000000, 0.000000}, 0.000500, {0.020000, 0.000000, 0.000000, 0.150000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 1.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -3.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -2.000000, 0.000000}, 0.000320, {0.010000, 0.000000, 0.010000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -1.000000, 0.000000}, 0.008120, {0.240000, 0.000000, 0.150000, 1.940000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -1.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, 0.000000}, 0.013310, {0.580000, 0.000000, 0.020000, 3.180000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 1.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 1.000000, 0.000000}, 0.001330, {0.060000, 0.000000, 0.030000, 0.320000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 2.000000, 0.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 3.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -3.000000, 0.000000}, 0.000490, {0.010000, 0.000000, 0.030000, 0.090000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, 0.000000}, 0.009650, {0.260000, 0.000000, 0.350000, 1.730000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, -2.000000}, -0.000210, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 0.000000}, 0.246970, {6.330000, -0.030000, 4.520000, 44.320000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 2.000000}, -0.000520, {-0.010000, -0.020000, 0.000000, -0.090000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, -2.000000}, 0.001630, {0.000000, 0.070000, 0.000000, 0.290000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, 0.000000}, 0.339830, {13.410000, -0.120000, 0.740000, 60.980000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, 2.000000}, -0.000750, {-0.030000, -0.030000, 0.000000, -0.130000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, -2.000000}, -0.000650, {-0.020000, -0.030000, -0.010000, -0.120000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, 0.000000}, 0.033000, {1.420000, -0.020000, 0.670000, 5.920000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, 2.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, 0.000000}, 0.002950, {0.140000, 0.000000, 0.110000, 0.530000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 3.000000, 0.000000}, 0.000260, {0.010000, 0.000000, 0.010000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 4.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -5.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -4.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -4.000000, 0.000000}, 0.000880, {0.010000, 0.000000, 0.060000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, -2.000000}, -0.000130, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, 0.000000}, 0.015440, {0.290000, 0.000000, 0.840000, 1.850000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, -2.000000}, -0.001110, {-0.030000, -0.050000, -0.040000, -0.130000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 0.000000}, 0.294220, {6.880000, -0.030000, 10.730000, 35.210000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 2.000000}, -0.000720, {0.000000, -0.030000, -0.030000, -0.090000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, -2.000000}, -0.004340, {-0.200000, -0.190000, -0.080000, -0.520000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 0.000000}, 7.371730, {165.380000, -1.060000, 134.790000, 881.890000, -0.040000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 2.000000}, -0.015410, {-0.330000, -0.690000, -0.290000, -1.840000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, -4.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, -2.000000}, 0.063140, {0.430000, 2.820000, -0.040000, 7.550000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 0.000000}, 8.050760, {289.140000, -3.140000, 21.090000, 962.910000, -0.060000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 2.000000}, -0.018160, {-0.620000, -0.810000, -0.120000, -2.170000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 4.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -2.000000}, -0.016440, {-0.380000, -0.740000, -0.300000, -1.970000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 0.000000}, 0.751730, {29.040000, -0.430000, 15.470000, 89.900000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 2.000000}, -0.003780, {-0.140000, -0.170000, -0.090000, -0.450000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, -2.000000}, -0.001330, {-0.030000, -0.060000, -0.050000, -0.160000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, 0.000000}, 0.064390, {2.630000, -0.050000, 2.500000, 7.700000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, 2.000000}, -0.000550, {-0.020000, -0.020000, -0.020000, -0.070000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, -2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, 0.000000}, 0.005380, {0.230000, 0.000000, 0.310000, 0.640000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 4.000000, 0.000000}, 0.000440, {0.020000, 0.000000, 0.030000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 5.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -6.000000, 0.000000}, 0.000100, {0.000000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -5.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -5.000000, 0.000000}, 0.001780, {0.010000, 0.000000, 0.160000, 0.110000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, -2.000000}, -0.000360, {0.000000, -0.020000, -0.030000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, 0.000000}, 0.029490, {0.410000, 0.000000, 2.150000, 1.770000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, -2.000000}, -0.003650, {-0.080000, -0.160000, -0.200000, -0.220000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 0.000000}, 0.478420, {8.720000, -0.050000, 26.150000, 28.630000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, -2.000000}, -0.028040, {-0.740000, -1.250000, -1.030000, -1.680000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 0.000000}, 8.605820, {187.040000, -1.140000, 313.850000, 515.030000, 0.020000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 2.000000}, -0.021570, {-0.210000, -0.970000, -0.790000, -1.290000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 4.000000}, 0.000120, {0.000000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -4.000000}, -0.000150, {0.000000, -0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -2.000000}, -0.061030, {-3.570000, -2.720000, -1.220000, -3.650000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 0.000000}, 205.443150, {4157.780000, -32.990000, 3751.430000, 12284.720000, -0.130000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 2.000000}, -0.426240, {-8.300000, -19.010000, -7.930000, -25.480000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 4.000000}, 0.000930, {0.020000, 0.080000, 0.020000, 0.060000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -4.000000}, -0.002860, {-0.020000, -0.260000, 0.000000, -0.170000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -2.000000}, 2.146190, {18.770000, 95.810000, -0.840000, 128.220000, 0.050000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 0.000000}, 164.734580, {5378.280000, -77.430000, 545.710000, 9844.150000, -0.180000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 2.000000}, -0.382150, {-11.750000, -16.940000, -3.100000, -22.840000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 4.000000}, 0.000890, {0.030000, 0.080000, 0.010000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -4.000000}, 0.000180, {0.000000, 0.020000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -2.000000}, -0.374530, {-6.500000, -16.890000, -6.910000, -22.360000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 0.000000}, 14.530780, {497.460000, -9.380000, 307.250000, 867.990000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 2.000000}, -0.073730, {-2.450000, -3.260000, -1.770000, -4.400000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 4.000000}, 0.000250, {0.000000, 0.020000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -2.000000}, -0.028870, {-0.540000, -1.300000, -1.060000, -1.720000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 0.000000}, 1.177040, {41.720000, -0.960000, 46.230000, 70.280000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 2.000000}, -0.010070, {-0.350000, -0.440000, -0.420000, -0.600000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, -2.000000}, -0.002320, {-0.050000, -0.100000, -0.130000, -0.140000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, 0.000000}, 0.093200, {3.390000, -0.090000, 5.360000, 5.560000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, 2.000000}, -0.001170, {-0.040000, -0.050000, -0.070000, -0.070000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, -2.000000}, -0.000190, {0.000000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, 0.000000}, 0.007300, {0.270000, 0.000000, 0.550000, 0.440000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, 2.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, 0.000000}, 0.000570, {0.020000, 0.000000, 0.050000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 6.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -8.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -7.000000, 0.000000}, 0.000360, {0.000000, 0.000000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -6.000000, -2.000000}, -0.000110, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -6.000000, 0.000000}, 0.004970, {0.100000, 0.000000, 0.540000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, -2.000000}, -0.001110, {-0.020000, -0.050000, -0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, 0.000000}, 0.068500, {1.400000, -0.030000, 6.240000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, -2.000000}, -0.010770, {-0.240000, -0.480000, -0.790000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 0.000000}, 0.948270, {19.710000, -0.300000, 69.110000, 0.060000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 2.000000}, -0.000540, {0.000000, -0.030000, -0.040000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, -4.000000}, 0.000240, {0.000000, 0.020000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, -2.000000}, -0.091540, {-2.110000, -4.080000, -5.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 0.000000}, 13.194000, {279.870000, -3.190000, 721.290000, 0.650000, 0.140000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 2.000000}, 0.004670, {0.380000, 0.200000, 0.240000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -4.000000}, 0.000370, {0.030000, 0.030000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -2.000000}, -0.560650, {-14.540000, -24.990000, -20.690000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 0.000000}, 211.654870, {4685.540000, -42.060000, 7715.640000, 7.860000, 2.120000, -0.010000}},
-{{2.000000, 0.000000, -2.000000, 2.000000}, -0.535720, {-4.500000, -24.120000, -19.500000, 0.040000, -0.010000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 4.000000}, 0.002820, {0.020000, 0.250000, 0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -6.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -4.000000}, -0.008500, {0.000000, -0.760000, -0.140000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -2.000000}, 0.179030, {-34.060000, 7.980000, 1.010000, 0.030000, 0.180000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 0.000000}, 4586.430610, {87132.460000, -842.120000, 83586.180000, -191.170000, 20.310000, -0.170000}},
-{{2.000000, 0.000000, -1.000000, 2.000000}, -9.366010, {-173.580000, -417.660000, -173.700000, 0.480000, -0.060000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 4.000000}, 0.019930, {0.360000, 1.780000, 0.390000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 6.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -6.000000}, 0.000150, {0.000000, 0.020000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -4.000000}, -0.075180, {-0.700000, -6.720000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -2.000000}, 55.178010, {530.970000, 2463.550000, -15.350000, -6.960000, 1.200000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, 0.000000}, 2369.912270, {69551.140000, -1472.500000, 10817.070000, -255.360000, 22.070000, -0.150000}},
-{{2.000000, 0.000000, 0.000000, 2.000000}, -5.741700, {-155.850000, -254.000000, -59.770000, 0.640000, -0.100000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, 4.000000}, 0.013720, {0.350000, 1.220000, 0.210000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, 6.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -6.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -4.000000}, 0.000560, {0.100000, 0.050000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -2.000000}, -6.383250, {-72.700000, -288.510000, -117.470000, 1.160000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 0.000000}, 191.955750, {5619.270000, -153.090000, 4250.550000, -30.100000, 2.780000, -0.020000}},
-{{2.000000, 0.000000, 1.000000, 2.000000}, -0.990230, {-27.730000, -43.700000, -25.330000, 0.160000, -0.020000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 4.000000}, 0.003440, {0.090000, 0.310000, 0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 6.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -4.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -2.000000}, -0.453800, {-4.940000, -20.520000, -16.630000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 0.000000}, 14.379640, {417.800000, -13.710000, 577.470000, -3.080000, 0.280000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 2.000000}, -0.123860, {-3.490000, -5.450000, -5.280000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 4.000000}, 0.000590, {0.020000, 0.050000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -2.000000}, -0.033360, {-0.350000, -1.510000, -1.830000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 0.000000}, 1.059490, {30.460000, -1.160000, 61.740000, -0.300000, 0.030000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 2.000000}, -0.013320, {-0.370000, -0.590000, -0.800000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 4.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, -2.000000}, -0.002470, {-0.030000, -0.110000, -0.180000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 0.000000}, 0.077650, {2.200000, -0.100000, 5.930000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 2.000000}, -0.001310, {-0.040000, -0.060000, -0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, -2.000000}, -0.000180, {0.000000, 0.000000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, 0.000000}, 0.005680, {0.160000, 0.000000, 0.540000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, 2.000000}, -0.000120, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, 0.000000}, 0.000410, {0.010000, 0.000000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 7.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -7.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -6.000000, 0.000000}, 0.000150, {0.010000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -5.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -5.000000, 0.000000}, 0.001730, {0.120000, 0.000000, 0.160000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, -2.000000}, -0.000200, {-0.020000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, 0.000000}, 0.018190, {1.370000, -0.020000, 1.320000, 1.100000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, 2.000000}, -0.000030, {0.040000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, -2.000000}, -0.001160, {-0.100000, -0.050000, -0.060000, -0.070000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, 0.000000}, 0.176240, {15.800000, -0.230000, 9.590000, 10.630000, 0.050000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, 2.000000}, -0.000240, {0.000000, -0.010000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, -2.000000}, -0.003460, {-0.430000, -0.150000, -0.130000, -0.210000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 0.000000}, 2.488970, {257.300000, -3.720000, 89.710000, 150.190000, 0.260000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 2.000000}, -0.000010, {-0.340000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, -4.000000}, 0.000170, {0.000000, 0.020000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, -2.000000}, -0.002280, {0.760000, -0.110000, -0.050000, -0.130000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 0.000000}, -28.398100, {915.460000, -16.700000, -528.730000, -1693.300000, -0.380000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 2.000000}, 0.067420, {-1.630000, 3.040000, 1.290000, 4.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 4.000000}, -0.000160, {0.000000, -0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -4.000000}, 0.001980, {0.030000, 0.180000, 0.000000, 0.120000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -2.000000}, -1.437240, {-23.320000, -64.110000, -0.160000, -86.030000, -0.040000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, 0.000000}, -24.359100, {-661.000000, 29.130000, -128.060000, -1457.610000, -5.210000, 0.030000}},
-{{2.000000, 1.000000, 0.000000, 2.000000}, 0.065410, {1.460000, 2.860000, 0.750000, 3.910000, 0.030000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, 4.000000}, -0.000170, {0.000000, -0.020000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -2.000000}, 0.084720, {-0.380000, 3.850000, 1.590000, 5.050000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 0.000000}, -2.914640, {-100.960000, 4.260000, -66.130000, -174.490000, -0.750000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 2.000000}, 0.016050, {0.510000, 0.700000, 0.420000, 0.960000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 4.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, -2.000000}, 0.008890, {0.070000, 0.400000, 0.330000, 0.530000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 0.000000}, -0.290230, {-11.130000, 0.470000, -11.800000, -17.380000, -0.080000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 2.000000}, 0.002620, {0.100000, 0.110000, 0.110000, 0.160000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, -2.000000}, 0.000850, {0.010000, 0.040000, 0.050000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, 0.000000}, -0.026760, {-1.080000, 0.050000, -1.570000, -1.600000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, 2.000000}, 0.000350, {0.010000, 0.020000, 0.020000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, 0.000000}, -0.002360, {-0.100000, 0.000000, -0.180000, -0.140000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 5.000000, 0.000000}, -0.000200, {0.000000, 0.000000, -0.020000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 6.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -5.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -4.000000, 0.000000}, -0.000490, {0.000000, 0.000000, -0.040000, -0.060000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, 0.000000}, -0.009440, {-0.260000, 0.000000, -0.530000, -1.140000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, -2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 0.000000}, -0.249900, {-10.760000, 0.110000, -9.200000, -29.880000, -0.020000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 2.000000}, 0.000600, {0.020000, 0.030000, 0.020000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, -2.000000}, -0.006540, {-0.240000, -0.290000, -0.090000, -0.780000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 0.000000}, -2.521380, {-84.660000, 0.740000, -46.070000, -302.130000, 0.070000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 2.000000}, 0.005150, {0.170000, 0.230000, 0.100000, 0.620000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, -4.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, -2.000000}, -0.023490, {-0.290000, -0.900000, 0.490000, -2.750000, 0.040000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, 0.000000}, -0.185760, {-6.480000, 0.330000, -6.560000, -22.260000, 0.390000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, 2.000000}, 0.000960, {0.030000, 0.040000, 0.030000, 0.110000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, -2.000000}, -0.002000, {-0.120000, -0.070000, 0.000000, -0.230000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, 0.000000}, -0.013430, {-0.460000, 0.030000, -0.710000, -1.610000, 0.060000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, 2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, -2.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, 0.000000}, -0.000660, {-0.010000, 0.000000, -0.060000, -0.080000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 3.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -3.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -2.000000, 0.000000}, -0.000930, {-0.060000, 0.000000, -0.030000, -0.170000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, 0.000000}, -0.001880, {-0.120000, 0.000000, -0.030000, -0.340000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 0.000000, -2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 0.000000, 0.000000}, 0.000380, {0.030000, 0.000000, 0.020000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 1.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 1.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 4.000000, -2.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 4.000000, -1.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -4.000000, -1.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -4.000000, 0.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -3.000000, -2.000000, 0.000000}, -0.000170, {0.000000, 0.000000, 0.000000, -0.030000, -0.070000, 0.000000}},
-{{3.000000, -3.000000, -1.000000, 0.000000}, -0.000530, {-0.020000, 0.000000, 0.000000, -0.090000, -0.210000, 0.000000}},
-{{3.000000, -3.000000, 0.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -3.000000, 0.000000, 0.000000}, 0.000300, {0.000000, 0.000000, 0.000000, 0.050000, 0.120000, 0.000000}},
-{{3.000000, -3.000000, 1.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{3.000000, -2.000000, -3.000000, 0.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, -2.000000, -2.000000, 0.000000}, -0.003990, {-0.100000, 0.000000, -0.150000, -0.480000, -1.550000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, -2.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, 0.000000}, -0.011820, {-0.500000, 0.000000, -0.230000, -1.410000, -4.600000, 0.020000}},
-{{3.000000, -2.000000, -1.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, -2.000000}, -0.001020, {-0.020000, -0.050000, 0.000000, -0.120000, -0.400000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, 0.000000}, 0.005180, {0.050000, 0.000000, -0.050000, 0.620000, 2.010000, -0.010000}},
-{{3.000000, -2.000000, 1.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -2.000000, 1.000000, 0.000000}, 0.000370, {0.000000, 0.000000, 0.000000, 0.040000, 0.150000, 0.000000}},
-{{3.000000, -1.000000, -4.000000, 0.000000}, -0.000130, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{3.000000, -1.000000, -3.000000, 0.000000}, -0.002970, {-0.060000, 0.000000, -0.160000, -0.180000, -1.160000, 0.000000}},
-{{3.000000, -1.000000, -2.000000, 0.000000}, -0.083110, {-1.910000, 0.020000, -3.040000, -4.980000, -32.320000, 0.170000}},
-{{3.000000, -1.000000, -2.000000, 2.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.010000, 0.080000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, -2.000000}, -0.001890, {-0.020000, -0.080000, -0.030000, -0.110000, -0.730000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, 0.000000}, -0.231410, {-9.240000, 0.190000, -4.480000, -13.780000, -89.980000, 0.470000}},
-{{3.000000, -1.000000, -1.000000, 2.000000}, 0.000750, {0.030000, 0.030000, 0.020000, 0.050000, 0.290000, 0.000000}},
-{{3.000000, -1.000000, 0.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 0.000000, -2.000000}, -0.019480, {-0.340000, -0.870000, 0.000000, -1.160000, -7.570000, 0.040000}},
-{{3.000000, -1.000000, 0.000000, 0.000000}, 0.065070, {-0.180000, 0.160000, -1.040000, 3.930000, 25.300000, -0.130000}},
-{{3.000000, -1.000000, 0.000000, 2.000000}, 0.000200, {0.020000, 0.000000, 0.000000, 0.010000, 0.080000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, -2.000000}, -0.000840, {0.000000, -0.040000, -0.010000, -0.050000, -0.330000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, 0.000000}, 0.003300, {-0.250000, 0.030000, -0.050000, 0.210000, 1.280000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, 0.000000}, -0.000110, {-0.050000, 0.000000, -0.010000, 0.000000, -0.040000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 3.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 0.000000, -5.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 0.000000, -4.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -4.000000, 0.000000}, -0.001740, {0.000000, 0.000000, -0.130000, 0.000000, -0.680000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, -2.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, 0.000000}, -0.044420, {-0.910000, 0.000000, -2.430000, -0.030000, -17.270000, 0.090000}},
-{{3.000000, 0.000000, -3.000000, 2.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, -2.000000}, -0.000280, {0.020000, -0.010000, 0.000000, 0.000000, -0.110000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, 0.000000}, -1.224120, {-28.100000, 0.420000, -44.730000, -0.150000, -475.970000, 2.510000}},
-{{3.000000, 0.000000, -2.000000, 2.000000}, 0.002980, {0.070000, 0.130000, 0.110000, 0.000000, 1.160000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, 4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, -4.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, -2.000000}, -0.029790, {-0.390000, -1.330000, -0.540000, 0.000000, -11.590000, 0.060000}},
-{{3.000000, 0.000000, -1.000000, 0.000000}, -3.209680, {-121.620000, 3.090000, -62.390000, 1.610000, -1248.010000, 6.580000}},
-{{3.000000, 0.000000, -1.000000, 2.000000}, 0.012150, {0.480000, 0.530000, 0.250000, 0.000000, 4.720000, -0.020000}},
-{{3.000000, 0.000000, -1.000000, 4.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, -4.000000}, 0.000250, {0.000000, 0.020000, 0.000000, 0.000000, 0.100000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, -2.000000}, -0.253040, {-3.600000, -11.270000, 0.100000, 0.080000, -98.390000, 0.520000}},
-{{3.000000, 0.000000, 0.000000, 0.000000}, 0.404230, {-12.920000, 2.280000, -14.170000, 1.050000, 157.170000, -0.830000}},
-{{3.000000, 0.000000, 0.000000, 2.000000}, 0.003750, {0.240000, 0.160000, 0.110000, 0.000000, 1.460000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, 4.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -2.000000}, -0.010620, {-0.050000, -0.470000, -0.180000, 0.000000, -4.130000, 0.020000}},
-{{3.000000, 0.000000, 1.000000, 0.000000}, 0.000370, {-3.590000, 0.360000, -1.360000, 0.180000, 0.140000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, 2.000000}, 0.000830, {0.060000, 0.030000, 0.030000, 0.000000, 0.320000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, -2.000000}, -0.000510, {0.000000, -0.020000, -0.020000, 0.000000, -0.200000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, 0.000000}, -0.003890, {-0.500000, 0.040000, -0.260000, 0.020000, -1.510000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, 2.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, 0.000000}, -0.000620, {-0.050000, 0.000000, -0.040000, 0.000000, -0.240000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 4.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, 1.000000, -5.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 1.000000, -4.000000, 0.000000}, -0.000590, {-0.020000, 0.000000, -0.040000, -0.040000, -0.230000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, 0.000000}, -0.006230, {-0.300000, 0.000000, -0.340000, -0.370000, -2.420000, 0.010000}},
-{{3.000000, 1.000000, -3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, 0.000000}, -0.041890, {-2.510000, 0.020000, -1.500000, -2.520000, -16.290000, 0.090000}},
-{{3.000000, 1.000000, -2.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, -2.000000}, 0.001160, {0.020000, 0.050000, 0.020000, 0.070000, 0.450000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, 0.000000}, 0.273770, {5.060000, -0.240000, 5.220000, 16.360000, 106.450000, -0.560000}},
-{{3.000000, 1.000000, -1.000000, 2.000000}, -0.001380, {-0.020000, -0.060000, -0.030000, -0.080000, -0.530000, 0.000000}},
-{{3.000000, 1.000000, 0.000000, -2.000000}, 0.008910, {0.140000, 0.400000, -0.010000, 0.530000, 3.460000, -0.020000}},
-{{3.000000, 1.000000, 0.000000, 0.000000}, 0.149900, {4.450000, -0.270000, 1.610000, 8.950000, 58.290000, -0.310000}},
-{{3.000000, 1.000000, 0.000000, 2.000000}, -0.000960, {-0.030000, -0.040000, -0.010000, -0.060000, -0.370000, 0.000000}},
-{{3.000000, 1.000000, 1.000000, -2.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.010000, 0.080000, 0.000000}},
-{{3.000000, 1.000000, 1.000000, 0.000000}, 0.022440, {0.700000, -0.040000, 0.590000, 1.340000, 8.730000, -0.050000}},
-{{3.000000, 1.000000, 1.000000, 2.000000}, -0.000220, {0.000000, 0.000000, 0.000000, -0.010000, -0.090000, 0.000000}},
-{{3.000000, 1.000000, 2.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, 2.000000, 0.000000}, 0.002560, {0.080000, 0.000000, 0.110000, 0.150000, 1.000000, 0.000000}},
-{{3.000000, 1.000000, 2.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{3.000000, 1.000000, 3.000000, 0.000000}, 0.000260, {0.000000, 0.000000, 0.020000, 0.020000, 0.100000, 0.000000}},
-{{3.000000, 1.000000, 4.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, -4.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, -3.000000, 0.000000}, -0.000200, {0.000000, 0.000000, -0.010000, -0.020000, -0.080000, 0.000000}},
-{{3.000000, 2.000000, -2.000000, 0.000000}, -0.000360, {-0.060000, 0.000000, -0.010000, -0.040000, -0.140000, 0.000000}},
-{{3.000000, 2.000000, -1.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, -1.000000, 0.000000}, -0.001270, {0.070000, 0.000000, -0.030000, -0.150000, -0.490000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, -2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, -0.040000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, 0.000000}, -0.001910, {-0.050000, 0.000000, -0.020000, -0.230000, -0.740000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, 1.000000, 0.000000}, -0.000390, {-0.010000, 0.000000, 0.000000, -0.050000, -0.150000, 0.000000}},
-{{3.000000, 2.000000, 2.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 3.000000, -3.000000, 0.000000}, 0.000000, {0.000000, 0.000000, 0.000000, -0.020000, -0.030000, 0.000000}},
-{{3.000000, 3.000000, -2.000000, -2.000000}, 0.000000, {-0.030000, 0.010000, -0.030000, 0.000000, -0.080000, 0.000000}},
-{{3.000000, 3.000000, -2.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{3.000000, 3.000000, -1.000000, 0.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, -0.050000, 0.000000}},
-{{3.000000, 3.000000, 0.000000, -2.000000}, -0.000020, {-0.090000, 0.070000, -0.080000, -0.080000, 0.050000, 0.000000}},
-{{3.000000, 3.000000, 0.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -5.000000, -2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -5.000000, -1.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{4.000000, -5.000000, 0.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -3.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -2.000000, 0.000000}, 0.000330, {0.020000, 0.000000, 0.010000, 0.080000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -1.000000, 0.000000}, 0.000860, {0.050000, 0.000000, 0.020000, 0.210000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 0.000000, 0.000000}, 0.000540, {0.040000, 0.000000, 0.000000, 0.130000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 1.000000, 0.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -3.000000, 0.000000}, 0.000270, {0.010000, 0.000000, 0.010000, 0.050000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -2.000000, 0.000000}, 0.007550, {0.330000, 0.000000, 0.280000, 1.350000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -2.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, 0.000000}, 0.017410, {0.970000, -0.010000, 0.360000, 3.120000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, 2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, -2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, 0.000000}, 0.009710, {0.650000, 0.000000, 0.110000, 1.740000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, 0.000000}, 0.001600, {0.110000, 0.000000, 0.040000, 0.290000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 2.000000, 0.000000}, 0.000200, {0.010000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 3.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -5.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -4.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, 0.000000}, 0.005600, {0.270000, 0.000000, 0.310000, 0.670000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 0.000000}, 0.157810, {6.460000, -0.060000, 5.770000, 18.870000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 2.000000}, -0.000900, {-0.040000, -0.040000, -0.030000, -0.110000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, -2.000000}, 0.001080, {0.000000, 0.050000, 0.020000, 0.130000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 0.000000}, 0.308740, {16.370000, -0.230000, 6.490000, 36.900000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 2.000000}, -0.001600, {-0.080000, -0.070000, -0.040000, -0.190000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, -2.000000}, 0.000910, {0.070000, 0.040000, -0.020000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, 0.000000}, 0.152270, {9.620000, -0.170000, 1.880000, 18.190000, 0.010000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, 2.000000}, -0.000890, {-0.050000, -0.040000, -0.020000, -0.110000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, -2.000000}, -0.000520, {-0.020000, -0.020000, -0.010000, -0.060000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, 0.000000}, 0.024110, {1.580000, -0.030000, 0.660000, 2.880000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, 2.000000}, -0.000210, {-0.010000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, -2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, 0.000000}, 0.002900, {0.200000, 0.000000, 0.130000, 0.350000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 3.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 3.000000, 0.000000}, 0.000310, {0.020000, 0.000000, 0.020000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -6.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -5.000000, 0.000000}, -0.000340, {-0.010000, 0.000000, -0.030000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, 0.000000}, -0.000200, {0.000000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, -2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 0.000000}, 0.099820, {4.580000, -0.040000, 5.460000, 5.980000, 0.020000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 2.000000}, -0.000780, {-0.030000, -0.040000, -0.040000, -0.050000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, -2.000000}, 0.000430, {0.000000, 0.020000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 0.000000}, 2.731980, {106.730000, -1.040000, 99.830000, 163.200000, 0.110000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 2.000000}, -0.015330, {-0.590000, -0.680000, -0.570000, -0.920000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 4.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -2.000000}, 0.022890, {0.270000, 1.020000, 0.410000, 1.360000, 0.020000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 0.000000}, 4.374160, {221.000000, -3.710000, 93.870000, 260.990000, -0.050000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 2.000000}, -0.022730, {-1.120000, -1.000000, -0.560000, -1.360000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 4.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -2.000000}, 0.006660, {0.750000, 0.260000, -0.270000, 0.390000, 0.020000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 0.000000}, 1.870830, {111.800000, -2.350000, 25.650000, 111.490000, 0.160000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 2.000000}, -0.011140, {-0.640000, -0.490000, -0.230000, -0.660000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 4.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -4.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -2.000000}, -0.007320, {-0.280000, -0.330000, -0.180000, -0.440000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 0.000000}, 0.282510, {17.390000, -0.420000, 8.050000, 16.820000, 0.020000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 2.000000}, -0.002510, {-0.150000, -0.110000, -0.080000, -0.150000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, -2.000000}, -0.001210, {-0.050000, -0.050000, -0.050000, -0.070000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, 0.000000}, 0.032740, {2.050000, -0.060000, 1.490000, 1.950000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, 2.000000}, -0.000410, {-0.030000, -0.020000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, -2.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, 0.000000}, 0.003360, {0.210000, 0.000000, 0.210000, 0.200000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 4.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 4.000000, 0.000000}, 0.000320, {0.020000, 0.000000, 0.030000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 5.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -7.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -6.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -6.000000, 0.000000}, -0.000620, {-0.030000, 0.000000, -0.070000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -5.000000, -2.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -5.000000, 0.000000}, -0.004310, {-0.180000, 0.000000, -0.390000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, -2.000000}, 0.000420, {0.020000, 0.020000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 0.000000}, -0.000700, {0.030000, 0.000000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, -2.000000}, 0.000230, {0.020000, 0.010000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 0.000000}, 1.186820, {52.890000, -0.500000, 64.880000, 0.220000, 0.250000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 2.000000}, -0.009340, {-0.290000, -0.420000, -0.510000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 4.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -4.000000}, 0.000130, {0.000000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -2.000000}, 0.006620, {0.090000, 0.290000, 0.240000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 0.000000}, 30.772470, {1164.740000, -12.420000, 1123.350000, -4.250000, 1.180000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 2.000000}, -0.169770, {-6.360000, -7.540000, -6.260000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 4.000000}, 0.000610, {0.020000, 0.050000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -4.000000}, 0.000170, {0.010000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -2.000000}, 0.300860, {5.060000, 13.370000, 5.390000, -0.190000, 0.150000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 0.000000}, 38.429740, {1853.280000, -37.860000, 849.770000, -9.840000, 0.080000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 2.000000}, -0.201340, {-9.450000, -8.850000, -5.160000, 0.050000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 4.000000}, 0.000720, {0.030000, 0.060000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -2.000000}, -0.023910, {4.230000, -1.470000, -2.510000, -0.040000, 0.160000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 0.000000}, 13.899030, {782.370000, -19.880000, 215.740000, -5.220000, 1.370000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 2.000000}, -0.085000, {-4.560000, -3.710000, -1.970000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 4.000000}, 0.000350, {0.020000, 0.030000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -4.000000}, -0.000610, {0.000000, -0.050000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -2.000000}, -0.066010, {-2.120000, -2.980000, -1.620000, 0.030000, 0.020000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 0.000000}, 1.977720, {113.340000, -3.310000, 59.210000, -0.940000, 0.180000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 2.000000}, -0.017810, {-0.990000, -0.770000, -0.630000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 4.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, -4.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, -2.000000}, -0.009800, {-0.350000, -0.440000, -0.410000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 0.000000}, 0.218530, {12.570000, -0.410000, 10.190000, -0.130000, 0.020000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 2.000000}, -0.002740, {-0.150000, -0.120000, -0.140000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, -2.000000}, -0.001090, {-0.040000, -0.050000, -0.070000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, 0.000000}, 0.021490, {1.240000, -0.040000, 1.380000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, 2.000000}, -0.000360, {-0.020000, -0.020000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, -2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, 0.000000}, 0.001980, {0.110000, 0.000000, 0.160000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 5.000000, 0.000000}, 0.000170, {0.010000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 6.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -6.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -5.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -4.000000, 0.000000}, 0.000640, {0.060000, 0.000000, 0.050000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, 0.000000}, 0.026820, {3.500000, -0.050000, 1.450000, 1.600000, 0.020000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, 2.000000}, -0.000030, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, -2.000000}, -0.000390, {-0.020000, -0.020000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 0.000000}, -0.357590, {7.750000, -0.180000, -13.130000, -21.490000, -0.040000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 2.000000}, 0.002200, {-0.030000, 0.100000, 0.080000, 0.130000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, -2.000000}, -0.018750, {-0.680000, -0.830000, -0.350000, -1.120000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 0.000000}, -0.635230, {-17.620000, 0.740000, -14.320000, -38.110000, -0.210000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 2.000000}, 0.003530, {0.090000, 0.150000, 0.090000, 0.210000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, -2.000000}, 0.000510, {-0.280000, 0.040000, 0.020000, 0.030000, -0.010000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 0.000000}, -0.289110, {-15.100000, 0.590000, -4.730000, -17.300000, -0.060000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 2.000000}, 0.001860, {0.090000, 0.080000, 0.050000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -4.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -2.000000}, 0.001830, {0.030000, 0.080000, 0.040000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, 0.000000}, -0.050700, {-2.990000, 0.120000, -1.550000, -3.030000, -0.010000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, 2.000000}, 0.000480, {0.030000, 0.020000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, -2.000000}, 0.000320, {0.010000, 0.010000, 0.010000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, 0.000000}, -0.006680, {-0.420000, 0.020000, -0.320000, -0.400000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, 2.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, 0.000000}, -0.000770, {-0.050000, 0.000000, -0.050000, -0.050000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 4.000000, 0.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -4.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, 0.000000}, -0.003690, {-0.240000, 0.000000, -0.200000, -0.440000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, 0.000000}, -0.035140, {-2.040000, 0.020000, -1.290000, -4.210000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, 2.000000}, 0.000190, {0.010000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, -2.000000}, 0.000900, {0.060000, 0.040000, 0.020000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, 0.000000}, -0.021710, {-1.510000, 0.030000, -0.570000, -2.600000, 0.010000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, 2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, 0.000000}, -0.002080, {-0.160000, 0.000000, -0.120000, -0.250000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, 2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 1.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 1.000000, 0.000000}, -0.000080, {0.000000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -2.000000, 0.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -1.000000, 0.000000}, 0.000230, {0.010000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, 0.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 4.000000, -2.000000, -2.000000}, 0.000000, {-0.020000, 0.000000, 0.000000, 0.040000, -0.060000, 0.000000}},
-{{5.000000, -3.000000, -2.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, -3.000000, 0.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, -3.000000, 0.000000}, -0.000130, {0.000000, 0.000000, 0.000000, -0.020000, -0.050000, 0.000000}},
-{{5.000000, -2.000000, -2.000000, 0.000000}, -0.000520, {-0.030000, 0.000000, -0.020000, -0.060000, -0.200000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, 0.000000}, -0.000110, {-0.020000, 0.000000, 0.000000, -0.010000, -0.040000, 0.000000}},
-{{5.000000, -2.000000, 0.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, 0.000000, 0.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.010000, 0.050000, 0.000000}},
-{{5.000000, -2.000000, 1.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -4.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, -1.000000, -3.000000, 0.000000}, -0.001890, {-0.080000, 0.000000, -0.100000, -0.110000, -0.730000, 0.000000}},
-{{5.000000, -1.000000, -3.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, 0.000000}, -0.006930, {-0.400000, 0.000000, -0.260000, -0.410000, -2.700000, 0.010000}},
-{{5.000000, -1.000000, -2.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, -2.000000}, -0.000400, {-0.020000, -0.020000, 0.000000, -0.020000, -0.160000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, 0.000000}, -0.001540, {-0.210000, 0.010000, -0.080000, -0.090000, -0.600000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, -2.000000}, -0.000210, {0.000000, 0.000000, 0.000000, -0.010000, -0.080000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, 0.000000}, 0.001020, {0.010000, 0.000000, -0.020000, 0.060000, 0.400000, 0.000000}},
-{{5.000000, -1.000000, 1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, -1.000000, 1.000000, 0.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{5.000000, 0.000000, -4.000000, 0.000000}, -0.000590, {-0.030000, 0.000000, -0.040000, 0.000000, -0.230000, 0.000000}},
-{{5.000000, 0.000000, -3.000000, 0.000000}, -0.016860, {-0.720000, 0.000000, -0.920000, 0.000000, -6.560000, 0.030000}},
-{{5.000000, 0.000000, -3.000000, 2.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{5.000000, 0.000000, -2.000000, -2.000000}, -0.000310, {0.000000, -0.010000, -0.010000, 0.000000, -0.120000, 0.000000}},
-{{5.000000, 0.000000, -2.000000, 0.000000}, -0.057250, {-3.180000, 0.070000, -2.180000, 0.050000, -22.260000, 0.120000}},
-{{5.000000, 0.000000, -2.000000, 2.000000}, 0.000390, {0.020000, 0.020000, 0.020000, 0.000000, 0.150000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, -2.000000}, -0.003350, {-0.110000, -0.150000, -0.060000, 0.000000, -1.300000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, 0.000000}, -0.013500, {-1.570000, 0.090000, -0.640000, 0.060000, -5.250000, 0.030000}},
-{{5.000000, 0.000000, -1.000000, 2.000000}, 0.000240, {0.020000, 0.010000, 0.000000, 0.000000, 0.090000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, -4.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, -2.000000}, -0.001370, {-0.060000, -0.060000, 0.000000, 0.000000, -0.530000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, 0.000000}, 0.004390, {-0.050000, 0.030000, -0.180000, 0.030000, 1.710000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, 2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, -2.000000}, -0.000190, {0.000000, 0.000000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, 0.000000}, 0.000500, {-0.030000, 0.000000, -0.020000, 0.000000, 0.200000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, 2.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, 2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, -4.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 1.000000, -3.000000, 0.000000}, -0.000460, {-0.050000, 0.000000, -0.020000, -0.030000, -0.180000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, 0.000000}, 0.003920, {0.120000, 0.000000, 0.150000, 0.230000, 1.520000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, -2.000000}, 0.000160, {0.000000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, 0.000000}, 0.004750, {0.240000, -0.010000, 0.120000, 0.280000, 1.850000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, 2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, -2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, 0.000000}, 0.001810, {0.110000, 0.000000, 0.050000, 0.110000, 0.700000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, 1.000000, 0.000000}, 0.000350, {0.020000, 0.000000, 0.010000, 0.020000, 0.140000, 0.000000}},
-{{5.000000, 1.000000, 2.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{5.000000, 2.000000, -3.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 2.000000, -2.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 2.000000, -1.000000, 0.000000}, -0.000080, {0.000000, 0.000000, 0.000000, -0.010000, -0.030000, 0.000000}},
-{{5.000000, 2.000000, 0.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 2.000000, 1.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 3.000000, -2.000000, -2.000000}, 0.000000, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{6.000000, -4.000000, -3.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -4.000000, -2.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -4.000000, -1.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -4.000000, 0.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -3.000000, 0.000000}, 0.000200, {0.010000, 0.000000, 0.010000, 0.030000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -2.000000, 0.000000}, 0.000590, {0.040000, 0.000000, 0.020000, 0.110000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -1.000000, 0.000000}, 0.000590, {0.050000, 0.000000, 0.020000, 0.110000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 0.000000, 0.000000}, 0.000240, {0.020000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 1.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -4.000000, 0.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -3.000000, 0.000000}, 0.003120, {0.190000, 0.000000, 0.170000, 0.370000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -3.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, 0.000000}, 0.008360, {0.590000, 0.000000, 0.330000, 1.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, 0.000000}, 0.007440, {0.610000, -0.010000, 0.210000, 0.890000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, 0.000000}, 0.002850, {0.260000, 0.000000, 0.070000, 0.340000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 1.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 1.000000, 0.000000}, 0.000560, {0.050000, 0.000000, 0.020000, 0.070000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 2.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 3.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -5.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -4.000000, 0.000000}, 0.001760, {0.110000, 0.000000, 0.130000, 0.110000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -4.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 0.000000}, 0.039000, {2.280000, -0.020000, 2.140000, 2.330000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 2.000000}, -0.000390, {-0.020000, -0.020000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, -2.000000}, 0.000440, {0.010000, 0.020000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 0.000000}, 0.090330, {6.230000, -0.110000, 3.590000, 5.380000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 2.000000}, -0.000800, {-0.050000, -0.040000, -0.030000, -0.050000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, -2.000000}, 0.000180, {0.020000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, 0.000000}, 0.071420, {5.640000, -0.120000, 2.050000, 4.250000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, 2.000000}, -0.000640, {-0.050000, -0.030000, -0.020000, -0.040000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, -2.000000}, -0.000250, {0.000000, -0.010000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, 0.000000}, 0.025100, {2.160000, -0.050000, 0.660000, 1.490000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, 2.000000}, -0.000260, {-0.020000, -0.010000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, -2.000000}, -0.000160, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, 0.000000}, 0.004770, {0.420000, -0.010000, 0.180000, 0.280000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, 0.000000}, 0.000690, {0.060000, 0.000000, 0.040000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 3.000000, 0.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -5.000000, 0.000000}, 0.000200, {0.010000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 0.000000}, 0.013760, {0.880000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 2.000000}, -0.000170, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, -2.000000}, 0.000180, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 0.000000}, 0.292550, {16.720000, -0.190000, 16.040000, -0.080000, 0.030000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 2.000000}, -0.002870, {-0.160000, -0.130000, -0.160000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, -2.000000}, 0.003640, {0.130000, 0.160000, 0.130000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 0.000000}, 0.571560, {38.340000, -0.750000, 22.970000, -0.260000, 0.020000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 2.000000}, -0.005090, {-0.340000, -0.220000, -0.220000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, -2.000000}, 0.000070, {0.080000, 0.000000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 0.000000}, 0.394510, {30.100000, -0.740000, 11.790000, -0.250000, 0.030000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 2.000000}, -0.003590, {-0.270000, -0.160000, -0.130000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -4.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -2.000000}, -0.002140, {-0.070000, -0.100000, -0.070000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, 0.000000}, 0.126160, {10.430000, -0.290000, 3.570000, -0.100000, 0.020000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, 2.000000}, -0.001320, {-0.110000, -0.060000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, -4.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, -2.000000}, -0.000940, {-0.050000, -0.040000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, 0.000000}, 0.022850, {1.930000, -0.060000, 0.910000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, 2.000000}, -0.000310, {-0.020000, -0.010000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, -2.000000}, -0.000180, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, 0.000000}, 0.003180, {0.270000, 0.000000, 0.180000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, 2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 3.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 3.000000, 0.000000}, 0.000380, {0.030000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 4.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -5.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -4.000000, 0.000000}, 0.000280, {0.050000, 0.000000, 0.020000, 0.020000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -3.000000, 0.000000}, -0.004780, {0.050000, 0.000000, -0.260000, -0.290000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -3.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, -2.000000}, -0.000260, {-0.010000, -0.010000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, 0.000000}, -0.012820, {-0.470000, 0.020000, -0.520000, -0.770000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, 2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, -2.000000}, -0.000070, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, 0.000000}, -0.010640, {-0.660000, 0.020000, -0.320000, -0.640000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, 2.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, 0.000000}, -0.003960, {-0.310000, 0.010000, -0.120000, -0.240000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, 0.000000}, -0.000830, {-0.070000, 0.000000, -0.030000, -0.050000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 2.000000, 0.000000}, -0.000130, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 3.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -4.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -3.000000, 0.000000}, -0.000510, {-0.040000, 0.000000, -0.030000, -0.060000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -2.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -2.000000, 0.000000}, -0.000610, {-0.060000, 0.000000, -0.030000, -0.070000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -1.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -1.000000, 0.000000}, -0.000210, {-0.020000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, 0.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 3.000000, -2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -2.000000, -3.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -2.000000, -2.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -4.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{7.000000, -1.000000, -3.000000, 0.000000}, -0.000160, {-0.010000, 0.000000, 0.000000, -0.010000, -0.060000, 0.000000}},
-{{7.000000, -1.000000, -2.000000, 0.000000}, -0.000120, {-0.010000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{7.000000, -1.000000, 0.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -5.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -4.000000, 0.000000}, -0.000250, {-0.020000, 0.000000, -0.020000, 0.000000, -0.100000, 0.000000}},
-{{7.000000, 0.000000, -3.000000, 0.000000}, -0.000980, {-0.070000, 0.000000, -0.060000, 0.000000, -0.380000, 0.000000}},
-{{7.000000, 0.000000, -3.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, 0.000000}, -0.000680, {-0.070000, 0.000000, -0.030000, 0.000000, -0.260000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, 2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, 0.000000}, -0.000050, {-0.020000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{7.000000, 0.000000, 0.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, 0.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{7.000000, 1.000000, -3.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{7.000000, 1.000000, -2.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{7.000000, 1.000000, -1.000000, 0.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{7.000000, 1.000000, 0.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{8.000000, -3.000000, -3.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -3.000000, -2.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -3.000000, -1.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -4.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -3.000000, 0.000000}, 0.000190, {0.020000, 0.000000, 0.010000, 0.020000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -2.000000, 0.000000}, 0.000250, {0.030000, 0.000000, 0.010000, 0.030000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -1.000000, 0.000000}, 0.000150, {0.020000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, 0.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, 1.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -5.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -4.000000, 0.000000}, 0.000580, {0.040000, 0.000000, 0.040000, 0.030000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -3.000000, 0.000000}, 0.001700, {0.150000, 0.000000, 0.100000, 0.100000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -3.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, 0.000000}, 0.001960, {0.190000, 0.000000, 0.090000, 0.120000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, 0.000000}, 0.001120, {0.120000, 0.000000, 0.040000, 0.070000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, 2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 0.000000, 0.000000}, 0.000370, {0.040000, 0.000000, 0.020000, 0.020000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 1.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 2.000000, 0.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -5.000000, 0.000000}, 0.000180, {0.010000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -4.000000, 0.000000}, 0.003240, {0.250000, 0.000000, 0.240000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -4.000000, 2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, -2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, 0.000000}, 0.008400, {0.720000, -0.010000, 0.490000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, 2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, -2.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, 0.000000}, 0.008660, {0.830000, -0.020000, 0.400000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, 2.000000}, -0.000110, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, 0.000000}, 0.004550, {0.470000, -0.010000, 0.180000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, 0.000000}, 0.001390, {0.150000, 0.000000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 1.000000, -2.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 1.000000, 0.000000}, 0.000290, {0.030000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 2.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -4.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -3.000000, 0.000000}, -0.000240, {-0.010000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -2.000000, 0.000000}, -0.000290, {-0.020000, 0.000000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -1.000000, 0.000000}, -0.000170, {-0.020000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, 0.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, 1.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 2.000000, -3.000000, 0.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{9.000000, 0.000000, -4.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{9.000000, 0.000000, -3.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -3.000000, 0.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -2.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -1.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -5.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -4.000000, 0.000000}, 0.000120, {0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -3.000000, 0.000000}, 0.000170, {0.020000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -2.000000, 0.000000}, 0.000130, {0.020000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -1.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, 0.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
+
+static const uint16_t arg[] = {
+1, 3, 4, 7, 8, 10, 11, 12, 14, 16,
+17, 18, 20, 22, 23, 24, 25, 26, 29, 31,
+32, 33, 34, 37, 38, 39, 40, 42, 43, 45,
+46, 47, 49, 50, 52, 56, 58, 66, 67, 70,
+72, 74, 75, 76, 77, 82, 83, 84, 85, 87,
+92, 79, 95, 96, 98, 99, 100, 103, 104, 106,
+107, 114, 115, 119, 123, 124, 125, 126, 127, 128,
+129, 130, 132, 134, 135, 137, 113, 138, 140, 141,
+142, 144, 145, 148, 151, 153, 155, 156, 157, 159,
+160, 161, 162, 165, 167, 169, 170, 171, 174, 175,
+179, 180, 181, 65, 183, 186, 188, 189, 190, 195,
+201, 202, 204, 205, 210, 214, 215, 219, 220, 222,
+223, 224, 226, 227, 229, 198, 182, 231, 234, 235,
+216, 237, 238, 240, 241, 242, 244, 245, 228, 246,
+248, 184, 257, 259, 266, 267, 269, 272, 273, 274,
+275, 276, 279, 280, 281, 282, 283, 285, 290, 291,
+296, 297, 298, 305, 307, 309, 312, 314, 315, 316,
+317, 321, 313, 324, 163, 326, 328, 329, 330, 331,
+333, 334, 336, 337, 338, 343, 344, 345, 347, 349,
+352, 353, 355, 357, 360, 361, 363, 367, 368, 369,
+370, 372, 375, 376, 379, 381, 382, 383, 385, 386,
+387, 392, 395, 400, 402, 404, 405, 414, 418, 419,
+420, 421, 423, 426, 429, 430, 431, 432, 433, 435,
+436, 437, 440, 441, 442, 443, 446, 447, 449, 452,
+302, 454, 277, 456, 459, 465, 466, 470, 473, 480,
+481, 486, 488, 472, 489, 491, 494, 496, 497, 499,
+500, 403, 502, 507, 490, 509, 515, 517, 519, 520,
+522, 523, 524, 526, 527, 528, 529, 530, 532, 534,
+535, 537, 538, 540, 541, 542, 543, 498, 545, 548,
+550, 554, 555, 556, 557, 558, 559, 563, 564, 565,
+566, 567, 570, 574, 576, 578, 581, 586, 587, 589,
+595, 599, 503, 320, 603, 606, 608, 609, 613, 614,
+615, 616, 617, 625, 628, 629, 630, 633, 634, 635,
+637, 641, 643, 644, 645, 648, 650, 653, 654, 553,
+656, 657, 658, 660, 663, 592, 669, 670, 671, 677,
+678, 679, 680, 684, 688, 691, 694, 696, 699, 702,
+703, 705, 707, 709, 711, 718, 719, 722, 724, 725,
+727, 729, 730, 732, 735, 736, 737, 738, 742, 743,
+604, 747, 748, 750, 751, 754, 757, 759, 760, 761,
+763, 764, 766, 770, 774, 714, 776, 781, 783, 785,
+787, 789, 791, 365, 793, 794, 795, 796, 506, 800,
+803, 805, 806, 807, 773, 811, 813, 814, 816, 818,
+819, 822, 826, 829, 830, 831, 832, 833, 834, 835,
+836, 838, 840, 842, 415, 844, 847, 848, 849, 850,
+851, 853, 856, 859, 860, 861, 862, 406, 864, 865,
+866, 868, 869, 871, 873, 876, 889, 890, 533, 896,
+897, 898, 901, 904, 905, 685, 906, 907, 908, 909,
+911, 912, 916, 917, 919, 920, 924, 925, 292, 927,
+929, 930, 932, 934, 935, 936, 937, 938, 940, 758,
+948, 949, 951, 953, 954, 955, 957, 958, 961, 967,
+970, 972, 710, 977, 978, 983, 984, 986, 989, 990,
+991, 992, 994, 985, 997, 999, 1000, 1003, 1004, 1005,
+1006, 1007, 1009, 1011, 518, 1015, 1016, 1020, 1025, 1026,
+1030, 1031, 1032, 1035, 1036, 1039, 690, 1041, 1042, 1043,
+1044, 1047, 1049, 1050, 1051, 1052, 1054, 1056, 1058, 1059,
+1060, 1061, 1062, 1063, 1064, 1065, 804, 881, 350, 1070,
+1071, 1073, 893, 1077, 1079, 1080, 1081, 1082, 1086, 1087,
+1088, 1089, 1092, 1093, 1100, 1101, 1102, 1104, 1111, 1112,
+1113, 1114, 1115, 1116, 1117, 1121, 1122, 1123, 1126, 1127,
+1132, 1133, 1134, 1136, 1137, 1140, 1141, 1142, 1143, 1145,
+1146, 1147, 1149, 1152, 593, 1153, 1154, 1155, 1159, 1160,
+1161, 1162, 1163, 1164, 1166, 1167, 1169, 1173, 1176, 1177,
+1084, 1179, 1180, 1184, 1185, 1186, 1187, 1188, 1189, 1192,
+1194, 1195, 1198, 1199, 1200, 1202, 1204, 1206, 1207, 1208,
+1217, 1068, 1226, 1227, 1228, 1237, 1238, 1240, 1241, 1247,
+1248, 1249, 1250, 1252, 1253, 1256, 698, 1257, 1258, 1259,
+1260, 1175, 1261, 1262, 1254, 1263, 1268, 762, 1269, 1274,
+1275, 1278, 1285, 1286, 1287, 956, 1288, 1289, 1290, 1291,
+1292, 1307, 1308, 1309, 1310, 1311, 1312, 1017, 512, 1318,
+1174, 1319, 1320, 1321, 1283, 1327, 1328, 968, 1329, 1330,
+1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1350, 1351,
+1352, 1353, 1354, 1355, 1356, 1370, 1371, 1372, 1373, 1374,
+1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+1385, 1386, 1387, 1410, 1411, 1412, 1413, 1414, 1415, 1416,
+1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1431, 1432,
+1433, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
+1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
+1465, 1466, 1467, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+1504, 1505, 1506, 1507, 1508, 1509, 1519, 1527, 1528, 1529,
+1530, 1531, 1532, 1533, 1534, 1523, 1535, 1536, 1537, 1538,
+1539, 1001, 1540, 1225, 1541, 1542, 1543, 1544, 1022, 1545,
+1546, 1547, 1548, 1549, 1069, 1550, 1551, 1369, 1552, 1553,
+1554, 1555, 1556, 1557, 1558, 1596, 1597, 1598, 1599, 1600,
+1601, 1602, 1603, 1604, 1524, 1623, 1628, 1629, 1630, 1631,
+1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
+1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
+1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
+1672, 1673, 1674, 1325, 1053, 1525, 1434, 1675, 1676, 1677,
+1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1624, 1686,
+1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1784, 1797,
+1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+1808, 1809, 1810, 1811, 1812, 1813, 1785, 1814, 1815, 1324,
+1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+1826, 1827, 1790, 1828, 1829, 1830, 1435, 1831, 1832, 1833,
+1834, 1835, 1836, 1837, 1838, 1839, 1786, 1840, 1841, 1842,
+1843, 1844, 1845, 1846, 1847, 1625, 1848, 1849, 1850, 1851,
+1526, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
+1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+1871, 1872, 1326, 1873, 1874, 1875, 715, 1947, 1948, 1950,
+1951, 639, 1952,
+};
+
+static const uint16_t max_arg[] = {
+1, 3, 4, 7, 8, 10, 11, 12, 14, 16,
+17, 18, 20, 22, 23, 24, 25, 26, 29, 31,
+32, 33, 34, 37, 38, 39, 40, 42, 43, 45,
+46, 47, 49, 50, 52, 56, 58, 66, 67, 70,
+72, 74, 75, 76, 77, 82, 83, 84, 85, 87,
+92, 92, 95, 96, 98, 99, 100, 103, 104, 106,
+107, 114, 115, 119, 123, 124, 125, 126, 127, 128,
+129, 130, 132, 134, 135, 137, 137, 138, 140, 141,
+142, 144, 145, 148, 151, 153, 155, 156, 157, 159,
+160, 161, 162, 165, 167, 169, 170, 171, 174, 175,
+179, 180, 181, 181, 183, 186, 188, 189, 190, 195,
+201, 202, 204, 205, 210, 214, 215, 219, 220, 222,
+223, 224, 226, 227, 229, 229, 229, 231, 234, 235,
+235, 237, 238, 240, 241, 242, 244, 245, 245, 246,
+248, 248, 257, 259, 266, 267, 269, 272, 273, 274,
+275, 276, 279, 280, 281, 282, 283, 285, 290, 291,
+296, 297, 298, 305, 307, 309, 312, 314, 315, 316,
+317, 321, 321, 324, 324, 326, 328, 329, 330, 331,
+333, 334, 336, 337, 338, 343, 344, 345, 347, 349,
+352, 353, 355, 357, 360, 361, 363, 367, 368, 369,
+370, 372, 375, 376, 379, 381, 382, 383, 385, 386,
+387, 392, 395, 400, 402, 404, 405, 414, 418, 419,
+420, 421, 423, 426, 429, 430, 431, 432, 433, 435,
+436, 437, 440, 441, 442, 443, 446, 447, 449, 452,
+452, 454, 454, 456, 459, 465, 466, 470, 473, 480,
+481, 486, 488, 488, 489, 491, 494, 496, 497, 499,
+500, 500, 502, 507, 507, 509, 515, 517, 519, 520,
+522, 523, 524, 526, 527, 528, 529, 530, 532, 534,
+535, 537, 538, 540, 541, 542, 543, 543, 545, 548,
+550, 554, 555, 556, 557, 558, 559, 563, 564, 565,
+566, 567, 570, 574, 576, 578, 581, 586, 587, 589,
+595, 599, 599, 599, 603, 606, 608, 609, 613, 614,
+615, 616, 617, 625, 628, 629, 630, 633, 634, 635,
+637, 641, 643, 644, 645, 648, 650, 653, 654, 654,
+656, 657, 658, 660, 663, 663, 669, 670, 671, 677,
+678, 679, 680, 684, 688, 691, 694, 696, 699, 702,
+703, 705, 707, 709, 711, 718, 719, 722, 724, 725,
+727, 729, 730, 732, 735, 736, 737, 738, 742, 743,
+743, 747, 748, 750, 751, 754, 757, 759, 760, 761,
+763, 764, 766, 770, 774, 774, 776, 781, 783, 785,
+787, 789, 791, 791, 793, 794, 795, 796, 796, 800,
+803, 805, 806, 807, 807, 811, 813, 814, 816, 818,
+819, 822, 826, 829, 830, 831, 832, 833, 834, 835,
+836, 838, 840, 842, 842, 844, 847, 848, 849, 850,
+851, 853, 856, 859, 860, 861, 862, 862, 864, 865,
+866, 868, 869, 871, 873, 876, 889, 890, 890, 896,
+897, 898, 901, 904, 905, 905, 906, 907, 908, 909,
+911, 912, 916, 917, 919, 920, 924, 925, 925, 927,
+929, 930, 932, 934, 935, 936, 937, 938, 940, 940,
+948, 949, 951, 953, 954, 955, 957, 958, 961, 967,
+970, 972, 972, 977, 978, 983, 984, 986, 989, 990,
+991, 992, 994, 994, 997, 999, 1000, 1003, 1004, 1005,
+1006, 1007, 1009, 1011, 1011, 1015, 1016, 1020, 1025, 1026,
+1030, 1031, 1032, 1035, 1036, 1039, 1039, 1041, 1042, 1043,
+1044, 1047, 1049, 1050, 1051, 1052, 1054, 1056, 1058, 1059,
+1060, 1061, 1062, 1063, 1064, 1065, 1065, 1065, 1065, 1070,
+1071, 1073, 1073, 1077, 1079, 1080, 1081, 1082, 1086, 1087,
+1088, 1089, 1092, 1093, 1100, 1101, 1102, 1104, 1111, 1112,
+1113, 1114, 1115, 1116, 1117, 1121, 1122, 1123, 1126, 1127,
+1132, 1133, 1134, 1136, 1137, 1140, 1141, 1142, 1143, 1145,
+1146, 1147, 1149, 1152, 1152, 1153, 1154, 1155, 1159, 1160,
+1161, 1162, 1163, 1164, 1166, 1167, 1169, 1173, 1176, 1177,
+1177, 1179, 1180, 1184, 1185, 1186, 1187, 1188, 1189, 1192,
+1194, 1195, 1198, 1199, 1200, 1202, 1204, 1206, 1207, 1208,
+1217, 1217, 1226, 1227, 1228, 1237, 1238, 1240, 1241, 1247,
+1248, 1249, 1250, 1252, 1253, 1256, 1256, 1257, 1258, 1259,
+1260, 1260, 1261, 1262, 1262, 1263, 1268, 1268, 1269, 1274,
+1275, 1278, 1285, 1286, 1287, 1287, 1288, 1289, 1290, 1291,
+1292, 1307, 1308, 1309, 1310, 1311, 1312, 1312, 1312, 1318,
+1318, 1319, 1320, 1321, 1321, 1327, 1328, 1328, 1329, 1330,
+1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1350, 1351,
+1352, 1353, 1354, 1355, 1356, 1370, 1371, 1372, 1373, 1374,
+1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+1385, 1386, 1387, 1410, 1411, 1412, 1413, 1414, 1415, 1416,
+1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1431, 1432,
+1433, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
+1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
+1465, 1466, 1467, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+1504, 1505, 1506, 1507, 1508, 1509, 1519, 1527, 1528, 1529,
+1530, 1531, 1532, 1533, 1534, 1534, 1535, 1536, 1537, 1538,
+1539, 1539, 1540, 1540, 1541, 1542, 1543, 1544, 1544, 1545,
+1546, 1547, 1548, 1549, 1549, 1550, 1551, 1551, 1552, 1553,
+1554, 1555, 1556, 1557, 1558, 1596, 1597, 1598, 1599, 1600,
+1601, 1602, 1603, 1604, 1604, 1623, 1628, 1629, 1630, 1631,
+1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
+1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
+1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
+1672, 1673, 1674, 1674, 1674, 1674, 1674, 1675, 1676, 1677,
+1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1685, 1686,
+1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1784, 1797,
+1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+1808, 1809, 1810, 1811, 1812, 1813, 1813, 1814, 1815, 1815,
+1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+1826, 1827, 1827, 1828, 1829, 1830, 1830, 1831, 1832, 1833,
+1834, 1835, 1836, 1837, 1838, 1839, 1839, 1840, 1841, 1842,
+1843, 1844, 1845, 1846, 1847, 1847, 1848, 1849, 1850, 1851,
+1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
+1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+1871, 1872, 1872, 1873, 1874, 1875, 1875, 1947, 1948, 1950,
+1951, 1951, 1952,
+};
+
+static const double ELP_ALIGNED amp[] = {
+22639.585779999783, 4586.4383030482413, 2369.9139392170182, 769.02571212064083,
+-666.41710350524488, -411.5956722539517, 211.65555045555556, 205.43581754495605,
+191.95619698055046, 164.72851067770688, -147.32128695221752, -124.98811884997961,
+-109.38029152528641, 55.17704960898589, -45.09960222672089, 39.533294846642107,
+38.429834539229823, 36.123813678767867, 30.772574871068475, -28.397082101606109,
+-24.358212338620138, -18.584706787435177, 17.954455689537255, 14.530268320821619,
+14.379697344712016, 13.899059697433019, 13.194063384267789, -9.6790503673222954,
+-9.3658620284143055, 8.6055260752023823, -8.453098171936281, 8.0501618065821727,
+-7.6301502626761346, -7.447485471464419, 7.3711914505201896, -6.3831480863566981,
+-5.7416062472501928, 4.3740066189929863, -3.9976127354056374, -3.2096876157228866,
+-2.9145384452924774, 2.7318871580458453, -2.5679425540909007, -2.521195632587292,
+2.4888854424583369, 2.1460723999452451, 1.9777270098531954, 1.9336824423566752,
+1.8707635234326729, -1.7529659058834621, -1.4371612257872322, -1.3725698661367376,
+1.261815334548221, -1.2241239477742394, 1.1868256821760201, 1.1770005002971526,
+-1.1616851618482078, 1.0776922015320931, 1.0594959939813802, -0.99021520624362558,
+0.94827607277695591, 0.75167537534057838, -0.66937827791124027, -0.63520773475829995,
+-0.58399223988376081, -0.58330985023303894, 0.5715624455486874, -0.56064201501978006,
+-0.55691967084933913, -0.545922295332263, -0.53571228385428427, 0.47840441076242296,
+-0.45379348014929738, -0.42621734391648503, 0.4203253264023018, 0.41339757059148174,
+0.40422722435341507, 0.39451146622077399, -0.38212938265318991, -0.37451003268772687,
+-0.35757765071651765, 0.34964807428159111, 0.33979203489338344, -0.32865581190371806,
+0.30871761179214624, 0.30155398679824569, 0.30085535746880604, 0.29419895713202798,
+0.29255151442959165, -0.29022035464026719, -0.28909983807170408, 0.28250035911531046,
+0.27376033109557757, 0.26336602735178849, 0.25428567748872871, -0.25303563377877913,
+-0.24988218348421065, 0.24694273034572545, -0.23140185805839836, 0.21853112454481052,
+-0.20133701738664361, -0.19309621888121814, -0.18574679866535543, 0.17902695036433208,
+0.17623428346546699, -0.16976761277048513, 0.15779874125045584, 0.15225887126721879,
+0.14989465656636866, -0.13635518177553779, -0.12812062905785798, 0.12616048484413014,
+-0.12385834524328818, -0.12072578938500593, 0.1110008916610703, -0.10134867537740934,
+0.099816755063919793, 0.093197028260304113, 0.09204688700937419, -0.091538840652026526,
+0.090916966899834181, 0.090326994780609016, -0.084998738519387607, 0.084715479206418559,
+-0.083107161858049991, -0.08281558084813738, -0.080485691493041592, -0.080187303291296072,
+0.077650572030115356, -0.075177366892444752, 0.07500610055323817, -0.073726131219942467,
+0.071417570720518117, 0.06850055286096865, 0.06741641313718931, -0.066008993778875244,
+0.065406505184683855, -0.065125344811016755, 0.065067393346210381, 0.064385428409945142,
+0.063134179585263892, -0.061026762909326793, -0.057250247446015763, -0.056839235213631316,
+0.051647338978221734, -0.051414323771696469, -0.050698289273472953, -0.047018547511284078,
+0.044499314133387487, -0.044420191950083079, 0.043377765355544419, 0.043036795808646923,
+-0.041888564277954156, -0.040740230161511848, -0.040119358521312036, -0.039677055794669604,
+-0.039468782533558504, 0.038998738458432214, -0.035868044015185202, -0.035137490893805072,
+-0.033359568213737117, 0.032996369447580352, 0.032738935006736518, -0.029789526698408331,
+0.029489081278239959, -0.028868509584793603, -0.028038551498779034, 0.02681914607534109,
+0.026768615776657505, -0.026759156631173703, -0.026019711176632113, 0.025099146321089359,
+0.024288739290388783, 0.024108270631263605, -0.023909618138649127, -0.02378961017702937,
+-0.023487888460711009, 0.022959247592637164, 0.022888787499854124, 0.022850114760163083,
+-0.022728808278949731, 0.022439230074951338, -0.021708437659199616, -0.021568883722094416,
+0.021490147745885833, 0.019929337733671896, -0.019478935460323477, -0.018749006424452888,
+0.018189435394415806, -0.018158338689386828, -0.017958011818946063, -0.017809753472371206,
+0.017408086973591006, -0.016860079741348174, -0.016438506567875311, 0.016049163245398339,
+0.015979756166714678, 0.015438917713797419, -0.015408606427033808, -0.015329209047162612,
+-0.015138945719806746, -0.014829504541564934, 0.013760086679413185, 0.013719541110713085,
+-0.013500128064030415, -0.013429068013676312, -0.013319838644010817, 0.013308016134137452,
+0.012969588013701659, -0.012819572112065988, -0.012809296304692779, 0.012149814390483465,
+-0.011819139519574232, -0.01113941619626768, -0.010769880800198795, -0.010639635924726609,
+-0.010619831809297086, -0.010069489709312174, -0.0097998634769044368, 0.0097089230596640753,
+0.0096489501433626446, -0.0095500646014261368, -0.0094393341463413442, -0.0093398799749005654,
+0.0089095117714696782, 0.0088895412698671572, 0.0086600424635811819, -0.0084997149440999183,
+-0.0084893778508736955, 0.0084000463657784071, 0.0083594041943655314, 0.0081188016757274429,
+0.0075491813365501613, 0.0074394663787402775, -0.0073196118158529314, 0.0072997729544717798,
+-0.0069397576851301873, -0.0069297665218779371, 0.0067897769531541658, -0.006679785793356467,
+0.0066596313503168693, 0.0066500633164340017, 0.0066199074057552033, -0.0065896543543193763,
+-0.0065394073612162719, -0.0062297984426934365, 0.0062296889616551224, 0.0056800468261369568,
+0.0055996085284573905, 0.0053999234841913641, 0.0053796272626469681, 0.0052597353995528784,
+0.0051895246720766557, 0.0051796085347183118, 0.005149531598513158, -0.0050899330293707884,
+0.0049700468298020262, -0.0047798414801312177, 0.0047698446671906461, 0.0047498394716054861,
+0.0047295697748270067, 0.0046699425826050639, 0.0045500194937675934, 0.0043899539254221194,
+-0.0043396079431998703, -0.0043100338149401332, -0.0041595447071575307, -0.0039897132937572631,
+-0.0039598644455814845, 0.0039198693904625532, -0.0038900506478264552, -0.0037796603426187123,
+0.0037499469558294686, -0.0036897425996956727, -0.0036498174074935429, 0.0036399486992563668,
+0.003609742775215862, -0.0035899486907045356, -0.0035496734368934903, -0.0035399560744453621,
+0.0035298180206568179, -0.0034598214692147873, 0.0034398874420974428, -0.003409760478770475,
+0.003359893322829459, -0.0033499465378432564, -0.0033199011373663692, 0.0032998528230756942,
+0.0032400208006890855, 0.0031800155954773424, 0.0031197837081626645, -0.0029997795430846026,
+0.0029799586981553417, -0.0029699014815403558, 0.0029496786045804524, 0.002899792726055915,
+0.0028899626044425852, -0.0028699630309403134, -0.0028699164003967094, -0.0028597921790305789,
+-0.0028500182093567691, 0.0028497937623161904, 0.002819910909416269, -0.0027399652073949593,
+0.0026997576034472523, 0.0026198666163149255, 0.0025599158756305133, 0.0025397190205883389,
+-0.0025098702551810729, -0.0024699725945589537, -0.0023599281910461224, -0.0023198847523704519,
+0.0022898357460313808, -0.0022798801966037443, 0.0021998866645142339, -0.0021399669619742946,
+-0.0021198871014783153, -0.0020798543003216099, -0.0020099804174057924, -0.0019998290090656192,
+0.0019800138705875123, 0.0019798546820539442, 0.0019599328673942356, -0.0019098581205188212,
+-0.0018899399843384801, -0.0018899026326246072, -0.0018797903015413196, 0.0018599043640341684,
+0.0018299035003675633, 0.0018099356458895722, 0.0017799451936265738, 0.0017599425855230968,
+-0.0017400112743596644, 0.0017299514308226772, 0.001699946225000089, 0.0016599140791088043,
+0.0016297915529033659, -0.0015998574564972977, 0.0015998223890608351, -0.0015699441410966274,
+0.0015499533433480459, 0.0015499164248736373, -0.0015399546402541152, 0.0015299521915532782,
+-0.0014899507383267976, -0.0014199769653924453, 0.0013900051948273773, -0.0013799291856651421,
+-0.0013699765325499275, -0.0013298809691365471, 0.0013298027930371879, -0.0013199808668961708,
+-0.001309985207830464, -0.0012798126862031002, -0.0012699089468538726, 0.001229956983138402,
+-0.0012099410736605999, -0.0011899203887261133, -0.0011699428089347963, -0.0011599419379380504,
+0.0011599384728680313, 0.0011199597545887682, -0.0011099891195593061, -0.0011099027440582207,
+-0.0010899865163425894, 0.0010799010112274049, -0.0010798393904195968, 0.0010599419428248109,
+0.0010199608006733411, -0.001019928540560155, -0.0010199055186976939, -0.00099994862859628273,
+0.00099991289848077149, -0.00098000519918207225, -0.0009599477594600754, 0.00095991827506449498,
+-0.00094989645482239837, -0.00093998695691219398, 0.00092993298589205231, -0.00092989645176817315,
+0.00090991393596273715, -0.0008999182744536499, 0.00089991740590028427, 0.00088993836186493055,
+-0.00088991740651112928, 0.00087994276422521792, 0.0008598706093857465, 0.00084995747444193011,
+-0.0008399557399273674, -0.0008399540052640164, 0.00082999086636044569, -0.00082997137814211602,
+-0.00082994140687294208, -0.00079995573733519895, -0.00077995660588856442, -0.00076999087188605458,
+-0.00076997311402715715, 0.00074995878132631539, -0.00074990709574582226, -0.00072000520237631472,
+0.00071997826978790482, -0.00071993467523498011, -0.00070996589443392862, -0.00070000433849091276,
+0.0006899917362055099, 0.0006899784920653693, 0.00068997849000003561, -0.00068000259735506643,
+0.00067997913467620014, -0.00065995525205601586, -0.00064991420760374184, 0.00063997935733171125,
+0.00063996762886448107, -0.00063996502442607427, 0.0006299650271302565, -0.00062995242801632348,
+-0.00062000606948919336, -0.00062000346593643542, -0.00061995242862716848, 0.00060998218090590171,
+-0.00060998131479591633, -0.00060995889092216315, 0.00059996415799404919, 0.00059994629451241236,
+0.00059994629451241236, -0.00059000346717212723, 0.00058998304823757732, -0.00058997849212137632,
+-0.00058996871594278538, 0.00058993304915058167, 0.00058993304853973663, 0.00057998473513712475,
+0.00056998560369049046, 0.00055999478006183996, 0.00055998130868746576, 0.00055995802420133261,
+-0.00055993755992712695, 0.00054997691595535636, -0.00054995020501956426, -0.00053999173780524656,
+-0.0005399804465593596, 0.00053991882665643267, -0.0005299438032456827, -0.00051996426905838737,
+-0.00051995558160328778, -0.00051993598313626024, -0.00050999391336901294, 0.00050996737800621005,
+-0.00050996513605925233, 0.00049999826688914976, 0.00049998473730047054, 0.00049990634004732477,
+-0.00048996600583430796, 0.00048994640614559047, 0.00047997518007031521, -0.00045998299961089775,
+0.00043997518129200534, 0.00043997138119634136, 0.00042997518190285034, 0.00041999477975903276,
+0.0004100043366583775, 0.00041000433604753247, -0.00040998142398571418, -0.00039997968970918073,
+0.00039996269285036222, -0.00039996096429546183, 0.00038999391221733145, -0.00038998142459655921,
+-0.00038998055726488371, -0.00038996877960213407, 0.00038000260016249137, 0.00037999477711962845,
+0.00037997051365464007, 0.0003799580254230228, 0.00036999000130936033, 0.00036998924438917273,
+-0.00036997675697319566, 0.00036997502412837815, 0.00036962909325483496, 0.00036000433665837753,
+-0.00035999391242735727, -0.00035998229314992486, -0.00035997588780898503, 0.00034998837808316327,
+0.00034998826725685437, 0.0003499814252074043, 0.00034996807065577581, -0.00034996427056011188,
+-0.00033999011355338347, -0.00032997588171453617, 0.00032995091478679332, 0.00031999011294253838,
+0.00031998446838288065, -0.0003199711136632315, 0.00031995091539763844, -0.00031995004867680797,
+-0.00030999695665650303, -0.00030999695560283356, 0.00030997675778006483, 0.00029996878025498428,
+0.00029000173283081585, -0.00028998837827918735, -0.00027999609056051934, 0.00027998924377832768,
+0.00027998359967549603, 0.00026996964714383543, 0.00026995004867680795, 0.00025998924669253572,
+-0.0002599836010512051, -0.00025998360044036001, 0.0002599696471438354, -0.00025000173330164366,
+0.00024999217884567914, -0.0002499907129091247, 0.00024998213544546126, 0.00024998213375294334,
+0.00024997969115489834, -0.0002399963580796275, 0.00023999608814514258, -0.00023999462280543143,
+0.00023999304631737184, -0.00023998533632540116, 0.00023997502311671386, -0.00022999782415619919,
+0.00022999695560283357, -0.00022998593568114239, 0.00022997502372755892, -0.0002199937559585855,
+-0.000209995490747952, -0.00020999375597258722, -0.00020998751155835692, -0.00020998126703211285,
+-0.00020997502433840398, -0.00020000173455133723, 0.00020000173405250595, -0.000199995490747952,
+-0.0001999946234162765, -0.00019999462219458638, 0.00019999375597258722, 0.00019999375597258722,
+0.00019999375475089712, -0.00019998837938886371, 0.00019998213497463341, 0.00019997502433840398,
+0.0001999750242263902, 0.00019997502372755892, -0.00018999999990198797, -0.0001899946234162765,
+-0.00018999217898569635, 0.00018999217888768431, 0.00018998837827918736, 0.00018998751155835692,
+-0.00018000173466335101, 0.00018000173405250595, 0.00018000000000000001, -0.00017999999938915495,
+0.00017999375486291088, 0.00017998593507029733, 0.00017000606939118133, 0.00017000173405250595,
+-0.00017000086733167551, 0.00017000086610998539, 0.00016999608888200313, -0.00016999375486291088,
+-0.00016998593507029734, 0.00016998593507029734, -0.00016998593507029734, -0.00016998126815579093,
+-0.00016000000000000001, 0.00015999999991598969, 0.0001599969568245237, -0.00015999608949284819,
+-0.00015999375538974561, 0.00015999217898569635, -0.00015998126825380297, -0.00015998126825380297,
+-0.00015000173466335099, 0.00015000173405250593, -0.00014999608949284817, -0.00014999608949284817,
+-0.00014999608940883784, 0.00014999217898569632, -0.00014998837950087746, 0.00014998751094751184,
+0.00014000086733167549, 0.00014000086726166687, -0.00014000086726166687, -0.00013999999999999999,
+0.00013999999992999137, 0.00013999999992999137, 0.00013998751216920196, -0.00013998751216920196,
+0.00013998751216920196, -0.00013998751209919335, -0.00013998751208519163, 0.00012999999992999137,
+0.00012999999992999137, -0.00012999999992999137, -0.00012999999938915493, 0.00012999999877830987,
+0.00012999608949284817, 0.00012999608949284817, -0.00012998751216920196, -0.00012998751209919335,
+0.00012998750911497666, -0.0001200008673316755, -0.00012, 0.00012,
+0.0001199999999299914, 0.0001199999999299914, -0.0001199999999299914, 0.00011999999938915494,
+-0.00011999999931914634, 0.00011999608949284817, 0.00011999375608460099, 0.00011999375608460099,
+0.00011999375601459239, 0.00011998126825380298, -0.00011000086733167551, 0.00011000086727566862,
+-0.00011000086422144333, -0.00011, -0.00011, -0.00010999999994399311,
+-0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311,
+0.00010999999994399311, -0.00010999999938915494, 0.00010999608949284817, -0.00010999375608460099,
+0.0001099937560285941, -0.0001099937560285941, -0.00010999375480690399, -0.0001099875121131951,
+0.00010998126819779609, 0.00010000086733167551, 0.0001, 0.0001,
+9.9999999943993116e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 8.9999999943993117e-05, -8.9999999943993117e-05, -8.9993756084600992e-05,
+-8.9993756084600992e-05, -8.9987512169201992e-05, -8.9987512169201992e-05, 8.9987512169201992e-05,
+-8.9987512169201992e-05, -8.9987512127196828e-05, -8.9987512113195103e-05, -8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+-8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, -8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, -7.9999999957994843e-05, -7.9999999957994843e-05,
+-7.9999999957994843e-05, -7.9994623416276494e-05, 7.9993756084600993e-05, -7.9993756042595829e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.9999999971996556e-05, -6.999999995799483e-05, 6.999999995799483e-05,
+-6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05, -6.9999999389154933e-05,
+6.9997393118213018e-05, 6.999375608460098e-05, 6.999375608460098e-05, 6.9993756042595817e-05,
+6.9993756042595817e-05, 6.998751216920198e-05, -6.0000001193686678e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, 6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999971996557e-05,
+5.9999999971996557e-05, -5.9999999971996557e-05, 5.9999999971996557e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05,
+-4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05,
+-4.9999998750306444e-05, 4.9993756084600995e-05, -4.9993756084600995e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 3.9999999985998284e-05,
+3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999985998284e-05, 3.9999999985998284e-05,
+-3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+-3.9999999971996559e-05, 3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+3.9993756084600996e-05, -3.0012490274178253e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -2.9999999985998278e-05,
+2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999389154944e-05, 2.9993756070599268e-05, 2.0000000610845059e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-1.9984355452677854e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-9.9999792312680314e-06, -2.4974355895597922e-08, 1.2487872803181985e-08, -7.7112136608007634e-09,
+-6.5105576294038512e-09, -1.8325351737212287e-12, -2.8003441705852874e-14,
+};
+
+static const double ELP_ALIGNED c[] = {
+22639.585779999783, 4586.4383030482413, 2369.9139392170182, 769.02571212064083,
+-666.41710350524488, -411.5956722539517, 211.65555045555556, 205.43581754495605,
+191.95619698055046, 164.72851067770688, -147.32128695221752, -124.98811884997961,
+-109.38029152528641, 55.17704960898589, -45.09960222672089, 39.533294846642107,
+38.429834539229823, 36.123813678767867, 30.772574871068475, -28.397082101606109,
+-24.358212338620138, -18.584706787435177, 17.954455689537255, 14.530268320821619,
+14.379697344712016, 13.899059697433019, 13.194063384267789, -9.6790503673222954,
+-9.3658620284143055, 8.6055260752023823, -8.453098171936281, 8.0501618065821727,
+-7.6301502626761346, -7.447485471464419, 7.3711914505201896, -6.3831480863566981,
+-5.7416062472501928, 4.3740066189929863, -3.9976127354056374, -3.2096876157228866,
+-2.9145384452924774, 2.7318871580458453, -2.5679425540909007, -2.521195632587292,
+2.4888854424583369, 2.1460723999452451, 1.9777270098531954, 1.9336824423566752,
+1.8707635234326729, -1.7529659058834621, -1.4371612257872322, -1.3725698661367376,
+1.261815334548221, -1.2241239477742394, 1.1868256821760201, 1.1770005002971526,
+-1.1616851618482078, 1.0776922015320931, 1.0594959939813802, -0.99021520624362558,
+0.94827607277695591, 0.75167537534057838, -0.66937827791124027, -0.63520773475829995,
+-0.58399223988376081, -0.58330985023303894, 0.5715624455486874, -0.56064201501978006,
+-0.55691967084933913, -0.545922295332263, -0.53571228385428427, 0.47840441076242296,
+-0.45379348014929738, -0.42621734391648503, 0.4203253264023018, 0.41339757059148174,
+0.40422722435341507, 0.39451146622077399, -0.38212938265318991, -0.37451003268772687,
+-0.35757765071651765, 0.34964807428159111, 0.33979203489338344, -0.32865581190371806,
+0.30871761179214624, 0.30155398679824569, 0.30085535746880604, 0.29419895713202798,
+0.29255151442959165, -0.29022035464026719, -0.28909983807170408, 0.28250035911531046,
+0.27376033109557757, 0.26336602735178849, 0.25428567748872871, -0.25303563377877913,
+-0.24988218348421065, 0.24694273034572545, -0.23140185805839836, 0.21853112454481052,
+-0.20133701738664361, -0.19309621888121814, -0.18574679866535543, 0.17902695036433208,
+0.17623428346546699, -0.16976761277048513, 0.15779874125045584, 0.15225887126721879,
+0.14989465656636866, -0.13635518177553779, -0.12812062905785798, 0.12616048484413014,
+-0.12385834524328818, -0.12072578938500593, 0.1110008916610703, -0.10134867537740934,
+0.099816755063919793, 0.093197028260304113, 0.09204688700937419, -0.091538840652026526,
+0.090916966899834181, 0.090326994780609016, -0.084998738519387607, 0.084715479206418559,
+-0.083107161858049991, -0.08281558084813738, -0.080485691493041592, -0.080187303291296072,
+0.077650572030115356, -0.075177366892444752, 0.07500610055323817, -0.073726131219942467,
+0.071417570720518117, 0.06850055286096865, 0.06741641313718931, -0.066008993778875244,
+0.065406505184683855, -0.065125344811016755, 0.065067393346210381, 0.064385428409945142,
+0.063134179585263892, -0.061026762909326793, -0.057250247446015763, -0.056839235213631316,
+0.051647338978221734, -0.051414323771696469, -0.050698289273472953, -0.047018547511284078,
+0.044499314133387487, -0.044420191950083079, 0.043377765355544419, 0.043036795808646923,
+-0.041888564277954156, -0.040740230161511848, -0.040119358521312036, -0.039677055794669604,
+-0.039468782533558504, 0.038998738458432214, -0.035868044015185202, -0.035137490893805072,
+-0.033359568213737117, 0.032996369447580352, 0.032738935006736518, -0.029789526698408331,
+0.029489081278239959, -0.028868509584793603, -0.028038551498779034, 0.02681914607534109,
+0.026768615776657505, -0.026759156631173703, -0.026019711176632113, 0.025099146321089359,
+0.024288739290388783, 0.024108270631263605, -0.023909618138649127, -0.02378961017702937,
+-0.023487888460711009, 0.022959247592637164, 0.022888787499854124, 0.022850114760163083,
+-0.022728808278949731, 0.022439230074951338, -0.021708437659199616, -0.021568883722094416,
+0.021490147745885833, 0.019929337733671896, -0.019478935460323477, -0.018749006424452888,
+0.018189435394415806, -0.018158338689386828, -0.017958011818946063, -0.017809753472371206,
+0.017408086973591006, -0.016860079741348174, -0.016438506567875311, 0.016049163245398339,
+0.015979756166714678, 0.015438917713797419, -0.015408606427033808, -0.015329209047162612,
+-0.015138945719806746, -0.014829504541564934, 0.013760086679413185, 0.013719541110713085,
+-0.013500128064030415, -0.013429068013676312, -0.013319838644010817, 0.013308016134137452,
+0.012969588013701659, -0.012819572112065988, -0.012809296304692779, 0.012149814390483465,
+-0.011819139519574232, -0.01113941619626768, -0.010769880800198795, -0.010639635924726609,
+-0.010619831809297086, -0.010069489709312174, -0.0097998634769044368, 0.0097089230596640753,
+0.0096489501433626446, -0.0095500646014261368, -0.0094393341463413442, -0.0093398799749005654,
+0.0089095117714696782, 0.0088895412698671572, 0.0086600424635811819, -0.0084997149440999183,
+-0.0084893778508736955, 0.0084000463657784071, 0.0083594041943655314, 0.0081188016757274429,
+0.0075491813365501613, 0.0074394663787402775, -0.0073196118158529314, 0.0072997729544717798,
+-0.0069397576851301873, -0.0069297665218779371, 0.0067897769531541658, -0.006679785793356467,
+0.0066596313503168693, 0.0066500633164340017, 0.0066199074057552033, -0.0065896543543193763,
+-0.0065394073612162719, -0.0062297984426934365, 0.0062296889616551224, 0.0056800468261369568,
+0.0055996085284573905, 0.0053999234841913641, 0.0053796272626469681, 0.0052597353995528784,
+0.0051895246720766557, 0.0051796085347183118, 0.005149531598513158, -0.0050899330293707884,
+0.0049700468298020262, -0.0047798414801312177, 0.0047698446671906461, 0.0047498394716054861,
+0.0047295697748270067, 0.0046699425826050639, 0.0045500194937675934, 0.0043899539254221194,
+-0.0043396079431998703, -0.0043100338149401332, -0.0041595447071575307, -0.0039897132937572631,
+-0.0039598644455814845, 0.0039198693904625532, -0.0038900506478264552, -0.0037796603426187123,
+0.0037499469558294686, -0.0036897425996956727, -0.0036498174074935429, 0.0036399486992563668,
+0.003609742775215862, -0.0035899486907045356, -0.0035496734368934903, -0.0035399560744453621,
+0.0035298180206568179, -0.0034598214692147873, 0.0034398874420974428, -0.003409760478770475,
+0.003359893322829459, -0.0033499465378432564, -0.0033199011373663692, 0.0032998528230756942,
+0.0032400208006890855, 0.0031800155954773424, 0.0031197837081626645, -0.0029997795430846026,
+0.0029799586981553417, -0.0029699014815403558, 0.0029496786045804524, 0.002899792726055915,
+0.0028899626044425852, -0.0028699630309403134, -0.0028699164003967094, -0.0028597921790305789,
+-0.0028500182093567691, 0.0028497937623161904, 0.002819910909416269, -0.0027399652073949593,
+0.0026997576034472523, 0.0026198666163149255, 0.0025599158756305133, 0.0025397190205883389,
+-0.0025098702551810729, -0.0024699725945589537, -0.0023599281910461224, -0.0023198847523704519,
+0.0022898357460313808, -0.0022798801966037443, 0.0021998866645142339, -0.0021399669619742946,
+-0.0021198871014783153, -0.0020798543003216099, -0.0020099804174057924, -0.0019998290090656192,
+0.0019800138705875123, 0.0019798546820539442, 0.0019599328673942356, -0.0019098581205188212,
+-0.0018899399843384801, -0.0018899026326246072, -0.0018797903015413196, 0.0018599043640341684,
+0.0018299035003675633, 0.0018099356458895722, 0.0017799451936265738, 0.0017599425855230968,
+-0.0017400112743596644, 0.0017299514308226772, 0.001699946225000089, 0.0016599140791088043,
+0.0016297915529033659, -0.0015998574564972977, 0.0015998223890608351, -0.0015699441410966274,
+0.0015499533433480459, 0.0015499164248736373, -0.0015399546402541152, 0.0015299521915532782,
+-0.0014899507383267976, -0.0014199769653924453, 0.0013900051948273773, -0.0013799291856651421,
+-0.0013699765325499275, -0.0013298809691365471, 0.0013298027930371879, -0.0013199808668961708,
+-0.001309985207830464, -0.0012798126862031002, -0.0012699089468538726, 0.001229956983138402,
+-0.0012099410736605999, -0.0011899203887261133, -0.0011699428089347963, -0.0011599419379380504,
+0.0011599384728680313, 0.0011199597545887682, -0.0011099891195593061, -0.0011099027440582207,
+-0.0010899865163425894, 0.0010799010112274049, -0.0010798393904195968, 0.0010599419428248109,
+0.0010199608006733411, -0.001019928540560155, -0.0010199055186976939, -0.00099994862859628273,
+0.00099991289848077149, -0.00098000519918207225, -0.0009599477594600754, 0.00095991827506449498,
+-0.00094989645482239837, -0.00093998695691219398, 0.00092993298589205231, -0.00092989645176817315,
+0.00090991393596273715, -0.0008999182744536499, 0.00089991740590028427, 0.00088993836186493055,
+-0.00088991740651112928, 0.00087994276422521792, 0.0008598706093857465, 0.00084995747444193011,
+-0.0008399557399273674, -0.0008399540052640164, 0.00082999086636044569, -0.00082997137814211602,
+-0.00082994140687294208, -0.00079995573733519895, -0.00077995660588856442, -0.00076999087188605458,
+-0.00076997311402715715, 0.00074995878132631539, -0.00074990709574582226, -0.00072000520237631472,
+0.00071997826978790482, -0.00071993467523498011, -0.00070996589443392862, -0.00070000433849091276,
+0.0006899917362055099, 0.0006899784920653693, 0.00068997849000003561, -0.00068000259735506643,
+0.00067997913467620014, -0.00065995525205601586, -0.00064991420760374184, 0.00063997935733171125,
+0.00063996762886448107, -0.00063996502442607427, 0.0006299650271302565, -0.00062995242801632348,
+-0.00062000606948919336, -0.00062000346593643542, -0.00061995242862716848, 0.00060998218090590171,
+-0.00060998131479591633, -0.00060995889092216315, 0.00059996415799404919, 0.00059994629451241236,
+0.00059994629451241236, -0.00059000346717212723, 0.00058998304823757732, -0.00058997849212137632,
+-0.00058996871594278538, 0.00058993304915058167, 0.00058993304853973663, 0.00057998473513712475,
+0.00056998560369049046, 0.00055999478006183996, 0.00055998130868746576, 0.00055995802420133261,
+-0.00055993755992712695, 0.00054997691595535636, -0.00054995020501956426, -0.00053999173780524656,
+-0.0005399804465593596, 0.00053991882665643267, -0.0005299438032456827, -0.00051996426905838737,
+-0.00051995558160328778, -0.00051993598313626024, -0.00050999391336901294, 0.00050996737800621005,
+-0.00050996513605925233, 0.00049999826688914976, 0.00049998473730047054, 0.00049990634004732477,
+-0.00048996600583430796, 0.00048994640614559047, 0.00047997518007031521, -0.00045998299961089775,
+0.00043997518129200534, 0.00043997138119634136, 0.00042997518190285034, 0.00041999477975903276,
+0.0004100043366583775, 0.00041000433604753247, -0.00040998142398571418, -0.00039997968970918073,
+0.00039996269285036222, -0.00039996096429546183, 0.00038999391221733145, -0.00038998142459655921,
+-0.00038998055726488371, -0.00038996877960213407, 0.00038000260016249137, 0.00037999477711962845,
+0.00037997051365464007, 0.0003799580254230228, 0.00036999000130936033, 0.00036998924438917273,
+-0.00036997675697319566, 0.00036997502412837815, 0.00036962909325483496, 0.00036000433665837753,
+-0.00035999391242735727, -0.00035998229314992486, -0.00035997588780898503, 0.00034998837808316327,
+0.00034998826725685437, 0.0003499814252074043, 0.00034996807065577581, -0.00034996427056011188,
+-0.00033999011355338347, -0.00032997588171453617, 0.00032995091478679332, 0.00031999011294253838,
+0.00031998446838288065, -0.0003199711136632315, 0.00031995091539763844, -0.00031995004867680797,
+-0.00030999695665650303, -0.00030999695560283356, 0.00030997675778006483, 0.00029996878025498428,
+0.00029000173283081585, -0.00028998837827918735, -0.00027999609056051934, 0.00027998924377832768,
+0.00027998359967549603, 0.00026996964714383543, 0.00026995004867680795, 0.00025998924669253572,
+-0.0002599836010512051, -0.00025998360044036001, 0.0002599696471438354, -0.00025000173330164366,
+0.00024999217884567914, -0.0002499907129091247, 0.00024998213544546126, 0.00024998213375294334,
+0.00024997969115489834, -0.0002399963580796275, 0.00023999608814514258, -0.00023999462280543143,
+0.00023999304631737184, -0.00023998533632540116, 0.00023997502311671386, -0.00022999782415619919,
+0.00022999695560283357, -0.00022998593568114239, 0.00022997502372755892, -0.0002199937559585855,
+-0.000209995490747952, -0.00020999375597258722, -0.00020998751155835692, -0.00020998126703211285,
+-0.00020997502433840398, -0.00020000173455133723, 0.00020000173405250595, -0.000199995490747952,
+-0.0001999946234162765, -0.00019999462219458638, 0.00019999375597258722, 0.00019999375597258722,
+0.00019999375475089712, -0.00019998837938886371, 0.00019998213497463341, 0.00019997502433840398,
+0.0001999750242263902, 0.00019997502372755892, -0.00018999999990198797, -0.0001899946234162765,
+-0.00018999217898569635, 0.00018999217888768431, 0.00018998837827918736, 0.00018998751155835692,
+-0.00018000173466335101, 0.00018000173405250595, 0.00018000000000000001, -0.00017999999938915495,
+0.00017999375486291088, 0.00017998593507029733, 0.00017000606939118133, 0.00017000173405250595,
+-0.00017000086733167551, 0.00017000086610998539, 0.00016999608888200313, -0.00016999375486291088,
+-0.00016998593507029734, 0.00016998593507029734, -0.00016998593507029734, -0.00016998126815579093,
+-0.00016000000000000001, 0.00015999999991598969, 0.0001599969568245237, -0.00015999608949284819,
+-0.00015999375538974561, 0.00015999217898569635, -0.00015998126825380297, -0.00015998126825380297,
+-0.00015000173466335099, 0.00015000173405250593, -0.00014999608949284817, -0.00014999608949284817,
+-0.00014999608940883784, 0.00014999217898569632, -0.00014998837950087746, 0.00014998751094751184,
+0.00014000086733167549, 0.00014000086726166687, -0.00014000086726166687, -0.00013999999999999999,
+0.00013999999992999137, 0.00013999999992999137, 0.00013998751216920196, -0.00013998751216920196,
+0.00013998751216920196, -0.00013998751209919335, -0.00013998751208519163, 0.00012999999992999137,
+0.00012999999992999137, -0.00012999999992999137, -0.00012999999938915493, 0.00012999999877830987,
+0.00012999608949284817, 0.00012999608949284817, -0.00012998751216920196, -0.00012998751209919335,
+0.00012998750911497666, -0.0001200008673316755, -0.00012, 0.00012,
+0.0001199999999299914, 0.0001199999999299914, -0.0001199999999299914, 0.00011999999938915494,
+-0.00011999999931914634, 0.00011999608949284817, 0.00011999375608460099, 0.00011999375608460099,
+0.00011999375601459239, 0.00011998126825380298, -0.00011000086733167551, 0.00011000086727566862,
+-0.00011000086422144333, -0.00011, -0.00011, -0.00010999999994399311,
+-0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311,
+0.00010999999994399311, -0.00010999999938915494, 0.00010999608949284817, -0.00010999375608460099,
+0.0001099937560285941, -0.0001099937560285941, -0.00010999375480690399, -0.0001099875121131951,
+0.00010998126819779609, 0.00010000086733167551, 0.0001, 0.0001,
+9.9999999943993116e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 8.9999999943993117e-05, -8.9999999943993117e-05, -8.9993756084600992e-05,
+-8.9993756084600992e-05, -8.9987512169201992e-05, -8.9987512169201992e-05, 8.9987512169201992e-05,
+-8.9987512169201992e-05, -8.9987512127196828e-05, -8.9987512113195103e-05, -8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+-8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, -8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, -7.9999999957994843e-05, -7.9999999957994843e-05,
+-7.9999999957994843e-05, -7.9994623416276494e-05, 7.9993756084600993e-05, -7.9993756042595829e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.9999999971996556e-05, -6.999999995799483e-05, 6.999999995799483e-05,
+-6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05, -6.9999999389154933e-05,
+6.9997393118213018e-05, 6.999375608460098e-05, 6.999375608460098e-05, 6.9993756042595817e-05,
+6.9993756042595817e-05, 6.998751216920198e-05, -6.0000001193686678e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, 6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999971996557e-05,
+5.9999999971996557e-05, -5.9999999971996557e-05, 5.9999999971996557e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05,
+-4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.9999999971996558e-05, -4.9999999971996558e-05, 4.9999999971996558e-05,
+-4.9999998750306444e-05, 4.9993756084600995e-05, -4.9993756084600995e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 3.9999999985998284e-05,
+3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999985998284e-05, 3.9999999985998284e-05,
+-3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+-3.9999999971996559e-05, 3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+3.9993756084600996e-05, -3.0012490274178253e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -2.9999999985998278e-05,
+2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999389154944e-05, 2.9993756070599268e-05, 2.0000000610845059e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-1.9984355452677854e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-9.9999792312680314e-06, -2.4974355895597922e-08, 1.2487872803181985e-08, -7.7112136608007634e-09,
+-6.5105576294038512e-09, -1.8325351737212287e-12, -2.8003441705852874e-14,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0,
+};
+
+const struct elp_table elp1 = {
+    arg, max_arg, amp, c, s, 1023
 };
@@ -1,836 +1,815 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp14[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 73.435780, 0.000100, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 277.117190, 0.000050, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 300.691880, 0.000040, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 354.551590, 0.000010, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 354.551590, 0.000010, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 4.024180, 0.000060, 0.080000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 300.722700, 0.000040, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 259.581320, 0.000010, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 78.692820, 0.000060, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 79.581320, 0.000050, 6.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 270.672000, 0.000020, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 270.672000, 0.000020, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 79.581320, 0.000050, 5.956000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 78.692820, 0.000060, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 259.581320, 0.000010, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 55.076500, 0.000020, 0.080000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 302.939440, 0.000030, 0.093000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 294.374620, 0.000050, 0.084000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 114.374620, 0.000050, 0.067000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 120.031400, 0.000030, 0.078000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 120.031400, 0.000030, 0.072000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 230.496560, 0.000030, 0.072000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 12.948190, 0.000040, 0.078000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 159.716870, 0.000020, 0.088000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 15.746060, 0.000090, 0.074000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 72.483110, 0.000030, 0.078000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 338.599460, 0.000040, 0.072000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 193.962280, 0.000030, 0.077000},
-{{0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 102.785020, 0.000010, 0.075000},
-{{0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 43.309310, 0.000070, 0.074000},
-{{0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 251.263400, 0.000020, 0.072000},
-{{0.000000, 0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 280.462290, 0.000060, 0.069000},
-{{0.000000, 0.000000, 0.000000, 7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 129.655570, 0.000020, 0.067000},
-{{0.000000, 0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 114.241150, 0.000030, 0.074000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 135.822770, 0.000050, 0.077000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 141.677360, 0.000010, 0.072000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 166.196130, 0.000050, 0.071000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 15.276080, 0.000020, 0.078000},
-{{0.000000, 0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 83.247520, 0.000010, 0.074000},
-{{0.000000, 0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 83.247520, 0.000010, 0.075000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 109.851380, 0.000050, 0.077000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 320.566580, 0.000010, 0.066000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 320.566580, 0.000010, 0.085000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 52.928860, 0.000040, 0.088000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 128.118460, 0.000070, 0.080000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 46.383240, 0.000030, 0.037000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 40.623150, 0.000020, 9.672000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 40.623150, 0.000020, 4.346000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 46.383240, 0.000030, 0.038000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 351.370340, 0.000040, 0.081000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 54.183320, 0.000020, 0.499000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 54.183320, 0.000020, 0.040000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 54.143470, 0.000060, 0.089000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 273.702540, 0.000020, 0.092000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 122.137770, 0.000070, 0.084000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 319.355030, 0.000020, 0.067000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 89.753740, 0.000040, 0.077000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 89.753740, 0.000040, 0.072000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 37.686110, 0.000020, 0.078000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 86.194310, 0.000020, 0.066000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 266.194310, 0.000020, 0.085000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 30.477280, 0.000010, 0.079000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 30.477280, 0.000010, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 43.950140, 0.000010, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 43.948260, 0.000050, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 342.040100, 0.000050, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 153.542950, 0.000020, 17.980000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 333.542380, 0.000320, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 333.542380, 0.000020, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 42.817460, 0.000020, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 5.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 141.263300, 0.000030, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 164.862310, 0.000120, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 14.881710, 0.000140, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 273.506130, 0.000040, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 183.125430, 0.000040, 0.097000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 101.831200, 0.000020, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 302.390440, 0.000050, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 178.303500, 0.000010, 0.065000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.300720, 0.000040, 0.530000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 120.799230, 0.000060, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 120.799230, 0.000060, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 138.643160, 0.000030, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 189.575410, 0.000070, 8.850000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 11.136870, 0.001320, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 9.575940, 0.000070, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 32.971630, 0.000020, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 281.314340, 0.000060, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 340.862290, 0.000120, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 136.952010, 0.000060, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 167.073650, 0.000020, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 177.160170, 0.000140, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 175.979860, 0.000080, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 141.866550, 0.000170, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 140.111310, 0.000020, 0.073000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 151.535810, 0.000020, 0.084000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 151.535810, 0.000020, 0.067000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 254.263270, 0.000030, 0.072000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 178.986040, 0.000020, 0.081000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 358.986040, 0.000020, 0.069000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 195.519640, 0.000020, 0.074000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 183.424680, 0.000090, 0.075000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 71.267410, 0.000040, 0.081000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 251.267410, 0.000040, 0.069000},
-{{0.000000, 0.000000, 2.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 230.332980, 0.000060, 0.071000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 80.557930, 0.000030, 0.074000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 260.557930, 0.000030, 0.075000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 108.194440, 0.000020, 0.077000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, -1.000000}, 108.281040, 0.000010, 0.075000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 1.000000}, 288.281040, 0.000010, 0.074000},
-{{0.000000, 0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 316.421070, 0.000010, 0.080000},
-{{0.000000, 0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 316.421070, 0.000010, 0.070000},
-{{0.000000, 0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 247.709600, 0.000020, 0.074000},
-{{0.000000, 0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 278.110750, 0.000010, 0.075000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 47.552730, 0.000040, 0.077000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 189.559810, 0.000020, 0.072000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 27.599500, 0.000020, 0.087000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 56.023250, 0.000050, 0.080000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 189.147110, 0.000070, 0.074000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 189.147110, 0.000070, 0.075000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 230.839830, 0.000010, 0.068000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 230.839830, 0.000010, 0.082000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 99.158620, 0.000030, 0.084000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 64.632080, 0.000020, 0.067000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 57.095510, 0.000030, 0.077000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 57.095510, 0.000030, 0.072000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 290.445120, 0.000050, 0.078000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 236.992910, 0.000020, 0.066000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 236.767200, 0.000040, 0.085000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 202.604020, 0.000050, 0.075000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 266.072430, 0.000020, 0.069000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 266.072430, 0.000020, 0.082000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 119.186100, 0.000020, 0.092000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 299.186100, 0.000020, 0.063000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 194.068660, 0.000050, 0.072000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 297.292730, 0.000030, 0.078000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 239.338620, 0.000020, 0.040000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 239.338560, 0.000020, 0.523000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 241.354980, 0.000010, 0.086000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 241.354980, 0.000010, 0.066000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000}, 59.289160, 0.000030, 0.074000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 59.289160, 0.000030, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 59.338530, 0.000100, 5.163000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 59.336970, 0.000110, 0.038000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 123.550440, 0.000020, 0.070000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 185.349630, 0.000070, 0.070000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 245.923500, 0.000020, 0.088000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 245.923500, 0.000020, 0.065000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 301.048030, 0.000060, 0.070000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 154.155500, 0.000030, 0.074000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 342.929270, 0.000060, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 92.980420, 0.000040, 0.074000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 272.980420, 0.000040, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 140.187990, 0.000030, 0.069000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 261.441390, 0.000020, 0.074000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 261.441390, 0.000020, 0.075000},
-{{0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 93.498570, 0.000020, 0.084000},
-{{0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 273.498570, 0.000020, 0.067000},
-{{0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 191.784340, 0.000090, 0.072000},
-{{0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 222.101750, 0.000060, 0.070000},
-{{0.000000, 0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 250.953410, 0.000030, 0.067000},
-{{0.000000, 0.000000, 2.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 280.456790, 0.000010, 0.088000},
-{{0.000000, 0.000000, 2.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 100.456790, 0.000010, 0.065000},
-{{0.000000, 0.000000, 3.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 21.146160, 0.000010, 0.071000},
-{{0.000000, 0.000000, 3.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 201.146160, 0.000010, 0.079000},
-{{0.000000, 0.000000, 3.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 230.620990, 0.000010, 0.073000},
-{{0.000000, 0.000000, 3.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 50.620990, 0.000010, 0.076000},
-{{0.000000, 0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 79.378770, 0.000020, 0.076000},
-{{0.000000, 0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 1.000000}, 258.936330, 0.000030, 0.075000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 108.025550, 0.000020, 0.080000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 108.025550, 0.000020, 0.070000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 163.803820, 0.000030, 0.073000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 3.925600, 0.000040, 0.076000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 0.000000}, 339.855510, 0.000050, 0.075000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 39.748880, 0.000030, 0.080000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 176.162030, 0.000010, 0.070000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 225.759890, 0.000030, 0.073000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 225.759890, 0.000030, 0.076000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 108.643150, 0.000030, 0.083000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 28.919670, 0.000030, 0.076000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 28.919670, 0.000030, 0.073000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 154.518820, 0.000020, 0.071000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 317.770440, 0.000060, 0.079000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 43.897530, 0.000040, 0.087000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 303.725940, 0.000010, 0.065000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 287.589930, 0.000060, 0.076000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 236.884240, 0.000050, 0.082000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 111.979780, 0.000010, 0.091000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 111.979780, 0.000010, 0.063000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 266.588040, 0.000010, 0.071000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 265.723680, 0.000030, 0.079000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 122.281190, 0.000020, 0.087000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 122.281190, 0.000020, 0.065000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 277.842840, 0.000050, 0.070000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 117.575880, 0.000030, 0.075000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 97.155370, 0.000020, 0.083000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 316.837230, 0.000030, 0.067000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 140.891320, 0.000040, 0.077000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 74.891590, 0.000020, 0.073000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 157.928070, 0.000030, 0.087000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 153.811550, 0.000050, 0.065000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 14.522580, 0.000040, 0.070000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 321.690910, 0.000020, 0.065000},
-{{0.000000, 0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 250.900670, 0.000020, 0.065000},
-{{0.000000, 0.000000, 3.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 100.393570, 0.000010, 0.091000},
-{{0.000000, 0.000000, 3.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 100.393570, 0.000010, 0.063000},
-{{0.000000, 0.000000, 4.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 50.587880, 0.000040, 0.076000},
-{{0.000000, 0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 79.100460, 0.000050, 0.079000},
-{{0.000000, 0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 167.752090, 0.000030, 0.073000},
-{{0.000000, 0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 287.701700, 0.000010, 0.083000},
-{{0.000000, 0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 287.701700, 0.000010, 0.068000},
-{{0.000000, 0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 309.730270, 0.000020, 0.076000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 339.766840, 0.000060, 0.079000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 217.757550, 0.000020, 0.070000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 1.931480, 0.000050, 0.026000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 1.957330, 0.000270, 0.088000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 2.128960, 0.000080, 0.040000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 2.075410, 0.000070, 0.515000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000}, 181.931530, 0.000010, 0.025000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000}, 181.931530, 0.000010, 0.076000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 1.476850, 0.000110, 0.037000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 1.287180, 0.000090, 6.017000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 3.099290, 0.000100, 0.074000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 3.099240, 0.000100, 0.075000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 1.287180, 0.000090, 5.977000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 1.476850, 0.000110, 0.037000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000}, 181.932620, 0.000010, 0.076000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000}, 181.932620, 0.000010, 0.025000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 2.076750, 0.000070, 0.515000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 2.130130, 0.000080, 0.040000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 1.958370, 0.000270, 0.088000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000}, 1.932670, 0.000050, 0.026000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 13.124350, 0.000050, 0.083000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 224.046130, 0.000020, 0.068000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 2.637170, 0.000010, 0.076000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 2.637170, 0.000010, 0.073000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 232.819480, 0.000030, 0.070000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 232.819480, 0.000030, 0.079000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 19.250440, 0.000050, 0.087000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 252.933770, 0.000020, 0.065000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 286.616810, 0.000060, 0.076000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 27.467640, 0.000010, 0.068000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 207.593450, 0.000050, 0.082000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 86.498640, 0.000020, 0.091000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 86.498640, 0.000020, 0.063000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 336.176470, 0.000010, 0.076000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 132.452800, 0.000050, 0.073000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 56.787050, 0.000030, 0.070000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 92.879110, 0.000010, 0.079000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 204.114690, 0.000070, 0.070000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 74.841670, 0.000030, 0.076000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 267.504160, 0.000020, 0.068000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 312.807130, 0.000020, 0.076000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 111.414080, 0.000060, 0.073000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 305.580330, 0.000020, 0.087000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 305.580330, 0.000020, 0.065000},
-{{0.000000, 0.000000, 4.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 12.940820, 0.000020, 0.068000},
-{{0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 322.983090, 0.000050, 0.061000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 200.718020, 0.000020, 0.087000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 34.741820, 0.000040, 0.065000},
-{{0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 71.191720, 0.000030, 0.063000},
-{{0.000000, 0.000000, 5.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 50.285060, 0.000010, 0.079000},
-{{0.000000, 0.000000, 5.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 49.966950, 0.000030, 0.071000},
-{{0.000000, 0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 258.892900, 0.000020, 0.082000},
-{{0.000000, 0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 282.986940, 0.000040, 0.076000},
-{{0.000000, 0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 169.523500, 0.000020, 0.073000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 179.971200, 0.000020, 0.076000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 179.971200, 0.000020, 0.073000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 28.289320, 0.000010, 0.086000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 28.289320, 0.000010, 0.066000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 178.554790, 0.000030, 0.083000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 57.367480, 0.000010, 0.090000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 57.367480, 0.000010, 0.063000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 121.890600, 0.000050, 0.073000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 27.598260, 0.000030, 0.070000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 207.598260, 0.000030, 0.079000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 257.560630, 0.000030, 0.071000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000}, 59.884180, 0.000030, 0.075000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 247.558240, 0.000020, 0.037000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 228.811840, 0.000010, 0.073000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 54.689570, 0.000040, 0.076000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 283.592230, 0.000040, 0.068000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 346.061560, 0.000050, 0.066000},
-{{0.000000, 0.000000, 5.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 41.954820, 0.000020, 0.063000},
-{{0.000000, 0.000000, 5.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 142.073900, 0.000020, 0.058000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 101.312610, 0.000060, 0.061000},
-{{0.000000, 0.000000, 6.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 200.963780, 0.000030, 0.078000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 229.903970, 0.000020, 0.082000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 311.020790, 0.000020, 0.075000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 311.020790, 0.000020, 0.074000},
-{{0.000000, 0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 204.898470, 0.000080, 0.077000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 208.949280, 0.000010, 0.075000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 69.708370, 0.000050, 0.074000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 178.418790, 0.000020, 0.070000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 178.418790, 0.000020, 0.080000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 35.757490, 0.000010, 0.079000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 238.382500, 0.000040, 0.071000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 31.631860, 0.000030, 0.075000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 43.906500, 0.000020, 5.148000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 43.904770, 0.000020, 0.038000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 27.844150, 0.000020, 0.077000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 243.185890, 0.000050, 0.068000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 235.651120, 0.000010, 0.075000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 235.651120, 0.000010, 0.074000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 48.257180, 0.000020, 0.086000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 290.956370, 0.000050, 0.066000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 84.673350, 0.000030, 0.071000},
-{{0.000000, 0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 280.282980, 0.000010, 0.090000},
-{{0.000000, 0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 354.019030, 0.000020, 0.064000},
-{{0.000000, 0.000000, 7.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 298.964110, 0.000020, 0.075000},
-{{0.000000, 0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 274.507910, 0.000010, 0.075000},
-{{0.000000, 0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 274.507910, 0.000010, 0.074000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 154.452820, 0.000010, 0.075000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 38.763080, 0.000040, 0.074000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 149.398450, 0.000020, 0.080000},
-{{0.000000, 0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 62.929780, 0.000020, 0.071000},
-{{0.000000, 0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 148.417360, 0.000020, 0.082000},
-{{0.000000, 0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 148.417360, 0.000020, 0.069000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 273.965300, 0.000010, 0.085000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 273.965300, 0.000010, 0.066000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 56.285060, 0.000050, 0.071000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 303.043470, 0.000010, 0.089000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 303.043470, 0.000010, 0.064000},
-{{0.000000, 0.000000, 8.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 286.850880, 0.000030, 0.075000},
-{{0.000000, 0.000000, 8.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 231.259420, 0.000030, 0.075000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 242.587010, 0.000030, 0.089000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 234.900430, 0.000010, 0.038000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 234.900430, 0.000010, 5.222000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 52.020350, 0.000040, 0.075000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 52.020350, 0.000040, 0.074000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 234.900430, 0.000010, 7.041000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 234.900430, 0.000010, 0.037000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 242.319460, 0.000020, 0.088000},
-{{0.000000, 0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 163.494810, 0.000020, 0.074000},
-{{0.000000, 0.000000, 8.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 68.708660, 0.000020, 0.071000},
-{{0.000000, 0.000000, 8.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 149.256720, 0.000040, 0.077000},
-{{0.000000, 0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 6.366680, 0.000010, 0.075000},
-{{0.000000, 0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 5.073850, 0.000040, 0.074000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 59.341920, 0.000020, 0.085000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 59.341920, 0.000020, 0.066000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 27.313730, 0.000060, 0.071000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 55.953980, 0.000020, 0.069000},
-{{0.000000, 0.000000, 9.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 264.848590, 0.000010, 0.074000},
-{{0.000000, 0.000000, 9.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 84.848590, 0.000010, 0.075000},
-{{0.000000, 0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 300.582580, 0.000010, 0.074000},
-{{0.000000, 0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 187.497090, 0.000100, 0.075000},
-{{0.000000, 0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 152.277380, 0.000020, 0.077000},
-{{0.000000, 0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 332.277380, 0.000020, 0.072000},
-{{0.000000, 0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 120.270720, 0.000020, 0.078000},
-{{0.000000, 0.000000, 9.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 179.359490, 0.000030, 0.075000},
-{{0.000000, 0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 358.239250, 0.000050, 0.072000},
-{{0.000000, 0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 27.145180, 0.000030, 0.069000},
-{{0.000000, 0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 151.801960, 0.000030, 0.074000},
-{{0.000000, 0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 151.801960, 0.000030, 0.075000},
-{{0.000000, 0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 300.652750, 0.000030, 0.075000},
-{{0.000000, 0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 329.152130, 0.000040, 0.072000},
-{{0.000000, 0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 358.156250, 0.000030, 0.069000},
-{{0.000000, 0.000000, 11.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 270.927020, 0.000010, 0.074000},
-{{0.000000, 0.000000, 11.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 91.029450, 0.000050, 0.075000},
-{{0.000000, 0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 120.154240, 0.000010, 0.077000},
-{{0.000000, 0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 300.154240, 0.000010, 0.072000},
-{{0.000000, 0.000000, 14.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000}, 190.682520, 0.000010, 0.074000},
-{{0.000000, 0.000000, 14.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 190.682520, 0.000010, 0.075000},
-{{0.000000, 0.000000, 34.000000, -41.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000}, 145.608260, 0.000010, 0.074000},
-{{0.000000, 0.000000, 34.000000, -41.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 2.000000}, 145.608260, 0.000010, 0.075000},
-{{0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 341.069900, 0.000020, 0.060000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 339.264290, 0.000020, 0.068000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 339.264290, 0.000020, 0.082000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 270.218910, 0.000030, 0.073000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 90.218910, 0.000030, 0.076000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 12.480680, 0.000060, 0.068000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 240.170340, 0.000010, 0.083000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 6.676870, 0.000020, 0.059000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 6.676870, 0.000020, 0.100000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 301.362510, 0.000080, 0.073000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 262.067050, 0.000040, 0.076000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 109.322190, 0.000010, 0.059000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 109.322190, 0.000010, 0.101000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 305.175130, 0.000040, 0.086000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 83.116220, 0.000050, 0.078000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.872950, 0.000010, 0.038000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 357.188130, 0.000030, 1.951000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 0.000000}, 267.667780, 0.000030, 0.073000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 246.360750, 0.000010, 0.072000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 246.360750, 0.000010, 0.077000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 0.115540, 0.000030, 0.793000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000}, 180.115540, 0.000030, 0.039000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 15.187840, 0.000020, 0.067000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 199.890380, 0.000100, 0.083000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 8.410470, 0.000040, 0.026000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 252.369410, 0.000020, 0.094000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 85.399220, 0.000020, 0.085000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 192.342060, 0.000020, 0.066000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 37.308050, 0.000010, 0.078000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 37.308050, 0.000010, 0.071000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 104.827450, 0.000020, 0.072000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 104.827450, 0.000020, 0.077000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 341.829850, 0.000070, 0.093000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 117.926180, 0.000070, 0.085000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 117.926180, 0.000070, 0.066000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 158.110770, 0.000010, 0.080000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 2.000000}, 158.110770, 0.000010, 0.070000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 338.110770, 0.000030, 1.354000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 89.483210, 0.000020, 0.078000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 202.694230, 0.000190, 0.071000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 239.758880, 0.000020, 0.072000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 342.203320, 0.000010, 0.077000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 254.642640, 0.000050, 0.103000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 2.606600, 0.000020, 0.058000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 346.468200, 0.000020, 0.084000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 239.525360, 0.000020, 0.067000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 66.428870, 0.000020, 0.072000},
-{{0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 158.742540, 0.000050, 0.063000},
-{{0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 309.008280, 0.000040, 0.067000},
-{{0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 20.621690, 0.000020, 0.063000},
-{{0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 341.119800, 0.000010, 0.062000},
-{{0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 161.119800, 0.000010, 0.093000},
-{{0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 256.447480, 0.000040, 0.066000},
-{{0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 302.867110, 0.000050, 0.071000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 112.423600, 0.000020, 0.077000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 112.423600, 0.000020, 0.073000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, -1.000000}, 167.175980, 0.000030, 0.075000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 1.000000}, 302.789750, 0.000020, 0.074000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 47.367140, 0.000070, 0.071000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 165.227310, 0.000020, 0.062000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 19.066820, 0.000030, 0.094000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 136.782600, 0.000070, 0.076000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 87.328840, 0.000010, 0.073000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -2.000000}, 186.113990, 0.000010, 0.074000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 0.000000}, 100.402380, 0.000030, 0.075000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 285.471560, 0.000030, 0.071000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 285.471560, 0.000030, 0.079000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 289.372090, 0.000010, 0.061000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 109.372090, 0.000010, 0.095000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 23.269650, 0.000020, 0.026000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 34.586560, 0.000140, 0.090000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 12.785010, 0.000020, 0.041000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 12.785130, 0.000020, 0.456000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 106.788940, 0.000060, 0.083000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 17.569950, 0.000030, 0.038000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 17.783220, 0.000020, 2.394000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 48.828380, 0.000090, 0.076000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 48.828380, 0.000090, 0.073000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 17.783220, 0.000020, 11.864000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 17.569950, 0.000030, 0.037000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 0.015450, 0.000050, 0.072000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 0.115350, 0.000050, 1.572000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 334.108700, 0.000010, 0.070000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 194.300340, 0.000140, 0.079000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 195.143970, 0.000010, 0.065000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 17.754990, 0.000040, 0.086000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 355.869250, 0.000030, 0.090000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 311.604040, 0.000210, 0.073000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 284.370920, 0.000070, 0.080000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 161.537760, 0.000010, 0.028000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 161.713340, 0.000020, 0.110000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 340.079070, 0.000030, 0.056000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 106.376160, 0.000010, 0.027000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 322.463160, 0.000040, 0.099000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 179.885110, 0.000060, 0.319000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 152.989530, 0.000010, 0.082000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 220.279560, 0.000090, 0.068000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 59.209580, 0.000010, 0.024000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 165.312400, 0.000050, 0.074000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 114.552520, 0.000010, 0.089000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 239.287580, 0.000040, 0.064000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 321.510640, 0.000040, 0.060000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 8.447020, 0.000030, 0.089000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 8.447020, 0.000030, 0.064000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 20.618590, 0.000020, 0.060000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 288.015330, 0.000040, 0.108000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 108.015330, 0.000040, 0.057000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 286.958990, 0.000010, 0.069000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 286.958990, 0.000010, 0.081000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 359.882500, 0.000030, 0.080000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000}, 56.983310, 0.000020, 0.037000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 56.920220, 0.000410, 0.074000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 2.215510, 0.000010, 0.075000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 236.988860, 0.000020, 4.230000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 50.463890, 0.000020, 0.089000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 202.222870, 0.000020, 0.087000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 153.846840, 0.000040, 0.074000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 153.846840, 0.000040, 0.075000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 198.159910, 0.000020, 0.089000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 28.061340, 0.000020, 0.027000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 21.983940, 0.000080, 0.096000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 303.808880, 0.000010, 0.026000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 91.290830, 0.000060, 0.087000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 8.451050, 0.000010, 0.039000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 8.451050, 0.000010, 0.958000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 359.124530, 0.000020, 0.080000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 359.124530, 0.000020, 0.070000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 8.451050, 0.000010, 1.409000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 8.451050, 0.000010, 0.036000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 301.815710, 0.000050, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 14.202980, 0.000030, 0.074000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 0.114050, 0.000040, 95.796000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 14.202980, 0.000030, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 182.496820, 0.000250, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 16.342680, 0.000020, 0.082000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 51.126270, 0.000030, 0.095000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 246.727150, 0.000030, 0.070000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 358.058630, 0.000040, 0.076000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 161.537570, 0.000010, 0.028000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 161.537570, 0.000010, 0.119000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 92.858200, 0.000020, 0.028000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 215.640940, 0.000060, 0.105000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 171.667530, 0.000040, 0.095000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 171.667530, 0.000040, 0.061000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 171.602200, 0.000020, 0.086000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 227.623270, 0.000100, 0.066000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 125.370210, 0.000030, 0.070000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000}, 318.898230, 0.000030, 0.074000},
-{{0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 245.628910, 0.000070, 0.118000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 147.183310, 0.000020, 0.094000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 325.574990, 0.000040, 0.062000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 161.547580, 0.000060, 0.068000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 59.562730, 0.000020, 0.072000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 147.444790, 0.000050, 0.078000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 109.151680, 0.000050, 0.072000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 100.224920, 0.000010, 0.077000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 339.040760, 0.000050, 0.085000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 237.030120, 0.000070, 0.078000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 129.547140, 0.000030, 0.084000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 90.923950, 0.000010, 0.084000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 90.923950, 0.000010, 0.067000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 286.770160, 0.000050, 0.077000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 286.770160, 0.000050, 0.072000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 108.726760, 0.000050, 0.085000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 75.669120, 0.000060, 0.092000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 207.768380, 0.000030, 0.084000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 207.768380, 0.000030, 0.067000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 290.151390, 0.000040, 0.077000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 352.672760, 0.000370, 0.072000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 316.243110, 0.000020, 0.101000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 245.050090, 0.000020, 0.067000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 263.378160, 0.000020, 0.077000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 76.696430, 0.000060, 0.072000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 97.293340, 0.000020, 0.028000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 253.443980, 0.000040, 0.113000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 356.316100, 0.000010, 0.101000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 356.316100, 0.000010, 0.059000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 201.212720, 0.000110, 0.063000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 345.416040, 0.000020, 0.023000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 94.176290, 0.000030, 0.067000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 246.379850, 0.000060, 0.127000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 262.162430, 0.000030, 0.059000},
-{{0.000000, 4.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 333.553740, 0.000040, 0.059000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 241.310530, 0.000030, 0.076000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 101.718770, 0.000010, 0.070000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 281.718770, 0.000010, 0.079000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 338.005970, 0.000020, 0.082000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 296.122770, 0.000060, 0.076000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 158.085520, 0.000020, 0.074000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 36.896730, 0.000040, 0.089000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 212.809340, 0.000010, 0.064000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 224.536050, 0.000080, 0.082000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 11.611860, 0.000030, 0.068000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 338.212170, 0.000030, 0.075000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 338.212170, 0.000030, 0.074000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 28.555290, 0.000070, 0.080000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 180.516030, 0.000030, 0.089000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 46.707810, 0.000110, 0.074000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 138.552080, 0.000060, 0.098000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 359.942410, 0.000020, 0.060000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 194.192810, 0.000060, 0.089000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 193.554470, 0.000040, 0.064000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 155.056810, 0.000020, 0.081000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 350.545650, 0.000120, 0.069000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000}, 198.448040, 0.000010, 0.077000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 18.448040, 0.000010, 0.073000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 195.580510, 0.000030, 5.352000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 341.335440, 0.000020, 0.075000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 15.603530, 0.000570, 0.074000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000}, 15.576590, 0.000030, 0.037000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 296.785250, 0.000020, 0.108000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 348.395630, 0.000060, 0.065000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 106.258250, 0.000030, 0.069000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 356.851700, 0.000010, 0.108000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 356.851700, 0.000010, 0.057000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 176.011780, 0.000010, 0.309000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000}, 356.011780, 0.000010, 0.033000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 178.067910, 0.000060, 0.061000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 358.807090, 0.000020, 0.065000},
-{{0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 247.294100, 0.000050, 0.138000},
-{{0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 261.057720, 0.000040, 0.057000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 338.488250, 0.000020, 0.106000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 338.488250, 0.000020, 0.057000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 292.105140, 0.000010, 0.074000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 195.252080, 0.000020, 0.075000},
-{{0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 76.410080, 0.000020, 0.080000},
-{{0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 256.410080, 0.000020, 0.070000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 210.041330, 0.000050, 0.086000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 200.694400, 0.000010, 0.066000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 350.985310, 0.000020, 0.076000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 126.345870, 0.000050, 0.094000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 14.810530, 0.000020, 5.330000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 14.815940, 0.000020, 0.038000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 192.834510, 0.000020, 0.027000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 74.475430, 0.000030, 0.104000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 38.852570, 0.000020, 0.094000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 38.852570, 0.000020, 0.062000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 335.647390, 0.000010, 0.066000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 299.921800, 0.000010, 0.024000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 276.390640, 0.000030, 0.116000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 350.375760, 0.000060, 0.062000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 162.759960, 0.000030, 0.152000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 342.759960, 0.000030, 0.049000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 275.972010, 0.000020, 0.029000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 275.972010, 0.000020, 0.131000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 299.368150, 0.000010, 0.115000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 299.368150, 0.000010, 0.055000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 176.007310, 0.000020, 0.259000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 124.725930, 0.000030, 0.058000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 341.041690, 0.000020, 0.062000},
-{{0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 228.464480, 0.000070, 0.055000},
-{{0.000000, 7.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 60.711770, 0.000030, 0.072000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 129.666500, 0.000060, 0.100000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 86.904340, 0.000010, 0.076000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 86.904340, 0.000010, 0.073000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 51.990430, 0.000040, 0.111000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 215.065070, 0.000020, 0.090000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 69.243250, 0.000030, 0.064000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 305.259400, 0.000050, 0.125000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 108.214810, 0.000030, 0.053000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 286.902150, 0.000050, 0.060000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 162.787350, 0.000020, 0.168000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 162.787350, 0.000020, 0.048000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 133.486090, 0.000030, 0.056000},
-{{0.000000, 7.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 238.670230, 0.000030, 0.053000},
-{{0.000000, 7.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 108.007040, 0.000020, 0.163000},
-{{0.000000, 7.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 108.007040, 0.000020, 0.048000},
-{{0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 43.426820, 0.000020, 0.075000},
-{{0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 223.666900, 0.000010, 0.074000},
-{{0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 341.642350, 0.000050, 0.081000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 94.874580, 0.000010, 0.026000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 93.184760, 0.000070, 0.088000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 87.103370, 0.000030, 0.037000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 81.685830, 0.000020, 5.850000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 82.048020, 0.000030, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 82.048020, 0.000030, 0.074000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 81.685830, 0.000020, 6.151000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 87.103370, 0.000030, 0.037000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 92.752240, 0.000070, 0.088000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000}, 92.752240, 0.000020, 0.026000},
-{{0.000000, 8.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 26.067390, 0.000130, 0.075000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 220.335900, 0.000020, 0.096000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 306.519200, 0.000030, 0.070000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 8.674880, 0.000010, 0.074000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 8.674880, 0.000010, 0.075000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 166.897190, 0.000040, 0.107000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 91.951590, 0.000060, 0.065000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 109.487330, 0.000030, 0.080000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 289.487330, 0.000030, 0.070000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 93.769170, 0.000010, 0.028000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 37.961730, 0.000030, 0.120000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 82.874290, 0.000010, 0.061000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 0.081830, 0.000030, 0.023000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 313.532170, 0.000040, 0.136000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 276.004050, 0.000020, 0.051000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 123.780890, 0.000040, 0.054000},
-{{0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 227.807860, 0.000020, 0.052000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 161.511390, 0.000030, 0.086000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 250.181310, 0.000070, 0.094000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 70.150190, 0.000010, 0.078000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 70.150190, 0.000010, 0.071000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 352.411070, 0.000020, 0.084000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 238.994710, 0.000020, 0.067000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 10.390830, 0.000020, 0.072000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 130.822050, 0.000050, 0.114000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 245.594690, 0.000010, 0.055000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 349.218500, 0.000020, 0.092000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 169.218500, 0.000020, 0.063000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 109.763670, 0.000020, 0.084000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 289.763670, 0.000020, 0.067000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 70.582590, 0.000050, 0.129000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 180.069410, 0.000050, 0.059000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000}, 18.362410, 0.000030, 0.092000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 198.362410, 0.000030, 0.063000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 207.581760, 0.000010, 0.113000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 82.241670, 0.000060, 0.056000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 330.282610, 0.000040, 0.174000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 336.719180, 0.000020, 0.147000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 336.719180, 0.000020, 0.050000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 70.975150, 0.000020, 0.127000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 143.753450, 0.000020, 0.053000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 250.148210, 0.000020, 0.099000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 250.148210, 0.000020, 0.060000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 193.811350, 0.000010, 0.110000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 193.811350, 0.000010, 0.056000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 172.043280, 0.000040, 0.064000},
-{{0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 118.035760, 0.000030, 0.123000},
-{{0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 212.471240, 0.000040, 0.060000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 96.880890, 0.000030, 0.141000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 196.510120, 0.000020, 0.057000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 198.367140, 0.000040, 0.060000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 52.352020, 0.000030, 0.054000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 161.491640, 0.000010, 0.246000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 3.000000}, 161.491640, 0.000010, 0.044000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 329.648580, 0.000020, 0.031000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 329.648580, 0.000020, 0.196000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 224.102790, 0.000020, 0.051000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 111.033750, 0.000020, 0.022000},
-{{0.000000, 10.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 289.743920, 0.000020, 0.044000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, -1.000000}, 60.662720, 0.000010, 0.026000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 1.000000}, 60.662720, 0.000020, 0.088000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 60.662720, 0.000010, 0.040000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000}, 60.662720, 0.000070, 0.037000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 60.191250, 0.000640, 0.075000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 60.191250, 0.000640, 0.075000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 60.662720, 0.000070, 0.037000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 60.662720, 0.000010, 0.040000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 60.662720, 0.000020, 0.088000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 60.662720, 0.000010, 0.026000},
-{{0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000}, 70.115000, 0.000030, 0.106000},
-{{0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 212.073670, 0.000030, 0.058000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 104.390210, 0.000030, 0.154000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 21.829270, 0.000010, 0.050000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.829270, 0.000010, 0.148000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 198.367280, 0.000030, 0.058000},
-{{0.000000, 11.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 51.884580, 0.000040, 0.052000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 274.278470, 0.000020, 0.223000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 94.278470, 0.000020, 0.045000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.255250, 0.000020, 0.055000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.255250, 0.000020, 0.114000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 251.064870, 0.000010, 0.152000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 251.064870, 0.000010, 0.049000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 108.260530, 0.000020, 0.171000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 108.260530, 0.000020, 0.048000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.812700, 0.000030, 0.135000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 124.365070, 0.000040, 0.053000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 198.346620, 0.000020, 0.056000},
-{{0.000000, 12.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 292.601960, 0.000020, 0.206000},
-{{0.000000, 12.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 292.601960, 0.000020, 0.045000},
-{{0.000000, 12.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 24.027600, 0.000040, 0.050000},
-{{0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.240760, 0.000020, 0.057000},
-{{0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.240760, 0.000020, 0.106000},
-{{0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 318.849430, 0.000030, 0.048000},
-{{0.000000, 12.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 321.115230, 0.000050, 0.075000},
-{{0.000000, 12.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 321.115230, 0.000050, 0.074000},
-{{0.000000, 13.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 91.525260, 0.000050, 0.054000},
-{{0.000000, 13.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 49.712150, 0.000040, 0.191000},
-{{0.000000, 13.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.794080, 0.000020, 0.125000},
-{{0.000000, 13.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 117.965180, 0.000040, 0.051000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 328.077850, 0.000040, 0.309000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.224200, 0.000020, 0.059000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.224200, 0.000020, 0.100000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 347.824270, 0.000050, 0.047000},
-{{0.000000, 14.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 91.553330, 0.000020, 0.130000},
-{{0.000000, 14.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 91.553330, 0.000020, 0.052000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 72.752180, 0.000020, 0.217000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000}, 87.705920, 0.000010, 0.045000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.773420, 0.000020, 0.116000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 117.813890, 0.000010, 0.149000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 117.813890, 0.000010, 0.050000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 21.205570, 0.000020, 0.034000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 201.205570, 0.000020, 0.383000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.205570, 0.000020, 0.062000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.205570, 0.000020, 0.094000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 112.946700, 0.000010, 0.212000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 323.542920, 0.000030, 0.045000},
-{{0.000000, 15.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 113.327680, 0.000020, 0.201000},
-{{0.000000, 15.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000}, 201.750750, 0.000010, 0.032000},
-{{0.000000, 15.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 21.750750, 0.000010, 0.251000},
-{{0.000000, 15.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.750750, 0.000020, 0.108000},
-{{0.000000, 15.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 267.453820, 0.000020, 0.046000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 201.184910, 0.000040, 0.504000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.184910, 0.000020, 0.064000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 21.184910, 0.000020, 0.089000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 289.818960, 0.000040, 0.044000},
-{{0.000000, 15.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 108.328360, 0.000020, 0.074000},
-{{0.000000, 15.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 108.328360, 0.000020, 0.075000},
-{{0.000000, 16.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 21.726110, 0.000030, 0.298000},
-{{0.000000, 16.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 359.925200, 0.000050, 0.047000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 1.000000}, 342.831880, 0.000020, 0.074000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 3.000000}, 162.831880, 0.000020, 0.075000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 201.162250, 0.000040, 0.735000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 289.638050, 0.000020, 0.288000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 289.638050, 0.000020, 0.043000},
-{{0.000000, 17.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 21.699540, 0.000020, 0.366000},
-{{0.000000, 17.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 359.896730, 0.000020, 0.207000},
-{{0.000000, 17.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 359.896730, 0.000020, 0.045000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000}, 201.137610, 0.000020, 0.071000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 2.000000}, 201.137610, 0.000020, 0.078000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 146.519810, 0.000020, 0.070000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 146.519810, 0.000020, 0.080000},
-{{0.000000, 18.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 21.671070, 0.000020, 0.474000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 175.797210, 0.000020, 0.041000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 217.502430, 0.000010, 0.042000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 217.502430, 0.000020, 0.097000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 217.502430, 0.000010, 0.027000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, -1.000000}, 114.565500, 0.000040, 0.019000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 1.000000}, 114.565500, 0.000040, 0.041000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, -1.000000}, 114.565500, 0.000220, 0.026000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 1.000000}, 114.565500, 0.000380, 0.088000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 114.565500, 0.000250, 0.040000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, -1.000000}, 114.565500, 0.000110, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 1.000000}, 114.565500, 0.000020, 0.076000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000}, 114.559720, 0.001250, 0.037000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -3.000000}, 294.565500, 0.000010, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 114.508840, 0.011260, 0.075000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 114.623740, 0.011230, 0.074000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 3.000000}, 294.565500, 0.000010, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 290.173870, 0.000030, 6.132000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 114.677480, 0.001210, 0.037000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 114.565500, 0.000020, 0.076000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 114.565500, 0.000110, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 114.565500, 0.000250, 0.040000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 114.565500, 0.000380, 0.088000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 114.565500, 0.000220, 0.026000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 114.565500, 0.000040, 0.041000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000}, 114.565500, 0.000040, 0.019000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, -1.000000}, 11.628570, 0.000010, 0.027000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 1.000000}, 11.628570, 0.000020, 0.097000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, -1.000000}, 11.628570, 0.000010, 0.042000},
-{{0.000000, 19.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.640740, 0.000020, 0.085000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 18.184190, 0.000050, 0.075000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 18.184190, 0.000050, 0.074000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.608610, 0.000030, 0.081000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 296.754070, 0.000030, 0.074000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 317.442380, 0.000050, 0.075000},
-{{0.000000, 20.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -2.000000}, 201.052240, 0.000020, 0.080000},
-{{0.000000, 20.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 201.052240, 0.000020, 0.069000},
-{{0.000000, 21.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000}, 48.151580, 0.000020, 0.074000},
-{{0.000000, 21.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 2.000000}, 228.151580, 0.000020, 0.075000},
-{{0.000000, 21.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000}, 288.903310, 0.000020, 0.074000},
-{{0.000000, 21.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 288.903310, 0.000020, 0.075000},
-{{0.000000, 22.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000}, 83.050360, 0.000020, 0.073000},
-{{0.000000, 23.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000}, 267.561100, 0.000020, 0.075000},
-{{0.000000, 23.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 87.561100, 0.000020, 0.074000},
-{{0.000000, 26.000000, -29.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 238.396220, 0.000040, 0.075000},
-{{0.000000, 26.000000, -29.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000}, 238.396220, 0.000040, 0.074000},
-{{3.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, -1.000000}, 218.714940, 0.000010, 0.074000},
-{{3.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 1.000000}, 218.714940, 0.000010, 0.075000},
+
+static const uint16_t arg[] = {
+11, 10, 2, 69, 73, 171, 172, 75, 587, 190,
+191, 160, 100, 178, 177, 76, 251, 255, 273, 277,
+327, 165, 3331, 226, 137, 308, 254, 290, 74, 266,
+321, 197, 371, 372, 470, 130, 431, 446, 590, 207,
+383, 384, 1461, 386, 358, 121, 5746, 5747, 399, 400,
+685, 660, 256, 253, 444, 443, 3118, 711, 410, 6049,
+6751, 1931, 3905, 63, 66, 1625, 1620, 1591, 505, 506,
+3642, 390, 4419, 4421, 3342, 2032, 203, 4133, 5044, 2672,
+6568, 439, 442, 6752, 758, 759, 1160, 722, 723, 7458,
+434, 3639, 3542, 2392, 1623, 7459, 1440, 2671, 7460, 2281,
+287, 7422, 1035, 7313, 7461, 3660, 4602, 818, 2583, 280,
+690, 7462, 666, 176, 5045, 4572, 1050, 918, 1544, 613,
+1846, 4461, 1824, 2920, 696, 715, 716, 3121, 8426, 8427,
+8385, 2085, 417, 661, 101, 3637, 1641, 279, 2135, 4622,
+1330, 2989, 5342, 8428, 547, 548, 7214, 3494, 2493, 1708,
+8429, 1753, 5079, 2044, 3872, 6122, 3068, 4637, 8271, 427,
+2195, 6133, 8430, 4028, 1423, 1422, 606, 8387, 8383, 8431,
+2862, 2937, 3350, 7230, 8092, 3006, 4391, 2156, 7389, 8340,
+3201, 1323, 1101, 1102, 5383, 2940, 6161, 518, 519, 884,
+357, 376, 1501, 7256, 447, 1758, 5650, 7260, 540, 2042,
+276, 9829, 9830, 3126, 1282, 9831, 9832, 4437, 864, 9833,
+9730, 9834, 9835, 9506, 1927, 4631, 3058, 2495, 3447, 3448,
+7342, 1120, 6126, 9728, 2084, 9731, 9836, 9837, 433, 509,
+2922, 6669, 9838, 9839, 1593, 1640, 52, 112, 5634, 9315,
+9840, 3005, 887, 9841, 1967, 9349, 6567, 1925, 5719, 5004,
+1151, 2554, 5381, 3075, 3458, 3858, 2673, 4464, 8359, 3355,
+5725, 8363, 4324, 9729, 912, 851, 875, 923, 532, 533,
+3649, 12080, 12081, 12352, 12353, 12354, 12355, 731, 724, 1355,
+736, 4144, 12356, 12357, 3150, 2867, 2623, 12082, 411, 497,
+12085, 11700, 12358, 12359, 12360, 5300, 4147, 4438, 4808, 3758,
+4020, 3268, 3490, 8206, 12361, 12362, 12363, 3543, 12364, 1357,
+12365, 12366, 4630, 12367, 5689, 2863, 3341, 12368, 2550, 3270,
+12086, 6124, 1735, 1072, 5357, 12369, 3558, 3875, 6653, 12087,
+12088, 1961, 5083, 1802, 12083, 1280, 11822, 4850, 6066, 8281,
+8282, 741, 768, 754, 12370, 12371, 12372, 12089, 928, 1012,
+1960, 869, 2988, 2713, 3880, 5943, 10669, 3854, 4819, 12373,
+12374, 3117, 3135, 973, 860, 612, 374, 1453, 3836, 12375,
+12376, 748, 12377, 757, 12378, 935, 12084, 991, 892, 893,
+992, 2878, 12379, 3352, 2483, 12380, 12381, 12382, 2719, 11964,
+4035, 3325, 12383, 3777, 4870, 4177, 12384, 2403, 3563, 12385,
+1132, 11192, 970, 1511, 1512, 2990, 1206, 16587, 16588, 16589,
+780, 776, 1225, 1099, 1381, 16590, 2217, 16591, 1709, 689,
+753, 677, 4472, 16150, 1295, 16592, 16593, 16594, 16595, 9441,
+16596, 16597, 7281, 16598, 987, 16599, 16600, 16151, 609, 15456,
+16601, 601, 655, 1219, 8191, 8192, 8193, 11701, 16602, 15514,
+16603, 16604, 16605, 16606, 6557, 7301, 16607, 16608, 16609, 16610,
+6112, 16611, 16612, 16613, 8731, 16614, 3870, 16615, 16616, 15581,
+16617, 16618, 16619, 16620, 6625, 6626, 976, 16621, 16622, 16623,
+9727, 16624, 16625, 11760, 1161, 1128, 2309, 16626, 6639, 6640,
+16627, 3763, 16628, 4160, 1771, 3272, 4846, 16629, 5356, 4636,
+16630, 6647, 15651, 16631, 16632, 16633, 16634, 5358, 7350, 200,
+415, 16635, 10450, 272, 3130, 16636, 16637, 16638, 2111, 5360,
+16639, 16640, 16641, 11823, 16642, 911, 763, 885, 843, 847,
+1052, 16643, 3274, 3559, 2591, 734, 657, 1018, 1180, 1024,
+975, 15789, 6141, 16644, 16645, 3741, 1293, 4456, 16646, 16647,
+16648, 16649, 16650, 6060, 1066, 3716, 4601, 16651, 16652, 16653,
+16152, 16153, 1592, 687, 662, 16654, 8320, 11925, 15891, 1349,
+16655, 5642, 15906, 16656, 16657, 16658, 16659, 16660, 1089, 1090,
+1256, 16154, 16661, 16662, 16663, 4321, 6699, 16664, 2393, 16665,
+4869, 16666, 16667, 16155, 1358, 16668, 16669, 1663, 16670, 3076,
+1644, 16671, 16672, 1513, 1514, 3778, 16673, 16674, 8353, 6707,
+16675, 5723, 7933, 16676, 16677, 9672, 16678, 16679, 9678, 16680,
+6160, 16008, 16681, 16682, 7403, 16683, 9680, 16684, 16685, 7243,
+16686, 12007, 1312, 1313, 16687, 16688, 16689, 5106, 16690, 16691,
+8365, 16028, 16692, 16693, 7407, 16694, 7409, 1375, 1309, 1402,
+1376, 16695, 16696, 16697, 11532, 12047, 4654, 3059, 16698, 3644,
+5388, 2041, 2137, 1881, 1862, 21329, 21330, 1609, 20078, 21331,
+4138, 3650, 3429, 1045, 2118, 21332, 21333, 21334, 21335, 21336,
+21337, 2780, 2624, 1374, 21338, 21339, 21340, 21341, 21342, 21343,
+21344, 21345, 6316, 21346, 21347, 21348, 21349, 21350, 21351, 1435,
+2222, 2223, 1436, 5685, 5073, 21352, 21353, 21354, 21355, 9333,
+21356, 15594, 21357, 21358, 21359, 21360, 21361, 1283, 21362, 8262,
+8263, 21363, 21364, 5080, 21365, 7336, 3195, 3446, 3449, 3271,
+11784, 21366, 21367, 21368, 21369, 21370, 9567, 4162, 4163, 21371,
+21372, 21373, 21374, 15690, 11809, 2436, 2651, 402, 359, 4003,
+21375, 3604, 21376, 21377, 21378, 21379, 21380, 2314, 4852, 15737,
+1849, 15747, 4856, 20402, 21381, 15756, 21382, 7365, 13737, 998,
+1110, 1190, 1156, 6679, 3767, 21383, 3828, 21384, 10682, 13851,
+13874, 21385, 21386, 11906, 11907, 18541, 21387, 9629, 21388, 21389,
+21390, 526, 21391, 18670, 21392, 20523, 1545, 21393, 1250, 21394,
+2617, 21395, 1036, 20547, 20548, 21396, 21397, 21398, 21399, 21400,
+21401, 2165, 2017, 2018, 2166, 21402, 21403, 21404, 1991, 21405,
+21406, 4178, 21407, 21408, 16011, 1886, 1561, 1805, 1806, 1562,
+1850, 1207, 1208,
+};
+
+static const uint16_t max_arg[] = {
+11, 11, 11, 69, 73, 171, 172, 172, 587, 587,
+587, 587, 587, 587, 587, 587, 587, 587, 587, 587,
+587, 587, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331,
+3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331, 3331,
+3331, 3331, 3331, 3331, 3331, 3331, 5746, 5747, 5747, 5747,
+5747, 5747, 5747, 5747, 5747, 5747, 5747, 5747, 5747, 6049,
+6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751,
+6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751, 6751,
+6751, 6751, 6751, 6752, 6752, 6752, 6752, 6752, 6752, 7458,
+7458, 7458, 7458, 7458, 7458, 7459, 7459, 7459, 7460, 7460,
+7460, 7460, 7460, 7460, 7461, 7461, 7461, 7461, 7461, 7461,
+7461, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462,
+7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 8426, 8427,
+8427, 8427, 8427, 8427, 8427, 8427, 8427, 8427, 8427, 8427,
+8427, 8427, 8427, 8428, 8428, 8428, 8428, 8428, 8428, 8428,
+8429, 8429, 8429, 8429, 8429, 8429, 8429, 8429, 8429, 8429,
+8429, 8429, 8430, 8430, 8430, 8430, 8430, 8430, 8430, 8431,
+8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431,
+8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431,
+8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431, 8431,
+8431, 9829, 9830, 9830, 9830, 9831, 9832, 9832, 9832, 9833,
+9833, 9834, 9835, 9835, 9835, 9835, 9835, 9835, 9835, 9835,
+9835, 9835, 9835, 9835, 9835, 9835, 9836, 9837, 9837, 9837,
+9837, 9837, 9838, 9839, 9839, 9839, 9839, 9839, 9839, 9839,
+9840, 9840, 9840, 9841, 9841, 9841, 9841, 9841, 9841, 9841,
+9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841,
+9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841, 9841,
+9841, 12080, 12081, 12352, 12353, 12354, 12355, 12355, 12355, 12355,
+12355, 12355, 12356, 12357, 12357, 12357, 12357, 12357, 12357, 12357,
+12357, 12357, 12358, 12359, 12360, 12360, 12360, 12360, 12360, 12360,
+12360, 12360, 12360, 12360, 12361, 12362, 12363, 12363, 12364, 12364,
+12365, 12366, 12366, 12367, 12367, 12367, 12367, 12368, 12368, 12368,
+12368, 12368, 12368, 12368, 12368, 12369, 12369, 12369, 12369, 12369,
+12369, 12369, 12369, 12369, 12369, 12369, 12369, 12369, 12369, 12369,
+12369, 12369, 12369, 12369, 12370, 12371, 12372, 12372, 12372, 12372,
+12372, 12372, 12372, 12372, 12372, 12372, 12372, 12372, 12372, 12373,
+12374, 12374, 12374, 12374, 12374, 12374, 12374, 12374, 12374, 12375,
+12376, 12376, 12377, 12377, 12378, 12378, 12378, 12378, 12378, 12378,
+12378, 12378, 12379, 12379, 12379, 12380, 12381, 12382, 12382, 12382,
+12382, 12382, 12383, 12383, 12383, 12383, 12384, 12384, 12384, 12385,
+12385, 12385, 12385, 12385, 12385, 12385, 12385, 16587, 16588, 16589,
+16589, 16589, 16589, 16589, 16589, 16590, 16590, 16591, 16591, 16591,
+16591, 16591, 16591, 16591, 16591, 16592, 16593, 16594, 16595, 16595,
+16596, 16597, 16597, 16598, 16598, 16599, 16600, 16600, 16600, 16600,
+16601, 16601, 16601, 16601, 16601, 16601, 16601, 16601, 16602, 16602,
+16603, 16604, 16605, 16606, 16606, 16606, 16607, 16608, 16609, 16610,
+16610, 16611, 16612, 16613, 16613, 16614, 16614, 16615, 16616, 16616,
+16617, 16618, 16619, 16620, 16620, 16620, 16620, 16621, 16622, 16623,
+16623, 16624, 16625, 16625, 16625, 16625, 16625, 16626, 16626, 16626,
+16627, 16627, 16628, 16628, 16628, 16628, 16628, 16629, 16629, 16629,
+16630, 16630, 16630, 16631, 16632, 16633, 16634, 16634, 16634, 16634,
+16634, 16635, 16635, 16635, 16635, 16636, 16637, 16638, 16638, 16638,
+16639, 16640, 16641, 16641, 16642, 16642, 16642, 16642, 16642, 16642,
+16642, 16643, 16643, 16643, 16643, 16643, 16643, 16643, 16643, 16643,
+16643, 16643, 16643, 16644, 16645, 16645, 16645, 16645, 16646, 16647,
+16648, 16649, 16650, 16650, 16650, 16650, 16650, 16651, 16652, 16653,
+16653, 16653, 16653, 16653, 16653, 16654, 16654, 16654, 16654, 16654,
+16655, 16655, 16655, 16656, 16657, 16658, 16659, 16660, 16660, 16660,
+16660, 16660, 16661, 16662, 16663, 16663, 16663, 16664, 16664, 16665,
+16665, 16666, 16667, 16667, 16667, 16668, 16669, 16669, 16670, 16670,
+16670, 16671, 16672, 16672, 16672, 16672, 16673, 16674, 16674, 16674,
+16675, 16675, 16675, 16676, 16677, 16677, 16678, 16679, 16679, 16680,
+16680, 16680, 16681, 16682, 16682, 16683, 16683, 16684, 16685, 16685,
+16686, 16686, 16686, 16686, 16687, 16688, 16689, 16689, 16690, 16691,
+16691, 16691, 16692, 16693, 16693, 16694, 16694, 16694, 16694, 16694,
+16694, 16695, 16696, 16697, 16697, 16697, 16697, 16697, 16698, 16698,
+16698, 16698, 16698, 16698, 16698, 21329, 21330, 21330, 21330, 21331,
+21331, 21331, 21331, 21331, 21331, 21332, 21333, 21334, 21335, 21336,
+21337, 21337, 21337, 21337, 21338, 21339, 21340, 21341, 21342, 21343,
+21344, 21345, 21345, 21346, 21347, 21348, 21349, 21350, 21351, 21351,
+21351, 21351, 21351, 21351, 21351, 21352, 21353, 21354, 21355, 21355,
+21356, 21356, 21357, 21358, 21359, 21360, 21361, 21361, 21362, 21362,
+21362, 21363, 21364, 21364, 21365, 21365, 21365, 21365, 21365, 21365,
+21365, 21366, 21367, 21368, 21369, 21370, 21370, 21370, 21370, 21371,
+21372, 21373, 21374, 21374, 21374, 21374, 21374, 21374, 21374, 21374,
+21375, 21375, 21376, 21377, 21378, 21379, 21380, 21380, 21380, 21380,
+21380, 21380, 21380, 21380, 21381, 21381, 21382, 21382, 21382, 21382,
+21382, 21382, 21382, 21382, 21382, 21383, 21383, 21384, 21384, 21384,
+21384, 21385, 21386, 21386, 21386, 21386, 21387, 21387, 21388, 21389,
+21390, 21390, 21391, 21391, 21392, 21392, 21392, 21393, 21393, 21394,
+21394, 21395, 21395, 21395, 21395, 21396, 21397, 21398, 21399, 21400,
+21401, 21401, 21401, 21401, 21401, 21402, 21403, 21404, 21404, 21405,
+21406, 21406, 21407, 21408, 21408, 21408, 21408, 21408, 21408, 21408,
+21408, 21408, 21408,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.011259999999999999, 0.01123, 0.00132, 0.00125,
+0.0012099999999999999, 0.00064000000000000005, 0.00064000000000000005, 0.00056999999999999998,
+0.00040999999999999999, 0.00038000000000000002, 0.00038000000000000002, 0.00036999999999999999,
+0.00032000000000000003, 0.00027, 0.00027, 0.00025000000000000001,
+0.00025000000000000001, 0.00025000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00021000000000000001, 0.00019000000000000001, 0.00017000000000000001, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00012999999999999999,
+0.00012, 0.00012, 0.00012, 0.00011,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.00011, 0.00011, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.004671026707702061, -0.004679063617916656, 0.0012951425155459293, -0.00051955184940707163,
+-0.00050518704443265942, 0.00031814814538838566, 0.00031814814538838566, 0.00054899321816834061,
+0.00022378057947768429, -0.00015797862765741161, -0.00015797862765741161, 0.00036697855057001309,
+0.00028648452996258585, 0.0002698424659740044, 0.00026984229853881672, -0.00024976266024581115,
+-0.00010393330766934975, -0.00010393330766934975, -9.1461310749027785e-05, -9.1461310749027785e-05,
+0.00013943557723589744, -0.00017528962005127464, -0.00013371769127068067, 0.00013530413570766217,
+-0.00013982807123222318, 0.00011525773647819112, -0.00013566199719354253, 0.00011677611692462807,
+-0.00011583612700008534, 0.00011336800134918838, 0.00011837001467627303, 5.6098679286924586e-05,
+0.00010996346020101176, 0.00010996346020101176, -0.00010254678450053534, 7.5429105806505646e-05,
+-4.5730655374513892e-05, -4.5730655374513892e-05, 2.850898596009729e-05, 5.0996457304896714e-05,
+9.9853734038541831e-05, 9.9853738756690703e-05, -9.9145148940045613e-05, -9.4034526371240121e-05,
+-6.7400241711801153e-05, 8.6622651004008755e-05, -8.9839277033253086e-05, -8.8103092028885834e-05,
+8.9977289455362439e-05, 8.9977289455362439e-05, 5.9248502085215024e-05, 5.9248502085215024e-05,
+-6.8660911833553009e-05, -7.980315748651002e-05, 7.9944779572897181e-05, 7.9944718868883114e-05,
+-7.2564420569097701e-05, 4.1636081730416894e-05, 7.4183105625943692e-05, -5.7024744165128121e-05,
+5.0936291652445204e-05, -4.3210256877083394e-05, -3.72369827189266e-05, -6.9024726363786781e-05,
+6.9024618649227029e-05, -6.9109840207669273e-05, -6.9109840207669273e-05, -6.9695101882027814e-05,
+6.9954081985277374e-05, 6.9954022678186614e-05, -6.3891061909314577e-05, 6.6509425016029054e-05,
+-3.2783350736636492e-05, -3.2783350736636492e-05, 4.7410861484210684e-05, -5.1013249388802111e-05,
+1.7373878113596496e-05, -2.8885140853371036e-05, -3.809386534722289e-05, 6.1484937423410865e-05,
+-4.6415896042317888e-05, -3.8889150707335568e-06, -3.3612025186004995e-06, -2.3733137360888791e-05,
+3.4296483733091789e-05, 3.4296483733091789e-05, 5.9852071365426246e-05, 1.1764141684611161e-05,
+1.1764141684611161e-05, 1.0895300605136718e-05, 3.514545682754025e-05, -3.0721879273920451e-05,
+-3.0721879273920451e-05, 1.1771493993013107e-05, -4.3846932874074152e-05, -3.8299490277562899e-05,
+3.0945386488409476e-05, 5.7356586173234386e-05, -4.4517321816822838e-05, 4.4427476644609531e-05,
+1.8132141503018286e-05, 5.6297581431306875e-05, 1.7158171033140193e-05, -2.1906334390214544e-05,
+-1.1769717544273521e-05, 5.3310437954955019e-05, 5.858213607215312e-05, -1.7330819814514108e-05,
+-5.9999879374173169e-05, -1.3516396671009362e-06, -4.8761076278902522e-05, -5.6915209605112333e-05,
+1.4851274117256565e-05, 1.380662242909096e-05, -2.4040276665590811e-05, 2.6417761293901533e-05,
+-4.4973462682561526e-05, -5.8168567540974614e-05, 5.8773594621508608e-05, -5.9965889385684931e-05,
+5.9155523660647226e-05, -3.8299071104905486e-05, -2.0433051092264303e-06, 8.0996992082854309e-06,
+6.194959634173579e-06, 9.0419903501368559e-06, 9.0419903501368559e-06, 2.0635049435883035e-05,
+-2.0635049435883031e-05, -3.5859380621953453e-05, -4.8555908306639285e-05, -1.6979075946076557e-05,
+3.5998340331625772e-05, 4.7563627862338853e-05, 2.6784295423562566e-05, 2.7942822153520764e-05,
+1.7465502087747436e-05, -4.6159162591077317e-05, -4.8500256211737413e-05, 4.6941355914640069e-05,
+-2.7316618326073124e-05, 6.8228157824888049e-06, -4.4867367631681115e-05, 9.4543779656987862e-06,
+4.9971592432559092e-05, 4.9971557420845105e-05, 4.8693977765657613e-05, 4.7204324426127297e-05,
+-4.4312826850514413e-05, -3.3749130637988788e-05, 3.9922892924215194e-05, -2.6414952225495999e-05,
+4.8527754651702841e-05, 1.7339931862497751e-05, -2.2554867025811723e-05, 1.7882846810558567e-05,
+2.7753067122133162e-05, 4.9976392175976797e-05, -8.9831626446676477e-07, 5.9927895980627611e-06,
+-1.3241927806144775e-05, -4.6598033569212002e-05, 2.7134619305582753e-05, 4.9999998182176523e-05,
+4.9999898671924359e-05, -4.8366132431365228e-05, 2.6359440440214762e-05, -4.2143665721859718e-05,
+-1.6403504829648752e-05, 4.6691756591950661e-05, 1.4426658989611691e-05, 1.4426658989611691e-05,
+-1.605276751316848e-05, -1.9300051905411564e-05, -4.3283225310641908e-05, -2.9632910055579909e-05,
+2.8863958062925412e-05, 1.4536904871021043e-05, 4.745545317194356e-05, -3.268559407165905e-05,
+1.6622386295043246e-05, -4.9999963310754604e-05, 3.8920502108963104e-05, 3.8920502108963104e-05,
+-1.3308832421746597e-06, 4.8875266098154642e-05, 4.9999957391339845e-05, 4.7502909998949797e-05,
+4.7502909998949797e-05, 3.6829877546105216e-05, 2.0416842155551958e-05, 2.0435341699270844e-05,
+3.8982923181291551e-05, 3.7242095077540073e-05, 2.4112246664113267e-05, 3.954715357625949e-05,
+1.719213833138677e-07, 1.719213833138677e-07, 2.4462131325176457e-06, -3.9940502791395975e-05,
+3.7267466510495897e-05, 1.2846068582113116e-05, -1.2846068582113094e-05, 2.6996455853711689e-05,
+-2.1921686181252446e-05, -2.0797874425059476e-06, 2.0797874425059429e-06, 3.9906151589087081e-05,
+2.8823240132351166e-05, -3.10380341678226e-05, 3.8721955664180065e-05, 2.539575833402501e-05,
+3.286913227310836e-05, 8.9891580235627155e-06, 2.31202473093228e-05, 9.4004120514008156e-06,
+-2.096984106852818e-05, 3.1189662851479199e-05, 2.4615262206857105e-05, 2.4615262206857105e-05,
+-3.4378654927019337e-05, 3.9843261333865089e-05, 3.4341271637857331e-05, -5.520566055658715e-06,
+2.3043102767889934e-05, 3.9569824872868551e-05, 2.5177307695041927e-05, -9.373463422061391e-06,
+3.8094769792450309e-05, 3.1718470213115173e-05, -2.0429171840005692e-05, 3.1308949848525286e-05,
+1.2370857880680709e-05, -1.2370857880680714e-05, -3.5904760249362745e-05, -3.5904760249362745e-05,
+3.9999920754398413e-05, 3.9977040638376731e-05, -3.9577752892128454e-05, -3.9577752892128454e-05,
+3.2994672308543231e-05, 1.3780074122913331e-05, -1.1398107156996989e-05, 3.5814098985594365e-05,
+3.1988756981112964e-05, -3.888590195938487e-05, -6.2175753839996833e-06, 2.463172346418592e-05,
+-3.8958594011088034e-05, 2.7550469794951675e-05, -2.2240736972085504e-05, 3.4739243856197551e-05,
+-3.9614916583121235e-05, -3.3746441627415042e-05, -3.7962275404027037e-05, 2.4689905617358547e-05,
+-2.2578554935178111e-05, 3.6533976887781778e-05, 2.5865121417066451e-05, -1.8757395519778506e-05,
+3.3950693399648672e-05, -3.7296760400369295e-05, 1.3561970108509215e-05, -3.7302474378017346e-05,
+-1.662932922709596e-05, -1.662932922709596e-05, -1.662932922709596e-05, -1.662932922709596e-05,
+-2.0961683847615123e-05, -2.0961683847615123e-05, 1.6312568404431486e-05, -1.5014236071742137e-05,
+-1.5014236071742137e-05, -1.9083736408542388e-05, 9.029607868358716e-06, -2.9113643472622968e-05,
+-1.2317340463651277e-05, 2.0694940408236081e-05, 2.0694940408236081e-05, -2.3400892708157098e-05,
+-2.2518270374390818e-05, -8.1365259887197067e-06, 4.9215095592123366e-06, -4.9215095592123468e-06,
+-4.7750465767109152e-06, 1.6297207359941971e-05, 1.6297207359941971e-05, 1.3756103946208635e-05,
+1.5321167621948708e-05, 1.5321167621948708e-05, -2.6999414048802053e-05, -2.3044479922016687e-05,
+-9.7901068237816229e-06, -5.7569913498159756e-06, -2.8809368529592695e-05, 2.3065629944412935e-05,
+-2.0930004191230897e-05, -2.0930004191230897e-05, -9.5901897671917402e-06, 2.6258956846293569e-05,
+2.6258956846293569e-05, -2.2369976950467144e-06, -1.3887687777926736e-05, 2.1882398480331849e-05,
+-2.7801385115331708e-05, -2.931716536495171e-05, -1.8129848028204332e-05, -1.8129848028204332e-05,
+1.6432570052714737e-05, 7.8446182026421348e-06, 9.672074857126018e-06, 1.9296881434466349e-05,
+-2.9990457000875442e-05, 2.6586529456028637e-05, -2.6586529456028637e-05, -6.4621914967849744e-06,
+1.5052487878176919e-05, -2.8014203555975325e-05, 2.5543063016422222e-05, 2.7850115733397356e-06,
+8.6964541530839102e-06, -1.8773857287152804e-05, -1.3812031707683189e-05, -2.9998125466092458e-05,
+2.6695599378403058e-05, -2.6439588503403624e-05, -2.6439588503403624e-05, 1.5295009550189421e-05,
+2.9984468529225159e-05, 1.1462072909827626e-07, -1.1462072909827994e-07, 2.996387987016156e-05,
+-1.2208103464353418e-06, 2.9999939002705373e-05, -2.9999939002705373e-05, 2.7837190462541597e-05,
+-2.9251691677898477e-05, 2.8354147369950478e-05, -5.4168000452706639e-06, 8.0028007304536469e-06,
+8.0028007304536469e-06, 2.8600473631816337e-05, 2.8600473631816337e-05, 2.9922068022308641e-05,
+2.8204911735215577e-05, 2.9674563487737747e-05, 2.9674563487737747e-05, 2.9999936915658329e-05,
+2.9082977698429548e-05, 2.9082977698429548e-05, 1.8828185062010502e-05, -1.1853307380709029e-05,
+-1.7365718452397307e-05, 2.2606292522715316e-05, -1.9101385729954029e-05, -2.6545146802251545e-05,
+-2.6545146802251545e-05, -2.1847645385827046e-06, -4.0909558974925758e-06, -1.4401868538938873e-05,
+2.9386008188347698e-05, 2.7856940607102808e-05, 2.7856940607102808e-05, -2.9998783273520381e-05,
+-2.8897619642805655e-05, 2.8898170862537494e-05, -8.3990174515481382e-06, 8.0295474789928154e-06,
+3.3391975797582245e-06, -2.8652144378121742e-05, 2.8652144378121738e-05, -1.7089546134389115e-05,
+1.4676098891200878e-05, 1.0632036106808021e-05, -9.3774137985085421e-06, -2.0645353572898583e-05,
+-1.5598890159372786e-05, 1.5160259315331974e-06, 4.1502930441583313e-06, 4.1502930441583313e-06,
+1.5160259315331974e-06, 1.7852763851047204e-05, -1.0007952051877019e-05, 1.0007952051877009e-05,
+2.3652654035519516e-05, 2.9999969403551195e-05, -2.8451601432380331e-05, 2.8472486851521142e-05,
+-2.8472486851521142e-05, -1.4100676354909285e-05, -3.5941714619928073e-06, 1.8324252610459852e-05,
+1.0204001150856983e-05, -2.5420981007623931e-05, -7.455731517768061e-06, -2.8471683454547753e-05,
+-2.7852104635827038e-05, 2.258948672766843e-05, 2.41290664199609e-05, 2.7868919383368917e-05,
+1.0346104773212735e-05, -2.7891634687956482e-05, 1.3504856177167115e-05, 2.3456687353141889e-07,
+2.3456687353141889e-07, 1.1449644251011675e-05, -1.875982089328254e-05, -6.4243598812751996e-06,
+-1.2763419896037887e-05, 1.9293349936915352e-05, 1.518016608258383e-05, 1.518016608258383e-05,
+1.170387535680866e-05, 1.170387535680866e-05, 1.2915309429809822e-06, 1.5175205947813356e-05,
+1.5827435198250751e-05, 1.3274598194593524e-06, -1.3274598194593638e-06, -1.7905371768922307e-05,
+1.7905283122661616e-05, 1.4670455624805844e-05, -4.1005811322609547e-06, 1.6778802861860948e-05,
+-1.9493168393321752e-05, -1.5345835138662421e-05, -1.7582303327401247e-05, -1.7582303327401247e-05,
+-1.9996868264710025e-05, 1.9996868264710025e-05, -1.9270775838287661e-05, -6.2448546292562882e-06,
+-7.5860226765432297e-06, -1.9722255481329308e-05, 1.7724152444361654e-05, 8.5685857459729265e-06,
+-1.0894856223295159e-05, -1.3699071150354111e-06, -1.3699071150354111e-06, -9.7529574643931981e-06,
+9.7529574643932032e-06, -1.0199264437131119e-05, -1.0199282453032726e-05, -1.1053417555650708e-05,
+-8.1591204988226553e-06, -8.1591204988226553e-06, -2.9764207001762698e-06, -2.9764207001762698e-06,
+-1.220472557192631e-06, 1.2204725571926198e-06, 3.6863109670736273e-06, -6.1888213962564028e-06,
+-6.1888213962564028e-06, -1.805453292102862e-05, -1.0681496483094903e-05, -1.0681496483094903e-05,
+-2.4912079470500123e-06, 5.2129244004617652e-06, 1.5693560648956345e-05, -6.5441369800395781e-06,
+1.2783484214550864e-05, -1.5812177871288154e-05, -1.4375605672806991e-05, -5.8695386399626262e-06,
+1.2214446344433614e-06, 1.2214446344433614e-06, -8.7093701316160659e-07, 1.3590652115887548e-05,
+1.1636875865481583e-05, 1.1636875865481583e-05, 1.949203787500679e-05, -1.8706656275670133e-05,
+-3.8528713048322616e-06, -1.9666591383825883e-05, -1.9999997473381327e-05, -1.9999997473381327e-05,
+-7.6348825996899952e-06, 1.4873444609319638e-05, -1.5776083541243048e-05, -1.2881412542784906e-05,
+1.3126656702971241e-05, 1.3126656702971241e-05, -1.999238436228611e-05, -1.999238436228611e-05,
+1.4409448862031879e-05, 1.4409867639039515e-05, 1.7684426648148897e-05, 1.3315763377221248e-05,
+1.98911311638926e-05, 9.68523329096956e-06, -1.7214565115868873e-05, 9.101642991180241e-06,
+-1.7037713141876962e-05, -1.7037713141876962e-05, -9.2908260575729517e-06, -1.9175880081791323e-05,
+7.2622081075105029e-06, 1.019827354531853e-05, 1.019827354531853e-05, 1.1197172128672809e-05,
+-1.7704200803044547e-05, 1.770420080304455e-05, -1.0081726696996253e-05, 1.8918301203518149e-05,
+1.8704470869205493e-05, 1.8704470869205493e-05, 1.9864353359241696e-05, 1.9864353359241696e-05,
+1.9301442353640395e-05, -6.0575750504894869e-06, 1.6042498807726962e-06, -1.9537778573586898e-05,
+-5.1181785360644351e-06, -5.1181785360644351e-06, 1.8039129485616875e-07, -1.0072801784892571e-05,
+1.9979306754437589e-05, 1.9444804100603816e-05, -1.0143138856748378e-05, 7.997744961169219e-06,
+1.8718525496422164e-05, -7.6290232480271523e-06, -7.6290232480271523e-06, 1.083115654806654e-05,
+-1.933890073686652e-05, 1.8373115517413745e-05, 1.9504145670502806e-05, 1.9504136400945157e-05,
+1.9044377594912595e-05, 1.9044377594912595e-05, -1.8989971156099177e-05, 1.8718906581750293e-05,
+1.089766625653469e-05, -1.0896041743371401e-05, 1.2731288027153108e-05, -1.8514393866739048e-05,
+-1.9003807209677817e-05, 1.7648889555261671e-05, 1.9997665312153055e-05, 1.9997665312153055e-05,
+1.9191919104812969e-05, -9.9728626680308095e-07, -1.9785558828386927e-05, -1.6808175413950966e-05,
+1.0131894170945662e-05, 1.4445616003784374e-05, -8.4365154793947719e-06, -2.3063159174730737e-06,
+-2.5389862199263401e-06, 1.935559399163405e-05, 1.8544457642014976e-05, -1.8554839228528368e-05,
+1.9999989897034832e-05, -1.8134527531575283e-05, 1.8948168199902261e-05, 9.012954839418193e-06,
+1.9995665346315739e-05, 1.8606847754869411e-05, 1.8606847754869411e-05, -1.9295555488215126e-05,
+4.6994222630867517e-06, -4.6994222630867542e-06, 1.975296400154674e-05, 1.9335528512913427e-05,
+1.9335045695594603e-05, -1.9500314717256985e-05, 1.5575254314033424e-05, 1.5575254314033424e-05,
+2.080852186147093e-06, 2.080852186147093e-06, -1.9951458838413522e-05, 1.8915104354167154e-05,
+-1.637000227166472e-05, -1.910426102378915e-05, -1.910426102378915e-05, -6.1826769895552932e-06,
+-6.1826769895552932e-06, 1.452505935137231e-05, 2.892018386572961e-06, 2.892018386572961e-06,
+-9.6034357674299997e-07, -1.5245258377397818e-05, 2.091975232335295e-06, -1.3432379145905162e-05,
+1.9824821494729672e-05, -1.0302344263729973e-05, 1.9672006994166247e-05, 1.964695404619773e-05,
+-1.9646954046197727e-05, -6.7628252056617798e-06, 6.762825205661773e-06, 1.8371574807572289e-05,
+1.8371574807572289e-05, 6.519564175370546e-06, -1.6129604156828014e-05, -6.7917649907606586e-06,
+-6.7917649907606586e-06, -1.9175391100858878e-05, 1.7258848310267782e-05, 1.7258848310267782e-05,
+-1.4361848193131948e-05, -7.1783562320963739e-06, 6.756336844989477e-06, 9.79899535231194e-06,
+9.79899535231194e-06, 1.4920801978849596e-06, -1.4920801978849444e-06, -1.8639493105009593e-05,
+1.8639493105009593e-05, -6.2667667982039959e-06, -6.2667667982039959e-06, -1.8983393527092614e-05,
+7.68653808057155e-06, 7.68653808057155e-06, -1.8641326139475466e-05, 1.8641326139475466e-05,
+-1.8570483858923753e-05, -1.8643419576099813e-05, 1.8643419576099813e-05, -5.4214803935662549e-07,
+-5.4214803935662549e-07, 5.9301047598477209e-06, -1.8573160153313578e-05, 1.8645772830710386e-05,
+-1.8645772830710386e-05, -1.8645772830710386e-05, 1.8645772830710386e-05, -7.9197832877752545e-06,
+-1.8576094044136715e-05, -8.8849198063637942e-07, -1.8648380200184647e-05, 1.8648380200184647e-05,
+-6.289247194333901e-06, -6.289247194333901e-06, 1.9108854988833496e-05, -1.91088549888335e-05,
+6.7215422799250715e-06, 6.7215422799250715e-06, 1.8582710800426713e-05, 1.9999967513496456e-05,
+1.9999967513496456e-05, -1.8654340506808362e-05, -1.8654340506808362e-05, -1.6681532085632063e-05,
+-1.6681532085632063e-05, 1.8586382940121549e-05, -1.9946218194620709e-05, -1.5866550421837581e-05,
+-8.31466461354798e-06, -8.31466461354798e-06, 1.9589497244257059e-05, -1.8590289939180879e-05,
+-1.8665065858694642e-05, -1.8665065858694642e-05, 1.3343244506036309e-05, -1.3343244506036312e-05,
+6.4794414677108867e-06, 6.4794414677108867e-06, 2.4199380034967973e-06, -8.5107963130313097e-07,
+8.5107963130313732e-07, 9.9548209583576029e-06, 9.9548209583576029e-06, -1.8083980700273703e-06,
+-1.8083980700273703e-06, -2.2129353693762621e-06, -7.8453140821039006e-06, 1.1758038148711366e-06,
+1.1758038148711366e-06, 7.7236321071710733e-06, 7.7236321071710733e-06, 8.6183035135013915e-06,
+8.6183035135013915e-06, 7.1994403430624403e-06, -9.9956167046214843e-06, -3.1367826019423543e-06,
+3.1367826019423547e-06, 7.2442541375898214e-06, 7.2442541375898214e-06, 1.4108698056083848e-06,
+-6.3149043598560146e-06, -6.3149043598560146e-06, -4.793815827880288e-06, -4.793815827880288e-06,
+1.8149394539402676e-06, -1.8149394539402623e-06, 9.3266320282217002e-06, -9.3266320282217002e-06,
+-6.3444738383591362e-06, 6.3444738383591354e-06, -9.9775732937705929e-06, 5.5522102815608318e-06,
+-3.742793617444146e-06, -3.742793617444146e-06, -5.9514746240164326e-07, -1.8040876312940667e-06,
+-1.8040876312940667e-06, 3.0406132682681761e-06, 3.0406132682681761e-06, -9.9943181923824999e-06,
+-9.9943181923824999e-06, -9.9943117784718714e-06, -9.9943117784718714e-06, 9.9894093084409432e-06,
+9.9894093084409432e-06, 8.8727148202015817e-06, 9.1479386434110818e-06, -5.0228804362762365e-07,
+6.3896841841702225e-06, 8.8056570880644266e-06, 8.8056570880644266e-06, 5.3924885823438597e-06,
+5.3924885823438597e-06, -6.585339617845717e-06, -8.7504853289583039e-06, 8.1149759889911877e-06,
+-5.6423060223036564e-06, -5.6423060223036564e-06, 1.7850993922373318e-06, 7.8596724944383464e-07,
+7.8596724944383464e-07, -9.0223047559723629e-06, 6.9152307020154811e-07, 6.9152307020154811e-07,
+5.4527517305485349e-06, 5.4527517305485349e-06, -5.7499911188235771e-06, -5.7499911188235771e-06,
+-5.7499911188235771e-06, -5.7499911188235771e-06, 9.938325751702536e-06, -8.9787982482405346e-07,
+8.9787982482405018e-07, 5.087796953579053e-06, 1.6178845332979185e-07, -5.0232952225772111e-06,
+5.0232952225772145e-06, -9.8266939464465661e-06, -9.8266939464465661e-06, -8.251949377176528e-06,
+-8.251949377176528e-06, -4.9742310592380364e-06, -3.3087989122918302e-06, -3.3087989122918302e-06,
+-9.2801224233486777e-06, -4.0097668528032504e-06, -4.0097668528032504e-06, 7.9538833223671571e-06,
+7.9538833223671571e-06, -9.2790634875138644e-06, -9.2790634875138644e-06, 9.5214710463709094e-06,
+9.4619724015746631e-06, -9.4619724015746614e-06, 4.6603650591774901e-07, -9.9431196782805163e-06,
+3.3170162855686385e-06, -3.3170162855686334e-06, 8.9962409416025645e-06, -9.6527242989694205e-06,
+-9.4853256454373259e-06, -2.8194227482579249e-06, -8.9092354891683153e-06, 5.1189923743519313e-06,
+-4.1552718151732104e-06, 2.9168714564939009e-06, 2.9168714564939009e-06, 9.9925248819667089e-06,
+5.5642439914395398e-06, 9.891417817034755e-06, 9.891417817034755e-06, 9.891417817034755e-06,
+9.891417817034755e-06, -9.4853151438916953e-06, -9.4853151438916953e-06, -1.775127857063442e-06,
+-1.6125270714830659e-07, -1.6125270714830659e-07, 9.9793371232446328e-06, 9.9793371232446328e-06,
+-2.0310807619781065e-06, 2.0310807619781053e-06, -8.4047828643976295e-06, -9.4861102025803261e-06,
+9.4861102025803261e-06, 9.9849072741568949e-06, 9.9849072741568949e-06, -9.9757837109163861e-06,
+9.9757837109163861e-06, 3.7630738043799691e-06, -9.354785744408993e-06, 9.1102503269979211e-06,
+4.9881754207919311e-06, 4.9041938104146427e-06, 4.9041938104146427e-06, 5.4003176383424692e-07,
+5.4003176383424692e-07, -7.233661507654156e-06, -8.4974873505168824e-07, 9.8856010858689799e-06,
+9.8856010858689799e-06, -6.5736988820149154e-07, 1.2404674758779118e-06, 3.3955574542439245e-06,
+3.3955574542439245e-06, -4.1318882746474591e-06, -8.8635102371428924e-06, -9.710870086012308e-06,
+-9.710870086012308e-06, -9.4827734733980842e-06, -9.4827734733980842e-06, 4.89949767615597e-06,
+4.89949767615597e-06, 4.89949767615597e-06, 4.89949767615597e-06, 9.2829598955079807e-06,
+-9.2829598955079824e-06, -3.2449743453376365e-06, -3.2449743453376365e-06, 4.0028552064716742e-07,
+-4.6660107226660301e-06, -4.6660107226660301e-06, -3.8987465024921659e-06, -9.2880470220683576e-06,
+9.2880470220683576e-06, -7.9332752109187906e-06, -7.9332752109187906e-06, 4.1573323067739908e-06,
+4.1573323067739908e-06, 9.7947486221285296e-06, 9.7947486221285296e-06, -7.8026734741670433e-06,
+-7.8026734741670433e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.010245443352824417, 0.010208783652301026, 0.00025496247650460771, 0.0011369106718549578,
+0.0010994935425628447, 0.00055532131022132639, 0.00055532131022132639, 0.00015331812158113847,
+0.0003435436686196266, 0.00034560490911368852, 0.00034560490911368852, -4.7188382272889629e-05,
+-0.00014257143504964898, 9.2219063684407044e-06, 9.2268043919939092e-06, -1.0890984663267475e-05,
+0.00022737165073268982, 0.00022737165073268982, 0.00020008705264476704, 0.00020008705264476704,
+-0.0001570277676109932, -7.3304495784909222e-05, 0.00010497418273670405, 3.5955400990707013e-05,
+6.9361729704725967e-06, 7.9471090227351535e-05, -3.4580666816289988e-05, 5.7125637992109913e-05,
+3.1336746506619052e-05, -3.9340771091711193e-05, -1.971140851230343e-05, 9.4619967143636129e-05,
+2.835034500760839e-06, 2.835034500760839e-06, -3.9801469678904649e-05, 8.0065285843684931e-05,
+0.00010004352632238352, 0.00010004352632238352, 9.5850079392387452e-05, 8.6019540468139255e-05,
+5.4066439276278139e-06, 5.406556788804287e-06, -1.3047583747812233e-05, -3.4022167040571493e-05,
+-7.3872913961686796e-05, 2.4423683854768941e-05, -5.3762721417730541e-06, -1.8380565142282066e-05,
+2.0217275449291384e-06, 2.0217275449291384e-06, 6.774669734133371e-05, 6.774669734133371e-05,
+-5.818658940155421e-05, 5.608569798378195e-06, 2.9719049515222485e-06, 2.9735374514617998e-06,
+-3.368092735467824e-05, -6.8311321888381323e-05, 2.9947735134565401e-05, -5.6108631714752122e-05,
+4.8015561984600783e-05, 5.5071532579150785e-05, 5.9274000354205559e-05, -1.164418955549751e-05,
+1.1644828050631698e-05, -1.1127892274389578e-05, -1.1127892274389578e-05, -6.5263139407909397e-06,
+2.5350371983645036e-06, 2.5366732426059012e-06, -2.8599514123497473e-05, -2.1828797127583733e-05,
+6.1848620958584636e-05, 6.1848620958584636e-05, 5.1499613720153144e-05, 4.793379170059344e-05,
+-6.7809647980902334e-05, -6.3762439083530321e-05, -5.8726973554812531e-05, 3.3460461294477844e-05,
+-5.2398135411374492e-05, 6.9891890370576054e-05, 6.9919255699906824e-05, -6.5853915532860944e-05,
+6.1022546681909058e-05, 6.1022546681909058e-05, 4.2106476067137244e-06, 5.8835405755585593e-05,
+5.8835405755585593e-05, -5.9002478123581453e-05, 4.8629177089310323e-05, 5.1538006692912148e-05,
+5.1538006692912148e-05, -5.8833935183467514e-05, 4.0956641433794784e-05, -4.618602650671375e-05,
+-5.1404115157086061e-05, -1.7613120749950544e-05, -4.0226956860511206e-05, -4.0326161719071091e-05,
+-5.7194627759209356e-05, -2.0750477704992038e-05, -5.7494322909288259e-05, 5.5857967324134738e-05,
+5.8834290587445856e-05, 2.7531749037264076e-05, 1.2966623817468286e-05, 5.7442516349450125e-05,
+1.2031244603030809e-07, 5.9984773653072324e-05, -3.496222876366795e-05, 1.8991021973715072e-05,
+5.8132948119754817e-05, 5.8389872213428618e-05, -5.4973312596584994e-05, -5.3871160078639837e-05,
+3.9716339891035344e-05, -1.4711143743131424e-05, -1.2069158018129293e-05, 2.0228964837082417e-06,
+-1.0031152497824284e-05, 4.6186374099959325e-05, 5.9965197441771252e-05, 5.9450776889249311e-05,
+-4.9614740502505502e-05, 4.917562821670947e-05, 4.917562821670947e-05, -4.5543328103890954e-05,
+4.5543328103890954e-05, 3.4844006965472118e-05, 1.1929952578163837e-05, 4.702883136988803e-05,
+3.4700424973888223e-05, -1.5417564806834543e-05, -4.222086591560298e-05, 4.1463220932492799e-05,
+-4.6850360050088092e-05, -1.9218004810346184e-05, -1.215422343861699e-05, -1.7219439738129874e-05,
+-4.1878423600078911e-05, -4.9532304456770653e-05, 2.2066248475977382e-05, 4.9098011541015685e-05,
+1.6852150468719492e-06, 1.6862529274046913e-06, 1.1353260736794622e-05, 1.6484894766813712e-05,
+-2.3159736106362035e-05, 3.6891681734233352e-05, -3.010253511851865e-05, 4.2452918614916976e-05,
+-1.2043962324091417e-05, 4.6896980318608313e-05, -4.4623737779885175e-05, -4.6692652419305713e-05,
+4.1590470847471438e-05, -1.5363024028380119e-06, 4.9991929627580837e-05, 4.9639565598757523e-05,
+-4.8214638316354197e-05, 1.8127969204590771e-05, -4.1996576469292063e-05, 1.3482668308262121e-08,
+1.0066179660961023e-07, 1.2677430087823028e-05, -4.2487408719275535e-05, 2.6905602381737266e-05,
+4.723266908934631e-05, -1.7885185667418515e-05, -4.7873494862997586e-05, -4.7873494862997586e-05,
+4.7353021605470572e-05, -4.6124917305599793e-05, -2.5031228629618003e-05, 4.0272703430958186e-05,
+-4.0827342859187927e-05, -4.7840133745328149e-05, -1.5747379599332457e-05, 3.7837176694128849e-05,
+4.7156084165867283e-05, -6.0571636874938273e-08, -3.1387808390937377e-05, -3.1387808390937377e-05,
+4.9982284359517809e-05, -1.0545537626625558e-05, -6.5275295482635461e-08, 1.5603638730490905e-05,
+1.5603638730490905e-05, -3.3816565762047674e-05, -3.439698469917497e-05, -3.4385997290089503e-05,
+8.9627953363625259e-06, -1.4595422372629915e-05, 3.191550658863116e-05, -6.0018867046743459e-06,
+3.9999630536268205e-05, 3.9999630536268205e-05, -3.9925130448256501e-05, -2.1808798156914693e-06,
+1.4530517536862434e-05, 3.788111035837844e-05, -3.7881110358378454e-05, 2.9515951133897006e-05,
+-3.3458028557742099e-05, 3.9945894459806438e-05, -3.9945894459806438e-05, 2.7384421390278026e-06,
+2.7734830597514405e-05, 2.5231734680696785e-05, 1.0030461083184248e-05, 3.0903971567418313e-05,
+2.2795178078113512e-05, -3.8976852592627569e-05, 3.2641295384156433e-05, -3.8879715190107533e-05,
+-3.4062674081179669e-05, 2.5044059798903581e-05, 3.1529174846285978e-05, 3.1529174846285978e-05,
+2.0447691444486573e-05, 3.5375876358517665e-06, -2.0510413508627657e-05, -3.9617210280698829e-05,
+-3.2695801180403322e-05, 5.8505520705753856e-06, -3.1082200327988083e-05, -3.8886220997614021e-05,
+1.2197889754388492e-05, -2.4370856516333718e-05, -3.4389663242484925e-05, -2.4894771727865442e-05,
+-3.8038952079362022e-05, 3.8038952079362022e-05, 1.7630887426212592e-05, 1.7630887426212592e-05,
+7.9621867895249494e-08, -1.3550726170858358e-06, 5.7966780150028955e-06, 5.7966780150028955e-06,
+-2.2613084691210322e-05, -3.7551425501131305e-05, -3.8341663412502258e-05, -1.7814328891374187e-05,
+2.4014983381282963e-05, -9.3747868671830755e-06, -3.9513817283885411e-05, 3.1516316396176018e-05,
+9.0679629840011848e-06, -2.8999510583412536e-05, 3.3246798626913075e-05, -1.9828891454129269e-05,
+5.5370013646690111e-06, -2.1475047787780809e-05, -1.2604191610286001e-05, 3.1470757229623936e-05,
+3.3018310935587609e-05, 1.6287066425941379e-05, 3.0512218766920417e-05, 3.5329309550493528e-05,
+-2.1150659982209829e-05, -1.4455160450076121e-05, -3.7630744967059887e-05, -1.4440408764206078e-05,
+3.6379464117230371e-05, 3.6379464117230371e-05, 3.6379464117230371e-05, 3.6379464117230371e-05,
+-3.4067694525351019e-05, -3.4067694525351019e-05, -2.5177373017269765e-05, 2.597253771162913e-05,
+2.597253771162913e-05, -2.3147591768675932e-05, 2.8608847962539044e-05, -7.2384918145286379e-06,
+2.7354764190219208e-05, 2.1719103146759021e-05, 2.1719103146759021e-05, 1.8772272650409702e-05,
+1.9822398930145483e-05, -2.8875542329710258e-05, 2.9593559158346967e-05, -2.9593559158346967e-05,
+2.9617544297092584e-05, 2.518731887809922e-05, 2.518731887809922e-05, -2.6660262643513162e-05,
+2.5792669941286623e-05, 2.5792669941286623e-05, 1.3077906599351074e-05, 1.9208121853106042e-05,
+-2.8357605829458601e-05, -2.9442436220498875e-05, 8.3678124337316597e-06, 1.918271918335358e-05,
+-2.1492671415044178e-05, -2.1492671415044178e-05, 2.8425837898455182e-05, 1.4507487216761287e-05,
+1.4507487216761287e-05, -2.9916481098423923e-05, 2.6591956080416961e-05, -2.0522198633381618e-05,
+1.1273108961995028e-05, 6.3642607555061524e-06, -2.3902062891604474e-05, -2.3902062891604474e-05,
+2.5099215953145284e-05, 2.895620771535485e-05, 2.8398080356921148e-05, 2.2970206070128059e-05,
+7.5662994828466574e-07, 1.3898073660897099e-05, -1.3898073660897097e-05, -2.9295734861219646e-05,
+2.5950387447537982e-05, -1.0733331222149977e-05, 1.5733783134995959e-05, 2.9870448783645077e-05,
+-2.8711873592005619e-05, -2.3399621419194362e-05, -2.6631330798628039e-05, 3.3536326658594017e-07,
+1.3687402011623912e-05, 1.4175618496936454e-05, 1.4175618496936454e-05, -2.5808190228290213e-05,
+-9.6521863839550948e-07, -2.9999781034008581e-05, 2.9999781034008581e-05, -1.4717007598444609e-06,
+-2.9975150076322158e-05, 6.0496561531187581e-08, -6.0496561531192332e-08, -1.1184401063632476e-05,
+6.6587186440909931e-06, 9.8001187198487772e-06, 2.9506919142288571e-05, -2.8912889521261113e-05,
+-2.8912889521261113e-05, 9.056097837135948e-06, 9.056097837135948e-06, -2.1609824775630732e-06,
+-1.0221690369439818e-05, 4.4068448817971617e-06, 4.4068448817971617e-06, -6.1522813009136757e-08,
+7.3607342155962687e-06, 7.3607342155962687e-06, 2.3355929595515669e-05, -2.7559011305531786e-05,
+2.4462866198221085e-05, -1.9721955744231495e-05, 2.3133029702040944e-05, -1.3976951786670601e-05,
+-1.3976951786670601e-05, 2.9920340972504834e-05, -2.9719759081203379e-05, -2.6317032176655534e-05,
+6.0384205512999938e-06, -1.1135118320536455e-05, -1.1135118320536455e-05, -2.7018902337784389e-07,
+-8.0577651355529596e-06, 8.0557880309494918e-06, 2.8800286558445733e-05, 2.8905472964174107e-05,
+-2.9813583473365574e-05, 8.8912666440314821e-06, -8.8912666440314855e-06, 2.4656589644972923e-05,
+2.6165093566346983e-05, 2.8052803928012802e-05, 2.8496738593241536e-05, 2.1766243953654561e-05,
+-2.5625663421574528e-05, 2.9961669936352328e-05, 2.9711530886974017e-05, 2.9711530886974017e-05,
+2.9961669936352328e-05, -2.4109724653731372e-05, 2.8281458514852635e-05, -2.8281458514852638e-05,
+1.8454049882777017e-05, 4.2846073241228557e-08, 9.5134839009152505e-06, 9.4507932201459046e-06,
+-9.4507932201459097e-06, 2.6479632292275177e-05, 2.978392068720632e-05, 2.3753352737414891e-05,
+2.8211316178323006e-05, -1.5930276978446531e-05, 2.9058769201997529e-05, -9.4532132771894992e-06,
+-1.1147208949102111e-05, -1.9741202835199581e-05, -1.7826613635267787e-05, 1.11051038898015e-05,
+-2.8159511998997865e-05, -1.1047928060662904e-05, -2.6788409053805925e-05, -1.9998624412240003e-05,
+-1.9998624412240003e-05, 1.6398342798138943e-05, 6.9331897458500267e-06, -1.8940105599385178e-05,
+1.5397893120729999e-05, 5.26940681782385e-06, 1.3021618858850524e-05, 1.3021618858850524e-05,
+1.6217869824125701e-05, 1.6217869824125701e-05, -1.9958255129728217e-05, -1.3027398989877074e-05,
+1.2226704177544056e-05, 1.9955897635228566e-05, -1.9955897635228562e-05, 8.9105365616600263e-06,
+-8.910714690603061e-06, 1.3593297310093774e-05, 1.9575117735986814e-05, 1.0884474012225255e-05,
+4.4739675892435625e-06, 1.2825963663483292e-05, 9.5321880858098421e-06, 9.5321880858098421e-06,
+3.5392033543323017e-07, -3.5392033543322372e-07, -5.3513735237290801e-06, 1.9000047122558837e-05,
+-1.8505465677765907e-05, -3.3215416193653446e-06, 9.2657660303414103e-06, 1.8071506254706871e-05,
+-1.677206331593483e-05, -1.9953028704840161e-05, -1.9953028704840161e-05, 1.7460808134153958e-05,
+-1.7460808134153958e-05, -1.7203924114616191e-05, -1.7203913433962018e-05, 1.6667992090843838e-05,
+-1.826003156310777e-05, -1.826003156310777e-05, -1.977728292297914e-05, -1.977728292297914e-05,
+1.9962726435463161e-05, -1.9962726435463161e-05, 1.965734243111293e-05, 1.9018372425768694e-05,
+1.9018372425768694e-05, 8.6042920105894718e-06, 1.6908744272761102e-05, 1.6908744272761102e-05,
+1.9844240548949082e-05, 1.9308687661129911e-05, -1.2398070582051424e-05, -1.8899054769656563e-05,
+-1.5381239590368813e-05, -1.2246429314977709e-05, -1.3904746007747121e-05, -1.9119323109199912e-05,
+1.9962666981267549e-05, 1.9962666981267549e-05, -1.9981027719291747e-05, -1.4672906156072877e-05,
+-1.6266011191787995e-05, -1.6266011191787995e-05, 4.4788904294814877e-06, -7.075380624668282e-06,
+-1.9625375988968979e-05, 3.6366445168074449e-06, 1.0053096068145873e-08, 1.0053096068145873e-08,
+-1.8485360902318112e-05, 1.3370887982983802e-05, 1.2292891771252209e-05, -1.529932060264716e-05,
+-1.5089429538665147e-05, -1.5089429538665147e-05, 5.5187635446524857e-07, 5.5187635446524857e-07,
+1.3869671354883946e-05, 1.3869236266837546e-05, 9.3413625412057092e-06, 1.4922816278499626e-05,
+-2.083962816563836e-06, -1.7498464392611569e-05, 1.0181294017535814e-05, 1.7808989158879838e-05,
+1.0474556357913837e-05, 1.0474556357913837e-05, -1.7711029082690917e-05, 5.6820439182356592e-06,
+1.8634922414735426e-05, 1.7204511521541561e-05, 1.7204511521541561e-05, 1.6571763223051217e-05,
+9.3038311423561912e-06, -9.3038311423561861e-06, 1.7273065356417576e-05, -6.4882878768565619e-06,
+-7.0811559439856389e-06, -7.0811559439856389e-06, 2.3253957983928742e-06, 2.3253957983928742e-06,
+5.2396873064236184e-06, -1.9060581956165119e-05, 1.9935555731407159e-05, -4.2749512756859409e-06,
+1.9334017908157875e-05, 1.9334017908157875e-05, 1.9999186457972241e-05, -1.7278271447175064e-05,
+9.0956121953639481e-07, -4.6797001494904701e-06, -1.7237074407587887e-05, 1.8331286794333136e-05,
+7.0439195935071151e-06, 1.8487779863495275e-05, 1.8487779863495275e-05, -1.6813269992219699e-05,
+5.0996978625820215e-06, 7.9011787844454097e-06, 4.4258673346369922e-06, 4.4259081840144532e-06,
+6.108328905878533e-06, 6.108328905878533e-06, 6.2754279129411795e-06, 7.0429068135043226e-06,
+1.6770237629836534e-05, -1.6771293162028621e-05, 1.542447098508302e-05, -7.5642064849695611e-06,
+-6.2334028858559629e-06, 9.408331279572141e-06, -3.0558478874190607e-07, -3.0558478874190607e-07,
+5.6276319242035567e-06, 1.9975120027225021e-05, 2.9209008624806453e-06, 1.0839060810506339e-05,
+1.724368639556975e-05, -1.3831998346992704e-05, -1.8133538170085075e-05, -1.986657763402671e-05,
+1.9838184114858503e-05, -5.0359687480185893e-06, -7.4901996477739094e-06, 7.4644451370121869e-06,
+-2.0102698939521303e-08, 8.4343886089353322e-06, -6.4005407481097161e-06, -1.7854037220265009e-05,
+-4.1637406036870579e-07, -7.3338405100677776e-06, -7.3338405100677776e-06, -5.261324776252764e-06,
+1.9440047077957516e-05, -1.9440047077957516e-05, -3.1337538438107523e-06, 5.1124687897641016e-06,
+5.1142944722873277e-06, -4.4427160530390299e-06, 1.2546372107234157e-05, 1.2546372107234157e-05,
+-1.9891456813903975e-05, -1.9891456813903975e-05, 1.3925840079115463e-06, -6.4976016553007391e-06,
+-1.149012731111766e-05, 5.9183790631329799e-06, 5.9183790631329799e-06, 1.9020370796670174e-05,
+1.9020370796670174e-05, 1.3748550863240529e-05, 1.978980115240484e-05, 1.978980115240484e-05,
+1.997693019997338e-05, -1.2945350401066082e-05, -1.9890290084040899e-05, -1.4817934757605467e-05,
+-2.6412975413808416e-06, -1.7142394893117768e-05, 3.6072345115717539e-06, -3.7412827621812714e-06,
+3.7412827621812773e-06, 1.8821907321992259e-05, -1.8821907321992263e-05, -7.9047605333605921e-06,
+-7.9047605333605921e-06, 1.890754566206902e-05, 1.1825221762996094e-05, -1.8811483947585792e-05,
+-1.8811483947585792e-05, -5.6836938806644229e-06, -1.0106045468093194e-05, -1.0106045468093194e-05,
+-1.391895529403815e-05, 1.8667383367926081e-05, -1.8824237366678038e-05, 1.7435013337688306e-05,
+1.7435013337688306e-05, -1.9944264756643191e-05, 1.9944264756643191e-05, -7.2504687288684937e-06,
+7.2504687288684971e-06, 1.8992831118528068e-05, 1.8992831118528068e-05, -6.2952974668031672e-06,
+-1.8463941408483821e-05, -1.8463941408483821e-05, -7.2457546026420751e-06, 7.2457546026420768e-06,
+-7.4254379834089538e-06, -7.2403664623759359e-06, 7.240366462375941e-06, 1.9992650537220468e-05,
+1.9992650537220468e-05, 1.9100624532648965e-05, -7.4187412624625729e-06, 7.2343040816337359e-06,
+-7.2343040816337308e-06, -7.2343040816337308e-06, 7.2343040816337359e-06, 1.836510366631988e-05,
+-7.4113919113341027e-06, -1.9980254803188696e-05, -7.2275802250380604e-06, 7.2275802250380604e-06,
+1.898539885618849e-05, 1.898539885618849e-05, -5.9035295388211024e-06, 5.9035295388210922e-06,
+-1.8836689448498632e-05, -1.8836689448498632e-05, 7.3947859541507003e-06, -3.6048010852785058e-08,
+-3.6048010852785058e-08, -7.2121827664063561e-06, -7.2121827664063561e-06, 1.1032972730684511e-05,
+1.1032972730684511e-05, 7.3855513811196745e-06, 1.465735219124482e-06, -1.2175901515341104e-05,
+1.8189732058615185e-05, 1.8189732058615185e-05, 4.0313270417128299e-06, -7.3757114895574807e-06,
+-7.1843800352286268e-06, -7.1843800352286268e-06, 1.4898249093505315e-05, -1.4898249093505312e-05,
+-1.8921332888211354e-05, -1.8921332888211354e-05, 1.9853057700496214e-05, -1.9981883381232636e-05,
+1.9981883381232636e-05, -9.4949443760573943e-07, -9.4949443760573943e-07, -9.8351256433418947e-06,
+-9.8351256433418947e-06, 9.7520724490214686e-06, 6.2008908193212246e-06, 9.9306336851650354e-06,
+9.9306336851650354e-06, -6.3518113222195256e-06, -6.3518113222195256e-06, 5.0719665366768323e-06,
+5.0719665366768323e-06, 6.9403212279176944e-06, 2.9605184392593155e-07, 9.4952933029028524e-06,
+-9.4952933029028524e-06, -6.8935318951907937e-06, -6.8935318951907937e-06, -9.8999720399414542e-06,
+-7.753836658446676e-06, -7.753836658446676e-06, -8.7760657363288054e-06, -8.7760657363288054e-06,
+-9.8339206209187494e-06, 9.833920620918751e-06, 3.6074831961007366e-06, -3.6074831961007383e-06,
+-7.7296605174080248e-06, 7.7296605174080265e-06, 6.6935130345421174e-07, -8.3170283749263609e-06,
+9.2731599758237418e-06, 9.2731599758237418e-06, -9.9822742648154538e-06, 9.8359172332127614e-06,
+9.8359172332127614e-06, -9.5265245999174088e-06, -9.5265245999174088e-06, -3.3705173106246449e-07,
+-3.3705173106246449e-07, -3.3724186379871258e-07, -3.3724186379871258e-07, 4.6011049589576154e-07,
+4.6011049589576154e-07, 4.6124756605726626e-06, -4.039210142637571e-06, 9.9873773695214274e-06,
+7.692329687849119e-06, 4.7392407880820669e-06, 4.7392407880820669e-06, 8.4214646522615721e-06,
+8.4214646522615721e-06, -7.5255100901953234e-06, -4.8403518991583125e-06, 5.8435575378442622e-06,
+-8.2561724031584949e-06, -8.2561724031584949e-06, -9.8393810862184781e-06, -9.9690649251974329e-06,
+-9.9690649251974329e-06, 4.3125418131721905e-06, -9.9760611387149715e-06, -9.9760611387149715e-06,
+-8.382571118994457e-06, -8.382571118994457e-06, -8.1815403276797463e-06, -8.1815403276797463e-06,
+-8.1815403276797463e-06, -8.1815403276797463e-06, 1.1089099391051751e-06, -9.9596090194431805e-06,
+9.9596090194431805e-06, -8.6089675431582238e-06, -9.9986911391626242e-06, 8.6467626951844235e-06,
+-8.6467626951844201e-06, -1.8536682774624009e-06, -1.8536682774624009e-06, 5.6484804573014098e-06,
+5.6484804573014098e-06, -8.6750807125531494e-06, 9.4367287636138211e-06, 9.4367287636138211e-06,
+-3.7254969880085904e-06, -9.160882587729216e-06, -9.160882587729216e-06, 6.0610015751664034e-06,
+6.0610015751664034e-06, 3.7281336878774955e-06, 3.7281336878774955e-06, -3.0564013337780884e-06,
+-3.2359045523376352e-06, 3.2359045523376381e-06, 9.9891345959072943e-06, -1.0650685721542874e-06,
+-9.4338434882752023e-06, 9.4338434882752057e-06, -4.3666519120069322e-06, -2.6124535609433017e-06,
+3.1667960780588598e-06, 9.5943136996142535e-06, 4.5415331110258167e-06, 8.5904549979222167e-06,
+9.0958076135122345e-06, -9.5651377881497956e-06, -9.5651377881497956e-06, 3.8658308715748813e-07,
+-8.3089824168624271e-06, 1.4696440279358187e-06, 1.4696440279358187e-06, 1.4696440279358187e-06,
+1.4696440279358187e-06, 3.1668275325724459e-06, 3.1668275325724459e-06, 9.8411849434444306e-06,
+9.9986997936950457e-06, 9.9986997936950457e-06, -6.4251893406461957e-07, -6.4251893406461957e-07,
+9.791563253042001e-06, -9.791563253042001e-06, -5.4184522700055224e-06, -3.1644451685092359e-06,
+3.1644451685092359e-06, -5.4920554120360031e-07, -5.4920554120360031e-07, 6.9551373316083313e-07,
+-6.9551373316082996e-07, -9.2649487609370656e-06, -3.5338341325255082e-06, -4.1235105164694689e-06,
+-8.6670702069042485e-06, -8.7148656369384571e-06, -8.7148656369384571e-06, 9.9854076378508495e-06,
+9.9854076378508495e-06, -6.904646348125487e-06, 9.9638309443345168e-06, 1.5082742360280742e-06,
+1.5082742360280742e-06, 9.9783698483312381e-06, 9.9227637501499097e-06, 9.4058593214510994e-06,
+9.4058593214510994e-06, -9.1064537162295436e-06, -4.6301389046186471e-06, -2.3872582961613771e-06,
+-2.3872582961613771e-06, 3.174430224814783e-06, 3.174430224814783e-06, 8.7175066688441531e-06,
+8.7175066688441531e-06, 8.7175066688441531e-06, 8.7175066688441531e-06, 3.7184211136435922e-06,
+-3.7184211136435914e-06, -9.4588657617126901e-06, -9.4588657617126901e-06, 9.9919853633780026e-06,
+8.8446788486618137e-06, 8.8446788486618137e-06, 9.2086793683624972e-06, -3.7056959556670514e-06,
+3.7056959556670509e-06, -6.0879507576705519e-06, -6.0879507576705519e-06, -9.0948660293075927e-06,
+-9.0948660293075927e-06, 2.0156635208564149e-06, 2.0156635208564149e-06, -6.2544613401579216e-06,
+-6.2544613401579216e-06,
+};
+
+const struct elp_table elp14 = {
+    arg, max_arg, amp, c, s, 833
 };
@@ -1,1718 +1,1651 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp15[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000030, 99999.999000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 277.418350, 0.000020, 0.067000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 177.303670, 0.000020, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 60.078940, 0.000040, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 0.780260, 0.000430, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 234.612130, 0.000110, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 232.101290, 0.000050, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 242.914820, 0.000080, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 62.914820, 0.000080, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 51.999970, 0.000050, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 54.567360, 0.000100, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 30.691880, 0.000220, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 38.288830, 0.000240, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 312.643000, 0.000160, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 132.027260, 0.000160, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 218.660270, 0.000230, 0.086000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 210.722650, 0.000190, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 42.641590, 0.000140, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 5.316820, 0.000240, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 169.385290, 0.000020, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 169.693060, 0.000060, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 169.082180, 0.001200, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 349.082180, 0.001200, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 349.693430, 0.000060, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 349.384600, 0.000020, 0.563000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 185.188010, 0.000250, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 221.322880, 0.000140, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 45.925890, 0.000040, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 326.499310, 0.000050, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 146.499310, 0.000050, 0.074000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 32.939420, 0.000020, 0.020000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 213.438840, 0.000160, 0.041000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 209.497820, 0.000020, 0.434000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 215.917830, 0.000070, 0.079000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 217.855400, 0.000140, 1.881000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 35.917830, 0.000070, 0.073000},
-{{0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 37.842270, 0.000020, 0.037000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 155.592630, 0.000030, 0.042000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 61.853960, 0.000030, 0.039000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 237.254780, 0.000040, 0.082000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 241.853960, 0.000030, 0.940000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 57.254780, 0.000040, 0.070000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 125.531100, 0.000020, 0.075000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 305.531100, 0.000020, 0.075000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 235.089240, 0.000030, 0.072000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 59.459560, 0.000040, 1.407000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 55.089240, 0.000030, 0.080000},
-{{0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 59.459560, 0.000040, 0.039000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 90.959650, 0.000020, 0.101000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 90.959650, 0.000020, 0.060000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 90.764550, 0.000020, 0.086000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 120.706880, 0.000020, 0.074000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 87.447600, 0.000200, 0.076000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 272.904390, 0.000080, 0.038000},
-{{0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 0.000000}, 90.764550, 0.000020, 0.088000},
-{{0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000}, 132.428500, 0.000030, 0.076000},
-{{0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000}, 312.428500, 0.000030, 0.075000},
-{{0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 341.399280, 0.000030, 0.094000},
-{{0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 161.350460, 0.000050, 0.376000},
-{{0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 161.399280, 0.000030, 0.063000},
-{{0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 341.399200, 0.000150, 0.037000},
-{{0.000000, 0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 190.462290, 0.000020, 0.313000},
-{{0.000000, 0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 190.462290, 0.000020, 0.034000},
-{{0.000000, 0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 9.138430, 0.000070, 0.068000},
-{{0.000000, 0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 189.137140, 0.000070, 0.036000},
-{{0.000000, 0.000000, 0.000000, 8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 248.397980, 0.000030, 0.064000},
-{{0.000000, 0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 350.125830, 0.000060, 0.036000},
-{{0.000000, 0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 349.461620, 0.000020, 0.034000},
-{{0.000000, 0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 349.467900, 0.000030, 0.063000},
-{{0.000000, 0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 349.461620, 0.000020, 0.367000},
-{{0.000000, 0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 169.467900, 0.000030, 0.095000},
-{{0.000000, 0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 18.499670, 0.000030, 0.065000},
-{{0.000000, 0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 18.514200, 0.000050, 0.457000},
-{{0.000000, 0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 198.499670, 0.000030, 0.090000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 61.575060, 0.000090, 0.076000},
-{{0.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 34.545250, 0.000040, 0.075000},
-{{0.000000, 0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 264.849260, 0.000100, 0.039000},
-{{0.000000, 0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 274.469060, 0.000040, 0.079000},
-{{0.000000, 0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 103.193750, 0.000020, 1.545000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 120.586010, 0.000060, 0.039000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 125.197850, 0.000060, 0.083000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 312.094020, 0.000020, 0.848000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 118.247310, 0.000100, 0.072000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 298.619540, 0.000020, 1.681000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 298.247310, 0.000100, 0.079000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 118.619540, 0.000020, 0.039000},
-{{0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 298.317850, 0.000250, 0.041000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 145.306240, 0.000240, 0.040000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 150.818020, 0.000240, 0.087000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 333.899070, 0.000020, 0.067000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 132.984470, 0.000520, 0.075000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 148.933940, 0.000090, 15.781000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 312.929290, 0.000520, 0.076000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 310.172030, 0.000020, 0.038000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 328.388670, 0.000280, 0.088000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 322.628340, 0.000220, 0.041000},
-{{0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 147.069400, 0.000020, 0.020000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 183.702540, 0.000200, 0.041000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 182.819010, 0.000100, 0.091000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 1.869780, 0.000030, 0.038000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 4.869280, 0.000030, 2.135000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 356.927970, 0.000050, 0.084000},
-{{0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 356.369780, 0.000230, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 122.652030, 0.000110, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 122.652060, 0.000040, 0.093000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 121.155350, 0.000030, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 301.155350, 0.000030, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 303.685240, 0.000030, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 303.685240, 0.000030, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 133.916600, 0.000350, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 134.210330, 0.000190, 0.094000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 132.587560, 0.000230, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 314.047010, 0.000040, 1.203000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 312.288040, 0.000190, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 314.373790, 0.000020, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 314.373790, 0.000020, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 312.305190, 0.000080, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 312.794130, 0.000140, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 202.458350, 0.000030, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 33.062800, 0.000020, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 138.157610, 0.000040, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 219.697110, 0.000090, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 51.916740, 0.000040, 0.360000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 282.417370, 0.000020, 0.089000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 111.300720, 0.000050, 0.487000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 144.359240, 0.000040, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 102.417370, 0.000020, 0.065000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 208.034990, 0.000090, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 28.818970, 0.000100, 1.000000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 28.034990, 0.000090, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 151.428960, 0.000020, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 1.000000}, 263.824650, 0.000020, 0.077000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 217.390750, 0.000080, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 6.413720, 0.000050, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 232.922050, 0.000050, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 37.390750, 0.000080, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 106.749430, 0.000020, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 85.595620, 0.000020, 1.292000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 253.341030, 0.000030, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 265.595620, 0.000020, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -5.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 198.351930, 0.000030, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 263.944460, 0.000060, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 254.340260, 0.000200, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 254.340260, 0.000070, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 253.607360, 0.000070, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 73.607360, 0.000070, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 157.725020, 0.000020, 0.073000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 337.725020, 0.000020, 0.078000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 61.798120, 0.000040, 0.085000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 246.089040, 0.000100, 0.653000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 241.798120, 0.000040, 0.068000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 37.815950, 0.000020, 0.074000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 76.058570, 0.000070, 0.077000},
-{{0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 231.572150, 0.000060, 0.038000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 272.748140, 0.000020, 0.077000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 269.676120, 0.000100, 0.074000},
-{{0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 269.175960, 0.000060, 0.037000},
-{{0.000000, 0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 312.360030, 0.000030, 0.385000},
-{{0.000000, 0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 309.455600, 0.000060, 0.071000},
-{{0.000000, 0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 129.724210, 0.000030, 0.037000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 341.267420, 0.000030, 0.099000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 161.249230, 0.000060, 0.320000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 161.267420, 0.000030, 0.061000},
-{{0.000000, 0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 341.312590, 0.000200, 0.036000},
-{{0.000000, 0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 190.404010, 0.000020, 0.273000},
-{{0.000000, 0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 190.404010, 0.000020, 0.033000},
-{{0.000000, 0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 188.464570, 0.000040, 0.531000},
-{{0.000000, 0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 188.464570, 0.000040, 0.035000},
-{{0.000000, 0.000000, 2.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 82.368510, 0.000040, 0.035000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 350.021800, 0.000060, 0.037000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 349.392860, 0.000020, 0.035000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 349.376640, 0.000030, 0.064000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 349.392860, 0.000020, 0.444000},
-{{0.000000, 0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 169.376640, 0.000030, 0.091000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 25.083040, 0.000150, 0.076000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 13.341520, 0.000030, 0.075000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 18.304930, 0.000030, 0.067000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 31.079660, 0.000020, 0.286000},
-{{0.000000, 0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 31.079660, 0.000020, 0.043000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 270.394140, 0.000100, 0.039000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 270.402850, 0.000100, 0.082000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 254.583830, 0.000020, 0.896000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 254.432920, 0.000020, 0.070000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 292.981140, 0.000030, 0.076000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 3.000000, -1.000000}, 292.981140, 0.000030, 0.075000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 95.188620, 0.000040, 0.072000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 268.661580, 0.000040, 1.519000},
-{{0.000000, 0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 275.188620, 0.000040, 0.079000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 121.037110, 0.000150, 0.040000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 118.348490, 0.000090, 0.086000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 123.352970, 0.000020, 0.067000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 111.840630, 0.000200, 0.075000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 292.750970, 0.000240, 0.076000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 118.142030, 0.000030, 0.038000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 299.774840, 0.000160, 0.088000},
-{{0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.866410, 0.000370, 0.041000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 148.686250, 0.000180, 0.041000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 148.756220, 0.000090, 0.090000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 154.130250, 0.000090, 0.078000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 326.395830, 0.000040, 2.470000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 334.130250, 0.000090, 0.073000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 326.064330, 0.000060, 0.084000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 326.724490, 0.000260, 0.040000},
-{{0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 146.849840, 0.000030, 0.019000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 180.422210, 0.000180, 0.042000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 2.857820, 0.000030, 0.039000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 354.143150, 0.000040, 0.081000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 182.857820, 0.000030, 1.068000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 174.143150, 0.000040, 0.070000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 176.619720, 0.000040, 1.194000},
-{{0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 356.612680, 0.000080, 0.039000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 212.773910, 0.000240, 0.043000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 212.559120, 0.000030, 0.308000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 34.802580, 0.000020, 0.074000},
-{{0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 214.802580, 0.000020, 0.077000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -4.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 341.456580, 0.000060, 0.043000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -4.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 339.644630, 0.000120, 0.076000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -4.000000, 5.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 164.546740, 0.000040, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 333.088320, 0.000210, 0.043000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 333.088320, 0.000050, 0.103000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 329.602570, 0.000400, 0.087000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 149.871280, 0.000070, 0.572000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 152.566320, 0.000030, 0.067000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 150.397330, 0.000060, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 149.310130, 0.000120, 37.133000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 329.337770, 0.002250, 0.076000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 329.338620, 0.000120, 0.038000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000}, 329.312380, 0.000040, 0.040000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 40.394870, 0.000060, 0.044000},
-{{0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 266.547660, 0.000100, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -5.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 14.910520, 0.000030, 0.044000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -5.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 194.696840, 0.000050, 0.075000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 140.014870, 0.000030, 0.020000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 155.243800, 0.000110, 0.044000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 167.065840, 0.000030, 0.089000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 224.446080, 0.000080, 0.500000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 347.065840, 0.000030, 0.066000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 85.031140, 0.000020, 0.077000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 272.836130, 0.000150, 0.074000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 222.908790, 0.000230, 0.037000},
-{{0.000000, 0.000000, 2.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 157.759070, 0.000040, 0.073000},
-{{0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 268.361840, 0.000030, 0.080000},
-{{0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 88.361840, 0.000030, 0.071000},
-{{0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 118.055570, 0.000020, 0.046000},
-{{0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 118.055570, 0.000020, 0.207000},
-{{0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 311.089810, 0.000120, 0.069000},
-{{0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 131.092550, 0.000120, 0.036000},
-{{0.000000, 0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 160.927670, 0.000030, 0.278000},
-{{0.000000, 0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 340.563420, 0.000060, 0.066000},
-{{0.000000, 0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 341.164500, 0.000190, 0.035000},
-{{0.000000, 0.000000, 3.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 82.225600, 0.000060, 0.036000},
-{{0.000000, 0.000000, 3.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 140.204350, 0.000030, 0.432000},
-{{0.000000, 0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 357.563850, 0.000060, 0.038000},
-{{0.000000, 0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 349.231330, 0.000030, 0.066000},
-{{0.000000, 0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 169.231330, 0.000030, 0.087000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 19.709170, 0.000040, 0.079000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 199.709170, 0.000040, 0.073000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 18.231980, 0.000050, 0.069000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 198.231980, 0.000050, 0.083000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.736430, 0.000050, 0.043000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 194.867720, 0.000020, 0.070000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 14.867720, 0.000020, 0.082000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 14.927890, 0.000080, 0.095000},
-{{0.000000, 0.000000, 3.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 14.927890, 0.000220, 0.042000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 239.761960, 0.000100, 0.039000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 241.504240, 0.000110, 0.082000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 273.580240, 0.000050, 0.075000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 48.182610, 0.000030, 0.072000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 228.182610, 0.000030, 0.080000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 59.523240, 0.000020, 0.063000},
-{{0.000000, 0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 59.523240, 0.000020, 0.093000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 79.814050, 0.000140, 0.074000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 268.468520, 0.000040, 5.260000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 259.814050, 0.000140, 0.077000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 279.600420, 0.000020, 0.089000},
-{{0.000000, 0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 269.951060, 0.000080, 0.041000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 120.893230, 0.000170, 0.041000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 138.084970, 0.000060, 0.077000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000}, 296.574240, 0.000030, 0.075000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 318.084970, 0.000060, 0.074000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000}, 116.574240, 0.000030, 0.075000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 296.154400, 0.000030, 0.068000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 297.020830, 0.000070, 0.085000},
-{{0.000000, 0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.515200, 0.000300, 0.040000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 144.729420, 0.000240, 0.042000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 145.356590, 0.000100, 0.094000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 163.745280, 0.000020, 0.039000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 147.482590, 0.000040, 0.081000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 327.482590, 0.000040, 0.071000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 326.280530, 0.000030, 0.076000},
-{{0.000000, 0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 327.205720, 0.000250, 0.039000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 183.612720, 0.000190, 0.043000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 183.004430, 0.000040, 0.099000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 2.782730, 0.000030, 0.040000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 182.782730, 0.000030, 0.712000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 174.600990, 0.000040, 0.073000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 174.600990, 0.000040, 0.078000},
-{{0.000000, 0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 356.127620, 0.000040, 0.038000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 212.667860, 0.000190, 0.044000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 35.587390, 0.000030, 0.088000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 215.587390, 0.000030, 0.066000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 218.102700, 0.000110, 0.075000},
-{{0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 32.173380, 0.000050, 0.037000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 241.363960, 0.000040, 0.405000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 63.175560, 0.000030, 1.440000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 41.038960, 0.000040, 0.072000},
-{{0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 246.021960, 0.000130, 0.037000},
-{{0.000000, 0.000000, 3.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000}, 284.631910, 0.000070, 0.075000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 111.949750, 0.000030, 0.098000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 291.949750, 0.000060, 0.333000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 291.949750, 0.000030, 0.062000},
-{{0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 229.832130, 0.000280, 0.036000},
-{{0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 131.989690, 0.000020, 0.283000},
-{{0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 131.989690, 0.000020, 0.033000},
-{{0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 130.196710, 0.000070, 0.067000},
-{{0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 130.315140, 0.000060, 0.035000},
-{{0.000000, 0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 342.191070, 0.000030, 0.437000},
-{{0.000000, 0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 162.191070, 0.000030, 0.035000},
-{{0.000000, 0.000000, 3.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 219.151530, 0.000040, 0.060000},
-{{0.000000, 0.000000, 3.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 68.039090, 0.000040, 0.033000},
-{{0.000000, 0.000000, 4.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 82.163060, 0.000030, 0.036000},
-{{0.000000, 0.000000, 4.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 262.163060, 0.000030, 0.879000},
-{{0.000000, 0.000000, 4.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 330.987710, 0.000050, 0.075000},
-{{0.000000, 0.000000, 4.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 320.176780, 0.000020, 0.066000},
-{{0.000000, 0.000000, 4.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 140.130260, 0.000030, 0.541000},
-{{0.000000, 0.000000, 4.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 140.176780, 0.000020, 0.088000},
-{{0.000000, 0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 1.821780, 0.000040, 0.038000},
-{{0.000000, 0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 349.115090, 0.000040, 0.069000},
-{{0.000000, 0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 169.115090, 0.000040, 0.084000},
-{{0.000000, 0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 210.506410, 0.000030, 0.391000},
-{{0.000000, 0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.506410, 0.000030, 0.042000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 237.929780, 0.000120, 0.040000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 234.067820, 0.000030, 0.085000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 234.067820, 0.000030, 0.068000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 62.130100, 0.000080, 0.074000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 242.130100, 0.000080, 0.077000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 241.465060, 0.000040, 0.041000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -4.000000, 1.000000, 0.000000}, 91.931480, 0.000040, 0.028000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 91.931480, 0.000150, 0.026000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 91.970230, 0.001340, 0.040000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 92.132350, 0.001310, 0.087000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 272.442980, 0.000060, 0.564000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 91.353930, 0.000110, 0.038000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 91.297650, 0.001780, 0.075000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 271.297850, 0.001780, 0.075000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 271.353960, 0.000110, 0.038000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 92.444410, 0.000060, 0.564000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 272.133640, 0.001320, 0.087000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 271.971250, 0.001340, 0.040000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 271.932670, 0.000150, 0.026000},
-{{0.000000, 0.000000, 4.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000}, 271.932670, 0.000040, 0.028000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 88.702570, 0.000050, 0.041000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 88.702570, 0.000050, 0.487000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 88.816990, 0.000040, 0.077000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 268.455560, 0.000020, 3.594000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 268.816990, 0.000040, 0.074000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 268.455560, 0.000020, 0.037000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 88.279100, 0.000030, 0.669000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 268.563660, 0.000060, 0.085000},
-{{0.000000, 0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 268.279100, 0.000030, 0.040000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 118.491790, 0.000180, 0.042000},
-{{0.000000, 0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.583680, 0.000280, 0.039000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 156.055510, 0.000050, 0.745000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 147.495490, 0.000020, 0.036000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 329.200330, 0.000040, 0.073000},
-{{0.000000, 0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 326.853080, 0.000180, 0.038000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 182.042150, 0.000160, 0.044000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 25.980260, 0.000020, 0.041000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 205.980260, 0.000020, 0.534000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 201.316700, 0.000020, 0.076000},
-{{0.000000, 0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 177.580800, 0.000090, 0.075000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 33.002360, 0.000020, 0.041000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 32.538690, 0.000030, 0.092000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 225.909630, 0.000050, 0.416000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 212.538690, 0.000030, 0.064000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 57.710240, 0.000020, 0.035000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 19.479750, 0.000030, 1.585000},
-{{0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 199.479750, 0.000030, 0.037000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 240.993470, 0.000030, 0.341000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 247.994730, 0.000030, 0.083000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 61.407670, 0.000070, 0.069000},
-{{0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 244.477780, 0.000130, 0.036000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 120.867890, 0.000050, 0.250000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 120.867890, 0.000050, 0.033000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 287.545570, 0.000070, 0.065000},
-{{0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 84.757480, 0.000110, 0.035000},
-{{0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 161.191720, 0.000020, 0.115000},
-{{0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 341.191720, 0.000020, 0.056000},
-{{0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 341.351960, 0.000140, 0.034000},
-{{0.000000, 0.000000, 5.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 82.102800, 0.000030, 0.037000},
-{{0.000000, 0.000000, 5.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 262.102800, 0.000030, 1.494000},
-{{0.000000, 0.000000, 5.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 286.442350, 0.000020, 0.075000},
-{{0.000000, 0.000000, 5.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 286.442350, 0.000020, 0.076000},
-{{0.000000, 0.000000, 5.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 320.067520, 0.000030, 0.068000},
-{{0.000000, 0.000000, 5.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 140.067520, 0.000030, 0.084000},
-{{0.000000, 0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 11.362500, 0.000020, 0.039000},
-{{0.000000, 0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 11.362500, 0.000020, 1.081000},
-{{0.000000, 0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 214.317830, 0.000020, 0.074000},
-{{0.000000, 0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 34.317830, 0.000020, 0.077000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 56.153460, 0.000050, 0.089000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 235.039120, 0.000070, 0.077000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 55.039120, 0.000070, 0.074000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 239.121930, 0.000030, 0.085000},
-{{0.000000, 0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 239.470070, 0.000060, 0.040000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 90.684810, 0.000050, 0.042000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 1.000000}, 191.587430, 0.000020, 0.076000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 141.866790, 0.000040, 0.075000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 349.658450, 0.000220, 0.042000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 349.658450, 0.000080, 0.095000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 350.728770, 0.000020, 0.082000},
-{{0.000000, 0.000000, 5.000000, -8.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 170.728770, 0.000020, 0.070000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 121.526450, 0.000030, 0.043000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 305.454510, 0.000060, 0.098000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 301.526450, 0.000030, 0.328000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 298.013400, 0.000060, 0.782000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 117.287910, 0.000020, 0.036000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 120.983170, 0.000030, 2.017000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 139.451470, 0.000040, 0.078000},
-{{0.000000, 0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.290540, 0.000200, 0.038000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 146.375210, 0.000060, 0.044000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 157.556290, 0.000060, 0.087000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 164.142490, 0.000020, 0.553000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 293.138170, 0.000030, 0.076000},
-{{0.000000, 0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 157.557600, 0.000350, 0.075000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 182.101410, 0.000040, 0.045000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 2.101410, 0.000040, 0.243000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 20.499540, 0.000030, 0.041000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 193.387550, 0.000050, 0.427000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 2.981490, 0.000020, 0.035000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 3.011570, 0.000020, 0.079000},
-{{0.000000, 0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 183.011570, 0.000020, 0.072000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 32.306070, 0.000050, 0.116000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 212.624440, 0.000070, 0.348000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 45.147260, 0.000020, 0.082000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 32.343030, 0.000110, 0.070000},
-{{0.000000, 0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 204.708810, 0.000080, 0.036000},
-{{0.000000, 0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 70.065320, 0.000100, 0.067000},
-{{0.000000, 0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 87.286920, 0.000020, 0.048000},
-{{0.000000, 0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 267.286920, 0.000020, 0.175000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 160.944840, 0.000040, 0.200000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 160.956660, 0.000030, 0.100000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 25.378230, 0.000170, 0.061000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 14.947550, 0.000450, 0.034000},
-{{0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 18.015100, 0.000040, 0.018000},
-{{0.000000, 0.000000, 6.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 233.054940, 0.000060, 0.071000},
-{{0.000000, 0.000000, 6.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 82.038470, 0.000030, 0.037000},
-{{0.000000, 0.000000, 6.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 262.038470, 0.000030, 4.969000},
-{{0.000000, 0.000000, 6.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 310.758920, 0.000030, 0.077000},
-{{0.000000, 0.000000, 6.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 130.758920, 0.000030, 0.074000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 319.903970, 0.000030, 0.075000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 319.906720, 0.000040, 0.071000},
-{{0.000000, 0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 139.906720, 0.000040, 0.081000},
-{{0.000000, 0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 171.400000, 0.000020, 0.073000},
-{{0.000000, 0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 351.400000, 0.000020, 0.078000},
-{{0.000000, 0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 30.571020, 0.000060, 0.041000},
-{{0.000000, 0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 208.268810, 0.000020, 0.076000},
-{{0.000000, 0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 28.268810, 0.000020, 0.075000},
-{{0.000000, 0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 210.086660, 0.000040, 0.040000},
-{{0.000000, 0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 59.010060, 0.000030, 0.042000},
-{{0.000000, 0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 85.189260, 0.000020, 0.080000},
-{{0.000000, 0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 265.189260, 0.000020, 0.072000},
-{{0.000000, 0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 240.272240, 0.000030, 0.082000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 267.630990, 0.000030, 0.043000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 87.630990, 0.000030, 0.335000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 95.181660, 0.000030, 0.072000},
-{{0.000000, 0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 95.181660, 0.000030, 0.079000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 120.889660, 0.000060, 0.043000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 304.011350, 0.000030, 0.284000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 320.902390, 0.000060, 0.087000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 297.541390, 0.000020, 0.573000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 295.990060, 0.000030, 0.067000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 297.541390, 0.000020, 0.035000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 333.241070, 0.000020, 0.075000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 120.031570, 0.000040, 36.376000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 313.695520, 0.000510, 0.076000},
-{{0.000000, 0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 305.358360, 0.000080, 0.038000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 152.667330, 0.000050, 0.045000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 334.492370, 0.000050, 0.109000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 157.633350, 0.000040, 0.439000},
-{{0.000000, 0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 326.977720, 0.000030, 0.037000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 183.959350, 0.000020, 0.046000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 3.423030, 0.000060, 0.115000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 3.959350, 0.000020, 0.218000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 81.402450, 0.000020, 0.042000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 196.348270, 0.000090, 0.356000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 168.666810, 0.000030, 0.082000},
-{{0.000000, 0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 168.666810, 0.000030, 0.070000},
-{{0.000000, 0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 23.377050, 0.000060, 0.067000},
-{{0.000000, 0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 212.415540, 0.000100, 0.036000},
-{{0.000000, 0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 72.196930, 0.000090, 0.065000},
-{{0.000000, 0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 281.222340, 0.000040, 0.094000},
-{{0.000000, 0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 101.222340, 0.000040, 0.063000},
-{{0.000000, 0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 311.388220, 0.000020, 0.099000},
-{{0.000000, 0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 311.324500, 0.000020, 0.316000},
-{{0.000000, 0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 131.388220, 0.000020, 0.061000},
-{{0.000000, 0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 132.437200, 0.000070, 0.034000},
-{{0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 316.152280, 0.000040, 0.167000},
-{{0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 215.053650, 0.000030, 0.057000},
-{{0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 108.960650, 0.000190, 0.033000},
-{{0.000000, 0.000000, 7.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.965220, 0.000070, 0.038000},
-{{0.000000, 0.000000, 7.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 263.371280, 0.000030, 0.077000},
-{{0.000000, 0.000000, 7.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 263.371280, 0.000030, 0.074000},
-{{0.000000, 0.000000, 7.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 111.349140, 0.000040, 0.080000},
-{{0.000000, 0.000000, 7.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 290.910860, 0.000020, 0.070000},
-{{0.000000, 0.000000, 7.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 110.910860, 0.000020, 0.081000},
-{{0.000000, 0.000000, 7.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 140.223390, 0.000030, 0.084000},
-{{0.000000, 0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 3.308800, 0.000060, 0.041000},
-{{0.000000, 0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 153.201840, 0.000030, 0.088000},
-{{0.000000, 0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 181.148370, 0.000060, 0.040000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 250.855440, 0.000040, 0.042000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 59.217390, 0.000020, 0.083000},
-{{0.000000, 0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 239.217390, 0.000020, 0.069000},
-{{0.000000, 0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 88.438470, 0.000020, 0.086000},
-{{0.000000, 0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 268.438470, 0.000020, 0.067000},
-{{0.000000, 0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 248.983110, 0.000120, 0.076000},
-{{0.000000, 0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 123.575740, 0.000100, 0.044000},
-{{0.000000, 0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.047400, 0.000070, 0.037000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 158.729990, 0.000060, 0.045000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 334.390840, 0.000020, 0.114000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 334.390840, 0.000020, 0.056000},
-{{0.000000, 0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 156.862180, 0.000040, 0.364000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 182.522920, 0.000060, 0.047000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 358.325390, 0.000030, 0.665000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 356.356430, 0.000080, 0.068000},
-{{0.000000, 0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 178.325390, 0.000030, 0.036000},
-{{0.000000, 0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 212.986860, 0.000060, 0.262000},
-{{0.000000, 0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 36.871280, 0.000020, 0.491000},
-{{0.000000, 0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 210.348140, 0.000030, 0.065000},
-{{0.000000, 0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 216.066970, 0.000140, 0.035000},
-{{0.000000, 0.000000, 7.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 72.434560, 0.000100, 0.063000},
-{{0.000000, 0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 101.228210, 0.000050, 0.061000},
-{{0.000000, 0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 101.421380, 0.000040, 0.034000},
-{{0.000000, 0.000000, 7.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 131.256720, 0.000040, 0.059000},
-{{0.000000, 0.000000, 7.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 131.528540, 0.000070, 0.033000},
-{{0.000000, 0.000000, 8.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.879300, 0.000060, 0.039000},
-{{0.000000, 0.000000, 8.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 290.535280, 0.000020, 0.073000},
-{{0.000000, 0.000000, 8.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 110.535280, 0.000020, 0.078000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 334.145060, 0.000160, 0.040000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 344.807890, 0.000090, 0.087000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 325.676520, 0.000250, 0.076000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 146.441420, 0.000290, 0.075000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 154.182380, 0.000150, 0.087000},
-{{0.000000, 0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 152.157630, 0.000180, 0.040000},
-{{0.000000, 0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 168.008980, 0.000020, 0.092000},
-{{0.000000, 0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 168.008980, 0.000020, 0.064000},
-{{0.000000, 0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 163.303890, 0.000030, 0.079000},
-{{0.000000, 0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 343.303890, 0.000030, 0.072000},
-{{0.000000, 0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 200.372410, 0.000090, 0.042000},
-{{0.000000, 0.000000, 8.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 246.103730, 0.000050, 0.043000},
-{{0.000000, 0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 95.506060, 0.000040, 0.078000},
-{{0.000000, 0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 275.506060, 0.000040, 0.073000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 126.725490, 0.000090, 0.045000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 297.335250, 0.000030, 0.373000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 297.643690, 0.000040, 1.100000},
-{{0.000000, 0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.643690, 0.000040, 0.036000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 147.584840, 0.000070, 0.046000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 153.879760, 0.000050, 0.311000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 144.166420, 0.000020, 0.085000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 144.166420, 0.000020, 0.068000},
-{{0.000000, 0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 323.512050, 0.000040, 0.036000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 2.776590, 0.000030, 0.044000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 182.776590, 0.000030, 0.267000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 335.808970, 0.000020, 0.089000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 167.578570, 0.000020, 0.507000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 335.808970, 0.000020, 0.066000},
-{{0.000000, 0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 167.578570, 0.000020, 0.035000},
-{{0.000000, 0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 211.422010, 0.000030, 0.049000},
-{{0.000000, 0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 211.479950, 0.000050, 0.234000},
-{{0.000000, 0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 217.237900, 0.000110, 0.034000},
-{{0.000000, 0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 73.467790, 0.000030, 0.098000},
-{{0.000000, 0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 71.914240, 0.000060, 0.329000},
-{{0.000000, 0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 73.467790, 0.000030, 0.061000},
-{{0.000000, 0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 250.894330, 0.000030, 0.034000},
-{{0.000000, 0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 115.089050, 0.000020, 0.280000},
-{{0.000000, 0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 115.089050, 0.000020, 0.033000},
-{{0.000000, 0.000000, 8.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 130.837450, 0.000060, 0.033000},
-{{0.000000, 0.000000, 9.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 52.849270, 0.000060, 0.079000},
-{{0.000000, 0.000000, 9.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.777770, 0.000060, 0.040000},
-{{0.000000, 0.000000, 9.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 81.777770, 0.000050, 0.083000},
-{{0.000000, 0.000000, 9.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 261.777760, 0.000020, 0.072000},
-{{0.000000, 0.000000, 9.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 81.777760, 0.000020, 0.079000},
-{{0.000000, 0.000000, 9.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 303.331630, 0.000050, 0.040000},
-{{0.000000, 0.000000, 9.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 252.123830, 0.000020, 0.075000},
-{{0.000000, 0.000000, 9.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 72.123830, 0.000020, 0.076000},
-{{0.000000, 0.000000, 9.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 123.600020, 0.000030, 0.087000},
-{{0.000000, 0.000000, 9.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 123.600020, 0.000060, 0.040000},
-{{0.000000, 0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 139.893090, 0.000030, 0.041000},
-{{0.000000, 0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 139.324340, 0.000020, 0.091000},
-{{0.000000, 0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 139.324340, 0.000020, 0.064000},
-{{0.000000, 0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 139.367470, 0.000040, 0.078000},
-{{0.000000, 0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 319.367470, 0.000040, 0.073000},
-{{0.000000, 0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 199.885450, 0.000080, 0.042000},
-{{0.000000, 0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 1.134000, 0.000040, 0.080000},
-{{0.000000, 0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 210.162550, 0.000030, 4.596000},
-{{0.000000, 0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.162550, 0.000030, 0.038000},
-{{0.000000, 0.000000, 9.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 257.860880, 0.000050, 0.044000},
-{{0.000000, 0.000000, 9.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 245.900780, 0.000030, 0.077000},
-{{0.000000, 0.000000, 9.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 245.900780, 0.000030, 0.074000},
-{{0.000000, 0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 88.506310, 0.000040, 0.081000},
-{{0.000000, 0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 88.731300, 0.000020, 1.182000},
-{{0.000000, 0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 88.506310, 0.000040, 0.071000},
-{{0.000000, 0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 268.731300, 0.000020, 0.037000},
-{{0.000000, 0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 125.591730, 0.000060, 0.046000},
-{{0.000000, 0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 152.183830, 0.000110, 0.047000},
-{{0.000000, 0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 153.746130, 0.000040, 0.272000},
-{{0.000000, 0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 145.617770, 0.000030, 0.088000},
-{{0.000000, 0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 325.617770, 0.000030, 0.066000},
-{{0.000000, 0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 194.387180, 0.000050, 0.237000},
-{{0.000000, 0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 223.161010, 0.000100, 0.034000},
-{{0.000000, 0.000000, 9.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 71.719530, 0.000040, 0.285000},
-{{0.000000, 0.000000, 9.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 251.719530, 0.000040, 0.033000},
-{{0.000000, 0.000000, 9.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 102.544350, 0.000060, 0.058000},
-{{0.000000, 0.000000, 10.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.658160, 0.000060, 0.040000},
-{{0.000000, 0.000000, 10.000000, -19.000000, 0.000000, 3.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 252.297790, 0.000100, 0.040000},
-{{0.000000, 0.000000, 10.000000, -19.000000, 0.000000, 3.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 252.297790, 0.000060, 0.087000},
-{{0.000000, 0.000000, 10.000000, -19.000000, 0.000000, 3.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 72.297790, 0.000060, 0.087000},
-{{0.000000, 0.000000, 10.000000, -19.000000, 0.000000, 3.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 72.297790, 0.000100, 0.040000},
-{{0.000000, 0.000000, 10.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 110.458140, 0.000070, 0.041000},
-{{0.000000, 0.000000, 10.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 290.435320, 0.000030, 0.090000},
-{{0.000000, 0.000000, 10.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 110.429740, 0.000040, 0.078000},
-{{0.000000, 0.000000, 10.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 290.429740, 0.000040, 0.073000},
-{{0.000000, 0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 139.779730, 0.000030, 0.042000},
-{{0.000000, 0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 319.779730, 0.000030, 0.366000},
-{{0.000000, 0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 167.041850, 0.000060, 0.043000},
-{{0.000000, 0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 211.202990, 0.000020, 0.077000},
-{{0.000000, 0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 210.124080, 0.000030, 3.989000},
-{{0.000000, 0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 29.390530, 0.000060, 0.074000},
-{{0.000000, 0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.124080, 0.000030, 0.037000},
-{{0.000000, 0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 245.966190, 0.000020, 0.045000},
-{{0.000000, 0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 245.966190, 0.000020, 0.231000},
-{{0.000000, 0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 239.711250, 0.000020, 0.080000},
-{{0.000000, 0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 59.711250, 0.000020, 0.071000},
-{{0.000000, 0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 125.321870, 0.000030, 0.047000},
-{{0.000000, 0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 125.321870, 0.000030, 0.185000},
-{{0.000000, 0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 117.454700, 0.000030, 0.066000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 153.167810, 0.000040, 0.049000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 146.387240, 0.000040, 0.241000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 324.922400, 0.000030, 0.092000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 325.128350, 0.000030, 0.421000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 324.922400, 0.000030, 0.064000},
-{{0.000000, 0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 145.128350, 0.000030, 0.035000},
-{{0.000000, 0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 182.250340, 0.000050, 0.214000},
-{{0.000000, 0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 223.172630, 0.000100, 0.033000},
-{{0.000000, 0.000000, 10.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 251.745390, 0.000070, 0.033000},
-{{0.000000, 0.000000, 10.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 99.918060, 0.000030, 0.222000},
-{{0.000000, 0.000000, 10.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 279.918060, 0.000030, 0.032000},
-{{0.000000, 0.000000, 10.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 131.321700, 0.000030, 0.055000},
-{{0.000000, 0.000000, 11.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 232.612710, 0.000030, 0.040000},
-{{0.000000, 0.000000, 11.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 232.417520, 0.000020, 0.075000},
-{{0.000000, 0.000000, 11.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 52.417520, 0.000020, 0.076000},
-{{0.000000, 0.000000, 11.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.518390, 0.000050, 0.041000},
-{{0.000000, 0.000000, 11.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 81.518380, 0.000030, 0.078000},
-{{0.000000, 0.000000, 11.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 261.518380, 0.000030, 0.073000},
-{{0.000000, 0.000000, 11.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 110.251770, 0.000060, 0.042000},
-{{0.000000, 0.000000, 11.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 138.716840, 0.000070, 0.043000},
-{{0.000000, 0.000000, 11.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 152.051050, 0.000030, 0.074000},
-{{0.000000, 0.000000, 11.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 332.051050, 0.000030, 0.077000},
-{{0.000000, 0.000000, 11.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 166.495220, 0.000020, 0.044000},
-{{0.000000, 0.000000, 11.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 166.495220, 0.000020, 0.268000},
-{{0.000000, 0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.074350, 0.000050, 0.037000},
-{{0.000000, 0.000000, 11.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 247.146020, 0.000030, 0.046000},
-{{0.000000, 0.000000, 11.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 67.146020, 0.000030, 0.208000},
-{{0.000000, 0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 87.970540, 0.000030, 0.087000},
-{{0.000000, 0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 267.970540, 0.000030, 0.066000},
-{{0.000000, 0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 121.409760, 0.000040, 0.048000},
-{{0.000000, 0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 296.606460, 0.000040, 0.064000},
-{{0.000000, 0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 144.523830, 0.000020, 0.351000},
-{{0.000000, 0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 144.523830, 0.000020, 0.034000},
-{{0.000000, 0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 229.562260, 0.000080, 0.033000},
-{{0.000000, 0.000000, 11.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 258.926720, 0.000060, 0.032000},
-{{0.000000, 0.000000, 11.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 281.787850, 0.000050, 0.032000},
-{{0.000000, 0.000000, 12.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 116.869900, 0.000050, 0.075000},
-{{0.000000, 0.000000, 12.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 232.503040, 0.000030, 0.041000},
-{{0.000000, 0.000000, 12.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 81.356540, 0.000020, 0.042000},
-{{0.000000, 0.000000, 12.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 81.356540, 0.000020, 0.383000},
-{{0.000000, 0.000000, 12.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 110.013500, 0.000060, 0.043000},
-{{0.000000, 0.000000, 12.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 138.338880, 0.000050, 0.044000},
-{{0.000000, 0.000000, 12.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 1.011290, 0.000030, 0.079000},
-{{0.000000, 0.000000, 12.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 181.011290, 0.000030, 0.072000},
-{{0.000000, 0.000000, 12.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 210.009370, 0.000050, 0.069000},
-{{0.000000, 0.000000, 12.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 30.009370, 0.000040, 0.036000},
-{{0.000000, 0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 247.065760, 0.000030, 0.047000},
-{{0.000000, 0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 67.065760, 0.000030, 0.190000},
-{{0.000000, 0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 238.960650, 0.000030, 0.582000},
-{{0.000000, 0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 238.960650, 0.000050, 0.067000},
-{{0.000000, 0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 58.960650, 0.000030, 0.035000},
-{{0.000000, 0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 93.242940, 0.000060, 0.048000},
-{{0.000000, 0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 267.780520, 0.000030, 0.444000},
-{{0.000000, 0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 267.780520, 0.000040, 0.064000},
-{{0.000000, 0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 87.780520, 0.000030, 0.035000},
-{{0.000000, 0.000000, 12.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 123.877630, 0.000030, 0.050000},
-{{0.000000, 0.000000, 12.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 116.021890, 0.000040, 0.034000},
-{{0.000000, 0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 224.290110, 0.000020, 0.228000},
-{{0.000000, 0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 224.179990, 0.000050, 0.032000},
-{{0.000000, 0.000000, 12.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 252.780220, 0.000040, 0.032000},
-{{0.000000, 0.000000, 12.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 281.613290, 0.000040, 0.031000},
-{{0.000000, 0.000000, 13.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 109.740600, 0.000020, 0.044000},
-{{0.000000, 0.000000, 13.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 109.740600, 0.000020, 0.277000},
-{{0.000000, 0.000000, 13.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 299.685010, 0.000030, 0.076000},
-{{0.000000, 0.000000, 13.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 119.685010, 0.000030, 0.075000},
-{{0.000000, 0.000000, 13.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 29.926140, 0.000040, 0.036000},
-{{0.000000, 0.000000, 13.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 246.964870, 0.000050, 0.048000},
-{{0.000000, 0.000000, 13.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 58.824880, 0.000050, 0.035000},
-{{0.000000, 0.000000, 13.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 94.957710, 0.000040, 0.049000},
-{{0.000000, 0.000000, 13.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 87.548930, 0.000050, 0.034000},
-{{0.000000, 0.000000, 13.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 123.616450, 0.000020, 0.051000},
-{{0.000000, 0.000000, 13.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 303.616450, 0.000020, 0.147000},
-{{0.000000, 0.000000, 13.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 115.820570, 0.000040, 0.034000},
-{{0.000000, 0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 224.057430, 0.000030, 0.032000},
-{{0.000000, 0.000000, 14.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 46.539890, 0.000040, 0.075000},
-{{0.000000, 0.000000, 14.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 317.382860, 0.000030, 0.046000},
-{{0.000000, 0.000000, 14.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 246.854410, 0.000050, 0.049000},
-{{0.000000, 0.000000, 14.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 58.659250, 0.000040, 0.034000},
-{{0.000000, 0.000000, 14.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 87.272020, 0.000040, 0.034000},
-{{0.000000, 0.000000, 14.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 123.349960, 0.000020, 0.052000},
-{{0.000000, 0.000000, 14.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 123.349960, 0.000020, 0.138000},
-{{0.000000, 0.000000, 14.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 73.092620, 0.000030, 0.171000},
-{{0.000000, 0.000000, 14.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 253.092620, 0.000030, 0.031000},
-{{0.000000, 0.000000, 15.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 29.737390, 0.000030, 0.034000},
-{{0.000000, 0.000000, 15.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 246.719980, 0.000050, 0.050000},
-{{0.000000, 0.000000, 15.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 238.485070, 0.000020, 0.320000},
-{{0.000000, 0.000000, 15.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 58.485070, 0.000020, 0.034000},
-{{0.000000, 0.000000, 15.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 252.843320, 0.000040, 0.030000},
-{{0.000000, 0.000000, 15.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 101.640010, 0.000020, 0.146000},
-{{0.000000, 0.000000, 15.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 281.640010, 0.000020, 0.030000},
-{{0.000000, 0.000000, 16.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 246.564470, 0.000020, 0.052000},
-{{0.000000, 0.000000, 16.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 246.564470, 0.000020, 0.140000},
-{{0.000000, 0.000000, 16.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 58.249440, 0.000030, 0.033000},
-{{0.000000, 0.000000, 17.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 274.987760, 0.000030, 0.054000},
-{{0.000000, 0.000000, 17.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 94.987760, 0.000030, 0.123000},
-{{0.000000, 0.000000, 18.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 274.700380, 0.000050, 0.056000},
-{{0.000000, 0.000000, 18.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 302.831220, 0.000030, 0.058000},
-{{0.000000, 0.000000, 18.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 122.831220, 0.000030, 0.109000},
-{{0.000000, 0.000000, 19.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 302.337670, 0.000020, 0.059000},
-{{0.000000, 0.000000, 19.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 302.337670, 0.000020, 0.104000},
-{{0.000000, 0.000000, 37.000000, -48.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 222.295500, 0.000020, 0.075000},
-{{0.000000, 0.000000, 37.000000, -48.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 42.295500, 0.000020, 0.075000},
-{{0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.069900, 0.000200, 0.033000},
-{{0.000000, 1.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 252.048540, 0.000050, 0.186000},
-{{0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 160.472710, 0.000060, 0.019000},
-{{0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 160.210610, 0.000190, 0.063000},
-{{0.000000, 1.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 8.359580, 0.000040, 0.385000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 106.098450, 0.000050, 0.036000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 295.973350, 0.000050, 0.067000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 69.421810, 0.000020, 0.033000},
-{{0.000000, 1.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 69.421810, 0.000020, 0.296000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 302.738180, 0.000210, 0.037000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 141.855380, 0.000060, 0.072000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 257.942210, 0.000020, 0.035000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 244.419350, 0.000020, 0.064000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 257.942210, 0.000020, 0.421000},
-{{0.000000, 1.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 64.419350, 0.000020, 0.092000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 61.657730, 0.000070, 0.078000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 28.162970, 0.000030, 0.074000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 208.162970, 0.000030, 0.077000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 331.217950, 0.000040, 0.068000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 151.217950, 0.000040, 0.084000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 159.640380, 0.000030, 0.061000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 159.640380, 0.000030, 0.099000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 17.442400, 0.000080, 0.043000},
-{{0.000000, 1.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 18.218080, 0.000030, 0.020000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 115.707130, 0.000440, 0.040000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 75.689380, 0.000040, 0.084000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 270.386290, 0.000020, 0.080000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 67.776810, 0.000030, 1.472000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 115.957760, 0.000040, 0.077000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 90.386290, 0.000020, 0.072000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 1.000000}, 273.984630, 0.000020, 0.037000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 2.000000}, 289.488080, 0.000020, 0.075000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 42.948390, 0.000020, 0.073000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000}, 101.555140, 0.000060, 0.076000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 179.296120, 0.000030, 2.670000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 222.948390, 0.000020, 0.078000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 1.000000}, 167.484860, 0.000020, 0.913000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 293.704080, 0.000030, 0.068000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 311.860210, 0.000060, 0.082000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 270.581180, 0.000080, 0.700000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 347.484860, 0.000020, 0.039000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 113.704080, 0.000030, 0.085000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -1.000000}, 90.115530, 0.000030, 0.040000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 295.603180, 0.000040, 0.090000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 281.294470, 0.000030, 0.041000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000}, 288.116140, 0.000020, 0.044000},
-{{0.000000, 1.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 108.116140, 0.000020, 0.020000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 171.535840, 0.000190, 0.041000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 0.248260, 0.000090, 0.092000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 191.615130, 0.000050, 0.079000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 18.308330, 0.000090, 1.599000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 11.615130, 0.000050, 0.072000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 207.309130, 0.000060, 0.083000},
-{{0.000000, 1.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 218.784240, 0.000040, 0.039000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 249.600290, 0.000050, 0.021000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 108.644020, 0.000030, 0.043000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 73.200480, 0.000260, 0.101000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 178.228540, 0.000030, 0.294000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 281.602930, 0.000030, 0.060000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 89.885290, 0.000020, 0.095000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 190.668090, 0.000050, 0.041000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 269.885290, 0.000020, 0.373000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 269.885290, 0.000020, 0.063000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 1.000000}, 269.885290, 0.000020, 0.034000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 195.586660, 0.000040, 0.086000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 22.003170, 0.000030, 0.615000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 15.586660, 0.000040, 0.067000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 90.106290, 0.000130, 0.076000},
-{{0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 239.686880, 0.000270, 0.038000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 161.871000, 0.000020, 0.021000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 162.589520, 0.000080, 0.045000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 8.996840, 0.000040, 0.113000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 189.742820, 0.000090, 0.381000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 352.274630, 0.000020, 0.081000},
-{{0.000000, 1.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 352.274630, 0.000020, 0.071000},
-{{0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 181.313380, 0.000060, 0.066000},
-{{0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 266.090320, 0.000180, 0.035000},
-{{0.000000, 1.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 275.524920, 0.000030, 0.018000},
-{{0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 110.341090, 0.000050, 0.216000},
-{{0.000000, 1.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 302.382700, 0.000200, 0.034000},
-{{0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 13.544020, 0.000020, 0.033000},
-{{0.000000, 1.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 193.544020, 0.000020, 0.018000},
-{{0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 317.249130, 0.000040, 0.055000},
-{{0.000000, 1.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 326.776350, 0.000100, 0.032000},
-{{0.000000, 1.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 216.184340, 0.000030, 0.171000},
-{{0.000000, 1.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 36.184340, 0.000030, 0.031000},
-{{0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.119800, 0.000210, 0.034000},
-{{0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 71.511050, 0.000030, 0.032000},
-{{0.000000, 2.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.511050, 0.000030, 0.211000},
-{{0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 160.429180, 0.000050, 0.019000},
-{{0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 160.209320, 0.000180, 0.066000},
-{{0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 346.447440, 0.000020, 0.059000},
-{{0.000000, 2.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 166.447440, 0.000020, 0.105000},
-{{0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 137.905970, 0.000030, 0.036000},
-{{0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 319.721410, 0.000020, 0.070000},
-{{0.000000, 2.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 139.721410, 0.000020, 0.081000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 303.175330, 0.000190, 0.038000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 254.254670, 0.000030, 0.076000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 191.328180, 0.000020, 0.075000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 238.897880, 0.000040, 0.572000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 79.933040, 0.000020, 0.284000},
-{{0.000000, 2.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 259.933040, 0.000020, 0.044000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 19.634880, 0.000040, 0.039000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 355.395850, 0.000070, 0.082000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 210.036000, 0.000020, 0.077000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 147.075770, 0.000020, 0.075000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 30.036000, 0.000020, 0.074000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 3.000000, -1.000000}, 327.075770, 0.000020, 0.076000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 69.709470, 0.000030, 0.071000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 249.709470, 0.000030, 0.080000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 324.347840, 0.000030, 0.063000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 144.347840, 0.000030, 0.093000},
-{{0.000000, 2.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 36.947400, 0.000140, 0.042000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 115.648690, 0.000070, 0.026000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 21.439230, 0.000300, 0.041000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 102.761930, 0.000340, 0.089000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 229.808340, 0.000020, 0.494000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 84.844270, 0.000020, 0.038000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 108.272030, 0.000510, 0.077000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 214.015640, 0.000060, 3.983000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 288.362690, 0.000470, 0.074000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 287.731170, 0.000020, 0.037000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, -1.000000}, 261.602830, 0.000020, 0.037000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 1.000000}, 253.719540, 0.000020, 2.131000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 72.692590, 0.000040, 0.071000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 267.457580, 0.000070, 1.246000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 15.057760, 0.000040, 0.038000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 252.692590, 0.000040, 0.080000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 132.239620, 0.000020, 0.068000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 231.331430, 0.000020, 0.657000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 287.191420, 0.000460, 0.085000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 287.341070, 0.000190, 0.040000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 107.019680, 0.000020, 0.019000},
-{{0.000000, 2.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 108.172970, 0.000050, 0.020000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 343.296250, 0.000030, 0.020000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 143.889840, 0.000100, 0.043000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 196.294910, 0.000030, 0.040000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 47.682620, 0.000020, 0.799000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 79.605300, 0.000030, 1.912000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 223.435830, 0.000090, 0.079000},
-{{0.000000, 2.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 259.605300, 0.000030, 0.038000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 72.099210, 0.000050, 0.021000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 234.935270, 0.000220, 0.044000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 250.513290, 0.000350, 0.108000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 269.885120, 0.000060, 0.303000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000}, 269.885110, 0.000050, 0.097000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 129.927180, 0.000060, 0.091000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 3.342130, 0.000060, 0.444000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 349.399920, 0.000050, 0.064000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 1.000000}, 155.223810, 0.000020, 0.653000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 155.223810, 0.000020, 0.036000},
-{{0.000000, 2.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 229.174310, 0.000210, 0.037000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 162.743790, 0.000050, 0.047000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 161.802000, 0.000030, 0.100000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 32.243490, 0.000040, 0.308000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 341.802000, 0.000030, 0.061000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 355.755070, 0.000030, 0.085000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 99.273090, 0.000060, 0.068000},
-{{0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 262.221090, 0.000070, 0.036000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 98.415560, 0.000040, 0.111000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 305.289450, 0.000040, 0.235000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 278.415560, 0.000040, 0.057000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 164.267740, 0.000020, 0.093000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 164.267740, 0.000020, 0.064000},
-{{0.000000, 2.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 203.471640, 0.000260, 0.034000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 110.291900, 0.000050, 0.190000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 151.497540, 0.000020, 0.102000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 225.029140, 0.000020, 0.288000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 151.497540, 0.000020, 0.060000},
-{{0.000000, 2.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 297.129990, 0.000180, 0.033000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 19.790040, 0.000030, 0.160000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 19.695750, 0.000230, 0.056000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 13.543840, 0.000020, 0.032000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 199.384140, 0.000050, 0.023000},
-{{0.000000, 2.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 193.543840, 0.000020, 0.017000},
-{{0.000000, 2.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 323.620100, 0.000030, 0.183000},
-{{0.000000, 2.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 143.620100, 0.000030, 0.031000},
-{{0.000000, 2.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 215.144790, 0.000020, 0.154000},
-{{0.000000, 2.000000, 5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 35.144790, 0.000020, 0.030000},
-{{0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.179060, 0.000210, 0.035000},
-{{0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 57.300830, 0.000030, 0.064000},
-{{0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 237.300830, 0.000030, 0.092000},
-{{0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 71.526310, 0.000030, 0.033000},
-{{0.000000, 3.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.526310, 0.000030, 0.243000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 160.388720, 0.000030, 0.019000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 2.000000, 0.000000}, 160.388720, 0.000030, 0.038000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 161.763660, 0.000150, 0.036000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 160.206560, 0.000180, 0.068000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 346.441110, 0.000020, 0.061000},
-{{0.000000, 3.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 166.441110, 0.000020, 0.099000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 2.000000}, 227.637460, 0.000040, 0.075000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 137.607580, 0.000030, 0.037000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 2.000000}, 47.637460, 0.000040, 0.076000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 60.170140, 0.000020, 0.065000},
-{{0.000000, 3.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 240.170140, 0.000020, 0.090000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 319.076130, 0.000180, 0.039000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 278.622690, 0.000040, 0.079000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 335.610280, 0.000020, 1.537000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000}, 122.000660, 0.000030, 0.075000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000}, 302.000660, 0.000030, 0.076000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 57.278480, 0.000020, 0.036000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 237.278480, 0.000020, 0.890000},
-{{0.000000, 3.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 238.467940, 0.000050, 0.042000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 301.039260, 0.000170, 0.040000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 289.434330, 0.000110, 0.086000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 305.135740, 0.000180, 0.075000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 305.811560, 0.000030, 8.102000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 125.135740, 0.000180, 0.076000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 63.854400, 0.000020, 0.527000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 98.659620, 0.000120, 0.088000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 90.354270, 0.000130, 0.041000},
-{{0.000000, 3.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 42.797540, 0.000030, 0.020000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 118.115210, 0.000020, 0.027000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 108.977030, 0.000390, 0.042000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 92.455170, 0.000180, 0.094000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 280.895670, 0.000060, 0.087000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 101.640240, 0.000300, 0.081000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 203.436120, 0.000050, 1.141000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 282.587810, 0.000260, 0.071000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 115.617550, 0.000030, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 45.938210, 0.000040, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 270.114050, 0.000040, 5.644000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 281.166730, 0.000350, 0.075000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 31.902290, 0.000050, 0.037000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 291.467270, 0.000190, 0.081000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 290.134980, 0.000020, 0.039000},
-{{0.000000, 3.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 108.221050, 0.000040, 0.020000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 350.039350, 0.000150, 0.044000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 192.932140, 0.000040, 0.041000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 154.386320, 0.000150, 0.075000},
-{{0.000000, 3.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 256.419680, 0.000050, 0.038000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 243.122090, 0.000530, 0.046000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 251.595720, 0.000450, 0.116000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 106.716800, 0.000070, 0.044000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 56.609870, 0.000040, 0.096000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 335.872610, 0.000060, 0.348000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 236.609870, 0.000040, 0.062000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 1.000000}, 234.112320, 0.000020, 0.090000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 54.110390, 0.000020, 0.087000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 54.112320, 0.000020, 0.065000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 204.990350, 0.000040, 0.549000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 234.110390, 0.000020, 0.066000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 308.414200, 0.000040, 0.907000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 243.657920, 0.000400, 0.036000},
-{{0.000000, 3.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000}, 335.371570, 0.000040, 0.075000},
-{{0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 83.720730, 0.000060, 0.048000},
-{{0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 81.507230, 0.000050, 0.065000},
-{{0.000000, 3.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 291.040370, 0.000060, 0.035000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 289.708020, 0.000030, 0.205000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 76.760140, 0.000060, 0.061000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 236.194700, 0.000450, 0.034000},
-{{0.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 108.895490, 0.000020, 0.018000},
-{{0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 110.264930, 0.000060, 0.170000},
-{{0.000000, 3.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 290.649140, 0.000200, 0.033000},
-{{0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 193.544230, 0.000050, 0.145000},
-{{0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 16.426460, 0.000220, 0.032000},
-{{0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 13.544260, 0.000020, 0.017000},
-{{0.000000, 3.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 18.820590, 0.000050, 0.018000},
-{{0.000000, 3.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 282.712200, 0.000040, 0.031000},
-{{0.000000, 3.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 36.108070, 0.000040, 0.030000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.241330, 0.000210, 0.035000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 77.606810, 0.000020, 0.067000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 257.606810, 0.000020, 0.087000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 71.547580, 0.000030, 0.033000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 251.547580, 0.000030, 0.060000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.547580, 0.000030, 0.286000},
-{{0.000000, 4.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 71.547580, 0.000030, 0.102000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 160.350890, 0.000020, 0.019000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 2.000000, 0.000000}, 160.350890, 0.000020, 0.039000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 161.491810, 0.000140, 0.037000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 145.471220, 0.000020, 0.034000},
-{{0.000000, 4.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 325.471220, 0.000020, 0.400000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 57.822120, 0.000030, 0.077000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 57.460610, 0.000030, 0.068000},
-{{0.000000, 4.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 237.460610, 0.000030, 0.085000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 307.185810, 0.000400, 0.040000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 182.392340, 0.000060, 0.083000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 314.593840, 0.000040, 0.073000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 134.593840, 0.000040, 0.078000},
-{{0.000000, 4.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 106.011950, 0.000040, 0.091000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 324.321590, 0.000070, 0.041000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 274.686240, 0.000020, 0.091000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 165.555030, 0.000030, 0.439000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 94.686240, 0.000020, 0.064000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 344.567560, 0.000080, 0.078000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 321.438400, 0.000040, 1.992000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 164.567560, 0.000080, 0.073000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 126.649220, 0.000040, 0.077000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 197.149150, 0.000200, 0.040000},
-{{0.000000, 4.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 18.491900, 0.000030, 0.019000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 288.840540, 0.000220, 0.043000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 293.865320, 0.000020, 0.100000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 66.329270, 0.000020, 0.305000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 113.865320, 0.000020, 0.060000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 20.763550, 0.000020, 0.041000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 200.763550, 0.000020, 0.450000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 54.421270, 0.000080, 0.085000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 187.405760, 0.000050, 0.666000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 211.274600, 0.000050, 0.068000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 82.690470, 0.000030, 0.036000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 336.720780, 0.000020, 0.078000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 231.136880, 0.000060, 0.071000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 270.111290, 0.000020, 2.231000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 31.101250, 0.000040, 0.037000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 156.720780, 0.000020, 0.073000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -1.000000}, 270.111290, 0.000020, 0.037000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 38.076900, 0.000100, 0.077000},
-{{0.000000, 4.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 319.145730, 0.000060, 0.038000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 344.262290, 0.000100, 0.045000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 13.796290, 0.000020, 0.234000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 181.331610, 0.000030, 0.042000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 165.236520, 0.000020, 0.400000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 143.515070, 0.000060, 0.072000},
-{{0.000000, 4.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 273.914090, 0.000040, 0.037000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 241.269040, 0.000260, 0.047000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 251.886010, 0.000460, 0.125000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 8.034690, 0.000020, 0.103000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 1.946800, 0.000030, 0.286000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 188.034690, 0.000020, 0.060000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 1.946800, 0.000030, 0.033000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 204.102180, 0.000040, 0.408000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 291.901020, 0.000020, 0.087000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 291.901020, 0.000020, 0.067000},
-{{0.000000, 4.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 234.093080, 0.000190, 0.035000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 339.384000, 0.000140, 0.049000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 151.725280, 0.000040, 0.143000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 146.259970, 0.000030, 0.095000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 135.731260, 0.000030, 0.367000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 326.259970, 0.000030, 0.063000},
-{{0.000000, 4.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 302.927250, 0.000070, 0.034000},
-{{0.000000, 4.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 243.883870, 0.000280, 0.033000},
-{{0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 109.718890, 0.000040, 0.154000},
-{{0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 323.653640, 0.000020, 0.212000},
-{{0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 293.714250, 0.000210, 0.032000},
-{{0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 13.544690, 0.000020, 0.031000},
-{{0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 193.544690, 0.000020, 0.017000},
-{{0.000000, 4.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 18.015560, 0.000030, 0.018000},
-{{0.000000, 4.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 303.435900, 0.000020, 0.153000},
-{{0.000000, 4.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 303.435900, 0.000020, 0.050000},
-{{0.000000, 4.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 312.195340, 0.000050, 0.030000},
-{{0.000000, 4.000000, 3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 37.004800, 0.000030, 0.029000},
-{{0.000000, 5.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 330.326510, 0.000040, 0.065000},
-{{0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.302820, 0.000210, 0.036000},
-{{0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 251.571560, 0.000030, 0.062000},
-{{0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.571560, 0.000060, 0.348000},
-{{0.000000, 5.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 71.571560, 0.000030, 0.096000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 148.243890, 0.000020, 0.075000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 148.243890, 0.000020, 0.076000},
-{{0.000000, 5.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 324.685380, 0.000040, 0.534000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 46.486350, 0.000060, 0.076000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 34.188550, 0.000030, 0.071000},
-{{0.000000, 5.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 214.188550, 0.000030, 0.081000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 306.986320, 0.000360, 0.041000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 322.473040, 0.000040, 0.088000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 12.466650, 0.000040, 0.076000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 192.466650, 0.000040, 0.075000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 295.409060, 0.000030, 0.067000},
-{{0.000000, 5.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 115.409060, 0.000030, 0.086000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 47.470980, 0.000080, 0.042000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 192.646670, 0.000050, 0.097000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 176.925220, 0.000070, 0.082000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 332.234670, 0.000030, 0.887000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 356.925220, 0.000070, 0.070000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 1.000000}, 1.146060, 0.000030, 0.078000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 135.400230, 0.000030, 0.076000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 181.146060, 0.000030, 0.073000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 315.400230, 0.000030, 0.075000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 251.677280, 0.000020, 0.072000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 71.677280, 0.000020, 0.079000},
-{{0.000000, 5.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 199.555110, 0.000220, 0.039000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 347.534010, 0.000050, 0.107000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 20.258650, 0.000020, 0.042000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 200.258650, 0.000020, 0.351000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 190.068460, 0.000030, 0.041000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 353.411960, 0.000030, 0.090000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 241.372090, 0.000070, 0.470000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 173.411960, 0.000030, 0.065000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 30.452060, 0.000030, 0.036000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000}, 106.754910, 0.000070, 0.076000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 270.895870, 0.000170, 0.073000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 94.854430, 0.000070, 0.037000},
-{{0.000000, 5.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000}, 286.754910, 0.000070, 0.075000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 345.574800, 0.000110, 0.046000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 343.057650, 0.000020, 0.099000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 29.718860, 0.000020, 0.320000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 163.057650, 0.000020, 0.061000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 29.718860, 0.000020, 0.034000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 87.728570, 0.000040, 0.068000},
-{{0.000000, 5.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 267.729190, 0.000040, 0.036000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 244.943830, 0.000270, 0.049000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 252.364980, 0.000430, 0.136000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 91.709470, 0.000030, 0.110000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 271.709470, 0.000030, 0.058000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 203.362230, 0.000040, 0.325000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 216.059890, 0.000030, 0.033000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 113.945370, 0.000020, 0.092000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 10.863090, 0.000060, 0.064000},
-{{0.000000, 5.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 231.972900, 0.000160, 0.035000},
-{{0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 164.261030, 0.000040, 0.051000},
-{{0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 325.740310, 0.000030, 0.060000},
-{{0.000000, 5.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 288.432310, 0.000050, 0.033000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 56.281510, 0.000020, 0.140000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 236.281510, 0.000020, 0.052000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 358.671820, 0.000050, 0.057000},
-{{0.000000, 5.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 254.271610, 0.000400, 0.032000},
-{{0.000000, 5.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 109.751940, 0.000040, 0.140000},
-{{0.000000, 5.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 293.716500, 0.000210, 0.031000},
-{{0.000000, 5.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 313.656440, 0.000040, 0.030000},
-{{0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 330.305790, 0.000030, 0.068000},
-{{0.000000, 6.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 150.305790, 0.000030, 0.085000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.361410, 0.000200, 0.037000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 262.058110, 0.000020, 0.073000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 262.058110, 0.000020, 0.078000},
-{{0.000000, 6.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.596130, 0.000060, 0.445000},
-{{0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 340.280690, 0.000040, 0.025000},
-{{0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 217.148790, 0.000040, 0.079000},
-{{0.000000, 6.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 323.841670, 0.000030, 0.802000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 210.192270, 0.000020, 0.040000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 158.298380, 0.000020, 0.085000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 210.192270, 0.000020, 0.655000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 338.298380, 0.000020, 0.068000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 359.465670, 0.000020, 0.074000},
-{{0.000000, 6.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 179.465670, 0.000020, 0.077000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 282.147960, 0.000150, 0.042000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 298.305980, 0.000040, 0.093000},
-{{0.000000, 6.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 301.697190, 0.000060, 0.075000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 353.073560, 0.000050, 0.044000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 284.817240, 0.000080, 0.087000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 117.618760, 0.000040, 0.075000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 284.131530, 0.000470, 0.076000},
-{{0.000000, 6.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 199.613690, 0.000200, 0.038000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 11.531310, 0.000060, 0.115000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 19.831890, 0.000040, 0.043000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 213.530280, 0.000020, 0.042000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 144.976160, 0.000030, 0.095000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 213.530280, 0.000020, 0.363000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 324.976160, 0.000030, 0.062000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 90.100490, 0.000050, 0.065000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 91.441640, 0.000030, 1.021000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 281.921350, 0.000060, 0.070000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 91.441640, 0.000030, 0.036000},
-{{0.000000, 6.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 288.319180, 0.000030, 0.025000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 350.332020, 0.000100, 0.048000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 343.691100, 0.000030, 0.105000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 163.691100, 0.000030, 0.059000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 4.373050, 0.000100, 0.066000},
-{{0.000000, 6.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 236.227220, 0.000030, 0.035000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 72.759960, 0.000030, 0.022000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 2.000000, 0.000000}, 252.759960, 0.000030, 0.055000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 244.344400, 0.000260, 0.050000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 252.759960, 0.000410, 0.149000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 70.845610, 0.000050, 0.118000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 250.845610, 0.000050, 0.056000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 30.616750, 0.000030, 0.062000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 68.022650, 0.000020, 0.034000},
-{{0.000000, 6.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 248.022650, 0.000020, 0.018000},
-{{0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 165.436510, 0.000040, 0.053000},
-{{0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 339.146220, 0.000020, 0.108000},
-{{0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 339.146220, 0.000020, 0.058000},
-{{0.000000, 6.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 239.735360, 0.000030, 0.033000},
-{{0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 280.904440, 0.000050, 0.056000},
-{{0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 57.446020, 0.000030, 0.154000},
-{{0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 237.446020, 0.000030, 0.050000},
-{{0.000000, 6.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 255.134400, 0.000340, 0.032000},
-{{0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 108.934330, 0.000030, 0.129000},
-{{0.000000, 6.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 299.250420, 0.000200, 0.031000},
-{{0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.415970, 0.000190, 0.038000},
-{{0.000000, 7.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.619990, 0.000060, 0.617000},
-{{0.000000, 7.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 340.247210, 0.000030, 0.026000},
-{{0.000000, 7.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 333.468130, 0.000030, 0.039000},
-{{0.000000, 7.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 323.048390, 0.000030, 1.609000},
-{{0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 219.729510, 0.000040, 0.041000},
-{{0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 217.677040, 0.000070, 0.090000},
-{{0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 210.764340, 0.000020, 0.078000},
-{{0.000000, 7.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 30.764340, 0.000020, 0.073000},
-{{0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 305.985750, 0.000030, 0.020000},
-{{0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 276.397240, 0.000140, 0.043000},
-{{0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 70.579360, 0.000020, 0.084000},
-{{0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 233.024810, 0.000030, 0.725000},
-{{0.000000, 7.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 250.579360, 0.000020, 0.068000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 16.740380, 0.000030, 0.045000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 196.740380, 0.000030, 0.241000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 19.399930, 0.000030, 0.092000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 8.597030, 0.000050, 0.420000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 199.399930, 0.000030, 0.064000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 53.464830, 0.000020, 0.079000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 233.464830, 0.000020, 0.072000},
-{{0.000000, 7.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 199.668260, 0.000170, 0.037000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 293.340940, 0.000170, 0.047000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 252.228990, 0.000020, 0.194000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 19.468860, 0.000030, 0.045000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 200.079780, 0.000030, 0.043000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 126.492720, 0.000040, 0.101000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 200.079780, 0.000030, 0.296000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 306.492720, 0.000040, 0.060000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 72.868690, 0.000020, 0.086000},
-{{0.000000, 7.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 288.338890, 0.000020, 0.024000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 352.793630, 0.000080, 0.049000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 10.010500, 0.000030, 0.163000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 332.182420, 0.000030, 0.384000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 356.021840, 0.000100, 0.063000},
-{{0.000000, 7.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 192.014340, 0.000090, 0.034000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 72.787350, 0.000030, 0.023000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 2.000000, 0.000000}, 252.787350, 0.000030, 0.057000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 241.905360, 0.000250, 0.052000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 95.099930, 0.000040, 0.127000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 252.504980, 0.000050, 0.186000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 275.099930, 0.000040, 0.054000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 55.196700, 0.000020, 0.031000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 229.186000, 0.000040, 0.032000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 60.434860, 0.000080, 0.059000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 215.075330, 0.000020, 0.033000},
-{{0.000000, 7.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 71.141250, 0.000020, 0.018000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 281.237880, 0.000060, 0.058000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 57.197700, 0.000020, 0.170000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 237.197700, 0.000020, 0.048000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 179.817280, 0.000030, 0.178000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 19.329980, 0.000050, 0.031000},
-{{0.000000, 7.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 236.949900, 0.000020, 0.017000},
-{{0.000000, 7.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 290.882060, 0.000170, 0.030000},
-{{0.000000, 7.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 195.719880, 0.000040, 0.107000},
-{{0.000000, 7.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 13.540440, 0.000020, 0.028000},
-{{0.000000, 7.000000, -2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 16.431220, 0.000150, 0.029000},
-{{0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 151.766650, 0.000030, 0.037000},
-{{0.000000, 8.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 331.766650, 0.000030, 4.509000},
-{{0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 70.663570, 0.000150, 0.039000},
-{{0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 77.797560, 0.000020, 1.285000},
-{{0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.642340, 0.000050, 1.004000},
-{{0.000000, 8.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 105.660780, 0.000070, 0.042000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 185.328730, 0.000370, 0.040000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 183.946900, 0.000340, 0.087000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 173.960530, 0.000480, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 325.617210, 0.000020, 238.919000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 354.016420, 0.000480, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 351.299520, 0.000020, 0.038000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 7.100120, 0.000310, 0.087000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 2.843440, 0.000390, 0.040000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 185.727210, 0.000070, 0.044000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 232.330870, 0.000030, 0.499000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 279.324800, 0.000030, 4.345000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 276.258360, 0.000060, 0.074000},
-{{0.000000, 8.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 99.324800, 0.000030, 0.037000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 62.352570, 0.000020, 0.046000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 62.352570, 0.000020, 0.209000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 18.815060, 0.000030, 0.098000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 353.830620, 0.000020, 0.333000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 198.815060, 0.000030, 0.062000},
-{{0.000000, 8.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 17.595910, 0.000030, 0.034000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 288.846700, 0.000170, 0.048000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 321.479240, 0.000020, 0.046000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 141.479240, 0.000020, 0.212000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 200.098560, 0.000020, 0.044000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 99.128520, 0.000040, 0.108000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 249.147240, 0.000050, 0.250000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 279.128520, 0.000040, 0.058000},
-{{0.000000, 8.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 270.081830, 0.000060, 0.034000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 343.880680, 0.000030, 0.022000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 348.873270, 0.000040, 0.051000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 355.510680, 0.000020, 0.148000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 359.763210, 0.000040, 0.061000},
-{{0.000000, 8.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 184.312460, 0.000090, 0.034000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 72.809590, 0.000020, 0.023000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 2.000000, 0.000000}, 72.809590, 0.000020, 0.059000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 118.080160, 0.000060, 0.053000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 235.951310, 0.000090, 0.167000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 65.660460, 0.000020, 0.031000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 201.761390, 0.000040, 0.031000},
-{{0.000000, 8.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 210.429760, 0.000070, 0.033000},
-{{0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 165.563640, 0.000030, 0.051000},
-{{0.000000, 8.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 345.563640, 0.000030, 0.143000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 280.854830, 0.000030, 0.060000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 100.854830, 0.000030, 0.102000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 234.716180, 0.000020, 0.125000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 234.716180, 0.000020, 0.029000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 176.522290, 0.000020, 0.161000},
-{{0.000000, 8.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 42.260420, 0.000050, 0.031000},
-{{0.000000, 8.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 289.107770, 0.000020, 0.166000},
-{{0.000000, 8.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 294.993980, 0.000020, 0.138000},
-{{0.000000, 8.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 109.107770, 0.000020, 0.049000},
-{{0.000000, 8.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 114.993980, 0.000020, 0.030000},
-{{0.000000, 8.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 195.913880, 0.000040, 0.100000},
-{{0.000000, 8.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 18.000700, 0.000020, 0.047000},
-{{0.000000, 8.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 198.000700, 0.000020, 0.021000},
-{{0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 152.417070, 0.000030, 0.038000},
-{{0.000000, 9.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 332.417070, 0.000030, 2.477000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 266.512810, 0.000020, 0.040000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 86.512810, 0.000020, 0.712000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 263.117960, 0.000030, 0.073000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.662720, 0.000050, 2.701000},
-{{0.000000, 9.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 83.117960, 0.000030, 0.078000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 340.181310, 0.000020, 0.027000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 334.710420, 0.000030, 0.041000},
-{{0.000000, 9.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 160.181310, 0.000020, 0.092000},
-{{0.000000, 9.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 245.953600, 0.000080, 0.043000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 206.450370, 0.000060, 0.045000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 51.731110, 0.000030, 0.113000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 118.858520, 0.000020, 0.227000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 67.566550, 0.000030, 0.042000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 94.221080, 0.000020, 0.094000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 247.566550, 0.000030, 0.380000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 274.221080, 0.000020, 0.063000},
-{{0.000000, 9.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 100.055390, 0.000050, 0.037000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 13.096620, 0.000030, 0.276000},
-{{0.000000, 9.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 10.855260, 0.000020, 0.033000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 321.034410, 0.000040, 0.047000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 270.069420, 0.000050, 0.033000},
-{{0.000000, 9.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 108.362410, 0.000410, 0.034000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 343.965210, 0.000020, 0.022000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 355.021400, 0.000060, 0.052000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 343.965210, 0.000060, 0.171000},
-{{0.000000, 9.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 190.061760, 0.000070, 0.033000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 112.675880, 0.000100, 0.055000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 71.290610, 0.000030, 0.206000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 268.332700, 0.000020, 0.151000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 239.056190, 0.000050, 0.151000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 88.332700, 0.000020, 0.050000},
-{{0.000000, 9.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 201.683700, 0.000050, 0.032000},
-{{0.000000, 9.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 349.633690, 0.000050, 0.131000},
-{{0.000000, 9.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 35.415980, 0.000080, 0.030000},
-{{0.000000, 9.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 109.166360, 0.000040, 0.047000},
-{{0.000000, 9.000000, -5.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 110.854810, 0.000060, 0.029000},
-{{0.000000, 9.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 18.097640, 0.000020, 0.063000},
-{{0.000000, 9.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 198.097640, 0.000020, 0.094000},
-{{0.000000, 9.000000, -4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 193.529660, 0.000040, 0.045000},
-{{0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 153.017660, 0.000060, 0.039000},
-{{0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 153.017660, 0.000030, 0.082000},
-{{0.000000, 10.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 333.017660, 0.000030, 0.070000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 265.949080, 0.000020, 0.041000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 265.949080, 0.000020, 0.493000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 251.680880, 0.000020, 0.038000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 83.084850, 0.000040, 0.077000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.680880, 0.000020, 3.918000},
-{{0.000000, 10.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 263.084850, 0.000040, 0.074000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 160.436440, 0.000520, 0.043000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 166.339790, 0.000030, 0.098000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 160.148250, 0.000040, 0.073000},
-{{0.000000, 10.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 340.148250, 0.000040, 0.079000},
-{{0.000000, 10.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 241.697340, 0.000070, 0.044000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 216.072930, 0.000050, 0.047000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 93.664560, 0.000050, 0.122000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 259.502150, 0.000050, 0.307000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 105.646380, 0.000020, 0.085000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 285.646380, 0.000020, 0.068000},
-{{0.000000, 10.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 100.711060, 0.000040, 0.036000},
-{{0.000000, 10.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 167.599150, 0.000040, 0.049000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 320.644350, 0.000040, 0.049000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 288.367140, 0.000030, 0.125000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 312.694210, 0.000040, 0.190000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 108.367140, 0.000030, 0.054000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 1.000000}, 270.054920, 0.000020, 0.221000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 270.054920, 0.000020, 0.032000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 108.367140, 0.000300, 0.033000},
-{{0.000000, 10.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 108.367140, 0.000030, 0.018000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 0.998480, 0.000040, 0.054000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 344.042590, 0.000020, 0.191000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 0.998480, 0.000040, 0.125000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 344.042590, 0.000020, 0.047000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 186.350590, 0.000020, 0.049000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 186.350590, 0.000020, 0.160000},
-{{0.000000, 10.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 187.724680, 0.000080, 0.032000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 128.245520, 0.000090, 0.057000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 184.509890, 0.000020, 0.054000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 4.509890, 0.000020, 0.125000},
-{{0.000000, 10.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 211.752820, 0.000060, 0.031000},
-{{0.000000, 10.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 355.760360, 0.000040, 0.121000},
-{{0.000000, 10.000000, -7.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 248.879510, 0.000050, 0.108000},
-{{0.000000, 10.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 110.501350, 0.000030, 0.118000},
-{{0.000000, 10.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 110.501350, 0.000030, 0.029000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 150.662720, 0.000210, 0.040000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 150.662720, 0.000130, 0.087000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000}, 150.662720, 0.000040, 0.038000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 149.609000, 0.000730, 0.075000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 225.680430, 0.000300, 1911.695000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 330.179450, 0.000600, 0.075000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 330.662720, 0.000040, 0.038000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 330.662720, 0.000130, 0.087000},
-{{0.000000, 10.000000, -3.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 330.662720, 0.000210, 0.040000},
-{{0.000000, 11.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 153.571750, 0.000060, 0.040000},
-{{0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 160.114680, 0.000040, 0.020000},
-{{0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 160.114680, 0.000430, 0.044000},
-{{0.000000, 11.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 24.320560, 0.000030, 0.075000},
-{{0.000000, 11.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 215.246060, 0.000060, 0.046000},
-{{0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 249.165980, 0.000030, 0.048000},
-{{0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 130.252220, 0.000040, 0.132000},
-{{0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 169.643080, 0.000040, 0.177000},
-{{0.000000, 11.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 271.403030, 0.000040, 0.258000},
-{{0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 109.232530, 0.000030, 0.050000},
-{{0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 219.788080, 0.000030, 0.150000},
-{{0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 350.210560, 0.000020, 0.046000},
-{{0.000000, 11.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 350.210560, 0.000020, 0.205000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 320.299140, 0.000040, 0.050000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 288.367690, 0.000020, 0.136000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 265.629250, 0.000030, 0.170000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 108.367690, 0.000020, 0.052000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 294.037460, 0.000020, 0.031000},
-{{0.000000, 11.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 288.367690, 0.000050, 0.033000},
-{{0.000000, 11.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 173.714890, 0.000060, 0.032000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 128.477380, 0.000090, 0.059000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 184.278450, 0.000020, 0.056000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 4.278450, 0.000020, 0.116000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 251.085310, 0.000020, 0.140000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 251.085310, 0.000020, 0.052000},
-{{0.000000, 11.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 218.435040, 0.000050, 0.031000},
-{{0.000000, 11.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 248.928570, 0.000020, 0.101000},
-{{0.000000, 11.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 248.928570, 0.000020, 0.027000},
-{{0.000000, 11.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 244.550960, 0.000040, 0.047000},
-{{0.000000, 11.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 150.700570, 0.000030, 0.029000},
-{{0.000000, 11.000000, -6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 17.969630, 0.000330, 0.027000},
-{{0.000000, 12.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 154.082820, 0.000060, 0.041000},
-{{0.000000, 12.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 71.710150, 0.000070, 0.100000},
-{{0.000000, 12.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 71.710150, 0.000030, 0.085000},
-{{0.000000, 12.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 251.710150, 0.000030, 0.068000},
-{{0.000000, 12.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 160.080530, 0.000330, 0.045000},
-{{0.000000, 12.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 340.094340, 0.000030, 0.071000},
-{{0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 175.243780, 0.000040, 0.047000},
-{{0.000000, 12.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 268.962620, 0.000020, 0.189000},
-{{0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 296.635250, 0.000030, 0.049000},
-{{0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 116.635250, 0.000030, 0.159000},
-{{0.000000, 12.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 271.427570, 0.000040, 0.222000},
-{{0.000000, 12.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 86.859760, 0.000030, 0.052000},
-{{0.000000, 12.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 266.859760, 0.000030, 0.137000},
-{{0.000000, 12.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 199.756580, 0.000040, 0.059000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 132.385330, 0.000020, 0.154000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 277.838740, 0.000030, 0.030000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 282.597400, 0.000020, 0.211000},
-{{0.000000, 12.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 107.793580, 0.000230, 0.032000},
-{{0.000000, 12.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 162.565290, 0.000020, 0.174000},
-{{0.000000, 12.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 162.565290, 0.000020, 0.031000},
-{{0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 128.553690, 0.000050, 0.062000},
-{{0.000000, 12.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 308.553690, 0.000050, 0.097000},
-{{0.000000, 12.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 148.267190, 0.000040, 0.029000},
-{{0.000000, 12.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 248.968110, 0.000020, 0.221000},
-{{0.000000, 12.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 9.653920, 0.000020, 0.115000},
-{{0.000000, 12.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 248.968110, 0.000020, 0.045000},
-{{0.000000, 12.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 189.653920, 0.000020, 0.028000},
-{{0.000000, 12.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 92.899650, 0.000090, 0.076000},
-{{0.000000, 12.000000, -8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 205.021320, 0.000070, 0.075000},
-{{0.000000, 13.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 154.554320, 0.000050, 0.042000},
-{{0.000000, 13.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 71.721250, 0.000050, 0.107000},
-{{0.000000, 13.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 340.045600, 0.000050, 0.046000},
-{{0.000000, 13.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 340.045600, 0.000030, 0.099000},
-{{0.000000, 13.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 160.045600, 0.000030, 0.061000},
-{{0.000000, 13.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 112.249740, 0.000050, 0.049000},
-{{0.000000, 13.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 299.174230, 0.000030, 0.051000},
-{{0.000000, 13.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 122.908660, 0.000020, 0.047000},
-{{0.000000, 13.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 302.908660, 0.000020, 0.195000},
-{{0.000000, 13.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 86.538040, 0.000050, 0.054000},
-{{0.000000, 13.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 107.443980, 0.000240, 0.031000},
-{{0.000000, 13.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 165.242880, 0.000150, 0.060000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 252.852250, 0.000030, 0.035000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 239.068360, 0.000140, 0.064000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 72.852250, 0.000030, 0.426000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 139.992280, 0.000020, 0.092000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 183.904820, 0.000020, 0.060000},
-{{0.000000, 13.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 183.904820, 0.000020, 0.102000},
-{{0.000000, 13.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 160.119300, 0.000050, 0.029000},
-{{0.000000, 13.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 2.000000}, 277.345800, 0.000030, 0.075000},
-{{0.000000, 13.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 45.743070, 0.000050, 0.073000},
-{{0.000000, 13.000000, -10.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 2.000000}, 97.345800, 0.000030, 0.076000},
-{{0.000000, 14.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 154.989590, 0.000050, 0.044000},
-{{0.000000, 14.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 340.009770, 0.000020, 0.021000},
-{{0.000000, 14.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 340.044000, 0.000270, 0.048000},
-{{0.000000, 14.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 340.009770, 0.000040, 0.129000},
-{{0.000000, 14.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 3.000000, 0.000000}, 160.009770, 0.000040, 0.053000},
-{{0.000000, 14.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 97.349760, 0.000060, 0.050000},
-{{0.000000, 14.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 298.684780, 0.000040, 0.053000},
-{{0.000000, 14.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 302.884660, 0.000020, 0.048000},
-{{0.000000, 14.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 302.884660, 0.000020, 0.174000},
-{{0.000000, 14.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 87.912760, 0.000050, 0.056000},
-{{0.000000, 14.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 108.347170, 0.000050, 0.052000},
-{{0.000000, 14.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 338.787300, 0.000050, 0.063000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 134.107690, 0.000040, 0.067000},
-{{0.000000, 14.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 252.848850, 0.000410, 0.580000},
-{{0.000000, 14.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 160.211180, 0.000020, 0.111000},
-{{0.000000, 14.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 160.211180, 0.000020, 0.028000},
-{{0.000000, 14.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 234.758760, 0.000060, 0.077000},
-{{0.000000, 14.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 125.186990, 0.000020, 0.068000},
-{{0.000000, 14.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 305.186990, 0.000020, 0.085000},
-{{0.000000, 14.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 17.919950, 0.000020, 0.073000},
-{{0.000000, 14.000000, -9.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 197.919950, 0.000020, 0.025000},
-{{0.000000, 15.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 155.391720, 0.000020, 0.045000},
-{{0.000000, 15.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 155.391720, 0.000020, 0.241000},
-{{0.000000, 15.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 340.020460, 0.000190, 0.049000},
-{{0.000000, 15.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 339.972940, 0.000050, 0.141000},
-{{0.000000, 15.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 92.712950, 0.000050, 0.052000},
-{{0.000000, 15.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 312.138660, 0.000040, 0.054000},
-{{0.000000, 15.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.241960, 0.000030, 0.058000},
-{{0.000000, 15.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 251.241960, 0.000030, 0.109000},
-{{0.000000, 15.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 103.474430, 0.000050, 0.119000},
-{{0.000000, 15.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 108.333740, 0.000040, 0.050000},
-{{0.000000, 15.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 341.953660, 0.000070, 0.065000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 95.250110, 0.000030, 0.070000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 275.250110, 0.000030, 0.082000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 183.613470, 0.000020, 0.065000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 3.613470, 0.000020, 0.090000},
-{{0.000000, 15.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 113.254010, 0.000030, 0.028000},
-{{0.000000, 15.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 165.179560, 0.000040, 0.075000},
-{{0.000000, 15.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 68.642910, 0.000030, 0.076000},
-{{0.000000, 15.000000, -12.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 85.147180, 0.000040, 0.075000},
-{{0.000000, 16.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 339.991990, 0.000170, 0.051000},
-{{0.000000, 16.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 159.935060, 0.000070, 0.200000},
-{{0.000000, 16.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 118.711010, 0.000040, 0.053000},
-{{0.000000, 16.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 299.108660, 0.000040, 0.056000},
-{{0.000000, 16.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 94.660080, 0.000020, 0.060000},
-{{0.000000, 16.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 274.660080, 0.000020, 0.102000},
-{{0.000000, 16.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 19.925100, 0.000050, 0.031000},
-{{0.000000, 16.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 85.585670, 0.000020, 0.064000},
-{{0.000000, 16.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 85.585670, 0.000020, 0.093000},
-{{0.000000, 16.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 338.325820, 0.000080, 0.068000},
-{{0.000000, 16.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 204.347080, 0.000020, 0.085000},
-{{0.000000, 16.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 202.739170, 0.000020, 0.063000},
-{{0.000000, 16.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 202.739170, 0.000020, 0.093000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 221.675680, 0.000020, 0.073000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 221.675680, 0.000020, 0.078000},
-{{0.000000, 16.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 75.696630, 0.000050, 0.028000},
-{{0.000000, 16.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 181.209940, 0.000050, 0.073000},
-{{0.000000, 16.000000, -14.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 181.209940, 0.000050, 0.077000},
-{{0.000000, 16.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 77.776000, 0.000090, 0.077000},
-{{0.000000, 16.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 193.428260, 0.000020, 0.076000},
-{{0.000000, 16.000000, -11.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 13.428260, 0.000020, 0.025000},
-{{0.000000, 17.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 166.141070, 0.000020, 0.052000},
-{{0.000000, 17.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 346.141070, 0.000020, 0.135000},
-{{0.000000, 17.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 159.896050, 0.000060, 0.178000},
-{{0.000000, 17.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 119.893210, 0.000040, 0.055000},
-{{0.000000, 17.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 59.833160, 0.000020, 0.062000},
-{{0.000000, 17.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 59.833160, 0.000020, 0.096000},
-{{0.000000, 17.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 19.955140, 0.000040, 0.030000},
-{{0.000000, 17.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 85.145480, 0.000050, 0.066000},
-{{0.000000, 17.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 244.587600, 0.000040, 0.071000},
-{{0.000000, 17.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 202.763500, 0.000020, 0.066000},
-{{0.000000, 17.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 22.763500, 0.000020, 0.088000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 252.818680, 0.000020, 0.025000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 252.818680, 0.000020, 0.076000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -2.000000, 1.000000}, 56.519830, 0.000030, 0.072000},
-{{0.000000, 17.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 236.519830, 0.000030, 0.079000},
-{{0.000000, 18.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 166.105450, 0.000040, 0.054000},
-{{0.000000, 18.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 159.855890, 0.000050, 0.160000},
-{{0.000000, 18.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 132.021960, 0.000030, 0.057000},
-{{0.000000, 18.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 60.182050, 0.000020, 0.065000},
-{{0.000000, 18.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 60.182050, 0.000020, 0.091000},
-{{0.000000, 18.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 71.012680, 0.000040, 0.069000},
-{{0.000000, 18.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 215.629820, 0.000020, 0.074000},
-{{0.000000, 18.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 35.629820, 0.000020, 0.077000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 127.502430, 0.000040, 0.039000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 321.292910, 0.000050, 0.080000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 72.802570, 0.000380, 1.286000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -2.000000, 1.000000}, 79.597850, 0.000020, 0.076000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000}, 79.597850, 0.000020, 0.075000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 127.502430, 0.000060, 0.070000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 127.502430, 0.000080, 0.082000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 127.502430, 0.000090, 0.095000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 127.502430, 0.000250, 0.042000},
-{{0.000000, 18.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 127.502430, 0.000020, 0.027000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, -1.000000, 0.000000}, 204.565500, 0.000030, 0.020000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000, 0.000000}, 204.565500, 0.000060, 0.028000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 1.000000, 0.000000}, 204.565500, 0.000030, 0.044000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -3.000000, 0.000000}, 204.565500, 0.000030, 0.020000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 204.565500, 0.000320, 0.026000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 204.565500, 0.003640, 0.040000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 204.589140, 0.002410, 0.087000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000}, 24.565500, 0.000070, 0.081000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -4.000000, 0.000000}, 204.565500, 0.000040, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000}, 204.453910, 0.000720, 0.038000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 204.554060, 0.013020, 0.075000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000}, 204.565500, 0.000050, 0.074000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 351.087990, 0.000550, 273.043000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000}, 24.565500, 0.000050, 0.074000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 24.795240, 0.012250, 0.075000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 24.684040, 0.000680, 0.038000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 24.565500, 0.000040, 0.025000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 204.565500, 0.000070, 0.081000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 24.577090, 0.002260, 0.087000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 24.565500, 0.003640, 0.040000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 24.565500, 0.000320, 0.026000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 24.565500, 0.000030, 0.020000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 0.000000}, 24.565500, 0.000030, 0.044000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000}, 24.565500, 0.000060, 0.028000},
-{{0.000000, 18.000000, -16.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000}, 24.565500, 0.000030, 0.020000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -2.000000, 0.000000}, 101.628570, 0.000020, 0.027000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, -1.000000, 0.000000}, 101.628570, 0.000250, 0.042000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 102.856860, 0.000070, 0.095000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 98.410310, 0.000030, 0.062000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 101.628570, 0.000080, 0.082000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 101.628570, 0.000060, 0.070000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 44.230710, 0.000040, 0.076000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 101.628570, 0.000040, 0.039000},
-{{0.000000, 18.000000, -15.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 69.060730, 0.000040, 0.026000},
-{{0.000000, 19.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 336.656550, 0.000030, 0.050000},
-{{0.000000, 19.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 166.068140, 0.000030, 0.056000},
-{{0.000000, 19.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 159.814550, 0.000020, 0.051000},
-{{0.000000, 19.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 159.814550, 0.000020, 0.145000},
-{{0.000000, 19.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 159.118650, 0.000040, 0.059000},
-{{0.000000, 19.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 71.473330, 0.000020, 0.104000},
-{{0.000000, 19.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 86.471660, 0.000050, 0.067000},
-{{0.000000, 19.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 167.649070, 0.000020, 0.086000},
-{{0.000000, 19.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 71.436730, 0.000020, 0.064000},
-{{0.000000, 19.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 251.436730, 0.000020, 0.092000},
-{{0.000000, 19.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 288.251920, 0.000050, 0.028000},
-{{0.000000, 19.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 55.149400, 0.000080, 0.078000},
-{{0.000000, 19.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 330.393880, 0.000040, 0.072000},
-{{0.000000, 19.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 333.793180, 0.000060, 0.084000},
-{{0.000000, 19.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 339.920760, 0.000070, 0.084000},
-{{0.000000, 19.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 304.232780, 0.000030, 0.068000},
-{{0.000000, 19.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 117.350990, 0.000020, 0.073000},
-{{0.000000, 19.000000, -18.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 29.221500, 0.000040, 0.078000},
-{{0.000000, 19.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 206.474720, 0.000050, 0.092000},
-{{0.000000, 19.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 8.405030, 0.000020, 0.079000},
-{{0.000000, 19.000000, -17.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 8.405030, 0.000020, 0.072000},
-{{0.000000, 20.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 159.554120, 0.000040, 0.062000},
-{{0.000000, 20.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 71.668500, 0.000020, 0.097000},
-{{0.000000, 20.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 225.850910, 0.000020, 0.070000},
-{{0.000000, 20.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 225.850910, 0.000020, 0.081000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 204.207410, 0.000130, 0.076000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 1.000000, 0.000000}, 231.738970, 0.000330, 34.812000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 322.763070, 0.000080, 0.075000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 318.306220, 0.000040, 0.070000},
-{{0.000000, 20.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 288.225160, 0.000040, 0.028000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 27.356710, 0.000040, 0.075000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 207.356710, 0.000040, 0.076000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 216.474650, 0.000020, 0.071000},
-{{0.000000, 20.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 216.474650, 0.000020, 0.080000},
-{{0.000000, 20.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 350.787810, 0.000030, 0.089000},
-{{0.000000, 20.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 55.608710, 0.000050, 0.081000},
-{{0.000000, 20.000000, -19.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 238.771390, 0.000050, 0.074000},
-{{0.000000, 21.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 339.822690, 0.000030, 0.123000},
-{{0.000000, 21.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 153.124220, 0.000030, 0.064000},
-{{0.000000, 21.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 43.904550, 0.000030, 0.092000},
-{{0.000000, 21.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 291.385730, 0.000030, 0.068000},
-{{0.000000, 21.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 265.710800, 0.000050, 0.079000},
-{{0.000000, 21.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 17.147490, 0.000020, 0.073000},
-{{0.000000, 21.000000, -22.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 197.147490, 0.000020, 0.078000},
-{{0.000000, 21.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 155.737920, 0.000040, 0.076000},
-{{0.000000, 21.000000, -20.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 63.476230, 0.000040, 0.076000},
-{{0.000000, 22.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 121.829030, 0.000030, 0.067000},
-{{0.000000, 22.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 182.095590, 0.000060, 0.072000},
-{{0.000000, 22.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 157.153160, 0.000050, 0.077000},
-{{0.000000, 22.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, -1.000000}, 275.799700, 0.000020, 0.074000},
-{{0.000000, 22.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 244.362970, 0.000030, 0.085000},
-{{0.000000, 22.000000, -21.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 64.362970, 0.000030, 0.068000},
-{{0.000000, 23.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 169.627770, 0.000020, 0.075000},
-{{0.000000, 23.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 169.627770, 0.000020, 0.076000},
-{{0.000000, 23.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 313.331150, 0.000030, 0.081000},
-{{0.000000, 23.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 313.331150, 0.000030, 0.071000},
-{{0.000000, 23.000000, -25.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000}, 84.089400, 0.000050, 0.075000},
-{{0.000000, 23.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 97.386630, 0.000070, 0.075000},
-{{0.000000, 23.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 203.562700, 0.000040, 0.075000},
-{{0.000000, 24.000000, -28.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 259.163470, 0.000020, 0.073000},
-{{0.000000, 24.000000, -28.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 259.163470, 0.000020, 0.078000},
-{{0.000000, 24.000000, -27.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 6.812210, 0.000050, 0.079000},
-{{0.000000, 24.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 265.309160, 0.000020, 0.074000},
-{{0.000000, 24.000000, -26.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 265.309160, 0.000020, 0.077000},
-{{0.000000, 24.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 344.480600, 0.000030, 0.087000},
-{{0.000000, 24.000000, -24.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 344.480600, 0.000030, 0.067000},
-{{0.000000, 24.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 250.630220, 0.000020, 0.115000},
-{{0.000000, 24.000000, -23.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 70.630220, 0.000020, 0.056000},
-{{0.000000, 25.000000, -30.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 165.875800, 0.000020, 0.071000},
-{{0.000000, 25.000000, -30.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 345.875800, 0.000020, 0.081000},
-{{0.000000, 25.000000, -29.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 192.204470, 0.000050, 0.076000},
-{{0.000000, 25.000000, -28.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 307.923150, 0.000020, 0.072000},
-{{0.000000, 25.000000, -28.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 307.923150, 0.000020, 0.079000},
-{{0.000000, 26.000000, -31.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 276.433900, 0.000030, 0.074000},
-{{0.000000, 26.000000, -31.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 178.066910, 0.000020, 0.077000},
-{{0.000000, 26.000000, -29.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 352.006710, 0.000030, 0.075000},
-{{0.000000, 26.000000, -29.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 172.006710, 0.000030, 0.075000},
-{{0.000000, 26.000000, -28.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 109.485890, 0.000040, 0.076000},
-{{0.000000, 27.000000, -32.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 121.107280, 0.000020, 0.078000},
-{{0.000000, 27.000000, -32.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 121.107280, 0.000020, 0.073000},
-{{0.000000, 28.000000, -33.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 159.389220, 0.000020, 0.071000},
-{{0.000000, 28.000000, -33.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 159.389220, 0.000020, 0.080000},
-{{0.000000, 29.000000, -34.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 158.705470, 0.000060, 0.086000},
-{{0.000000, 29.000000, -34.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 341.199600, 0.000020, 0.067000},
-{{0.000000, 30.000000, -36.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 251.616330, 0.000050, 0.084000},
-{{0.000000, 31.000000, -39.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 244.727890, 0.000040, 0.075000},
-{{0.000000, 31.000000, -39.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 2.000000, 0.000000}, 64.727890, 0.000040, 0.076000},
-{{0.000000, 31.000000, -37.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000}, 251.596480, 0.000040, 0.076000},
-{{0.000000, 31.000000, -37.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 71.596480, 0.000040, 0.075000},
-{{0.000000, 34.000000, -42.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 245.432240, 0.000060, 0.075000},
-{{3.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000}, 63.348720, 0.000050, 0.075000},
+
+static const uint16_t arg[] = {
+6, 7, 34, 37, 32, 39, 14, 30, 31, 57,
+56, 42, 43, 71, 72, 152, 91, 99, 150, 0,
+1079, 79, 77, 3013, 141, 85, 123, 124, 90, 64,
+139, 2277, 3211, 1187, 3210, 1016, 229, 3279, 3280, 3470,
+1278, 3471, 54, 3472, 3474, 3475, 132, 175, 3568, 338,
+174, 853, 138, 110, 278, 76, 81, 3788, 122, 3900,
+3899, 50, 201, 204, 125, 957, 113, 119, 1400, 12,
+507, 135, 4191, 1398, 4192, 1857, 4331, 4332, 641, 339,
+4488, 158, 2327, 4487, 250, 2726, 794, 504, 4493, 285,
+284, 88, 252, 181, 147, 216, 2092, 291, 2007, 92,
+890, 126, 3640, 4682, 1843, 142, 170, 326, 329, 257,
+4896, 675, 1450, 211, 4901, 4910, 4489, 4905, 4907, 4903,
+4908, 4906, 428, 429, 3541, 529, 583, 5130, 217, 3705,
+5126, 5125, 5124, 1840, 5127, 474, 5128, 162, 106, 159,
+5145, 605, 538, 5144, 5146, 53, 3953, 192, 574, 3175,
+5142, 5141, 392, 105, 682, 2350, 800, 5414, 5415, 4978,
+5417, 5411, 246, 234, 103, 670, 5434, 299, 184, 3314,
+5431, 5430, 5428, 5426, 116, 117, 1477, 265, 1020, 771,
+2799, 5787, 4136, 408, 927, 335, 337, 611, 5785, 233,
+8, 2474, 5786, 3977, 2751, 1103, 1104, 1057, 341, 706,
+691, 6229, 3742, 868, 6228, 2907, 4894, 6224, 4878, 4879,
+361, 245, 440, 438, 698, 260, 21, 148, 4474, 5396,
+3292, 499, 182, 621, 567, 1854, 4877, 958, 282, 283,
+5875, 4536, 4600, 6052, 206, 1259, 618, 5041, 2949, 3367,
+407, 220, 2023, 5395, 6055, 4818, 3, 6056, 243, 5111,
+5294, 4671, 5112, 4814, 1026, 1027, 4816, 7538, 45, 156,
+527, 6552, 195, 264, 6570, 4811, 18, 622, 654, 774,
+303, 298, 353, 385, 199, 1837, 5397, 591, 2609, 6218,
+46, 5, 762, 44, 401, 469, 4473, 6062, 5299, 1269,
+5296, 404, 347, 351, 8500, 212, 82, 80, 336, 701,
+310, 1074, 1729, 1661, 312, 5776, 829, 2099, 1762, 5298,
+3302, 891, 1497, 494, 565, 481, 739, 241, 2771, 2913,
+4817, 5645, 663, 2531, 520, 493, 1697, 450, 5440, 6548,
+5394, 6730, 461, 684, 704, 2953, 95, 671, 2322, 7430,
+6574, 4659, 1210, 1240, 5879, 9903, 5740, 4955, 6741, 6794,
+6072, 9773, 5303, 1329, 2694, 616, 614, 5921, 2326, 707,
+5233, 1159, 1218, 643, 391, 669, 393, 6439, 831, 5770,
+2850, 551, 5046, 4820, 945, 2709, 5646, 570, 571, 388,
+6194, 2481, 534, 535, 7426, 4420, 4198, 599, 8609, 9968,
+8124, 5110, 6732, 425, 820, 319, 60, 6733, 6181, 6734,
+596, 635, 3492, 5739, 516, 515, 979, 1743, 1093, 484,
+1678, 356, 6737, 1818, 2098, 416, 6344, 4367, 1838, 1977,
+4675, 6966, 9945, 6183, 7437, 6743, 6744, 6184, 2384, 7743,
+6185, 5641, 672, 673, 5301, 2469, 5302, 8407, 5742, 6745,
+7444, 6048, 6378, 1936, 263, 7216, 17, 1201, 787, 340,
+2424, 280, 2352, 2700, 5553, 5304, 6566, 5226, 1586, 594,
+62, 6560, 4572, 2059, 7231, 2910, 2749, 368, 8113, 7451,
+1416, 5433, 9376, 7233, 2431, 3044, 6547, 6189, 3316, 6190,
+6063, 772, 5745, 6561, 5640, 6070, 627, 604, 615, 653,
+1528, 7245, 8135, 6572, 463, 464, 578, 580, 7425, 8391,
+552, 350, 346, 83, 213, 413, 8126, 9359, 8078, 1716,
+3928, 6051, 1041, 5184, 315, 3157, 5042, 8400, 1146, 1325,
+1220, 4535, 3816, 3942, 7435, 5407, 2741, 12444, 7438, 2467,
+9924, 5887, 10382, 6186, 8474, 12485, 7440, 6187, 5897, 5205,
+6558, 12191, 6783, 5137, 9777, 7441, 8412, 7443, 7764, 6565,
+40, 47, 3236, 1617, 5637, 7445, 3399, 3710, 2696, 1141,
+1766, 5638, 6188, 1186, 29, 721, 155, 2972, 6059, 8416,
+2276, 3518, 12251, 645, 1286, 5236, 7447, 7876, 4102, 5960,
+7218, 8419, 1386, 6061, 9375, 729, 871, 9351, 7220, 5425,
+6227, 5644, 2851, 2186, 7452, 6073, 4583, 9323, 1543, 3722,
+6553, 9807, 6191, 6074, 12458, 6554, 7205, 6487, 6488, 6192,
+7116, 3049, 2707, 6749, 7236, 2391, 5017, 5599, 7423, 8388,
+9144, 7221, 1387, 1152, 1114, 8084, 5024, 8097, 8085, 7237,
+5029, 8098, 1962, 7455, 7456, 7457, 846, 129, 1794, 1367,
+2290, 8101, 3676, 9742, 9301, 459, 35, 709, 3682, 379,
+4208, 5467, 8393, 7428, 7429, 3801, 1327, 3687, 118, 114,
+144, 2602, 435, 328, 9746, 8395, 9749, 224, 306, 375,
+556, 9302, 432, 1855, 6317, 9303, 8396, 8397, 7432, 9750,
+9751, 2462, 781, 782, 888, 933, 8399, 2645, 1011, 3228,
+9756, 5633, 9306, 9360, 9361, 2097, 196, 1371, 12147, 6182,
+8404, 9307, 2181, 1978, 6740, 9765, 12152, 1285, 12524, 4888,
+4084, 9334, 9335, 8105, 9768, 2141, 3818, 12165, 12568, 9771,
+9772, 9336, 4961, 8089, 3949, 8475, 4748, 5509, 12605, 12601,
+9873, 9776, 6991, 1075, 7493, 5761, 8411, 7761, 2297, 1549,
+1245, 1496, 996, 188, 424, 971, 1764, 12228, 2517, 3034,
+2237, 1539, 1952, 925, 8887, 4557, 9342, 9313, 9314, 12539,
+1012, 728, 5934, 333, 452, 7827, 756, 2213, 836, 12602,
+8417, 4380, 5227, 3517, 167, 2797, 1277, 325, 959, 3714,
+7211, 9791, 9317, 678, 586, 610, 127, 314, 1150, 2975,
+8112, 7448, 6746, 8081, 2184, 969, 4992, 3103, 6796, 3177,
+1910, 5639, 7219, 7512, 12550, 6455, 2185, 2329, 360, 8114,
+12604, 8116, 9377, 9799, 9802, 9803, 9054, 9055, 5771, 8131,
+9322, 1248, 2433, 5588, 2479, 904, 905, 9804, 6748, 9805,
+5007, 9325, 12603, 9079, 5994, 3629, 7937, 8424, 9811, 6571,
+9353, 6193, 3209, 646, 1787, 8117, 7453, 8425, 5268, 1956,
+8096, 7142, 1044, 632, 656, 2753, 1049, 2857, 9355, 9326,
+9384, 9817, 9327, 5274, 674, 842, 480, 1823, 6030, 2806,
+9823, 9824, 9825, 9329, 240, 877, 5156, 695, 16160, 5442,
+9735, 9736, 12093, 9737, 9738, 12098, 12099, 12101, 12102, 3369,
+301, 541, 589, 1140, 1533, 33, 830, 2232, 12105, 12106,
+12107, 9744, 12111, 12112, 11540, 9745, 5834, 16197, 1273, 8620,
+755, 26, 10124, 365, 2179, 12113, 4359, 2605, 16772, 7240,
+12115, 16844, 12120, 11472, 5855, 5856, 3805, 15231, 12122, 287,
+2734, 239, 1179, 1660, 12123, 11475, 10253, 11476, 9304, 8398,
+12126, 16845, 12131, 7491, 2737, 12132, 6328, 1328, 3812, 8472,
+15234, 8456, 5187, 11542, 9753, 9754, 12138, 12140, 1291, 1165,
+6339, 3813, 2270, 11478, 16244, 8402, 6738, 9758, 9759, 9727,
+2420, 2786, 1605, 7723, 9760, 1636, 11480, 2787, 3943, 12146,
+1267, 11482, 9762, 9763, 16837, 1405, 13257, 4329, 5199, 7739,
+7740, 2649, 12154, 3946, 15238, 16284, 8405, 9766, 1871, 10358,
+7742, 6979, 12161, 1746, 12163, 2650, 12167, 5204, 16296, 16838,
+9898, 10378, 16300, 3032, 12169, 11546, 3509, 5405, 16839, 16304,
+9774, 12172, 12173, 12174, 12175, 7750, 13328, 12177, 12178, 3819,
+12181, 12182, 5896, 16320, 16321, 16322, 6221, 9775, 4678, 5743,
+12187, 4545, 9337, 12196, 12201, 16344, 9925, 8476, 12210, 12211,
+12212, 12213, 3821, 3822, 12222, 3511, 12223, 1060, 108, 3235,
+2212, 11499, 1183, 317, 2693, 6384, 237, 12226, 12229, 10491,
+12231, 11550, 5210, 936, 1608, 1891, 9788, 795, 1526, 633,
+472, 134, 3609, 3515, 11504, 9343, 9368, 9369, 7446, 9344,
+12235, 9345, 9789, 16840, 6404, 2610, 2611, 61, 4980, 606,
+5223, 12240, 9371, 9346, 11551, 7210, 12244, 12245, 3961, 12246,
+15256, 1938, 2144, 16841, 12247, 9347, 3242, 9790, 8418, 8111,
+9348, 9734, 6422, 16406, 809, 363, 12254, 765, 2214, 766,
+3311, 624, 1527, 2798, 3717, 7866, 5421, 3718, 9794, 9795,
+11507, 2524, 1618, 3619, 1173, 3719, 2772, 640, 355, 12258,
+12259, 2430, 4994, 12260, 16420, 9374, 7450, 15260, 10805, 16425,
+5246, 6775, 16794, 2912, 3837, 6441, 16842, 719, 5248, 1981,
+12266, 12267, 10837, 16432, 6747, 5580, 9320, 6787, 7903, 4772,
+14150, 12271, 15268, 1873, 9796, 16441, 8421, 9797, 9321, 10877,
+6461, 8115, 16449, 4104, 1939, 8130, 9800, 9801, 9378, 7097,
+2977, 11514, 15274, 10921, 9324, 11516, 8093, 10937, 1437, 14367,
+11518, 11519, 10957, 6068, 16478, 7234, 15278, 16843, 8094, 9809,
+7235, 12290, 14446, 11523, 11524, 7960, 14522, 11526, 15286, 5016,
+1194, 12301, 7138, 11558, 966, 879, 938, 967, 907, 972,
+11529, 12303, 9187, 12307, 12311, 11559, 12314, 12315, 8134, 12323,
+16552, 6750, 9386, 15292, 16806, 5756, 9822, 466, 501, 9969,
+902, 1202, 1200, 16158, 5808, 16851, 295, 297, 10013, 12091,
+9300, 11538, 17064, 8390, 17033, 17034, 9740, 15226, 15227, 1086,
+16178, 10017, 569, 3368, 1879, 100, 10083, 1147, 1699, 3683,
+16179, 12801, 3581, 1446, 16181, 16182, 12104, 16183, 6178, 17035,
+16192, 6179, 16194, 17036, 16195, 16196, 11470, 17037, 1973, 10192,
+16199, 16200, 1385, 649, 12121, 5487, 845, 1778, 6735, 12124,
+12129, 12130, 292, 4531, 5186, 3391, 608, 8734, 16224, 12133,
+16227, 17065, 12137, 16230, 9755, 12141, 3936, 3704, 15236, 658,
+1413, 6940, 960, 13191, 16234, 792, 16235, 13193, 16238, 7718,
+7719, 1420, 1458, 2692, 3030, 921, 13212, 1761, 4492, 17038,
+10327, 17039, 16261, 16262, 11544, 4954, 2127, 2842, 1274, 4539,
+6351, 12150, 16270, 16274, 16275, 5504, 16276, 16280, 1908, 17066,
+11545, 3162, 4958, 17040, 6742, 12157, 12159, 1615, 1607, 13292,
+12160, 16875, 6365, 16297, 13318, 17041, 17042, 3097, 16305, 16306,
+7227, 17043, 17044, 5508, 8408, 16316, 16328, 8409, 12186, 5744,
+17045, 12199, 17046, 16348, 7524, 16353, 12205, 12207, 12208, 16361,
+16362, 10408, 16882, 15244, 8080, 16382, 10420, 2965, 8812, 2273,
+2791, 13433, 16383, 324, 348, 8820, 2101, 11500, 11549, 5516,
+948, 3398, 15246, 12224, 13491, 1782, 8106, 16384, 17067, 16386,
+10494, 5914, 4753, 16389, 4374, 8859, 1951, 8860, 9364, 852,
+600, 630, 10519, 5918, 8868, 1344, 3514, 19, 13612, 2131,
+16392, 6058, 12232, 7020, 8890, 9367, 16393, 16394, 13654, 15249,
+15250, 13673, 13675, 8415, 16893, 1217, 1434, 681, 536, 17047,
+7828, 3101, 2699, 17048, 16399, 9370, 16400, 12241, 12242, 15253,
+8928, 593, 17049, 597, 4761, 10666, 2573, 13829, 1188, 307,
+1231, 5559, 2701, 104, 1893, 5232, 10683, 1565, 7849, 13867,
+16404, 12250, 10693, 9792, 17050, 13902, 749, 3832, 17051, 955,
+143, 487, 2301, 16407, 16408, 17068, 13972, 16416, 7067, 6430,
+13985, 10755, 8994, 7872, 9000, 617, 2703, 15259, 17052, 4257,
+5244, 5245, 4996, 15261, 7079, 837, 16905, 10822, 3620, 15263,
+2704, 17053, 12268, 12269, 16428, 16431, 16434, 24, 789, 14148,
+15266, 1652, 8457, 16437, 16438, 5973, 12272, 12273, 16440, 10871,
+16442, 14178, 16443, 12274, 14183, 10872, 17054, 16446, 16908, 15269,
+9040, 10882, 10893, 7093, 12276, 16450, 10899, 16913, 16452, 16455,
+9798, 17069, 16457, 12278, 14252, 17055, 4779, 16460, 7536, 2978,
+12279, 16461, 491, 5419, 14288, 16916, 2705, 6475, 3411, 15276,
+6778, 16470, 17056, 4265, 17057, 16473, 9080, 1619, 15279, 5591,
+917, 17058, 17059, 12285, 12286, 12288, 7113, 16801, 7522, 16491,
+16497, 17060, 7953, 16501, 5758, 17070, 9812, 15285, 16502, 9813,
+16505, 7963, 16510, 8082, 14599, 9883, 11527, 6496, 16513, 16514,
+7976, 14618, 16518, 17061, 14637, 9140, 9143, 14641, 16522, 16523,
+16524, 6498, 9154, 11108, 850, 1984, 2804, 9383, 1118, 1123,
+12304, 11530, 16533, 14775, 16536, 4407, 15289, 12308, 3994, 16538,
+16539, 11181, 11201, 1438, 9328, 17062, 14900, 6027, 8029, 15293,
+15294, 8038, 3996, 16557, 16558, 11308, 14956, 17063, 12333, 14987,
+11339, 7188, 15298, 15299, 16568,
+};
+
+static const uint16_t max_arg[] = {
+6, 7, 34, 37, 37, 39, 39, 39, 39, 57,
+57, 57, 57, 71, 72, 152, 152, 152, 152, 152,
+1079, 1079, 1079, 3013, 3013, 3013, 3013, 3013, 3013, 3013,
+3013, 3013, 3211, 3211, 3211, 3211, 3211, 3279, 3280, 3470,
+3470, 3471, 3471, 3472, 3474, 3475, 3475, 3475, 3568, 3568,
+3568, 3568, 3568, 3568, 3568, 3568, 3568, 3788, 3788, 3900,
+3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900, 3900,
+3900, 3900, 4191, 4191, 4192, 4192, 4331, 4332, 4332, 4332,
+4488, 4488, 4488, 4488, 4488, 4488, 4488, 4488, 4493, 4493,
+4493, 4493, 4493, 4493, 4493, 4493, 4493, 4493, 4493, 4493,
+4493, 4493, 4493, 4682, 4682, 4682, 4682, 4682, 4682, 4682,
+4896, 4896, 4896, 4896, 4901, 4910, 4910, 4910, 4910, 4910,
+4910, 4910, 4910, 4910, 4910, 4910, 4910, 5130, 5130, 5130,
+5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130,
+5145, 5145, 5145, 5145, 5146, 5146, 5146, 5146, 5146, 5146,
+5146, 5146, 5146, 5146, 5146, 5146, 5146, 5414, 5415, 5415,
+5417, 5417, 5417, 5417, 5417, 5417, 5434, 5434, 5434, 5434,
+5434, 5434, 5434, 5434, 5434, 5434, 5434, 5434, 5434, 5434,
+5434, 5787, 5787, 5787, 5787, 5787, 5787, 5787, 5787, 5787,
+5787, 5787, 5787, 5787, 5787, 5787, 5787, 5787, 5787, 5787,
+5787, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+6229, 6229, 6229, 6229, 6229, 6229, 6229, 7538, 7538, 7538,
+7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538,
+7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538,
+7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538, 7538,
+7538, 7538, 7538, 7538, 8500, 8500, 8500, 8500, 8500, 8500,
+8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500, 8500,
+8500, 8500, 8500, 8500, 8500, 9903, 9903, 9903, 9903, 9903,
+9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903,
+9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903,
+9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903,
+9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9903, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968, 9968,
+9968, 9968, 9968, 9968, 9968, 9968, 9968, 12444, 12444, 12444,
+12444, 12444, 12444, 12444, 12444, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485,
+12485, 12485, 12485, 12485, 12485, 12485, 12485, 12485, 12524, 12524,
+12524, 12524, 12524, 12524, 12524, 12524, 12524, 12524, 12568, 12568,
+12568, 12568, 12568, 12568, 12568, 12568, 12568, 12568, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605,
+12605, 12605, 12605, 12605, 12605, 12605, 12605, 12605, 16160, 16160,
+16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160,
+16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160, 16160,
+16160, 16160, 16160, 16160, 16160, 16160, 16160, 16197, 16197, 16197,
+16197, 16197, 16197, 16197, 16197, 16197, 16197, 16197, 16772, 16772,
+16772, 16844, 16844, 16844, 16844, 16844, 16844, 16844, 16844, 16844,
+16844, 16844, 16844, 16844, 16844, 16844, 16844, 16844, 16844, 16844,
+16844, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845, 16845,
+16845, 16845, 16845, 16845, 16845, 16851, 16851, 16851, 16851, 16851,
+16851, 16851, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064, 17064,
+17064, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065,
+17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065,
+17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065,
+17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065,
+17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17065, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066,
+17066, 17066, 17066, 17066, 17066, 17066, 17066, 17066, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067, 17067,
+17067, 17067, 17067, 17067, 17067, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068, 17068,
+17068, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069,
+17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069,
+17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069,
+17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069, 17069,
+17069, 17069, 17069, 17069, 17069, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070, 17070,
+17070, 17070, 17070, 17070, 17070,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.01302, 0.01225, 0.00364, 0.00364,
+0.0024099999999999998, 0.0022599999999999999, 0.0022499999999999998, 0.0017799999999999999,
+0.0017799999999999999, 0.00134, 0.00134, 0.00132,
+0.00131, 0.0011999999999999999, 0.0011999999999999999, 0.00072999999999999996,
+0.00072000000000000005, 0.00068000000000000005, 0.00059999999999999995, 0.00055000000000000003,
+0.00052999999999999998, 0.00051999999999999995, 0.00051999999999999995, 0.00051999999999999995,
+0.00051000000000000004, 0.00051000000000000004, 0.00048000000000000001, 0.00048000000000000001,
+0.00046999999999999999, 0.00046999999999999999, 0.00046000000000000001, 0.00046000000000000001,
+0.00044999999999999999, 0.00044999999999999999, 0.00044999999999999999, 0.00044000000000000002,
+0.00042999999999999999, 0.00042999999999999999, 0.00042999999999999999, 0.00040999999999999999,
+0.00040999999999999999, 0.00040999999999999999, 0.00040000000000000002, 0.00040000000000000002,
+0.00040000000000000002, 0.00040000000000000002, 0.00038999999999999999, 0.00038999999999999999,
+0.00038000000000000002, 0.00036999999999999999, 0.00036999999999999999, 0.00036000000000000002,
+0.00035, 0.00035, 0.00035, 0.00035,
+0.00034000000000000002, 0.00034000000000000002, 0.00034000000000000002, 0.00033,
+0.00033, 0.00033, 0.00032000000000000003, 0.00032000000000000003,
+0.00031, 0.00029999999999999997, 0.00029999999999999997, 0.00029999999999999997,
+0.00029999999999999997, 0.00029999999999999997, 0.00029, 0.00027999999999999998,
+0.00027999999999999998, 0.00027999999999999998, 0.00027999999999999998, 0.00027,
+0.00027, 0.00027, 0.00025999999999999998, 0.00025999999999999998,
+0.00025999999999999998, 0.00025999999999999998, 0.00025999999999999998, 0.00025999999999999998,
+0.00025000000000000001, 0.00025000000000000001, 0.00025000000000000001, 0.00025000000000000001,
+0.00025000000000000001, 0.00025000000000000001, 0.00025000000000000001, 0.00024000000000000001,
+0.00024000000000000001, 0.00024000000000000001, 0.00024000000000000001, 0.00024000000000000001,
+0.00024000000000000001, 0.00024000000000000001, 0.00024000000000000001, 0.00023000000000000001,
+0.00023000000000000001, 0.00023000000000000001, 0.00023000000000000001, 0.00023000000000000001,
+0.00023000000000000001, 0.00022000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00022000000000000001, 0.00022000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00022000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001,
+0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001,
+0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001,
+0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001,
+0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001,
+0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001, 0.00020000000000000001,
+0.00020000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001,
+0.00018000000000000001, 0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001,
+0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001,
+0.00017000000000000001, 0.00017000000000000001, 0.00016000000000000001, 0.00016000000000000001,
+0.00016000000000000001, 0.00016000000000000001, 0.00016000000000000001, 0.00016000000000000001,
+0.00016000000000000001, 0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999,
+0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999,
+0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999,
+0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012,
+0.00012, 0.00012, 0.00012, 0.00012,
+0.00012, 0.00012, 0.00012, 0.00011,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.011842596093748461, 0.011120700950660097, -0.0033105312346679641, 0.0033105312346679637,
+-0.0021914491396917901, 0.0020552496235223486, 0.0019354244404037803, -4.0310465394345564e-05,
+4.0316677172748145e-05, -4.6069500178118828e-05, 4.6093341228467222e-05, 4.9144176573328776e-05,
+-4.8742398322166465e-05, -0.001178279823815259, 0.001178279823815259, -0.00062969299669963705,
+-0.00065541208672588523, 0.00061786468791574735, 0.00052055229018713243, 0.00054336007802753669,
+-0.00023960815007223604, -0.00035453605296727002, 0.00035416953572391558, -0.00048998071655803491,
+0.00035232119860683319, -0.00015989975882566037, -0.00047733583280402004, 0.00047738486909524219,
+0.0001480646070180262, 0.00011474988791207741, 0.00013595989747500515, -0.00014301791426807941,
+0.00043477305795257769, -0.00014207396273627044, -0.00025036761654890192, -0.00019085933373506404,
+0.00042996012826170216, -0.00013026954834201979, -0.0004043613816945173, -0.00012151397746843027,
+-0.00012916084067532736, -0.00012090632626550398, 0.000345014546585889, -0.00017749179275095925,
+0.00024176073038155763, -0.00010843097020431507, -0.0001268237364787007, 0.00038951983738057065,
+0.00011235277629342261, 0.00017294229972913473, -0.0003684009544746772, 0.0002165847562633605,
+-0.00024276369620773459, -0.0003234923233273846, -0.0001167558701920182, 6.7782647188821614e-05,
+-7.5106174708452426e-05, -8.7227863993623157e-05, -0.0003391936118139637, 0.00031390265911873888,
+-0.00031025689412520575, -0.00020435088928826047, -0.00029103571293784302, 0.00029103571293784297,
+0.00030762282049402528, 0.00013859517363858616, 0.00027924173075478655, -6.0529754180528937e-05,
+-9.4531437077144951e-05, -0.00020959790920960759, -0.00024166311270414976, 0.00023845452441345356,
+-0.00018060819534349975, 0.00012965220579073825, -0.00012325375064421503, -0.00013627583562066752,
+-0.0001143467708372266, 0.00025378784899777725, 0.00021737090815876988, 7.5146181997447795e-05,
+-0.0002384869065818693, 5.6663257214146401e-05, -0.00012498132314046567, -0.00011256977842964745,
+-0.00024897583575871762, 0.00011859062276747092, 0.00021015516989305216, 0.00020646682257401597,
+-0.00011773233912519165, -0.00015219876894176379, -5.0391588021410351e-05, 0.00018837532405738752,
+0.00023896740925558103, -0.00019732944853431369, -0.00020953811280522786, 9.2814377798741275e-05,
+-0.00020179516479435194, -0.00019594420762099403, -7.194556199025715e-05, -0.00017959866825201438,
+0.00022953849843836829, -0.0001556447106121932, -0.00016846084528375764, 0.00021654397575620425,
+-7.0285381867326099e-05, 0.00018918341584546233, 0.0001748372884312419, 0.00021257517593570416,
+0.00021642612522876139, -0.00012639033186303005, 0.00021102036625465418, 7.1045792911016191e-05,
+-0.00020731039618321665, 0.00018725810885123373, 0.00011356820060473053, 6.7953995599090384e-05,
+-0.00013728959076401593, 6.7748445963872428e-05, 6.7532377738011378e-05, 8.4456854607960414e-05,
+6.731893772772969e-05, 8.4464404895248117e-05, -0.00018306764004572719, 0.00018306764004572719,
+8.9066102145779987e-06, -0.00019958255129728217, -5.3984785008988589e-05, 0.00018945614107986874,
+-7.4405231349227281e-05, 9.170056605770797e-05, 6.4882878768565626e-05, 0.00010711436650565537,
+7.0528866970519721e-05, -0.00019110808534892462, 6.3919516061772426e-05, -0.00018839545491667267,
+9.7725527442720349e-05, -0.00016333357183556202, -0.00013248592557606659, 0.00012784304037444949,
+0.00017982538699038244, -0.00018962242515413113, -0.00015994460237379171, -6.1734554482656447e-05,
+-0.00017877926122242366, -0.0001879305444138105, 0.00010396854812238677, 5.6631243550676738e-05,
+6.9534237184975777e-05, -0.00011142933546982081, 6.0552073995687885e-05, 0.00017856479192385782,
+-0.00015378014338064447, -0.00017999511288779792, -8.5865909096044272e-05, 0.00015070882108484353,
+-0.00015916245161781125, -1.2273092339253081e-05, -0.00016936845429667567, 8.2081944678928212e-05,
+-0.00016936551829994803, 0.0001360045137510238, 0.00010359278750249185, -0.00010359278750249188,
+-7.7107837843085881e-06, -8.7284776295572705e-05, 0.00015359469486100983, 8.7656300817949071e-05,
+2.6579914911450022e-06, -0.00016008171382760243, 6.7354283251327659e-05, 6.0595730094233014e-05,
+5.4916319297426255e-05, 0.00015973961547106284, 0.00010838851418792742, -0.00010711745626320449,
+-0.00013351592133628045, 7.9454856921313031e-05, -0.00015989838120916382, 0.00014398416343573085,
+-9.8565459696493452e-05, 0.00014216459346076471, 0.00013585414885370779, -7.7338972046177339e-05,
+7.4219391998210905e-06, -5.0556451406158219e-06, 5.0587587822139245e-06, -0.00013502773252664451,
+-0.0001424660641818678, 0.00014773901701035751, -0.00013525940031859637, 3.1565542877855469e-05,
+0.00014387399798874255, 4.9667162495680747e-05, -0.00014505214390713751, 0.00010298477852018716,
+-0.00010514007199701629, -0.00011053868219361776, 9.5111258125016104e-05, 2.475807484797651e-05,
+-2.4758074847976493e-05, 0.00013265009008922829, -0.00011316611752064894, 0.00011188627318469416,
+-0.00013275896048912592, 0.00013103457451265442, 1.5598948567407892e-05, -7.1962102268122098e-05,
+-5.2830241712367556e-05, -5.6011942736617493e-05, -2.4116422172761028e-07, -8.0380801048935907e-07,
+-0.00011332758669497396, 0.00011332758669497396, -0.00011856872217454164, 0.00011250638663796887,
+-0.00010319310277097108, 0.00010322354468769714, 7.8868945783715645e-05, -7.887327079535645e-05,
+-6.3714985016788899e-05, -4.3037176861601998e-05, -1.8067695345804419e-05, -6.3701944892247364e-05,
+-5.9348914834663056e-05, -9.9890765168134034e-05, -5.248030972404761e-05, -8.6559653835270548e-05,
+-2.5991170896709834e-06, 2.5991746694558311e-06, 1.0050877641784092e-05, 9.2934631697750628e-05,
+-8.7574279506661291e-05, -9.728942481201774e-05, 3.6599884683016548e-05, 0.00010653210567159421,
+5.7974543662885541e-05, -8.9776336002302508e-06, -4.7327830940956385e-05, 4.7327830940956412e-05,
+-9.9878987464310009e-05, 8.7614712869395084e-05, -4.0531646525573274e-05, -5.6527422767801442e-07,
+6.878986459860595e-07, 7.0310009608113265e-07, -6.0218246107707456e-06, -5.0359364785718644e-05,
+-8.2270590697017257e-05, 3.4094862559796228e-05, -8.4418256527288036e-05, -5.5303882673721185e-05,
+3.0179488471373729e-05, -7.2943429555650066e-05, -3.0406980654501959e-05, 3.0406980654501925e-05,
+-7.2929555007200225e-05, 8.3653822430837239e-05, -8.0788539168484734e-05, 7.8718372900379142e-05,
+9.6251343855005379e-05, 9.8579747619294129e-05, 9.9708872796971701e-05, 9.9759056755337793e-05,
+-3.8551764413040059e-05, 4.284063557367962e-05, -7.7091561943861165e-05, -6.9248859617400426e-05,
+-7.9439465368111203e-05, 7.9439465368111203e-05, -4.2734987649215641e-05, -7.6947136505106339e-05,
+-8.0980944152420485e-05, 8.0980944152420485e-05, -8.9919786720153288e-05, -8.6361164818763179e-05,
+2.7517168903336122e-05, 8.6854733142364206e-05, -8.437047578337012e-05, -5.3818360678769856e-05,
+8.9999155149098962e-05, 8.5444183577146015e-05, -8.8701954596254206e-05, -6.5353037197017489e-05,
+-8.8028598052444622e-05, -8.9745192402300854e-05, -5.0390749644766893e-05, -5.5712928860747356e-05,
+-5.5998505758354848e-05, -4.552815532175024e-06, 1.905607772246965e-05, -5.479155681903497e-05,
+-3.6425170521278194e-05, 3.6425170521278153e-05, 4.0535569407600542e-06, 5.384636067579671e-05,
+-6.3561013338648122e-05, 6.3561013338648122e-05, 7.9860234275059921e-05, -5.7112779678557676e-05,
+7.7300063976619706e-05, -6.8333122564870695e-08, 3.7397237491756419e-05, -3.7397237491756439e-05,
+7.8700409174095053e-05, -7.2675513126414248e-05, 4.6295089690509885e-05, 7.9838295315929158e-05,
+-7.522996276110739e-05, -5.1889710080662181e-05, 7.6321501696265806e-05, 8.1146644818247856e-07,
+-7.6334849188113577e-05, 7.7115591669972859e-05, -7.7115591669972845e-05, 4.6545686512887861e-05,
+5.4077083831599056e-05, 2.0458932676967206e-05, 7.9368060876063159e-05, 3.9473020443486666e-05,
+-3.2598106293698441e-05, 6.5197296033169921e-05, -7.927403148794875e-05, 7.4343928107738113e-05,
+-4.8703606061364415e-05, -1.6125308166851313e-05, 4.5715082556294156e-05, 6.3691204654280173e-05,
+-5.669013887034912e-05, 5.6690138870349127e-05, 6.9111525229962492e-05, -6.9111775518401771e-05,
+-1.8894674753146006e-05, -1.9755275725806194e-05, 1.9755275725806187e-05, 1.6865092643407935e-05,
+-6.0542994773847386e-05, 3.1802007790589894e-05, 1.7682578886528463e-05, -4.5178967993196165e-05,
+3.3500202464480072e-05, 2.1102496785418797e-05, -4.011119055735914e-05, 4.0111190557359161e-05,
+-5.8955575219087369e-05, -4.7234718774168991e-05, 9.7841935285618942e-06, 3.1830922310677022e-05,
+-4.6409512348408459e-05, -5.9093028435760479e-05, -2.4466607200096978e-05, -2.1926815256946288e-05,
+-5.260206590914235e-05, 3.3231635691273608e-05, 6.9774114685808918e-05, -3.0299637949410602e-05,
+-3.1051327541252992e-06, -9.4745615255247301e-06, -2.0134894900165433e-05, 5.6861235006743866e-05,
+3.8050159950304815e-05, -6.9899226430094851e-05, 6.9899226430094851e-05, -3.3538363979474107e-05,
+-2.0179482875407558e-05, -5.9237119494320848e-06, 2.0179482875407551e-05, -5.5402796763539683e-05,
+-1.8895898187166381e-05, -6.9650580327881303e-05, -6.0357549971717275e-05, -6.8923400202173542e-05,
+-3.3189035975537243e-05, 2.1967698161177923e-05, -6.3430532638702249e-05, 6.6556439374289885e-05,
+-6.5751305613464576e-05, 6.3664062205153144e-05, -6.3664062205153144e-05, -1.5576128465851856e-05,
+6.5745309615065412e-05, -8.9994930263454538e-06, -5.9031802388746223e-05, 5.9031871712949801e-05,
+5.9111204092416426e-05, -3.0529873911148862e-05, -3.4584099164744395e-05, -6.3295475784148951e-06,
+-3.7291718403138857e-05, -8.6290292107984634e-07, 3.8128804635292814e-05, -5.6815548574397554e-05,
+5.9092425101657227e-05, 4.9779893703821992e-05, 5.6884975349031385e-05, -5.2168314643584095e-05,
+4.569578004916233e-05, 5.6580624017894056e-05, 8.1163733111011105e-06, 5.9945772621319925e-05,
+-4.4648179967603703e-05, 4.4648179967603716e-05, 2.2427596997769102e-05, -3.8819477194763388e-05,
+2.5575075832187079e-06, -2.5590037139036552e-06, -1.5039741909104254e-06, -3.047930333922528e-05,
+3.4803384330760039e-05, 2.8180682912143272e-05, -4.996090370562493e-05, -5.5455303139876547e-05,
+-3.6062936872326451e-05, 5.1659963292927116e-05, -3.0803183475525296e-05, 4.6564362840247699e-05,
+5.9892954547682239e-05, 5.5074817851622629e-05, 5.9899977818339065e-05, -5.9987948943343656e-05,
+-5.591287406687933e-05, -5.9941841556391164e-05, -5.0327727082242057e-05, 8.4755340962966568e-06,
+1.8626411023168518e-05, -3.9234915352683093e-05, 3.6234836186013368e-05, 8.5807765780205774e-06,
+-3.3203510399260291e-05, -3.4920336129798363e-05, -1.3031715263150453e-05, 8.7047255674838243e-06,
+-1.8244188392701176e-05, 1.8244188392701155e-05, -5.8472046819929266e-05, 5.2277696226471116e-05,
+-2.0768762389595013e-05, -1.1523859070054337e-05, -2.0534492621237534e-05, -3.3941859040113987e-06,
+-5.6548943510914174e-05, -4.7187255412499623e-05, -1.2018653792643404e-05, 4.0038929701729141e-05,
+-5.3312648173620822e-05, -5.9984237040119616e-05, -4.9733093943941757e-05, -1.20301974075863e-07,
+-3.8508809253706044e-05, 5.9897953169009608e-05, -9.6684185187282926e-06, 1.1341273987390805e-05,
+5.4758332339384799e-05, 6.5624809277831635e-06, 2.1541539085559327e-05, 1.3741687331426637e-05,
+-2.0781691021461833e-05, -5.9947705177140978e-05, -3.7647719402796077e-05, 4.5382548155110272e-05,
+-4.8240797025870493e-05, -1.8967199591013648e-05, 4.1311642049574895e-05, 5.8924819464757424e-05,
+-1.8942787640281873e-05, 3.1525795408277716e-05, 5.8788936671727953e-05, 1.2394127443086893e-05,
+-1.891907778844705e-05, 1.1692970898731809e-05, 6.5407149588708805e-06, 8.5692146482504229e-08,
+-2.8242383759123717e-05, -5.3719231526435175e-05, 5.9773630878907145e-05, 5.7665649103713993e-05,
+-2.1360064081215366e-05, -5.3468784789008536e-05, -5.1019579477127633e-05, -5.3729545292770891e-05,
+-4.9000874470864805e-05, -5.9639366375448977e-05, -5.3965605873919485e-05, -7.6755598157311083e-06,
+-3.4621219576607493e-05, -5.634423346740112e-05, -3.6527704546023313e-05, -5.4569196175845559e-05,
+5.4569196175845553e-05, -1.2093981125138484e-05, 5.3832348614040774e-05, -5.9959872674932595e-05,
+-5.590355416539546e-05, -2.494614627268282e-05, -3.0713371695722055e-05, 3.0783094396351988e-05,
+4.1693958757775796e-05, -4.1693958757775823e-05, -4.7374613601666138e-05, 4.741224931632661e-05,
+4.9928147546161033e-05, -1.8163146921078038e-05, 4.968705992054084e-05, -3.0145049840833734e-05,
+4.4585264012198511e-05, -4.8364087333276407e-05, 4.7489878592822436e-05, -4.7489878592822436e-05,
+4.2976374132711672e-05, 3.1223159638941544e-06, 4.232203263245693e-05, 4.3725784744392914e-05,
+1.1321245066723041e-06, 1.1321245066723041e-06, -4.5696954421098947e-05, -3.4789604376862076e-05,
+-2.5653014511088142e-05, -2.5653014511088142e-05, 2.784852104206576e-05, -5.9759523406458984e-07,
+-4.8641310627733378e-05, 4.2260260919839817e-05, -4.4417778333226583e-05, 4.5126397288868675e-05,
+-9.735865408492842e-06, -2.0254103363738907e-05, -4.4893605458930169e-05, -4.2641147725816863e-05,
+7.1506471483504812e-06, 2.7474206989944178e-05, -1.0514305889687919e-05, -4.8431939077274748e-05,
+-4.9961440162534654e-05, 7.3745981503479323e-06, 4.3268792433323604e-05, 1.0214423553504714e-05,
+-2.2598307316275803e-05, -3.7354471251496053e-05, -4.3297181176432718e-05, -2.5781332240452705e-05,
+-3.5857702106645771e-05, -1.9564772399264046e-05, 2.5882776447458856e-05, 2.1383097384570843e-06,
+-1.9653444512477635e-05, -1.9761260042536813e-05, 4.0972559288850401e-06, -1.5410558241863312e-05,
+-1.3864433081174375e-05, 2.1897652154432413e-05, -4.8976105856903341e-05, 4.8976105856903341e-05,
+-1.7428365165344828e-05, -4.9135802415115686e-05, -1.7380408738922299e-05, -4.7111408587831737e-05,
+-1.5594336129265962e-05, 1.5368486922521437e-05, -1.0026037169192645e-07, 4.9146754615202885e-05,
+-4.7749389910252251e-05, -1.7340152859118487e-05, -4.716572835368053e-05, -2.6148778993966376e-05,
+-4.5875203808481048e-05, 4.2447528315331162e-05, -1.1740412464965092e-05, 7.3842304353409857e-06,
+-4.8609471020412908e-05, 4.7326669426532864e-05, -4.9582910471318083e-05, -4.2734452803325306e-05,
+3.3583016786386531e-05, -4.8786937534202057e-05, 4.8821215537209925e-05, 1.580920364913697e-05,
+4.9986566500347241e-05, 4.9635089863736571e-05, -8.7694023307171782e-08, 1.6405738842048662e-05,
+-1.6405738842048645e-05, 9.4585768487117773e-06, 4.943820655371796e-05, -1.5031145188696078e-05,
+4.7181394041465799e-05, -1.5747387881871306e-05, -1.7798381630033068e-05, 3.7004791819729664e-05,
+-1.5730507072414402e-05, -8.7300073663273301e-06, 6.0580363514780883e-08, -2.5709860148185971e-05,
+-4.6461886134801179e-05, 4.9183872314456467e-05, -4.0413408289481211e-05, -3.1957520271851899e-06,
+-9.109931456873936e-06, -1.8016521301810823e-05, 1.5755695026736011e-05, -3.9165671978265636e-05,
+-3.11623859855019e-05, 3.1162385985501927e-05, -4.5149651511686334e-05, 1.5682015455878615e-05,
+4.6998226338557698e-05, -1.8932220868947698e-05, 3.0192920615927498e-06, -4.7020136500944744e-05,
+3.4893854620047364e-05, -4.5311549354188523e-05, 1.8210576678265622e-06, -1.5738699235023152e-05,
+4.6612181088119516e-05, 4.6976549231631941e-05, -2.3666109366010188e-06, -1.1650569535215759e-05,
+4.7006946205903245e-05, 1.2352800373553422e-05, -4.9988851760928156e-05, -4.9988851760928156e-05,
+4.2313010791052005e-06, -4.6941470117256806e-05, 3.9017651571681757e-05, -4.5474330146537968e-05,
+4.5474330146537962e-05, 3.0771117889523053e-06, 1.5659781551554482e-05, -4.4756557277147215e-05,
+2.8242078232341722e-05, -2.5922703062500718e-05, -3.7395380263018428e-06, -4.6077302242157178e-05,
+5.148827996149232e-06, 4.9647012655865485e-05, -4.8869970227514001e-05, -1.5768929141366241e-05,
+2.2427959038347252e-05, 1.9952253925525227e-05, 2.7823529155333887e-05, -2.163617217375559e-05,
+2.16361721737556e-05, 2.03258553583344e-05, 2.03258553583344e-05, 3.294714423294256e-05,
+3.1168297639479273e-06, -2.1581441210265702e-05, 2.7809933599119837e-05, -2.979930659759732e-05,
+2.4672237259393993e-05, -3.2507457410495283e-05, 1.8903187284437089e-05, -1.8903187284437076e-05,
+-3.9564283007746425e-05, -3.9564283007746425e-05, 5.3120458584137199e-06, -3.6173910950781306e-06,
+-9.3430845303220955e-07, 3.6173910950781433e-06, 3.3315238501601249e-05, 3.9791197962739076e-05,
+-3.9791197962739076e-05, -3.9930407232086396e-05, -3.8553925470710085e-05, 3.4398502617263725e-05,
+-3.7024017320515664e-05, 3.7656663270930949e-05, -3.7656663270930956e-05, -1.069047428075738e-06,
+-3.3729125681640749e-05, 3.3729125681640749e-05, -3.9945019410146909e-05, -3.9822543621175459e-05,
+-3.9822543621175459e-05, 3.990867801437629e-05, -1.9169761164999051e-05, 3.0170531943137604e-05,
+-3.1019155341706311e-05, 1.4958957433390026e-05, 3.9979781915769069e-05, 3.9280339229651419e-05,
+-3.9280339229651419e-05, -1.9107783601347711e-05, -1.3481720374975526e-06, 1.3490023419237134e-06,
+8.2583810245160127e-07, -8.2583810245162392e-07, 3.4358513842864219e-05, -3.1463089643373176e-05,
+-3.0394224200847429e-05, -3.9973099668232291e-05, 3.9973099668232291e-05, -3.7808188213054518e-05,
+3.8039001738861835e-05, 3.0599877696885768e-05, -3.0599877696885768e-05, -3.4610726492832569e-05,
+-2.001908417832899e-05, -3.69907074235117e-05, 7.7846726916386157e-06, -7.7846726916386208e-06,
+2.8847340470879897e-05, -1.4562006648984823e-05, -1.3118108176006024e-05, -3.6782492867461939e-05,
+-7.9209246465968945e-06, -2.637735963772266e-05, -3.8380412802613141e-06, 3.838041280261309e-06,
+1.8558866441242833e-05, 1.8558866441242833e-05, 3.2159277652498203e-05, -3.0356068170826272e-05,
+3.0356068170826293e-05, 3.9992165763770019e-05, 1.0426742244977554e-06, 1.0426742244977554e-06,
+-3.5873714617299777e-05, 1.2546752556128523e-05, -1.2546752556128537e-05, -1.3962340271777116e-05,
+1.3962340271777104e-05, -3.5693294596241599e-05, -3.3311919101494341e-05, -2.0846200866120334e-05,
+1.7914395973423625e-05, 3.4637744941146164e-05, -1.5491018559770053e-06, -1.7548580054628196e-05,
+-1.184151277857375e-05, 8.0522052953770593e-06, 3.4666769365089747e-05, -3.4568171210105598e-06,
+-1.7422171942581684e-05, 2.7513975787341457e-05, 2.080506760275007e-05, 1.9037698430433097e-06,
+-1.1799428077808519e-05, 3.9575005712929858e-05, 3.5058302560330179e-05, -3.5058302560330179e-05,
+9.8871447755292407e-06, -1.7508336496568151e-05, 1.7285432046702303e-05, -3.1180411661152157e-05,
+-3.8529006098620412e-05, 3.8529006098620412e-05, 3.9507878673193463e-05, 2.937248808772373e-05,
+-2.0662600449377702e-05, 3.7674122604032868e-05, 1.1899933990085866e-05, 3.8626576778801578e-05,
+-1.1899933990085853e-05, 3.3831537840985861e-05, -5.8540673222622171e-06, 2.3108293493956029e-05,
+5.8540673222622383e-06, -2.6952777646002058e-05, 2.6952777646002072e-05, 5.9970757708397575e-06,
+2.781734921637771e-05, 7.9621867895261512e-08, -1.2507356374981338e-05, -3.8985432357894936e-05,
+2.2013476707520983e-05, -2.2013476707520996e-05, -3.6255158134209196e-05, 2.4853679569693979e-05,
+3.63611775919511e-05, 8.8021568040997455e-06, 3.2316275548544885e-05, 2.808305989569046e-05,
+-2.8083059895690464e-05, -1.1033513485605843e-05, 3.1277536999445208e-05, -2.3876572643378374e-05,
+3.4250232615497854e-05, 2.7304254409125667e-06, -3.6512745613695757e-05, -3.5227457785441723e-05,
+-1.349622544234537e-05, 3.4754426545214195e-05, 3.2639604529475663e-05, 3.1722672216194152e-05,
+3.9056872966001258e-05, -3.9056872966001258e-05, 1.5853419481582569e-06, -1.5849094465023126e-06,
+-3.6720649218308359e-05, -3.8500298942808314e-05, -1.3517943418120515e-05, 2.7613302581647538e-05,
+3.765427529856683e-05, -3.1882799211046339e-05, 1.8967204099721702e-05, -1.8543446975815323e-05,
+3.7627683464530587e-05, -3.87147839026317e-05, -3.0762818311143247e-05, -2.3788825756876316e-05,
+2.3788825756876322e-05, -3.555723198905993e-06, 3.5557231989059621e-06, -2.6144222130720639e-05,
+-3.8503911913959168e-05, -6.3459820216079678e-06, 6.3459820216079636e-06, 3.9248109624274022e-05,
+3.9999658405532847e-05, -3.7149434811776536e-05, -3.8466996569721311e-05, 3.1100950833723453e-05,
+-1.3132484782374995e-05, -3.8889957748113171e-05, 4.8159734771522105e-06, -4.8159734771522063e-06,
+-3.7622977378255301e-05, 3.7622977378255308e-05, -7.4342515611703689e-06, -3.9066763702559385e-05,
+3.0928986293731283e-05, 2.7123415997269703e-05, 3.9993926311980884e-05, 3.9993926311980884e-05,
+3.9890542752243376e-05, -3.4870026675376612e-05, 3.4870026675376612e-05, -3.7615012250652781e-05,
+-2.5846142063974594e-05, -3.9348276917091183e-05, 9.7940183234164563e-07, 3.0775598686514937e-05,
+-1.7188325976851112e-05, -3.9862260280381326e-05, 9.9652875764072635e-07, -3.7645488071743106e-05,
+-3.4020402501091907e-05, 3.7590037117733072e-05, -3.7590037117733065e-05, 1.9199619046979809e-05,
+-2.7840366969340851e-05, 2.6837084410643623e-05, -1.2582059742275999e-05, -3.8669287920424629e-05,
+3.3838582952964255e-06, -1.9215681665643472e-05, 1.9458697664756823e-05, -1.9935400087135589e-05,
+3.7598404760553384e-05, -1.7165224957110247e-05, -3.8829573111392074e-05, 1.3014355835936852e-05,
+-2.4351803030682208e-05, -3.6379464117230377e-05, 3.6379464117230371e-05, 2.86614732295267e-05,
+-8.0626540834256564e-06, 1.4295128425129446e-05, -3.7372821777608433e-05, 3.4777686582577334e-05,
+3.4909557941339472e-05, -3.7480102699818898e-05, 2.986841579786623e-05, 1.2510081788395994e-05,
+3.5526513481491239e-05, -3.5526513481491239e-05, -3.6467017163439739e-05, 1.7862762057319709e-05,
+-3.6664926628351002e-05, -1.3342988344183849e-05, -1.70767092162472e-05, 1.7076709216247186e-05,
+-1.2628293244347328e-05, 1.2628293244347323e-05, 1.8369701987210297e-21, -2.7318915459993051e-05,
+1.4151616852747942e-05, -1.4151616852747945e-05, -1.7168996573036624e-05, 1.7168996573036613e-05,
+-2.0240088772360552e-05, 2.0240088772360539e-05, 2.8432932053215842e-05, -2.8432932053215849e-05,
+-1.1044719969932462e-05, 2.9494579670339526e-05, -2.9494579670339526e-05, 2.8449764482022864e-05,
+-2.8449764482022864e-05, 2.9984026927178745e-05, 2.9891728516637433e-05, -1.5520808272430977e-05,
+1.5520808272430964e-05, 1.6638902665234977e-05, 1.6638902665234977e-05, -2.7724724169381414e-05,
+-8.6002362392756263e-06, -2.8474215024586439e-05, 2.0213612133597033e-05, -1.9172785974317923e-05,
+2.8410834450329846e-05, -2.8410834450329842e-05, 2.9485808065542034e-05, -2.9485808065542037e-05,
+2.9190357277878547e-05, 2.848195370191638e-05, 1.171284316725333e-05, 1.171284316725333e-05,
+-1.4149765472366025e-05, -2.5117209203676667e-05, 2.9962689961558043e-05, -2.9962689961558043e-05,
+-2.5285097712933223e-05, -2.662634141864092e-05, 2.8989865536916112e-05, -2.2986337208463463e-05,
+-2.9238837547118049e-05, 2.9238837547118045e-05, -8.576217136174787e-07, 8.5762171361747499e-07,
+-2.8353204784532804e-05, -2.30499635902259e-05, 2.947168698470565e-05, -2.947168698470565e-05,
+2.0002761030641347e-05, -2.000276103064134e-05, 1.3420711011018774e-05, -1.3420711011018777e-05,
+1.32237483569063e-05, 2.4952965879129371e-05, 2.9964624485595512e-05, -2.9964624485595512e-05,
+2.4396865754413409e-05, -2.4396865754413406e-05, 1.3537747190974763e-05, -1.1213798498884561e-05,
+1.1213798498884551e-05, 2.856245208446919e-05, -2.8562452084469183e-05, 4.0906291114264706e-06,
+-4.0906291114264943e-06, -2.3025114535659268e-05, -2.5847171216641808e-05, 2.5847171216641801e-05,
+-1.7604816649394392e-05, -1.7604816649394392e-05, 9.0092566096484288e-07, -9.0092566096483992e-07,
+2.5290852971438466e-05, -2.5290852971438469e-05, 2.8282782278951941e-05, -2.8282782278951945e-05,
+-1.454727892516934e-05, -1.1240756194119959e-05, 4.1218842134732277e-06, -4.1218842134732243e-06,
+2.3004042051433054e-05, -2.3004042051433057e-05, -1.539638368506634e-05, -1.5686763644409218e-05,
+1.5686763644409225e-05, -1.5443588079090413e-05, 1.1788494221419059e-05, 2.8100250025898076e-05,
+-2.8358161110031845e-05, 4.1552452730638966e-06, -4.1552452730638805e-06, 1.958633054462674e-05,
+-1.958633054462673e-05, 2.2948980903970751e-05, 1.5446626962961735e-05, -1.4876383955564416e-05,
+-1.2400573360956048e-06, 1.2400573360955945e-06, -2.7094139865626573e-06, -2.7094139865626573e-06,
+1.6780713617643343e-05, 1.3146456367615159e-05, 2.5153761496717864e-05, -2.9415029620993384e-05,
+-2.9415029620993384e-05, -2.4558438179398491e-05, -3.4630521790693553e-06, -3.4630521790693553e-06,
+-2.3056343194745725e-05, -2.6778008924983643e-05, 2.9987187247459772e-05, -2.9987187247459772e-05,
+-2.5889140231118183e-05, -2.8735260074820334e-05, 2.8735260074820338e-05, 1.3775885110518008e-05,
+2.9964780392613022e-05, -2.9964780392613022e-05, -2.5600517700927522e-05, 8.536629600471536e-06,
+8.536629600471536e-06, -9.8193422904109389e-06, -1.6601755199630146e-05, -2.2945311377876802e-05,
+-2.5938102123814509e-05, 2.5938102123814509e-05, -1.2249541002397561e-05, -1.2249541002397561e-05,
+-2.4758660408625754e-05, 2.4758660408625758e-05, 1.0474493064316467e-05, -2.2907028958711781e-05,
+2.2907028958711764e-05, -2.5948217148061972e-05, 2.5948217148061969e-05, -1.7345073145811393e-05,
+-1.7345073145811393e-05, -1.3831415037926333e-05, 2.4551233660658407e-05, 2.4613046211740041e-05,
+2.4551233660658407e-05, -2.4613046211740045e-05, -5.1671881367858098e-06, 5.1671881367858124e-06,
+-1.9808584551827462e-05, -1.8215987961432632e-05, 4.4247640689317812e-06, -4.4247640689317981e-06,
+-2.6500966112245509e-05, 2.6500966112245499e-05, -1.1651517843101894e-05, 1.1651517843101884e-05,
+1.0624005852994326e-06, -1.0624005852994229e-06, -1.8261580032089589e-05, 2.9995327103682268e-05,
+-2.9995327103682268e-05, -1.1690231451012835e-05, 1.1690231451012845e-05, -1.5468799344271622e-05,
+1.5468799344271609e-05, -1.1618263919827538e-06, 1.161826391982757e-06, -1.6722630139613117e-05,
+1.4856941876538795e-05, -1.4856941876538798e-05, -2.1559294602854191e-05, 2.2076837013686145e-05,
+8.7247630153802332e-06, -8.7247630153802298e-06, 2.6049240113283353e-05, 1.5786667045097009e-05,
+2.6082877614073886e-06, -2.6082877614073924e-06, 1.6264984430545516e-05, -1.626498443054553e-05,
+2.6448260261414902e-05, -2.6448260261414902e-05, -2.8125822531445098e-05, -2.8125822531445098e-05,
+2.8496203356571653e-05, 1.1346464833100728e-05, -2.9997736201421312e-05, 1.2060389383540249e-05,
+-1.2060389383540253e-05, -6.0491325554082589e-08, 5.8755449289508955e-06, -9.5906213943697888e-06,
+-2.998566247794411e-05, 6.0338404363864777e-06, 2.7814893819366271e-05, 2.8883603139400885e-06,
+-2.4213651164751328e-05, 2.4213651164751324e-05, 9.5136527359493861e-06, -9.5136527359493844e-06,
+-2.2261370784736199e-05, -8.1408600673152796e-06, 1.0403418901148878e-05, -1.0403418901148861e-05,
+2.4377114416310828e-05, -2.4377114416310814e-05, 2.8734110552753427e-05, -2.8794906655464809e-05,
+5.4128448512164553e-06, -5.412844851216446e-06, -2.8499488604738649e-05, 2.8499488604738652e-05,
+2.9917702167646549e-05, 2.8228189175229767e-05, 2.4153057774082546e-05, -2.415305777408255e-05,
+1.62068439029966e-05, -1.6206843902996614e-05, 9.5060746925382247e-06, -9.506074692538228e-06,
+-2.8259741793821296e-05, -2.8259741793821296e-05, -2.2156336249295866e-05, -1.5897870990324976e-05,
+1.5897870990324973e-05, 1.7553639100984719e-05, 2.2012771071199514e-05, -1.2970858937872826e-05,
+1.0116811135261054e-05, 9.4955109868575478e-06, -9.4955109868575377e-06, -9.4955109868575377e-06,
+9.4955109868575478e-06, 1.5976486477596268e-05, 1.613637901373927e-05, -1.6136379013739274e-05,
+-2.9051630173336768e-05, 2.8451055108553919e-05, 3.8168876557281235e-06, -2.9991898218216319e-05,
+2.9982684027561008e-05, 2.9982684027561008e-05, -2.4946988223478504e-05, -2.1482210265237329e-05,
+2.4946988223478493e-05, 2.8529176814436926e-05, 2.3957552691219134e-05, -9.4835997955068242e-06,
+9.4835997955068107e-06, 2.4815786538387269e-05, -2.4815786538387273e-05, 1.2872339087594373e-05,
+-1.2872339087594376e-05, 2.6545890793316265e-05, 2.9993998687747635e-05, -2.1360865938247918e-05,
+-2.9993998687747638e-05, 2.1360865938247925e-05, -2.9537986983822974e-05, 2.9801902082920919e-05,
+-2.9801902082920919e-05, 2.5861605649106593e-05, -8.9494360835419752e-07, 8.9494360835421383e-07,
+-2.425206461125581e-05, 2.4794836631513281e-05, 2.6060447350872835e-05, -2.6060447350872838e-05,
+2.4221689008395959e-05, -2.4567399479356726e-05, 2.4567399479356733e-05, -7.5476129379586342e-07,
+-7.5476129379586342e-07, 9.4293078746304247e-06, 2.8792850496845634e-05, -2.8792850496845637e-05,
+-1.6677023093411626e-05, 8.8912666440314737e-06, -8.8912666440314838e-06, 2.5817795271253392e-05,
+-1.5119840536969847e-05, 1.6142818592576959e-05, -1.6142818592576948e-05, -9.7345268230214834e-06,
+2.8234786781760312e-05, 2.6840580950674178e-05, 2.3974304908720838e-05, 1.7627520719077821e-05,
+-1.804407433914273e-05, 2.8728592069649706e-05, -2.8728592069649706e-05, 2.8296691912748249e-05,
+-2.8296691912748249e-05, 2.828468323189836e-05, -2.8176464191071888e-05, -2.8176464191071888e-05,
+2.9543277413545072e-05, 2.6533134980600446e-05, 8.8775685946994677e-06, -8.8775685946994727e-06,
+-2.9999847448037389e-05, -2.6430847393087509e-05, 2.6430847393087509e-05, -1.8333019606427815e-05,
+4.8609287463800563e-06, -4.8609287463800724e-06, 2.839693562933694e-05, -2.8396935629336943e-05,
+2.8596367491794386e-05, 2.8820567690978321e-05, -2.9052754412294783e-05, 2.9052754412294786e-05,
+5.6496372662152738e-06, -5.6496372662152831e-06, -2.6590247058682517e-05, 2.6590247058682527e-05,
+-3.594769262870976e-06, 3.5947692628709722e-06, 2.7124807662725352e-05, 1.8580584867424617e-05,
+1.1448302191020159e-05, -1.1448302191020155e-05, 2.9219680086821798e-05, 9.6230466353306502e-06,
+-2.6734392394504268e-05, 2.6734392394504264e-05, -2.9151400855915511e-05, 9.4531437077144981e-06,
+-9.4531437077144964e-06, -9.4531437077144964e-06, -1.0506883529423046e-05, -1.0506883529423046e-05,
+2.7337666508194996e-05, -1.066985888453653e-05, -9.8820830605005835e-06, -2.3052500323990655e-05,
+-2.2863004182430443e-06, -2.6162224228498929e-05, 9.4147277833619689e-06, -9.4147277833619723e-06,
+2.8207634934368706e-05, 1.3449273368670387e-05, -1.3449273368670402e-05, 1.6434027706324061e-06,
+-1.643402770632403e-06, 4.0915627845887222e-06, 2.8198935803134619e-05, -2.8198935803134626e-05,
+1.4624009834002935e-05, -8.8451032763278575e-06, 8.8451032763278473e-06, 3.8357234836130174e-06,
+-3.8357234836130275e-06, 9.6471701882493009e-06, -9.6471701882493042e-06, -2.7451059141435033e-06,
+2.7451059141434999e-06, -1.1844244785113143e-05, 1.0925381850798158e-05, 1.6549450361595985e-05,
+-1.6549450361595968e-05, -2.0082461565602225e-05, -2.728459808792278e-05, -2.728459808792278e-05,
+-2.728459808792278e-05, 2.7284598087922776e-05, 2.7284598087922776e-05, 2.7284598087922776e-05,
+-4.387831178067013e-06, 2.7544384713073978e-05, -2.9117482495449169e-05, 1.6876694228637673e-05,
+2.9613066813244793e-05, 2.8158890775084571e-05, -2.6759661076614039e-05, 2.1614881339466336e-05,
+1.0939346570192432e-05, -1.5821590265710089e-05, -1.2980055262620622e-05, 1.2980055262620619e-05,
+2.058641759436146e-05, 2.058641759436146e-05, 2.8906197380849387e-05, 2.8906197380849387e-05,
+3.3617067588999802e-06, 2.9708530822027122e-05, -2.9708530822027122e-05, 2.5822638085002372e-06,
+-1.9977857804995816e-05, -1.9657761789315401e-05, 1.9657717421426989e-05, 1.6784919140952531e-05,
+-1.7407488622580386e-05, 1.5794052495861141e-05, -1.1622895398555905e-05, 1.1622895398555902e-05,
+-3.3496538147448251e-07, -3.3496538147448251e-07, -2.6687037593197531e-07, -1.0212923282655656e-05,
+-2.6687037593197531e-07, -1.9667492707860486e-05, -1.9667492707860486e-05, 1.9662652303324344e-05,
+1.9662652303324344e-05, -4.5648933553727003e-06, 1.340698349554873e-05, 9.5798251014435196e-06,
+-9.5798251014435366e-06, 1.796040869484772e-05, 1.2901694991960065e-05, -1.6786593024373855e-05,
+1.3986728624437284e-05, 1.3986728624437284e-05, 1.676146207086623e-05, 4.3006281773484727e-06,
+-4.300628177348471e-06, -1.7564496335943265e-05, -2.151432769147222e-06, -5.7637348367835801e-06,
+1.5359049604043002e-06, -1.5359049604043028e-06, -1.8507506632101256e-05, 1.8507506632101246e-05,
+1.5799687213719553e-05, 9.5891405513907867e-07, -1.9671176685683366e-05, -1.9671176685683366e-05,
+1.9658248362848263e-05, 1.9658248362848263e-05, 1.7129007999142681e-05, 1.7129007999142681e-05,
+-5.3165638732411272e-06, -5.3673275854289111e-06, -1.0995905758489103e-05, 1.6422470187152738e-05,
+-1.6422470187152735e-05, 1.7322860507492592e-06, -9.4065538916584042e-06, -9.4065538916584042e-06,
+-1.9330415851515779e-05, 1.9330415851515779e-05, 1.014377663845276e-05, 1.014377663845276e-05,
+3.3355194888013982e-06, -1.9200535978853404e-05, -1.3379937429715798e-05, -1.3379937429715798e-05,
+1.5360480923245148e-05, -1.5360480923245145e-05, -5.3904597777400332e-07, -5.3904597777400332e-07,
+-1.6866983000221858e-05, 1.7978900481698833e-05, -1.7978900481698836e-05, -1.863170622361045e-05,
+1.6772962673544262e-05, 1.0684025484236733e-05, -1.8932053571280767e-05, 1.8932053571280761e-05,
+5.6610090727685015e-06, 5.6610090727685015e-06, 1.9608006621614687e-05, 1.9608006621614687e-05,
+-1.651845779169146e-05, 1.6518457791691457e-05, -1.9592386801704756e-05, 1.9738734766347446e-05,
+-1.9738734766347449e-05, -9.1692407376051585e-06, -1.923888421198186e-05, 1.9972927806381214e-05,
+1.9972378919073965e-05, -1.9972378919073965e-05, 1.4105741234861272e-05, 9.4668970233834275e-07,
+-9.4668970233834519e-07, -1.9775127620940118e-05, 1.9775127620940118e-05, -1.7614706031590821e-05,
+1.7614706031590818e-05, 1.6772926563001688e-06, -1.6772926563001667e-06, 9.2477852405986283e-06,
+9.2477852405986283e-06, 1.785817562333268e-05, -1.9952265795163363e-05, 1.9952265795163363e-05,
+2.989861270477125e-06, 1.3223152573443712e-05, 1.3206457048246379e-05, -1.3223152573443707e-05,
+7.1383012920369077e-06, -7.1383012920369052e-06, 1.023564272006958e-05, -1.0235642720069585e-05,
+5.4500932193480706e-07, -5.450093219348095e-07, 1.8035268727972969e-05, 1.8035268727972969e-05,
+1.599971047576587e-05, 7.0156814551234201e-06, -7.0156814551234218e-06, -1.9563603496739712e-05,
+-1.9563603496739712e-05, -1.6214416936076272e-05, -1.6214416936076272e-05, 1.8243685618369154e-05,
+-1.9531837876842669e-05, 1.8243685618369154e-05, -1.9531837876842669e-05, -8.4805269705776313e-06,
+-8.4805269705776313e-06, -2.860262314117543e-06, 2.8602623141175405e-06, -6.1392162346632681e-06,
+6.1392162346632741e-06, -1.5168225755019733e-05, -1.5168225755019733e-05, 4.4282365536453425e-07,
+-4.4282365536454558e-07, -1.7106744511555872e-05, -8.1455130317006611e-06, -8.1455130317006611e-06,
+-1.0087161735412261e-05, 1.0087161735412259e-05, -1.2198057354357995e-05, 1.2198057354357995e-05,
+-1.9447008828571539e-05, -1.9447008828571539e-05, -1.6287139384806118e-05, -1.6287139384806118e-05,
+3.0057058387206612e-06, 3.0057058387206612e-06, -1.4316265572853764e-05, -6.7552460645090248e-06,
+-6.7552460645090248e-06, -1.1072613273381022e-05, 1.1072613273381021e-05, -1.0995028104050959e-05,
+-1.0995028104050959e-05, -1.0454414519019758e-05, 1.0454414519019765e-05, -4.0352383113519046e-06,
+4.0352383113519105e-06, -7.9543385618248295e-06, -7.9543385618248295e-06, 1.0698159287569764e-05,
+1.0698159287569764e-05, -1.4793679019531053e-05, 1.4793679019531053e-05, 7.0297061190766494e-06,
+7.0297061190766494e-06, -4.1779633955019542e-06, -8.635623123891969e-06, -4.1779633955019542e-06,
+8.6356231238919791e-06, 1.3483962582260192e-07, -1.3483962582261767e-07, 1.3897773518445494e-06,
+6.6722148362972504e-06, 1.4639354493929586e-05, -1.4639354493929589e-05, -1.9524775608316899e-05,
+1.9524775608316902e-05, 6.2188834782899786e-06, -6.2188834782899854e-06, 4.0041316949822304e-08,
+-4.0041316949820305e-08, -4.0041316949820305e-08, -4.0041316949820305e-08, -1.9007167248196787e-05,
+1.9818475496439507e-05, 1.9818475496439507e-05, 1.9443805575492435e-05, -1.9443805575492435e-05,
+1.9443107226846288e-05, -1.9443107226846292e-05, 1.5258199312189317e-05, -1.5258199312189319e-05,
+-1.9610363340229977e-05, 3.4959795305477734e-06, -3.4959795305477717e-06, -1.7314221471863869e-05,
+-1.6787801692789083e-05, 1.7314221471863869e-05, 1.6787801692789076e-05, -1.2906930047708652e-05,
+1.7972615181996792e-06, 6.0910256395552878e-06, -2.9206833087221611e-06, -5.6067872633151347e-06,
+-1.3444653893079554e-05, -1.2496289034688202e-05, -5.8540031957792686e-06, 1.3464736818515669e-05,
+-1.8159034177327116e-05, -1.8159034177327116e-05, -1.9250784681876957e-05, -1.9250784681876957e-05,
+-1.7575932499861189e-05, -1.4134941261196256e-05, -1.7575932499861189e-05, 1.9443820290136489e-05,
+-1.9443820290136489e-05, -1.6353999338359217e-05, 1.6353999338359217e-05, 1.9442589319655563e-05,
+-1.9442589319655566e-05, 9.9485226819039825e-06, -9.9485226819039808e-06, 1.8215155305625772e-05,
+1.0811126989682393e-05, -1.0811126989682394e-05, 8.8130748756232121e-06, -9.424920761150591e-06,
+6.8846592546425017e-06, -1.1723963286621398e-05, 1.1724509087596975e-05, 1.1723963286621398e-05,
+-1.1724509087596975e-05, -6.4768589340273838e-06, 1.9443785955668518e-05, 4.2923848277938417e-06,
+-4.29238482779384e-06, -1.88353916152991e-05, -1.88353916152991e-05, -1.64768315110263e-05,
+1.64768315110263e-05, 1.63398313040927e-06, -1.6339831304092723e-06, 8.0917626559239985e-06,
+8.0295990156607218e-06, -8.0917626559239968e-06, 1.8701027930000143e-05, -1.8701027930000143e-05,
+1.8371795542965621e-05, 3.8847514063378197e-08, -1.8371795542965621e-05, 3.8847514063378197e-08,
+1.9422994466485388e-05, -1.9339720237050971e-05, 1.9803672484644644e-05, -1.9803672484644644e-05,
+7.4600860038040969e-06, 7.4600860038040969e-06, 1.6108980002192084e-05, 1.9443750802630797e-05,
+-1.9443750802630797e-05, 1.1020074505829655e-05, 1.1020074505829655e-05, -1.7005922098182573e-05,
+-1.7005922098182573e-05, -6.2873783063263516e-06, 6.2873783063263491e-06, 1.8762781431990768e-05,
+-1.8762781431990771e-05, 1.9131969021378987e-05, 1.7369367553991521e-05, -1.9131969021378984e-05,
+1.7369367553991521e-05, -8.1173083411368016e-06, 1.1102257592272445e-05, -1.1102257592272438e-05,
+-2.7633737791122784e-06, -2.7633737791122784e-06, -1.7286853169927061e-05, -1.8582442336387973e-05,
+-1.7286853169927061e-05, 1.8582442336387976e-05, 1.9999130297528331e-05, -1.9999130297528331e-05,
+-1.6671880296542573e-05, -1.6671880296542573e-05, 7.4848006508923318e-06, -7.4848006508923385e-06,
+1.868983895440928e-05, 1.868983895440928e-05, -1.7185568360854477e-05, 1.7185568360854477e-05,
+6.650017860830309e-06, -6.6500178608303115e-06, 1.190632215925298e-05, -1.1906322159252984e-05,
+-6.1042703208027798e-06, 5.8912517285634362e-06, 6.2927362848906211e-06, 1.1415217230740994e-05,
+-1.636794446313833e-05, 6.4647240349669871e-06, 1.0834839047046802e-05, -1.0834839047046798e-05,
+-1.0907443372036811e-05, 1.9444098197365951e-05, 4.2273284106002089e-06, 1.650566321700591e-05,
+1.9769852391486218e-05, 9.2805896836454184e-06, 9.2805896836454184e-06, 1.98841707799693e-05,
+1.564765099075605e-05, -1.564765099075605e-05, -1.8782057778165831e-05, 1.9938638825613591e-05,
+5.9109630840866584e-06, 5.9109630840866584e-06, 8.2428644574009918e-06, -1.1552542575282069e-05,
+-1.1552542575282069e-05, -1.9963169456791246e-05, 6.5469208492006262e-06, 8.450460694350341e-06,
+-6.5469208492006245e-06, -8.4504606943503258e-06, 1.9021054817387554e-05, -1.9021054817387554e-05,
+-1.2165075669860798e-06, 1.2165075669860862e-06, 1.8815404437960273e-05, -1.8815404437960273e-05,
+-9.6529690621756208e-06, -1.4721023904729168e-06, 1.4721023904729098e-06, 1.9642121408720929e-05,
+1.9221883034571331e-05, -5.8191535633950214e-07, 5.8191535633949525e-07, 1.9010570550244954e-05,
+-1.9010570550244954e-05, -1.4128600570701906e-06, -1.4128600570701906e-06, -6.2861853672319998e-06,
+-6.2861853672319998e-06, -5.3939879365697692e-06, 5.3939879365697785e-06, 1.9170693568268483e-08,
+1.9170693568268483e-08, 1.9229326428850271e-05, 1.9229326428850271e-05, -1.987727353553116e-05,
+-1.987727353553116e-05, -1.9938075516332988e-05, 1.9938075516332988e-05, 1.970878505019011e-05,
+1.970878505019011e-05, 6.3022780106944047e-06, -6.3022780106944072e-06, 8.1466766486253969e-06,
+-1.9944265277476219e-05, 1.9944265277476219e-05, -6.483199466048853e-06, -6.483199466048853e-06,
+-7.1906310980845442e-06, -7.1906310980845442e-06, -3.6209414773922491e-07, -1.3482265830494381e-05,
+4.3619791094816046e-06, -1.908117986763561e-05, -1.908117986763561e-05, -7.1777502267313636e-06,
+1.9716773149798231e-05, -7.1777502267313636e-06, -1.9716773149798227e-05, -1.0866026970422471e-05,
+1.0866026970422463e-05, -1.5319156546739849e-05, -1.9953571070556556e-05, -1.9953571070556556e-05,
+1.8795018558866536e-05, 1.085899272229112e-05, 1.085899272229112e-05, -1.8818936964610423e-05,
+-1.8818936964610423e-05, -1.1524935087923041e-05, 1.1524935087923041e-05, 1.9029746534334893e-05,
+-1.9029746534334893e-05, -1.8183518829155442e-05, -1.8183518829155442e-05, -1.9960238781146675e-05,
+1.9960238781146675e-05, -1.6248819242493368e-06, 1.6248819242493256e-06, 1.5393678856623801e-06,
+1.5393678856623801e-06, -1.8221296544446195e-05, -1.8445481019521229e-05, -1.8445481019521229e-05,
+-1.4938409628052957e-05, -1.4938409628052957e-05, -1.9453229097166746e-05, 1.9453229097166746e-05,
+-1.9417768585134346e-05, 1.9417768585134343e-05, 1.0050393247054358e-05, 1.0050393247054358e-05,
+-1.844219658897776e-05, 1.844219658897776e-05, -5.9079317462657985e-06, -5.9079317462657985e-06,
+9.9449159184721004e-06, 9.9449159184721004e-06, -1.6255953617098444e-05, 1.625595361709844e-05,
+3.6111210645747078e-06, 3.6111210645747078e-06, -1.2175901515341104e-05, -4.0313270417128282e-06,
+-1.8771613587782224e-05, -1.8771613587782224e-05, 6.3549209411181234e-06, -1.9537116531245536e-05,
+6.3670333583929414e-06, -6.3670333583929312e-06, -9.1888038356683256e-06, 1.9785190090255071e-05,
+1.9785190090255071e-05, 6.290287648129113e-06, -1.3930556377392219e-05, -1.3930556377392219e-05,
+-1.6082399117950637e-05, -1.6082399117950637e-05, 1.9110979383367616e-05, -1.9110979383367616e-05,
+2.0210217599670097e-06, -1.9673176978589711e-05, -1.9673176978589711e-05, -3.7601510427699285e-06,
+-3.7601510427699285e-06, -1.635583460246602e-06, -1.635583460246602e-06, -6.6332718752152118e-06,
+6.6332718752152228e-06, -1.9395380663655389e-05, 1.9395380663655392e-05, 1.2292079488386205e-05,
+1.2292079488386205e-05, -1.9988618023449182e-05, -1.0332842439330462e-05, -1.0332842439330462e-05,
+-1.8719866427983258e-05, -1.8719866427983258e-05, 1.8932940205072957e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+-0.0054104822114423119, 0.0051373641457451375, -0.0015132689596657313, 0.0015132689596657322,
+-0.0010028213540527109, 0.00093997286397599922, -0.0011474459619030925, 0.0017795434994345293,
+-0.0017795433587136189, 0.0013392078259752435, -0.0013392070056172782, -0.0013190848531875912,
+0.0013090928838725704, 0.00022728100842323289, -0.00022728100842323303, 0.00036930574042036066,
+-0.00029805200313640041, 0.00028397751218499026, -0.00029837109977498067, -8.5204610238585296e-05,
+-0.00047274510512427387, 0.00038040003568137195, -0.0003807413032035085, 0.00017412322476130106,
+-0.00036874079379998684, 0.00048428510933900876, 5.0502502129029368e-05, -5.0036854007006232e-05,
+-0.00044606823709898632, -0.00045577676907030453, -0.00043944841139613428, -0.00043720232867450317,
+0.00011607061677515335, -0.00042698359349325452, -0.00037391985315522096, 0.00039645014153889195,
+5.8556045956540493e-06, -0.00040979244109032336, 0.0001462596082112244, -0.00039157930650099708,
+0.0003891239869707889, -0.00039176735477701495, -0.00020239803023778033, -0.00035846431273705692,
+-0.00031867185198158909, -0.00038502301840351175, 0.00036880311802583917, 1.9346738407643459e-05,
+0.00036301081755115805, -0.00032709472781504461, -3.4361850097845862e-05, -0.00028756050381500715,
+0.00025212256504239907, 0.00013361405894684456, -0.00032995161277936586, -0.00034337372167956551,
+0.00033160075772027941, -0.00032862029721718349, -2.3402856761475202e-05, 0.00010180923631078276,
+0.00011243068819401965, -0.0002591152524401007, -0.0001330346338167676, 0.00013303463381676768,
+3.8317102073365405e-05, -0.00026606649139658707, 0.0001096542557544908, 0.00029383013606307424,
+0.00028471706553020277, -0.00021463624217489709, 0.00016030888920500144, -0.00014676320992249272,
+-0.00021396420208708795, -0.00024817394209222701, -0.00025141303258211108, -0.0002330855993533037,
+-0.00024459112003320723, -9.2150570812564279e-05, -0.00014265303461977815, 0.00024890369891025413,
+-0.00010355672546489068, -0.00025375041927430084, -0.00022799050170140529, -0.00023436732917431148,
+-2.2606043622183492e-05, -0.00022008240318486031, -0.00013540607285946366, -0.00014096613485582206,
+-0.00022054273128831715, 0.00019833188027296972, 0.00024486871555321323, 0.00014871024607024979,
+2.2239094263832862e-05, 0.00013660559557039987, 0.0001170204224997654, -0.00022132666191363508,
+-0.00012991809522010532, 0.00013858523550429455, 0.00022896252119049106, -0.00014368130832541473,
+-1.4562888953061445e-05, 0.0001693361274461142, -0.00015659164602967131, 7.7515847177828315e-05,
+0.00021899763719219472, 0.00011229263185553571, -0.00013353622195498395, 5.6672696917514172e-05,
+-3.9493446525524837e-05, -0.00018007077500680984, 6.2212579320838459e-05, -0.00020821262043796722,
+-7.363694476523154e-05, -9.5049464330208104e-05, -0.00017664162536447543, 0.00019870142043306788,
+-0.00015890742043041614, 0.00019877159774344086, 0.00019884511046804884, -0.00019226814533283935,
+0.00019891747189025415, -0.00019226482857166464, 0.00010288945119927535, -0.00010288945119927537,
+0.00019980158231226692, -1.2915309429809833e-05, -0.00019257633028888386, -6.4080969149388504e-05,
+0.00018564444927836644, -0.00017773858946412268, 0.00018918301203518147, -0.00016889793512086564,
+-0.00018715148656597611, -5.8972024844566241e-05, 0.00018951067375329764, -6.7135330242279798e-05,
+-0.00017449848505371649, -9.7067730536143173e-05, 0.00013618913144687042, -0.00014055659724045998,
+-6.1341912211465972e-05, -1.1972296298786608e-05, -0.00010255595629455008, 0.00017969097023175072,
+6.4327099707389327e-05, 2.7966238151185112e-05, -0.00015903000031856551, -0.00018136400484634194,
+-0.00017681908793765319, -0.00015389445473035777, 0.00018009288252127218, -6.4920066891442426e-05,
+9.3550347416930684e-05, -1.3263998299477242e-06, 0.00015819938576084884, -9.8421802702534485e-05,
+8.4067318233710156e-05, -0.00017958109924051633, 6.0945276184089006e-05, -0.00016019536309683051,
+6.0953434775982615e-05, -0.00011791001755299497, -0.00014720235860020577, 0.00014720235860020574,
+0.00017983476808846406, 0.0001458813484549407, 7.2860618378883435e-05, -0.00014565841179593175,
+-0.00016997921955707706, -5.7217522648377557e-05, -0.00015608779749775421, -0.00015883374167457892,
+-0.00016088566708946802, -5.8165756671404085e-05, -0.00011769422242460952, 0.00011885222153456147,
+-8.8167447222453811e-05, -0.00013887737652912977, -5.7015512528546244e-06, -6.9775072050931995e-05,
+-0.00012603511476893623, -4.784588139156281e-05, 6.3589702304969175e-05, 0.00012852503025808084,
+-0.00014981627020625683, 0.00014991477729767725, -0.00014991467226253529, 6.5326192669655476e-05,
+4.6940606691093388e-05, -2.594576753178239e-05, 6.4845158843615202e-05, -0.00014664111463987944,
+4.2429620582033288e-05, 0.00014153859180318152, 3.8208317784784318e-05, 9.4837415576068878e-05,
+-9.2442226609175903e-05, -8.5913908879170251e-05, -0.00010273192579659235, 0.00013779346040295959,
+-0.00013779346040295959, -4.4765540310819607e-05, -8.2422265470579416e-05, 8.4151422286494863e-05,
+4.4441629243837357e-05, -4.9294424454370183e-05, -0.00013912826026221759, -0.00012008936604525953,
+-0.00011878116669157959, -0.00011731437367547882, 0.00012999977630680045, 0.00012999751494810303,
+6.3693469790027587e-05, -6.3693469790027601e-05, -5.3305329207278658e-05, -4.1741022575733111e-05,
+6.1246906374932942e-05, -6.1195586622786723e-05, -9.0441635273613469e-05, 9.0437863497776024e-05,
+-0.00010168776073997483, -0.00011201696928494, 0.00011863202933816483, -8.9677545779002452e-05,
+9.2615907423875685e-05, 4.606338061980146e-05, -9.6673766303315373e-05, -6.7878025368436684e-05,
+0.0001099692893054883, -0.00010996928794457869, 0.00010953985511506708, 5.8848570341202404e-05,
+-6.6563845809036328e-05, 5.1329989477368384e-05, -0.00010373258138690028, -2.740274550435203e-05,
+8.1479766120676729e-05, -9.9596195183049126e-05, 8.8091295928850158e-05, -8.8091295928850144e-05,
+-4.91811580833624e-06, 4.8204378315807122e-05, -9.1417643974924149e-05, -9.9998402312474595e-05,
+-9.999763394927327e-05, -9.9997528220725987e-05, -9.9818523473136568e-05, -8.6394064485813621e-05,
+5.6846722916663012e-05, 9.4008192978211249e-05, -5.3605577740501875e-05, 8.3315548136054908e-05,
+9.5337287960200659e-05, -6.8405088148908332e-05, -9.5264975344964774e-05, 9.5264975344964774e-05,
+-6.8419880199045645e-05, -5.4790856834967943e-05, 5.8933962526052913e-05, 6.1671855557594957e-05,
+-2.7123399604502375e-05, -1.6793848853561667e-05, 7.6250039709706054e-06, -6.9376217312055559e-06,
+9.2270046389071779e-05, 7.9149731165956445e-05, 4.6442341425210444e-05, -5.7485610735988261e-05,
+-4.2300961478773278e-05, 4.2300961478773292e-05, 7.9206823131731436e-05, 4.6681240168450261e-05,
+3.9269411558903642e-05, -3.9269411558903649e-05, 3.7989414581098869e-06, -2.5332769511966562e-05,
+8.5690171055642511e-05, -2.3585065841941219e-05, -3.1330860442824717e-05, 7.213587217085435e-05,
+3.8996467585586077e-07, 2.8271743717623301e-05, -1.5230339812494573e-05, -6.1878756686970128e-05,
+-1.8734084576545058e-05, -6.7676022839704085e-06, -7.4570586361101017e-05, 7.0682880231052461e-05,
+7.045684745169556e-05, 8.9884769959821265e-05, 8.7959456011478364e-05, 7.1399476898269097e-05,
+-7.1226448405741857e-05, 7.1226448405741885e-05, -7.9897238225911272e-05, -5.9165610298314469e-05,
+-4.8579806333127726e-05, 4.8579806333127726e-05, -4.7268363132803697e-06, -5.6019018175870687e-05,
+2.0608253424550608e-05, -7.9999970816146946e-05, 7.0720906583450767e-05, -7.072090658345074e-05,
+-1.4361253282009033e-05, -3.3440541141141722e-05, -6.5243886077912675e-05, -5.0839552561451741e-06,
+-2.7211260591203731e-05, -6.0888898723370149e-05, 2.3979749348708751e-05, -7.9995884407908611e-05,
+2.3937226226694622e-05, -2.1288154485300376e-05, 2.1288154485300403e-05, 6.5065344593293056e-05,
+5.8954804759834535e-05, -7.7339718603828162e-05, -1.0035482687620686e-05, 6.9583623483317425e-05,
+-7.3057261556020144e-05, 4.6360679351830111e-05, -1.0753042901788801e-05, -2.9546240937071301e-05,
+6.3466201687350311e-05, 7.8357988977028237e-05, 6.565158967512676e-05, -4.8408991413647536e-05,
+-4.1063708488889934e-05, 4.1063708488889921e-05, 1.1117422380581602e-05, -1.1115866349234337e-05,
+-6.7401715601109335e-05, -6.7154516460156055e-05, 6.7154516460156069e-05, 6.7937976494220577e-05,
+3.5136103708491736e-05, -6.2358899128250005e-05, -6.7729804398962331e-05, 5.3468316329109856e-05,
+6.1463293394015603e-05, -6.6743423866485809e-05, -5.736804330000476e-05, 5.7368043300004753e-05,
+-3.7739106382988606e-05, 5.1661217003910838e-05, 6.93128383273665e-05, -6.2344144751946376e-05,
+5.2403789591812174e-05, 3.7523512499370341e-05, 6.5584945925998609e-05, -6.6477174824805451e-05,
+4.6184658297861674e-05, 6.1608914852336665e-05, -5.6189785380958754e-06, 6.3102550979612826e-05,
+-6.9931095734152897e-05, -6.9355841022217054e-05, 6.7041673661680703e-05, -4.0826461437502098e-05,
+-5.8755300422653093e-05, 3.7547495887647345e-06, -3.7547495887647116e-06, -6.1442478315741085e-05,
+6.702826620822839e-05, 6.9748904197414855e-05, -6.7028266208228403e-05, -4.2784694819268204e-05,
+6.7401372624748833e-05, -6.9854606139719504e-06, -3.5453718583692333e-05, -1.2229673117913788e-05,
+-6.1631873985905166e-05, 6.6463676075728608e-05, -2.9606883138394148e-05, -2.1685026580949196e-05,
+2.401594907816014e-05, 2.9101326147417926e-05, -2.9101326147417905e-05, 6.8245030749610467e-05,
+-2.4032358677815743e-05, 6.9419083293203735e-05, 1.0735283262961269e-05, -1.0734902051990875e-05,
+-1.0289098636163006e-05, 5.1651977686912946e-05, 4.902999168838524e-05, -5.966520617120653e-05,
+-4.700348645091122e-05, -5.9993794667021958e-05, -4.6327035919467947e-05, 1.9287131466090869e-05,
+-1.0396407822177414e-05, -3.3495703945971688e-05, -1.9081393542927934e-05, 2.9638943085879589e-05,
+3.8883102830131475e-05, -1.9965795394767275e-05, 5.9448502792541763e-05, -2.5503617063096549e-06,
+4.0081666951119574e-05, -4.0081666951119561e-05, -5.5650722303539406e-05, 4.5749843609844672e-05,
+-5.9945468177017177e-05, 5.9945404327539802e-05, -5.9981147551818942e-05, -5.1681834990211897e-05,
+-4.8874578659313337e-05, -5.2970266287845265e-05, 3.3225112504207923e-05, 2.2906535173709663e-05,
+-4.7952732812036866e-05, 3.0516359425288974e-05, 5.1489454141339715e-05, -3.7838606122342292e-05,
+3.5824566360627069e-06, 2.3806814961489269e-05, 3.4630416345299569e-06, -1.2024897383326277e-06,
+2.1765810657572421e-05, -2.6411419553855002e-06, -3.2666800987169822e-05, 5.9398361271860968e-05,
+5.7035574972082002e-05, 4.5394068084583394e-05, 4.7822971954624245e-05, 5.9383249097014673e-05,
+4.9975262852397429e-05, 4.8791086527990943e-05, 5.8567690728764201e-05, 5.936520658428465e-05,
+-5.7158985206978862e-05, 5.7158985206978869e-05, 1.3454357683962476e-05, 2.9445585021405299e-05,
+5.6290838586794424e-05, -5.8882940416843366e-05, 5.6376720486281764e-05, 5.9903918920626643e-05,
+2.0055348109654889e-05, 3.705891156841395e-05, 5.878394305431185e-05, -4.4686509243170831e-05,
+-2.7527468912265156e-05, -1.3752478739273627e-06, -3.3565151076124533e-05, -5.999987939517073e-05,
+4.6011646458931285e-05, 3.4978859562787703e-06, 5.9215890463174762e-05, -5.8918380021373061e-05,
+-2.4526007408656732e-05, 5.9640035580744607e-05, -5.5999661550989035e-05, 5.8405188376421742e-05,
+5.6286066821980847e-05, -2.5045247043271217e-06, -4.6718831575375809e-05, -3.9248239743319666e-05,
+3.5676680090904825e-05, -5.6923152931602905e-05, 4.3512621515691234e-05, 1.1307769499142835e-05,
+-5.6931281352303889e-05, -5.1050212770128746e-05, 1.1994203808822001e-05, -5.8705924785531832e-05,
+-5.6939164865975071e-05, -5.8849591600633999e-05, -5.9642426575608098e-05, -5.999993880710239e-05,
+5.2937394718689976e-05, -2.6725346849185199e-05, -5.2070194499501253e-06, -1.6573258986914128e-05,
+5.6069132884737686e-05, 2.7222950853768404e-05, -3.1575346553554356e-05, 2.6704605644571526e-05,
+-3.4625341891316386e-05, 6.5685598372067506e-06, 2.6224289936255402e-05, 5.950702295960649e-05,
+-4.9003787149855373e-05, 2.0623466124078069e-05, 4.7599651265512733e-05, -2.4943993840643921e-05,
+2.4943993840643938e-05, 5.8768491732771178e-05, -2.6496759097979928e-05, -2.1940074762569259e-06,
+2.1789736842759169e-05, -5.456821223149896e-05, -3.9454895755538624e-05, 3.9400521562350961e-05,
+-2.7597351378436503e-05, 2.7597351378436466e-05, 1.5988933238112853e-05, 1.5876983805700864e-05,
+-2.6795676160108674e-06, 4.658433313811988e-05, 5.5853447926322825e-06, -3.9890800569725976e-05,
+-2.2630824840525738e-05, -1.2685229852833286e-05, 1.5643255135648268e-05, -1.5643255135648264e-05,
+2.5554476445530855e-05, -4.9902416204244176e-05, 2.6624153580109372e-05, -2.4249860793147171e-05,
+4.9987181297822669e-05, 4.9987181297822669e-05, 2.0292569000400262e-05, -3.5912162665334135e-05,
+4.2917628621510554e-05, 4.2917628621510554e-05, 4.1526616473890824e-05, 4.9996428671818386e-05,
+-1.1576826007863834e-05, 2.6722094734265496e-05, 2.2957808430691884e-05, -2.1531564451455598e-05,
+4.9042970186844439e-05, -4.571401641653226e-05, 2.201281874040477e-05, -2.6110008054864005e-05,
+4.9486040914178892e-05, -4.1775207363623016e-05, -4.8881994350252062e-05, -1.2423657964349623e-05,
+-1.9632872651421548e-06, 4.945316271100247e-05, 2.5056168928269114e-05, -4.8945536583733643e-05,
+4.4601754521982161e-05, 3.3236177239886584e-05, -2.5007081040680473e-05, -4.2840668854575488e-05,
+-3.4845734310400926e-05, -4.6013255491923152e-05, 4.2779456323928071e-05, 4.9954255388929774e-05,
+-4.5975451262548399e-05, -4.5929212942649455e-05, -4.9831842167967427e-05, -4.7565898442835485e-05,
+4.8039332794467892e-05, -4.4949892437284899e-05, -1.0066829445927753e-05, 1.0066829445927764e-05,
+-4.6864187688077933e-05, -9.2559667794732295e-06, 4.688199432690544e-05, 1.6748587429104999e-05,
+4.7505964685368412e-05, 4.7579508296243332e-05, -4.9999899478477642e-05, -9.1976361524597285e-06,
+1.4832254150961025e-05, 4.6896898605583769e-05, -1.659500132168771e-05, -4.2617383274019803e-05,
+-1.9886318802893764e-05, 2.6423613301726151e-05, -4.8602085502090264e-05, 4.9451725357946652e-05,
+-1.170979620299337e-05, 1.6130293270479617e-05, -6.444764479269631e-06, -2.5957013379824001e-05,
+-3.7042961322298202e-05, -1.0946904860912366e-05, -1.0793002986624824e-05, -4.743489306386296e-05,
+-1.1589518999349896e-06, -6.029747442372315e-06, 4.9999923097523625e-05, 4.7231893176607859e-05,
+-4.7231893176607865e-05, -4.9097202812349849e-05, 7.4742044895707063e-06, -4.7687154185549161e-05,
+1.6550409550942716e-05, -4.7455450423506604e-05, -4.6724914246595484e-05, 3.3625070741612848e-05,
+-4.7461048737303735e-05, 4.9231971028833191e-05, -4.9999963300182094e-05, -4.288359932609107e-05,
+-1.8474120731357423e-05, -8.9970386325302892e-06, -2.9440727409962064e-05, 4.9897767174300913e-05,
+-4.9163087259152666e-05, -4.6641236692238308e-05, -4.7452693013405328e-05, -3.1081347115125146e-05,
+3.9101223762058846e-05, -3.9101223762058819e-05, 2.1482759794153078e-05, 4.7477093331854092e-05,
+-1.7063608089431184e-05, 4.6277111113047898e-05, 4.9908755498878183e-05, 1.7003139811003259e-05,
+3.5810876975508425e-05, 2.1139146035801394e-05, 4.996682648488345e-05, 4.7458332739251196e-05,
+-1.8091560856055327e-05, -1.7123195446179459e-05, 4.9943960122068424e-05, 4.8623700286024127e-05,
+1.7039571837206429e-05, 4.845006009213135e-05, -1.0557933623346411e-06, -1.0557933623346411e-06,
+4.9820639208845598e-05, 1.7219128410889051e-05, -3.1266961250349238e-05, -2.0786661533869937e-05,
+2.0786661533869951e-05, 4.9905224005491555e-05, -4.74844315724385e-05, -2.2290145371832836e-05,
+4.1259968699918931e-05, -4.2755274130023023e-05, -4.9859962448339679e-05, 1.9413454563392307e-05,
+4.9734189148573339e-05, 5.9307785617347728e-06, -1.057005250516265e-05, -4.74482968475642e-05,
+4.4687656610905636e-05, 3.4668538522576393e-05, 2.8737627343646266e-05, -3.3643365670925448e-05,
+3.3643365670925434e-05, 3.445082878469064e-05, 3.445082878469064e-05, 2.2682276933625511e-05,
+-3.9878382266869458e-05, 3.3678500490488671e-05, -2.8750784219087761e-05, 2.6683352980882914e-05,
+3.1484610663245799e-05, 2.3308050384037608e-05, 3.5251517846604795e-05, -3.5251517846604802e-05,
+-5.8879122006826893e-06, -5.8879122006826893e-06, 3.9645708075378222e-05, 3.9836095211067684e-05,
+-3.9989086857723982e-05, -3.9836095211067684e-05, -2.2138086719078191e-05, -4.0817354997733169e-06,
+4.0817354997733118e-06, 2.3585118782280061e-06, 1.0658087576996755e-05, -2.0414284648013044e-05,
+1.5140083931410561e-05, 1.3489837334071899e-05, -1.3489837334071889e-05, -3.9985711668001166e-05,
+2.1502234319997598e-05, -2.1502234319997601e-05, -2.0965267284218662e-06, 3.7636444491447584e-06,
+3.7636444491447584e-06, -2.7013735663248737e-06, -3.5107267864032009e-05, 2.6262882596320495e-05,
+-2.5254940148158999e-05, 3.7097568552480975e-05, 1.2716280775230089e-06, -7.5534727115087758e-06,
+7.5534727115087894e-06, -3.5141038770134097e-05, 3.9977273946047271e-05, -3.9977245936676088e-05,
+3.9991473984194921e-05, -3.9991473984194921e-05, -2.0481516704329004e-05, 2.4699675910688874e-05,
+2.6003675417690874e-05, -1.4667320524103086e-06, 1.4667320524103141e-06, 1.3059131060152736e-05,
+1.2370705182440745e-05, -2.5761356426547757e-05, 2.5761356426547754e-05, -2.0052371721029361e-05,
+3.4629990884506137e-05, 1.5221286552330477e-05, -3.9235173901539625e-05, 3.9235173901539625e-05,
+-2.7709762679552764e-05, 3.7255173632059775e-05, -3.7787765716996343e-05, 1.571776760405599e-05,
+3.9207894010555248e-05, 3.0070498807672611e-05, 3.9815442219458152e-05, -3.9815442219458152e-05,
+-3.543400169916052e-05, -3.543400169916052e-05, -2.37861485085234e-05, 2.6048207715851554e-05,
+-2.604820771585153e-05, 7.9162966287386832e-07, 3.9986408071513104e-05, 3.9986408071513104e-05,
+1.7693970711983574e-05, 3.7981298033312169e-05, -3.7981298033312162e-05, 3.7484037324374638e-05,
+-3.7484037324374645e-05, 1.8055157735835778e-05, 2.2143081216838286e-05, 3.4138481358276085e-05,
+-3.576414988375068e-05, 2.000566483254439e-05, -3.9969992287212281e-05, 3.5945059995308196e-05,
+-3.8207048762170512e-05, -3.9181143294716421e-05, 1.9955327654229969e-05, 3.9850350254318827e-05,
+3.6006498369087766e-05, 2.9034137431196198e-05, 3.4163564832215618e-05, 3.9954670069776816e-05,
+-3.8220066680169778e-05, 5.8154039259168717e-06, -1.925916461294069e-05, 1.9259164612940686e-05,
+3.8758797300583578e-05, 3.5964679243987983e-05, -3.6072341744872035e-05, -2.5055576797213968e-05,
+-1.0747822526096682e-05, 1.0747822526096689e-05, 6.2551996566237249e-06, -2.7152475827013045e-05,
+-3.4249918870989704e-05, 1.3441000186604417e-05, 3.8188893294145083e-05, 1.0391706613994978e-05,
+-3.818889329414509e-05, 2.1340736803445705e-05, 3.9569304969716385e-05, -3.2649759138425351e-05,
+-3.9569304969716385e-05, -2.9555841675803649e-05, 2.9555841675803639e-05, -3.9547883409846434e-05,
+2.8743609421471247e-05, -3.9999920754398413e-05, 3.7994289524995906e-05, -8.9518748800460008e-06,
+3.339770715554335e-05, -3.3397707155543336e-05, -1.6898624460691618e-05, -3.1341579600380328e-05,
+-1.6669276052864255e-05, -3.9019508397672573e-05, 2.3572406212996593e-05, -2.8484061278108893e-05,
+2.848406127810889e-05, 3.8448167448695841e-05, -2.4934227063382906e-05, 3.2092199656699685e-05,
+2.0662080383743718e-05, -3.9906700902374999e-05, -1.6334607670511752e-05, 1.8947987174761369e-05,
+3.7654374232078136e-05, -1.9802268443623105e-05, -2.312263428243919e-05, -2.436538666764605e-05,
+8.6348522927517556e-06, -8.6348522927517488e-06, 3.9968571289294423e-05, -3.9968588442005159e-05,
+-1.586171242287382e-05, 1.085020651021875e-05, 3.7646582922550783e-05, -2.8939687637125211e-05,
+-1.3496501462962191e-05, -2.4155477939136355e-05, -3.5217114712018935e-05, 3.544207350388978e-05,
+1.3570461933666503e-05, 1.0058106550068452e-05, -2.5566560377876211e-05, 3.2157297291734244e-05,
+-3.215729729173423e-05, 3.9841646960595916e-05, -3.9841646960595922e-05, -3.0273414891279399e-05,
+-1.0837378249469464e-05, 3.9493398336702154e-05, -3.9493398336702154e-05, -7.7191897839714346e-06,
+-1.6531013485504358e-07, -1.4829682841030881e-05, -1.0967687764750096e-05, -2.5154141949951637e-05,
+3.7782771780808897e-05, -9.3579477637980342e-06, 3.9709021638254531e-05, -3.9709021638254531e-05,
+1.3583503715731452e-05, -1.3583503715731439e-05, 3.9303077535038346e-05, 8.5899926547342799e-06,
+-2.536528743858785e-05, -2.9399324901076455e-05, 6.9703525868043253e-07, 6.9703525868043253e-07,
+-2.9571268034096594e-06, 1.9597990704623877e-05, -1.959799070462388e-05, 1.360554494988134e-05,
+3.0528297371600065e-05, 7.1911823545165097e-06, -3.9988007852990201e-05, -2.5551174640054818e-05,
+-3.6118713295375092e-05, 3.3166557462500358e-06, -3.9987584703695158e-05, -1.3520992117453811e-05,
+2.1038351020545785e-05, -1.3674396128804012e-05, 1.3674396128804024e-05, -3.5090947956002132e-05,
+2.8721315551562661e-05, -2.9660932222976223e-05, 3.7969616440540955e-05, 1.0231626054899688e-05,
+3.9856611785716982e-05, 3.5082154696150774e-05, -3.4947948225776974e-05, 3.4678232702458101e-05,
+1.3651372072491351e-05, -3.612969764849686e-05, 9.6054282563068364e-06, 3.7823624127991971e-05,
+3.1733100843675156e-05, -1.662932922709595e-05, 1.662932922709596e-05, 2.7901970401982808e-05,
+3.9178994488514118e-05, 3.7358389998888554e-05, 1.4257355728855095e-05, -1.9761389525132614e-05,
+1.9527487404688358e-05, 1.3972898826336228e-05, -2.66059718432869e-05, -3.7993392236646138e-05,
+1.8381154475424594e-05, -1.8381154475424588e-05, 1.6436443021572274e-05, 3.5789966913697749e-05,
+-1.5990095538727653e-05, 3.7708946710919604e-05, -3.6171618740992751e-05, 3.6171618740992764e-05,
+-3.7954264710764345e-05, 3.7954264710764352e-05, 3.0000000000000001e-05, 1.2396647050301651e-05,
+2.6452442995931784e-05, -2.6452442995931784e-05, -2.4601332416661028e-05, 2.4601332416661038e-05,
+2.2143595157222426e-05, -2.2143595157222436e-05, -9.5691365784594839e-06, 9.569136578459467e-06,
+-2.7892905205191071e-05, -5.4835909831053577e-06, 5.4835909831053543e-06, 9.5189758334303145e-06,
+-9.5189758334303162e-06, 9.7884075835655311e-07, 2.5464811579205972e-06, 2.5673030802194704e-05,
+-2.5673030802194714e-05, -2.4962910849835527e-05, -2.4962910849835527e-05, -1.1460352077127393e-05,
+-2.8740840917214832e-05, -9.4455851451149335e-06, -2.2167766791278249e-05, 2.3073887361755887e-05,
+-9.63454647795893e-06, 9.6345464779589402e-06, -5.5305626044749165e-06, 5.5305626044748995e-06,
+6.9226470363440516e-06, 9.4222244359753965e-06, -2.7619002605802531e-05, -2.7619002605802531e-05,
+2.6453433370302584e-05, 1.6405054154703057e-05, 1.4957306801523419e-06, -1.4957306801523415e-06,
+-1.6145086981723546e-05, 1.3821647610106661e-05, 7.7193067144351474e-06, 1.9277663285232682e-05,
+6.7149369984564945e-06, -6.7149369984565106e-06, -2.9987738911033823e-05, 2.9987738911033823e-05,
+9.8028454260151566e-06, 1.9201541044646922e-05, -5.6053248144538063e-06, 5.6053248144538029e-06,
+2.2358209927251687e-05, -2.2358209927251694e-05, -2.6830663725646437e-05, 2.6830663725646434e-05,
+-2.6928284003872544e-05, -1.6653813192029188e-05, 1.4564612721421364e-06, -1.4564612721421254e-06,
+1.7458320118531748e-05, -1.7458320118531748e-05, 2.677180234861402e-05, 2.7825361151769699e-05,
+-2.7825361151769703e-05, -9.175310944180678e-06, 9.1753109441807e-06, 2.9719804061816262e-05,
+-2.9719804061816258e-05, 1.9231331223286973e-05, -1.5229042652038349e-05, 1.5229042652038359e-05,
+-2.4291365353582042e-05, -2.4291365353582042e-05, 2.998646916449843e-05, -2.998646916449843e-05,
+1.6136070028885044e-05, -1.6136070028885037e-05, 1.0004210441679149e-05, -1.0004210441679141e-05,
+-2.6236933431201979e-05, -2.7814481842816232e-05, 2.9715485365895003e-05, -2.9715485365895007e-05,
+-1.9256532639494051e-05, 1.9256532639494048e-05, -2.5747842034279748e-05, 2.5571966024622376e-05,
+-2.5571966024622372e-05, 2.5719556513349457e-05, -2.7586797639297853e-05, 1.050599583485617e-05,
+9.7884982738659967e-06, 2.9710838707796185e-05, -2.9710838707796188e-05, -2.2723900540985955e-05,
+2.2723900540985962e-05, -1.9322118814177337e-05, 2.5717731538125667e-05, -2.6051740832555236e-05,
+-2.9974360006565535e-05, 2.9974360006565535e-05, 2.9877400754573995e-05, 2.9877400754573995e-05,
+-2.4867803491314611e-05, -2.6966102517315901e-05, -1.6348953561810432e-05, 5.8954247002299963e-06,
+5.8954247002299963e-06, -1.7230296404550405e-05, -2.9799450827239134e-05, -2.9799450827239134e-05,
+1.9193880235275579e-05, 1.3525466277119482e-05, -8.7669891398704557e-07, 8.7669891398706844e-07,
+-1.515758615655863e-05, 8.6188646834972698e-06, -8.6188646834972631e-06, -2.6650046705809133e-05,
+1.4532501582570351e-06, -1.4532501582570353e-06, -1.5640124470236695e-05, 2.8759797549084958e-05,
+2.8759797549084958e-05, -2.8347495779764168e-05, 2.4987631426198714e-05, 1.9326476289594994e-05,
+-1.507364780716895e-05, 1.5073647807168947e-05, -2.7385192079490347e-05, -2.7385192079490347e-05,
+1.6941332142731507e-05, -1.6941332142731497e-05, -2.811200802229514e-05, 1.9371835852204092e-05,
+-1.9371835852204116e-05, -1.5056228838491484e-05, 1.5056228838491494e-05, 2.4477508810466243e-05,
+2.4477508810466243e-05, 2.6621268903803692e-05, -1.7240560482181362e-05, -1.7152199747517783e-05,
+-1.7240560482181362e-05, 1.7152199747517779e-05, 2.9551652521628299e-05, -2.9551652521628299e-05,
+2.2530423388234461e-05, -2.3836480079679159e-05, 2.9671896854334919e-05, -2.9671896854334915e-05,
+1.4060540356530226e-05, -1.4060540356530242e-05, -2.7644929588477492e-05, 2.7644929588477495e-05,
+2.998118251497688e-05, -2.998118251497688e-05, -2.3801569165321578e-05, 5.2948271275273864e-07,
+-5.2948271275273472e-07, -2.7628581009920694e-05, 2.762858100992069e-05, -2.5704401312745293e-05,
+2.57044013127453e-05, -2.9977494215409205e-05, 2.9977494215409205e-05, 2.4906899470100712e-05,
+-2.606283327033245e-05, 2.6062833270332446e-05, -2.0861371388941385e-05, -2.0312884272577774e-05,
+2.8703283964129489e-05, -2.8703283964129493e-05, 1.4880762397152557e-05, 2.5510412454667372e-05,
+-2.9886398828793214e-05, 2.9886398828793214e-05, -2.5208139191025425e-05, 2.5208139191025418e-05,
+1.4159432514916034e-05, -1.4159432514916038e-05, 1.0437341947529323e-05, 1.0437341947529323e-05,
+9.3790401566959221e-06, 2.7771527429927372e-05, 3.6854143584855867e-07, -2.746901905633672e-05,
+2.7469019056336716e-05, 2.9999939013263557e-05, -2.9419006981675628e-05, 2.8425692274241214e-05,
+9.2738652072077128e-07, -2.9386948966985795e-05, 1.123973673256541e-05, -2.9860632523388649e-05,
+-1.7711552649943953e-05, 1.7711552649943956e-05, 2.8451544977729464e-05, -2.8451544977729464e-05,
+2.0110479128665574e-05, -2.8874320725592689e-05, 2.8138387927655314e-05, -2.8138387927655321e-05,
+-1.7485888388471741e-05, 1.7485888388471761e-05, -8.6226962570963855e-06, -8.4174432402641458e-06,
+2.950764495205708e-05, -2.950764495205708e-05, 9.3690527412525558e-06, -9.3690527412525473e-06,
+-2.2206073511534875e-06, 1.0157230719415659e-05, -1.7794094530541045e-05, 1.7794094530541041e-05,
+2.5245558237121672e-05, -2.5245558237121662e-05, 2.845407780863552e-05, -2.845407780863552e-05,
+1.0069110871698154e-05, 1.0069110871698154e-05, 2.0226140610807044e-05, 2.5441259756053427e-05,
+-2.5441259756053431e-05, -2.4328373441567778e-05, 2.0382294026113985e-05, 2.7051004018590598e-05,
+-2.8242700516300808e-05, 2.8457604802556163e-05, -2.8457604802556166e-05, -2.8457604802556166e-05,
+2.8457604802556163e-05, 2.5391964867476946e-05, 2.5290655830265752e-05, -2.5290655830265749e-05,
+7.4835008032116058e-06, 9.5151176140932722e-06, 2.9756198826858756e-05, -6.971665999980111e-07,
+1.0191459676798247e-06, 1.0191459676798247e-06, 1.666276623426089e-05, 2.0940741202739985e-05,
+-1.6662766234260907e-05, 9.2782579340409962e-06, 1.8056457821163563e-05, -2.8461576465801452e-05,
+2.8461576465801456e-05, 1.685754248048028e-05, -1.6857542480480277e-05, -2.7098023662510706e-05,
+2.7098023662510706e-05, -1.3975538701221031e-05, 6.0003559843822471e-07, 2.1064505842013005e-05,
+-6.0003559843822005e-07, -2.1064505842012998e-05, -5.2447426003098373e-06, -3.4418936996940683e-06,
+3.4418936996940776e-06, 1.5204517527698731e-05, 2.9986648294497103e-05, -2.9986648294497099e-05,
+-1.7658917353322475e-05, -1.6888341434746255e-05, -1.4861126601721188e-05, 1.4861126601721184e-05,
+-1.7700558792889856e-05, 1.7217516743761362e-05, -1.7217516743761355e-05, 2.9990504086950383e-05,
+2.9990504086950383e-05, -2.8479609425085743e-05, -8.4244738866172582e-06, 8.4244738866172548e-06,
+-2.493745978927716e-05, 2.8652144378121742e-05, -2.8652144378121738e-05, 1.5278790767977874e-05,
+-2.591120263778977e-05, 2.5286545985704569e-05, -2.5286545985704572e-05, 2.8376733207539507e-05,
+-1.0138876436200079e-05, -1.3400866174628652e-05, -1.8034209274145732e-05, -2.4274894712407761e-05,
+-2.396688092438169e-05, 8.6410646158711296e-06, -8.6410646158711279e-06, 9.9647993855876465e-06,
+-9.9647993855876499e-06, 9.9988346556570129e-06, -1.0299847847868604e-05, -1.0299847847868604e-05,
+5.2148595059040236e-06, -1.3999741001219883e-05, 2.8656391535683725e-05, -2.8656391535683725e-05,
+9.5671806111187231e-08, 1.4191909881454264e-05, -1.4191909881454267e-05, -2.3746586957083607e-05,
+-2.9603570252971448e-05, 2.9603570252971445e-05, 9.6754352286237856e-06, -9.6754352286237771e-06,
+9.0690554234851448e-06, -8.3291582989961657e-06, 7.479135047509569e-06, -7.4791350475095605e-06,
+-2.9463224513963023e-05, 2.9463224513963019e-05, 1.3890959698963417e-05, -1.3890959698963396e-05,
+-2.9783848541562223e-05, 2.9783848541562223e-05, -1.2815803106327602e-05, 2.3553383323514934e-05,
+2.7729702070939801e-05, -2.7729702070939801e-05, 6.7978155038063292e-06, 2.8414731627348717e-05,
+1.3611475426884202e-05, -1.3611475426884205e-05, 7.084901420466518e-06, -2.8471706553020276e-05,
+2.847170655302028e-05, 2.847170655302028e-05, 2.809991812264119e-05, 2.809991812264119e-05,
+1.2355241393299995e-05, -2.8038439888554373e-05, 2.8325685064714101e-05, -1.9198495483042699e-05,
+-2.9912753641173554e-05, 1.4681213281529006e-05, 2.8484432603883692e-05, -2.8484432603883688e-05,
+-1.0214173065372552e-05, -2.6816357803675979e-05, 2.6816357803675969e-05, 2.9954953302141496e-05,
+-2.9954953302141496e-05, -2.9719675536246501e-05, -1.0238164853658711e-05, 1.0238164853658694e-05,
+-2.619424242796469e-05, -2.8666428937541112e-05, 2.8666428937541112e-05, -2.9753776657044054e-05,
+2.9753776657044051e-05, 2.8406550430472088e-05, -2.8406550430472088e-05, 2.987414255706989e-05,
+-2.9874142557069894e-05, 2.756290742048669e-05, 2.7939864556118561e-05, 2.502230390529758e-05,
+-2.502230390529759e-05, 2.2286649309981738e-05, -1.2471996920321961e-05, -1.2471996920321961e-05,
+-1.2471996920321961e-05, 1.2471996920321969e-05, 1.2471996920321969e-05, 1.2471996920321969e-05,
+2.9677380907903296e-05, -1.1887256654845832e-05, 7.2230335128124136e-06, -2.4802765811761154e-05,
+-4.802736086263725e-06, -1.0347795432692753e-05, 1.3561730681028423e-05, 2.0803771405223384e-05,
+-2.7934399879310441e-05, 2.548876775099157e-05, -2.704659249109423e-05, 2.704659249109423e-05,
+-2.1821993736379012e-05, -2.1821993736379012e-05, -8.0269392036676129e-06, -8.0269392036676129e-06,
+-2.9811053783238964e-05, -4.171713844053131e-06, 4.1717138440531268e-06, -1.9832597248552947e-05,
+9.4084936273978383e-07, 3.6840740267442371e-06, -3.6843107604171863e-06, 1.0875039743912912e-05,
+-9.8478088859773497e-06, 1.2269796483967553e-05, 1.6276003887755374e-05, -1.6276003887755377e-05,
+1.9997194758095791e-05, 1.9997194758095791e-05, 1.9998219425800139e-05, 1.7195819201846421e-05,
+1.9998219425800139e-05, -3.6317668683789077e-06, -3.6317668683789077e-06, -3.6578825020186047e-06,
+-3.6578825020186047e-06, 1.947207612593157e-05, -1.484091619645108e-05, -1.755639345155356e-05,
+1.755639345155355e-05, -8.7990749237654763e-06, -1.5282220595660588e-05, 1.0872455777516093e-05,
+-1.4295853328372769e-05, -1.4295853328372769e-05, 1.0911158932345951e-05, -1.9532142669973419e-05,
+1.9532142669973422e-05, 9.5649604528526734e-06, -1.9883946716882934e-05, 1.9151484556849567e-05,
+1.9940937689903289e-05, -1.9940937689903289e-05, 7.5810420301386103e-06, -7.5810420301386289e-06,
+1.226253986532264e-05, -1.9976998869571396e-05, -3.611759654327409e-06, -3.611759654327409e-06,
+-3.6814767831094163e-06, -3.6814767831094163e-06, 1.0324586430715091e-05, 1.0324586430715091e-05,
+-1.9280408413250673e-05, -1.9266338380467992e-05, 1.6705988643310705e-05, 1.1415010860795517e-05,
+-1.1415010860795519e-05, 1.992483839428515e-05, 1.7649836936451458e-05, 1.7649836936451458e-05,
+-5.1317660710000728e-06, 5.1317660710000805e-06, 1.7236699089709145e-05, 1.7236699089709145e-05,
+-1.9719896291305035e-05, 5.5981620309487241e-06, 1.4865304382248291e-05, 1.4865304382248291e-05,
+-1.2808420113605813e-05, 1.2808420113605818e-05, -1.9992734416128417e-05, -1.9992734416128417e-05,
+1.0747319873820959e-05, 8.7612292213575556e-06, -8.7612292213575522e-06, -7.2704555013476117e-06,
+1.0893471584021827e-05, 1.6907146401808322e-05, 6.4480499047506809e-06, -6.448049904750692e-06,
+-1.9182100413615625e-05, -1.9182100413615625e-05, 3.9403142421277309e-06, 3.9403142421277309e-06,
+-1.1275661939953137e-05, 1.1275661939953142e-05, -4.0172601872900031e-06, -3.2221653936113583e-06,
+3.2221653936113468e-06, 1.7774279853086654e-05, 5.4649185060671561e-06, 1.0402667163204419e-06,
+1.0507522604923735e-06, -1.0507522604923767e-06, 1.4178436592767712e-05, 1.9977581900907991e-05,
+-1.9977581900907991e-05, 2.990706868874193e-06, -2.990706868874204e-06, -9.4721766991878931e-06,
+9.4721766991878965e-06, 1.9929543129362538e-05, -1.9929543129362538e-05, -1.7733540767251366e-05,
+-1.7733540767251366e-05, -9.0047522678975724e-06, -1.3809741631016043e-06, 1.3809741631016041e-06,
+1.9775255487181473e-05, -1.500494038706682e-05, -1.5019636887515743e-05, 1.5004940387066823e-05,
+-1.8682736808725437e-05, 1.8682736808725437e-05, 1.7182305378123351e-05, -1.7182305378123348e-05,
+1.9992572741871024e-05, -1.9992572741871024e-05, -8.6445984238598605e-06, -8.6445984238598605e-06,
+1.2000386022610604e-05, -1.8729127414811334e-05, 1.872912741481133e-05, 4.155167652737219e-06,
+4.155167652737219e-06, 1.170865848093124e-05, 1.170865848093124e-05, -8.1956046182152154e-06,
+4.3020122213603785e-06, -8.1956046182152154e-06, 4.3020122213603785e-06, 1.8112997054637463e-05,
+1.8112997054637463e-05, -1.979441586646191e-05, 1.979441586646191e-05, -1.9034443097292e-05,
+1.9034443097291996e-05, 1.3035525591427302e-05, 1.3035525591427302e-05, 1.9995097079290456e-05,
+-1.9995097079290452e-05, -1.0361432922928812e-05, -1.8266105700186746e-05, -1.8266105700186746e-05,
+-1.7269891954602229e-05, 1.7269891954602229e-05, -1.5849523550561161e-05, 1.5849523550561161e-05,
+4.6705296938849144e-06, 4.6705296938849144e-06, 1.1607286102267724e-05, 1.1607286102267724e-05,
+1.9772853421069012e-05, 1.9772853421069012e-05, -1.3965834742238721e-05, 1.8824628830548967e-05,
+1.8824628830548967e-05, 1.6655246479657589e-05, -1.6655246479657589e-05, 1.6706566283684077e-05,
+1.6706566283684077e-05, -1.7050079679124932e-05, 1.7050079679124929e-05, 1.9588691936180881e-05,
+-1.9588691936180881e-05, -1.8350163433709974e-05, -1.8350163433709974e-05, -1.6898206646203167e-05,
+-1.6898206646203167e-05, -1.3459088418874691e-05, 1.3459088418874691e-05, 1.8723867973242505e-05,
+1.8723867973242505e-05, -1.9558747962634159e-05, -1.803956798989661e-05, -1.9558747962634159e-05,
+1.8039567989896606e-05, -1.9999545451717348e-05, 1.9999545451717348e-05, -1.9951654540721678e-05,
+-1.8854218339095762e-05, 1.3626786121498485e-05, -1.362678612149848e-05, 4.3339517123375406e-06,
+-4.3339517123375254e-06, -1.9008563551290559e-05, 1.9008563551290559e-05, 1.9999959917283257e-05,
+-1.9999959917283257e-05, -1.9999959917283257e-05, -1.9999959917283257e-05, 6.2231497811860083e-06,
+-2.6884993950207449e-06, -2.6884993950207449e-06, 4.6838472159592629e-06, -4.683847215959257e-06,
+-4.6867452848813572e-06, 4.686745284881347e-06, -1.2930094885556933e-05, 1.2930094885556929e-05,
+-3.9285683988145483e-06, 1.9692082853827095e-05, -1.9692082853827095e-05, -1.0010880821548529e-05,
+1.0870589419327183e-05, 1.0010880821548533e-05, -1.0870589419327191e-05, -1.5277799473208033e-05,
+1.9919082585179435e-05, -1.9049918809755598e-05, -1.9785590944173283e-05, -1.9198019079684428e-05,
+1.4806798495802557e-05, -1.5615465422507631e-05, 1.912408550973892e-05, 1.4788538210658571e-05,
+8.3814961520402626e-06, 8.3814961520402626e-06, 5.4228488022451421e-06, 5.4228488022451421e-06,
+9.5439298384011203e-06, -1.4149326328222546e-05, 9.5439298384011203e-06, 4.6837861314193962e-06,
+-4.6837861314193903e-06, -1.1512893017871155e-05, 1.1512893017871154e-05, -4.6888933179605933e-06,
+4.6888933179605823e-06, 1.7350126698316702e-05, -1.7350126698316702e-05, -8.2588205690602859e-06,
+1.6826156222172698e-05, -1.6826156222172695e-05, 1.7953543138797395e-05, 1.7640035959318013e-05,
+-1.8777685345842428e-05, -1.620335412357434e-05, 1.6202959194383475e-05, 1.620335412357434e-05,
+-1.6202959194383475e-05, 1.89222170569072e-05, 4.6839286619405105e-06, 1.9533955884308875e-05,
+-1.9533955884308875e-05, 6.7251782651704042e-06, 6.7251782651704042e-06, 1.1336402575652066e-05,
+-1.1336402575652067e-05, -1.9933140724169334e-05, 1.9933140724169334e-05, -1.8289980238376252e-05,
+1.8317356240672409e-05, 1.8289980238376252e-05, 7.0902436038090098e-06, -7.0902436038090149e-06,
+-7.9042474991278369e-06, -1.9999962271730691e-05, 7.9042474991278352e-06, -1.9999962271730691e-05,
+4.7694114893640777e-06, 5.0965891685127168e-06, 2.7954527577708536e-06, -2.7954527577708523e-06,
+-1.8556592273794407e-05, -1.8556592273794407e-05, -1.1853301788488117e-05, 4.684074585784711e-06,
+-4.6840745857847152e-06, -1.6690055658563974e-05, -1.6690055658563974e-05, 1.0526092037909687e-05,
+1.0526092037909687e-05, -1.898601785612604e-05, 1.898601785612604e-05, 6.9251738559650957e-06,
+-6.9251738559650915e-06, -5.8281867990821008e-06, 9.9148913647274363e-06, 5.8281867990821152e-06,
+9.9148913647274363e-06, 1.8278657097689395e-05, 1.6635500484050032e-05, -1.6635500484050039e-05,
+-1.9808174205537339e-05, -1.9808174205537339e-05, -1.0058066786484504e-05, 7.3954605546115896e-06,
+-1.0058066786484504e-05, -7.3954605546115845e-06, -1.8651365227352804e-07, 1.8651365227353447e-07,
+-1.1047552098893019e-05, -1.1047552098893019e-05, 1.8546637409956602e-05, -1.8546637409956602e-05,
+-7.1196853763523489e-06, -7.1196853763523489e-06, -1.0230163249645515e-05, 1.0230163249645515e-05,
+1.8862058807315757e-05, -1.8862058807315757e-05, 1.6069831755189024e-05, -1.606983175518902e-05,
+-1.9045678876074921e-05, 1.9112643801177753e-05, -1.8984242677779408e-05, 1.642232674059903e-05,
+-1.1493058515974733e-05, 1.892636634834379e-05, 1.6810897145143385e-05, -1.6810897145143389e-05,
+-1.6763880191823441e-05, 4.6826323036504059e-06, 1.9548137878297575e-05, -1.129438275280142e-05,
+-3.0253820285786606e-06, 1.7716395093918354e-05, 1.7716395093918354e-05, -2.149360926651246e-06,
+-1.2455963169160836e-05, 1.2455963169160834e-05, -6.8727218492850819e-06, -1.5654653562868706e-06,
+1.9106556869791185e-05, 1.9106556869791185e-05, 1.8222381445269867e-05, -1.6326014824392852e-05,
+-1.6326014824392852e-05, 1.213204533224809e-06, -1.8898090575354492e-05, -1.8127043720729532e-05,
+1.8898090575354492e-05, 1.8127043720729539e-05, 6.1805722739838426e-06, -6.1805722739838392e-06,
+-1.996296845009443e-05, 1.996296845009443e-05, -6.7808963888253707e-06, 6.780896388825369e-06,
+1.7516283518049153e-05, 1.9945749285297958e-05, -1.9945749285297958e-05, 3.7665722567165749e-06,
+-5.5244196623047095e-06, -1.9991532570517359e-05, 1.9991532570517359e-05, 6.2127455568499886e-06,
+-6.2127455568499954e-06, -1.9950033244562167e-05, -1.9950033244562167e-05, -1.8986412866278831e-05,
+-1.8986412866278831e-05, 1.9258891300906704e-05, -1.9258891300906698e-05, -1.9999990812110593e-05,
+-1.9999990812110593e-05, -5.4984547913682586e-06, -5.4984547913682586e-06, -2.2122379604537888e-06,
+-2.2122379604537888e-06, -1.5726235102538275e-06, 1.572623510253822e-06, -3.4005575786042498e-06,
+-3.4005575786042498e-06, -1.8981077205362129e-05, 1.8981077205362129e-05, -1.8265586757143658e-05,
+-1.4920732360231136e-06, 1.4920732360231191e-06, -1.8920045578259688e-05, -1.8920045578259688e-05,
+-1.8662658556895359e-05, -1.8662658556895359e-05, -1.9996721927060273e-05, 1.4772559293361585e-05,
+-1.9518533199204446e-05, 5.9923763949653178e-06, 5.9923763949653178e-06, -1.8667616389958788e-05,
+3.3539315078569672e-06, -1.8667616389958788e-05, -3.3539315078569702e-06, 1.6790755131263499e-05,
+-1.6790755131263502e-05, 1.2857816404680761e-05, -1.3619844096936344e-06, -1.3619844096936344e-06,
+-6.8371980644020062e-06, -1.6795305208814413e-05, -1.6795305208814413e-05, 6.7710864358697668e-06,
+6.7710864358697668e-06, 1.6345515324368346e-05, -1.6345515324368346e-05, 6.1537587569687145e-06,
+-6.1537587569687153e-06, 8.3282436917845748e-06, 8.3282436917845748e-06, -1.2605029946843991e-06,
+1.2605029946843981e-06, 1.993388468744233e-05, -1.993388468744233e-05, 1.9940670663560727e-05,
+1.9940670663560727e-05, -8.2452624117946183e-06, -7.7307328215688731e-06, -7.7307328215688731e-06,
+-1.3298267473039291e-05, -1.3298267473039291e-05, -4.6445535515424002e-06, 4.6445535515424045e-06,
+4.7906432943989695e-06, -4.7906432943989805e-06, 1.7291315611588501e-05, 1.7291315611588501e-05,
+-7.7385647877043174e-06, 7.7385647877043174e-06, -1.9107494406160762e-05, -1.9107494406160762e-05,
+1.7352194310072724e-05, 1.7352194310072724e-05, -1.1650921508565064e-05, 1.1650921508565069e-05,
+1.9671293924319896e-05, 1.9671293924319896e-05, 1.5866550421837578e-05, 1.9589497244257059e-05,
+6.9011972375081335e-06, 6.9011972375081335e-06, 1.8963517074428425e-05, 4.2779758817146794e-06,
+1.8959453742476642e-05, -1.8959453742476645e-05, 1.7764174173589019e-05, 2.9233975255637979e-06,
+2.9233975255637979e-06, 1.8985054155935252e-05, -1.4350595772172562e-05, -1.4350595772172562e-05,
+-1.1889341386760689e-05, -1.1889341386760689e-05, 5.8966487947390949e-06, -5.8966487947390923e-06,
+-1.9897624758893707e-05, 3.6008481735679873e-06, 3.6008481735679873e-06, -1.9643351652290815e-05,
+-1.9643351652290815e-05, -1.9933009475354387e-05, -1.9933009475354387e-05, -1.8867954426208446e-05,
+1.8867954426208443e-05, 4.8804926915120737e-06, -4.8804926915120585e-06, -1.577671644706829e-05,
+-1.577671644706829e-05, 6.7464769520292048e-07, 1.7124028939591623e-05, 1.7124028939591623e-05,
+7.040355169909072e-06, 7.040355169909072e-06, -6.445446081624763e-06,
+};
+
+const struct elp_table elp15 = {
+    arg, max_arg, amp, c, s, 1715
 };
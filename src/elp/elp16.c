@@ -1,173 +1,183 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp16[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000}, 180.000310, 0.000020, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000}, 359.999680, 0.000120, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 180.005670, 0.009630, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000}, 0.000000, 0.000020, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 180.000060, 0.000650, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000}, 179.999860, 0.000050, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 153.735670, 0.000090, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 154.274800, 0.001350, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 155.766300, 0.006610, 1.000000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 154.628450, 0.001200, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000}, 153.962480, 0.000080, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 336.258460, 0.000020, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 154.007450, 0.000080, 0.500000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 155.895600, 0.000010, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000}, 24.155170, 0.000010, 0.096000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 0.000000}, 24.155110, 0.000030, 0.530000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000}, 24.082860, 0.000310, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 0.000000}, 23.352310, 0.000020, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000010, 1.127000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 346.968090, 0.000020, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 0.000000}, 336.316370, 0.000030, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 0.000000}, 165.169900, 0.000180, 8.850000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000}, 335.786800, 0.001590, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 0.000000}, 335.844920, 0.000110, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000}, 210.915390, 0.000030, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 0.000000}, 40.766890, 0.000170, 0.095000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000}, 198.781970, 0.000170, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, 0.000000}, 182.660550, 0.000010, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000}, 180.001520, 0.000020, 0.067000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000}, 179.999190, 0.000180, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, -2.000000}, 359.999760, 0.000020, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 180.074000, 0.001810, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -2.000000}, 359.999820, 0.000150, 0.474000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 179.709820, 0.000430, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000}, 179.999990, 0.000110, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, 0.000000}, 350.808270, 0.000010, 1.292000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 0.000000}, 335.904130, 0.000560, 0.080000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -2.000000}, 335.928130, 0.000010, 0.903000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000}, 155.911330, 0.000070, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, 0.000000}, 155.905870, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -2.000000, 0.000000}, 11.985930, 0.000020, 4.425000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 0.000000}, 156.005890, 0.000240, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, -2.000000}, 180.000000, 0.000040, 9.300000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000}, 156.003960, 0.000020, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 0.000000}, 334.711310, 0.000020, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000}, 335.838480, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -2.000000, 0.000000}, 180.000030, 0.000020, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000}, 180.000210, 0.000020, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, -1.000000, 1.000000}, 275.131490, 0.000010, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 1.000000, -1.000000}, 275.131000, 0.000060, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 1.000000, 1.000000}, 95.132400, 0.000040, 0.106000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 2.000000, -1.000000}, 275.133540, 0.000100, 0.043000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000}, 77.000070, 0.000030, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 1.000000}, 275.132280, 0.000040, 0.097000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000, 0.000000}, 77.056430, 0.000040, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, -1.000000, 1.000000}, 95.132280, 0.000010, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, -1.000000}, 95.125390, 0.000010, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, 1.000000}, 275.132140, 0.000230, 0.949000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000, -1.000000}, 95.138270, 0.000010, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 2.000000, -1.000000}, 275.133550, 0.000020, 1.388000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000, -1.000000}, 95.135430, 0.000080, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000, 1.000000}, 275.131400, 0.000110, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, -1.000000}, 95.136080, 0.000530, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 1.000000}, 275.131510, 0.001460, 0.089000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, -1.000000}, 95.144820, 0.000800, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 1.000000}, 95.132220, 0.008510, 0.487000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 3.000000}, 275.132310, 0.000020, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, -1.000000}, 275.133480, 0.007720, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, 1.000000}, 95.130890, 0.000060, 0.065000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000, -1.000000}, 275.134130, 0.000940, 0.581000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000, 1.000000}, 275.132150, 0.000080, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 3.000000, -1.000000}, 275.134300, 0.000100, 0.067000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 3.000000, 1.000000}, 275.132280, 0.000010, 0.024000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000, -1.000000}, 95.135680, 0.000040, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000, 1.000000}, 275.131570, 0.000080, 0.098000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, -1.000000}, 95.139030, 0.000100, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, 1.000000}, 95.132230, 0.000330, 0.327000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000, -1.000000}, 275.133560, 0.000330, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 2.000000, -1.000000}, 275.134220, 0.000040, 0.368000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000}, 275.138070, 0.000010, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 76.154820, 0.000030, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 95.130380, 0.000150, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 72.382690, 0.000090, 1.000000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 275.132200, 0.000090, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 95.133390, 0.000070, 1.200000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 75.534110, 0.000020, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000}, 95.133730, 0.000010, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000, -1.000000}, 275.135010, 0.000030, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, -1.000000}, 275.135400, 0.000220, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 1.000000}, 95.127140, 0.000010, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -1.000000}, 95.132430, 0.000410, 0.949000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 1.000000}, 95.131610, 0.000010, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, -1.000000}, 95.134060, 0.000520, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 1.000000}, 95.132280, 0.000050, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000, -1.000000}, 95.134250, 0.000060, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -4.000000, -1.000000}, 95.134560, 0.000020, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -3.000000, -1.000000}, 95.134630, 0.000290, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 1.000000}, 275.131070, 0.000020, 0.077000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -3.000000}, 275.134600, 0.000030, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -1.000000}, 95.134650, 0.004100, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 1.000000}, 275.131120, 0.000420, 3.575000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -3.000000}, 275.134610, 0.000180, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -1.000000}, 95.134590, 0.061740, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 77.021810, 0.000010, 8.850000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 1.000000}, 95.131570, 0.008580, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 3.000000}, 275.131860, 0.000030, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -3.000000}, 275.134720, 0.000470, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -1.000000}, 95.135230, 0.289380, 18.600000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 1.000000}, 95.132250, 0.061540, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 3.000000}, 275.132280, 0.000130, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -3.000000}, 95.136410, 0.000030, 0.073000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -1.000000}, 95.134530, 0.062450, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 1.000000}, 95.132210, 0.006610, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 3.000000}, 275.132280, 0.000030, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -1.000000}, 95.134490, 0.004320, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, 1.000000}, 95.132170, 0.000570, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000, -1.000000}, 95.134500, 0.000310, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000, 1.000000}, 95.132200, 0.000050, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 4.000000, -1.000000}, 95.134560, 0.000020, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, -1.000000}, 95.134980, 0.000040, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, -1.000000}, 95.135600, 0.000280, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, -1.000000}, 275.132120, 0.000460, 1.057000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 1.000000}, 275.132480, 0.000060, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, -1.000000}, 275.134000, 0.000390, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 1.000000}, 275.132280, 0.000040, 0.024000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, -1.000000}, 275.134240, 0.000050, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -1.000000}, 275.133190, 0.000310, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 1.000000}, 275.132280, 0.000040, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -1.000000}, 275.133810, 0.000050, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -1.000000}, 95.132290, 0.000050, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000, -1.000000}, 95.134290, 0.000020, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -2.000000, -1.000000}, 275.134450, 0.000030, 0.354000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, -1.000000}, 275.134320, 0.000220, 0.096000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, 1.000000}, 95.132280, 0.000060, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -1.000000}, 95.134170, 0.000360, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 1.000000}, 95.132280, 0.000060, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000, -1.000000}, 95.134270, 0.000080, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000, 1.000000}, 95.132280, 0.000010, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -3.000000, -1.000000}, 275.134560, 0.000080, 0.066000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, -1.000000}, 275.134550, 0.000790, 0.547000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, 1.000000}, 95.131660, 0.000110, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, -1.000000}, 275.134410, 0.004650, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 1.000000}, 95.132230, 0.001430, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -3.000000}, 95.135050, 0.000030, 0.463000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -1.000000}, 95.133950, 0.005820, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 1.000000}, 95.132230, 0.000840, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, -3.000000}, 275.135580, 0.000010, 0.090000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, -1.000000}, 95.134160, 0.001060, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, 1.000000}, 95.132180, 0.000140, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 2.000000, -1.000000}, 95.134240, 0.000120, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 2.000000, 1.000000}, 95.132280, 0.000020, 0.013000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 3.000000, -1.000000}, 95.134280, 0.000010, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, -1.000000}, 95.133190, 0.000070, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 1.000000}, 275.132280, 0.000010, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, -1.000000}, 275.133490, 0.000080, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 1.000000, -1.000000}, 275.133850, 0.000020, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -2.000000, -1.000000}, 275.134390, 0.000060, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -2.000000, 1.000000}, 95.132280, 0.000030, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -1.000000, -1.000000}, 95.133460, 0.000070, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -1.000000, 1.000000}, 95.132280, 0.000030, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, -1.000000}, 95.133870, 0.000070, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 1.000000}, 95.132280, 0.000010, 0.013000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 1.000000, -1.000000}, 95.134020, 0.000020, 0.016000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000}, 234.686280, 0.000010, 0.040000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000, 0.000000}, 234.688660, 0.000020, 0.087000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 234.675720, 0.000030, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 234.688840, 0.000140, 238.919000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 234.675740, 0.000030, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 234.688870, 0.000020, 0.087000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 234.686430, 0.000010, 0.040000},
+
+static const uint16_t arg[] = {
+20, 80, 82, 83, 311, 346, 350, 379, 1, 418,
+465, 531, 572, 598, 129, 107, 1147, 1153, 16, 22,
+1348, 1441, 1529, 1019, 1594, 1800, 1941, 68, 2043, 2070,
+2203, 2226, 229, 2287, 2371, 2446, 2594, 2720, 2721, 1171,
+2819, 2392, 2942, 3009, 268, 3358, 3466, 3467, 769, 902,
+3894, 13, 15, 2919, 3639, 4475, 24, 4660, 4810, 4881,
+700, 1185, 5049, 5047, 5398, 5399, 4897, 173, 220, 3542,
+205, 128, 6195, 6054, 6196, 6197, 6065, 6198, 84, 5050,
+6753, 6754, 6755, 7463, 1699, 7464, 7465, 7466, 7467, 7468,
+7540, 8432, 8433, 8434, 8386, 8435, 4882, 9842, 2042, 622,
+9843, 9844, 9845, 9846, 9433, 2678, 1487, 115, 709, 654,
+12386, 12387, 12388, 7539, 12389, 12390, 12391, 12392, 12393, 123,
+124, 3569, 12608, 262, 2882, 590, 9969, 9896, 395, 1234,
+1442, 1737, 2503, 2119, 1930, 16699, 16700, 774, 16701, 16179,
+16702, 16703, 16704, 16705, 16706, 122, 125, 462, 3468, 1700,
+133, 436, 648, 21409, 21410, 16846, 21411, 21412, 4010, 21413,
+17071, 16847, 63, 21414, 21415, 21416, 21417, 21418, 174, 175,
+};
+
+static const uint16_t max_arg[] = {
+20, 80, 82, 83, 311, 346, 350, 379, 379, 418,
+465, 531, 572, 598, 598, 598, 1147, 1153, 1153, 1153,
+1348, 1441, 1529, 1529, 1594, 1800, 1941, 1941, 2043, 2070,
+2203, 2226, 2226, 2287, 2371, 2446, 2594, 2720, 2721, 2721,
+2819, 2819, 2942, 3009, 3009, 3358, 3466, 3467, 3467, 3467,
+3894, 3894, 3894, 3894, 3894, 4475, 4475, 4660, 4810, 4881,
+4881, 4881, 5049, 5049, 5398, 5399, 5399, 5399, 5399, 5399,
+5399, 5399, 6195, 6195, 6196, 6197, 6197, 6198, 6198, 6198,
+6753, 6754, 6755, 7463, 7463, 7464, 7465, 7466, 7467, 7468,
+7540, 8432, 8433, 8434, 8434, 8435, 8435, 9842, 9842, 9842,
+9843, 9844, 9845, 9846, 9846, 9846, 9846, 9846, 9846, 9846,
+12386, 12387, 12388, 12388, 12389, 12390, 12391, 12392, 12393, 12393,
+12393, 12393, 12608, 12608, 12608, 12608, 12608, 12608, 12608, 12608,
+12608, 12608, 12608, 12608, 12608, 16699, 16700, 16700, 16701, 16701,
+16702, 16703, 16704, 16705, 16706, 16706, 16706, 16706, 16706, 16706,
+16706, 16706, 16706, 21409, 21410, 21410, 21411, 21412, 21412, 21413,
+21413, 21413, 21413, 21414, 21415, 21416, 21417, 21418, 21418, 21418,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.28938000000000003, 0.062449999999999999, 0.061740000000000003, 0.061539999999999997,
+0.0096299999999999997, 0.0085800000000000008, 0.0085100000000000002, 0.0077200000000000003,
+0.0066100000000000004, 0.0066100000000000004, 0.0058199999999999997, 0.0046499999999999996,
+0.0043200000000000001, 0.0041000000000000003, 0.00181, 0.0015900000000000001,
+0.0014599999999999999, 0.0014300000000000001, 0.0013500000000000001, 0.0011999999999999999,
+0.00106, 0.00093999999999999997, 0.00084000000000000003, 0.00080000000000000004,
+0.00079000000000000001, 0.00064999999999999997, 0.00056999999999999998, 0.00055999999999999995,
+0.00052999999999999998, 0.00051999999999999995, 0.00046999999999999999, 0.00046000000000000001,
+0.00042999999999999999, 0.00042000000000000002, 0.00040999999999999999, 0.00038999999999999999,
+0.00036000000000000002, 0.00033, 0.00033, 0.00031,
+0.00031, 0.00031, 0.00029, 0.00027999999999999998,
+0.00024000000000000001, 0.00023000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001, 0.00017000000000000001,
+0.00017000000000000001, 0.00014999999999999999, 0.00014999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00012999999999999999, 0.00012, 0.00012,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.0001, 0.0001, 0.0001, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.025901456153189235, -0.0055889350832352344, -0.0055254583423188265, -0.005505055966251381,
+-0.0096299999528461511, -0.0007674218187171452, -0.00076125695743639544, 0.00069075707106064192,
+-0.0060275192086705533, -0.00059129244539897637, -0.00052079964265613204, 0.00041613999008584279,
+-0.00038661348231507601, -0.0003669362361691946, -0.0018099984903832934, 0.0014501207874426138,
+0.00013058540674476543, -0.00012792004283930592, -0.0012161963712783923, -0.0010842578011090122,
+-9.4857412680263826e-05, 8.4118347451688565e-05, -7.514184334616572e-05, -7.1738743405431991e-05,
+7.0700974667573522e-05, -0.00064999999999964359, -5.0988513475306362e-05, 0.0005112036205796003,
+-4.744639552699195e-05, -4.653292115842575e-05, 4.2063994104050923e-05, 4.1148225093469485e-05,
+-0.00042999448523234742, 3.7562817561979518e-05, -3.6677801351025706e-05, 3.4899284100265807e-05,
+-3.221578764098591e-05, -2.9520009885993674e-05, 2.9527639417441392e-05, 0.00028301644934581422,
+-2.7743150998675005e-05, 2.7736091650062919e-05, -2.5953925637869525e-05, -2.5063683973350776e-05,
+-0.00021926094367171202, 2.057419251002205e-05, 1.9692129688306376e-05, 1.9687999428369321e-05,
+-0.000174004030489055, -0.00017999999998201266, 1.6109270574820102e-05, 0.00012875332958361624,
+-0.00016094760620493211, 0.00014999999999925977, -1.3413362433361145e-05, -1.2523518874445455e-05,
+-8.0922321154647427e-05, 1.1629207795152536e-05, 0.00011999999999812844, -1.0738741899769357e-05,
+0.00010036853378808719, -0.00010999999999999834, 9.8384161971299619e-06, -9.8389133606440442e-06,
+8.9477347538675295e-06, 8.9490558827309584e-06, -8.9572781361747879e-06, -8.0708588511159903e-05,
+2.7239206641206592e-05, 8.0508648521225439e-06, -7.188054298734699e-05, -7.1908083103917956e-05,
+-7.1608161518724363e-06, 7.1562547797095171e-06, 7.1554481931668985e-06, -7.1592029863498225e-06,
+7.1596062780056727e-06, 7.1581182699517993e-06, -6.390404335142403e-05, -6.2632318031946294e-06,
+-6.2629884371109591e-06, -6.2633169813058809e-06, -6.2638158814840628e-06, 5.3659916344307483e-06,
+-5.3658769042838914e-06, -5.3693813798440625e-06, 5.3675352744836479e-06, -5.3673266746857937e-06,
+-5.3673266746857937e-06, 5.3695273992584153e-06, -4.9999999999850742e-05, -4.4727722289048288e-06,
+-4.4727026956236082e-06, 4.4744757915705157e-06, 4.4741020512299229e-06, -4.4727809205643696e-06,
+-4.0000000000000003e-05, -3.5783012230482605e-06, 3.5782177831238579e-06, 8.9596519499580036e-06,
+-3.5805819082356497e-06, 3.5795667266436085e-06, -3.580095177625436e-06, 3.5782177831238579e-06,
+3.5782177831238579e-06, 2.737323005983524e-05, 2.7473321898734928e-05, -2.5737808032633121e-05,
+6.7484959177828162e-06, 7.1789748398384645e-06, 2.6850870281397938e-06, 2.6848732141599363e-06,
+2.6834443074486872e-06, -2.6858171236199054e-06, 2.6836633373428935e-06, 2.6847949894988254e-06,
+-2.6851078880328845e-06, -2.6836633373428968e-06, -2.6836633373428968e-06, -1.7346102714089847e-05,
+-1.7346094170081051e-05, -1.9999999999707264e-05, 2.0000000000000002e-05, 1.830741873290841e-05,
+1.8361697455929635e-05, 1.9484892613222318e-05, -1.999999999296212e-05, 1.999999999982454e-05,
+-1.8257520124714608e-05, 1.9563972553245324e-05, -1.827147134158645e-05, 1.8083337821891832e-05,
+1.8247904317207238e-05, -1.9999999999997261e-05, -1.9999999999865666e-05, 1.7895504274304675e-06,
+1.7891193215532189e-06, 4.9960718126727222e-06, -1.7899015695013985e-06, 1.7886882148380005e-06,
+-1.7899015695013985e-06, -1.7898076998933342e-06, -1.7891088915619315e-06, 1.789654727113549e-06,
+-1.7897138302455288e-06, -1.1560382865828188e-05, -1.1560323048125445e-05, -9.1280281701313528e-06,
+9.1244057347209717e-06, 1.0000000000000001e-05, -9.9892207250122037e-06, 9.8715933183751765e-06,
+9.130345415885106e-06, 8.9441711747413051e-07, -8.9455444578096576e-07, -8.9335672862190815e-07,
+-8.9559570171147e-07, 8.9455444578096449e-07, 8.9556093539422916e-07, -8.9480650362310229e-07,
+-8.936609395748606e-07, -8.9443797748106217e-07, 2.2458013794190647e-06, -8.9455444578096576e-07,
+8.9512809383101615e-07, -8.9490211162021228e-07, 8.9455444578096449e-07, -8.9455444578096576e-07,
+-5.7805303944693849e-06, -5.7805090316406511e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.28821849171964042, 0.062199407590710881, 0.061492250813474862, 0.061293278251439931,
+-9.5298642194701079e-07, 0.0085456107887123475, 0.0084758827177323949, -0.0076890347033148265,
+0.0027131369646789878, 0.0065835000754928298, 0.0057966514240731471, -0.0046313418691186414,
+0.0043026654547259667, 0.0040835472078312, -2.3376933502093284e-06, -0.00065211172495732196,
+-0.0014541483595373974, 0.0014242669913467735, 0.00058597473195460474, 0.00051418383943318321,
+0.0010557471625628962, -0.00093622865990205455, 0.00083663235855334947, 0.00079677697801493338,
+-0.0007868299512480795, -6.8067840800288689e-10, 0.00056771486812798777, -0.00022862820977803246,
+0.00052787199163385832, 0.00051791378360540252, -0.00046811389682428181, -0.00045815589439802821,
+2.1777671520457478e-06, -0.00041831690706545135, 0.00040835614221908635, -0.0003884353742507097,
+0.00035855563449299036, 0.00032867699800310157, -0.0003286763126701308, 0.00012649778416908412,
+0.00030875608102945071, -0.0003087567152629709, 0.00028883627497941445, 0.00027887597914787139,
+9.7594254852375017e-05, -0.00022907794001728006, -0.0002191169094988767, -0.0002191172806478497,
+4.6071654773450716e-05, 2.5446900493347824e-09, -0.00017927769354146442, 0.00011100711743457128,
+-5.473452344637802e-05, -4.7123889807253866e-10, 0.00014939906863240912, 0.00013943873735444324,
+-0.0001142435028303321, -0.00012947880724681227, -6.7020643277719296e-10, 0.00011951853171123773,
+-4.501285844322265e-05, 1.919862176362043e-11, -0.00010955914186745008, 0.00010955909722100552,
+-9.9598885750667071e-05, -9.9598767054656653e-05, 9.9598027934247801e-05, 3.9826169041677467e-05,
+8.5778934602603036e-05, -8.9639185489008417e-05, 3.5116770065656133e-05, 3.5060342045108884e-05,
+7.9678872432026069e-05, -7.9679282235270454e-05, -7.9679354673308606e-05, 7.9679017392286159e-05,
+-7.9678981155283001e-05, -7.9679114847200605e-05, 2.8570496028933713e-05, 6.9719236422808374e-05,
+6.9719258285186981e-05, 6.9719228770775165e-05, 6.9719183949633738e-05, -5.9759569390845008e-05,
+5.9759579692699254e-05, 5.9759264918485933e-05, -5.9759430762660163e-05, 5.9759449498528739e-05,
+5.9759449498528739e-05, -5.9759251798433797e-05, 1.2217304764017923e-10, 4.9799541248773951e-05,
+4.9799547493893573e-05, -4.9799388213015725e-05, -4.9799421792177271e-05, 4.9799540468127171e-05,
+4.8985871965894129e-21, 3.9839625504729985e-05, -3.9839632999019164e-05, 3.8983645762493971e-05,
+3.9839420593156422e-05, -3.9839511819919511e-05, 3.9839464335243557e-05, -3.9839632999019164e-05,
+-3.9839632999019164e-05, 1.2276248453470319e-05, -1.2050584377883586e-05, -1.5413151451774095e-05,
+2.9231110188422004e-05, 2.9128376546745037e-05, -2.9879596845528481e-05, -2.9879616058843302e-05,
+-2.9879744420741307e-05, 2.98795312275556e-05, -2.9879724749264369e-05, -2.9879623087722541e-05,
+2.9879594970976827e-05, 2.9879724749264369e-05, 2.9879724749264369e-05, -2.447677921280177e-05,
+-2.4476785267732364e-05, -1.0821041362220989e-10, 0, -8.0522307057084741e-06,
+7.927677247271561e-06, -4.5098735959220037e-06, -5.3058009254340536e-10, -8.377580411188701e-11,
+8.1647387524427965e-06, 4.1534296594337207e-06, 8.1334700475003377e-06, -8.543587842314054e-06,
+-8.1862071822089542e-06, -1.0471975515395297e-11, -7.3303828586774922e-11, -1.9919776837798245e-05,
+-1.9919815562731624e-05, 1.9365930559686956e-05, 1.991974528882075e-05, -1.9919854278334962e-05,
+1.991974528882075e-05, 1.9919753723312008e-05, 1.9919816499509582e-05, -1.9919767467461063e-05,
+1.9919762157360915e-05, -1.6320464086399816e-05, -1.6320506457306394e-05, 4.0840055980971026e-06,
+4.0920923728810253e-06, 0, -4.6418671565080291e-07, -1.597387040328856e-06,
+-4.0788224509808986e-06, -9.959920583015172e-06, 9.9599082497547909e-06, 9.9600157507619427e-06,
+9.9598146739322395e-06, -9.9599082497547909e-06, -9.9598178000903125e-06, 9.9598856078307345e-06,
+9.9599884600876023e-06, 9.9599187097304974e-06, 9.7445562322867964e-06, 9.9599082497547909e-06,
+-9.9598567105975208e-06, 9.9598770178460386e-06, -9.9599082497547909e-06, 9.9599082497547909e-06,
+-8.1599919337347165e-06, -8.1600070670999348e-06,
+};
+
+const struct elp_table elp16 = {
+    arg, max_arg, amp, c, s, 170
 };
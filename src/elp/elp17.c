@@ -1,153 +1,164 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp17[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 0.000020, 0.000680, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000410, 5.997000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 180.000010, 0.000390, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000}, 180.001340, 0.000010, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000}, 180.000030, 0.000050, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 155.901410, 0.000070, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 155.893880, 0.000060, 0.857000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 155.968620, 0.000060, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 155.967260, 0.000060, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 155.890290, 0.000050, 1.200000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000}, 155.898640, 0.000060, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -1.000000}, 24.155180, 0.000010, 0.487000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 1.000000}, 24.155030, 0.000010, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 1.000000}, 168.916350, 0.000010, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, -1.000000}, 335.844750, 0.000070, 18.600000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 1.000000}, 335.844940, 0.000070, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 1.000000}, 24.070780, 0.000010, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, -1.000000}, 25.707420, 0.000060, 0.097000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000, -1.000000}, 180.000140, 0.000010, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, -1.000000}, 179.999890, 0.000110, 0.515000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 1.000000}, 180.000010, 0.000070, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -1.000000}, 359.999760, 0.000570, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 1.000000}, 179.999980, 0.000030, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -1.000000}, 359.999560, 0.000020, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, -1.000000}, 335.902940, 0.000020, 1.063000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 1.000000}, 335.899440, 0.000020, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -1.000000}, 335.905980, 0.000060, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, -1.000000}, 156.004240, 0.000010, 16.885000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 1.000000}, 156.003930, 0.000010, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, -1.000000}, 335.589470, 0.000020, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, -1.000000, 1.000000, 0.000000}, 275.132280, 0.000010, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, -1.000000, 0.000000}, 95.132280, 0.000040, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 0.000000, 0.000000}, 95.132310, 0.000290, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 0.000000, 2.000000}, 95.132250, 0.000010, 0.108000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 1.000000, 0.000000}, 95.132230, 0.000500, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 2.000000, 0.000000}, 95.132170, 0.000040, 0.104000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 1.000000, 0.000000, 0.000000}, 95.132280, 0.000030, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 1.000000, 1.000000, 0.000000}, 95.132280, 0.000040, 0.046000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000}, 275.132280, 0.000030, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 1.000000}, 77.052900, 0.000030, 0.097000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000, 0.000000}, 275.132280, 0.000020, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -2.000000, 0.000000, 0.000000}, 275.131050, 0.000020, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, -1.000000, 0.000000}, 275.132280, 0.000060, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, 0.000000}, 275.132210, 0.000960, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, 2.000000}, 275.132320, 0.000010, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 1.000000, 0.000000}, 275.132280, 0.000060, 1.127000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -3.000000, 0.000000}, 95.132280, 0.000010, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000, 0.000000}, 95.132510, 0.000170, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, -2.000000}, 95.135300, 0.000060, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 0.000000}, 95.132360, 0.002640, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 2.000000}, 275.131750, 0.000080, 0.450000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, -2.000000}, 95.136840, 0.000140, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000}, 95.132260, 0.048340, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 2.000000}, 95.132250, 0.000500, 0.065000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, -2.000000}, 275.132860, 0.000240, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, 0.000000}, 95.132240, 0.012090, 0.530000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, 2.000000}, 95.132290, 0.000070, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000, 0.000000}, 95.132160, 0.001080, 0.066000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 3.000000, 0.000000}, 95.132040, 0.000100, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 4.000000, 0.000000}, 95.132280, 0.000010, 0.024000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000, 0.000000}, 95.132390, 0.000140, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, -2.000000}, 95.136410, 0.000010, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, 0.000000}, 95.132280, 0.002270, 0.096000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, 2.000000}, 95.132300, 0.000020, 0.061000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000, -2.000000}, 275.132870, 0.000010, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000, 0.000000}, 95.132230, 0.000540, 0.346000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 2.000000, 0.000000}, 95.132170, 0.000050, 0.062000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 0.000000, 0.000000}, 95.132280, 0.000080, 0.107000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 2.000000, 1.000000, 0.000000}, 95.132280, 0.000020, 0.257000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000}, 95.132280, 0.000060, 99999.999000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 275.132280, 0.000040, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 257.755660, 0.000020, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 275.132280, 0.000350, 1.000000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 257.755660, 0.000020, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 275.132280, 0.000030, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000, 0.000000}, 275.132280, 0.000020, 0.071000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, -2.000000}, 275.135520, 0.000010, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 0.000000}, 275.132370, 0.000380, 1.127000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -2.000000}, 95.131340, 0.000010, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000}, 275.131750, 0.000440, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, -2.000000}, 95.134010, 0.000020, 0.819000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 0.000000}, 275.132140, 0.000480, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000, 0.000000}, 275.132160, 0.000060, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -3.000000, -2.000000}, 95.134610, 0.000030, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -3.000000, 0.000000}, 95.132120, 0.000150, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -2.000000}, 95.134640, 0.000370, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000}, 95.132090, 0.002940, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 2.000000}, 275.131830, 0.000040, 0.073000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -2.000000}, 95.134670, 0.003250, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 95.132340, 0.077550, 8.850000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 2.000000}, 95.131920, 0.000750, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -4.000000}, 275.134850, 0.000010, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -2.000000}, 95.135100, 0.009170, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 275.132260, 1.374970, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 2.000000}, 95.132230, 0.001420, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -2.000000}, 95.134720, 0.001980, 4.535000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000}, 275.132170, 0.072450, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 2.000000}, 95.132230, 0.000230, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -2.000000}, 95.134900, 0.000130, 0.077000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, 0.000000}, 275.132070, 0.004270, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, 2.000000}, 95.132280, 0.000030, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000, -2.000000}, 95.134770, 0.000010, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000, 0.000000}, 275.131970, 0.000260, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 4.000000, 0.000000}, 275.132030, 0.000020, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 0.000000}, 95.132280, 0.000020, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, -2.000000}, 95.135500, 0.000020, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 0.000000}, 95.132310, 0.000440, 0.898000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000}, 95.132930, 0.000370, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, -2.000000}, 275.134100, 0.000010, 1.283000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 0.000000}, 95.132200, 0.000370, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, 0.000000}, 95.132160, 0.000040, 0.024000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 275.132280, 0.000010, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -1.000000}, 77.148570, 0.000010, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 95.132230, 0.000390, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000}, 95.132280, 0.000050, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000}, 275.132280, 0.000060, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, -1.000000, 0.000000}, 275.132280, 0.000020, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000}, 275.132280, 0.000030, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, -2.000000}, 275.134460, 0.000010, 0.334000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, 0.000000}, 275.132280, 0.000670, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -2.000000}, 95.135440, 0.000030, 0.097000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000}, 275.132200, 0.000580, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000, 0.000000}, 275.132100, 0.000080, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -3.000000, -2.000000}, 275.134560, 0.000010, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -3.000000, 0.000000}, 275.132280, 0.000020, 0.602000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, -2.000000}, 275.134570, 0.000070, 0.066000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, 0.000000}, 95.132670, 0.000120, 0.086000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, 2.000000}, 95.131910, 0.000020, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, -2.000000}, 275.134560, 0.000260, 0.501000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 0.000000}, 275.132280, 0.015040, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 2.000000}, 95.132280, 0.000060, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -2.000000}, 95.135710, 0.000500, 0.089000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000}, 275.132200, 0.008490, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 2.000000}, 95.132280, 0.000030, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, -2.000000}, 95.134460, 0.000140, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, 0.000000}, 275.132100, 0.001050, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 2.000000, -2.000000}, 95.134330, 0.000020, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 2.000000, 0.000000}, 275.132000, 0.000100, 0.015000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 3.000000, 0.000000}, 275.132280, 0.000010, 0.013000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 0.000000}, 95.132340, 0.000100, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000}, 95.132200, 0.000090, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 1.000000, 0.000000}, 95.132280, 0.000020, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000}, 95.132280, 0.000020, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, -1.000000, -2.000000, 0.000000}, 275.132280, 0.000020, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, -1.000000, -1.000000, 0.000000}, 275.132280, 0.000030, 0.021000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, -1.000000, 0.000000, 0.000000}, 275.132280, 0.000010, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -2.000000, 0.000000}, 275.132310, 0.000180, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -1.000000, 0.000000}, 275.132230, 0.000220, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, 0.000000}, 275.132140, 0.000080, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 1.000000, 0.000000}, 275.132280, 0.000020, 0.013000},
+
+static const uint16_t arg[] = {
+2, 63, 66, 101, 232, 276, 322, 354, 577, 693,
+736, 784, 867, 952, 1162, 1334, 1359, 1427, 1655, 1750,
+1772, 1928, 696, 2019, 2116, 2118, 2117, 2169, 2285, 2286,
+2370, 2394, 1446, 2504, 2559, 2560, 2561, 220, 2941, 3139,
+3140, 3278, 3357, 3465, 3893, 4041, 4326, 4472, 4476, 4477,
+4661, 4883, 1154, 5400, 5401, 5402, 5748, 6199, 6200, 6201,
+6202, 222, 931, 932, 1077, 6756, 6757, 247, 274, 227,
+258, 65, 154, 7469, 7470, 7471, 7472, 7473, 7474, 7475,
+7246, 267, 8436, 4708, 9847, 9848, 9849, 654, 9850, 9851,
+1570, 12394, 709, 2042, 774, 12395, 12396, 12397, 12398, 12399,
+12400, 3464, 953, 686, 1756, 622, 16707, 16708, 16709, 3639,
+3542, 16710, 16711, 16712, 16713, 16714, 16715, 16716, 16717, 16718,
+16719, 10084, 16720, 16721, 8384, 12401, 8437, 4478, 187, 4280,
+2049, 1946, 21419, 21420, 21421, 21422, 21423, 21424, 21425, 21426,
+21427, 21428, 21429, 21430, 830, 2392, 21431, 21432, 21433, 21434,
+};
+
+static const uint16_t max_arg[] = {
+2, 63, 66, 101, 232, 276, 322, 354, 577, 693,
+736, 784, 867, 952, 1162, 1334, 1359, 1427, 1655, 1750,
+1772, 1928, 1928, 2019, 2116, 2118, 2118, 2169, 2285, 2286,
+2370, 2394, 2394, 2504, 2559, 2560, 2561, 2561, 2941, 3139,
+3140, 3278, 3357, 3465, 3893, 4041, 4326, 4472, 4476, 4477,
+4661, 4883, 4883, 5400, 5401, 5402, 5748, 6199, 6200, 6201,
+6202, 6202, 6202, 6202, 6202, 6756, 6757, 6757, 6757, 6757,
+6757, 6757, 6757, 7469, 7470, 7471, 7472, 7473, 7474, 7475,
+7475, 7475, 8436, 8436, 9847, 9848, 9849, 9849, 9850, 9851,
+9851, 12394, 12394, 12394, 12394, 12395, 12396, 12397, 12398, 12399,
+12400, 12400, 12400, 12400, 12400, 12400, 16707, 16708, 16709, 16709,
+16709, 16710, 16711, 16712, 16713, 16714, 16715, 16716, 16717, 16718,
+16719, 16719, 16720, 16721, 16721, 16721, 16721, 16721, 16721, 16721,
+16721, 16721, 21419, 21420, 21421, 21422, 21423, 21424, 21425, 21426,
+21427, 21428, 21429, 21430, 21430, 21430, 21431, 21432, 21433, 21434,
+};
+
+static const double ELP_ALIGNED amp[] = {
+1.37497, 0.077549999999999994, 0.072450000000000001, 0.048340000000000001,
+0.01504, 0.01209, 0.0091699999999999993, 0.0084899999999999993,
+0.0042700000000000004, 0.0032499999999999999, 0.0029399999999999999, 0.00264,
+0.0022699999999999999, 0.00198, 0.00142, 0.00108,
+0.0010499999999999999, 0.00096000000000000002, 0.00075000000000000002, 0.00068000000000000005,
+0.00067000000000000002, 0.00058, 0.00056999999999999998, 0.00054000000000000001,
+0.00050000000000000001, 0.00050000000000000001, 0.00050000000000000001, 0.00048000000000000001,
+0.00044000000000000002, 0.00044000000000000002, 0.00040999999999999999, 0.00038999999999999999,
+0.00038999999999999999, 0.00038000000000000002, 0.00036999999999999999, 0.00036999999999999999,
+0.00036999999999999999, 0.00035, 0.00029, 0.00025999999999999998,
+0.00025999999999999998, 0.00024000000000000001, 0.00023000000000000001, 0.00022000000000000001,
+0.00018000000000000001, 0.00017000000000000001, 0.00014999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00012999999999999999, 0.00012,
+0.00011, 0.0001, 0.0001, 0.0001,
+9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.12299807460068866, -0.0069373506116119045, 0.0064809084233086204, -0.0043242593847119147,
+0.0013454098864545704, -0.0010815079183757526, -0.00082075594799231415, 0.00075946491771689321,
+0.00038195916072356826, -0.00029086521955784544, -0.00026298929673604468, -0.00023616604504296353,
+-0.00020306385919227919, -0.00017720576239578837, -0.0001270254970851849, -9.6609627265962231e-05,
+9.392493135920603e-05, 8.5876058635856847e-05, -6.7086889936059959e-05, 0.00067999999999995863,
+5.9935147867324614e-05, 5.1883351269234164e-05, 0.00056999999999499942, -4.8305470722535101e-05,
+-4.4727287706051021e-05, -4.4727461539253993e-05, -4.4757534601337671e-05, 4.2937445238306882e-05,
+3.9356341822637782e-05, -3.9360625074170866e-05, -0.00040999999999999999, -0.00038999999999999408,
+-3.4887284410719795e-05, 3.3993663449151877e-05, -3.3113693580153088e-05, -3.3102695180037135e-05,
+-3.3097999947614699e-05, 3.1309405602333751e-05, -2.5942230162521705e-05, 2.3257014494436092e-05,
+2.3268720403518433e-05, 2.1471726455677895e-05, -2.057455234478347e-05, 1.9680006590662377e-05,
+1.6102073893978968e-05, -1.5208105265935231e-05, -1.3417899487001001e-05, -1.2534859712245664e-05,
+-1.2524029944026392e-05, -1.2529067620891718e-05, -1.1635128541516859e-05, -1.0735466888462218e-05,
+-0.00010999999999979727, -8.9451272580700163e-06, 8.9450577247648162e-06, -8.9456487577200577e-06,
+-8.0508648521224948e-06, 7.15569851320687e-06, -7.1564355662477261e-06, 7.1561852464156986e-06,
+7.1562408730511478e-06, -6.3899095793336892e-05, 6.3870800147512805e-05, 6.3870895136702686e-05,
+-6.9999999999998923e-05, -6.2618932887901161e-06, 6.2646676615347419e-06, -5.4767433393276473e-05,
+-5.4799353441574031e-05, -5.4798773443934136e-05, -5.4769469078938212e-05, 5.406125120562505e-05,
+5.477260739956223e-05, 5.3673266746857869e-06, 5.3673266746857869e-06, -5.3704765246703466e-06,
+-5.3673266746857937e-06, 5.3672015147756986e-06, 5.3673266746857869e-06, -5.3673266746857937e-06,
+-4.9999999999993145e-05, -4.563824818806469e-05, -4.472676620640909e-06, -4.4727722289048288e-06,
+-3.578217783123863e-06, -3.5781412965127277e-06, -3.578217783123863e-06, 3.5782177831238579e-06,
+3.5779048832676227e-06, -3.5781343431837865e-06, -2.9999999999998171e-05, -2.6836633373428968e-06,
+2.6836633373428935e-06, 6.7215402901099349e-06, 2.6836633373428935e-06, -2.6848784291366873e-06,
+-2.6836633373428968e-06, 2.6836633373428935e-06, -2.685311271922129e-06, -2.6836633373428968e-06,
+2.6836633373428935e-06, 1.9999999999410263e-05, 1.8257102571230855e-05, 1.8256603724625989e-05,
+1.8212154475702247e-05, 1.789108891561929e-06, 1.788681261497008e-06, -1.7891158448895096e-06,
+-1.7891088915619315e-06, -4.2416226945056708e-06, -4.2416226945056708e-06, 1.789108891561929e-06,
+-1.7897103535911426e-06, 1.7890219749488133e-06, -1.7891088915619315e-06, -1.7902283744934611e-06,
+1.789108891561929e-06, 1.789108891561929e-06, -1.7889802549624375e-06, -1.7898216065044507e-06,
+-1.7891088915619315e-06, -1.7891088915619315e-06, 1.789108891561929e-06, 1.789108891561929e-06,
+-9.9999999972651449e-06, 9.1244050205159805e-06, 9.1244157335616604e-06, -9.8134756236257629e-06,
+9.1304230101135915e-06, -9.999999999970148e-06, -9.135755544500607e-06, -9.1357335414544934e-06,
+8.9455444578096449e-07, -8.9454923078507994e-07, 8.9456139910843359e-07, -8.9455444578096576e-07,
+-8.9455444578096576e-07, -8.9527237453996855e-07, 8.9465700731691334e-07, 8.9511766389296196e-07,
+-8.9439104245995803e-07, 8.9500119618474244e-07, -8.9498728958454279e-07, 8.9487082173932734e-07,
+8.9455444578096449e-07, 2.2242372457543147e-06, 8.9493340149226668e-07, 8.9495078475070909e-07,
+8.9455444578096449e-07, 8.9455444578096449e-07,
+};
+
+static const double ELP_ALIGNED s[] = {
+-1.3694575475510453, 0.077239081212114161, -0.072159547712057404, 0.04814619798876886,
+-0.014979702007631204, 0.012041529828991437, 0.0091331954798873766, -0.0084559631644631258,
+-0.0042528822226273032, 0.0032369580510182034, 0.0029282138975495419, 0.0026294154481878219,
+0.0022608991726943369, 0.0019720542887491023, 0.0014143070823163764, 0.0010756702933146067,
+-0.001045790661303288, -0.00095615129689457146, 0.00074699354026571546, 2.3736477827122404e-10,
+-0.00066731385273357093, -0.00057767475092916534, -2.3876104171887791e-09, 0.00053783508764143899,
+0.0004979954515198509, 0.00049799543590705177, 0.00049799273397953313, -0.00047807570090562792,
+-0.00043823632706376555, 0.00043823594238009571, 5.0210518765041483e-20, -6.8067840875962966e-11,
+0.00038843645218548364, -0.00037847646009402726, 0.00036851524160810465, 0.00036851622972647698,
+0.0003685166514548124, -0.00034859678874141762, 0.00028883732565960851, -0.00025895774032997271,
+-0.00025895668875466969, -0.00023903758065001526, 0.00022907790769913141, -0.00021911799866873439,
+-0.00017927834006458462, 0.00016931837919794839, 0.00014939866121674831, 0.00013943771832611976,
+0.00013943869145241261, 0.00013943823888930583, 0.00012947827533537192, 0.00011951882592582112,
+2.1118483950923402e-10, 9.9599119967683119e-05, -9.959912621253575e-05, 9.9599073129741039e-05,
+8.963918548900843e-05, -7.9679332193411919e-05, 7.9679265998038328e-05, -7.9679288480250519e-05,
+-7.9679283484271329e-05, 2.8581559733400742e-05, -2.8644735790655809e-05, -2.8644523986904161e-05,
+-1.2217304772608736e-11, 6.9719356655378029e-05, -6.9719107417482909e-05, 2.4505677699525583e-05,
+2.4434214994254442e-05, 2.4435515731008815e-05, 2.4501127664073579e-05, 2.6026546410968637e-05,
+-2.4494111101516241e-05, -5.9759449498528739e-05, -5.9759449498528739e-05, 5.9759166509398075e-05,
+5.9759449498528739e-05, -5.9759460739700368e-05, -5.9759449498528739e-05, 5.9759449498528739e-05,
+-2.6179938788488238e-11, 2.0424257693355962e-05, 4.9799549835788399e-05, 4.9799541248773951e-05,
+3.9839632999019164e-05, 3.9839639868630719e-05, 3.9839632999019164e-05, -3.9839632999019164e-05,
+-3.9839661101047159e-05, 3.9839640493133583e-05, 1.0471975517077902e-11, 2.9879724749264369e-05,
+-2.9879724749264369e-05, 2.9237320262439047e-05, -2.9879724749264369e-05, 2.9879615590244069e-05,
+2.9879724749264369e-05, -2.9879724749264369e-05, 2.9879576693334996e-05, 2.9879724749264369e-05,
+-2.9879724749264369e-05, -1.5358897418221998e-10, -8.165672397516066e-06, -8.1667876452110902e-06,
+-8.26543582354607e-06, -1.9919816499509582e-05, -1.9919854902703723e-05, 1.991981587499155e-05,
+1.9919816499509582e-05, -1.9545041236013153e-05, -1.9545041236013153e-05, -1.9919816499509582e-05,
+1.9919762469724602e-05, -1.9919824305780165e-05, 1.9919816499509582e-05, 1.9919715920844821e-05,
+-1.9919816499509582e-05, -1.9919816499509582e-05, 1.9919828052655337e-05, 1.9919752473785657e-05,
+1.9919816499509582e-05, 1.9919816499509582e-05, -1.9919816499509582e-05, -1.9919816499509582e-05,
+-2.3387411974572865e-10, 4.0920939653901868e-06, 4.0920700777396791e-06, 1.9224193570870469e-06,
+4.0786487537404198e-06, -2.4434609525586556e-11, 4.0666903780748328e-06, 4.0667398072096216e-06,
+-9.9599082497547909e-06, 9.9599087181410375e-06, -9.9599076252355456e-06, 9.9599082497547909e-06,
+9.9599082497547909e-06, 9.9598437425185328e-06, -9.9598990376036837e-06, -9.9598576479680074e-06,
+9.9599229245595769e-06, -9.9598681145298253e-06, 9.9598693641775309e-06, -9.9598798292147878e-06,
+-9.9599082497547909e-06, 9.7495009448996562e-06, -9.9598742063789896e-06, -9.9598726444103752e-06,
+-9.9599082497547909e-06, -9.9599082497547909e-06,
+};
+
+const struct elp_table elp17 = {
+    arg, max_arg, amp, c, s, 150
 };
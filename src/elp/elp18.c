@@ -1,117 +1,131 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp18[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.027020, 99999.999000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000}, 270.000300, 0.000040, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000}, 89.999620, 0.000100, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 89.997520, 0.010350, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 90.000070, 0.000530, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000}, 89.999790, 0.000030, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 245.887100, 0.000070, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 244.233790, 0.001260, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 64.429400, 0.001120, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000}, 65.901690, 0.000060, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 0.000000}, 114.155070, 0.000030, 0.530000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000}, 294.141830, 0.000250, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 261.052170, 0.000020, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 0.000000}, 66.292360, 0.000030, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 0.000000}, 65.777390, 0.000080, 8.850000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000}, 245.786310, 0.001470, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 0.000000}, 245.844950, 0.000080, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000}, 114.064750, 0.000030, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 0.000000}, 301.712510, 0.000290, 0.095000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000}, 105.063900, 0.000220, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000}, 270.000210, 0.000220, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, -2.000000}, 89.999750, 0.000020, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 90.094720, 0.001660, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -2.000000}, 89.999740, 0.000020, 0.474000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 89.730460, 0.000570, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000}, 90.000030, 0.000070, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, 0.000000}, 65.876750, 0.000040, 1.292000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 0.000000}, 246.392670, 0.000510, 0.080000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000}, 63.779870, 0.000100, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 0.000000}, 66.003910, 0.000230, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -2.000000, 0.000000}, 89.999260, 0.000020, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000}, 90.000010, 0.000020, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 0.000000, -1.000000}, 185.136030, 0.000030, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 0.000000, 1.000000}, 185.132160, 0.000080, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 1.000000, -1.000000}, 5.132270, 0.000020, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 1.000000, 1.000000}, 185.132510, 0.000040, 0.106000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -3.000000, 0.000000, 2.000000, -1.000000}, 5.133520, 0.000070, 0.043000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000}, 166.994390, 0.000040, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 1.000000}, 5.132280, 0.000030, 0.097000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 1.000000, 0.000000}, 167.073450, 0.000020, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, -1.000000}, 5.136660, 0.000030, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, -1.000000, 0.000000, 1.000000}, 185.132280, 0.000020, 0.949000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000, -1.000000}, 185.134700, 0.000070, 0.019000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -2.000000, 1.000000}, 5.131420, 0.000070, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, -1.000000}, 185.134980, 0.000660, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 1.000000}, 5.131380, 0.001010, 0.089000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, -1.000000}, 185.136030, 0.003280, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 1.000000}, 5.132370, 0.001490, 0.487000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, -1.000000}, 5.133430, 0.006480, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, 1.000000}, 5.132170, 0.001330, 0.065000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000, -1.000000}, 185.134140, 0.001100, 0.581000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 2.000000, 1.000000}, 5.132280, 0.000070, 0.035000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 3.000000, -1.000000}, 185.134340, 0.000100, 0.067000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000, -1.000000}, 185.135050, 0.000050, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, -1.000000, 1.000000}, 5.131420, 0.000050, 0.098000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, -1.000000}, 185.136100, 0.000220, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, 1.000000}, 5.132280, 0.000100, 0.327000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000, -1.000000}, 5.133540, 0.000250, 0.095000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 1.000000, 1.000000}, 5.132280, 0.000050, 0.061000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 2.000000, -1.000000}, 185.134330, 0.000040, 0.368000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 165.969050, 0.000020, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000}, 185.130430, 0.000140, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 185.132280, 0.000120, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 5.133340, 0.000030, 1.200000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 345.969050, 0.000020, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000, -1.000000}, 5.134930, 0.000030, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, -1.000000}, 5.135440, 0.000210, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 1.000000}, 185.133860, 0.000020, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -1.000000}, 185.132270, 0.000040, 0.949000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 1.000000}, 185.132280, 0.000030, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, -1.000000}, 5.134040, 0.000460, 0.082000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000, -1.000000}, 5.134270, 0.000040, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -3.000000, -1.000000}, 185.134560, 0.000190, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -1.000000}, 185.134590, 0.003110, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 1.000000}, 185.131930, 0.000820, 3.575000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -1.000000}, 185.134590, 0.057030, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 1.000000}, 5.131900, 0.014470, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -1.000000}, 185.129890, 0.001830, 18.600000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 1.000000}, 185.133090, 0.000350, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -3.000000}, 185.135040, 0.000100, 0.073000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -1.000000}, 5.134530, 0.057650, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -1.000000}, 5.134530, 0.003140, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000, -1.000000}, 5.134560, 0.000190, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, -1.000000}, 185.134940, 0.000030, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, -1.000000}, 185.135590, 0.000250, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 1.000000}, 5.133040, 0.000040, 0.069000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, -1.000000}, 185.132270, 0.000040, 1.057000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 1.000000}, 185.132280, 0.000020, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, -1.000000}, 185.134020, 0.000370, 0.070000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, -1.000000}, 185.134280, 0.000040, 0.036000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -1.000000}, 185.133190, 0.000270, 0.081000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -1.000000}, 185.133870, 0.000030, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -1.000000}, 5.132290, 0.000040, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -2.000000, -1.000000}, 5.134330, 0.000040, 0.354000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, -1.000000}, 185.134380, 0.000150, 0.096000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -1.000000}, 5.134690, 0.000350, 0.042000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000, -1.000000}, 5.134570, 0.000060, 0.027000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -3.000000, -1.000000}, 5.134510, 0.000090, 0.066000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, -1.000000}, 5.134560, 0.000910, 0.547000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -2.000000, 1.000000}, 5.131870, 0.000140, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, -1.000000}, 185.134560, 0.003510, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 1.000000}, 5.131830, 0.000110, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -1.000000}, 5.134690, 0.005030, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 1.000000, -1.000000}, 5.134620, 0.000760, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 2.000000, -1.000000}, 5.134700, 0.000070, 0.020000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, -1.000000}, 5.133210, 0.000050, 0.080000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, -1.000000}, 185.134510, 0.000060, 0.039000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -2.000000, -1.000000}, 185.134450, 0.000040, 0.044000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, -1.000000, -1.000000}, 5.132270, 0.000020, 0.028000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 0.000000, 0.000000, -1.000000}, 5.134720, 0.000040, 0.020000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, -2.000000, 0.000000, 0.000000, 0.000000}, 324.685940, 0.000030, 0.040000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000}, 324.677090, 0.000030, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 144.677090, 0.000030, 0.075000},
-{{0.000000, 8.000000, -13.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 144.686110, 0.000030, 0.040000},
+
+static const uint16_t arg[] = {
+80, 82, 240, 346, 311, 379, 465, 531, 1019, 572,
+598, 20, 129, 350, 107, 1699, 16, 22, 1441, 1147,
+1594, 2287, 1348, 2043, 229, 1800, 68, 2070, 2446, 83,
+2594, 13, 2392, 1171, 2721, 3009, 268, 15, 902, 4897,
+3466, 2942, 2819, 3467, 3639, 5047, 3542, 1153, 4810, 84,
+5399, 2720, 7539, 6065, 769, 700, 8501, 173, 1185, 5398,
+6195, 5049, 6054, 4881, 205, 6197, 6198, 9843, 6196, 12486,
+6753, 3569, 436, 9842, 709, 9844, 2371, 7464, 12606, 2226,
+8434, 8435, 12390, 7468, 6755, 7540, 2678, 1487, 115, 16848,
+2042, 16846, 5050, 12386, 16847, 9845, 8386, 174, 123, 124,
+175, 590, 9896, 2919, 2119, 1930, 7463, 622, 3358, 654,
+774, 17071, 7465, 6754,
+};
+
+static const uint16_t max_arg[] = {
+80, 82, 240, 346, 346, 379, 465, 531, 1019, 1019,
+1019, 1019, 1019, 1019, 1019, 1699, 1699, 1699, 1699, 1699,
+1699, 2287, 2287, 2287, 2287, 2287, 2287, 2287, 2446, 2446,
+2594, 2594, 2594, 2594, 2721, 3009, 3009, 3009, 3009, 4897,
+4897, 4897, 4897, 4897, 4897, 5047, 5047, 5047, 5047, 5047,
+5399, 5399, 7539, 7539, 7539, 7539, 8501, 8501, 8501, 8501,
+8501, 8501, 8501, 8501, 8501, 8501, 8501, 9843, 9843, 12486,
+12486, 12486, 12486, 12486, 12486, 12486, 12486, 12486, 12606, 12606,
+12606, 12606, 12606, 12606, 12606, 12606, 12606, 12606, 12606, 16848,
+16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848,
+16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848, 16848,
+16848, 17071, 17071, 17071,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.05765, 0.057029999999999997, 0.027019999999999999, 0.01447,
+0.01035, 0.0064799999999999996, 0.0050299999999999997, 0.0035100000000000001,
+0.0032799999999999999, 0.00314, 0.0031099999999999999, 0.00183,
+0.00166, 0.00149, 0.00147, 0.00133,
+0.0012600000000000001, 0.0011199999999999999, 0.0011000000000000001, 0.00101,
+0.00091, 0.00081999999999999998, 0.00076000000000000004, 0.00066,
+0.00056999999999999998, 0.00052999999999999998, 0.00051000000000000004, 0.00046000000000000001,
+0.00036999999999999999, 0.00035, 0.00035, 0.00029,
+0.00027, 0.00025000000000000001, 0.00025000000000000001, 0.00025000000000000001,
+0.00023000000000000001, 0.00022000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00021000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00014999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00012, 0.00011,
+0.0001, 0.0001, 0.0001, 0.0001,
+0.0001, 9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.057418668496468893, -0.056801151018666521, -4.9634934769442219e-18, 0.014411995821998631,
+4.4799111226442546e-07, 0.0064540089097927869, 0.0050098149187443267, -0.0034959152981880416,
+-0.0032668306950303975, 0.0031274001574833014, -0.0030975202466781149, -0.0018226700367424055,
+-2.7442706900201775e-06, 0.0014840261198423698, -0.00060290721132092752, 0.0013246680256319714,
+-0.00054772208019008856, 0.00048341768999989396, -0.0010955867124922141, 0.0010059521523155955,
+0.00090634841064134413, -0.00081671292455547063, 0.0007569502497483129, -0.00065735116153151866,
+2.6814755748691704e-06, -6.4751715242852688e-10, -0.00020423779360889029, 0.00045815451525052953,
+-0.00036851559991117686, -0.00034859634608028862, 0.00034859547148320365, 0.00015244064751660685,
+-0.00026891713910000693, 0.00010224919636707793, 0.00024899721437666766, -0.00024899641385920111,
+9.3535088912185331e-05, -5.7177152463813803e-05, 8.0634211424565372e-10, -0.00021911666889777389,
+0.00020915703685334499, -0.00018923758024379713, 0.00018923758024379713, -0.00014939813183898051,
+-0.00013943911979851965, 0.00013943880511116017, -0.00011951889899705746, 0.00010955906802787967,
+6.6322511576137431e-10, 4.4182106360687474e-05, -9.9598760807012771e-05, 9.9599082497547889e-05,
+-9.9598651465387011e-05, 8.9638860828586268e-05, 3.2822635343337055e-05, -3.2736586102090946e-05,
+-7.9679280986267166e-05, -2.8597518063727582e-05, -3.665191427708355e-11, 6.9719222211806736e-05,
+-6.9719093203223406e-05, 6.971945173021072e-05, 6.9719357748283513e-05, 6.9719093203223406e-05,
+2.4498212111287259e-05, 5.9759234929271066e-05, -5.9759240552390841e-05, -4.9799324951628047e-05,
+4.9799608378721948e-05, 4.9799541248773945e-05, 4.979946864213383e-05, 2.0943951020648795e-10,
+1.6348033794679318e-05, -3.9839618634811383e-05, -3.8973921379543335e-05, -3.9839504947571314e-05,
+-3.983963362353537e-05, 3.983950869614308e-05, 3.9839585532236266e-05, -3.983963362353537e-05,
+-3.9839508071384154e-05, 3.9839632374501738e-05, 3.9839504947571314e-05, -3.983949745029673e-05,
+3.9839480580789949e-05, 1.0995574287235062e-10, -1.2276229343347667e-05, 1.206209611263537e-05,
+-1.2233063444442709e-05, -2.987954903991217e-05, 2.9879724749264366e-05, 2.9879519508183186e-05,
+2.9879675095064005e-05, 2.9879600594588104e-05, -2.9879724749264366e-05, -2.9879600125958835e-05,
+-2.987965026412875e-05, 2.4479872893699488e-05, 2.4477193968653096e-05, -2.4477193968653096e-05,
+-2.4479924347559575e-05, -3.1107014456493149e-06, 8.7266462599326526e-11, 9.0757121103760015e-11,
+2.5830872928471158e-10, -3.4906585032433941e-12, 1.9919816811767685e-05, -1.9493152776109984e-05,
+-1.9919816499509578e-05, -1.9403298069879319e-05, 1.9403298069879312e-05, -1.9919767155107086e-05,
+-1.9919816499509578e-05, 1.9919816811767685e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.0051593612097439812, -0.0051039340664470884, -0.027019999999999999, 0.0012943246990975534,
+0.01034999999030454, 0.00057980082124408955, 0.00045017161164024385, -0.00031412772544749595,
+-0.00029362767241390936, 0.00028101290890886557, -0.00027833131591531554, -0.00016362743401226315,
+0.0016599977316184441, 0.00013329094352430647, -0.0013406725530632833, 0.00011897319810904817,
+-0.0011347248665964109, 0.0010103006171408419, -9.8436555255164646e-05, 9.0334197575564991e-05,
+8.1440521412313844e-05, -7.3348475540055918e-05, 6.8017052317538535e-05, -5.9071570430819798e-05,
+0.00056999369267452546, 0.00052999999999960446, -0.00046731886722212743, 4.1163578021745138e-05,
+-3.3109705859542261e-05, -3.1314333770202596e-05, 3.1324068404390727e-05, -0.0002467019436176327,
+-2.4157241114570949e-05, -0.00022813395591688394, 2.2369336884668916e-05, -2.2378245803848184e-05,
+0.00021012183880356078, 0.00021244004621570245, -0.00021999999999852229, -1.9694806704898938e-05,
+1.8797178903454889e-05, -1.7004064910263313e-05, 1.700406491026333e-05, -1.3423792423253311e-05,
+-1.2519259954729109e-05, 1.2522764438089936e-05, -1.0734653349371633e-05, 9.8392384289859902e-06,
+9.999999999780066e-05, 8.9710319793950686e-05, -8.9491254157854773e-06, 8.9455444578096728e-06,
+-8.9503422435324463e-06, 8.0544788380964231e-06, 7.295666254097923e-05, -7.2995314441273476e-05,
+-7.1562686863675688e-06, -6.3891955366812599e-05, 6.9999999999990399e-05, 6.2633899911080863e-06,
+-6.2648258491555362e-06, 6.2608346439446533e-06, 6.2618811204667696e-06, 6.2648258491555184e-06,
+5.4770773258649351e-05, 5.3697151384583711e-06, -5.3696525587309493e-06, -4.4751798133881379e-06,
+4.4720247456747532e-06, 4.4727722289048364e-06, 4.473580552659114e-06, -3.9999999999451688e-05,
+3.6506736242069398e-05, -3.578377709631825e-06, 9.0018582693339015e-06, -3.5796432130088993e-06,
+-3.5782108297961276e-06, 3.5796014931749134e-06, 3.5787462357132164e-06, -3.5782108297961276e-06,
+-3.5796084464808372e-06, 3.578224736451501e-06, 3.579643213008898e-06, -3.5797266526650859e-06,
+3.5799143918341123e-06, 2.9999999999798495e-05, 2.7373238630266782e-05, 2.7468269646440175e-05,
+2.7392556630665922e-05, -2.685618955005269e-06, 2.6836633373429015e-06, 2.6859474976440574e-06,
+2.6842161264346561e-06, 2.6850453083496257e-06, -2.6836633373429083e-06, -2.6850505233236785e-06,
+-2.6844925206360191e-06, -1.7341736450203513e-05, -1.7345517444600281e-05, 1.7345517444600277e-05,
+1.7341663816882165e-05, -1.9756607414129464e-05, 1.9999999999809616e-05, 1.9999999999794081e-05,
+1.9999999998331916e-05, 1.9999999999999697e-05, 1.7891054148980645e-06, 4.474035633210319e-06,
+-1.7891088915619389e-06, 4.8489198809031256e-06, -4.848919880903145e-06, -1.7896582037688132e-06,
+-1.7891088915619389e-06, 1.7891054148980645e-06,
+};
+
+const struct elp_table elp18 = {
+    arg, max_arg, amp, c, s, 114
 };
@@ -1,229 +1,237 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp19[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000}, 180.000000, 0.000020, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000}, 0.000000, 0.000110, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000970, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 0.000000, 0.000350, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000}, 0.000000, 0.000040, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -4.000000, 0.000000}, 0.000000, 0.000120, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, -2.000000}, 180.000000, 0.000020, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 0.000000}, 0.000000, 0.001690, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, -2.000000}, 180.000000, 0.000130, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.024380, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 2.000000}, 180.000000, 0.000060, 0.750000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000}, 180.000000, 0.000760, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.371150, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000}, 0.000000, 0.000200, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 180.000000, 0.000190, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 0.000000, 1.676800, 1.000000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 180.000000, 0.001040, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000}, 0.000000, 0.000210, 0.079000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 0.000000, 0.275600, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000}, 180.000000, 0.000660, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -2.000000}, 180.000000, 0.000070, 1.500000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000}, 0.000000, 0.019230, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 2.000000}, 180.000000, 0.000110, 0.018000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 3.000000, 0.000000}, 0.000000, 0.001380, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 3.000000, 2.000000}, 180.000000, 0.000010, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 4.000000, 0.000000}, 0.000000, 0.000100, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 0.000000, 0.000080, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 0.000000, 0.000970, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000}, 180.000000, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.012930, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000}, 0.000000, 0.000020, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 0.000000, 0.037470, 0.500000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 2.000000}, 180.000000, 0.000030, 0.035000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 0.000000, 0.005850, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000}, 180.000000, 0.000010, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 0.000000, 0.000330, 0.035000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 3.000000, 0.000000}, 0.000000, 0.000020, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000}, 0.000000, 0.000030, 0.043000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000}, 0.000000, 0.000390, 0.098000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000}, 0.000000, 0.000760, 0.333000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000}, 0.000000, 0.000140, 0.062000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000}, 0.000000, 0.000010, 0.108000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000}, 0.000000, 0.000010, 0.250000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 0.000000, 0.000000}, 180.000000, 0.000020, 0.107000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, -1.000000, 0.000000}, 180.000000, 0.000010, 0.346000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.000220, 0.096000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 0.000000}, 0.000000, 0.000340, 0.530000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -2.000000}, 0.000000, 0.000030, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000}, 0.000000, 0.001410, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 0.000000}, 0.000000, 0.000300, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000, 0.000000}, 0.000000, 0.000040, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.071000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000040, 1.127000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000110, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000}, 180.000000, 0.000030, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -3.000000, 0.000000}, 180.000000, 0.000060, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 0.000000}, 180.000000, 0.000880, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 0.000000}, 180.000000, 0.002700, 8.850000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.045160, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 2.000000}, 0.000000, 0.000090, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 0.000000}, 180.000000, 0.003170, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 2.000000}, 0.000000, 0.000020, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, 0.000000}, 180.000000, 0.000230, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 3.000000, 0.000000}, 180.000000, 0.000020, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -2.000000, 0.000000}, 180.000000, 0.000020, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.000020, 0.898000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000}, 0.000000, 0.000200, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 1.000000, 0.000000}, 0.000000, 0.000040, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, -1.000000, 0.000000}, 180.000000, 0.000080, 0.134000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000}, 180.000000, 0.000130, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, 1.000000, 0.000000}, 180.000000, 0.000010, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -2.000000, 0.000000}, 180.000000, 0.000070, 0.209000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -1.000000, 0.000000}, 180.000000, 0.001860, 0.118000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000, -2.000000}, 180.000000, 0.000010, 0.196000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000}, 180.000000, 0.002560, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 1.000000, 0.000000}, 180.000000, 0.000250, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 2.000000, 0.000000}, 180.000000, 0.000020, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -3.000000, 0.000000}, 180.000000, 0.000080, 0.059000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -2.000000, 0.000000}, 180.000000, 0.001480, 0.265000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, -2.000000}, 0.000000, 0.000020, 0.058000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, 0.000000}, 180.000000, 0.037070, 0.105000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, 2.000000}, 0.000000, 0.000080, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, -2.000000}, 180.000000, 0.000320, 0.243000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.040480, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 2.000000}, 0.000000, 0.000090, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, -2.000000}, 0.000000, 0.000080, 0.109000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, 0.000000}, 180.000000, 0.003780, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, 2.000000}, 0.000000, 0.000020, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 2.000000, 0.000000}, 180.000000, 0.000320, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 3.000000, 0.000000}, 180.000000, 0.000030, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -4.000000, 0.000000}, 180.000000, 0.000070, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -3.000000, 0.000000}, 180.000000, 0.001200, 0.062000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, -2.000000}, 0.000000, 0.000070, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.021650, 0.360000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, 2.000000}, 0.000000, 0.000050, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, -2.000000}, 0.000000, 0.000150, 0.061000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.516420, 0.095000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 2.000000}, 0.000000, 0.001070, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, -2.000000}, 180.000000, 0.005390, 0.322000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.413830, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 2.000000}, 0.000000, 0.000960, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, -2.000000}, 0.000000, 0.000940, 0.099000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, 0.000000}, 180.000000, 0.036490, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, 2.000000}, 0.000000, 0.000190, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, -2.000000}, 0.000000, 0.000070, 0.043000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, 0.000000}, 180.000000, 0.002950, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, 2.000000}, 0.000000, 0.000030, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 3.000000, 0.000000}, 180.000000, 0.000230, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 4.000000, 0.000000}, 180.000000, 0.000020, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000}, 180.000000, 0.000030, 0.067000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000}, 180.000000, 0.000310, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.008190, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 2.000000}, 180.000000, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000290, 0.474000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.010720, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 2.000000}, 180.000000, 0.000030, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -2.000000}, 180.000000, 0.000050, 0.090000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.001280, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 2.000000, 0.000000}, 0.000000, 0.000130, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 3.000000, 0.000000}, 0.000000, 0.000010, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -4.000000, 0.000000}, 180.000000, 0.000050, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -3.000000, 0.000000}, 180.000000, 0.000450, 0.071000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, 0.000000}, 180.000000, 0.006310, 1.292000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.071180, 0.080000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 2.000000}, 180.000000, 0.000170, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -2.000000}, 0.000000, 0.003620, 0.903000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000}, 0.000000, 0.061280, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 2.000000}, 180.000000, 0.000160, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, -2.000000}, 180.000000, 0.000210, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, 0.000000}, 0.000000, 0.007340, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, 2.000000}, 180.000000, 0.000040, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000, -2.000000}, 180.000000, 0.000020, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000, 0.000000}, 0.000000, 0.000730, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 3.000000, 0.000000}, 0.000000, 0.000070, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -3.000000, 0.000000}, 0.000000, 0.000050, 0.077000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -2.000000, 0.000000}, 0.000000, 0.001260, 4.425000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, -2.000000}, 0.000000, 0.000030, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.012700, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 2.000000}, 180.000000, 0.000030, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, -2.000000}, 0.000000, 0.000120, 9.300000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000}, 0.000000, 0.000940, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 1.000000, 0.000000}, 0.000000, 0.000070, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 3.000000, -1.000000, 0.000000}, 0.000000, 0.000010, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.116000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, -1.000000, 0.000000}, 0.000000, 0.000060, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.000030, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -2.000000, 0.000000}, 0.000000, 0.000210, 0.104000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, 0.000000}, 0.000000, 0.000580, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -2.000000}, 0.000000, 0.000050, 0.108000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.000170, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000070, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000040, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -3.000000, 0.000000}, 0.000000, 0.000020, 0.602000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.000110, 0.086000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 0.000000}, 180.000000, 0.000690, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, -2.000000}, 180.000000, 0.000020, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000380, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 1.000000, 0.000000}, 180.000000, 0.000060, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -2.000000, 0.000000}, 180.000000, 0.000060, 0.050000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -1.000000, 0.000000}, 180.000000, 0.000130, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000}, 180.000000, 0.000070, 0.022000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 1.000000, 0.000000}, 180.000000, 0.000010, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -3.000000, 0.000000}, 180.000000, 0.000030, 0.130000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -2.000000, 0.000000}, 180.000000, 0.000790, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -1.000000, 0.000000}, 180.000000, 0.001550, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.000760, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 1.000000, 0.000000}, 180.000000, 0.000120, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 2.000000, 0.000000}, 180.000000, 0.000010, 0.014000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -3.000000, 0.000000}, 180.000000, 0.000250, 0.115000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.006860, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -2.000000, 2.000000}, 0.000000, 0.000040, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, -2.000000}, 180.000000, 0.000060, 0.119000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.010970, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, 2.000000}, 0.000000, 0.000060, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, -2.000000}, 180.000000, 0.000020, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.004690, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, 2.000000}, 0.000000, 0.000030, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 1.000000, -2.000000}, 0.000000, 0.000020, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 1.000000, 0.000000}, 180.000000, 0.000710, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 2.000000, 0.000000}, 180.000000, 0.000080, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000180, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000410, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000220, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000040, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -3.000000, 0.000000}, 180.000000, 0.000070, 0.093000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.000900, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, -2.000000}, 0.000000, 0.000050, 0.096000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.001600, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000}, 0.000000, 0.000730, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 1.000000, 0.000000}, 0.000000, 0.000130, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 2.000000, 0.000000}, 0.000000, 0.000020, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -3.000000, 0.000000}, 0.000000, 0.000020, 0.085000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -2.000000, 0.000000}, 0.000000, 0.000180, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.000110, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, 0.000000, 0.000000}, 0.000000, 0.000010, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, -1.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 5.000000, 1.000000, -1.000000, 0.000000}, 180.000000, 0.000010, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, -3.000000, 0.000000}, 180.000000, 0.000020, 0.031000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, -2.000000, 0.000000}, 180.000000, 0.000040, 0.022000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, -1.000000, 0.000000}, 180.000000, 0.000040, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.000010, 0.014000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -3.000000, 0.000000}, 180.000000, 0.000100, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.000230, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.000180, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.000060, 0.014000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, 1.000000, 0.000000}, 180.000000, 0.000010, 0.012000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000010, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000010, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 1.000000, -3.000000, 0.000000}, 0.000000, 0.000010, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.000030, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.000030, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 1.000000}, 14.813110, 0.000010, 0.089000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 1.000000}, 194.813110, 0.000070, 0.487000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, -1.000000}, 14.813110, 0.000060, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -1.000000}, 194.813110, 0.000040, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -1.000000}, 194.813110, 0.000530, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 1.000000}, 194.813110, 0.000070, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -1.000000}, 194.813110, 0.002470, 18.600000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 1.000000}, 194.813110, 0.000520, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -1.000000}, 194.813110, 0.000530, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 1.000000}, 194.813110, 0.000060, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -1.000000}, 194.813110, 0.000040, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, -1.000000}, 14.813110, 0.000040, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 1.000000}, 194.813110, 0.000010, 0.026000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -1.000000}, 194.813110, 0.000050, 0.041000},
+
+static const uint16_t arg[] = {
+1, 13, 15, 16, 22, 68, 84, 107, 115, 128,
+131, 133, 173, 194, 205, 262, 268, 293, 229, 129,
+395, 409, 436, 462, 482, 528, 631, 648, 700, 735,
+769, 802, 20, 997, 1046, 1085, 1106, 1139, 1171, 1182,
+1185, 1234, 1262, 1341, 1365, 311, 1419, 1428, 1443, 1442,
+1471, 1487, 1596, 1645, 1646, 1647, 1685, 1686, 1712, 1737,
+1793, 1929, 82, 80, 83, 2263, 1930, 2447, 2503, 1800,
+2678, 2722, 2768, 2769, 902, 2882, 2919, 3207, 3208, 3359,
+3360, 3361, 3468, 3423, 2679, 3566, 3567, 2227, 3668, 3143,
+3782, 2119, 3895, 3896, 4042, 3476, 4187, 2288, 4479, 4662,
+4663, 4599, 4664, 4665, 4884, 4882, 4885, 4810, 5113, 590,
+5114, 5115, 5403, 5404, 5749, 5750, 6203, 6204, 6205, 6206,
+6207, 6208, 6758, 6759, 6760, 6761, 6762, 6763, 6764, 6544,
+6765, 6766, 350, 346, 6790, 7476, 7477, 7478, 7479, 7480,
+7481, 7482, 379, 418, 8438, 6231, 8439, 8440, 8441, 8442,
+465, 7540, 9852, 1700, 9853, 9854, 7247, 9855, 7542, 9856,
+9857, 598, 572, 531, 12402, 12403, 12404, 2883, 12405, 12406,
+9969, 7541, 12407, 12408, 12409, 12410, 12411, 12412, 12413, 3569,
+16722, 16723, 16724, 16725, 16726, 16727, 8503, 16728, 16729, 16730,
+16731, 16732, 12487, 16733, 16734, 5788, 16735, 16736, 16737, 16738,
+6230, 16739, 16740, 16741, 16742, 16743, 21435, 21436, 21437, 21438,
+12607, 21439, 21440, 21441, 21442, 21443, 21444, 21445, 21446, 21447,
+21448, 21449, 17079, 21450, 1147, 1153,
+};
+
+static const uint16_t max_arg[] = {
+1, 13, 15, 16, 22, 68, 84, 107, 115, 128,
+131, 133, 173, 194, 205, 262, 268, 293, 293, 293,
+395, 409, 436, 462, 482, 528, 631, 648, 700, 735,
+769, 802, 802, 997, 1046, 1085, 1106, 1139, 1171, 1182,
+1185, 1234, 1262, 1341, 1365, 1365, 1419, 1428, 1443, 1443,
+1471, 1487, 1596, 1645, 1646, 1647, 1685, 1686, 1712, 1737,
+1793, 1929, 1929, 1929, 1929, 2263, 2263, 2447, 2503, 2503,
+2678, 2722, 2768, 2769, 2769, 2882, 2919, 3207, 3208, 3359,
+3360, 3361, 3468, 3468, 3468, 3566, 3567, 3567, 3668, 3668,
+3782, 3782, 3895, 3896, 4042, 4042, 4187, 4187, 4479, 4662,
+4663, 4663, 4664, 4665, 4884, 4884, 4885, 4885, 5113, 5113,
+5114, 5115, 5403, 5404, 5749, 5750, 6203, 6204, 6205, 6206,
+6207, 6208, 6758, 6759, 6760, 6761, 6762, 6763, 6764, 6764,
+6765, 6766, 6766, 6766, 6790, 7476, 7477, 7478, 7479, 7480,
+7481, 7482, 7482, 7482, 8438, 8438, 8439, 8440, 8441, 8442,
+8442, 8442, 9852, 9852, 9853, 9854, 9854, 9855, 9855, 9856,
+9857, 9857, 9857, 9857, 12402, 12403, 12404, 12404, 12405, 12406,
+12406, 12406, 12407, 12408, 12409, 12410, 12411, 12412, 12413, 12413,
+16722, 16723, 16724, 16725, 16726, 16727, 16727, 16728, 16729, 16730,
+16731, 16732, 16732, 16733, 16734, 16734, 16735, 16736, 16737, 16738,
+16738, 16739, 16740, 16741, 16742, 16743, 21435, 21436, 21437, 21438,
+21438, 21439, 21440, 21441, 21442, 21443, 21444, 21445, 21446, 21447,
+21448, 21449, 21449, 21450, 21450, 21450,
+};
+
+static const double ELP_ALIGNED amp[] = {
+1.6768000000000001, 0.51641999999999999, 0.41382999999999998, 0.37114999999999998,
+0.27560000000000001, 0.071179999999999993, 0.061280000000000001, 0.045159999999999999,
+0.040480000000000002, 0.037470000000000003, 0.037069999999999999, 0.036490000000000002,
+0.024379999999999999, 0.021649999999999999, 0.019230000000000001, 0.012930000000000001,
+0.012699999999999999, 0.010970000000000001, 0.01072, 0.0081899999999999994,
+0.0073400000000000002, 0.0068599999999999998, 0.0063099999999999996, 0.0058500000000000002,
+0.0053899999999999998, 0.0046899999999999997, 0.0037799999999999999, 0.00362,
+0.0031700000000000001, 0.0029499999999999999, 0.0027000000000000001, 0.0025600000000000002,
+0.00247, 0.0018600000000000001, 0.0016900000000000001, 0.0016000000000000001,
+0.0015499999999999999, 0.00148, 0.00141, 0.0013799999999999999,
+0.0012800000000000001, 0.0012600000000000001, 0.0011999999999999999, 0.00107,
+0.0010399999999999999, 0.00097000000000000005, 0.00097000000000000005, 0.00096000000000000002,
+0.00093999999999999997, 0.00093999999999999997, 0.00089999999999999998, 0.00088000000000000003,
+0.00079000000000000001, 0.00076000000000000004, 0.00076000000000000004, 0.00076000000000000004,
+0.00072999999999999996, 0.00072999999999999996, 0.00071000000000000002, 0.00068999999999999997,
+0.00066, 0.00058, 0.00052999999999999998, 0.00052999999999999998,
+0.00051999999999999995, 0.00044999999999999999, 0.00040999999999999999, 0.00038999999999999999,
+0.00038000000000000002, 0.00035, 0.00034000000000000002, 0.00033,
+0.00032000000000000003, 0.00032000000000000003, 0.00031, 0.00029999999999999997,
+0.00029, 0.00025000000000000001, 0.00025000000000000001, 0.00023000000000000001,
+0.00023000000000000001, 0.00023000000000000001, 0.00022000000000000001, 0.00022000000000000001,
+0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00020000000000000001,
+0.00020000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00018000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00017000000000000001, 0.00017000000000000001,
+0.00016000000000000001, 0.00014999999999999999, 0.00013999999999999999, 0.00012999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999,
+0.00012, 0.00012, 0.00012, 0.00011,
+0.00011, 0.00011, 0.00011, 0.00011,
+0.0001, 0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+1.6768000000000001, -0.51641999999999999, -0.41382999999999998, 0.37114999999999998,
+0.27560000000000001, 0.071179999999999993, 0.061280000000000001, -0.045159999999999999,
+-0.040480000000000002, 0.037470000000000003, -0.037069999999999999, -0.036490000000000002,
+0.024379999999999999, -0.021649999999999999, 0.019230000000000001, 0.012930000000000001,
+0.012699999999999999, -0.010970000000000001, 0.01072, 0.0081899999999999994,
+0.0073400000000000002, -0.0068599999999999998, -0.0063099999999999996, 0.0058500000000000002,
+-0.0053899999999999998, -0.0046899999999999997, -0.0037799999999999999, 0.00362,
+-0.0031700000000000001, -0.0029499999999999999, -0.0027000000000000001, -0.0025600000000000002,
+-0.0023879093377559045, -0.0018600000000000001, 0.0016900000000000001, 0.0016000000000000001,
+-0.0015499999999999999, -0.00148, 0.00141, 0.0013799999999999999,
+0.0012800000000000001, 0.0012600000000000001, -0.0011999999999999999, 0.00107,
+-0.0010399999999999999, 0.00097000000000000005, 0.00097000000000000005, 0.00096000000000000002,
+0.00093999999999999997, 0.00093999999999999997, 0.00089999999999999998, -0.00088000000000000003,
+-0.00079000000000000001, -0.00076000000000000004, 0.00076000000000000004, -0.00076000000000000004,
+0.00072999999999999996, 0.00072999999999999996, -0.00071000000000000002, -0.00068999999999999997,
+-0.00066, 0.00058, -0.00051238540445774461, -0.00051238540445774461,
+-0.00050271775531703241, -0.00044999999999999999, 0.00040999999999999999, 0.00038999999999999999,
+-0.00038000000000000002, 0.00035, 0.00034000000000000002, 0.00033,
+-0.00032000000000000003, -0.00032000000000000003, -0.00031, 0.00029999999999999997,
+0.00029, -0.00025000000000000001, -0.00025000000000000001, -0.00023000000000000001,
+-0.00023000000000000001, -0.00023000000000000001, -0.00022000000000000001, 0.00022000000000000001,
+0.00021000000000000001, -0.00021000000000000001, 0.00021000000000000001, 0.00020000000000000001,
+0.00020000000000000001, -0.00019000000000000001, 0.00019000000000000001, 0.00018000000000000001,
+0.00018000000000000001, -0.00018000000000000001, -0.00017000000000000001, -0.00017000000000000001,
+-0.00016000000000000001, 0.00014999999999999999, 0.00013999999999999999, -0.00012999999999999999,
+-0.00012999999999999999, 0.00012999999999999999, -0.00012999999999999999, 0.00012999999999999999,
+0.00012, 0.00012, -0.00012, 0.00011,
+-0.00011, 0.00011, 0.00011, 0.00011,
+0.0001, -0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05,
+8.0000000000000007e-05, -8.0000000000000007e-05, -8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, -8.0000000000000007e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.7673543984985137e-05, -6.7673543984985137e-05, -6.0000000000000002e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, 5.8005894844272985e-05, -5.8005894844272985e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, -4.833824570356082e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -3.8670596562848655e-05, -3.8670596562848655e-05, 3.8670596562848655e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+9.6676491407121636e-06, -9.6676491407121636e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 6.3243210001567609e-17, 5.0679558489114914e-17, 0,
+0, 0, 0, 5.5305049449494471e-18,
+4.9573702429484862e-18, 0, 4.5397656844392382e-18, 4.4687361700886919e-18,
+0, 2.6513603201540194e-18, 0, 0,
+0, 1.3434375386646465e-18, 0, 0,
+0, 8.4010770421508423e-19, 7.7275213026197987e-19, 0,
+6.600846247404234e-19, 5.7435934880010866e-19, 4.6291649007769953e-19, 0,
+3.8821303532971096e-19, 3.6127080574846919e-19, 3.3065463576978538e-19, 3.1350958058172243e-19,
+-0.00063149742252693137, 2.2778430464140773e-19, 0, 0,
+1.8982025386783974e-19, 1.8124772627380827e-19, 0, 0,
+0, 0, 1.4695761589768237e-19, 0,
+1.2736326711132473e-19, 0, 0, 0,
+0, 0, 0, 1.0776891832496708e-19,
+9.6747097132640902e-20, 9.307315673519885e-20, 0, 9.307315673519885e-20,
+0, 0, 8.6949922739462081e-20, 8.4500629141167364e-20,
+8.0826688743725312e-20, 0, -0.00013550349552197312, -0.00013550349552197312,
+-0.00013294682579514345, 5.5109105961630888e-20, 0, 0,
+4.6536578367599425e-20, 0, 0, 0,
+3.9188697572715303e-20, 3.9188697572715303e-20, 3.7964050773567951e-20, 0,
+0, 3.0616169978683829e-20, 3.0616169978683829e-20, 2.8166876380389123e-20,
+2.8166876380389123e-20, 2.8166876380389123e-20, 2.6942229581241771e-20, 0,
+0, 2.5717582782094418e-20, 0, 0,
+0, 2.3268289183799713e-20, 0, 0,
+0, 2.204364238465236e-20, 2.0818995585505007e-20, 2.0818995585505007e-20,
+1.9594348786357652e-20, 0, 0, 1.5920408388915591e-20,
+1.5920408388915591e-20, 0, 1.5920408388915591e-20, 0,
+0, 0, 1.4695761589768238e-20, 0,
+1.3471114790620885e-20, 0, 0, 0,
+0, 1.2246467991473533e-20, 0, 0,
+0, 9.7971743931788258e-21, 9.7971743931788258e-21, 0,
+0, 9.7971743931788258e-21, 8.5725275940314716e-21, 8.5725275940314716e-21,
+8.5725275940314716e-21, 0, 0, 0,
+0, 8.5725275940314716e-21, 8.5725275940314716e-21, 8.5725275940314716e-21,
+-1.789668808780777e-05, -1.789668808780777e-05, 7.347880794884119e-21, 7.347880794884119e-21,
+0, 7.347880794884119e-21, 7.347880794884119e-21, 7.347880794884119e-21,
+0, 7.347880794884119e-21, 1.5340018360978095e-05, -1.5340018360978091e-05,
+0, 6.1232339957367663e-21, 6.1232339957367663e-21, 0,
+0, 0, -1.2783348634148409e-05, 0,
+0, 0, 0, 4.8985871965894129e-21,
+4.8985871965894129e-21, 0, 0, 4.8985871965894129e-21,
+4.8985871965894129e-21, -1.0226678907318728e-05, -1.0226678907318728e-05, 1.022667890731873e-05,
+3.6739403974420595e-21, 0, 0, 3.6739403974420595e-21,
+3.6739403974420595e-21, 0, 3.6739403974420595e-21, 3.6739403974420595e-21,
+0, 3.6739403974420595e-21, 3.6739403974420595e-21, 3.6739403974420595e-21,
+0, 0, 0, 2.4492935982947065e-21,
+2.4492935982947065e-21, 2.4492935982947065e-21, 0, 0,
+2.4492935982947065e-21, 0, 0, 0,
+2.4492935982947065e-21, 2.4492935982947065e-21, 0, 2.4492935982947065e-21,
+0, 0, 2.4492935982947065e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, 0, 0, 2.4492935982947065e-21,
+2.4492935982947065e-21, 0, 0, 0,
+0, 2.4492935982947065e-21, 1.2246467991473532e-21, 1.2246467991473532e-21,
+0, 0, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 0, 0, 1.2246467991473532e-21,
+1.2246467991473532e-21, 0, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 0, 0, 0,
+2.5566697268296824e-06, -2.556669726829682e-06,
+};
+
+const struct elp_table elp19 = {
+    arg, max_arg, amp, c, s, 226
 };
@@ -1,921 +1,894 @@
 #include "lunar-priv.h"
-const struct main_problem  elp2[] = {
-{{0.000000, 0.000000, 0.000000, 1.000000}, 18461.400000, {0.000000, 412529.610000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 0.000000, 3.000000}, -6.296640, {7.680000, -422.650000, -13.210000, 0.020000, -0.020000, 0.000000}},
-{{0.000000, 0.000000, 0.000000, 5.000000}, 0.005920, {0.000000, 0.660000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -5.000000}, -0.002360, {0.020000, -0.260000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -3.000000}, 2.798710, {-17.130000, 188.680000, 50.780000, -0.110000, 0.040000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -1.000000}, 999.700790, {-563.820000, 22508.540000, 18298.820000, -0.920000, -0.210000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 1.000000}, 1010.174300, {-93.160000, 22571.830000, 18386.360000, -0.760000, -0.170000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 3.000000}, -1.019410, {0.950000, -68.420000, -19.880000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 5.000000}, 0.001560, {0.000000, 0.170000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -5.000000}, -0.000440, {0.000000, -0.050000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -3.000000}, -0.130350, {-0.400000, -8.780000, -4.770000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -1.000000}, 31.759850, {-167.640000, 723.950000, 1159.970000, -1.090000, 0.220000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 1.000000}, 61.912290, {-23.730000, 1382.400000, 2253.180000, -0.620000, -0.060000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 3.000000}, -0.117870, {0.110000, -7.910000, -4.410000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 5.000000}, 0.000260, {0.000000, 0.030000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -5.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -3.000000}, -0.001460, {0.040000, -0.100000, -0.080000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -1.000000}, 1.581310, {-10.250000, 36.060000, 86.530000, -0.080000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 1.000000}, 3.984070, {-3.300000, 88.860000, 217.430000, -0.110000, -0.010000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 3.000000}, -0.011810, {0.010000, -0.790000, -0.650000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 5.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, -3.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, -1.000000}, 0.091570, {-0.700000, 2.090000, 6.680000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 1.000000}, 0.263250, {-0.370000, 5.860000, 19.150000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 3.000000}, -0.001090, {0.000000, -0.070000, -0.080000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, -1.000000}, 0.005660, {-0.050000, 0.130000, 0.510000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 1.000000}, 0.017680, {-0.040000, 0.390000, 1.610000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 3.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, -1.000000}, 0.000360, {0.000000, 0.000000, 0.040000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, 1.000000}, 0.001200, {0.000000, 0.030000, 0.130000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 7.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 7.000000, 1.000000}, 0.000080, {0.000000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -6.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -6.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -5.000000, -1.000000}, -0.000530, {-0.010000, -0.010000, -0.050000, -0.030000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -5.000000, 1.000000}, -0.000140, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, -1.000000}, -0.006460, {-0.140000, -0.140000, -0.470000, -0.390000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, 1.000000}, -0.001860, {-0.020000, -0.040000, -0.140000, -0.110000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, -3.000000}, 0.000230, {0.000000, 0.010000, 0.010000, 0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, -1.000000}, -0.074790, {-1.690000, -1.630000, -4.080000, -4.480000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 1.000000}, -0.023650, {-0.350000, -0.530000, -1.290000, -1.420000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, -3.000000}, 0.001540, {0.030000, 0.100000, 0.060000, 0.090000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, -1.000000}, -0.793220, {-18.590000, -17.320000, -28.860000, -47.520000, -0.010000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 1.000000}, -0.301290, {-4.790000, -6.710000, -11.010000, -18.040000, -0.010000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 3.000000}, 0.001910, {0.060000, 0.130000, 0.070000, 0.120000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -5.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -3.000000}, 0.006790, {0.140000, 0.450000, 0.140000, 0.410000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -1.000000}, -6.731730, {-159.360000, -146.940000, -122.890000, -403.360000, -0.030000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 1.000000}, -5.632600, {-148.810000, -123.960000, -102.800000, -337.620000, -0.040000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 3.000000}, -0.009110, {-0.200000, -0.610000, -0.150000, -0.550000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, -3.000000}, 0.000100, {-0.170000, 0.000000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, -1.000000}, -4.839830, {70.860000, -100.970000, -8.740000, -289.050000, 0.020000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 1.000000}, -6.460360, {28.140000, -136.250000, -20.210000, -386.090000, 0.290000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 3.000000}, 0.011570, {0.060000, 0.770000, 0.040000, 0.690000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 5.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -3.000000}, -0.007030, {-0.040000, -0.470000, -0.130000, -0.420000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -1.000000}, -5.076140, {-113.160000, -112.230000, -93.120000, -304.280000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 1.000000}, -5.311510, {-99.030000, -115.960000, -99.190000, -318.300000, 0.060000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 3.000000}, 0.006680, {0.100000, 0.450000, 0.130000, 0.400000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 5.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -3.000000}, 0.001410, {0.040000, 0.090000, 0.050000, 0.080000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -1.000000}, -0.312920, {-4.920000, -6.960000, -11.470000, -18.750000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 1.000000}, -0.638840, {-12.560000, -13.950000, -23.510000, -38.290000, 0.010000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 3.000000}, 0.001350, {0.020000, 0.090000, 0.050000, 0.080000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, -1.000000}, -0.024190, {-0.360000, -0.540000, -1.330000, -1.450000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 1.000000}, -0.061760, {-1.230000, -1.350000, -3.400000, -3.700000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 3.000000}, 0.000200, {0.000000, 0.010000, 0.010000, 0.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, -1.000000}, -0.001910, {-0.030000, -0.040000, -0.140000, -0.110000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, 1.000000}, -0.005480, {-0.110000, -0.120000, -0.400000, -0.330000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, -1.000000}, -0.000150, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, 1.000000}, -0.000460, {0.000000, -0.010000, -0.040000, -0.030000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 6.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 6.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -5.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -4.000000, -1.000000}, -0.000160, {0.000000, 0.000000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -4.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, -1.000000}, -0.001690, {-0.050000, -0.040000, -0.090000, -0.200000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, 1.000000}, -0.000490, {-0.010000, -0.010000, -0.030000, -0.060000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, -1.000000}, -0.015710, {-0.490000, -0.340000, -0.570000, -1.880000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 1.000000}, -0.005360, {-0.120000, -0.120000, -0.200000, -0.640000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 3.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, -3.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, -1.000000}, -0.113350, {-3.250000, -2.460000, -2.070000, -13.580000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 1.000000}, -0.095110, {-3.170000, -2.080000, -1.730000, -11.390000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 3.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, -3.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, -1.000000}, -0.018010, {3.130000, -0.330000, -0.140000, -2.140000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 1.000000}, -0.057290, {2.090000, -1.190000, -0.390000, -6.840000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 3.000000}, 0.000160, {0.000000, 0.010000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, -3.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, -1.000000}, -0.061870, {-1.290000, -1.370000, -1.130000, -7.410000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 1.000000}, -0.055040, {-0.810000, -1.210000, -1.040000, -6.590000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 3.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, -3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, -1.000000}, -0.002840, {-0.020000, -0.060000, -0.100000, -0.340000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, 1.000000}, -0.005280, {-0.060000, -0.120000, -0.190000, -0.630000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, 3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, -1.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, 1.000000}, -0.000370, {0.000000, 0.000000, -0.020000, -0.040000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 4.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -3.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -3.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, -1.000000}, -0.000330, {-0.010000, 0.000000, -0.010000, -0.060000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, 1.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, -1.000000}, -0.002160, {-0.070000, -0.050000, -0.040000, -0.390000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, 1.000000}, -0.001900, {-0.070000, -0.040000, -0.030000, -0.340000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, -1.000000}, 0.000660, {0.110000, 0.020000, 0.000000, 0.120000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, 1.000000}, -0.000310, {0.080000, 0.000000, 0.000000, -0.060000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, -1.000000}, -0.001090, {-0.020000, -0.020000, -0.020000, -0.190000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, 1.000000}, -0.000830, {-0.010000, -0.020000, -0.020000, -0.150000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 2.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 2.000000, 1.000000}, -0.000080, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -1.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -1.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 0.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 0.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 1.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 1.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -3.000000, -1.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, -3.000000, 0.000000, -1.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.020000, 0.040000, 0.000000}},
-{{1.000000, -3.000000, 0.000000, 1.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.020000, 0.050000, 0.000000}},
-{{1.000000, -3.000000, 1.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, -2.000000, -1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, -2.000000, -2.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, -2.000000, -1.000000, -1.000000}, 0.000640, {0.000000, 0.010000, 0.010000, 0.080000, 0.250000, 0.000000}},
-{{1.000000, -2.000000, -1.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, -1.000000}, 0.002040, {0.020000, 0.050000, 0.000000, 0.240000, 0.790000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, 1.000000}, 0.002140, {0.000000, 0.050000, 0.000000, 0.260000, 0.830000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, -1.000000}, -0.000600, {-0.010000, -0.010000, -0.010000, -0.070000, -0.230000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, -2.000000, 2.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -2.000000, 2.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, -1.000000, -4.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, -1.000000}, 0.000180, {0.000000, 0.000000, 0.010000, 0.010000, 0.070000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, -1.000000}, 0.000960, {0.000000, 0.020000, 0.040000, 0.060000, 0.370000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, 1.000000}, -0.001370, {-0.030000, -0.030000, -0.050000, -0.080000, -0.530000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, -3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, -1.000000}, 0.010310, {0.070000, 0.230000, 0.200000, 0.620000, 4.010000, -0.020000}},
-{{1.000000, -1.000000, -1.000000, 1.000000}, 0.000800, {0.040000, 0.030000, 0.000000, 0.050000, 0.310000, 0.000000}},
-{{1.000000, -1.000000, 0.000000, -3.000000}, -0.000520, {0.000000, -0.030000, 0.000000, -0.030000, -0.200000, 0.000000}},
-{{1.000000, -1.000000, 0.000000, -1.000000}, -0.013460, {-1.070000, -0.270000, 0.000000, -0.820000, -5.230000, 0.030000}},
-{{1.000000, -1.000000, 0.000000, 1.000000}, -0.018290, {-1.520000, -0.330000, 0.000000, -1.110000, -7.110000, 0.040000}},
-{{1.000000, -1.000000, 0.000000, 3.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, -3.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, -1.000000}, -0.020120, {-0.420000, -0.450000, -0.380000, -1.200000, -7.830000, 0.040000}},
-{{1.000000, -1.000000, 1.000000, 1.000000}, -0.008450, {-0.450000, -0.170000, -0.170000, -0.510000, -3.290000, 0.020000}},
-{{1.000000, -1.000000, 1.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, -1.000000}, -0.001750, {-0.040000, -0.040000, -0.060000, -0.100000, -0.680000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, 1.000000}, -0.001460, {-0.070000, -0.030000, -0.060000, -0.090000, -0.570000, 0.000000}},
-{{1.000000, -1.000000, 3.000000, -1.000000}, -0.000150, {0.000000, 0.000000, 0.000000, 0.000000, -0.060000, 0.000000}},
-{{1.000000, -1.000000, 3.000000, 1.000000}, -0.000180, {0.000000, 0.000000, -0.010000, -0.010000, -0.070000, 0.000000}},
-{{1.000000, -1.000000, 4.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 4.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -5.000000, -1.000000}, -0.000110, {0.000000, 0.000000, -0.010000, 0.000000, -0.040000, 0.000000}},
-{{1.000000, 0.000000, -5.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 0.000000, -4.000000, -1.000000}, -0.001220, {-0.040000, -0.030000, -0.090000, 0.000000, -0.470000, 0.000000}},
-{{1.000000, 0.000000, -4.000000, 1.000000}, -0.000430, {0.000000, 0.000000, -0.030000, 0.000000, -0.170000, 0.000000}},
-{{1.000000, 0.000000, -3.000000, -1.000000}, -0.012550, {-0.370000, -0.270000, -0.690000, 0.000000, -4.880000, 0.030000}},
-{{1.000000, 0.000000, -3.000000, 1.000000}, -0.005370, {-0.120000, -0.120000, -0.290000, 0.000000, -2.090000, 0.010000}},
-{{1.000000, 0.000000, -3.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, -3.000000}, -0.000250, {0.000000, -0.020000, 0.000000, 0.000000, -0.100000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, -1.000000}, -0.109640, {-3.190000, -2.330000, -4.030000, -0.020000, -42.630000, 0.220000}},
-{{1.000000, 0.000000, -2.000000, 1.000000}, -0.078460, {-2.000000, -1.720000, -2.870000, -0.030000, -30.510000, 0.160000}},
-{{1.000000, 0.000000, -2.000000, 3.000000}, -0.000200, {0.000000, -0.010000, 0.000000, 0.000000, -0.080000, 0.000000}},
-{{1.000000, 0.000000, -1.000000, -3.000000}, -0.003690, {-0.040000, -0.250000, -0.070000, 0.000000, -1.440000, 0.000000}},
-{{1.000000, 0.000000, -1.000000, -1.000000}, -0.429890, {-13.130000, -8.830000, -8.150000, -0.010000, -167.150000, 0.880000}},
-{{1.000000, 0.000000, -1.000000, 1.000000}, 0.139280, {1.860000, 3.370000, 2.460000, 0.040000, 54.160000, -0.290000}},
-{{1.000000, 0.000000, -1.000000, 3.000000}, 0.002340, {0.050000, 0.160000, 0.040000, 0.000000, 0.910000, 0.000000}},
-{{1.000000, 0.000000, 0.000000, -5.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, 0.000000, 0.000000, -3.000000}, -0.032260, {-0.410000, -2.150000, 0.000000, 0.000000, -12.540000, 0.070000}},
-{{1.000000, 0.000000, 0.000000, -1.000000}, -4.805780, {-102.500000, -103.390000, -3.120000, -0.090000, -1868.590000, 9.850000}},
-{{1.000000, 0.000000, 0.000000, 1.000000}, -5.368440, {-119.820000, -113.860000, -3.160000, -0.080000, -2087.370000, 11.000000}},
-{{1.000000, 0.000000, 0.000000, 3.000000}, 0.006450, {0.150000, 0.430000, 0.020000, 0.000000, 2.510000, -0.010000}},
-{{1.000000, 0.000000, 0.000000, 5.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -5.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -3.000000}, -0.000190, {0.010000, -0.010000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -1.000000}, -0.588930, {-7.870000, -13.100000, -10.900000, 0.030000, -228.990000, 1.210000}},
-{{1.000000, 0.000000, 1.000000, 1.000000}, -0.667410, {-14.680000, -14.150000, -12.470000, 0.070000, -259.500000, 1.370000}},
-{{1.000000, 0.000000, 1.000000, 3.000000}, 0.001420, {0.030000, 0.090000, 0.030000, 0.000000, 0.550000, 0.000000}},
-{{1.000000, 0.000000, 2.000000, -1.000000}, -0.036360, {-0.400000, -0.810000, -1.340000, 0.000000, -14.140000, 0.070000}},
-{{1.000000, 0.000000, 2.000000, 1.000000}, -0.063830, {-1.350000, -1.350000, -2.350000, 0.020000, -24.820000, 0.130000}},
-{{1.000000, 0.000000, 2.000000, 3.000000}, 0.000210, {0.000000, 0.010000, 0.000000, 0.000000, 0.080000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, -1.000000}, -0.002470, {-0.020000, -0.050000, -0.140000, 0.000000, -0.960000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, 1.000000}, -0.005530, {-0.110000, -0.120000, -0.300000, 0.000000, -2.150000, 0.010000}},
-{{1.000000, 0.000000, 3.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, 4.000000, -1.000000}, -0.000170, {0.000000, 0.000000, -0.010000, 0.000000, -0.070000, 0.000000}},
-{{1.000000, 0.000000, 4.000000, 1.000000}, -0.000450, {0.000000, 0.000000, -0.030000, 0.000000, -0.180000, 0.000000}},
-{{1.000000, 0.000000, 5.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, 5.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 1.000000, -5.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, -4.000000, -1.000000}, 0.000170, {0.000000, 0.000000, 0.010000, 0.010000, 0.070000, 0.000000}},
-{{1.000000, 1.000000, -4.000000, 1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 1.000000, -3.000000, -1.000000}, 0.001860, {0.020000, 0.040000, 0.100000, 0.110000, 0.720000, 0.000000}},
-{{1.000000, 1.000000, -3.000000, 1.000000}, 0.000930, {0.000000, 0.020000, 0.050000, 0.060000, 0.360000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, -3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, -1.000000}, 0.015970, {0.200000, 0.350000, 0.590000, 0.960000, 6.210000, -0.030000}},
-{{1.000000, 1.000000, -2.000000, 1.000000}, 0.016800, {0.230000, 0.380000, 0.610000, 1.010000, 6.530000, -0.030000}},
-{{1.000000, 1.000000, -2.000000, 3.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, -3.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, -1.000000}, 0.006350, {-0.380000, 0.070000, 0.200000, 0.360000, 2.460000, -0.010000}},
-{{1.000000, 1.000000, -1.000000, 1.000000}, -0.055900, {-0.180000, -1.290000, -0.970000, -3.360000, -21.740000, 0.110000}},
-{{1.000000, 1.000000, -1.000000, 3.000000}, -0.000210, {0.000000, -0.010000, 0.000000, -0.010000, -0.080000, 0.000000}},
-{{1.000000, 1.000000, 0.000000, -3.000000}, 0.000800, {0.000000, 0.050000, 0.000000, 0.050000, 0.310000, 0.000000}},
-{{1.000000, 1.000000, 0.000000, -1.000000}, 0.804260, {0.220000, 17.530000, 1.110000, 48.120000, 312.710000, -1.650000}},
-{{1.000000, 1.000000, 0.000000, 1.000000}, 0.802630, {0.340000, 17.410000, 0.850000, 48.020000, 312.080000, -1.650000}},
-{{1.000000, 1.000000, 0.000000, 3.000000}, -0.000830, {0.000000, -0.060000, 0.000000, -0.050000, -0.320000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, -3.000000}, -0.000210, {0.010000, -0.010000, 0.000000, -0.010000, -0.080000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, -1.000000}, 0.034650, {0.090000, 0.750000, 0.710000, 2.070000, 13.480000, -0.070000}},
-{{1.000000, 1.000000, 1.000000, 1.000000}, 0.101760, {0.150000, 2.200000, 1.970000, 6.090000, 39.570000, -0.210000}},
-{{1.000000, 1.000000, 1.000000, 3.000000}, -0.000200, {0.000000, -0.010000, 0.000000, -0.010000, -0.080000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, -3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, -1.000000}, 0.003170, {0.000000, 0.070000, 0.120000, 0.190000, 1.230000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, 1.000000}, 0.010160, {0.030000, 0.220000, 0.380000, 0.610000, 3.950000, -0.020000}},
-{{1.000000, 1.000000, 2.000000, 3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 1.000000, 3.000000, -1.000000}, 0.000270, {0.000000, 0.000000, 0.020000, 0.020000, 0.110000, 0.000000}},
-{{1.000000, 1.000000, 3.000000, 1.000000}, 0.000930, {0.000000, 0.020000, 0.050000, 0.060000, 0.360000, 0.000000}},
-{{1.000000, 1.000000, 4.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 4.000000, 1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 2.000000, -3.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{1.000000, 2.000000, -3.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, -2.000000, -1.000000}, 0.000170, {0.000000, 0.000000, 0.000000, 0.020000, 0.060000, 0.000000}},
-{{1.000000, 2.000000, -2.000000, 1.000000}, 0.000160, {0.000000, 0.000000, 0.000000, 0.020000, 0.060000, 0.000000}},
-{{1.000000, 2.000000, -1.000000, -1.000000}, -0.000080, {0.000000, 0.000000, 0.000000, -0.010000, -0.030000, 0.000000}},
-{{1.000000, 2.000000, -1.000000, 1.000000}, -0.000390, {-0.020000, 0.000000, 0.000000, -0.050000, -0.150000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, -1.000000}, -0.001700, {-0.030000, -0.040000, 0.000000, -0.200000, -0.660000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, 1.000000}, -0.002040, {-0.030000, -0.040000, 0.000000, -0.240000, -0.790000, 0.000000}},
-{{1.000000, 2.000000, 1.000000, -1.000000}, -0.000220, {0.000000, 0.000000, 0.000000, -0.030000, -0.090000, 0.000000}},
-{{1.000000, 2.000000, 1.000000, 1.000000}, -0.000720, {-0.010000, -0.020000, -0.010000, -0.090000, -0.280000, 0.000000}},
-{{1.000000, 2.000000, 2.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 2.000000, 2.000000, 1.000000}, -0.000120, {0.000000, 0.000000, 0.000000, -0.010000, -0.050000, 0.000000}},
-{{1.000000, 2.000000, 3.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 3.000000, 0.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{1.000000, 3.000000, 0.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{2.000000, -5.000000, -1.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, -1.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 0.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 0.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -2.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -1.000000, -1.000000}, 0.000310, {0.000000, 0.000000, 0.000000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -1.000000, 1.000000}, 0.000340, {0.000000, 0.000000, 0.000000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, -1.000000}, 0.001180, {0.030000, 0.030000, 0.000000, 0.280000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, 1.000000}, 0.000620, {0.030000, 0.010000, 0.000000, 0.150000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 1.000000, -1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 1.000000, 1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 2.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -3.000000, -1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, -1.000000}, 0.000770, {0.020000, 0.020000, 0.030000, 0.140000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, 1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, -1.000000}, 0.009140, {0.250000, 0.200000, 0.170000, 1.640000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 1.000000}, 0.010420, {0.250000, 0.230000, 0.190000, 1.870000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, -3.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, -1.000000}, 0.036470, {0.910000, 0.810000, 0.020000, 6.540000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, 1.000000}, 0.016030, {0.620000, 0.350000, 0.060000, 2.880000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, -3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, -1.000000}, 0.002400, {0.070000, 0.050000, 0.050000, 0.430000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, 1.000000}, 0.002560, {0.110000, 0.060000, 0.050000, 0.460000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, -1.000000}, 0.000210, {0.000000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, 1.000000}, 0.000310, {0.010000, 0.000000, 0.010000, 0.060000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 3.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 3.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -4.000000, -1.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -4.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, -1.000000}, 0.001780, {0.030000, 0.040000, 0.100000, 0.210000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, 1.000000}, 0.000300, {0.000000, 0.000000, 0.020000, 0.040000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, -1.000000}, 0.022850, {0.530000, 0.510000, 0.830000, 2.730000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 1.000000}, -0.001920, {0.000000, -0.040000, -0.070000, -0.230000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 3.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, -3.000000}, 0.000240, {0.000000, 0.020000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, -1.000000}, 0.268650, {6.320000, 5.970000, 4.910000, 32.140000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 1.000000}, 0.314740, {6.780000, 6.970000, 5.750000, 37.650000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 3.000000}, -0.000450, {0.000000, -0.030000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, -3.000000}, 0.002730, {0.030000, 0.180000, 0.000000, 0.330000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, -1.000000}, 1.085870, {23.510000, 24.250000, 0.470000, 129.870000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 1.000000}, 0.383530, {13.480000, 8.450000, 1.720000, 45.870000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 3.000000}, -0.000440, {-0.010000, -0.030000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -3.000000}, -0.000720, {-0.020000, -0.050000, -0.010000, -0.090000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -1.000000}, 0.069150, {1.690000, 1.510000, 1.310000, 8.270000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 1.000000}, 0.058480, {2.240000, 1.280000, 1.260000, 6.990000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 3.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, -3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, -1.000000}, 0.005550, {0.160000, 0.120000, 0.210000, 0.660000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, 1.000000}, 0.006770, {0.270000, 0.150000, 0.270000, 0.810000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, -1.000000}, 0.000460, {0.010000, 0.000000, 0.030000, 0.060000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, 1.000000}, 0.000700, {0.030000, 0.020000, 0.040000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 4.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 4.000000, 1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -6.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -5.000000, -1.000000}, 0.000290, {0.000000, 0.000000, 0.030000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -5.000000, 1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, -1.000000}, 0.004160, {0.060000, 0.090000, 0.300000, 0.250000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, 1.000000}, 0.000800, {0.000000, 0.020000, 0.060000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, -3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, -1.000000}, 0.055020, {0.990000, 1.230000, 3.010000, 3.290000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 1.000000}, 0.009350, {0.120000, 0.210000, 0.510000, 0.560000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 3.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, -3.000000}, 0.000330, {-0.010000, 0.020000, 0.010000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, -1.000000}, 0.650250, {13.750000, 14.460000, 23.700000, 38.910000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 1.000000}, -0.062080, {-0.480000, -1.400000, -2.270000, -3.710000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 3.000000}, -0.002670, {-0.030000, -0.180000, -0.100000, -0.160000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -5.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -3.000000}, 0.010340, {0.060000, 0.690000, 0.170000, 0.620000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -1.000000}, 7.434880, {154.990000, 165.140000, 135.900000, 444.610000, -0.020000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 1.000000}, 8.868530, {174.250000, 196.330000, 161.680000, 530.290000, -0.010000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 3.000000}, -0.011770, {-0.230000, -0.790000, -0.240000, -0.700000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 5.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -5.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -3.000000}, 0.088150, {0.980000, 5.900000, -0.130000, 5.270000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -1.000000}, 29.577940, {553.390000, 661.640000, 12.430000, 1767.420000, 0.160000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 1.000000}, 7.958910, {253.110000, 175.210000, 44.350000, 475.600000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 3.000000}, -0.009440, {-0.280000, -0.630000, -0.110000, -0.560000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 5.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -5.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -3.000000}, -0.016690, {-0.300000, -1.120000, -0.310000, -1.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -1.000000}, 1.766060, {35.980000, 38.730000, 33.430000, 105.500000, 0.020000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 1.000000}, 1.134660, {38.360000, 24.880000, 25.430000, 67.780000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 3.000000}, -0.002240, {-0.070000, -0.150000, -0.060000, -0.130000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -3.000000}, -0.000610, {-0.010000, -0.040000, -0.020000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -1.000000}, 0.128970, {2.890000, 2.780000, 4.820000, 7.700000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 1.000000}, 0.123870, {4.350000, 2.710000, 4.970000, 7.400000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 3.000000}, -0.000360, {-0.010000, -0.020000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, -3.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, -1.000000}, 0.009850, {0.240000, 0.210000, 0.550000, 0.590000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, 1.000000}, 0.012110, {0.440000, 0.260000, 0.700000, 0.720000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, 3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, -1.000000}, 0.000760, {0.020000, 0.020000, 0.060000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, 1.000000}, 0.001110, {0.040000, 0.020000, 0.080000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, -1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, 1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -7.000000, -1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -7.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -6.000000, -1.000000}, 0.000920, {0.020000, 0.020000, 0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -6.000000, 1.000000}, 0.000200, {0.000000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, -3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, -1.000000}, 0.011270, {0.230000, 0.250000, 1.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, 1.000000}, 0.002300, {0.030000, 0.050000, 0.210000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, -3.000000}, -0.000140, {0.000000, 0.000000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, -1.000000}, 0.133810, {2.770000, 2.960000, 9.750000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 1.000000}, 0.024960, {0.390000, 0.560000, 1.820000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, -3.000000}, 0.000230, {-0.020000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, -1.000000}, 1.515640, {31.760000, 33.590000, 82.840000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 1.000000}, 0.254080, {3.880000, 5.750000, 13.920000, 0.000000, 0.010000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 3.000000}, 0.002320, {0.050000, 0.160000, 0.130000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 5.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -5.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -3.000000}, 0.020450, {0.100000, 1.370000, 0.700000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -1.000000}, 15.566350, {330.350000, 344.990000, 567.470000, 0.230000, 0.030000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 1.000000}, -1.624430, {-20.880000, -36.380000, -59.200000, 0.180000, -0.020000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 3.000000}, -0.065610, {-0.770000, -4.410000, -2.380000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 5.000000}, 0.000120, {0.000000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -5.000000}, -0.000460, {0.000000, -0.050000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -3.000000}, 0.329070, {3.620000, 22.030000, 5.640000, -0.020000, 0.010000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -1.000000}, 166.575280, {3219.290000, 3695.900000, 3042.800000, -5.990000, 0.390000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 1.000000}, 199.485150, {3726.280000, 4413.250000, 3627.390000, -8.680000, 0.730000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 3.000000}, -0.244840, {-4.550000, -16.390000, -4.940000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 5.000000}, 0.000380, {0.000000, 0.040000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -5.000000}, -0.002210, {-0.020000, -0.250000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -3.000000}, 2.186370, {23.850000, 146.450000, -2.380000, -0.270000, 0.030000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -1.000000}, 623.657830, {9963.620000, 13978.190000, 245.160000, -70.260000, 5.000000, -0.030000}},
-{{2.000000, 0.000000, 0.000000, 1.000000}, 117.261610, {3313.250000, 2575.660000, 874.520000, -12.650000, 1.790000, -0.010000}},
-{{2.000000, 0.000000, 0.000000, 3.000000}, -0.144530, {-3.710000, -9.640000, -2.050000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, 5.000000}, 0.000260, {0.000000, 0.030000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -5.000000}, -0.000750, {0.000000, -0.080000, -0.010000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -3.000000}, -0.291160, {-3.490000, -19.630000, -5.360000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -1.000000}, 33.357430, {512.770000, 735.760000, 630.310000, -5.210000, 0.430000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 1.000000}, 15.121650, {433.440000, 331.250000, 359.200000, -2.400000, 0.310000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 3.000000}, -0.030380, {-0.820000, -2.020000, -0.850000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 5.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -5.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -3.000000}, -0.009950, {-0.120000, -0.680000, -0.360000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -1.000000}, 2.146180, {33.220000, 46.620000, 80.120000, -0.450000, 0.040000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 1.000000}, 1.519760, {43.480000, 33.210000, 62.710000, -0.330000, 0.040000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 3.000000}, -0.004510, {-0.120000, -0.300000, -0.200000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 5.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -3.000000}, -0.000930, {0.000000, -0.060000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -1.000000}, 0.146420, {2.280000, 3.130000, 8.160000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 1.000000}, 0.137950, {3.920000, 3.010000, 8.150000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 3.000000}, -0.000560, {-0.020000, -0.040000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, -3.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, -1.000000}, 0.010270, {0.160000, 0.220000, 0.760000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 1.000000}, 0.011860, {0.330000, 0.260000, 0.910000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 3.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, -1.000000}, 0.000730, {0.010000, 0.020000, 0.070000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, 1.000000}, 0.000990, {0.030000, 0.020000, 0.090000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, -1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, 1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -6.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -5.000000, -1.000000}, 0.000280, {0.020000, 0.000000, 0.030000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -5.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, -1.000000}, 0.002470, {0.190000, 0.050000, 0.180000, 0.150000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, 1.000000}, 0.000340, {0.030000, 0.000000, 0.030000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, -3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, -1.000000}, 0.018180, {1.670000, 0.380000, 0.990000, 1.100000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, 1.000000}, 0.001620, {0.170000, 0.030000, 0.090000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, -3.000000}, -0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, -1.000000}, 0.079130, {12.080000, 1.570000, 2.840000, 4.800000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 1.000000}, 0.054290, {3.180000, 1.160000, 1.970000, 3.260000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 3.000000}, 0.000170, {-0.030000, 0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, -3.000000}, -0.003420, {0.050000, -0.230000, -0.060000, -0.200000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, -1.000000}, -0.791050, {41.530000, -18.400000, -14.910000, -47.090000, -0.010000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 1.000000}, -1.317880, {39.710000, -29.980000, -24.580000, -78.590000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 3.000000}, 0.001920, {-0.030000, 0.130000, 0.040000, 0.110000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -5.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -3.000000}, -0.054570, {-0.950000, -3.650000, 0.010000, -3.270000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -1.000000}, -12.094700, {-205.760000, -271.060000, -3.140000, -723.840000, -0.310000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, 1.000000}, -1.264330, {-30.650000, -27.380000, -10.590000, -75.650000, -0.410000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, 3.000000}, 0.001770, {0.040000, 0.120000, 0.030000, 0.110000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -5.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -3.000000}, 0.004650, {0.020000, 0.310000, 0.090000, 0.280000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -1.000000}, -0.822750, {-17.020000, -18.200000, -15.410000, -49.250000, -0.040000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 1.000000}, -0.237020, {-7.850000, -5.100000, -5.790000, -14.190000, -0.080000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 3.000000}, 0.000520, {0.020000, 0.030000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, -3.000000}, 0.000210, {0.000000, 0.010000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, -1.000000}, -0.062830, {-1.470000, -1.370000, -2.340000, -3.760000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 1.000000}, -0.031420, {-1.170000, -0.670000, -1.310000, -1.880000, -0.010000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 3.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, -3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, -1.000000}, -0.004960, {-0.130000, -0.110000, -0.280000, -0.300000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, 1.000000}, -0.003550, {-0.140000, -0.080000, -0.210000, -0.210000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, -1.000000}, -0.000400, {-0.010000, 0.000000, -0.030000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, 1.000000}, -0.000370, {-0.020000, 0.000000, -0.030000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 5.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 5.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -4.000000, -1.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -4.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, -1.000000}, -0.001020, {-0.030000, -0.020000, -0.060000, -0.120000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, -3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, -1.000000}, -0.012620, {-0.470000, -0.280000, -0.460000, -1.510000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 1.000000}, -0.005040, {-0.270000, -0.110000, -0.190000, -0.600000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 3.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, -3.000000}, -0.000460, {-0.020000, -0.030000, 0.000000, -0.060000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, -1.000000}, -0.105350, {-3.660000, -2.340000, -1.910000, -12.620000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 1.000000}, -0.113300, {-3.820000, -2.500000, -2.080000, -13.580000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 3.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, -3.000000}, -0.001030, {-0.020000, -0.060000, 0.020000, -0.120000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, -1.000000}, -0.134150, {-2.410000, -3.040000, -0.260000, -16.070000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, 1.000000}, -0.014820, {-0.520000, -0.320000, -0.530000, -1.780000, 0.030000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, 3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, -3.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, -1.000000}, -0.006170, {-0.080000, -0.140000, -0.130000, -0.740000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, 1.000000}, -0.001450, {-0.050000, -0.030000, -0.080000, -0.170000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, -1.000000}, -0.000250, {0.000000, 0.000000, -0.010000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, 1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -2.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -2.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, -1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, 1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 0.000000, -1.000000}, 0.000370, {0.010000, 0.000000, 0.000000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 0.000000, 1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 1.000000, -1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{3.000000, -3.000000, -1.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -3.000000, -1.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{3.000000, -3.000000, 0.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -2.000000, -3.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -2.000000, -2.000000, -1.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, -2.000000, -2.000000, 1.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, -1.000000}, -0.001010, {-0.030000, -0.020000, -0.020000, -0.120000, -0.390000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, 1.000000}, -0.000630, {-0.030000, -0.010000, -0.010000, -0.080000, -0.250000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, -3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, -1.000000}, -0.001310, {-0.050000, -0.030000, 0.000000, -0.160000, -0.510000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, 1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{3.000000, -2.000000, 1.000000, -1.000000}, -0.000140, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, -2.000000, 2.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, -4.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, -3.000000, -1.000000}, -0.000220, {0.000000, 0.000000, -0.010000, -0.010000, -0.080000, 0.000000}},
-{{3.000000, -1.000000, -2.000000, -1.000000}, -0.002820, {-0.070000, -0.060000, -0.100000, -0.170000, -1.100000, 0.000000}},
-{{3.000000, -1.000000, -2.000000, 1.000000}, -0.003290, {-0.070000, -0.070000, -0.120000, -0.200000, -1.280000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, -3.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, -1.000000}, -0.021040, {-0.530000, -0.470000, -0.390000, -1.260000, -8.180000, 0.040000}},
-{{3.000000, -1.000000, -1.000000, 1.000000}, -0.013560, {-0.550000, -0.290000, -0.270000, -0.810000, -5.270000, 0.030000}},
-{{3.000000, -1.000000, -1.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 0.000000, -3.000000}, -0.000760, {-0.010000, -0.050000, 0.000000, -0.050000, -0.300000, 0.000000}},
-{{3.000000, -1.000000, 0.000000, -1.000000}, -0.025720, {-0.940000, -0.600000, -0.070000, -1.530000, -10.000000, 0.050000}},
-{{3.000000, -1.000000, 0.000000, 1.000000}, -0.000420, {-0.190000, 0.000000, -0.100000, -0.020000, -0.160000, 0.000000}},
-{{3.000000, -1.000000, 0.000000, 3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, -1.000000}, -0.002750, {-0.110000, -0.060000, -0.060000, -0.160000, -1.070000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, 1.000000}, -0.000300, {-0.050000, 0.000000, -0.020000, -0.020000, -0.120000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, -1.000000}, -0.000270, {-0.010000, 0.000000, -0.010000, -0.020000, -0.100000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, 1.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, -1.000000, 3.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 3.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -4.000000, -1.000000}, -0.000160, {0.000000, 0.000000, -0.010000, 0.000000, -0.060000, 0.000000}},
-{{3.000000, 0.000000, -4.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, -1.000000}, -0.002870, {-0.040000, -0.060000, -0.160000, 0.000000, -1.120000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, 1.000000}, 0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, 3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, -3.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, -1.000000}, -0.039410, {-0.880000, -0.870000, -1.440000, 0.000000, -15.320000, 0.080000}},
-{{3.000000, 0.000000, -2.000000, 1.000000}, -0.048520, {-1.040000, -1.060000, -1.770000, 0.000000, -18.870000, 0.100000}},
-{{3.000000, 0.000000, -2.000000, 3.000000}, 0.000160, {0.000000, 0.010000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, -3.000000}, -0.001280, {-0.010000, -0.090000, -0.020000, 0.000000, -0.500000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, -1.000000}, -0.305170, {-7.430000, -6.740000, -5.660000, 0.080000, -118.660000, 0.630000}},
-{{3.000000, 0.000000, -1.000000, 1.000000}, -0.205930, {-7.880000, -4.390000, -4.050000, 0.120000, -80.070000, 0.420000}},
-{{3.000000, 0.000000, -1.000000, 3.000000}, 0.000380, {0.020000, 0.020000, 0.000000, 0.000000, 0.150000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, -3.000000}, -0.010090, {-0.130000, -0.680000, 0.000000, 0.000000, -3.920000, 0.020000}},
-{{3.000000, 0.000000, 0.000000, -1.000000}, -0.351830, {-11.870000, -8.150000, -0.990000, 0.220000, -136.800000, 0.720000}},
-{{3.000000, 0.000000, 0.000000, 1.000000}, -0.028400, {-2.770000, -0.490000, -1.370000, 0.100000, -11.040000, 0.060000}},
-{{3.000000, 0.000000, 0.000000, 3.000000}, 0.000160, {0.000000, 0.010000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -1.000000}, -0.036110, {-1.260000, -0.830000, -0.750000, 0.030000, -14.040000, 0.070000}},
-{{3.000000, 0.000000, 1.000000, 1.000000}, -0.006580, {-0.560000, -0.120000, -0.290000, 0.020000, -2.560000, 0.010000}},
-{{3.000000, 0.000000, 1.000000, 3.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, -1.000000}, -0.003220, {-0.120000, -0.070000, -0.130000, 0.000000, -1.250000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, 1.000000}, -0.001080, {-0.080000, -0.020000, -0.060000, 0.000000, -0.420000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, -1.000000}, -0.000270, {-0.010000, 0.000000, -0.020000, 0.000000, -0.110000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, 1.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{3.000000, 0.000000, 4.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 4.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -4.000000, -1.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, 1.000000, -4.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, -1.000000}, -0.000440, {-0.020000, 0.000000, -0.020000, -0.030000, -0.170000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, 1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, -1.000000}, -0.001520, {-0.090000, -0.030000, -0.060000, -0.090000, -0.590000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, 1.000000}, -0.002610, {-0.120000, -0.060000, -0.090000, -0.160000, -1.020000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.010000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, -1.000000}, 0.013210, {0.230000, 0.290000, 0.250000, 0.790000, 5.140000, -0.030000}},
-{{3.000000, 1.000000, -1.000000, 1.000000}, 0.020830, {0.370000, 0.450000, 0.390000, 1.240000, 8.100000, -0.040000}},
-{{3.000000, 1.000000, -1.000000, 3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 1.000000, 0.000000, -3.000000}, 0.000310, {0.000000, 0.020000, 0.000000, 0.020000, 0.120000, 0.000000}},
-{{3.000000, 1.000000, 0.000000, -1.000000}, 0.034360, {0.680000, 0.770000, 0.090000, 2.050000, 13.360000, -0.070000}},
-{{3.000000, 1.000000, 0.000000, 1.000000}, 0.013510, {0.390000, 0.290000, 0.170000, 0.810000, 5.250000, -0.030000}},
-{{3.000000, 1.000000, 0.000000, 3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{3.000000, 1.000000, 1.000000, -1.000000}, 0.004260, {0.090000, 0.090000, 0.090000, 0.250000, 1.660000, 0.000000}},
-{{3.000000, 1.000000, 1.000000, 1.000000}, 0.002580, {0.080000, 0.050000, 0.070000, 0.150000, 1.000000, 0.000000}},
-{{3.000000, 1.000000, 2.000000, -1.000000}, 0.000440, {0.000000, 0.000000, 0.020000, 0.030000, 0.170000, 0.000000}},
-{{3.000000, 1.000000, 2.000000, 1.000000}, 0.000350, {0.010000, 0.000000, 0.020000, 0.020000, 0.140000, 0.000000}},
-{{3.000000, 1.000000, 3.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 1.000000, 3.000000, 1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 2.000000, -2.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, -2.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 2.000000, -1.000000, -1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 2.000000, -1.000000, 1.000000}, -0.000100, {0.000000, 0.000000, 0.000000, -0.010000, -0.040000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, -1.000000}, -0.000560, {0.000000, -0.010000, 0.000000, -0.070000, -0.220000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, 1.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, 2.000000, 1.000000, -1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, -0.030000, 0.000000}},
-{{3.000000, 2.000000, 1.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 2.000000, 2.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 3.000000, -1.000000, -3.000000}, 0.000010, {0.000000, 0.000000, -0.020000, -0.010000, 0.030000, 0.000000}},
-{{3.000000, 3.000000, -1.000000, -1.000000}, 0.000000, {-0.010000, 0.000000, -0.010000, -0.020000, 0.010000, 0.000000}},
-{{3.000000, 3.000000, -1.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -2.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -1.000000, -1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -1.000000, 1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 0.000000, -1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 0.000000, 1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 1.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -2.000000, -1.000000}, 0.000130, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -2.000000, 1.000000}, 0.000590, {0.030000, 0.010000, 0.020000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, -1.000000}, 0.001650, {0.070000, 0.040000, 0.030000, 0.300000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, 1.000000}, 0.001340, {0.070000, 0.030000, 0.030000, 0.240000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, -3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, -1.000000}, 0.001610, {0.080000, 0.040000, 0.000000, 0.290000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, 1.000000}, 0.000800, {0.050000, 0.020000, 0.010000, 0.140000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, -1.000000}, 0.000240, {0.010000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, 1.000000}, 0.000170, {0.010000, 0.000000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 2.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 2.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -4.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, 1.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, -3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, -1.000000}, 0.002830, {0.110000, 0.060000, 0.100000, 0.340000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 1.000000}, 0.012300, {0.500000, 0.270000, 0.450000, 1.470000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, -3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, -1.000000}, 0.034620, {1.290000, 0.770000, 0.650000, 4.140000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 1.000000}, 0.023800, {1.250000, 0.520000, 0.530000, 2.850000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, -3.000000}, 0.000290, {0.000000, 0.020000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, -1.000000}, 0.028990, {1.410000, 0.650000, 0.180000, 3.460000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, 1.000000}, 0.012700, {0.790000, 0.270000, 0.200000, 1.520000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, 3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, -3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, -1.000000}, 0.004170, {0.210000, 0.090000, 0.100000, 0.500000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, 1.000000}, 0.002550, {0.170000, 0.060000, 0.080000, 0.300000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, -1.000000}, 0.000470, {0.030000, 0.010000, 0.020000, 0.060000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, 1.000000}, 0.000370, {0.030000, 0.000000, 0.020000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 3.000000, -1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 3.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -6.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -5.000000, -1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, -1.000000}, -0.000580, {-0.020000, -0.010000, -0.040000, -0.030000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, -3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, -1.000000}, -0.000900, {-0.030000, -0.020000, -0.050000, -0.050000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 1.000000}, 0.001910, {0.120000, 0.040000, 0.100000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 3.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, -3.000000}, -0.000330, {-0.010000, -0.020000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, -1.000000}, 0.052510, {1.990000, 1.160000, 1.920000, 3.140000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 1.000000}, 0.213760, {8.240000, 4.680000, 7.800000, 12.770000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 3.000000}, -0.000600, {-0.020000, -0.040000, -0.020000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -3.000000}, -0.000650, {-0.040000, -0.040000, -0.010000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -1.000000}, 0.595800, {21.190000, 13.270000, 11.160000, 35.530000, 0.020000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 1.000000}, 0.338820, {16.920000, 7.360000, 7.740000, 20.210000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 3.000000}, -0.000750, {-0.040000, -0.050000, -0.020000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -5.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -3.000000}, 0.005340, {0.130000, 0.360000, 0.000000, 0.320000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -1.000000}, 0.414960, {19.000000, 9.230000, 2.870000, 24.710000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 1.000000}, 0.157910, {9.240000, 3.410000, 2.730000, 9.410000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 3.000000}, -0.000370, {-0.020000, -0.020000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -3.000000}, -0.000620, {-0.020000, -0.040000, -0.010000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -1.000000}, 0.056860, {2.690000, 1.240000, 1.350000, 3.380000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 1.000000}, 0.030090, {1.830000, 0.650000, 0.930000, 1.790000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 3.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, -3.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, -1.000000}, 0.006140, {0.300000, 0.130000, 0.250000, 0.370000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, 1.000000}, 0.004210, {0.260000, 0.090000, 0.200000, 0.250000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, -3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, -1.000000}, 0.000600, {0.030000, 0.010000, 0.040000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, 1.000000}, 0.000500, {0.030000, 0.010000, 0.030000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 4.000000, -1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 4.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -7.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -6.000000, -1.000000}, -0.000150, {0.000000, 0.000000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -6.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -5.000000, -1.000000}, -0.001160, {-0.050000, -0.030000, -0.110000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, -3.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, -1.000000}, -0.006800, {-0.280000, -0.150000, -0.500000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 1.000000}, 0.000290, {0.000000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, -3.000000}, -0.000660, {-0.020000, -0.040000, -0.040000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, -1.000000}, -0.007710, {-0.290000, -0.170000, -0.420000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 1.000000}, 0.021740, {1.300000, 0.470000, 1.190000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 3.000000}, -0.001270, {-0.040000, -0.090000, -0.070000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -3.000000}, -0.003900, {-0.140000, -0.260000, -0.140000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -1.000000}, 0.633710, {23.670000, 13.990000, 23.160000, -0.030000, 0.080000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 1.000000}, 2.413890, {90.530000, 52.840000, 87.950000, -0.350000, 0.070000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 3.000000}, -0.006320, {-0.240000, -0.420000, -0.240000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 5.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -5.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -3.000000}, -0.005540, {-0.340000, -0.370000, -0.100000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -1.000000}, 6.579620, {223.570000, 146.750000, 123.070000, -1.940000, 0.260000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 1.000000}, 2.998500, {142.570000, 65.020000, 71.120000, -0.780000, 0.060000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 3.000000}, -0.006640, {-0.310000, -0.440000, -0.190000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 5.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -5.000000}, -0.000130, {0.000000, -0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -3.000000}, 0.062570, {1.510000, 4.190000, -0.040000, -0.030000, 0.020000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -1.000000}, 3.674490, {157.550000, 81.630000, 29.570000, -1.610000, 0.060000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 1.000000}, 1.191880, {65.390000, 25.660000, 23.110000, -0.450000, 0.080000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 3.000000}, -0.002880, {-0.150000, -0.190000, -0.080000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -3.000000}, -0.005520, {-0.150000, -0.380000, -0.110000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -1.000000}, 0.473380, {20.490000, 10.320000, 11.590000, -0.250000, 0.020000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 1.000000}, 0.212590, {11.970000, 4.560000, 6.920000, -0.100000, 0.010000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 3.000000}, -0.000680, {-0.040000, -0.040000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, -3.000000}, -0.000900, {-0.020000, -0.060000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, -1.000000}, 0.048340, {2.100000, 1.030000, 2.040000, -0.030000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 1.000000}, 0.028280, {1.600000, 0.600000, 1.370000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 3.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, -3.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, -1.000000}, 0.004490, {0.200000, 0.090000, 0.270000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, 1.000000}, 0.003230, {0.180000, 0.070000, 0.210000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, -1.000000}, 0.000400, {0.020000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, 1.000000}, 0.000340, {0.020000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 5.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 5.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -5.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -4.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -4.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, -1.000000}, 0.000630, {0.050000, 0.010000, 0.030000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, 1.000000}, 0.001920, {0.190000, 0.040000, 0.100000, 0.110000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, -1.000000}, -0.002030, {0.570000, -0.050000, -0.080000, -0.120000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 1.000000}, -0.029570, {0.540000, -0.670000, -1.080000, -1.780000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 3.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, -3.000000}, -0.000150, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, -1.000000}, -0.171910, {-3.930000, -3.890000, -3.200000, -10.300000, -0.020000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 1.000000}, -0.050970, {-1.360000, -1.110000, -1.240000, -3.060000, -0.020000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 3.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, -3.000000}, -0.003040, {-0.090000, -0.200000, 0.000000, -0.180000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, -1.000000}, -0.113080, {-4.830000, -2.510000, -0.930000, -6.760000, -0.020000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 1.000000}, -0.025490, {-1.260000, -0.540000, -0.520000, -1.530000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 3.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -3.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -1.000000}, -0.016920, {-0.790000, -0.370000, -0.420000, -1.010000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, 1.000000}, -0.005580, {-0.320000, -0.120000, -0.190000, -0.330000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, -1.000000}, -0.001960, {-0.100000, -0.040000, -0.080000, -0.120000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, 1.000000}, -0.000880, {-0.050000, -0.020000, -0.040000, -0.050000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, -1.000000}, -0.000200, {-0.010000, 0.000000, -0.010000, -0.010000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, 1.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 4.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 4.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, 1.000000}, -0.000200, {-0.010000, 0.000000, -0.010000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, -3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, -1.000000}, -0.001140, {-0.070000, -0.020000, -0.040000, -0.140000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, 1.000000}, -0.002770, {-0.160000, -0.060000, -0.100000, -0.330000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, -3.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, -1.000000}, -0.004380, {-0.250000, -0.090000, -0.080000, -0.520000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, 1.000000}, -0.001790, {-0.120000, -0.040000, -0.050000, -0.210000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, -1.000000}, -0.000560, {-0.030000, -0.010000, -0.020000, -0.070000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, 1.000000}, -0.000250, {-0.020000, 0.000000, -0.010000, -0.030000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 1.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 1.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -2.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -1.000000, -1.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -1.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, 0.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, -2.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, -2.000000, -2.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, -1.000000}, -0.000100, {0.000000, 0.000000, 0.000000, -0.010000, -0.040000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, 0.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -3.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, -1.000000, -3.000000, 1.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, -1.000000}, -0.000570, {-0.020000, -0.010000, -0.020000, -0.030000, -0.220000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, 1.000000}, -0.000610, {-0.040000, -0.010000, -0.020000, -0.040000, -0.240000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, -3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, -1.000000}, -0.001270, {-0.070000, -0.030000, -0.030000, -0.080000, -0.500000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, 1.000000}, -0.000290, {-0.030000, 0.000000, -0.010000, -0.020000, -0.110000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, -3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, -1.000000}, -0.000320, {-0.030000, 0.000000, 0.000000, -0.020000, -0.120000, 0.000000}},
-{{5.000000, -1.000000, 1.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 0.000000, -4.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, -3.000000, -1.000000}, -0.000330, {-0.010000, 0.000000, -0.020000, 0.000000, -0.130000, 0.000000}},
-{{5.000000, 0.000000, -3.000000, 1.000000}, -0.001240, {-0.050000, -0.030000, -0.070000, 0.000000, -0.480000, 0.000000}},
-{{5.000000, 0.000000, -2.000000, -1.000000}, -0.005050, {-0.210000, -0.110000, -0.190000, 0.000000, -1.960000, 0.010000}},
-{{5.000000, 0.000000, -2.000000, 1.000000}, -0.005190, {-0.290000, -0.110000, -0.200000, 0.000000, -2.020000, 0.010000}},
-{{5.000000, 0.000000, -2.000000, 3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, -3.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, -1.000000}, -0.010490, {-0.540000, -0.240000, -0.220000, 0.010000, -4.080000, 0.020000}},
-{{5.000000, 0.000000, -1.000000, 1.000000}, -0.002450, {-0.210000, -0.050000, -0.090000, 0.000000, -0.950000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, 3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, -3.000000}, -0.000410, {-0.010000, -0.030000, 0.000000, 0.000000, -0.160000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, -1.000000}, -0.002540, {-0.190000, -0.060000, -0.070000, 0.000000, -0.990000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, 1.000000}, -0.000270, {-0.050000, 0.000000, -0.030000, 0.000000, -0.100000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, -3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, -1.000000}, -0.000450, {-0.030000, -0.010000, -0.020000, 0.000000, -0.170000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, 1.000000}, -0.000060, {-0.010000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 0.000000, 2.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 0.000000, 2.000000, 1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, -3.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, -3.000000, 1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, -1.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, 1.000000}, 0.000410, {0.010000, 0.000000, 0.020000, 0.020000, 0.160000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, -1.000000}, 0.000970, {0.040000, 0.020000, 0.020000, 0.060000, 0.380000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, 1.000000}, 0.000530, {0.030000, 0.010000, 0.010000, 0.030000, 0.210000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, -3.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, -1.000000}, 0.000510, {0.020000, 0.010000, 0.000000, 0.030000, 0.200000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, 1.000000}, 0.000230, {0.010000, 0.000000, 0.000000, 0.010000, 0.090000, 0.000000}},
-{{5.000000, 1.000000, 1.000000, -1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{5.000000, 1.000000, 1.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{5.000000, 1.000000, 2.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 2.000000, -1.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 2.000000, 0.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -3.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -2.000000, -1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -2.000000, 1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -1.000000, -1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -1.000000, 1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 0.000000, -1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 0.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 1.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -3.000000, -1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -3.000000, 1.000000}, 0.000330, {0.020000, 0.000000, 0.020000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, -1.000000}, 0.000880, {0.050000, 0.020000, 0.030000, 0.100000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, 1.000000}, 0.000870, {0.060000, 0.020000, 0.040000, 0.100000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, -3.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, -1.000000}, 0.001370, {0.090000, 0.030000, 0.030000, 0.160000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, 1.000000}, 0.000780, {0.060000, 0.020000, 0.020000, 0.090000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, -1.000000}, 0.000670, {0.050000, 0.010000, 0.010000, 0.080000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, 1.000000}, 0.000320, {0.030000, 0.000000, 0.000000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 1.000000, -1.000000}, 0.000130, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 1.000000, 1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 2.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 2.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -4.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -4.000000, 1.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, -1.000000}, 0.000890, {0.050000, 0.020000, 0.050000, 0.050000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 1.000000}, 0.004150, {0.240000, 0.090000, 0.230000, 0.250000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, -1.000000}, 0.010910, {0.590000, 0.240000, 0.400000, 0.650000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 1.000000}, 0.009390, {0.640000, 0.200000, 0.380000, 0.560000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, -3.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, -1.000000}, 0.014860, {0.960000, 0.330000, 0.350000, 0.880000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, 1.000000}, 0.007570, {0.590000, 0.160000, 0.240000, 0.450000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, 3.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, -3.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, -1.000000}, 0.006520, {0.470000, 0.140000, 0.120000, 0.390000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, 1.000000}, 0.002880, {0.240000, 0.060000, 0.090000, 0.170000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, 3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, -1.000000}, 0.001220, {0.090000, 0.030000, 0.040000, 0.070000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, 1.000000}, 0.000630, {0.060000, 0.010000, 0.030000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, -1.000000}, 0.000170, {0.010000, 0.000000, 0.000000, 0.010000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, 1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 3.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 3.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, -1.000000}, 0.000140, {0.000000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 1.000000}, 0.000720, {0.050000, 0.020000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, -1.000000}, 0.007020, {0.400000, 0.150000, 0.380000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 1.000000}, 0.031180, {1.770000, 0.680000, 1.710000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 3.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, -3.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, -1.000000}, 0.080960, {4.280000, 1.790000, 3.000000, -0.040000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 1.000000}, 0.059630, {3.970000, 1.280000, 2.460000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 3.000000}, -0.000210, {-0.010000, -0.010000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, -3.000000}, 0.001070, {0.040000, 0.070000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, -1.000000}, 0.094030, {5.840000, 2.080000, 2.280000, -0.070000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 1.000000}, 0.042170, {3.170000, 0.890000, 1.370000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 3.000000}, -0.000140, {-0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -3.000000}, 0.000600, {0.040000, 0.040000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -1.000000}, 0.036740, {2.540000, 0.800000, 0.730000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, 1.000000}, 0.014650, {1.190000, 0.310000, 0.470000, -0.010000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, 3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, -3.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, -1.000000}, 0.006540, {0.460000, 0.140000, 0.220000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, 1.000000}, 0.003050, {0.250000, 0.060000, 0.130000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, 3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, -3.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, -1.000000}, 0.000880, {0.060000, 0.020000, 0.040000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, 1.000000}, 0.000480, {0.040000, 0.010000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 3.000000, -1.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 3.000000, 1.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 4.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -4.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -3.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -3.000000, 1.000000}, -0.000540, {0.000000, -0.010000, -0.030000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, -1.000000}, -0.002560, {-0.080000, -0.060000, -0.090000, -0.150000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, 1.000000}, -0.001370, {-0.050000, -0.030000, -0.060000, -0.080000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, -3.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, -1.000000}, -0.003500, {-0.190000, -0.080000, -0.080000, -0.210000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, 1.000000}, -0.001160, {-0.070000, -0.020000, -0.040000, -0.070000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, -3.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, -1.000000}, -0.001530, {-0.100000, -0.030000, -0.030000, -0.090000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, 1.000000}, -0.000470, {-0.040000, 0.000000, -0.020000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, -1.000000}, -0.000310, {-0.020000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, 1.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 2.000000, -1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 2.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -3.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -3.000000, 1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -2.000000, -1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.010000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -2.000000, 1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -1.000000, -1.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -1.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -3.000000, -1.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -3.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -2.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{7.000000, -1.000000, -2.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -1.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -4.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -3.000000, -1.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{7.000000, 0.000000, -3.000000, 1.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, -1.000000}, -0.000240, {-0.020000, 0.000000, 0.000000, 0.000000, -0.090000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, 1.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, -3.000000}, -0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, -1.000000}, -0.000130, {-0.010000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{7.000000, 0.000000, 0.000000, -1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, -0.010000, 0.000000}},
-{{7.000000, 1.000000, -2.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 1.000000, -2.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 1.000000, -1.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 1.000000, -1.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -3.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -3.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -2.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -2.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -1.000000, -1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -1.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, 0.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -4.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -4.000000, 1.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -3.000000, -1.000000}, 0.000190, {0.010000, 0.000000, 0.010000, 0.010000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -3.000000, 1.000000}, 0.000220, {0.020000, 0.000000, 0.010000, 0.010000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, -1.000000}, 0.000380, {0.030000, 0.000000, 0.020000, 0.020000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, 1.000000}, 0.000250, {0.020000, 0.000000, 0.010000, 0.010000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, -1.000000}, 0.000290, {0.030000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, 1.000000}, 0.000150, {0.020000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 0.000000, -1.000000}, 0.000110, {0.010000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 0.000000, 1.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 1.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 1.000000, 1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -5.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -4.000000, -1.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -4.000000, 1.000000}, 0.000420, {0.030000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, -1.000000}, 0.001070, {0.080000, 0.020000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, 1.000000}, 0.001080, {0.090000, 0.020000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, -3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, -1.000000}, 0.001890, {0.150000, 0.040000, 0.080000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, 1.000000}, 0.001110, {0.110000, 0.020000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, -3.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, -1.000000}, 0.001300, {0.120000, 0.030000, 0.040000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, 1.000000}, 0.000600, {0.060000, 0.010000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, -1.000000}, 0.000450, {0.040000, 0.000000, 0.010000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, 1.000000}, 0.000200, {0.020000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 1.000000, -1.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 1.000000, 1.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 2.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -3.000000, -1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -3.000000, 1.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -2.000000, -1.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -2.000000, 1.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -1.000000, -1.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -1.000000, 1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, 0.000000, -1.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -4.000000, -1.000000}, 0.000010, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -4.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -3.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -3.000000, 1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -2.000000, -1.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -2.000000, 1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -1.000000, -1.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
+
+static const uint16_t arg[] = {
+2, 5, 6, 9, 13, 15, 19, 21, 27, 28,
+30, 35, 36, 41, 44, 48, 51, 53, 54, 55,
+57, 59, 60, 61, 62, 63, 64, 68, 69, 71,
+73, 78, 80, 81, 86, 88, 89, 90, 91, 93,
+94, 97, 101, 102, 105, 108, 109, 110, 111, 112,
+116, 117, 118, 120, 121, 122, 131, 133, 136, 139,
+143, 146, 147, 149, 150, 152, 154, 158, 164, 166,
+168, 172, 173, 176, 177, 178, 185, 187, 191, 192,
+193, 194, 196, 197, 199, 200, 203, 206, 207, 208,
+209, 211, 212, 213, 217, 218, 221, 225, 230, 232,
+233, 236, 239, 243, 247, 249, 250, 251, 252, 253,
+254, 255, 256, 258, 260, 261, 262, 263, 264, 265,
+268, 270, 271, 278, 284, 286, 287, 288, 289, 293,
+294, 295, 299, 300, 301, 303, 304, 306, 308, 310,
+311, 318, 319, 322, 323, 325, 327, 332, 335, 339,
+340, 341, 342, 346, 348, 351, 354, 356, 358, 359,
+362, 364, 366, 371, 373, 374, 377, 378, 380, 384,
+388, 389, 390, 391, 393, 394, 396, 397, 398, 399,
+401, 407, 408, 409, 410, 411, 412, 413, 416, 417,
+422, 424, 425, 427, 428, 434, 438, 439, 444, 445,
+448, 450, 451, 453, 455, 457, 458, 460, 461, 462,
+463, 464, 467, 468, 469, 471, 474, 475, 476, 477,
+478, 479, 482, 483, 484, 485, 487, 492, 493, 495,
+501, 504, 505, 508, 510, 511, 513, 514, 516, 521,
+525, 531, 536, 539, 544, 546, 547, 549, 551, 552,
+560, 561, 562, 568, 569, 571, 572, 573, 575, 577,
+579, 580, 582, 583, 584, 585, 588, 590, 591, 594,
+596, 597, 598, 600, 601, 602, 605, 607, 610, 611,
+612, 618, 619, 620, 621, 622, 623, 624, 626, 627,
+631, 632, 636, 638, 640, 642, 646, 647, 649, 651,
+652, 655, 659, 661, 662, 664, 665, 666, 667, 668,
+672, 673, 674, 675, 676, 681, 682, 683, 686, 687,
+689, 692, 693, 695, 697, 700, 701, 704, 706, 708,
+712, 713, 716, 717, 720, 721, 723, 726, 728, 731,
+733, 734, 739, 740, 741, 744, 745, 746, 749, 752,
+753, 755, 756, 765, 767, 768, 769, 771, 772, 775,
+777, 778, 779, 780, 782, 784, 786, 788, 790, 792,
+797, 798, 799, 801, 802, 808, 809, 810, 812, 815,
+817, 820, 821, 823, 824, 825, 827, 828, 837, 839,
+841, 843, 845, 846, 852, 854, 855, 857, 858, 863,
+867, 870, 872, 874, 875, 877, 878, 879, 880, 882,
+883, 884, 885, 886, 887, 888, 891, 892, 894, 895,
+899, 900, 902, 903, 910, 913, 914, 915, 918, 921,
+922, 923, 926, 928, 931, 933, 939, 941, 942, 943,
+944, 945, 946, 947, 950, 952, 959, 960, 962, 963,
+964, 965, 966, 969, 971, 973, 974, 975, 976, 979,
+980, 981, 982, 987, 988, 993, 995, 996, 998, 1002,
+1008, 1010, 1012, 1013, 1014, 1018, 1019, 1021, 1023, 1024,
+1027, 1028, 1029, 1033, 1034, 1037, 1038, 1040, 1045, 1046,
+1048, 1055, 1057, 1066, 1067, 1072, 1074, 1075, 1076, 1078,
+1083, 1085, 1090, 1091, 1094, 1095, 1096, 1097, 1098, 1099,
+1103, 1105, 1106, 1107, 1108, 1109, 1110, 1118, 1119, 1120,
+1124, 1125, 1128, 1129, 1130, 1131, 1135, 1138, 1139, 1144,
+1148, 1150, 1151, 1156, 1157, 1158, 1165, 1168, 1170, 1171,
+1172, 1178, 1181, 1182, 1183, 1190, 1191, 1193, 1196, 1197,
+1201, 1203, 1205, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+1216, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1229, 1230,
+1231, 1232, 1233, 1234, 1235, 1236, 1239, 1242, 1243, 1244,
+1245, 1246, 1251, 1255, 1264, 1265, 1266, 1267, 1270, 1271,
+1272, 1273, 1276, 1277, 1279, 1280, 1281, 1282, 1293, 1294,
+1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+1305, 1306, 1313, 1314, 1315, 1316, 1317, 1322, 1323, 1339,
+1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366,
+1367, 1368, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
+1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
+1406, 1407, 1408, 1409, 1425, 1426, 1427, 1428, 1429, 1430,
+1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+1488, 1489, 1490, 1491, 1499, 1500, 1501, 1502, 1503, 1510,
+1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1520, 1521,
+1522, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
+1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1605, 1606,
+1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
+1617, 1618, 1619, 1620, 1621, 1622, 1705, 1706, 1707, 1708,
+1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,
+1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738,
+1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
+1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
+1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+1779, 1780, 1781, 1782, 1783, 1796, 1876, 1877, 1878, 1879,
+1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,
+1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899,
+1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+1940, 1941, 1942, 1943, 1944, 1945, 1946, 1949,
+};
+
+static const uint16_t max_arg[] = {
+2, 5, 6, 9, 13, 15, 19, 21, 27, 28,
+30, 35, 36, 41, 44, 48, 51, 53, 54, 55,
+57, 59, 60, 61, 62, 63, 64, 68, 69, 71,
+73, 78, 80, 81, 86, 88, 89, 90, 91, 93,
+94, 97, 101, 102, 105, 108, 109, 110, 111, 112,
+116, 117, 118, 120, 121, 122, 131, 133, 136, 139,
+143, 146, 147, 149, 150, 152, 154, 158, 164, 166,
+168, 172, 173, 176, 177, 178, 185, 187, 191, 192,
+193, 194, 196, 197, 199, 200, 203, 206, 207, 208,
+209, 211, 212, 213, 217, 218, 221, 225, 230, 232,
+233, 236, 239, 243, 247, 249, 250, 251, 252, 253,
+254, 255, 256, 258, 260, 261, 262, 263, 264, 265,
+268, 270, 271, 278, 284, 286, 287, 288, 289, 293,
+294, 295, 299, 300, 301, 303, 304, 306, 308, 310,
+311, 318, 319, 322, 323, 325, 327, 332, 335, 339,
+340, 341, 342, 346, 348, 351, 354, 356, 358, 359,
+362, 364, 366, 371, 373, 374, 377, 378, 380, 384,
+388, 389, 390, 391, 393, 394, 396, 397, 398, 399,
+401, 407, 408, 409, 410, 411, 412, 413, 416, 417,
+422, 424, 425, 427, 428, 434, 438, 439, 444, 445,
+448, 450, 451, 453, 455, 457, 458, 460, 461, 462,
+463, 464, 467, 468, 469, 471, 474, 475, 476, 477,
+478, 479, 482, 483, 484, 485, 487, 492, 493, 495,
+501, 504, 505, 508, 510, 511, 513, 514, 516, 521,
+525, 531, 536, 539, 544, 546, 547, 549, 551, 552,
+560, 561, 562, 568, 569, 571, 572, 573, 575, 577,
+579, 580, 582, 583, 584, 585, 588, 590, 591, 594,
+596, 597, 598, 600, 601, 602, 605, 607, 610, 611,
+612, 618, 619, 620, 621, 622, 623, 624, 626, 627,
+631, 632, 636, 638, 640, 642, 646, 647, 649, 651,
+652, 655, 659, 661, 662, 664, 665, 666, 667, 668,
+672, 673, 674, 675, 676, 681, 682, 683, 686, 687,
+689, 692, 693, 695, 697, 700, 701, 704, 706, 708,
+712, 713, 716, 717, 720, 721, 723, 726, 728, 731,
+733, 734, 739, 740, 741, 744, 745, 746, 749, 752,
+753, 755, 756, 765, 767, 768, 769, 771, 772, 775,
+777, 778, 779, 780, 782, 784, 786, 788, 790, 792,
+797, 798, 799, 801, 802, 808, 809, 810, 812, 815,
+817, 820, 821, 823, 824, 825, 827, 828, 837, 839,
+841, 843, 845, 846, 852, 854, 855, 857, 858, 863,
+867, 870, 872, 874, 875, 877, 878, 879, 880, 882,
+883, 884, 885, 886, 887, 888, 891, 892, 894, 895,
+899, 900, 902, 903, 910, 913, 914, 915, 918, 921,
+922, 923, 926, 928, 931, 933, 939, 941, 942, 943,
+944, 945, 946, 947, 950, 952, 959, 960, 962, 963,
+964, 965, 966, 969, 971, 973, 974, 975, 976, 979,
+980, 981, 982, 987, 988, 993, 995, 996, 998, 1002,
+1008, 1010, 1012, 1013, 1014, 1018, 1019, 1021, 1023, 1024,
+1027, 1028, 1029, 1033, 1034, 1037, 1038, 1040, 1045, 1046,
+1048, 1055, 1057, 1066, 1067, 1072, 1074, 1075, 1076, 1078,
+1083, 1085, 1090, 1091, 1094, 1095, 1096, 1097, 1098, 1099,
+1103, 1105, 1106, 1107, 1108, 1109, 1110, 1118, 1119, 1120,
+1124, 1125, 1128, 1129, 1130, 1131, 1135, 1138, 1139, 1144,
+1148, 1150, 1151, 1156, 1157, 1158, 1165, 1168, 1170, 1171,
+1172, 1178, 1181, 1182, 1183, 1190, 1191, 1193, 1196, 1197,
+1201, 1203, 1205, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+1216, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1229, 1230,
+1231, 1232, 1233, 1234, 1235, 1236, 1239, 1242, 1243, 1244,
+1245, 1246, 1251, 1255, 1264, 1265, 1266, 1267, 1270, 1271,
+1272, 1273, 1276, 1277, 1279, 1280, 1281, 1282, 1293, 1294,
+1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+1305, 1306, 1313, 1314, 1315, 1316, 1317, 1322, 1323, 1339,
+1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366,
+1367, 1368, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
+1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
+1406, 1407, 1408, 1409, 1425, 1426, 1427, 1428, 1429, 1430,
+1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+1488, 1489, 1490, 1491, 1499, 1500, 1501, 1502, 1503, 1510,
+1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1520, 1521,
+1522, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
+1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1605, 1606,
+1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
+1617, 1618, 1619, 1620, 1621, 1622, 1705, 1706, 1707, 1708,
+1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,
+1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738,
+1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
+1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
+1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+1779, 1780, 1781, 1782, 1783, 1796, 1876, 1877, 1878, 1879,
+1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,
+1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899,
+1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+1940, 1941, 1942, 1943, 1944, 1945, 1946, 1949,
+};
+
+static const double ELP_ALIGNED amp[] = {
+18461.238680000977, 1010.1670684572065, 999.69357574283754, 623.65242834342678,
+199.48374400255545, 166.57410217079999, 117.26068633236684, 61.911945225502166,
+33.357200171065656, 31.759668197533784, 29.576578747398852, 15.566264146094996,
+15.121553091067174, -12.094142301993864, 8.8681361287979623, 7.9585483545426978,
+7.4345495887323496, -6.7314313333408666, 6.5795744852210385, -6.4600674026070557,
+-6.2964758811173036, -5.6323496253612273, -5.3683956888492324, -5.3112745069456917,
+-5.075914192200714, -4.8396107976110407, -4.8057397748012924, 3.9840541785107315,
+3.6744616388763158, 2.9984812206618741, 2.7986406905906982, 2.4138771780692565,
+2.1863126913266306, 2.1461689972239522, 1.7659818785902839, -1.6244210192935056,
+1.5813034543096383, 1.5197526556358836, 1.5156340039346252, -1.3178213396953622,
+-1.2642729744428549, 1.1918722470239156, 1.1346101526808809, 1.0857794666193619,
+-1.0193849686234684, -0.82271346711204119, 0.80422319498259232, 0.80259328179076062,
+-0.79318605789927754, -0.79101469779758038, -0.66740559064232208, 0.65022210506799993,
+-0.63881267522002194, 0.63370655522641894, 0.59577359277333797, -0.58892584055754305,
+0.47337712444026669, -0.42988724661750677, 0.41494120965053316, 0.38349820313915051,
+-0.3518270352520293, 0.33880517319488179, 0.32906188659450036, 0.31471426433659838,
+-0.31290656547454521, -0.30516790455922888, -0.30127706666588727, -0.29115281957063105,
+0.2686280229569365, 0.26324937564948425, 0.25407895854705809, -0.24483403135052215,
+-0.23700964723081611, 0.21375087241805898, 0.21258887871021664, -0.20592870889021603,
+-0.17190232488590301, 0.15790302720979735, 0.14641950859029759, -0.14452642033530635,
+0.13927887035756989, 0.13794955454887314, -0.13413879963718953, 0.13380968796906262,
+-0.13034698026749608, 0.12896452294148794, 0.12386475055329171, -0.11786728928883108,
+-0.11334073811726099, -0.11329072330774588, -0.11307487794267482, -0.10963942564411915,
+-0.10534137055687365, 0.10175550794372119, -0.09510222464961493, 0.094029427716808722,
+0.091569762124323661, 0.088144390922190563, 0.080959584932942391, 0.07912663455528067,
+-0.078459557420326301, -0.074786919081326286, 0.06914435931260178, -0.065608481844249736,
+-0.063829688275092694, -0.062827319414148, 0.062568376667657272, -0.062077332891355488,
+-0.061864935448889852, -0.061757456650472602, 0.059629731307917454, 0.058475244105182476,
+-0.057285297765117975, 0.056857521579167174, -0.055897481678740916, -0.055035502241402481,
+0.055017725765814714, -0.054566529979192147, 0.054287681534841654, 0.052507752197858637,
+-0.050967762761618879, -0.048519738913999334, 0.048339792756893894, 0.04216978932741134,
+-0.039409784606434066, 0.036739769051231712, 0.036465601407326201, -0.036359799427132987,
+-0.036109759112903358, 0.034648475777653051, 0.034617170207734006, 0.03435842663403383,
+-0.032259159198359554, -0.031418677688892428, 0.031179882291110614, -0.030379283750658456,
+0.030088708706239881, -0.02956872028388639, 0.028987600948148076, -0.028399989464081118,
+0.028279896584106023, -0.025718816050415413, -0.025488878537838398, 0.024959938842141479,
+-0.024188998798003365, 0.023798063029962558, -0.023649017971540856, 0.022848167931385607,
+0.021739906851392592, -0.021039063254930736, 0.020829083573661377, 0.020449524967629036,
+-0.020119107679315115, -0.018289177775851029, 0.018179250333859091, -0.018008547089206565,
+0.017679987133064217, -0.016919261055453692, 0.016799273649312576, -0.016688964500615681,
+0.016028070050732431, 0.015969314868028269, -0.015708742594635918, 0.014859351786676396,
+-0.014818809383686982, 0.014649925710091877, -0.01355940421512513, 0.013509395551609901,
+-0.013459382342560861, 0.013209414988021643, 0.012698962639543001, -0.012618987543121853,
+-0.012549954232758405, 0.012299015560126391, 0.012109509451245426, 0.011859977233838637,
+-0.011809747447104757, -0.01176927479776785, 0.01156927152644841, 0.011269991558434344,
+0.010909534950554581, -0.01048993143434228, 0.010418758910186602, 0.010339357793225199,
+0.010309540272323673, 0.010269979876276477, 0.010159566041243776, -0.010089734072084015,
+-0.0099497653021238548, 0.0098495971769231409, -0.0094394135023318591, 0.0093896050501042043,
+0.0093496124466727788, 0.0091389125170988836, -0.0091094310414750225, -0.0084496297942369576,
+-0.0077099699315942832, 0.0075696772356129696, -0.007029565234585507, 0.0070199742765625897,
+-0.0067999846918728362, 0.0067895801607384338, 0.0067694589867078247, 0.0066795855397655379,
+-0.0066398443980509566, -0.006579990676571802, 0.006539964306097862, 0.006519712119469701,
+-0.0064597424962362301, 0.0064498335701787153, 0.0063497652118967712, -0.0063198565599995541,
+-0.006169494473585369, 0.006139739803503799, 0.0059197436411913308, 0.0056599934003767026,
+-0.0055797634844608037, 0.0055495591796895088, -0.0055398639637834046, -0.0055299790841347772,
+-0.0055198609322139845, -0.005479781711253736, -0.0053699782162762669, -0.0053595708026320105,
+0.0053396594085087807, -0.0052795761828808054, -0.0051899743105119859, -0.0050499734481510806,
+-0.0050395988123064072, -0.0049597939443052881, 0.0046497117494105102, -0.0045099000240888141,
+0.0044899882111739719, -0.0043796470452171637, 0.0042598165057138463, 0.0042098260383021972,
+0.0041696612701546927, 0.0041598347238358526, 0.004149828641518913, -0.0038999104609056786,
+-0.0036899083041833048, -0.0035498557991327615, -0.0034998445207667546, -0.0034197903870718058,
+-0.0032898581500539273, 0.0032299908294199111, -0.0032199838926813629, 0.0031698643983152502,
+0.0030499877969977444, -0.0030398093938821757, -0.0028799326298548436, 0.0028798781817201045,
+-0.0028699904102523245, -0.0028397729159285873, 0.0028297729104309818, -0.0028198790578959562,
+-0.0027697791512921554, -0.0027498818300832782, 0.0027297235598305646, -0.002669838379709103,
+-0.0026098844315374683, 0.0025798928537680513, -0.0025598906793244235, 0.0025596936467878165,
+0.0025497961477641568, -0.0025399825952865909, -0.0024699925875418423, 0.0024699023890973584,
+-0.0024499882392914106, 0.0023997162914845449, -0.0023599026646941202, 0.0023399408968838914,
+0.0023199487041431271, 0.0022999986595968911, -0.0022398653712066728, -0.0022099022360995142,
+-0.0021597403998144661, 0.0021398181045017236, -0.0020398345010631458, 0.0020398305911668389,
+-0.0020299124939510251, -0.0019599163635315581, 0.0019199243366127027, 0.0019198839514968744,
+-0.0019198468192389441, -0.0019099278157129257, 0.0019099243408886182, 0.0019098803040788963,
+-0.0018997746625669376, 0.0018899912874621209, -0.0018599278163237709, 0.001859924345988945,
+-0.0017898575650762503, 0.0017798619072322333, 0.0017698869903964355, -0.0017499271194119585,
+-0.0016998594769067638, -0.0016898672825942668, 0.0016497996382285336, 0.0016199336249252678,
+0.001609803279538061, 0.0015599361233734454, 0.0015399099018474083, -0.0015299346691265293,
+-0.0015199372709062996, -0.0014599678360252657, -0.001459937272155993, -0.0014498890575159399,
+0.0014199674048280303, 0.0014099191883274389, -0.0013699435180911802, -0.0013699426512391035,
+0.0013698909623295812, 0.001349919189549129, 0.0013398410122280795, -0.0013098883620638472,
+0.0012999917304751059, -0.0012799665387880537, -0.0012699708743139821, -0.0012699409141743777,
+-0.0012399943360739652, -0.0012199960713621628, 0.0012199480248998478, 0.0011999995437903259,
+0.0011798134370148371, -0.0011599978060727498, -0.00115995193662869, -0.0011399082292208968,
+0.0011099965089247782, 0.0011099554077879273, -0.0010899795651033413, -0.0010898752780347763,
+-0.0010799973775009167, 0.0010799973774781439, 0.001069997378088989, 0.0010699743586699082,
+-0.00102989987408726, -0.0010199224541584263, -0.0010099189842856572, 0.00098999998313824061,
+0.00096995644718120776, 0.00095995818430194069, -0.0009299808736154666, 0.00092995905164761799,
+0.00092995905164761799, 0.00092000085108076134, -0.00089997913773042545, -0.0008999652942345436,
+0.0008899652930128535, 0.00087999564464732809, -0.00087996442568117803, 0.0008799323387725076,
+0.00086993320549333798, -0.00082994531693203878, -0.00082990025430721716, 0.00079996616339875432,
+0.00079995704602411595, 0.00079994922745319245, 0.00079990562844756054, 0.000779937714745386,
+0.00076990736494344668, 0.00075996616217706425, -0.00075994922685634902, -0.00074996958327446092,
+-0.00074995720402261552, 0.00072999824969657986, 0.0007199965125898487, -0.00071993685007588773,
+-0.00071992511833563529, 0.00069994569515667104, -0.00067998695752303909, 0.00066994700244710638,
+-0.00065998782607640466, 0.00065991724528161261, -0.00064996024719809196, 0.00063994700515128866,
+0.00062997371277205344, 0.0006299737121612084, -0.00062994700331875343, -0.00061996024841978216,
+0.00061990242892932779, -0.00060997284571518155, -0.00060996111636230262, 0.00059999868782280438,
+0.00059998435552801243, 0.00059997458132541887, -0.00059996111575145756, -0.00059995324848384599,
+0.00058992913925427488, -0.00057998082585166311, -0.0005699790908802742, -0.00055998695874472917,
+-0.00055995411491587086, -0.00055995238177701718, -0.00053997995974167773, -0.00052998169379418368,
+0.00052997822295175543, 0.00051997127017400842, -0.00051996953645231303, 0.00050997735624492668,
+0.00049997995790914253, -0.00048996122738463566, 0.00047999868904449446, -0.00046998300047377373,
+0.00046996035883126993, -0.00045998082707335319, -0.00045998044746424087, 0.0004599651378917874,
+-0.0004599508037644603, -0.00045000260174299551, 0.00045000086488829525, -0.00044999782208563475,
+-0.00044995704890154944, 0.00043998300267912474, -0.00043998300145743462, -0.00043998218212759187,
+-0.00043995704829070443, -0.00043000260175699723, 0.00042000260016249137, -0.00041999617365587344,
+0.00040998924599768038, -0.00040998826764367189, 0.0004000026007733364, -0.00039999011355338346,
+-0.00038996877899128904, 0.00037999217755398047, 0.00037998924500001784, 0.00037998435797139269,
+-0.00036999011294253835, -0.00036997968993320821, -0.00036997675900175494, 0.00036997675716921979,
+0.00036995629198136189, 0.00036000346932670203, -0.00035998142520740433, 0.00034998924602568381,
+0.00034000260077333641, 0.00033999011233169335, 0.00033995004867680797, -0.00033000173387048355,
+0.00032998055909741887, -0.0003299805578757288, 0.00032997675778006483, -0.00032996340322843638,
+-0.00031998751016864619, 0.00031997502250586882, -0.00030998751094751185, 0.00030997969098687768,
+0.00030996340322843639, -0.0003099625413943664, 0.00030995629259220693, -0.00029998924361030702,
+0.00029997675900175492, 0.000290001734663351, 0.00028999011416422848, -0.00028998837751432338,
+0.00028998751033666682, 0.00028996720332410031, 0.00027999011294253833, -0.000270002598800784,
+-0.00027000173389848703, 0.00026998924667853404, -0.00026998837875001521, 0.00025998913581021997,
+0.00025998826847854447, 0.0002499946221945864, -0.00024999217884567914, -0.00024998213558547849,
+-0.00024998213436378837, -0.00023999999865229439, 0.00023997502372755892, 0.0002399734472394993,
+0.00022999609071453831, 0.00022999375534774044, 0.00022999071290912468, -0.00021999462330426272,
+0.00021999462219458637, -0.00021998126812778748, 0.00020999608938083441, -0.00020999608888200313,
+-0.00020998984607628046, 0.00020998984557744918, -0.0002099898454654354, 0.00020997502433840398,
+0.00020000173466335101, 0.00019999999877830989, -0.00019999608938083441, -0.00019999462280543144,
+0.00019999071290912468, -0.0001999898454654354, -0.00019998837889003242, -0.00018999609000568121,
+0.00018999462280543144, 0.00017999462331826446, -0.00017999462331826446, -0.00017000086723366347,
+0.00016999609132538338, 0.00016999462331826446, 0.00016999375547375594, 0.00016998751208519166,
+0.00016998126764295791, -0.00016000086724766519, 0.00015999608940883787, 0.00015999608940883787,
+-0.00015998837950087749, -0.00015998751216920199, 0.00015998751208519166, -0.00015998751208519166,
+-0.00015998751208519166, 0.00015998360166205017, -0.00015000173466335099, -0.00015000086733167549,
+-0.00014999999999999999, -0.00014999999991598966, 0.00014999999991598966, -0.00014999999938915493,
+0.00014999999877830987, -0.00014000086733167549, -0.00014000086733167549, 0.00014000086733167549,
+0.00013999999999999999, -0.00013999999999999999, -0.00013999999992999137, -0.00013999999992999137,
+0.00013999999991598966, -0.00013999999938915493, -0.00013998751216920196, -0.00013998751208519163,
+-0.00013998751208519163, -0.00012999999931914631, -0.00012999608949284817, 0.00012998751216920196,
+0.00012998751216920196, -0.00012, 0.00012, -0.00012,
+0.00011999608949284817, 0.00011999375608460099, -0.00011999375601459239, 0.00011998751216920199,
+0.00011998751209919339, -0.00011000086727566862, -0.00011, 0.00011,
+-0.00011, -0.00010999999994399311, -0.00010999999994399311, 0.00010999999938915494,
+-0.00010999375608460099, 0.00010999375608460099, -0.00010998751216920199, 0.0001099875121131951,
+0.00010000521437441902, -0.0001, 0.0001, 0.0001,
+-0.0001, -0.0001, 0.0001, 0.0001,
+0.0001, 9.9999999943993116e-05, -9.9999999943993116e-05, 9.9993756084600991e-05,
+-9.9993756028594102e-05, -9.9993756028594102e-05, 9.9987512169201991e-05, 9.9987512169201991e-05,
+-9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, -8.9999999957994842e-05,
+-8.9999999943993117e-05, -8.9993756084600992e-05, -8.9993756084600992e-05, -8.9993756084600992e-05,
+-8.9993756084600992e-05, -8.9993756042595829e-05, -8.9987512169201992e-05, 8.0000867331675508e-05,
+8.0000000000000007e-05, -8.0000000000000007e-05, 8.0000000000000007e-05, -8.0000000000000007e-05,
+-7.9999999957994843e-05, 7.9999999957994843e-05, 7.9999999957994843e-05, -7.9999999957994843e-05,
+-7.9993756084600993e-05, 7.9993756084600993e-05, -7.9993756042595829e-05, 7.9987512169201993e-05,
+7.9987512169201993e-05, 7.9987512169201993e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05, -6.999999995799483e-05,
+-6.999999995799483e-05, 6.998751216920198e-05, 6.998751216920198e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, -6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 5.9999999971996557e-05, -5.9999999971996557e-05,
+-5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999957994838e-05, 5.9999999957994838e-05,
+-5.9999999361151503e-05, 5.9993756084600995e-05, -5.9993756084600995e-05, 5.9993756084600995e-05,
+5.9993756084600995e-05, 5.9993756084600995e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05,
+-4.9999999971996558e-05, 4.9999999971996558e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -3.9999999985998284e-05, -3.9999999985998284e-05,
+-3.9999999985998284e-05, 3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999971996559e-05,
+-3.9999999971996559e-05, 3.9999999971996559e-05, 3.9999999971996559e-05, 3.9999999971996559e-05,
+-3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+-3.9993756084600996e-05, 3.9993756084600996e-05, 3.9993756084600996e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, -2.9999999985998278e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0004509210042839e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.162109596585152e-08,
+};
+
+static const double ELP_ALIGNED c[] = {
+18461.238680000977, 1010.1670684572065, 999.69357574283754, 623.65242834342678,
+199.48374400255545, 166.57410217079999, 117.26068633236684, 61.911945225502166,
+33.357200171065656, 31.759668197533784, 29.576578747398852, 15.566264146094996,
+15.121553091067174, -12.094142301993864, 8.8681361287979623, 7.9585483545426978,
+7.4345495887323496, -6.7314313333408666, 6.5795744852210385, -6.4600674026070557,
+-6.2964758811173036, -5.6323496253612273, -5.3683956888492324, -5.3112745069456917,
+-5.075914192200714, -4.8396107976110407, -4.8057397748012924, 3.9840541785107315,
+3.6744616388763158, 2.9984812206618741, 2.7986406905906982, 2.4138771780692565,
+2.1863126913266306, 2.1461689972239522, 1.7659818785902839, -1.6244210192935056,
+1.5813034543096383, 1.5197526556358836, 1.5156340039346252, -1.3178213396953622,
+-1.2642729744428549, 1.1918722470239156, 1.1346101526808809, 1.0857794666193619,
+-1.0193849686234684, -0.82271346711204119, 0.80422319498259232, 0.80259328179076062,
+-0.79318605789927754, -0.79101469779758038, -0.66740559064232208, 0.65022210506799993,
+-0.63881267522002194, 0.63370655522641894, 0.59577359277333797, -0.58892584055754305,
+0.47337712444026669, -0.42988724661750677, 0.41494120965053316, 0.38349820313915051,
+-0.3518270352520293, 0.33880517319488179, 0.32906188659450036, 0.31471426433659838,
+-0.31290656547454521, -0.30516790455922888, -0.30127706666588727, -0.29115281957063105,
+0.2686280229569365, 0.26324937564948425, 0.25407895854705809, -0.24483403135052215,
+-0.23700964723081611, 0.21375087241805898, 0.21258887871021664, -0.20592870889021603,
+-0.17190232488590301, 0.15790302720979735, 0.14641950859029759, -0.14452642033530635,
+0.13927887035756989, 0.13794955454887314, -0.13413879963718953, 0.13380968796906262,
+-0.13034698026749608, 0.12896452294148794, 0.12386475055329171, -0.11786728928883108,
+-0.11334073811726099, -0.11329072330774588, -0.11307487794267482, -0.10963942564411915,
+-0.10534137055687365, 0.10175550794372119, -0.09510222464961493, 0.094029427716808722,
+0.091569762124323661, 0.088144390922190563, 0.080959584932942391, 0.07912663455528067,
+-0.078459557420326301, -0.074786919081326286, 0.06914435931260178, -0.065608481844249736,
+-0.063829688275092694, -0.062827319414148, 0.062568376667657272, -0.062077332891355488,
+-0.061864935448889852, -0.061757456650472602, 0.059629731307917454, 0.058475244105182476,
+-0.057285297765117975, 0.056857521579167174, -0.055897481678740916, -0.055035502241402481,
+0.055017725765814714, -0.054566529979192147, 0.054287681534841654, 0.052507752197858637,
+-0.050967762761618879, -0.048519738913999334, 0.048339792756893894, 0.04216978932741134,
+-0.039409784606434066, 0.036739769051231712, 0.036465601407326201, -0.036359799427132987,
+-0.036109759112903358, 0.034648475777653051, 0.034617170207734006, 0.03435842663403383,
+-0.032259159198359554, -0.031418677688892428, 0.031179882291110614, -0.030379283750658456,
+0.030088708706239881, -0.02956872028388639, 0.028987600948148076, -0.028399989464081118,
+0.028279896584106023, -0.025718816050415413, -0.025488878537838398, 0.024959938842141479,
+-0.024188998798003365, 0.023798063029962558, -0.023649017971540856, 0.022848167931385607,
+0.021739906851392592, -0.021039063254930736, 0.020829083573661377, 0.020449524967629036,
+-0.020119107679315115, -0.018289177775851029, 0.018179250333859091, -0.018008547089206565,
+0.017679987133064217, -0.016919261055453692, 0.016799273649312576, -0.016688964500615681,
+0.016028070050732431, 0.015969314868028269, -0.015708742594635918, 0.014859351786676396,
+-0.014818809383686982, 0.014649925710091877, -0.01355940421512513, 0.013509395551609901,
+-0.013459382342560861, 0.013209414988021643, 0.012698962639543001, -0.012618987543121853,
+-0.012549954232758405, 0.012299015560126391, 0.012109509451245426, 0.011859977233838637,
+-0.011809747447104757, -0.01176927479776785, 0.01156927152644841, 0.011269991558434344,
+0.010909534950554581, -0.01048993143434228, 0.010418758910186602, 0.010339357793225199,
+0.010309540272323673, 0.010269979876276477, 0.010159566041243776, -0.010089734072084015,
+-0.0099497653021238548, 0.0098495971769231409, -0.0094394135023318591, 0.0093896050501042043,
+0.0093496124466727788, 0.0091389125170988836, -0.0091094310414750225, -0.0084496297942369576,
+-0.0077099699315942832, 0.0075696772356129696, -0.007029565234585507, 0.0070199742765625897,
+-0.0067999846918728362, 0.0067895801607384338, 0.0067694589867078247, 0.0066795855397655379,
+-0.0066398443980509566, -0.006579990676571802, 0.006539964306097862, 0.006519712119469701,
+-0.0064597424962362301, 0.0064498335701787153, 0.0063497652118967712, -0.0063198565599995541,
+-0.006169494473585369, 0.006139739803503799, 0.0059197436411913308, 0.0056599934003767026,
+-0.0055797634844608037, 0.0055495591796895088, -0.0055398639637834046, -0.0055299790841347772,
+-0.0055198609322139845, -0.005479781711253736, -0.0053699782162762669, -0.0053595708026320105,
+0.0053396594085087807, -0.0052795761828808054, -0.0051899743105119859, -0.0050499734481510806,
+-0.0050395988123064072, -0.0049597939443052881, 0.0046497117494105102, -0.0045099000240888141,
+0.0044899882111739719, -0.0043796470452171637, 0.0042598165057138463, 0.0042098260383021972,
+0.0041696612701546927, 0.0041598347238358526, 0.004149828641518913, -0.0038999104609056786,
+-0.0036899083041833048, -0.0035498557991327615, -0.0034998445207667546, -0.0034197903870718058,
+-0.0032898581500539273, 0.0032299908294199111, -0.0032199838926813629, 0.0031698643983152502,
+0.0030499877969977444, -0.0030398093938821757, -0.0028799326298548436, 0.0028798781817201045,
+-0.0028699904102523245, -0.0028397729159285873, 0.0028297729104309818, -0.0028198790578959562,
+-0.0027697791512921554, -0.0027498818300832782, 0.0027297235598305646, -0.002669838379709103,
+-0.0026098844315374683, 0.0025798928537680513, -0.0025598906793244235, 0.0025596936467878165,
+0.0025497961477641568, -0.0025399825952865909, -0.0024699925875418423, 0.0024699023890973584,
+-0.0024499882392914106, 0.0023997162914845449, -0.0023599026646941202, 0.0023399408968838914,
+0.0023199487041431271, 0.0022999986595968911, -0.0022398653712066728, -0.0022099022360995142,
+-0.0021597403998144661, 0.0021398181045017236, -0.0020398345010631458, 0.0020398305911668389,
+-0.0020299124939510251, -0.0019599163635315581, 0.0019199243366127027, 0.0019198839514968744,
+-0.0019198468192389441, -0.0019099278157129257, 0.0019099243408886182, 0.0019098803040788963,
+-0.0018997746625669376, 0.0018899912874621209, -0.0018599278163237709, 0.001859924345988945,
+-0.0017898575650762503, 0.0017798619072322333, 0.0017698869903964355, -0.0017499271194119585,
+-0.0016998594769067638, -0.0016898672825942668, 0.0016497996382285336, 0.0016199336249252678,
+0.001609803279538061, 0.0015599361233734454, 0.0015399099018474083, -0.0015299346691265293,
+-0.0015199372709062996, -0.0014599678360252657, -0.001459937272155993, -0.0014498890575159399,
+0.0014199674048280303, 0.0014099191883274389, -0.0013699435180911802, -0.0013699426512391035,
+0.0013698909623295812, 0.001349919189549129, 0.0013398410122280795, -0.0013098883620638472,
+0.0012999917304751059, -0.0012799665387880537, -0.0012699708743139821, -0.0012699409141743777,
+-0.0012399943360739652, -0.0012199960713621628, 0.0012199480248998478, 0.0011999995437903259,
+0.0011798134370148371, -0.0011599978060727498, -0.00115995193662869, -0.0011399082292208968,
+0.0011099965089247782, 0.0011099554077879273, -0.0010899795651033413, -0.0010898752780347763,
+-0.0010799973775009167, 0.0010799973774781439, 0.001069997378088989, 0.0010699743586699082,
+-0.00102989987408726, -0.0010199224541584263, -0.0010099189842856572, 0.00098999998313824061,
+0.00096995644718120776, 0.00095995818430194069, -0.0009299808736154666, 0.00092995905164761799,
+0.00092995905164761799, 0.00092000085108076134, -0.00089997913773042545, -0.0008999652942345436,
+0.0008899652930128535, 0.00087999564464732809, -0.00087996442568117803, 0.0008799323387725076,
+0.00086993320549333798, -0.00082994531693203878, -0.00082990025430721716, 0.00079996616339875432,
+0.00079995704602411595, 0.00079994922745319245, 0.00079990562844756054, 0.000779937714745386,
+0.00076990736494344668, 0.00075996616217706425, -0.00075994922685634902, -0.00074996958327446092,
+-0.00074995720402261552, 0.00072999824969657986, 0.0007199965125898487, -0.00071993685007588773,
+-0.00071992511833563529, 0.00069994569515667104, -0.00067998695752303909, 0.00066994700244710638,
+-0.00065998782607640466, 0.00065991724528161261, -0.00064996024719809196, 0.00063994700515128866,
+0.00062997371277205344, 0.0006299737121612084, -0.00062994700331875343, -0.00061996024841978216,
+0.00061990242892932779, -0.00060997284571518155, -0.00060996111636230262, 0.00059999868782280438,
+0.00059998435552801243, 0.00059997458132541887, -0.00059996111575145756, -0.00059995324848384599,
+0.00058992913925427488, -0.00057998082585166311, -0.0005699790908802742, -0.00055998695874472917,
+-0.00055995411491587086, -0.00055995238177701718, -0.00053997995974167773, -0.00052998169379418368,
+0.00052997822295175543, 0.00051997127017400842, -0.00051996953645231303, 0.00050997735624492668,
+0.00049997995790914253, -0.00048996122738463566, 0.00047999868904449446, -0.00046998300047377373,
+0.00046996035883126993, -0.00045998082707335319, -0.00045998044746424087, 0.0004599651378917874,
+-0.0004599508037644603, -0.00045000260174299551, 0.00045000086488829525, -0.00044999782208563475,
+-0.00044995704890154944, 0.00043998300267912474, -0.00043998300145743462, -0.00043998218212759187,
+-0.00043995704829070443, -0.00043000260175699723, 0.00042000260016249137, -0.00041999617365587344,
+0.00040998924599768038, -0.00040998826764367189, 0.0004000026007733364, -0.00039999011355338346,
+-0.00038996877899128904, 0.00037999217755398047, 0.00037998924500001784, 0.00037998435797139269,
+-0.00036999011294253835, -0.00036997968993320821, -0.00036997675900175494, 0.00036997675716921979,
+0.00036995629198136189, 0.00036000346932670203, -0.00035998142520740433, 0.00034998924602568381,
+0.00034000260077333641, 0.00033999011233169335, 0.00033995004867680797, -0.00033000173387048355,
+0.00032998055909741887, -0.0003299805578757288, 0.00032997675778006483, -0.00032996340322843638,
+-0.00031998751016864619, 0.00031997502250586882, -0.00030998751094751185, 0.00030997969098687768,
+0.00030996340322843639, -0.0003099625413943664, 0.00030995629259220693, -0.00029998924361030702,
+0.00029997675900175492, 0.000290001734663351, 0.00028999011416422848, -0.00028998837751432338,
+0.00028998751033666682, 0.00028996720332410031, 0.00027999011294253833, -0.000270002598800784,
+-0.00027000173389848703, 0.00026998924667853404, -0.00026998837875001521, 0.00025998913581021997,
+0.00025998826847854447, 0.0002499946221945864, -0.00024999217884567914, -0.00024998213558547849,
+-0.00024998213436378837, -0.00023999999865229439, 0.00023997502372755892, 0.0002399734472394993,
+0.00022999609071453831, 0.00022999375534774044, 0.00022999071290912468, -0.00021999462330426272,
+0.00021999462219458637, -0.00021998126812778748, 0.00020999608938083441, -0.00020999608888200313,
+-0.00020998984607628046, 0.00020998984557744918, -0.0002099898454654354, 0.00020997502433840398,
+0.00020000173466335101, 0.00019999999877830989, -0.00019999608938083441, -0.00019999462280543144,
+0.00019999071290912468, -0.0001999898454654354, -0.00019998837889003242, -0.00018999609000568121,
+0.00018999462280543144, 0.00017999462331826446, -0.00017999462331826446, -0.00017000086723366347,
+0.00016999609132538338, 0.00016999462331826446, 0.00016999375547375594, 0.00016998751208519166,
+0.00016998126764295791, -0.00016000086724766519, 0.00015999608940883787, 0.00015999608940883787,
+-0.00015998837950087749, -0.00015998751216920199, 0.00015998751208519166, -0.00015998751208519166,
+-0.00015998751208519166, 0.00015998360166205017, -0.00015000173466335099, -0.00015000086733167549,
+-0.00014999999999999999, -0.00014999999991598966, 0.00014999999991598966, -0.00014999999938915493,
+0.00014999999877830987, -0.00014000086733167549, -0.00014000086733167549, 0.00014000086733167549,
+0.00013999999999999999, -0.00013999999999999999, -0.00013999999992999137, -0.00013999999992999137,
+0.00013999999991598966, -0.00013999999938915493, -0.00013998751216920196, -0.00013998751208519163,
+-0.00013998751208519163, -0.00012999999931914631, -0.00012999608949284817, 0.00012998751216920196,
+0.00012998751216920196, -0.00012, 0.00012, -0.00012,
+0.00011999608949284817, 0.00011999375608460099, -0.00011999375601459239, 0.00011998751216920199,
+0.00011998751209919339, -0.00011000086727566862, -0.00011, 0.00011,
+-0.00011, -0.00010999999994399311, -0.00010999999994399311, 0.00010999999938915494,
+-0.00010999375608460099, 0.00010999375608460099, -0.00010998751216920199, 0.0001099875121131951,
+0.00010000521437441902, -0.0001, 0.0001, 0.0001,
+-0.0001, -0.0001, 0.0001, 0.0001,
+0.0001, 9.9999999943993116e-05, -9.9999999943993116e-05, 9.9993756084600991e-05,
+-9.9993756028594102e-05, -9.9993756028594102e-05, 9.9987512169201991e-05, 9.9987512169201991e-05,
+-9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, -8.9999999957994842e-05,
+-8.9999999943993117e-05, -8.9993756084600992e-05, -8.9993756084600992e-05, -8.9993756084600992e-05,
+-8.9993756084600992e-05, -8.9993756042595829e-05, -8.9987512169201992e-05, 8.0000867331675508e-05,
+8.0000000000000007e-05, -8.0000000000000007e-05, 8.0000000000000007e-05, -8.0000000000000007e-05,
+-7.9999999957994843e-05, 7.9999999957994843e-05, 7.9999999957994843e-05, -7.9999999957994843e-05,
+-7.9993756084600993e-05, 7.9993756084600993e-05, -7.9993756042595829e-05, 7.9987512169201993e-05,
+7.9987512169201993e-05, 7.9987512169201993e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05, -6.999999995799483e-05,
+-6.999999995799483e-05, 6.998751216920198e-05, 6.998751216920198e-05, -6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, -6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 5.9999999971996557e-05, -5.9999999971996557e-05,
+-5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999957994838e-05, 5.9999999957994838e-05,
+-5.9999999361151503e-05, 5.9993756084600995e-05, -5.9993756084600995e-05, 5.9993756084600995e-05,
+5.9993756084600995e-05, 5.9993756084600995e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05, -4.9999999971996558e-05,
+-4.9999999971996558e-05, 4.9999999971996558e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -3.9999999985998284e-05, -3.9999999985998284e-05,
+-3.9999999985998284e-05, 3.9999999985998284e-05, -3.9999999985998284e-05, -3.9999999971996559e-05,
+-3.9999999971996559e-05, 3.9999999971996559e-05, 3.9999999971996559e-05, 3.9999999971996559e-05,
+-3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05, -3.9999999971996559e-05,
+-3.9993756084600996e-05, 3.9993756084600996e-05, 3.9993756084600996e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, 2.9999999985998278e-05,
+-2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, 2.9999999985998278e-05, -2.9999999985998278e-05, -2.9999999985998278e-05,
+-2.9999999985998278e-05, -2.9999999985998278e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0004509210042839e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.162109596585152e-08,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0,
+};
+
+const struct elp_table elp2 = {
+    arg, max_arg, amp, c, s, 918
 };
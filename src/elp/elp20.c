@@ -1,191 +1,199 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp20[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000}, 0.000000, 0.000070, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000080, 5.997000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000}, 0.000000, 0.000080, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000}, 0.000000, 0.000050, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000}, 0.000000, 0.000030, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -4.000000, -1.000000}, 0.000000, 0.000020, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, -1.000000}, 0.000000, 0.000190, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 1.000000}, 0.000000, 0.000060, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, -1.000000}, 0.000000, 0.002000, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 1.000000}, 0.000000, 0.000760, 0.083000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -3.000000}, 180.000000, 0.000020, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000}, 0.000000, 0.016960, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.014190, 0.857000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 3.000000}, 0.000000, 0.000020, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.012150, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000}, 0.000000, 0.016230, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 3.000000}, 180.000000, 0.000030, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -3.000000}, 0.000000, 0.000020, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000}, 0.000000, 0.012790, 1.200000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000}, 0.000000, 0.013380, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 3.000000}, 180.000000, 0.000020, 0.018000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -1.000000}, 0.000000, 0.000790, 0.071000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 1.000000}, 0.000000, 0.001610, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 3.000000, -1.000000}, 0.000000, 0.000060, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 3.000000, 1.000000}, 0.000000, 0.000160, 0.018000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 4.000000, 1.000000}, 0.000000, 0.000010, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000}, 0.000000, 0.000080, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000}, 0.000000, 0.000030, 0.090000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000}, 0.000000, 0.000570, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000}, 0.000000, 0.000480, 0.462000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000}, 0.000000, 0.000090, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000}, 0.000000, 0.000290, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000}, 0.000000, 0.000310, 0.545000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000}, 0.000000, 0.000280, 0.035000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000}, 0.000000, 0.000010, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 1.000000}, 0.000000, 0.000030, 0.024000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000}, 0.000000, 0.000020, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000}, 0.000000, 0.000010, 0.316000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000, -1.000000}, 180.000000, 0.000010, 0.327000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 1.000000}, 180.000000, 0.000010, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, -1.000000}, 180.000000, 0.000030, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -1.000000}, 0.000000, 0.000030, 0.487000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 1.000000}, 0.000000, 0.000050, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, -1.000000}, 0.000000, 0.000050, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 1.000000}, 0.000000, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, -1.000000}, 180.000000, 0.000040, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 1.000000}, 180.000000, 0.000040, 3.575000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000020, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.000140, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, -1.000000}, 180.000000, 0.002020, 18.600000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 1.000000}, 180.000000, 0.002020, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, -1.000000}, 180.000000, 0.000090, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 1.000000}, 180.000000, 0.000260, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, 1.000000}, 180.000000, 0.000030, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 1.000000}, 0.000000, 0.000010, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, 0.000000, -1.000000}, 180.000000, 0.000010, 0.137000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -1.000000, -1.000000}, 180.000000, 0.000070, 0.202000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -1.000000, 1.000000}, 180.000000, 0.000080, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000, -1.000000}, 180.000000, 0.000280, 0.120000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 1.000000}, 180.000000, 0.000120, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 1.000000, -1.000000}, 180.000000, 0.000020, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 1.000000, 1.000000}, 180.000000, 0.000020, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -2.000000, -1.000000}, 180.000000, 0.000110, 0.058000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, -1.000000}, 180.000000, 0.001350, 0.254000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, 1.000000}, 180.000000, 0.001580, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, -3.000000}, 180.000000, 0.000010, 0.057000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, -1.000000}, 180.000000, 0.005460, 0.107000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 1.000000}, 180.000000, 0.001930, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, -1.000000}, 180.000000, 0.000350, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, 1.000000}, 180.000000, 0.000290, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 2.000000, -1.000000}, 180.000000, 0.000030, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 2.000000, 1.000000}, 180.000000, 0.000030, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -4.000000, -1.000000}, 180.000000, 0.000010, 0.023000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -3.000000, -1.000000}, 180.000000, 0.000140, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -3.000000, 1.000000}, 180.000000, 0.000020, 0.384000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, -1.000000}, 180.000000, 0.001640, 0.062000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, 1.000000}, 0.000000, 0.000160, 0.094000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, -3.000000}, 180.000000, 0.000030, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, -1.000000}, 180.000000, 0.018690, 0.340000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 1.000000}, 180.000000, 0.022290, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 3.000000}, 0.000000, 0.000030, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, -3.000000}, 180.000000, 0.000220, 0.060000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, -1.000000}, 180.000000, 0.074300, 0.097000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 1.000000}, 180.000000, 0.019990, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 3.000000}, 0.000000, 0.000020, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, -3.000000}, 0.000000, 0.000040, 0.305000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, -1.000000}, 180.000000, 0.004430, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, 1.000000}, 180.000000, 0.002850, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, -1.000000}, 180.000000, 0.000320, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, 1.000000}, 180.000000, 0.000310, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 3.000000, -1.000000}, 180.000000, 0.000020, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 3.000000, 1.000000}, 180.000000, 0.000030, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.000260, 0.515000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 1.000000}, 0.000000, 0.000370, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -3.000000}, 0.000000, 0.000010, 0.064000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.002950, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 1.000000}, 0.000000, 0.000530, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000220, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 1.000000}, 0.000000, 0.000100, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 2.000000, -1.000000}, 0.000000, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 2.000000, 1.000000}, 0.000000, 0.000010, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -3.000000, -1.000000}, 180.000000, 0.000050, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, -1.000000}, 180.000000, 0.000200, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, 1.000000}, 180.000000, 0.000140, 0.079000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, -1.000000}, 0.000000, 0.001980, 1.063000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.003300, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -3.000000}, 0.000000, 0.000140, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.030430, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 1.000000}, 0.000000, 0.003180, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, -3.000000}, 180.000000, 0.000010, 0.785000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, -1.000000}, 0.000000, 0.002070, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, 1.000000}, 0.000000, 0.000600, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000, -1.000000}, 0.000000, 0.000160, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000, 1.000000}, 0.000000, 0.000080, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 3.000000, -1.000000}, 0.000000, 0.000010, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -2.000000, -1.000000}, 0.000000, 0.000060, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -2.000000, 1.000000}, 0.000000, 0.000030, 0.073000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, -1.000000}, 0.000000, 0.000530, 16.885000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 1.000000}, 0.000000, 0.000570, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, -1.000000}, 0.000000, 0.000680, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 1.000000}, 0.000000, 0.000070, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 1.000000, -1.000000}, 0.000000, 0.000030, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, -1.000000}, 0.000000, 0.000050, 0.106000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, 1.000000}, 0.000000, 0.000030, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -1.000000}, 0.000000, 0.000060, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000030, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 1.000000}, 180.000000, 0.000050, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, -1.000000}, 180.000000, 0.000090, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 1.000000}, 180.000000, 0.000030, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 1.000000, -1.000000}, 180.000000, 0.000010, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -1.000000, -1.000000}, 180.000000, 0.000010, 0.051000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -1.000000, 1.000000}, 180.000000, 0.000010, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 0.000000, -1.000000}, 180.000000, 0.000010, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -2.000000, -1.000000}, 180.000000, 0.000010, 0.133000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -2.000000, 1.000000}, 180.000000, 0.000060, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -1.000000, -1.000000}, 180.000000, 0.000170, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -1.000000, 1.000000}, 180.000000, 0.000120, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000, -1.000000}, 180.000000, 0.000150, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 1.000000}, 180.000000, 0.000060, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 1.000000, -1.000000}, 180.000000, 0.000020, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 1.000000, 1.000000}, 180.000000, 0.000010, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -2.000000, -1.000000}, 180.000000, 0.000130, 0.117000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -2.000000, 1.000000}, 180.000000, 0.000540, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, -1.000000}, 180.000000, 0.001490, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, 1.000000}, 180.000000, 0.000850, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, -3.000000}, 180.000000, 0.000010, 0.122000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, -1.000000}, 180.000000, 0.001040, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, 1.000000}, 180.000000, 0.000400, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 1.000000, -1.000000}, 180.000000, 0.000140, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 1.000000, 1.000000}, 180.000000, 0.000080, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 2.000000, -1.000000}, 180.000000, 0.000020, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 2.000000, 1.000000}, 180.000000, 0.000010, 0.011000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -2.000000, 1.000000}, 0.000000, 0.000010, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.000080, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 1.000000}, 0.000000, 0.000030, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.000070, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 1.000000}, 0.000000, 0.000020, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000010, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -2.000000, 1.000000}, 0.000000, 0.000070, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, -1.000000}, 0.000000, 0.000430, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.000130, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.000280, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 1.000000}, 0.000000, 0.000060, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 1.000000, -1.000000}, 0.000000, 0.000040, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 1.000000, 1.000000}, 0.000000, 0.000010, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -2.000000, 1.000000}, 0.000000, 0.000010, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -1.000000, -1.000000}, 0.000000, 0.000020, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -3.000000, 1.000000}, 180.000000, 0.000010, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -2.000000, -1.000000}, 180.000000, 0.000030, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -2.000000, 1.000000}, 180.000000, 0.000020, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -1.000000, -1.000000}, 180.000000, 0.000040, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -1.000000, 1.000000}, 180.000000, 0.000020, 0.014000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, 0.000000, -1.000000}, 180.000000, 0.000020, 0.017000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, -1.000000, 0.000000}, 194.813110, 0.000020, 0.041000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, 0.000000}, 194.813110, 0.000410, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, 0.000000}, 194.813110, 0.000100, 0.530000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 1.000000, 0.000000, 0.000000}, 194.813110, 0.000020, 0.096000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000}, 194.813110, 0.000020, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -2.000000}, 194.813110, 0.000030, 0.037000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 194.813110, 0.000660, 8.850000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, -2.000000}, 194.813110, 0.000080, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 14.813110, 0.011720, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 2.000000}, 194.813110, 0.000010, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -2.000000}, 194.813110, 0.000020, 4.535000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000}, 14.813110, 0.000620, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, 0.000000}, 14.813110, 0.000040, 0.025000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 0.000000}, 14.813110, 0.000130, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000}, 14.813110, 0.000070, 0.026000},
+
+static const uint16_t arg[] = {
+65, 154, 187, 202, 210, 222, 227, 247, 258, 267,
+274, 2, 479, 560, 686, 699, 696, 744, 920, 931,
+932, 940, 953, 968, 1067, 1082, 1097, 1133, 1192, 1366,
+1523, 1597, 1648, 1756, 63, 66, 1903, 1947, 1946, 2020,
+1570, 2049, 2170, 2318, 101, 2405, 1077, 2633, 2770, 2820,
+2821, 2943, 2944, 3010, 3011, 3012, 3141, 1154, 3469, 3464,
+3669, 3783, 4043, 4188, 4189, 4190, 4327, 4478, 4480, 4481,
+4482, 4483, 4666, 4667, 232, 4886, 4887, 5116, 5309, 276,
+5751, 5752, 5753, 2370, 2394, 6209, 6210, 6211, 6212, 6075,
+322, 1750, 6767, 6768, 6729, 6769, 354, 7483, 7484, 7485,
+7486, 7487, 7488, 7489, 8384, 8437, 8443, 8444, 8445, 8446,
+9858, 9859, 9860, 9861, 9862, 577, 7246, 12414, 12415, 12416,
+12417, 12401, 12418, 12419, 12420, 12421, 12422, 12423, 12424, 12425,
+12426, 12427, 12428, 9388, 12429, 693, 16744, 16745, 16746, 16747,
+16748, 16749, 16750, 16751, 16752, 16753, 16754, 16755, 16756, 16757,
+16758, 16759, 16149, 16760, 16761, 16762, 16763, 784, 867, 736,
+952, 21451, 21452, 21453, 21454, 21455, 21456, 21457, 21458, 21459,
+21460, 21461, 21462, 21463, 21464, 21465, 21466, 21467, 21468, 21469,
+21470, 21471, 11565, 21472, 21473, 21474, 21475, 1162,
+};
+
+static const uint16_t max_arg[] = {
+65, 154, 187, 202, 210, 222, 227, 247, 258, 267,
+274, 274, 479, 560, 686, 699, 699, 744, 920, 931,
+932, 940, 953, 968, 1067, 1082, 1097, 1133, 1192, 1366,
+1523, 1597, 1648, 1756, 1756, 1756, 1903, 1947, 1947, 2020,
+2020, 2049, 2170, 2318, 2318, 2405, 2405, 2633, 2770, 2820,
+2821, 2943, 2944, 3010, 3011, 3012, 3141, 3141, 3469, 3469,
+3669, 3783, 4043, 4188, 4189, 4190, 4327, 4478, 4480, 4481,
+4482, 4483, 4666, 4667, 4667, 4886, 4887, 5116, 5309, 5309,
+5751, 5752, 5753, 5753, 5753, 6209, 6210, 6211, 6212, 6212,
+6212, 6212, 6767, 6768, 6768, 6769, 6769, 7483, 7484, 7485,
+7486, 7487, 7488, 7489, 8384, 8437, 8443, 8444, 8445, 8446,
+9858, 9859, 9860, 9861, 9862, 9862, 9862, 12414, 12415, 12416,
+12417, 12417, 12418, 12419, 12420, 12421, 12422, 12423, 12424, 12425,
+12426, 12427, 12428, 12428, 12429, 12429, 16744, 16745, 16746, 16747,
+16748, 16749, 16750, 16751, 16752, 16753, 16754, 16755, 16756, 16757,
+16758, 16759, 16759, 16760, 16761, 16762, 16763, 16763, 16763, 16763,
+16763, 21451, 21452, 21453, 21454, 21455, 21456, 21457, 21458, 21459,
+21460, 21461, 21462, 21463, 21464, 21465, 21466, 21467, 21468, 21469,
+21470, 21471, 21471, 21472, 21473, 21474, 21475, 21475,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.074300000000000005, 0.030429999999999999, 0.022290000000000001, 0.019990000000000001,
+0.018689999999999998, 0.016959999999999999, 0.016230000000000001, 0.014189999999999999,
+0.01338, 0.012789999999999999, 0.012149999999999999, 0.01172,
+0.0054599999999999996, 0.0044299999999999999, 0.0033, 0.0031800000000000001,
+0.0029499999999999999, 0.0028500000000000001, 0.0020699999999999998, 0.0020200000000000001,
+0.0020200000000000001, 0.002, 0.00198, 0.0019300000000000001,
+0.00164, 0.0016100000000000001, 0.00158, 0.00149,
+0.0013500000000000001, 0.0010399999999999999, 0.00084999999999999995, 0.00079000000000000001,
+0.00076000000000000004, 0.00068000000000000005, 0.00066, 0.00062,
+0.00059999999999999995, 0.00056999999999999998, 0.00056999999999999998, 0.00054000000000000001,
+0.00052999999999999998, 0.00052999999999999998, 0.00048000000000000001, 0.00042999999999999999,
+0.00040999999999999999, 0.00040000000000000002, 0.00036999999999999999, 0.00035,
+0.00032000000000000003, 0.00031, 0.00031, 0.00029,
+0.00029, 0.00027999999999999998, 0.00027999999999999998, 0.00027999999999999998,
+0.00025999999999999998, 0.00025999999999999998, 0.00022000000000000001, 0.00022000000000000001,
+0.00020000000000000001, 0.00019000000000000001, 0.00017000000000000001, 0.00016000000000000001,
+0.00016000000000000001, 0.00016000000000000001, 0.00014999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012,
+0.00012, 0.00011, 0.0001, 0.0001,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.074300000000000005, 0.030429999999999999, -0.022290000000000001, -0.019990000000000001,
+-0.018689999999999998, 0.016959999999999999, 0.016230000000000001, 0.014189999999999999,
+0.01338, 0.012789999999999999, 0.012149999999999999, 0.011330484792914656,
+-0.0054599999999999996, -0.0044299999999999999, 0.0033, 0.0031800000000000001,
+0.0029499999999999999, -0.0028500000000000001, 0.0020699999999999998, -0.0020200000000000001,
+-0.0020200000000000001, 0.002, 0.00198, -0.0019300000000000001,
+-0.00164, 0.0016100000000000001, -0.00158, -0.00149,
+-0.0013500000000000001, -0.0010399999999999999, -0.00084999999999999995, 0.00079000000000000001,
+0.00076000000000000004, 0.00068000000000000005, -0.00063806484328700276, 0.00059939424672415418,
+0.00059999999999999995, 0.00056999999999999998, 0.00056999999999999998, -0.00054000000000000001,
+0.00052999999999999998, 0.00052999999999999998, 0.00048000000000000001, 0.00042999999999999999,
+-0.0003963736147691987, -0.00040000000000000002, 0.00036999999999999999, -0.00035,
+-0.00032000000000000003, 0.00031, -0.00031, 0.00029,
+-0.00029, 0.00027999999999999998, -0.00027999999999999998, 0.00027999999999999998,
+-0.00025999999999999998, 0.00025999999999999998, -0.00022000000000000001, 0.00022000000000000001,
+-0.00020000000000000001, 0.00019000000000000001, -0.00017000000000000001, 0.00016000000000000001,
+0.00016000000000000001, 0.00016000000000000001, -0.00014999999999999999, 0.00013999999999999999,
+-0.00013999999999999999, -0.00013999999999999999, 0.00013999999999999999, -0.00013999999999999999,
+-0.00012999999999999999, 0.00012999999999999999, 0.0001256794388292581, -0.00012,
+-0.00012, -0.00011, 0.0001, -9.667649140712164e-05,
+9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, -8.0000000000000007e-05, 8.0000000000000007e-05,
+-8.0000000000000007e-05, 8.0000000000000007e-05, -7.7341193125697309e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.7673543984985137e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05,
+5.0000000000000002e-05, -5.0000000000000002e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, 3.8670596562848655e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -2.9002947422136493e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -1.9335298281424327e-05, -1.9335298281424327e-05, -1.9335298281424327e-05,
+-1.9335298281424327e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -9.6676491407121636e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+9.0991257176648354e-18, 0, 2.7297377152994504e-18, 2.4480689514955593e-18,
+2.2888648676064029e-18, 0, 0, 0,
+0, 0, 0, 0.0029964169198443877,
+6.6865715233445483e-19, 5.4251853202227745e-19, 0, 0,
+0, 3.4902433775699567e-19, 0, 2.4737865342776537e-19,
+2.4737865342776537e-19, 0, 0, 2.363568322354392e-19,
+2.0084207506016593e-19, 0, 1.934941942652818e-19, 1.8247237307295564e-19,
+1.6532731788489269e-19, 1.2736326711132473e-19, 1.0409497792752502e-19, 0,
+0, 0, -0.00016874020197075901, 0.00015851352306344029,
+0, 0, 0, 6.613092715395708e-20,
+0, 0, 0, 0,
+-0.00010482345880001695, 4.8985871965894131e-20, 0, 4.2862637970157361e-20,
+3.9188697572715303e-20, 0, 3.7964050773567951e-20, 0,
+3.5514757175273245e-20, 0, 3.4290110376125887e-20, 0,
+3.1840816777831181e-20, 0, 2.6942229581241771e-20, 0,
+2.4492935982947065e-20, 0, 2.0818995585505007e-20, 0,
+0, 0, 1.8369701987210296e-20, 0,
+1.7145055188062943e-20, 1.7145055188062943e-20, 0, 1.7145055188062943e-20,
+1.5920408388915591e-20, 0, 3.3236706448785868e-05, 1.4695761589768238e-20,
+1.4695761589768238e-20, 1.3471114790620885e-20, 0, -2.5566697268296817e-05,
+0, 1.102182119232618e-20, 1.102182119232618e-20, 0,
+0, 0, 9.7971743931788258e-21, 0,
+9.7971743931788258e-21, 0, -2.0453357814637456e-05, 0,
+8.5725275940314716e-21, 0, 0, 0,
+1.7896688087807774e-05, 0, 0, 0,
+0, 7.347880794884119e-21, 7.347880794884119e-21, 0,
+0, 0, 0, 6.1232339957367663e-21,
+0, 6.1232339957367663e-21, 4.8985871965894129e-21, 4.8985871965894129e-21,
+0, 0, 4.8985871965894129e-21, 1.022667890731873e-05,
+0, 3.6739403974420595e-21, 0, 0,
+3.6739403974420595e-21, 0, 3.6739403974420595e-21, 3.6739403974420595e-21,
+3.6739403974420595e-21, 3.6739403974420595e-21, 0, 3.6739403974420595e-21,
+0, 0, 0, 3.6739403974420595e-21,
+3.6739403974420595e-21, 0, 3.6739403974420595e-21, -7.6700091804890456e-06,
+0, 2.4492935982947065e-21, 0, 0,
+2.4492935982947065e-21, 0, 0, 2.4492935982947065e-21,
+2.4492935982947065e-21, 2.4492935982947065e-21, 2.4492935982947065e-21, 0,
+2.4492935982947065e-21, 0, 2.4492935982947065e-21, 2.4492935982947065e-21,
+0, 0, 2.4492935982947065e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, -5.113339453659364e-06, -5.113339453659364e-06, -5.113339453659364e-06,
+-5.113339453659364e-06, 0, 0, 0,
+1.2246467991473532e-21, 1.2246467991473532e-21, 0, 1.2246467991473532e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, 0, 0,
+1.2246467991473532e-21, 0, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, 0, 0,
+0, 0, 1.2246467991473532e-21, -2.556669726829682e-06,
+};
+
+const struct elp_table elp20 = {
+    arg, max_arg, amp, c, s, 188
 };
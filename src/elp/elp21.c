@@ -1,172 +1,183 @@
 #include "lunar-priv.h"
-const struct planet_pert  elp21[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.001490, 99999.999000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000}, 90.000000, 0.000100, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000}, 270.000000, 0.001740, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000}, 270.000000, 0.000290, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000}, 270.000000, 0.000030, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -4.000000, 0.000000}, 90.000000, 0.000070, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -3.000000, 0.000000}, 90.000000, 0.001060, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000}, 90.000000, 0.017640, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 2.000000}, 90.000000, 0.000130, 0.750000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -2.000000}, 90.000000, 0.000020, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000}, 90.000000, 0.326540, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000}, 270.000000, 0.000840, 0.069000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000}, 90.000000, 0.000470, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000}, 270.000000, 0.123020, 1.000000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000}, 90.000000, 0.000400, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000}, 90.000000, 0.000620, 0.079000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000}, 270.000000, 0.263960, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -2.000000}, 270.000000, 0.000080, 1.500000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000}, 270.000000, 0.014490, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 3.000000, 0.000000}, 270.000000, 0.000890, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 4.000000, 0.000000}, 270.000000, 0.000060, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000}, 90.000000, 0.000050, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000}, 90.000000, 0.000690, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000}, 90.000000, 0.010660, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000}, 270.000000, 0.000020, 0.064000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000}, 90.000000, 0.000030, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000}, 270.000000, 0.005360, 0.500000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000}, 270.000000, 0.005870, 0.066000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000}, 270.000000, 0.000260, 0.035000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000}, 90.000000, 0.000020, 0.043000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000}, 90.000000, 0.000290, 0.098000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000}, 270.000000, 0.000160, 0.333000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000}, 270.000000, 0.000140, 0.062000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, -1.000000, 0.000000}, 270.000000, 0.000040, 0.346000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -2.000000, 0.000000, 0.000000}, 90.000000, 0.000150, 0.096000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, -1.000000, 0.000000}, 270.000000, 0.000290, 0.530000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, -2.000000}, 90.000000, 0.000030, 0.065000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 0.000000, 0.000000}, 270.000000, 0.001260, 0.088000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 1.000000, 0.000000}, 270.000000, 0.000280, 0.041000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, -1.000000, 2.000000, 0.000000}, 270.000000, 0.000030, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, 0.000000}, 90.000000, 0.000020, 0.071000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000040, 1.127000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000080, 0.081000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, 0.000000}, 90.000000, 0.000020, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -3.000000, 0.000000}, 270.000000, 0.000040, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000840, 0.076000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.002140, 8.850000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, -2.000000}, 270.000000, 0.000080, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.041940, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 1.000000, 0.000000}, 90.000000, 0.002350, 0.038000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 1.000000, 2.000000, 0.000000}, 90.000000, 0.000150, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, -1.000000, 0.000000}, 270.000000, 0.000020, 0.898000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 0.000000, 0.000000}, 270.000000, 0.000190, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 2.000000, 1.000000, 0.000000}, 270.000000, 0.000030, 0.036000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, -1.000000, 0.000000}, 90.000000, 0.000040, 0.134000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -4.000000, 0.000000, 0.000000}, 90.000000, 0.000160, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -2.000000, 0.000000}, 270.000000, 0.000080, 0.209000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, -1.000000, 0.000000}, 90.000000, 0.001120, 0.118000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 0.000000, 0.000000}, 90.000000, 0.003100, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -3.000000, 1.000000, 0.000000}, 90.000000, 0.000220, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -3.000000, 0.000000}, 270.000000, 0.000080, 0.059000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -2.000000, 0.000000}, 270.000000, 0.001730, 0.265000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, -2.000000}, 270.000000, 0.000050, 0.058000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, -1.000000, 0.000000}, 90.000000, 0.024900, 0.105000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, -2.000000}, 270.000000, 0.000140, 0.243000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 0.000000, 0.000000}, 90.000000, 0.049700, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, -2.000000}, 270.000000, 0.000040, 0.109000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 1.000000, 0.000000}, 90.000000, 0.003310, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -2.000000, 2.000000, 0.000000}, 90.000000, 0.000230, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -4.000000, 0.000000}, 270.000000, 0.000060, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -3.000000, 0.000000}, 270.000000, 0.001250, 0.062000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, -2.000000}, 270.000000, 0.000040, 0.034000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, 0.000000}, 270.000000, 0.025290, 0.360000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -2.000000, 2.000000}, 270.000000, 0.000080, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, -2.000000}, 270.000000, 0.000810, 0.061000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 0.000000}, 90.000000, 0.382450, 0.095000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, -1.000000, 2.000000}, 270.000000, 0.000090, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, -2.000000}, 270.000000, 0.001650, 0.322000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.513950, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, -2.000000}, 270.000000, 0.000530, 0.099000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 1.000000, 0.000000}, 90.000000, 0.032220, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, -2.000000}, 270.000000, 0.000050, 0.043000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 2.000000, 0.000000}, 90.000000, 0.002130, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, -1.000000, 3.000000, 0.000000}, 90.000000, 0.000150, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -3.000000, 0.000000}, 270.000000, 0.000020, 0.067000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -2.000000, 0.000000}, 90.000000, 0.000040, 0.564000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.006330, 0.087000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, -2.000000}, 90.000000, 0.000050, 0.474000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.013560, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, -2.000000}, 90.000000, 0.000030, 0.090000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 1.000000, 0.000000}, 270.000000, 0.001140, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 2.000000, 0.000000}, 270.000000, 0.000090, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -4.000000, 0.000000}, 270.000000, 0.000040, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -3.000000, 0.000000}, 270.000000, 0.000430, 0.071000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000390, 1.292000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, -2.000000}, 90.000000, 0.000120, 0.070000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.060680, 0.080000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, -2.000000}, 90.000000, 0.000340, 0.903000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 0.000000, 0.000000}, 270.000000, 0.077540, 0.039000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, -2.000000}, 90.000000, 0.000140, 0.082000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 1.000000, 0.000000}, 270.000000, 0.006580, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 2.000000, 0.000000}, 270.000000, 0.000530, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 1.000000, 3.000000, 0.000000}, 270.000000, 0.000040, 0.015000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -3.000000, 0.000000}, 90.000000, 0.000050, 0.077000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -2.000000, 0.000000}, 90.000000, 0.000550, 4.425000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, -2.000000}, 90.000000, 0.000050, 0.075000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, -1.000000, 0.000000}, 270.000000, 0.011860, 0.074000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 0.000000, 0.000000}, 270.000000, 0.000740, 0.037000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 2.000000, 1.000000, 0.000000}, 270.000000, 0.000050, 0.025000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, -1.000000, 0.000000}, 270.000000, 0.000070, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -2.000000, 0.000000, 0.000000}, 90.000000, 0.000050, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -2.000000, 0.000000}, 270.000000, 0.000130, 0.104000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, -1.000000, 0.000000}, 270.000000, 0.000640, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, -2.000000}, 270.000000, 0.000040, 0.108000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.000400, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, -1.000000, 1.000000, 0.000000}, 90.000000, 0.000020, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000060, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000030, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000100, 0.086000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, -1.000000, 0.000000}, 90.000000, 0.000530, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, -2.000000}, 90.000000, 0.000020, 0.089000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.000270, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 1.000000, 1.000000, 0.000000}, 90.000000, 0.000040, 0.019000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -2.000000, 0.000000}, 90.000000, 0.000040, 0.050000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, -1.000000, 0.000000}, 90.000000, 0.000120, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -3.000000, 0.000000, 0.000000}, 90.000000, 0.000060, 0.022000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -2.000000, 0.000000}, 90.000000, 0.000540, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, -1.000000, 0.000000}, 90.000000, 0.001400, 0.029000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000, -2.000000}, 90.000000, 0.000020, 0.048000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 0.000000, 0.000000}, 90.000000, 0.000640, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -2.000000, 1.000000, 0.000000}, 90.000000, 0.000090, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -3.000000, 0.000000}, 90.000000, 0.000110, 0.115000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -2.000000, 0.000000}, 90.000000, 0.004760, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, -2.000000}, 90.000000, 0.000070, 0.119000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, -1.000000, 0.000000}, 90.000000, 0.009930, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, -2.000000}, 90.000000, 0.000140, 0.046000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.003940, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 1.000000, 0.000000}, 90.000000, 0.000510, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, -1.000000, 2.000000, 0.000000}, 90.000000, 0.000050, 0.013000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -2.000000, 0.000000}, 270.000000, 0.000120, 0.044000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.000380, 0.028000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000190, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 0.000000, 1.000000, 0.000000}, 270.000000, 0.000030, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -3.000000, 0.000000}, 90.000000, 0.000060, 0.093000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000600, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, -2.000000}, 270.000000, 0.000040, 0.096000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.001460, 0.027000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 0.000000, -2.000000}, 270.000000, 0.000050, 0.042000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 0.000000, 0.000000}, 270.000000, 0.000610, 0.020000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 1.000000, 1.000000, 0.000000}, 270.000000, 0.000090, 0.016000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -2.000000, 0.000000}, 270.000000, 0.000130, 0.040000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 4.000000, 2.000000, -1.000000, 0.000000}, 270.000000, 0.000090, 0.026000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, -2.000000, 0.000000}, 90.000000, 0.000030, 0.022000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -2.000000, -1.000000, 0.000000}, 90.000000, 0.000030, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -3.000000, 0.000000}, 90.000000, 0.000060, 0.030000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -2.000000, 0.000000}, 90.000000, 0.000170, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, -1.000000, 0.000000}, 90.000000, 0.000130, 0.017000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.000040, 0.014000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000020, 0.021000},
-{{0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 6.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.000020, 0.016000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 0.000000, -1.000000}, 284.813110, 0.000030, 0.040000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, -1.000000, 0.000000, 1.000000, -1.000000}, 104.813110, 0.000050, 0.087000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -2.000000, -1.000000}, 284.813110, 0.000030, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, -1.000000}, 284.813110, 0.000490, 0.075000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, -1.000000, 1.000000}, 104.813110, 0.000120, 0.074000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 1.000000, -1.000000}, 104.813110, 0.000490, 0.076000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 1.000000, 0.000000, 2.000000, -1.000000}, 104.813110, 0.000030, 0.038000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, -1.000000, -1.000000}, 284.813110, 0.000030, 0.088000},
-{{0.000000, 0.000000, 1.000000, 0.000000, 0.000000, 0.000000, 0.000000, 3.000000, 0.000000, 0.000000, -1.000000}, 104.813110, 0.000040, 0.041000},
+
+static const uint16_t arg[] = {
+15, 13, 16, 22, 1, 84, 68, 115, 107, 133,
+194, 131, 173, 205, 229, 268, 262, 293, 395, 129,
+462, 128, 409, 528, 631, 802, 700, 769, 735, 311,
+1139, 482, 240, 1085, 1106, 1171, 1262, 1185, 997, 1046,
+1182, 2227, 1487, 2288, 1442, 1419, 1929, 1647, 2679, 1686,
+1471, 1234, 1596, 1443, 1685, 1737, 1712, 82, 80, 3143,
+2263, 1365, 3476, 436, 1930, 648, 1800, 2447, 2678, 2882,
+2503, 2722, 2769, 3207, 3668, 3423, 3361, 1646, 4663, 3468,
+3359, 3360, 4479, 2768, 3566, 6230, 6790, 3567, 3895, 3896,
+6811, 4664, 2119, 346, 3208, 4810, 5114, 1341, 4599, 4885,
+4665, 5115, 6758, 590, 8502, 6759, 6205, 8438, 4884, 7477,
+7480, 5403, 6760, 6544, 6765, 6766, 5404, 6203, 12487, 6762,
+2919, 8440, 12407, 6764, 12409, 6208, 12488, 379, 12607, 1700,
+7476, 6204, 6207, 6761, 902, 8439, 6763, 8441, 7478, 7479,
+8442, 7482, 465, 7540, 16724, 12404, 9852, 9853, 6231, 7247,
+7542, 9856, 9857, 1019, 598, 572, 531, 1645, 17072, 12403,
+8503, 2883, 16731, 9969, 17073, 16738, 17074, 12412, 12413,
+};
+
+static const uint16_t max_arg[] = {
+15, 15, 16, 22, 22, 84, 84, 115, 115, 133,
+194, 194, 194, 205, 229, 268, 268, 293, 395, 395,
+462, 462, 462, 528, 631, 802, 802, 802, 802, 802,
+1139, 1139, 1139, 1139, 1139, 1171, 1262, 1262, 1262, 1262,
+1262, 2227, 2227, 2288, 2288, 2288, 2288, 2288, 2679, 2679,
+2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 3143,
+3143, 3143, 3476, 3476, 3476, 3476, 3476, 3476, 3476, 3476,
+3476, 3476, 3476, 3476, 3668, 3668, 3668, 3668, 4663, 4663,
+4663, 4663, 4663, 4663, 4663, 6230, 6790, 6790, 6790, 6790,
+6811, 6811, 6811, 6811, 6811, 6811, 6811, 6811, 6811, 6811,
+6811, 6811, 6811, 6811, 8502, 8502, 8502, 8502, 8502, 8502,
+8502, 8502, 8502, 8502, 8502, 8502, 8502, 8502, 12487, 12487,
+12487, 12487, 12487, 12487, 12487, 12487, 12488, 12488, 12607, 12607,
+12607, 12607, 12607, 12607, 12607, 12607, 12607, 12607, 12607, 12607,
+12607, 12607, 12607, 12607, 16724, 16724, 16724, 16724, 16724, 16724,
+16724, 16724, 16724, 16724, 16724, 16724, 16724, 16724, 17072, 17072,
+17072, 17072, 17072, 17072, 17073, 17073, 17074, 17074, 17074,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.51395000000000002, 0.38245000000000001, 0.32654, 0.26395999999999997,
+0.12302, 0.077539999999999998, 0.060679999999999998, 0.049700000000000001,
+0.041939999999999998, 0.032219999999999999, 0.02529, 0.024899999999999999,
+0.017639999999999999, 0.014489999999999999, 0.013559999999999999, 0.011860000000000001,
+0.010659999999999999, 0.0099299999999999996, 0.0065799999999999999, 0.0063299999999999997,
+0.0058700000000000002, 0.0053600000000000002, 0.0047600000000000003, 0.0039399999999999999,
+0.00331, 0.0030999999999999999, 0.0023500000000000001, 0.00214,
+0.0021299999999999999, 0.00174, 0.00173, 0.00165,
+0.00149, 0.0014599999999999999, 0.0014, 0.0012600000000000001,
+0.00125, 0.00114, 0.0011199999999999999, 0.00106,
+0.00088999999999999995, 0.00084000000000000003, 0.00084000000000000003, 0.00080999999999999996,
+0.00073999999999999999, 0.00068999999999999997, 0.00064000000000000005, 0.00064000000000000005,
+0.00062, 0.00060999999999999997, 0.00059999999999999995, 0.00055000000000000003,
+0.00054000000000000001, 0.00052999999999999998, 0.00052999999999999998, 0.00052999999999999998,
+0.00051000000000000004, 0.00048999999999999998, 0.00048999999999999998, 0.00046999999999999999,
+0.00042999999999999999, 0.00040000000000000002, 0.00040000000000000002, 0.00038999999999999999,
+0.00038000000000000002, 0.00034000000000000002, 0.00029, 0.00029,
+0.00029, 0.00027999999999999998, 0.00027, 0.00025999999999999998,
+0.00023000000000000001, 0.00022000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00017000000000000001, 0.00016000000000000001, 0.00016000000000000001, 0.00014999999999999999,
+0.00014999999999999999, 0.00014999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00012999999999999999, 0.00012999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012, 0.00012,
+0.00012, 0.00012, 0.00011, 0.0001,
+0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+3.1470361121089108e-17, 2.3418308416695263e-17, 1.9994808289678836e-17, -4.8488665365440295e-17,
+-2.2598407384666108e-17, -1.4243866920882863e-17, -1.1146735165839208e-17, 3.0432472958811727e-18,
+2.5680843378119995e-18, 1.9729059934263857e-18, -4.6456976325654839e-18, 1.5246852649384546e-18,
+1.0801384768479655e-18, -2.6617698179467719e-18, -2.490931589465716e-18, -2.1786466556831415e-18,
+6.5273674394553923e-19, 6.0803713577666083e-19, -1.2087263907584376e-18, -1.1628021357904118e-18,
+-1.0783015066492445e-18, -9.846160265144719e-19, 2.9146593819707009e-19, 2.4125541943202859e-19,
+2.0267904525888695e-19, 1.8982025386783974e-19, 1.43895998899814e-19, -3.9311162252630034e-19,
+1.3042488410919312e-19, -3.1963281457745916e-19, -3.1779584437873814e-19, -3.0310008278896988e-19,
+-2.7370855960943342e-19, -2.6819764901327031e-19, 8.5725275940314722e-20, -2.3145824503884977e-19,
+-2.296212748401287e-19, -2.0941460265419738e-19, 6.8580220752251773e-20, 6.4906280354809721e-20,
+-1.6349034768617164e-19, -1.543054966925665e-19, -1.543054966925665e-19, -1.4879458609640339e-19,
+-1.359357947053562e-19, 4.2250314570583682e-20, -1.175660927181459e-19, 3.9188697572715303e-20,
+3.7964050773567951e-20, -1.120551821219828e-19, -1.1021821192326178e-19, 3.3677786976552213e-20,
+3.306546357697854e-20, -9.7359420532214576e-20, -9.7359420532214576e-20, 3.2453140177404861e-20,
+3.1228493378257508e-20, 0.00012527681661465416, -0.00012527681661465444, 2.8779199779962797e-20,
+-7.898971854500428e-20, 2.4492935982947065e-20, 2.4492935982947065e-20, -7.1641837750120152e-20,
+-6.9804867551399132e-20, 2.0818995585505007e-20, -5.3272135762909862e-20, 1.7757378587636623e-20,
+-5.3272135762909862e-20, -5.1435165564188824e-20, 1.653273178848927e-20, -4.7761225166746766e-20,
+1.4083438190194562e-20, 1.3471114790620885e-20, -3.4902433775699566e-20, -3.4902433775699566e-20,
+1.0409497792752504e-20, -2.9391523179536476e-20, 9.7971743931788258e-21, 9.184850993605148e-21,
+9.184850993605148e-21, 9.184850993605148e-21, -2.5717582782094412e-20, -2.5717582782094412e-20,
+8.5725275940314716e-21, 8.5725275940314716e-21, 7.9602041944577953e-21, -2.3880612583373383e-20,
+-2.3880612583373383e-20, 7.9602041944577953e-21, 7.347880794884119e-21, 7.347880794884119e-21,
+-2.2043642384652357e-20, -3.0680036721956189e-05, 6.7355573953104427e-21, 6.1232339957367663e-21,
+-1.8369701987210299e-20, -1.6532731788489267e-20, -1.6532731788489267e-20, 5.51091059616309e-21,
+-1.6532731788489267e-20, -1.6532731788489267e-20, -1.4695761589768238e-20, -1.4695761589768238e-20,
+-1.4695761589768238e-20, -1.4695761589768238e-20, -1.4695761589768238e-20, -1.4695761589768238e-20,
+4.2862637970157358e-21, -1.2858791391047206e-20, 4.2862637970157358e-21, -1.1021821192326178e-20,
+-1.1021821192326178e-20, 3.6739403974420595e-21, 3.6739403974420595e-21, 3.6739403974420595e-21,
+3.6739403974420595e-21, 3.0616169978683832e-21, -9.1848509936051495e-21, -9.1848509936051495e-21,
+3.0616169978683832e-21, 3.0616169978683832e-21, 3.0616169978683832e-21, -9.1848509936051495e-21,
+3.0616169978683832e-21, 3.0616169978683832e-21, -9.1848509936051495e-21, -1.2783348634148412e-05,
+-7.347880794884119e-21, 2.4492935982947065e-21, -7.347880794884119e-21, 2.4492935982947065e-21,
+-7.347880794884119e-21, -7.347880794884119e-21, 2.4492935982947065e-21, -7.347880794884119e-21,
+-7.347880794884119e-21, -7.347880794884119e-21, 2.4492935982947065e-21, 2.4492935982947065e-21,
+-7.347880794884119e-21, 2.4492935982947065e-21, -1.022667890731873e-05, -5.5109105961630892e-21,
+1.8369701987210297e-21, 1.8369701987210297e-21, -5.5109105961630892e-21, -5.5109105961630892e-21,
+1.8369701987210297e-21, 1.8369701987210297e-21, -5.5109105961630892e-21, 1.8369701987210297e-21,
+1.8369701987210297e-21, 7.6700091804890303e-06, 7.6700091804890303e-06, -7.6700091804890473e-06,
+7.6700091804890303e-06, 1.2246467991473532e-21, -3.6739403974420595e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, -3.6739403974420595e-21, -3.6739403974420595e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21, -3.6739403974420595e-21,
+-3.6739403974420595e-21,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.51395000000000002, 0.38245000000000001, 0.32654, -0.26395999999999997,
+-0.12302, -0.077539999999999998, -0.060679999999999998, 0.049700000000000001,
+0.041939999999999998, 0.032219999999999999, -0.02529, 0.024899999999999999,
+0.017639999999999999, -0.014489999999999999, -0.013559999999999999, -0.011860000000000001,
+0.010659999999999999, 0.0099299999999999996, -0.0065799999999999999, -0.0063299999999999997,
+-0.0058700000000000002, -0.0053600000000000002, 0.0047600000000000003, 0.0039399999999999999,
+0.00331, 0.0030999999999999999, 0.0023500000000000001, -0.00214,
+0.0021299999999999999, -0.00174, -0.00173, -0.00165,
+-0.00149, -0.0014599999999999999, 0.0014, -0.0012600000000000001,
+-0.00125, -0.00114, 0.0011199999999999999, 0.00106,
+-0.00088999999999999995, -0.00084000000000000003, -0.00084000000000000003, -0.00080999999999999996,
+-0.00073999999999999999, 0.00068999999999999997, -0.00064000000000000005, 0.00064000000000000005,
+0.00062, -0.00060999999999999997, -0.00059999999999999995, 0.00055000000000000003,
+0.00054000000000000001, -0.00052999999999999998, -0.00052999999999999998, 0.00052999999999999998,
+0.00051000000000000004, -0.00047371480789489608, 0.00047371480789489597, 0.00046999999999999999,
+-0.00042999999999999999, 0.00040000000000000002, 0.00040000000000000002, -0.00038999999999999999,
+-0.00038000000000000002, 0.00034000000000000002, -0.00029, 0.00029,
+-0.00029, -0.00027999999999999998, 0.00027, -0.00025999999999999998,
+0.00023000000000000001, 0.00022000000000000001, -0.00019000000000000001, -0.00019000000000000001,
+0.00017000000000000001, -0.00016000000000000001, 0.00016000000000000001, 0.00014999999999999999,
+0.00014999999999999999, 0.00014999999999999999, -0.00013999999999999999, -0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00012999999999999999, -0.00012999999999999999,
+-0.00012999999999999999, 0.00012999999999999999, 0.00012, 0.00012,
+-0.00012, 0.00011601178968854597, 0.00011, 0.0001,
+-0.0001, -9.0000000000000006e-05, -9.0000000000000006e-05, 9.0000000000000006e-05,
+-9.0000000000000006e-05, -9.0000000000000006e-05, -8.0000000000000007e-05, -8.0000000000000007e-05,
+-8.0000000000000007e-05, -8.0000000000000007e-05, -8.0000000000000007e-05, -8.0000000000000007e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05, -6.0000000000000002e-05,
+-6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 4.833824570356082e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 3.8670596562848655e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -2.9002947422136496e-05, -2.9002947422136496e-05, 2.9002947422136493e-05,
+-2.9002947422136496e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05,
+};
+
+const struct elp_table elp21 = {
+    arg, max_arg, amp, c, s, 169
 };
@@ -1,6 +1,25 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp22[] = {
-{0.000000, {1.000000, 1.000000, -1.000000, -1.000000}, 192.936650, 0.000040, 0.075000},
-{0.000000, {1.000000, 1.000000, 0.000000, -1.000000}, 192.936650, 0.000820, 18.600000},
-{0.000000, {1.000000, 1.000000, 1.000000, -1.000000}, 192.936650, 0.000040, 0.076000},
+
+static const uint16_t arg[] = {
+120, 425, 426,
+};
+
+static const uint16_t max_arg[] = {
+120, 425, 426,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00081999999999999998, 4.0000000000000003e-05, 4.0000000000000003e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.00079918691572033508, -3.8984727596113911e-05, -3.8984727596113911e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+-0.00018357634308760479, -8.954943565249015e-06, -8.954943565249015e-06,
+};
+
+const struct elp_table elp22 = {
+    arg, max_arg, amp, c, s, 3
 };
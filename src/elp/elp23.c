@@ -1,5 +1,25 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp23[] = {
-{0.000000, {1.000000, 1.000000, 0.000000, -2.000000}, 192.936630, 0.000040, 0.074000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 192.936640, 0.000040, 0.075000},
+
+static const uint16_t arg[] = {
+427, 131,
+};
+
+static const uint16_t max_arg[] = {
+427, 427,
+};
+
+static const double ELP_ALIGNED amp[] = {
+4.0000000000000003e-05, 4.0000000000000003e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-3.8984730721976524e-05, -3.898472915904581e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+-8.954929957011394e-06, -8.95493676113034e-06,
+};
+
+const struct elp_table elp23 = {
+    arg, max_arg, amp, c, s, 2
 };
@@ -1,5 +1,25 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp24[] = {
-{0.000000, {1.000000, 1.000000, -1.000000, -1.000000}, 282.936650, 0.000040, 0.075000},
-{0.000000, {1.000000, 1.000000, 1.000000, -1.000000}, 102.936650, 0.000040, 0.076000},
+
+static const uint16_t arg[] = {
+425, 426,
+};
+
+static const uint16_t max_arg[] = {
+425, 426,
+};
+
+static const double ELP_ALIGNED amp[] = {
+4.0000000000000003e-05, 4.0000000000000003e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+8.9549435652490133e-06, -8.9549435652490251e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+-3.8984727596113911e-05, 3.8984727596113911e-05,
+};
+
+const struct elp_table elp24 = {
+    arg, max_arg, amp, c, s, 2
 };
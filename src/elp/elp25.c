@@ -1,9 +1,28 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp25[] = {
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000580, 0.075000},
-{0.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 0.000000, 0.000040, 0.038000},
-{0.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.564000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000210, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000090, 0.040000},
-{0.000000, {2.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000010, 0.026000},
+
+static const uint16_t arg[] = {
+63, 26, 109, 199, 125, 344,
+};
+
+static const uint16_t max_arg[] = {
+63, 63, 109, 199, 199, 344,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00058, 0.00021000000000000001, 9.0000000000000006e-05, 4.0000000000000003e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.00058, 0.00021000000000000001, 9.0000000000000006e-05, 4.0000000000000003e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 0, 0, 0,
+0, 0,
+};
+
+const struct elp_table elp25 = {
+    arg, max_arg, amp, c, s, 6
 };
@@ -1,7 +1,25 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp26[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000050, 0.075000},
-{0.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000030, 5.997000},
-{0.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 0.000000, 0.000030, 0.037000},
-{0.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.000010, 0.088000},
+
+static const uint16_t arg[] = {
+367, 142, 155, 83,
+};
+
+static const uint16_t max_arg[] = {
+367, 367, 367, 367,
+};
+
+static const double ELP_ALIGNED amp[] = {
+5.0000000000000002e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-5.0000000000000002e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+6.1232339957367663e-21, 0, 0, 0,
+};
+
+const struct elp_table elp26 = {
+    arg, max_arg, amp, c, s, 4
 };
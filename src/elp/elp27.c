@@ -1,8 +1,28 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp27[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.003560, 99999.999000},
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 270.000000, 0.000720, 0.075000},
-{0.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 270.000000, 0.000030, 0.038000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.000190, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000130, 0.040000},
+
+static const uint16_t arg[] = {
+25, 63, 26, 109, 199,
+};
+
+static const uint16_t max_arg[] = {
+25, 63, 63, 109, 199,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0035599999999999998, 0.00072000000000000005, 0.00019000000000000001, 0.00012999999999999999,
+3.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+2.1798713024822886e-19, -1.3226185430791414e-19, -3.4902433775699566e-20, -2.3880612583373383e-20,
+-5.5109105961630892e-21,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.0035599999999999998, -0.00072000000000000005, -0.00019000000000000001, -0.00012999999999999999,
+-3.0000000000000001e-05,
+};
+
+const struct elp_table elp27 = {
+    arg, max_arg, amp, c, s, 5
 };
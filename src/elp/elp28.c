@@ -1,23 +1,39 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp28[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 303.961850, 0.000040, 0.075000},
-{0.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 259.883930, 0.000160, 5.997000},
-{0.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 0.430200, 0.000400, 2.998000},
-{0.000000, {0.000000, 0.000000, 3.000000, -2.000000}, 0.433790, 0.000020, 0.077000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 359.998580, 0.000140, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 359.999820, 0.002230, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 359.999610, 0.000140, 0.070000},
-{0.000000, {1.000000, 0.000000, -1.000000, 0.000000}, 359.993310, 0.000090, 1.127000},
-{0.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 359.995370, 0.000010, 0.081000},
-{0.000000, {1.000000, 1.000000, -1.000000, 0.000000}, 0.064180, 0.000030, 8.850000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 180.000950, 0.000040, 0.095000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 180.000140, 0.000030, 0.042000},
-{0.000000, {2.000000, 0.000000, -3.000000, 0.000000}, 179.981260, 0.000010, 0.067000},
-{0.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 179.983660, 0.000250, 0.564000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 179.996380, 0.000140, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 179.958640, 0.000030, 0.474000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 179.999040, 0.000020, 0.040000},
-{0.000000, {2.000000, 1.000000, -2.000000, 0.000000}, 179.991840, 0.000020, 1.292000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 0.003130, 0.000020, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 359.999650, 0.000020, 0.039000},
+
+static const uint16_t arg[] = {
+43, 118, 125, 142, 106, 123, 26, 294, 367, 91,
+221, 101, 136, 430, 109, 331, 216, 228, 110, 578,
+};
+
+static const uint16_t max_arg[] = {
+43, 118, 125, 142, 142, 142, 142, 294, 367, 367,
+367, 367, 367, 430, 430, 430, 430, 430, 430, 578,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0022300000000000002, 0.00040000000000000002, 0.00025000000000000001, 0.00016000000000000001,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 9.0000000000000006e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.0022299999999889956, 0.00039998872481951126, -0.00024999998983356124, -2.8102855542400928e-05,
+0.00013999999995700384, 0.00013999999999675673, -0.000139999999720572, 8.9999999386493066e-05,
+2.2345630823918557e-05, -3.9999999994501662e-05, 2.999998117888387e-05, -2.9999999999910442e-05,
+-2.9999992183595332e-05, 1.9999426792673159e-05, -1.9999999997192646e-05, -1.9999999797168665e-05,
+1.9999999970156937e-05, 1.9999999999626843e-05, 9.9999999673497352e-06, -9.9999994651107022e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+-7.0057516180117431e-09, 3.0033343572328728e-06, 7.1296698977576033e-08, -0.00015751263285959939,
+-3.4697145525607864e-09, -9.5294977152910758e-10, 8.8453286432730882e-09, -1.0508627402386094e-08,
+-3.3176388939743594e-05, -6.6322511571594421e-10, 3.3604562390392934e-08, -7.3303828576759664e-11,
+2.1656043477934594e-08, 1.5141982864535321e-07, 3.3510321636241301e-10, 2.8483773296285838e-09,
+1.09257611120502e-09, -1.2217304764719812e-10, -8.0808744279408647e-10, 3.2707469599230124e-09,
+};
+
+const struct elp_table elp28 = {
+    arg, max_arg, amp, c, s, 20
 };
@@ -1,15 +1,33 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp29[] = {
-{0.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 0.021990, 0.000030, 5.997000},
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 245.990670, 0.000010, 0.075000},
-{0.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 0.005300, 0.000010, 0.037000},
-{0.000000, {0.000000, 0.000000, 2.000000, -3.000000}, 0.422830, 0.000020, 0.073000},
-{0.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 0.745050, 0.000010, 0.076000},
-{0.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 359.999820, 0.000010, 0.039000},
-{0.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 359.999820, 0.000100, 0.081000},
-{0.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 359.999820, 0.000100, 0.069000},
-{0.000000, {0.000000, 1.000000, 1.000000, 1.000000}, 359.999820, 0.000010, 0.036000},
-{0.000000, {2.000000, 0.000000, -2.000000, -1.000000}, 179.983560, 0.000010, 0.066000},
-{0.000000, {2.000000, 0.000000, -2.000000, 1.000000}, 179.983530, 0.000010, 0.086000},
-{0.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 179.994780, 0.000050, 0.088000},
+
+static const uint16_t arg[] = {
+284, 285, 83, 142, 406, 63, 155, 93, 382, 423,
+369, 218,
+};
+
+static const uint16_t max_arg[] = {
+284, 285, 285, 285, 406, 406, 406, 406, 406, 423,
+423, 423,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0001, 0.0001, 5.0000000000000002e-05, 3.0000000000000001e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+9.9999999999506517e-05, 9.9999999999506517e-05, -4.9999999792491567e-05, 2.9999997790487578e-05,
+1.999945539158136e-05, -4.0688539871154025e-06, 9.9999999572164835e-06, 9.9991545470225661e-06,
+9.9999999999506527e-06, 9.9999999999506527e-06, -9.999999588349771e-06, -9.9999995868460266e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+-3.1415926538169248e-10, -3.1415926538169248e-10, 4.555309341413447e-09, 1.1513936792737847e-08,
+1.4759417382573347e-07, -9.1347921285344587e-06, 9.2502450223780145e-10, 1.3003209126194808e-07,
+-3.1415926538169252e-11, -3.1415926538169252e-11, 2.869321250906837e-09, 2.8745572384453853e-09,
+};
+
+const struct elp_table elp29 = {
+    arg, max_arg, amp, c, s, 12
 };
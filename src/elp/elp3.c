@@ -1,707 +1,690 @@
 #include "lunar-priv.h"
-const struct main_problem  elp3[] = {
-{{0.000000, 0.000000, 0.000000, 0.000000}, 385000.527190, {-7992.630000, -11.060000, 21578.080000, -4.530000, 11.390000, -0.060000}},
-{{0.000000, 0.000000, 0.000000, 2.000000}, -3.148370, {-204.480000, -138.940000, 159.640000, -0.390000, 0.120000, 0.000000}},
-{{0.000000, 0.000000, 0.000000, 4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -4.000000}, 0.000380, {0.030000, 0.030000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, -2.000000}, 79.661830, {-359.450000, 3583.790000, 1454.020000, -2.370000, 0.850000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 0.000000}, -20905.322060, {6888.230000, -35.830000, -380331.740000, 22.310000, 1.770000, 0.000000}},
-{{0.000000, 0.000000, 1.000000, 2.000000}, -0.103260, {-9.140000, -4.530000, 8.080000, 0.000000, 0.020000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -4.000000}, -0.008370, {0.070000, -0.750000, -0.310000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, -2.000000}, -4.421240, {18.290000, -198.910000, -161.900000, 0.140000, -0.040000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 0.000000}, -569.923320, {374.440000, -1.990000, -20737.330000, 5.790000, 0.440000, 0.000000}},
-{{0.000000, 0.000000, 2.000000, 2.000000}, -0.001020, {-0.370000, -0.040000, 0.620000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -4.000000}, 0.000330, {0.000000, 0.030000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, -2.000000}, -0.001110, {0.000000, 0.000000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 0.000000}, -23.210320, {26.490000, -0.140000, -1266.640000, 0.630000, 0.050000, 0.000000}},
-{{0.000000, 0.000000, 3.000000, 2.000000}, 0.000260, {0.000000, 0.000000, 0.060000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, -2.000000}, 0.000270, {0.000000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 0.000000}, -1.116930, {1.980000, 0.000000, -81.260000, 0.060000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 4.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 5.000000, 0.000000}, -0.058880, {0.150000, 0.000000, -5.350000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 6.000000, 0.000000}, -0.003290, {0.000000, 0.000000, -0.360000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 0.000000, 7.000000, 0.000000}, -0.000190, {0.000000, 0.000000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -6.000000, 0.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -5.000000, 0.000000}, -0.001740, {-0.030000, 0.000000, -0.160000, -0.100000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -4.000000, 0.000000}, -0.026740, {-0.560000, 0.000000, -1.940000, -1.600000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 0.000000}, -0.422420, {-9.350000, 0.200000, -23.040000, -25.300000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -3.000000, 2.000000}, 0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, -2.000000}, -0.000190, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 0.000000}, -7.002930, {-161.630000, 3.290000, -254.780000, -419.550000, -0.120000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 2.000000}, -0.050200, {-1.170000, -2.240000, -1.830000, -3.010000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -2.000000, 4.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, -2.000000}, -0.007690, {-0.150000, -0.340000, -0.040000, -0.460000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 0.000000}, -129.624760, {-3122.770000, 61.800000, -2362.460000, -7767.840000, -0.740000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 2.000000}, 0.334650, {7.260000, 14.910000, 5.990000, 20.060000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, -1.000000, 4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, -2.000000}, -0.185680, {-4.480000, -8.290000, 0.540000, -11.120000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 0.000000, 0.000000}, 48.890100, {1082.400000, -25.990000, 156.780000, 2926.500000, -3.760000, 0.020000}},
-{{0.000000, 1.000000, 0.000000, 2.000000}, -0.158030, {-3.350000, -7.060000, -0.080000, -9.460000, -0.030000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, -2.000000}, -0.248110, {-2.720000, -11.080000, -4.500000, -14.870000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 0.000000}, 104.758960, {2165.070000, -47.620000, 1929.100000, 6279.070000, -0.600000, 0.000000}},
-{{0.000000, 1.000000, 1.000000, 2.000000}, -0.006820, {-0.050000, -0.310000, -0.170000, -0.410000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, -2.000000}, 0.032650, {0.360000, 1.450000, 1.200000, 1.960000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 0.000000}, 5.751050, {119.470000, -2.620000, 210.760000, 344.760000, -0.090000, 0.000000}},
-{{0.000000, 1.000000, 2.000000, 2.000000}, -0.000300, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, -2.000000}, -0.000800, {-0.040000, -0.040000, -0.040000, -0.050000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 3.000000, 0.000000}, 0.355090, {7.330000, -0.160000, 19.480000, 21.290000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, -2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 4.000000, 0.000000}, 0.023040, {0.470000, 0.000000, 1.680000, 1.380000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 5.000000, 0.000000}, 0.001530, {0.030000, 0.000000, 0.140000, 0.090000, 0.000000, 0.000000}},
-{{0.000000, 1.000000, 6.000000, 0.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -5.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -4.000000, 0.000000}, -0.000660, {-0.020000, 0.000000, -0.050000, -0.080000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -3.000000, 0.000000}, -0.009380, {-0.290000, 0.000000, -0.510000, -1.120000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 0.000000}, -0.136180, {-4.100000, 0.090000, -4.960000, -16.310000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -2.000000, 2.000000}, -0.000990, {-0.030000, -0.040000, -0.040000, -0.120000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, -2.000000}, -0.000310, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 0.000000}, -2.117280, {-59.780000, 1.220000, -38.700000, -253.610000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, -1.000000, 2.000000}, 0.004500, {0.120000, 0.200000, 0.080000, 0.540000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, -2.000000}, -0.005580, {-0.140000, -0.250000, 0.000000, -0.670000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 0.000000}, 1.065750, {16.470000, -0.600000, 3.280000, 127.540000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 0.000000, 2.000000}, -0.003420, {-0.070000, -0.150000, 0.000000, -0.410000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, -2.000000}, -0.002370, {0.000000, -0.110000, -0.040000, -0.280000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 0.000000}, 1.165620, {22.200000, -0.390000, 21.490000, 139.600000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 1.000000, 2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, -2.000000}, 0.000180, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 2.000000, 0.000000}, 0.050720, {0.700000, 0.000000, 1.860000, 6.070000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 3.000000, 0.000000}, 0.002280, {0.000000, 0.000000, 0.130000, 0.270000, 0.000000, 0.000000}},
-{{0.000000, 2.000000, 4.000000, 0.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -3.000000, 0.000000}, -0.000210, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, 0.000000}, -0.002870, {-0.100000, 0.000000, -0.100000, -0.510000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -2.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, 0.000000}, -0.038940, {-1.140000, 0.030000, -0.710000, -6.990000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, -1.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, -2.000000}, -0.000170, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, 0.000000}, 0.021270, {0.030000, 0.000000, 0.080000, 3.820000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 0.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 1.000000, 0.000000}, 0.019120, {0.390000, 0.000000, 0.350000, 3.430000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 2.000000, 0.000000}, 0.000780, {0.000000, 0.000000, 0.030000, 0.140000, 0.000000, 0.000000}},
-{{0.000000, 3.000000, 3.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -2.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, -1.000000, 0.000000}, -0.000730, {-0.020000, 0.000000, 0.000000, -0.170000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 0.000000, 0.000000}, 0.000340, {0.000000, 0.000000, 0.000000, 0.080000, 0.000000, 0.000000}},
-{{0.000000, 4.000000, 1.000000, 0.000000}, 0.000370, {0.000000, 0.000000, 0.000000, 0.090000, 0.000000, 0.000000}},
-{{1.000000, -4.000000, 0.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, -3.000000, -1.000000, 0.000000}, 0.000350, {0.000000, 0.000000, 0.000000, 0.060000, 0.130000, 0.000000}},
-{{1.000000, -3.000000, 0.000000, 0.000000}, -0.001610, {0.000000, 0.000000, 0.000000, -0.290000, -0.630000, 0.000000}},
-{{1.000000, -2.000000, -3.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, -2.000000, 0.000000}, 0.000290, {0.000000, 0.000000, 0.000000, 0.040000, 0.110000, 0.000000}},
-{{1.000000, -2.000000, -1.000000, 0.000000}, 0.008440, {0.100000, 0.000000, 0.170000, 1.010000, 3.280000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, -2.000000}, -0.000240, {0.000000, 0.000000, 0.000000, -0.030000, -0.090000, 0.000000}},
-{{1.000000, -2.000000, 0.000000, 0.000000}, -0.029480, {0.180000, 0.000000, -0.030000, -3.520000, -11.460000, 0.060000}},
-{{1.000000, -2.000000, 0.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -2.000000, 1.000000, 0.000000}, 0.001590, {0.160000, 0.000000, 0.030000, 0.190000, 0.620000, 0.000000}},
-{{1.000000, -2.000000, 2.000000, 0.000000}, 0.000360, {0.030000, 0.000000, 0.000000, 0.040000, 0.140000, 0.000000}},
-{{1.000000, -2.000000, 3.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, -4.000000, 0.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, -1.000000, -3.000000, 0.000000}, 0.000650, {0.000000, 0.000000, 0.040000, 0.040000, 0.250000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, 0.000000}, -0.004220, {-0.240000, 0.000000, -0.130000, -0.260000, -1.640000, 0.000000}},
-{{1.000000, -1.000000, -2.000000, 2.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, -2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{1.000000, -1.000000, -1.000000, 0.000000}, 0.114110, {0.000000, -0.020000, 2.310000, 6.800000, 44.370000, -0.230000}},
-{{1.000000, -1.000000, -1.000000, 2.000000}, 0.000210, {0.000000, 0.000000, 0.000000, 0.000000, 0.080000, 0.000000}},
-{{1.000000, -1.000000, 0.000000, -2.000000}, -0.013660, {-0.210000, -0.610000, 0.000000, -0.820000, -5.310000, 0.030000}},
-{{1.000000, -1.000000, 0.000000, 0.000000}, 0.497570, {32.610000, -1.420000, 0.140000, 30.000000, 193.460000, -1.020000}},
-{{1.000000, -1.000000, 0.000000, 2.000000}, -0.000740, {-0.030000, -0.030000, 0.000000, -0.040000, -0.290000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, -2.000000}, 0.000440, {0.000000, 0.020000, 0.000000, 0.030000, 0.170000, 0.000000}},
-{{1.000000, -1.000000, 1.000000, 0.000000}, 0.109980, {5.320000, -0.170000, 2.140000, 6.590000, 42.760000, -0.230000}},
-{{1.000000, -1.000000, 1.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, -1.000000, 2.000000, 0.000000}, 0.011210, {0.520000, 0.000000, 0.420000, 0.670000, 4.360000, -0.020000}},
-{{1.000000, -1.000000, 3.000000, 0.000000}, 0.000970, {0.040000, 0.000000, 0.050000, 0.060000, 0.380000, 0.000000}},
-{{1.000000, -1.000000, 4.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 0.000000, -6.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 0.000000, -5.000000, 0.000000}, -0.000430, {0.000000, 0.000000, -0.040000, 0.000000, -0.170000, 0.000000}},
-{{1.000000, 0.000000, -4.000000, 0.000000}, -0.006360, {-0.180000, 0.000000, -0.460000, 0.000000, -2.470000, 0.000000}},
-{{1.000000, 0.000000, -3.000000, -2.000000}, -0.000190, {0.000000, 0.000000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{1.000000, 0.000000, -3.000000, 0.000000}, -0.099380, {-2.830000, 0.090000, -5.450000, -0.040000, -38.640000, 0.200000}},
-{{1.000000, 0.000000, -3.000000, 2.000000}, -0.000480, {0.000000, -0.020000, -0.030000, 0.000000, -0.190000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, -2.000000}, -0.002780, {-0.040000, -0.120000, -0.100000, 0.000000, -1.080000, 0.000000}},
-{{1.000000, 0.000000, -2.000000, 0.000000}, -1.738520, {-48.130000, 1.590000, -63.710000, -0.500000, -675.990000, 3.560000}},
-{{1.000000, 0.000000, -2.000000, 2.000000}, 0.004570, {0.030000, 0.200000, 0.160000, 0.000000, 1.780000, 0.000000}},
-{{1.000000, 0.000000, -1.000000, -2.000000}, -0.042320, {-0.600000, -1.870000, -0.770000, 0.000000, -16.450000, 0.090000}},
-{{1.000000, 0.000000, -1.000000, 0.000000}, -8.379090, {-219.270000, 9.530000, -156.070000, -0.840000, -3257.990000, 17.180000}},
-{{1.000000, 0.000000, -1.000000, 2.000000}, -0.024710, {-0.500000, -1.080000, -0.460000, 0.000000, -9.610000, 0.050000}},
-{{1.000000, 0.000000, 0.000000, -2.000000}, -0.795640, {-11.230000, -35.240000, -0.220000, 0.000000, -309.370000, 1.630000}},
-{{1.000000, 0.000000, 0.000000, 0.000000}, 108.742650, {2351.060000, -120.480000, 69.820000, 2.010000, 42281.560000, -222.900000}},
-{{1.000000, 0.000000, 0.000000, 2.000000}, -0.018740, {-0.510000, -0.830000, -0.130000, 0.000000, -7.290000, 0.040000}},
-{{1.000000, 0.000000, 1.000000, -4.000000}, 0.000170, {0.000000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{1.000000, 0.000000, 1.000000, -2.000000}, 0.060550, {0.870000, 2.670000, 1.140000, 0.000000, 23.540000, -0.120000}},
-{{1.000000, 0.000000, 1.000000, 0.000000}, 6.321990, {138.540000, -6.740000, 118.100000, -0.560000, 2458.130000, -12.960000}},
-{{1.000000, 0.000000, 1.000000, 2.000000}, -0.001640, {-0.050000, -0.070000, -0.040000, 0.000000, -0.640000, 0.000000}},
-{{1.000000, 0.000000, 2.000000, -2.000000}, 0.002030, {0.000000, 0.090000, 0.070000, 0.000000, 0.790000, 0.000000}},
-{{1.000000, 0.000000, 2.000000, 0.000000}, 0.378520, {7.870000, -0.400000, 13.920000, -0.090000, 147.180000, -0.780000}},
-{{1.000000, 0.000000, 2.000000, 2.000000}, -0.000130, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, -2.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, 0.000000, 3.000000, 0.000000}, 0.023680, {0.460000, -0.020000, 1.300000, 0.000000, 9.210000, -0.050000}},
-{{1.000000, 0.000000, 4.000000, 0.000000}, 0.001520, {0.030000, 0.000000, 0.110000, 0.000000, 0.590000, 0.000000}},
-{{1.000000, 0.000000, 5.000000, 0.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{1.000000, 1.000000, -5.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, 1.000000, -4.000000, 0.000000}, 0.001010, {0.000000, 0.000000, 0.070000, 0.060000, 0.390000, 0.000000}},
-{{1.000000, 1.000000, -3.000000, 0.000000}, 0.017290, {0.210000, 0.000000, 0.950000, 1.040000, 6.720000, -0.040000}},
-{{1.000000, 1.000000, -3.000000, 2.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.050000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 1.000000, -2.000000, 0.000000}, 0.332260, {4.670000, -0.100000, 12.190000, 19.900000, 129.180000, -0.680000}},
-{{1.000000, 1.000000, -2.000000, 2.000000}, -0.001480, {0.000000, -0.070000, -0.050000, -0.090000, -0.580000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, -2.000000}, 0.001560, {0.000000, 0.070000, 0.030000, 0.090000, 0.610000, 0.000000}},
-{{1.000000, 1.000000, -1.000000, 0.000000}, 0.851270, {-2.920000, -0.500000, 15.940000, 50.910000, 330.990000, -1.740000}},
-{{1.000000, 1.000000, -1.000000, 2.000000}, 0.003310, {-0.020000, 0.150000, 0.060000, 0.200000, 1.290000, 0.000000}},
-{{1.000000, 1.000000, 0.000000, -2.000000}, 0.033790, {0.040000, 1.480000, 0.110000, 2.020000, 13.140000, -0.070000}},
-{{1.000000, 1.000000, 0.000000, 0.000000}, -16.675330, {-4.780000, 10.810000, -19.360000, -997.670000, -6483.730000, 34.180000}},
-{{1.000000, 1.000000, 0.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, -2.000000}, -0.005620, {0.000000, -0.250000, -0.110000, -0.340000, -2.180000, 0.000000}},
-{{1.000000, 1.000000, 1.000000, 0.000000}, -0.933350, {-1.070000, 0.640000, -18.080000, -55.840000, -362.910000, 1.910000}},
-{{1.000000, 1.000000, 2.000000, -2.000000}, -0.000370, {-0.020000, 0.000000, 0.000000, -0.020000, -0.140000, 0.000000}},
-{{1.000000, 1.000000, 2.000000, 0.000000}, -0.059040, {-0.120000, 0.040000, -2.220000, -3.530000, -22.960000, 0.120000}},
-{{1.000000, 1.000000, 3.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 1.000000, 3.000000, 0.000000}, -0.003920, {0.000000, 0.000000, -0.220000, -0.230000, -1.520000, 0.000000}},
-{{1.000000, 1.000000, 4.000000, 0.000000}, -0.000270, {0.000000, 0.000000, -0.020000, 0.000000, -0.100000, 0.000000}},
-{{1.000000, 2.000000, -4.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, -3.000000, 0.000000}, 0.000280, {0.000000, 0.000000, 0.000000, 0.030000, 0.110000, 0.000000}},
-{{1.000000, 2.000000, -2.000000, 0.000000}, 0.003240, {0.140000, 0.000000, 0.120000, 0.390000, 1.260000, 0.000000}},
-{{1.000000, 2.000000, -1.000000, 0.000000}, 0.004380, {0.140000, 0.000000, 0.080000, 0.520000, 1.700000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, 0.000000, 0.000000}, 0.037290, {0.600000, -0.030000, 0.070000, 4.470000, 14.500000, -0.080000}},
-{{1.000000, 2.000000, 1.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{1.000000, 2.000000, 1.000000, 0.000000}, 0.006460, {0.120000, 0.000000, 0.130000, 0.770000, 2.510000, 0.000000}},
-{{1.000000, 2.000000, 2.000000, 0.000000}, 0.000670, {0.000000, 0.000000, 0.030000, 0.080000, 0.260000, 0.000000}},
-{{1.000000, 2.000000, 3.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, 3.000000, -2.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{1.000000, 3.000000, -1.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{1.000000, 3.000000, 0.000000, 0.000000}, 0.000540, {0.000000, 0.000000, 0.000000, 0.100000, 0.210000, 0.000000}},
-{{1.000000, 3.000000, 1.000000, 0.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{2.000000, -6.000000, 0.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, -1.000000, 0.000000}, -0.000120, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 0.000000, 0.000000}, -0.000580, {-0.030000, 0.000000, 0.000000, -0.170000, 0.000000, 0.000000}},
-{{2.000000, -5.000000, 1.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -2.000000, 0.000000}, 0.000360, {0.000000, 0.000000, 0.000000, 0.090000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, -1.000000, 0.000000}, -0.004260, {-0.080000, 0.000000, -0.080000, -1.020000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 0.000000, 0.000000}, -0.015780, {-0.660000, 0.000000, 0.000000, -3.780000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 1.000000, 0.000000}, -0.001130, {-0.050000, 0.000000, -0.020000, -0.270000, 0.000000, 0.000000}},
-{{2.000000, -4.000000, 2.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -4.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -3.000000, 0.000000}, 0.000460, {0.000000, 0.000000, 0.020000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, 0.000000}, 0.011160, {0.260000, 0.000000, 0.410000, 2.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -2.000000, 2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, -2.000000}, 0.000260, {0.000000, 0.000000, 0.000000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 0.000000}, -0.148080, {-2.640000, 0.030000, -2.710000, -26.580000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, -1.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, -2.000000}, 0.001040, {0.030000, 0.050000, 0.000000, 0.190000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 0.000000, 0.000000}, -0.410760, {-15.670000, 0.090000, -0.510000, -73.710000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, -2.000000}, 0.000270, {0.000000, 0.000000, 0.000000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 1.000000, 0.000000}, -0.028550, {-1.200000, 0.000000, -0.560000, -5.120000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 2.000000, 0.000000}, -0.002090, {-0.100000, 0.000000, -0.080000, -0.380000, 0.000000, 0.000000}},
-{{2.000000, -3.000000, 3.000000, 0.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -5.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -4.000000, 0.000000}, 0.000670, {0.000000, 0.000000, 0.050000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -3.000000, 0.000000}, 0.015170, {0.230000, 0.000000, 0.830000, 1.810000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, -2.000000}, 0.000410, {0.000000, 0.000000, 0.000000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 0.000000}, 0.343040, {6.870000, -0.030000, 12.500000, 41.040000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -2.000000, 2.000000}, 0.000990, {0.000000, 0.040000, 0.040000, 0.120000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, -2.000000}, 0.009570, {0.130000, 0.430000, 0.170000, 1.150000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 0.000000}, -4.950490, {-84.900000, 0.910000, -90.350000, -592.240000, 0.030000, 0.000000}},
-{{2.000000, -2.000000, -1.000000, 2.000000}, 0.001680, {0.040000, 0.080000, 0.040000, 0.200000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, -2.000000}, 0.028390, {0.780000, 1.270000, -0.110000, 3.400000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 0.000000, 0.000000}, -9.885190, {-346.350000, 1.990000, -14.480000, -1182.310000, 0.070000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, -2.000000}, 0.007920, {0.090000, 0.360000, 0.140000, 0.950000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 1.000000, 0.000000}, -0.657580, {-25.020000, 0.180000, -13.070000, -78.640000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, -2.000000}, 0.000840, {0.020000, 0.040000, 0.030000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 2.000000, 0.000000}, -0.046080, {-1.860000, 0.000000, -1.760000, -5.510000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, -2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 3.000000, 0.000000}, -0.003350, {-0.140000, 0.000000, -0.190000, -0.400000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 4.000000, 0.000000}, -0.000250, {0.000000, 0.000000, -0.020000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, -2.000000, 5.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -6.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -5.000000, 0.000000}, 0.001190, {0.000000, 0.000000, 0.110000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -4.000000, 0.000000}, 0.023340, {0.280000, 0.000000, 1.700000, 1.400000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, -2.000000}, 0.000790, {0.000000, 0.040000, 0.040000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 0.000000}, 0.495060, {7.680000, 0.000000, 27.040000, 29.620000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -3.000000, 2.000000}, -0.000460, {0.000000, -0.020000, -0.020000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, -2.000000}, 0.015180, {0.170000, 0.680000, 0.540000, 0.910000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 0.000000}, 10.056540, {188.870000, -1.290000, 366.360000, 601.570000, -0.030000, 0.000000}},
-{{2.000000, -1.000000, -2.000000, 2.000000}, 0.030240, {0.360000, 1.360000, 1.100000, 1.810000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, -2.000000}, 0.323360, {4.560000, 14.420000, 5.730000, 19.340000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 0.000000}, -152.143140, {-2564.200000, 30.400000, -2771.740000, -9097.840000, 0.060000, 0.000000}},
-{{2.000000, -1.000000, -1.000000, 2.000000}, 0.037340, {0.840000, 1.680000, 0.850000, 2.230000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -4.000000}, -0.000350, {0.000000, -0.030000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, -2.000000}, 0.657100, {17.830000, 29.300000, -2.920000, 39.260000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 0.000000}, -204.593570, {-6583.800000, 38.790000, -377.950000, -12225.820000, 0.270000, 0.000000}},
-{{2.000000, -1.000000, 0.000000, 2.000000}, 0.001080, {-0.090000, 0.050000, 0.210000, 0.060000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -4.000000}, -0.000850, {0.000000, -0.080000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, -2.000000}, 0.209420, {1.810000, 9.460000, 3.820000, 12.500000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 0.000000}, -12.831850, {-434.140000, 2.980000, -260.020000, -766.510000, 0.020000, 0.000000}},
-{{2.000000, -1.000000, 1.000000, 2.000000}, 0.000000, {0.000000, 0.000000, 0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -4.000000}, 0.000130, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, -2.000000}, 0.018040, {0.340000, 0.810000, 0.660000, 1.080000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 2.000000, 0.000000}, -0.848830, {-29.750000, 0.220000, -32.800000, -50.680000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, -2.000000}, 0.001270, {0.030000, 0.060000, 0.070000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 3.000000, 0.000000}, -0.058500, {-2.100000, 0.000000, -3.330000, -3.490000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, -2.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 4.000000, 0.000000}, -0.004130, {-0.150000, 0.000000, -0.310000, -0.250000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 5.000000, 0.000000}, -0.000300, {0.000000, 0.000000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, -1.000000, 6.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -7.000000, 0.000000}, 0.000200, {0.000000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -6.000000, 0.000000}, 0.003040, {0.060000, 0.000000, 0.330000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, -2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, 0.000000}, 0.047400, {0.930000, 0.000000, 4.320000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -5.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, -2.000000}, 0.001880, {0.030000, 0.080000, 0.140000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 0.000000}, 0.778540, {15.430000, -0.130000, 56.710000, 0.050000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -4.000000, 2.000000}, 0.000480, {0.020000, 0.020000, 0.040000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, -2.000000}, 0.029100, {0.440000, 1.300000, 1.570000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 0.000000}, 14.402620, {282.850000, -2.350000, 786.990000, 0.580000, 0.140000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 2.000000}, -0.020080, {-0.430000, -0.890000, -1.090000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -3.000000, 4.000000}, -0.000180, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -4.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, -2.000000}, 0.472630, {7.200000, 21.060000, 16.920000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 0.000000}, 246.157680, {4806.360000, -51.780000, 8962.910000, -0.430000, 1.110000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 2.000000}, 0.774050, {9.680000, 34.650000, 28.170000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -2.000000, 4.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -4.000000}, -0.000390, {0.000000, -0.040000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, -2.000000}, 8.751700, {133.450000, 390.010000, 155.980000, -0.280000, 0.200000, 0.000000}},
-{{2.000000, 0.000000, -1.000000, 0.000000}, -3699.104680, {-63127.050000, 818.000000, -67236.740000, 147.860000, -15.950000, 0.140000}},
-{{2.000000, 0.000000, -1.000000, 2.000000}, 0.596330, {12.130000, 26.760000, 14.460000, -0.080000, 0.030000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -4.000000}, -0.007450, {-0.110000, -0.670000, -0.100000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, -2.000000}, 10.321290, {282.080000, 460.160000, -60.760000, -1.290000, 0.060000, 0.000000}},
-{{2.000000, 0.000000, 0.000000, 0.000000}, -2955.966510, {-86674.510000, 507.990000, -7597.690000, 323.540000, -19.090000, 0.140000}},
-{{2.000000, 0.000000, 0.000000, 2.000000}, 0.031430, {-0.690000, 1.430000, 2.990000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -4.000000}, -0.018660, {-0.110000, -1.670000, -0.330000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, -2.000000}, 4.131180, {20.860000, 186.870000, 75.090000, -0.760000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 0.000000}, -170.732740, {-4963.300000, 29.720000, -3579.160000, 26.820000, -1.820000, 0.000000}},
-{{2.000000, 0.000000, 1.000000, 2.000000}, 0.001810, {-0.120000, 0.080000, 0.320000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -4.000000}, 0.002190, {0.000000, 0.200000, 0.080000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, -2.000000}, 0.283990, {2.900000, 12.830000, 10.350000, -0.060000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 0.000000}, -10.444720, {-300.480000, 1.810000, -410.750000, 2.240000, -0.170000, 0.000000}},
-{{2.000000, 0.000000, 2.000000, 2.000000}, 0.000140, {0.000000, 0.000000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -4.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, -2.000000}, 0.018110, {0.190000, 0.820000, 0.990000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 3.000000, 0.000000}, -0.669680, {-19.020000, 0.120000, -38.590000, 0.190000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, -2.000000}, 0.001190, {0.000000, 0.050000, 0.090000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 4.000000, 0.000000}, -0.044220, {-1.240000, 0.000000, -3.360000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, -2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 5.000000, 0.000000}, -0.002980, {-0.080000, 0.000000, -0.280000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 0.000000, 6.000000, 0.000000}, -0.000200, {0.000000, 0.000000, -0.020000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -6.000000, 0.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -5.000000, 0.000000}, 0.001160, {0.080000, 0.000000, 0.110000, 0.070000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -4.000000, 0.000000}, 0.014170, {1.080000, 0.000000, 1.030000, 0.850000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, -2.000000}, 0.000210, {0.020000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, 0.000000}, 0.168580, {15.790000, -0.240000, 9.160000, 10.170000, 0.050000, 0.000000}},
-{{2.000000, 1.000000, -3.000000, 2.000000}, 0.000300, {0.000000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, -2.000000}, 0.000520, {0.270000, 0.020000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 0.000000}, 0.143680, {122.130000, -1.910000, 4.580000, 9.230000, 0.130000, 0.000000}},
-{{2.000000, 1.000000, -2.000000, 2.000000}, -0.002030, {0.310000, -0.100000, -0.080000, -0.120000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, -2.000000}, -0.047360, {2.580000, -2.160000, -0.890000, -2.820000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 0.000000}, 24.209350, {-837.260000, 13.300000, 449.340000, 1443.450000, 0.260000, 0.000000}},
-{{2.000000, 1.000000, -1.000000, 2.000000}, -0.005880, {-0.100000, -0.260000, -0.140000, -0.350000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -4.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, -2.000000}, -0.135720, {-4.940000, -6.040000, 0.540000, -8.130000, 0.030000, 0.000000}},
-{{2.000000, 1.000000, 0.000000, 0.000000}, 30.824980, {873.360000, -8.400000, 94.400000, 1844.570000, 3.860000, -0.020000}},
-{{2.000000, 1.000000, 0.000000, 2.000000}, -0.001430, {-0.040000, -0.060000, -0.040000, -0.090000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -4.000000}, 0.000400, {0.000000, 0.040000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, -2.000000}, -0.055270, {1.020000, -2.520000, -1.020000, -3.290000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 0.000000}, 2.616500, {90.880000, -1.010000, 56.020000, 156.640000, 0.490000, 0.000000}},
-{{2.000000, 1.000000, 1.000000, 2.000000}, -0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, -4.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, -2.000000}, -0.005370, {-0.030000, -0.240000, -0.200000, -0.320000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 2.000000, 0.000000}, 0.212520, {8.110000, -0.090000, 8.450000, 12.720000, 0.050000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, -2.000000}, -0.000440, {0.000000, -0.020000, -0.020000, -0.030000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 3.000000, 0.000000}, 0.017040, {0.680000, 0.000000, 0.990000, 1.020000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 4.000000, 0.000000}, 0.001350, {0.060000, 0.000000, 0.100000, 0.080000, 0.000000, 0.000000}},
-{{2.000000, 1.000000, 5.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -4.000000, 0.000000}, -0.000410, {0.000000, 0.000000, -0.030000, -0.050000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -3.000000, 0.000000}, -0.010360, {-0.290000, 0.000000, -0.580000, -1.250000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, -2.000000}, -0.000550, {0.000000, -0.020000, -0.020000, -0.070000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 0.000000}, -0.108880, {-2.720000, 0.000000, -3.960000, -13.050000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -2.000000, 2.000000}, -0.000460, {0.000000, -0.020000, 0.000000, -0.060000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, -2.000000}, -0.010720, {-0.370000, -0.470000, -0.170000, -1.280000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 0.000000}, 2.353800, {79.520000, -0.720000, 42.860000, 282.050000, -0.060000, 0.000000}},
-{{2.000000, 2.000000, -1.000000, 2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, -2.000000}, 0.000800, {0.020000, 0.040000, 0.040000, 0.100000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 0.000000, 0.000000}, 0.147640, {4.880000, -0.050000, 4.900000, 17.690000, -0.290000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, -2.000000}, 0.001870, {0.110000, 0.070000, 0.000000, 0.220000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 1.000000, 0.000000}, 0.009120, {0.290000, 0.000000, 0.460000, 1.090000, -0.040000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, -2.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 2.000000, 2.000000, 0.000000}, 0.000360, {0.000000, 0.000000, 0.030000, 0.040000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -3.000000, 0.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -2.000000, 0.000000}, -0.000520, {-0.020000, 0.000000, -0.020000, -0.090000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, -1.000000, 0.000000}, 0.002080, {0.140000, 0.000000, 0.030000, 0.370000, 0.000000, 0.000000}},
-{{2.000000, 3.000000, 0.000000, 0.000000}, -0.000240, {-0.020000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{2.000000, 4.000000, -1.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -4.000000, -1.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -4.000000, 0.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -3.000000, -2.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{3.000000, -3.000000, -1.000000, 0.000000}, 0.000650, {0.030000, 0.000000, 0.000000, 0.120000, 0.250000, 0.000000}},
-{{3.000000, -3.000000, 0.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -3.000000, 0.000000, 0.000000}, -0.000550, {0.000000, 0.000000, 0.000000, -0.100000, -0.210000, 0.000000}},
-{{3.000000, -3.000000, 1.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -2.000000, -3.000000, 0.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{3.000000, -2.000000, -2.000000, 0.000000}, 0.002240, {0.030000, 0.000000, 0.080000, 0.270000, 0.870000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -2.000000, -1.000000, 0.000000}, 0.013890, {0.550000, 0.000000, 0.260000, 1.660000, 5.400000, -0.030000}},
-{{3.000000, -2.000000, 0.000000, -2.000000}, 0.000700, {0.000000, 0.030000, 0.000000, 0.080000, 0.270000, 0.000000}},
-{{3.000000, -2.000000, 0.000000, 0.000000}, -0.010480, {-0.230000, 0.000000, 0.040000, -1.250000, -4.070000, 0.020000}},
-{{3.000000, -2.000000, 1.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -2.000000, 1.000000, 0.000000}, -0.000670, {0.000000, 0.000000, 0.000000, -0.080000, -0.260000, 0.000000}},
-{{3.000000, -2.000000, 2.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, -4.000000, 0.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{3.000000, -1.000000, -3.000000, 0.000000}, -0.003340, {-0.050000, 0.000000, -0.180000, -0.200000, -1.300000, 0.000000}},
-{{3.000000, -1.000000, -2.000000, -2.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{3.000000, -1.000000, -2.000000, 0.000000}, 0.052930, {0.920000, 0.000000, 1.930000, 3.170000, 20.580000, -0.110000}},
-{{3.000000, -1.000000, -2.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, -2.000000}, -0.000890, {0.000000, -0.040000, 0.000000, -0.050000, -0.340000, 0.000000}},
-{{3.000000, -1.000000, -1.000000, 0.000000}, 0.255610, {9.610000, -0.150000, 4.830000, 15.240000, 99.380000, -0.520000}},
-{{3.000000, -1.000000, 0.000000, -2.000000}, 0.014410, {0.210000, 0.640000, 0.000000, 0.860000, 5.610000, -0.030000}},
-{{3.000000, -1.000000, 0.000000, 0.000000}, -0.157080, {-2.880000, -0.040000, 0.830000, -9.420000, -61.080000, 0.320000}},
-{{3.000000, -1.000000, 1.000000, -2.000000}, 0.000490, {0.000000, 0.020000, 0.000000, 0.030000, 0.190000, 0.000000}},
-{{3.000000, -1.000000, 1.000000, 0.000000}, -0.008870, {-0.030000, 0.000000, -0.090000, -0.540000, -3.450000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, -1.000000, 2.000000, 0.000000}, -0.000300, {0.000000, 0.000000, 0.000000, 0.000000, -0.120000, 0.000000}},
-{{3.000000, 0.000000, -5.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -4.000000, 0.000000}, -0.001700, {0.000000, 0.000000, -0.120000, 0.000000, -0.660000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, -3.000000, 0.000000}, -0.048430, {-0.720000, 0.000000, -2.650000, -0.030000, -18.830000, 0.100000}},
-{{3.000000, 0.000000, -3.000000, 2.000000}, -0.000130, {0.000000, 0.000000, 0.000000, 0.000000, -0.050000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, -2.000000}, -0.002060, {0.000000, -0.090000, -0.070000, 0.000000, -0.800000, 0.000000}},
-{{3.000000, 0.000000, -2.000000, 0.000000}, 0.862430, {16.640000, -0.340000, 31.480000, 0.130000, 335.340000, -1.770000}},
-{{3.000000, 0.000000, -2.000000, 2.000000}, -0.001010, {-0.030000, -0.040000, -0.040000, 0.000000, -0.390000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, -2.000000}, -0.008680, {0.000000, -0.390000, -0.140000, 0.000000, -3.380000, 0.000000}},
-{{3.000000, 0.000000, -1.000000, 0.000000}, 3.258230, {117.770000, -2.270000, 61.910000, -1.340000, 1266.880000, -6.680000}},
-{{3.000000, 0.000000, -1.000000, 2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, -4.000000}, -0.000180, {0.000000, 0.000000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{3.000000, 0.000000, 0.000000, -2.000000}, 0.200990, {2.460000, 8.950000, -0.040000, -0.070000, 78.150000, -0.410000}},
-{{3.000000, 0.000000, 0.000000, 0.000000}, -1.418930, {-19.430000, -0.690000, 10.760000, -0.630000, -551.710000, 2.910000}},
-{{3.000000, 0.000000, 0.000000, 2.000000}, -0.000150, {0.000000, 0.000000, 0.000000, 0.000000, -0.060000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, -2.000000}, 0.006710, {0.020000, 0.300000, 0.120000, 0.000000, 2.610000, 0.000000}},
-{{3.000000, 0.000000, 1.000000, 0.000000}, -0.065450, {0.720000, -0.100000, -0.320000, -0.110000, -25.450000, 0.130000}},
-{{3.000000, 0.000000, 1.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, -2.000000}, 0.000350, {0.000000, 0.000000, 0.000000, 0.000000, 0.140000, 0.000000}},
-{{3.000000, 0.000000, 2.000000, 0.000000}, -0.001110, {0.210000, 0.000000, 0.030000, 0.000000, -0.430000, 0.000000}},
-{{3.000000, 0.000000, 3.000000, 0.000000}, 0.000160, {0.030000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{3.000000, 0.000000, 4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -5.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -4.000000, 0.000000}, -0.000650, {-0.030000, 0.000000, -0.050000, -0.040000, -0.250000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, 0.000000}, -0.006800, {-0.290000, 0.000000, -0.370000, -0.410000, -2.640000, 0.000000}},
-{{3.000000, 1.000000, -3.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, -2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, -0.040000, 0.000000}},
-{{3.000000, 1.000000, -2.000000, 0.000000}, 0.038100, {2.030000, 0.000000, 1.370000, 2.290000, 14.820000, -0.080000}},
-{{3.000000, 1.000000, -2.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, -2.000000}, -0.000230, {0.000000, 0.000000, 0.000000, 0.000000, -0.090000, 0.000000}},
-{{3.000000, 1.000000, -1.000000, 0.000000}, -0.212590, {-4.000000, 0.170000, -4.030000, -12.700000, -82.660000, 0.440000}},
-{{3.000000, 1.000000, -1.000000, 2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{3.000000, 1.000000, 0.000000, -2.000000}, -0.008080, {-0.120000, -0.360000, 0.000000, -0.480000, -3.140000, 0.000000}},
-{{3.000000, 1.000000, 0.000000, 0.000000}, -0.107660, {-3.220000, 0.120000, -1.090000, -6.420000, -41.860000, 0.220000}},
-{{3.000000, 1.000000, 1.000000, -2.000000}, -0.000180, {0.000000, 0.000000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{3.000000, 1.000000, 1.000000, 0.000000}, -0.014480, {-0.440000, 0.000000, -0.370000, -0.860000, -5.630000, 0.030000}},
-{{3.000000, 1.000000, 2.000000, 0.000000}, -0.001500, {-0.050000, 0.000000, -0.070000, -0.090000, -0.580000, 0.000000}},
-{{3.000000, 1.000000, 3.000000, 0.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, -0.060000, 0.000000}},
-{{3.000000, 2.000000, -3.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{3.000000, 2.000000, -2.000000, 0.000000}, 0.000320, {0.050000, 0.000000, 0.000000, 0.040000, 0.120000, 0.000000}},
-{{3.000000, 2.000000, -1.000000, 0.000000}, 0.000990, {-0.050000, 0.000000, 0.020000, 0.120000, 0.390000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, -2.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.020000, 0.040000, 0.000000}},
-{{3.000000, 2.000000, 0.000000, 0.000000}, 0.001620, {0.040000, 0.000000, 0.000000, 0.190000, 0.630000, 0.000000}},
-{{3.000000, 2.000000, 1.000000, 0.000000}, 0.000280, {0.000000, 0.000000, 0.000000, 0.030000, 0.110000, 0.000000}},
-{{3.000000, 2.000000, 2.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 3.000000, -2.000000, -2.000000}, 0.000000, {-0.030000, 0.000000, -0.030000, 0.000000, -0.070000, 0.000000}},
-{{3.000000, 3.000000, -2.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{3.000000, 3.000000, -1.000000, 0.000000}, 0.000100, {0.000000, 0.000000, 0.000000, 0.020000, 0.040000, 0.000000}},
-{{3.000000, 3.000000, 0.000000, -2.000000}, 0.000020, {0.080000, -0.060000, 0.070000, 0.080000, -0.050000, 0.000000}},
-{{4.000000, -5.000000, -1.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -5.000000, 0.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -2.000000, 0.000000}, -0.000220, {0.000000, 0.000000, 0.000000, -0.050000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, -1.000000, 0.000000}, -0.000780, {-0.050000, 0.000000, 0.000000, -0.190000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 0.000000, 0.000000}, -0.000450, {-0.030000, 0.000000, 0.000000, -0.110000, 0.000000, 0.000000}},
-{{4.000000, -4.000000, 1.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -3.000000, 0.000000}, -0.000110, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -2.000000, 0.000000}, -0.005130, {-0.220000, 0.000000, -0.190000, -0.920000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, -2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, -1.000000, 0.000000}, -0.015710, {-0.870000, 0.000000, -0.310000, -2.820000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, -2.000000}, -0.000220, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 0.000000, 0.000000}, -0.008170, {-0.540000, 0.000000, -0.080000, -1.470000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 1.000000, 0.000000}, -0.001140, {-0.080000, 0.000000, -0.030000, -0.210000, 0.000000, 0.000000}},
-{{4.000000, -3.000000, 2.000000, 0.000000}, -0.000130, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -5.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -4.000000, 0.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, 0.000000}, -0.002390, {-0.120000, 0.000000, -0.130000, -0.290000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -3.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, -2.000000}, -0.000360, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 0.000000}, -0.108340, {-4.380000, 0.040000, -3.950000, -12.960000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -2.000000, 2.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, -2.000000}, -0.001450, {-0.040000, -0.060000, -0.030000, -0.170000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 0.000000}, -0.279060, {-14.760000, 0.110000, -5.610000, -33.360000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, -1.000000, 2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, -2.000000}, -0.004030, {-0.180000, -0.180000, 0.000000, -0.480000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 0.000000, 0.000000}, -0.128060, {-8.090000, 0.050000, -1.350000, -15.300000, -0.020000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, -2.000000}, 0.000230, {0.000000, 0.000000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 1.000000, 0.000000}, -0.017280, {-1.130000, 0.000000, -0.450000, -2.060000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, -2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 2.000000, 0.000000}, -0.001840, {-0.120000, 0.000000, -0.080000, -0.220000, 0.000000, 0.000000}},
-{{4.000000, -2.000000, 3.000000, 0.000000}, -0.000180, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -6.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -5.000000, 0.000000}, -0.000410, {0.000000, 0.000000, -0.040000, -0.020000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -4.000000, 0.000000}, -0.002300, {-0.060000, 0.000000, -0.170000, -0.140000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, -2.000000}, -0.000590, {-0.020000, -0.030000, -0.030000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 0.000000}, -0.043160, {-2.190000, 0.020000, -2.360000, -2.590000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -3.000000, 2.000000}, 0.000770, {0.020000, 0.030000, 0.040000, 0.050000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, -2.000000}, -0.006610, {-0.250000, -0.290000, -0.240000, -0.400000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 0.000000}, -1.897100, {-73.130000, 0.790000, -69.170000, -113.340000, -0.120000, 0.000000}},
-{{4.000000, -1.000000, -2.000000, 2.000000}, 0.001600, {0.070000, 0.070000, 0.060000, 0.100000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -4.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, -2.000000}, -0.026980, {-0.670000, -1.200000, -0.500000, -1.610000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 0.000000}, -3.958120, {-199.780000, 1.540000, -80.750000, -236.160000, 0.150000, 0.000000}},
-{{4.000000, -1.000000, -1.000000, 2.000000}, 0.000690, {0.030000, 0.030000, 0.030000, 0.040000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -4.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, -2.000000}, -0.057890, {-2.540000, -2.570000, 0.140000, -3.440000, -0.020000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 0.000000}, -1.571450, {-94.020000, 0.590000, -18.480000, -93.650000, -0.260000, 0.000000}},
-{{4.000000, -1.000000, 0.000000, 2.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -4.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, -2.000000}, 0.002720, {0.120000, 0.120000, 0.070000, 0.160000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 1.000000, 0.000000}, -0.202860, {-12.450000, 0.080000, -5.510000, -12.080000, -0.030000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, -2.000000}, 0.000550, {0.020000, 0.020000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 2.000000, 0.000000}, -0.020790, {-1.290000, 0.000000, -0.920000, -1.240000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, -2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 3.000000, 0.000000}, -0.001940, {-0.120000, 0.000000, -0.120000, -0.120000, 0.000000, 0.000000}},
-{{4.000000, -1.000000, 4.000000, 0.000000}, -0.000170, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -7.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -6.000000, 0.000000}, -0.000550, {-0.020000, 0.000000, -0.060000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -5.000000, -2.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -5.000000, 0.000000}, -0.005420, {-0.210000, 0.000000, -0.490000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, -2.000000}, -0.000720, {-0.030000, -0.030000, -0.050000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 0.000000}, -0.029390, {-0.870000, 0.000000, -2.140000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -4.000000, 2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, -2.000000}, -0.007440, {-0.270000, -0.330000, -0.410000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 0.000000}, -0.514230, {-25.810000, 0.280000, -28.100000, -0.190000, -0.150000, 0.000000}},
-{{4.000000, 0.000000, -3.000000, 2.000000}, 0.009250, {0.290000, 0.410000, 0.500000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -4.000000}, -0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, -2.000000}, -0.079820, {-2.910000, -3.540000, -2.910000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 0.000000}, -21.636270, {-808.810000, 9.470000, -788.010000, 2.770000, -1.210000, 0.000000}},
-{{4.000000, 0.000000, -2.000000, 2.000000}, 0.014830, {0.600000, 0.660000, 0.610000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -4.000000}, -0.000800, {-0.020000, -0.070000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, -2.000000}, -0.321760, {-7.980000, -14.290000, -5.950000, 0.150000, -0.110000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 0.000000}, -34.782450, {-1678.730000, 13.500000, -725.230000, 8.970000, 0.880000, 0.000000}},
-{{4.000000, 0.000000, -1.000000, 2.000000}, 0.005500, {0.250000, 0.250000, 0.210000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -4.000000}, 0.000320, {0.000000, 0.030000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, -2.000000}, -0.507930, {-21.440000, -22.550000, 1.370000, 0.280000, -0.170000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 0.000000}, -11.649930, {-657.420000, 4.130000, -155.600000, 4.420000, -2.170000, 0.000000}},
-{{4.000000, 0.000000, 0.000000, 2.000000}, 0.000670, {0.020000, 0.030000, 0.050000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -4.000000}, 0.000500, {0.000000, 0.040000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, -2.000000}, 0.019380, {0.760000, 0.890000, 0.570000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 0.000000}, -1.422550, {-81.300000, 0.500000, -40.470000, 0.680000, -0.210000, 0.000000}},
-{{4.000000, 0.000000, 1.000000, 2.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, -2.000000}, 0.004000, {0.160000, 0.180000, 0.170000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 2.000000, 0.000000}, -0.139220, {-7.970000, 0.050000, -6.330000, 0.080000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, -2.000000}, 0.000440, {0.000000, 0.020000, 0.030000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 3.000000, 0.000000}, -0.012430, {-0.710000, 0.000000, -0.780000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 4.000000, 0.000000}, -0.001060, {-0.060000, 0.000000, -0.090000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 0.000000, 5.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -5.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -4.000000, 0.000000}, 0.000930, {0.050000, 0.000000, 0.070000, 0.060000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, 0.000000}, -0.023990, {-2.480000, 0.030000, -1.300000, -1.430000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -3.000000, 2.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, -2.000000}, 0.000360, {-0.050000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 0.000000}, 0.236960, {-7.250000, 0.120000, 8.690000, 14.250000, 0.020000, 0.000000}},
-{{4.000000, 1.000000, -2.000000, 2.000000}, -0.000220, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, -2.000000}, 0.015510, {0.500000, 0.690000, 0.290000, 0.920000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 0.000000}, 0.578810, {16.490000, -0.100000, 12.270000, 34.720000, 0.130000, 0.000000}},
-{{4.000000, 1.000000, -1.000000, 2.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, -2.000000}, 0.019690, {0.950000, 0.870000, 0.000000, 1.180000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 0.000000}, 0.244530, {12.940000, -0.100000, 3.440000, 14.630000, 0.040000, 0.000000}},
-{{4.000000, 1.000000, 0.000000, 2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -4.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, -2.000000}, 0.000130, {0.030000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 1.000000, 0.000000}, 0.036820, {2.170000, -0.020000, 1.070000, 2.200000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, -2.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 2.000000, 0.000000}, 0.004300, {0.270000, 0.000000, 0.200000, 0.260000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 3.000000, 0.000000}, 0.000450, {0.030000, 0.000000, 0.030000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, 1.000000, 4.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -4.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -3.000000, 0.000000}, 0.002520, {0.170000, 0.000000, 0.140000, 0.300000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, -2.000000}, 0.000210, {0.000000, 0.000000, 0.000000, 0.030000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -2.000000, 0.000000}, 0.026580, {1.570000, 0.000000, 0.970000, 3.180000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, -2.000000}, -0.000640, {-0.040000, -0.030000, 0.000000, -0.080000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, -1.000000, 0.000000}, 0.018680, {1.310000, 0.000000, 0.450000, 2.240000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, -2.000000}, 0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 0.000000, 0.000000}, 0.001360, {0.110000, 0.000000, 0.090000, 0.160000, 0.000000, 0.000000}},
-{{4.000000, 2.000000, 1.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -2.000000, 0.000000}, -0.000150, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, -1.000000, 0.000000}, -0.000200, {0.000000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{4.000000, 3.000000, 0.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -3.000000, -2.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, -3.000000, 0.000000}, 0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{5.000000, -2.000000, -2.000000, 0.000000}, 0.000440, {0.030000, 0.000000, 0.000000, 0.050000, 0.170000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, -2.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -2.000000, -1.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, -2.000000, 0.000000, 0.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, -0.060000, 0.000000}},
-{{5.000000, -2.000000, 1.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -3.000000, 0.000000}, 0.001280, {0.060000, 0.000000, 0.070000, 0.080000, 0.500000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, -2.000000, 0.000000}, 0.005730, {0.320000, 0.000000, 0.220000, 0.340000, 2.230000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, -2.000000}, 0.000340, {0.000000, 0.000000, 0.000000, 0.020000, 0.130000, 0.000000}},
-{{5.000000, -1.000000, -1.000000, 0.000000}, -0.000560, {0.070000, 0.000000, 0.020000, -0.040000, -0.220000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, -2.000000}, 0.000210, {0.000000, 0.000000, 0.000000, 0.000000, 0.080000, 0.000000}},
-{{5.000000, -1.000000, 0.000000, 0.000000}, -0.001530, {-0.060000, 0.000000, 0.000000, -0.090000, -0.600000, 0.000000}},
-{{5.000000, -1.000000, 1.000000, -2.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, -1.000000, 1.000000, 0.000000}, -0.000190, {0.000000, 0.000000, 0.000000, 0.000000, -0.070000, 0.000000}},
-{{5.000000, 0.000000, -4.000000, 0.000000}, 0.000260, {0.000000, 0.000000, 0.020000, 0.000000, 0.100000, 0.000000}},
-{{5.000000, 0.000000, -3.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, -3.000000, 0.000000}, 0.011490, {0.490000, 0.000000, 0.630000, 0.000000, 4.470000, -0.020000}},
-{{5.000000, 0.000000, -3.000000, 2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 0.000000, -2.000000, -2.000000}, 0.000300, {0.000000, 0.000000, 0.000000, 0.000000, 0.120000, 0.000000}},
-{{5.000000, 0.000000, -2.000000, 0.000000}, 0.045910, {2.500000, -0.040000, 1.730000, -0.030000, 17.850000, -0.090000}},
-{{5.000000, 0.000000, -1.000000, -2.000000}, 0.002810, {0.100000, 0.120000, 0.050000, 0.000000, 1.090000, 0.000000}},
-{{5.000000, 0.000000, -1.000000, 0.000000}, -0.002480, {0.570000, -0.020000, 0.220000, -0.040000, -0.960000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, -2.000000}, 0.001420, {0.070000, 0.060000, 0.000000, 0.000000, 0.550000, 0.000000}},
-{{5.000000, 0.000000, 0.000000, 0.000000}, -0.008140, {-0.250000, 0.000000, 0.070000, 0.000000, -3.170000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, -2.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.000000, 0.080000, 0.000000}},
-{{5.000000, 0.000000, 1.000000, 0.000000}, -0.000890, {0.000000, 0.000000, 0.000000, 0.000000, -0.350000, 0.000000}},
-{{5.000000, 0.000000, 2.000000, 0.000000}, -0.000060, {0.000000, 0.000000, 0.000000, 0.000000, -0.020000, 0.000000}},
-{{5.000000, 1.000000, -4.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 1.000000, -3.000000, 0.000000}, 0.000380, {0.040000, 0.000000, 0.020000, 0.020000, 0.150000, 0.000000}},
-{{5.000000, 1.000000, -2.000000, 0.000000}, -0.002560, {-0.070000, 0.000000, -0.100000, -0.150000, -1.000000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, -2.000000}, -0.000150, {0.000000, 0.000000, 0.000000, 0.000000, -0.060000, 0.000000}},
-{{5.000000, 1.000000, -1.000000, 0.000000}, -0.003110, {-0.160000, 0.000000, -0.080000, -0.190000, -1.210000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, -2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{5.000000, 1.000000, 0.000000, 0.000000}, -0.001110, {-0.070000, 0.000000, -0.030000, -0.070000, -0.430000, 0.000000}},
-{{5.000000, 1.000000, 1.000000, 0.000000}, -0.000200, {0.000000, 0.000000, 0.000000, 0.000000, -0.080000, 0.000000}},
-{{5.000000, 1.000000, 2.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{5.000000, 2.000000, -1.000000, 0.000000}, 0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.030000, 0.000000}},
-{{5.000000, 2.000000, 0.000000, 0.000000}, 0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -4.000000, -2.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -4.000000, -1.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -3.000000, 0.000000}, -0.000120, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -2.000000, 0.000000}, -0.000440, {-0.030000, 0.000000, 0.000000, -0.080000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, -1.000000, 0.000000}, -0.000430, {-0.040000, 0.000000, 0.000000, -0.080000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 0.000000, 0.000000}, -0.000170, {0.000000, 0.000000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, -3.000000, 1.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -4.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -3.000000, 0.000000}, -0.001950, {-0.120000, 0.000000, -0.110000, -0.230000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -2.000000, 0.000000}, -0.006180, {-0.440000, 0.000000, -0.240000, -0.740000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, -2.000000}, -0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, -1.000000, 0.000000}, -0.005410, {-0.440000, 0.000000, -0.140000, -0.650000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, -2.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 0.000000, 0.000000}, -0.001940, {-0.170000, 0.000000, -0.040000, -0.230000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 1.000000, 0.000000}, -0.000350, {-0.030000, 0.000000, 0.000000, -0.040000, 0.000000, 0.000000}},
-{{6.000000, -2.000000, 2.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -4.000000, 0.000000}, -0.000850, {-0.060000, 0.000000, -0.060000, -0.050000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, -2.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 0.000000}, -0.024360, {-1.430000, 0.000000, -1.330000, -1.450000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -3.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, -2.000000}, -0.000410, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 0.000000}, -0.066780, {-4.610000, 0.040000, -2.600000, -3.980000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -2.000000, 2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, -2.000000}, -0.001210, {-0.070000, -0.050000, -0.020000, -0.070000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, -1.000000, 0.000000}, -0.051910, {-4.100000, 0.030000, -1.420000, -3.090000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, -2.000000}, -0.000490, {-0.040000, -0.020000, 0.000000, -0.030000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 0.000000, 0.000000}, -0.017090, {-1.470000, 0.000000, -0.420000, -1.010000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 1.000000, 0.000000}, -0.002960, {-0.260000, 0.000000, -0.110000, -0.180000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 2.000000, 0.000000}, -0.000390, {-0.040000, 0.000000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{6.000000, -1.000000, 3.000000, 0.000000}, -0.000050, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -5.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 0.000000}, -0.006590, {-0.450000, 0.000000, -0.480000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -4.000000, 2.000000}, 0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, -2.000000}, -0.000270, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 0.000000}, -0.183160, {-10.480000, 0.120000, -10.020000, 0.050000, -0.020000, 0.000000}},
-{{6.000000, 0.000000, -3.000000, 2.000000}, 0.000280, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, -2.000000}, -0.003260, {-0.130000, -0.140000, -0.120000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 0.000000}, -0.422500, {-28.360000, 0.260000, -16.580000, 0.190000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -2.000000, 2.000000}, 0.000200, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, -2.000000}, -0.007850, {-0.440000, -0.350000, -0.130000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 0.000000}, -0.286630, {-21.860000, 0.160000, -8.120000, 0.180000, -0.030000, 0.000000}},
-{{6.000000, 0.000000, -1.000000, 2.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -4.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, -2.000000}, -0.002700, {-0.190000, -0.120000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 0.000000, 0.000000}, -0.085870, {-7.100000, 0.050000, -2.250000, 0.070000, -0.020000, 0.000000}},
-{{6.000000, 0.000000, 1.000000, 0.000000}, -0.014200, {-1.200000, 0.000000, -0.550000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 2.000000, 0.000000}, -0.001820, {-0.160000, 0.000000, -0.100000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 3.000000, 0.000000}, -0.000200, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 0.000000, 4.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -4.000000, 0.000000}, -0.000240, {-0.040000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -3.000000, 0.000000}, 0.002780, {-0.060000, 0.000000, 0.150000, 0.170000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, -2.000000}, 0.000190, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -2.000000, 0.000000}, 0.009480, {0.350000, 0.000000, 0.370000, 0.570000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, -2.000000}, 0.000420, {0.030000, 0.000000, 0.000000, 0.020000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, -1.000000, 0.000000}, 0.007800, {0.490000, 0.000000, 0.220000, 0.470000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, -2.000000}, 0.000160, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 0.000000, 0.000000}, 0.002720, {0.210000, 0.000000, 0.070000, 0.160000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 1.000000, 0.000000}, 0.000520, {0.040000, 0.000000, 0.020000, 0.030000, 0.000000, 0.000000}},
-{{6.000000, 1.000000, 2.000000, 0.000000}, 0.000080, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -4.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -3.000000, 0.000000}, 0.000340, {0.030000, 0.000000, 0.020000, 0.040000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -2.000000, 0.000000}, 0.000440, {0.040000, 0.000000, 0.000000, 0.050000, 0.000000, 0.000000}},
-{{6.000000, 2.000000, -1.000000, 0.000000}, 0.000140, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -4.000000, 0.000000}, 0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, -1.000000, -3.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.040000, 0.000000}},
-{{7.000000, -1.000000, -2.000000, 0.000000}, 0.000060, {0.000000, 0.000000, 0.000000, 0.000000, 0.020000, 0.000000}},
-{{7.000000, -1.000000, -1.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -4.000000, 0.000000}, 0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.060000, 0.000000}},
-{{7.000000, 0.000000, -3.000000, 0.000000}, 0.000660, {0.050000, 0.000000, 0.040000, 0.000000, 0.260000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -2.000000, 0.000000}, 0.000320, {0.040000, 0.000000, 0.000000, 0.000000, 0.130000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, -2.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 0.000000, -1.000000, 0.000000}, -0.000080, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{7.000000, 0.000000, 0.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{7.000000, 1.000000, -3.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{7.000000, 1.000000, -2.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, -0.030000, 0.000000}},
-{{7.000000, 1.000000, -1.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -4.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -3.000000, 0.000000}, -0.000130, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -2.000000, 0.000000}, -0.000160, {0.000000, 0.000000, 0.000000, -0.020000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, -1.000000, 0.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -2.000000, 0.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -4.000000, 0.000000}, -0.000330, {-0.030000, 0.000000, -0.020000, -0.020000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -3.000000, 0.000000}, -0.001090, {-0.100000, 0.000000, -0.060000, -0.070000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -2.000000, 0.000000}, -0.001260, {-0.120000, 0.000000, -0.060000, -0.080000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, -1.000000, 0.000000}, -0.000700, {-0.080000, 0.000000, -0.030000, -0.040000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 0.000000, 0.000000}, -0.000220, {-0.020000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, -1.000000, 1.000000, 0.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -5.000000, 0.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -4.000000, 0.000000}, -0.001840, {-0.140000, 0.000000, -0.130000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, -2.000000}, -0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -3.000000, 0.000000}, -0.005390, {-0.460000, 0.000000, -0.310000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, -2.000000}, -0.000120, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -2.000000, 0.000000}, -0.005590, {-0.530000, 0.000000, -0.250000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, -2.000000}, -0.000090, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, -1.000000, 0.000000}, -0.002850, {-0.290000, 0.000000, -0.110000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, -2.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 0.000000, 0.000000}, -0.000830, {-0.090000, 0.000000, -0.030000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 1.000000, 0.000000}, -0.000160, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 0.000000, 2.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -4.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -3.000000, 0.000000}, 0.000150, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -2.000000, 0.000000}, 0.000190, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, -1.000000, 0.000000}, 0.000110, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{8.000000, 1.000000, 0.000000, 0.000000}, 0.000040, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -3.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, -1.000000, -2.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -5.000000, 0.000000}, -0.000020, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -4.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -3.000000, 0.000000}, -0.000100, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -2.000000, 0.000000}, -0.000070, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
-{{10.000000, 0.000000, -1.000000, 0.000000}, -0.000030, {0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000}},
+
+static const uint16_t arg[] = {
+0, 1, 3, 4, 7, 11, 16, 14, 12, 17,
+18, 20, 24, 8, 25, 32, 31, 26, 29, 34,
+40, 37, 39, 38, 22, 45, 47, 65, 33, 42,
+46, 49, 52, 79, 56, 66, 70, 10, 72, 76,
+75, 74, 87, 85, 83, 113, 100, 84, 50, 95,
+96, 103, 99, 124, 107, 129, 104, 114, 82, 43,
+119, 98, 163, 127, 130, 126, 125, 115, 145, 123,
+128, 156, 182, 144, 184, 155, 138, 132, 151, 174,
+198, 160, 142, 162, 159, 141, 161, 169, 216, 157,
+183, 137, 228, 171, 181, 77, 175, 180, 92, 189,
+195, 205, 170, 188, 190, 23, 201, 202, 277, 224,
+292, 281, 220, 210, 219, 302, 227, 229, 238, 245,
+313, 274, 240, 320, 246, 257, 234, 215, 326, 267,
+279, 134, 282, 269, 350, 315, 58, 337, 276, 365,
+222, 297, 248, 330, 272, 291, 363, 285, 314, 280,
+307, 283, 214, 298, 403, 406, 242, 352, 167, 336,
+415, 296, 309, 329, 324, 321, 316, 383, 355, 345,
+312, 367, 186, 334, 344, 331, 347, 395, 387, 338,
+357, 372, 420, 459, 472, 423, 490, 386, 370, 426,
+381, 498, 305, 503, 506, 419, 507, 429, 360, 512,
+404, 153, 235, 518, 165, 465, 405, 533, 375, 433,
+421, 436, 241, 447, 553, 431, 532, 179, 509, 441,
+435, 430, 440, 592, 593, 554, 452, 437, 446, 443,
+604, 418, 449, 488, 481, 556, 639, 454, 528, 529,
+499, 494, 470, 497, 515, 502, 542, 559, 496, 519,
+442, 606, 520, 526, 379, 473, 685, 690, 540, 517,
+698, 557, 630, 710, 714, 715, 550, 541, 567, 402,
+614, 545, 558, 548, 106, 543, 643, 368, 273, 625,
+586, 369, 758, 762, 564, 724, 566, 581, 773, 718,
+244, 671, 609, 595, 628, 599, 617, 804, 589, 637,
+644, 654, 678, 259, 522, 635, 645, 140, 615, 650,
+67, 555, 656, 688, 789, 829, 663, 805, 865, 629,
+641, 881, 677, 669, 893, 648, 328, 527, 737, 757,
+774, 657, 719, 896, 705, 727, 333, 226, 754, 725,
+925, 732, 696, 833, 794, 856, 748, 956, 868, 658,
+813, 694, 968, 967, 847, 764, 537, 743, 819, 761,
+985, 850, 912, 1001, 830, 871, 776, 853, 711, 759,
+608, 859, 822, 835, 785, 836, 1017, 940, 889, 869,
+709, 1022, 795, 432, 876, 231, 978, 955, 908, 800,
+1053, 924, 954, 862, 565, 844, 1051, 904, 864, 684,
+1068, 838, 796, 1069, 932, 500, 840, 275, 1084, 957,
+1007, 997, 563, 916, 909, 534, 866, 1064, 803, 148,
+831, 1032, 890, 977, 953, 917, 703, 860, 603, 920,
+1174, 948, 1141, 1026, 702, 1175, 938, 927, 898, 491,
+911, 1054, 934, 1016, 897, 266, 989, 972, 793, 1127,
+1225, 994, 1043, 905, 961, 949, 1186, 1100, 1009, 1254,
+970, 814, 999, 1137, 1169, 991, 722, 361, 1005, 524,
+1087, 992, 1050, 204, 570, 1147, 1031, 1283, 1284, 986,
+1324, 1060, 480, 1188, 634, 1052, 707, 616, 1325, 535,
+1071, 1326, 1142, 1049, 984, 1003, 576, 1039, 747, 1369,
+1077, 729, 1350, 1092, 983, 1025, 1133, 1248, 1116, 1073,
+1121, 1035, 1136, 1115, 1056, 1104, 1434, 1070, 1036, 1063,
+1385, 1152, 1421, 1435, 1173, 1253, 1062, 400, 951, 1143,
+1140, 1122, 791, 1202, 1082, 1431, 1437, 1523, 1318, 861,
+353, 1524, 1134, 1162, 1145, 826, 1252, 1311, 1047, 1278,
+1424, 1189, 1117, 1247, 1195, 1206, 1249, 1450, 1525, 1123,
+1207, 530, 1204, 1177, 290, 1199, 1320, 1042, 392, 670,
+1200, 1526, 1163, 1530, 1240, 1626, 1187, 1352, 653, 1241,
+1453, 1331, 1288, 1625, 1624, 1261, 1228, 1269, 1419, 317,
+1410, 1411, 1432, 930, 1258, 489, 1597, 1496, 1519, 1451,
+1376, 1179, 1456, 1260, 1627, 907, 770, 1262, 1065, 1334,
+1423, 1509, 1312, 1263, 1384, 1292, 1337, 135, 1146, 1194,
+1787, 1371, 1308, 1159, 1412, 1439, 1652, 1433, 1372, 1785,
+1041, 1446, 1545, 1662, 1663, 1415, 1788, 1506, 1418, 1310,
+1353, 1789, 1786, 633, 1458, 1377, 1274, 1378, 1599, 1307,
+1601, 1603, 1355, 1422, 1508, 1460, 1461, 1379, 1551, 1689,
+1356, 1335, 1382, 1387, 1338, 1791, 1011, 1636, 1268, 1184,
+1647, 1493, 1623, 1628, 1648, 1536, 1149, 1442, 1443, 1287,
+919, 1655, 1790, 1505, 763, 1669, 1546, 1674, 1792, 1600,
+1681, 1217, 1462, 1498, 1793, 1794, 1795, 1465, 1386, 1466,
+1467, 1784, 1951, 237,
+};
+
+static const uint16_t max_arg[] = {
+0, 1, 3, 4, 7, 11, 16, 16, 16, 17,
+18, 20, 24, 24, 25, 32, 32, 32, 32, 34,
+40, 40, 40, 40, 40, 45, 47, 65, 65, 65,
+65, 65, 65, 79, 79, 79, 79, 79, 79, 79,
+79, 79, 87, 87, 87, 113, 113, 113, 113, 113,
+113, 113, 113, 124, 124, 129, 129, 129, 129, 129,
+129, 129, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 182, 182, 184, 184, 184, 184, 184, 184,
+198, 198, 198, 198, 198, 198, 198, 198, 216, 216,
+216, 216, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 277, 277,
+292, 292, 292, 292, 292, 302, 302, 302, 302, 302,
+313, 313, 313, 320, 320, 320, 320, 320, 326, 326,
+326, 326, 326, 326, 350, 350, 350, 350, 350, 365,
+365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+365, 365, 365, 365, 403, 406, 406, 406, 406, 406,
+415, 415, 415, 415, 415, 415, 415, 415, 415, 415,
+415, 415, 415, 415, 415, 415, 415, 415, 415, 415,
+415, 415, 420, 459, 472, 472, 490, 490, 490, 490,
+490, 498, 498, 503, 506, 506, 507, 507, 507, 512,
+512, 512, 512, 518, 518, 518, 518, 533, 533, 533,
+533, 533, 533, 533, 553, 553, 553, 553, 553, 553,
+553, 553, 553, 592, 593, 593, 593, 593, 593, 593,
+604, 604, 604, 604, 604, 604, 639, 639, 639, 639,
+639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+639, 639, 639, 639, 639, 639, 685, 690, 690, 690,
+698, 698, 698, 710, 714, 715, 715, 715, 715, 715,
+715, 715, 715, 715, 715, 715, 715, 715, 715, 715,
+715, 715, 758, 762, 762, 762, 762, 762, 773, 773,
+773, 773, 773, 773, 773, 773, 773, 804, 804, 804,
+804, 804, 804, 804, 804, 804, 804, 804, 804, 804,
+804, 804, 804, 804, 804, 829, 829, 829, 865, 865,
+865, 881, 881, 881, 893, 893, 893, 893, 893, 893,
+893, 893, 893, 896, 896, 896, 896, 896, 896, 896,
+925, 925, 925, 925, 925, 925, 925, 956, 956, 956,
+956, 956, 968, 968, 968, 968, 968, 968, 968, 968,
+985, 985, 985, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
+1001, 1001, 1001, 1001, 1001, 1001, 1017, 1017, 1017, 1017,
+1017, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+1068, 1068, 1068, 1069, 1069, 1069, 1069, 1069, 1084, 1084,
+1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175,
+1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175,
+1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1254,
+1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254,
+1254, 1254, 1254, 1254, 1254, 1254, 1254, 1283, 1284, 1284,
+1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325,
+1325, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1369,
+1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+1369, 1369, 1369, 1369, 1369, 1369, 1434, 1434, 1434, 1434,
+1434, 1434, 1434, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+1435, 1435, 1435, 1435, 1435, 1435, 1437, 1523, 1523, 1523,
+1523, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524,
+1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525,
+1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+1525, 1526, 1526, 1530, 1530, 1626, 1626, 1626, 1626, 1626,
+1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627,
+1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+1787, 1787, 1787, 1787, 1787, 1787, 1787, 1787, 1787, 1787,
+1787, 1787, 1787, 1787, 1787, 1787, 1788, 1788, 1788, 1788,
+1788, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789,
+1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789,
+1789, 1789, 1789, 1789, 1789, 1791, 1791, 1791, 1791, 1791,
+1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791,
+1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1792, 1792,
+1792, 1792, 1792, 1792, 1793, 1794, 1795, 1795, 1795, 1795,
+1795, 1795, 1951, 1951,
+};
+
+static const double ELP_ALIGNED amp[] = {
+385000.52906917688, -20905.355047716119, -3699.110920001347, -2955.9675643427154,
+-569.92512147422656, 246.15847760507347, -204.58598384891377, -170.73307849690906,
+-152.1377115187714, -129.62013870624, 108.74270171165811, 104.75522520835075,
+79.660556169881289, 48.888296413479964, -34.782523678928712, 30.823839685180101,
+24.208482544881974, -23.210430199937111, -21.636343730010744, -16.674712960334418,
+14.402688797679671, -12.831395088810908, -11.649947830369715, -10.444757713732505,
+10.321105572429925, 10.05619665326304, -9.8844537885691288, 8.7515611816276699,
+-8.3791067207141339, -7.0026914110894589, 6.3220032166237186, 5.7508540319103307,
+-4.9501283973662158, -4.4211763467340637, 4.131113910409753, -3.9579801374120653,
+3.2582370850524178, -3.1483015653276722, 2.6164074435104121, 2.3536278844488918,
+-2.117125478065391, -1.8970355352588544, -1.7385258314584724, -1.5713933535376174,
+-1.4225541252364311, -1.4189284016000927, 1.1655348499905036, -1.1169370855216347,
+1.0656708832121577, -0.93331695181104213, 0.86243278066047757, 0.85123978999367578,
+-0.84880128489854678, -0.79562623733494364, 0.77854493731241381, 0.77403891775041245,
+-0.66968351143158689, -0.65753210031259646, 0.65706377425220253, 0.5963208388547907,
+0.57878942343930639, -0.51423242648501477, -0.50792123650167442, 0.49755183342561893,
+0.49504385031830966, 0.47262323155732477, -0.42250165661113992, -0.42240627886522375,
+-0.41071405457087956, 0.37852141925440458, 0.35507845838658436, 0.34301547044766778,
+0.3346321632277463, 0.33224867052460105, 0.32334278201881006, -0.32175502111874954,
+-0.28663087789656283, 0.28398591779395571, -0.2790396989852702, 0.25560096112556729,
+-0.24809677258898158, 0.24452120182844961, 0.23695180964853127, -0.21258248588065384,
+0.21251282533397728, 0.2094088269761227, -0.20285296577346432, 0.20098654007448888,
+-0.18566976784607836, -0.18316094657180806, 0.16857453730143129, -0.15802133917196162,
+-0.15707403033969056, -0.14806365029001184, 0.14762939876102957, 0.14367537355042737,
+-0.13922061803796604, -0.13617028131461317, -0.13571251461283498, -0.12805058295754981,
+0.11410596225003439, 0.10997613696251127, -0.10887219498759794, -0.10833226585613318,
+-0.10765613261624898, -0.10325752717798203, -0.099380482687694116, -0.085870257975842537,
+-0.079818867896229925, -0.066777755788335849, -0.065449919974819179, 0.060549054684297901,
+-0.059038004048046634, -0.058880464031609077, -0.058498109566696231, -0.057886834794938606,
+-0.05526704883416856, 0.052928187988818598, -0.051908205272314607, 0.050716371224285288,
+-0.050197403278090642, -0.048430211040801731, 0.047400374630475223, -0.047357471896429831,
+-0.046076712139372859, 0.045910184244450328, -0.044220291347698185, -0.043158595203426305,
+-0.042319335460018093, -0.038935708745570168, 0.038098688823061076, 0.037338024313545944,
+0.037287226715706626, 0.036818726831562419, 0.033788169493837721, 0.032648313226855422,
+0.031429700171796568, 0.030238433406834013, -0.029477804738723811, -0.029390185555835037,
+0.029099627778266135, -0.028546851612588128, 0.028387370846061709, -0.026978568794419695,
+-0.026739169201673879, 0.026578098470172964, -0.024709617518486771, -0.024359209900029145,
+-0.023989231453247637, 0.023680120533137661, 0.023339273281125311, 0.023039284022686703,
+0.021267621761138451, -0.020789305470205657, -0.020079746477749783, 0.019688922945830425,
+0.019379701356344769, 0.019117888669803827, -0.018739686661857827, 0.018678640312855318,
+-0.018659375560531641, 0.01810976519264337, 0.018039066129179458, 0.017289433007070774,
+-0.017278752714327713, -0.017089405702680846, 0.017039448944927711, -0.015777639759663398,
+-0.015708266049995895, 0.015509180856866152, 0.015179212714738479, 0.015168941825792408,
+0.014829794777109481, -0.014479495079787527, 0.014409212730135257, -0.014200047629940747,
+0.014169558536382394, 0.013888986019509919, -0.013659249437738359, -0.01243006760850069,
+0.011490054605705379, 0.011209618047729944, 0.011158786761636922, -0.010719031707030008,
+-0.010479216021500284, -0.010359269798097795, 0.009569128534619083, 0.0094796761667146744,
+-0.009379344897676254, 0.0092498830180760428, 0.0091193592928200812, -0.0088696706278904025,
+-0.0086798596281319525, 0.0084393840984821698, -0.0083697336035214696, -0.0081690890501041162,
+-0.0081399939089685999, -0.0080795595020767014, 0.0079192781869254786, -0.0078498743806842842,
+0.0077997255873416991, -0.0076895832828125094, -0.0074497466626182868, -0.0074399064973698689,
+-0.0068196375153311917, -0.0067997760693296735, 0.0067098930878894117, -0.0066096576393657224,
+-0.006590041604432397, 0.0064595304829814845, -0.0063600398828034376, -0.006179558739343503,
+-0.0058796919263100931, 0.0057298067655038691, -0.0056196994817936923, -0.0055900216509171003,
+-0.0055794838864376391, 0.0054999204360152631, -0.0054200424864243547, -0.0054096062612653383,
+-0.0053900268591830676, -0.0053697236873365625, -0.0051294420256465341, 0.0045699356628389302,
+0.0044995915497486804, 0.004379682244120533, 0.004299854988340319, -0.0042593700543959454,
+-0.0042198489165548433, -0.0041298707802342894, -0.0040296298919369035, 0.0039999443457362296,
+-0.0039198754691144215, -0.0034196853375854474, -0.0033497667141340437, -0.0033398907287877297,
+0.0033098216674902633, -0.0032900312239403182, -0.0032599556529389951, 0.0032397668849634973,
+-0.0031098882927930935, 0.0030400286182802215, -0.002980024280400154, -0.0029598971342892767,
+-0.0028696902275229552, -0.0028500095229339242, 0.0028099574029379175, -0.0027799617432753671,
+0.0027799068670784194, 0.0027199061558475981, 0.0027198592352593817, -0.0026999530623081224,
+-0.0025599150089096823, 0.0025198248147971208, -0.0024799481555012421, -0.0023898301944350695,
+-0.0023697856241168599, -0.0022999273261578271, 0.0022798426895960081, 0.0022398383498869459,
+0.0021899287285103673, -0.0020897696637597911, 0.0020797715685734325, -0.0020599708756372241,
+0.0020299708756512259, -0.0020298929255332947, -0.0019498659232641126, -0.0019399354736651774,
+-0.0019398598488881589, 0.0018799808567537073, 0.0018698352535918633, -0.0018400112667599506,
+-0.0018398695651844852, -0.0018200086635432342, 0.0018099964778865421, -0.0017399514363202826,
+-0.0017000104070559923, 0.0016798473045181272, -0.0016399760918263037, 0.0016198813622819302,
+-0.0016098189255713204, 0.0015999153870100849, 0.0015898839569608179, 0.0015599190323522677,
+0.0015299559455723307, -0.0015299438002562352, 0.0015200095379897939, -0.0014999498722168124,
+-0.0014799207670576238, -0.0014498729899469522, -0.0014299238086018199, 0.0014199765319110791,
+0.0013599078966193996, 0.0013499587183284927, 0.0012799561156333801, 0.0012699326551230904,
+-0.0012599552453367204, -0.0012099384704438835, 0.0011899882534493205, 0.0011899658332406376,
+0.001159965828353877, -0.0011398714748848868, -0.0011298331458933525, -0.0011100043366583775,
+-0.0011099974102306458, -0.0011099588897092441, -0.0010899614904738095, 0.0010799612034346382,
+-0.001060007802320009, 0.0010398618112391245, -0.0010199305608062444, -0.0010099878249194925,
+0.0010099686072832675, 0.00098992681018672123, 0.00098991290031330667, -0.00098991289848077146,
+0.00096996687019053796, 0.00092996860477510932, -0.0008899999995099397, -0.00088995313791833904,
+-0.00084997398074798756, -0.0008499374963657902, 0.00083992451959073917, -0.00083000259649742105,
+-0.00079997262522824714, -0.00079995660527771943, 0.00079992538692241462, 0.00078995660772109965,
+0.00077991518717944041, -0.00077988136255319348, 0.00076996051700656135, -0.0007399632905783634,
+-0.00072989385221652674, -0.00071999260330438694, -0.00069997762144667001, 0.00069993831677730598,
+0.00068996589297943981, 0.00066999260391523206, 0.00066995438533518548, 0.00066995265030778974,
+-0.00066995004831276318, 0.000660003465908432, -0.00065995438411349538, -0.00064997935881420325,
+0.0006499784933150629, 0.00064992507083263358, -0.00063993831471197225, -0.00058996589359028501,
+-0.00057989385160568164, -0.00055997329364293046, -0.00055000520276836298, 0.00054997518068116032,
+-0.00054995020624125433, -0.00054993756055197378, 0.00053993756055197375, 0.0005199830004737737,
+0.00051997343074668275, -0.00051994553820306985, 0.00049998435797139274, 0.00048997344697346659,
+-0.00048997344479611909, 0.00047999564709070826, -0.00047999478071469019, -0.00045997518190285037,
+-0.0004599547154933023, 0.00045995178334015896, 0.00044998386841629432, -0.00044993131509807571,
+0.00043999478098072288, -0.00043997518190285037, 0.0004399734470014701, 0.00043996877835244055,
+0.00043996877797962473, -0.00043995004684427281, -0.00043000346908867273, -0.00042995004623342769,
+0.00041998751033666684, -0.00040999098149590397, -0.00040998751216920196, -0.00040997138241803145,
+0.00040996878042300495, 0.00039997187014059466, -0.00038998924438917273, -0.00038998435797139267,
+0.00037998924417914696, 0.00037998566465098285, -0.00036998751075148777, 0.0003699438047614089,
+0.00035998751522342727, 0.00035997762633343047, -0.00035997502433840397, 0.00035997502230984468,
+0.00035994380476140893, 0.00034999999980397592, -0.00034997578064774646, -0.00034997502250586879,
+0.00034996253632558355, 0.00033998751198717963, 0.00033997675716921982, 0.00033995004867680797,
+0.00032999000314189549, -0.00032998924500001782, 0.00031999999737459742, 0.00031998826847854452,
+0.00031997502111615804, -0.00030997502433840395, -0.00030000260199502648, -0.00029999999999999997,
+-0.00029999999983197932, 0.00029999999983197932, 0.00029998751216920195, 0.00028997502418438501,
+0.00027999999999999998, 0.00027998126809978402, 0.00027998126809978402, 0.00027000173466335101,
+-0.00027000173452333378, -0.00027, 0.00026996878042300496, 0.00026000520399005299,
+0.00026000173452333375, 0.00025996878042300494, -0.00024998300291715399, -0.00023999999755661976,
+-0.00023998126812778747, -0.00023997502311671386, -0.00022999999987398452, 0.00022998126825380297,
+-0.00022000000000000001, -0.00021999999877830989, -0.00021997502433840398, -0.00021996878042300497,
+0.00020999999988798623, 0.00020999999988798623, 0.00020999999877830989, 0.00020998126825380297,
+-0.00020997502433840398, 0.00020000260199502651, -0.00020000173466335101, 0.00020000000000000001,
+-0.00020000000000000001, 0.00019999999988798623, -0.00019999999988798623, -0.00019997502433840398,
+-0.00019000173466335101, -0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+-0.00018999999990198797, -0.00018999999990198797, -0.00018000000000000001, -0.00017999999990198797,
+-0.00017999999990198797, 0.00017998751216920198, -0.00017998751216920198, -0.00017000000000000001,
+0.00016999999991598969, -0.00016998126825380297, -0.00016998126825380297, 0.00016000000000000001,
+-0.00016000000000000001, 0.0001599999980834545, -0.00015998751216920199, -0.00015998751208519166,
+-0.00015998751208519166, -0.00015998126825380297, 0.00014999999999999999, -0.00014999999999999999,
+0.00014999999999999999, -0.00014999999991598966, -0.00014999999991598966, 0.00014999999991598966,
+-0.00014998126825380295, 0.00014000260199502649, -0.00013999999999999999, -0.00013999999999999999,
+0.00013999999999999999, 0.00013999999992999137, -0.00013999999992999137, -0.00013999999991598966,
+0.00012999999999999999, -0.00012999999999999999, -0.00012999999992999137, -0.00012999999992999137,
+0.00012999999816746481, -0.00012998751216920196, 0.00012, 0.00012,
+-0.00012, -0.00012, 0.00012, -0.00012,
+-0.0001199999999299914, -0.00011998751216920199, -0.00011997502433840396, -0.00011,
+-0.00011, 0.00011, 0.00011, -0.00011,
+0.00011, -0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311,
+-0.00010998751216920199, 0.0001, 0.0001, -0.0001,
+-0.0001, -0.0001, 9.9999999943993116e-05, 9.9999999943993116e-05,
+9.9987512113195102e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+-9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05,
+-9.0000000000000006e-05, 8.9999999957994842e-05, -8.9999999957994842e-05, -8.9999999943993117e-05,
+-8.9987512169201992e-05, 8.9987512113195103e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+-8.0000000000000007e-05, 8.0000000000000007e-05, -7.9999999957994843e-05, 7.9999999957994843e-05,
+7.9999999957994843e-05, 7.9999999957994843e-05, 7.9999999957994843e-05, -7.9999999957994843e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05,
+-6.999999995799483e-05, 6.999999995799483e-05, -6.999999995799483e-05, -6.999999995799483e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, 6.0000000000000002e-05, -5.9999999971996557e-05, 5.9999999971996557e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999971996557e-05,
+5.9999999971996557e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 1.9979578224695575e-05, -2.6000644792951879e-09, 1.7346633510099198e-09,
+};
+
+static const double ELP_ALIGNED c[] = {
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+0, 0, 0, 0,
+};
+
+static const double ELP_ALIGNED s[] = {
+385000.52906917688, -20905.355047716119, -3699.110920001347, -2955.9675643427154,
+-569.92512147422656, 246.15847760507347, -204.58598384891377, -170.73307849690906,
+-152.1377115187714, -129.62013870624, 108.74270171165811, 104.75522520835075,
+79.660556169881289, 48.888296413479964, -34.782523678928712, 30.823839685180101,
+24.208482544881974, -23.210430199937111, -21.636343730010744, -16.674712960334418,
+14.402688797679671, -12.831395088810908, -11.649947830369715, -10.444757713732505,
+10.321105572429925, 10.05619665326304, -9.8844537885691288, 8.7515611816276699,
+-8.3791067207141339, -7.0026914110894589, 6.3220032166237186, 5.7508540319103307,
+-4.9501283973662158, -4.4211763467340637, 4.131113910409753, -3.9579801374120653,
+3.2582370850524178, -3.1483015653276722, 2.6164074435104121, 2.3536278844488918,
+-2.117125478065391, -1.8970355352588544, -1.7385258314584724, -1.5713933535376174,
+-1.4225541252364311, -1.4189284016000927, 1.1655348499905036, -1.1169370855216347,
+1.0656708832121577, -0.93331695181104213, 0.86243278066047757, 0.85123978999367578,
+-0.84880128489854678, -0.79562623733494364, 0.77854493731241381, 0.77403891775041245,
+-0.66968351143158689, -0.65753210031259646, 0.65706377425220253, 0.5963208388547907,
+0.57878942343930639, -0.51423242648501477, -0.50792123650167442, 0.49755183342561893,
+0.49504385031830966, 0.47262323155732477, -0.42250165661113992, -0.42240627886522375,
+-0.41071405457087956, 0.37852141925440458, 0.35507845838658436, 0.34301547044766778,
+0.3346321632277463, 0.33224867052460105, 0.32334278201881006, -0.32175502111874954,
+-0.28663087789656283, 0.28398591779395571, -0.2790396989852702, 0.25560096112556729,
+-0.24809677258898158, 0.24452120182844961, 0.23695180964853127, -0.21258248588065384,
+0.21251282533397728, 0.2094088269761227, -0.20285296577346432, 0.20098654007448888,
+-0.18566976784607836, -0.18316094657180806, 0.16857453730143129, -0.15802133917196162,
+-0.15707403033969056, -0.14806365029001184, 0.14762939876102957, 0.14367537355042737,
+-0.13922061803796604, -0.13617028131461317, -0.13571251461283498, -0.12805058295754981,
+0.11410596225003439, 0.10997613696251127, -0.10887219498759794, -0.10833226585613318,
+-0.10765613261624898, -0.10325752717798203, -0.099380482687694116, -0.085870257975842537,
+-0.079818867896229925, -0.066777755788335849, -0.065449919974819179, 0.060549054684297901,
+-0.059038004048046634, -0.058880464031609077, -0.058498109566696231, -0.057886834794938606,
+-0.05526704883416856, 0.052928187988818598, -0.051908205272314607, 0.050716371224285288,
+-0.050197403278090642, -0.048430211040801731, 0.047400374630475223, -0.047357471896429831,
+-0.046076712139372859, 0.045910184244450328, -0.044220291347698185, -0.043158595203426305,
+-0.042319335460018093, -0.038935708745570168, 0.038098688823061076, 0.037338024313545944,
+0.037287226715706626, 0.036818726831562419, 0.033788169493837721, 0.032648313226855422,
+0.031429700171796568, 0.030238433406834013, -0.029477804738723811, -0.029390185555835037,
+0.029099627778266135, -0.028546851612588128, 0.028387370846061709, -0.026978568794419695,
+-0.026739169201673879, 0.026578098470172964, -0.024709617518486771, -0.024359209900029145,
+-0.023989231453247637, 0.023680120533137661, 0.023339273281125311, 0.023039284022686703,
+0.021267621761138451, -0.020789305470205657, -0.020079746477749783, 0.019688922945830425,
+0.019379701356344769, 0.019117888669803827, -0.018739686661857827, 0.018678640312855318,
+-0.018659375560531641, 0.01810976519264337, 0.018039066129179458, 0.017289433007070774,
+-0.017278752714327713, -0.017089405702680846, 0.017039448944927711, -0.015777639759663398,
+-0.015708266049995895, 0.015509180856866152, 0.015179212714738479, 0.015168941825792408,
+0.014829794777109481, -0.014479495079787527, 0.014409212730135257, -0.014200047629940747,
+0.014169558536382394, 0.013888986019509919, -0.013659249437738359, -0.01243006760850069,
+0.011490054605705379, 0.011209618047729944, 0.011158786761636922, -0.010719031707030008,
+-0.010479216021500284, -0.010359269798097795, 0.009569128534619083, 0.0094796761667146744,
+-0.009379344897676254, 0.0092498830180760428, 0.0091193592928200812, -0.0088696706278904025,
+-0.0086798596281319525, 0.0084393840984821698, -0.0083697336035214696, -0.0081690890501041162,
+-0.0081399939089685999, -0.0080795595020767014, 0.0079192781869254786, -0.0078498743806842842,
+0.0077997255873416991, -0.0076895832828125094, -0.0074497466626182868, -0.0074399064973698689,
+-0.0068196375153311917, -0.0067997760693296735, 0.0067098930878894117, -0.0066096576393657224,
+-0.006590041604432397, 0.0064595304829814845, -0.0063600398828034376, -0.006179558739343503,
+-0.0058796919263100931, 0.0057298067655038691, -0.0056196994817936923, -0.0055900216509171003,
+-0.0055794838864376391, 0.0054999204360152631, -0.0054200424864243547, -0.0054096062612653383,
+-0.0053900268591830676, -0.0053697236873365625, -0.0051294420256465341, 0.0045699356628389302,
+0.0044995915497486804, 0.004379682244120533, 0.004299854988340319, -0.0042593700543959454,
+-0.0042198489165548433, -0.0041298707802342894, -0.0040296298919369035, 0.0039999443457362296,
+-0.0039198754691144215, -0.0034196853375854474, -0.0033497667141340437, -0.0033398907287877297,
+0.0033098216674902633, -0.0032900312239403182, -0.0032599556529389951, 0.0032397668849634973,
+-0.0031098882927930935, 0.0030400286182802215, -0.002980024280400154, -0.0029598971342892767,
+-0.0028696902275229552, -0.0028500095229339242, 0.0028099574029379175, -0.0027799617432753671,
+0.0027799068670784194, 0.0027199061558475981, 0.0027198592352593817, -0.0026999530623081224,
+-0.0025599150089096823, 0.0025198248147971208, -0.0024799481555012421, -0.0023898301944350695,
+-0.0023697856241168599, -0.0022999273261578271, 0.0022798426895960081, 0.0022398383498869459,
+0.0021899287285103673, -0.0020897696637597911, 0.0020797715685734325, -0.0020599708756372241,
+0.0020299708756512259, -0.0020298929255332947, -0.0019498659232641126, -0.0019399354736651774,
+-0.0019398598488881589, 0.0018799808567537073, 0.0018698352535918633, -0.0018400112667599506,
+-0.0018398695651844852, -0.0018200086635432342, 0.0018099964778865421, -0.0017399514363202826,
+-0.0017000104070559923, 0.0016798473045181272, -0.0016399760918263037, 0.0016198813622819302,
+-0.0016098189255713204, 0.0015999153870100849, 0.0015898839569608179, 0.0015599190323522677,
+0.0015299559455723307, -0.0015299438002562352, 0.0015200095379897939, -0.0014999498722168124,
+-0.0014799207670576238, -0.0014498729899469522, -0.0014299238086018199, 0.0014199765319110791,
+0.0013599078966193996, 0.0013499587183284927, 0.0012799561156333801, 0.0012699326551230904,
+-0.0012599552453367204, -0.0012099384704438835, 0.0011899882534493205, 0.0011899658332406376,
+0.001159965828353877, -0.0011398714748848868, -0.0011298331458933525, -0.0011100043366583775,
+-0.0011099974102306458, -0.0011099588897092441, -0.0010899614904738095, 0.0010799612034346382,
+-0.001060007802320009, 0.0010398618112391245, -0.0010199305608062444, -0.0010099878249194925,
+0.0010099686072832675, 0.00098992681018672123, 0.00098991290031330667, -0.00098991289848077146,
+0.00096996687019053796, 0.00092996860477510932, -0.0008899999995099397, -0.00088995313791833904,
+-0.00084997398074798756, -0.0008499374963657902, 0.00083992451959073917, -0.00083000259649742105,
+-0.00079997262522824714, -0.00079995660527771943, 0.00079992538692241462, 0.00078995660772109965,
+0.00077991518717944041, -0.00077988136255319348, 0.00076996051700656135, -0.0007399632905783634,
+-0.00072989385221652674, -0.00071999260330438694, -0.00069997762144667001, 0.00069993831677730598,
+0.00068996589297943981, 0.00066999260391523206, 0.00066995438533518548, 0.00066995265030778974,
+-0.00066995004831276318, 0.000660003465908432, -0.00065995438411349538, -0.00064997935881420325,
+0.0006499784933150629, 0.00064992507083263358, -0.00063993831471197225, -0.00058996589359028501,
+-0.00057989385160568164, -0.00055997329364293046, -0.00055000520276836298, 0.00054997518068116032,
+-0.00054995020624125433, -0.00054993756055197378, 0.00053993756055197375, 0.0005199830004737737,
+0.00051997343074668275, -0.00051994553820306985, 0.00049998435797139274, 0.00048997344697346659,
+-0.00048997344479611909, 0.00047999564709070826, -0.00047999478071469019, -0.00045997518190285037,
+-0.0004599547154933023, 0.00045995178334015896, 0.00044998386841629432, -0.00044993131509807571,
+0.00043999478098072288, -0.00043997518190285037, 0.0004399734470014701, 0.00043996877835244055,
+0.00043996877797962473, -0.00043995004684427281, -0.00043000346908867273, -0.00042995004623342769,
+0.00041998751033666684, -0.00040999098149590397, -0.00040998751216920196, -0.00040997138241803145,
+0.00040996878042300495, 0.00039997187014059466, -0.00038998924438917273, -0.00038998435797139267,
+0.00037998924417914696, 0.00037998566465098285, -0.00036998751075148777, 0.0003699438047614089,
+0.00035998751522342727, 0.00035997762633343047, -0.00035997502433840397, 0.00035997502230984468,
+0.00035994380476140893, 0.00034999999980397592, -0.00034997578064774646, -0.00034997502250586879,
+0.00034996253632558355, 0.00033998751198717963, 0.00033997675716921982, 0.00033995004867680797,
+0.00032999000314189549, -0.00032998924500001782, 0.00031999999737459742, 0.00031998826847854452,
+0.00031997502111615804, -0.00030997502433840395, -0.00030000260199502648, -0.00029999999999999997,
+-0.00029999999983197932, 0.00029999999983197932, 0.00029998751216920195, 0.00028997502418438501,
+0.00027999999999999998, 0.00027998126809978402, 0.00027998126809978402, 0.00027000173466335101,
+-0.00027000173452333378, -0.00027, 0.00026996878042300496, 0.00026000520399005299,
+0.00026000173452333375, 0.00025996878042300494, -0.00024998300291715399, -0.00023999999755661976,
+-0.00023998126812778747, -0.00023997502311671386, -0.00022999999987398452, 0.00022998126825380297,
+-0.00022000000000000001, -0.00021999999877830989, -0.00021997502433840398, -0.00021996878042300497,
+0.00020999999988798623, 0.00020999999988798623, 0.00020999999877830989, 0.00020998126825380297,
+-0.00020997502433840398, 0.00020000260199502651, -0.00020000173466335101, 0.00020000000000000001,
+-0.00020000000000000001, 0.00019999999988798623, -0.00019999999988798623, -0.00019997502433840398,
+-0.00019000173466335101, -0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+-0.00018999999990198797, -0.00018999999990198797, -0.00018000000000000001, -0.00017999999990198797,
+-0.00017999999990198797, 0.00017998751216920198, -0.00017998751216920198, -0.00017000000000000001,
+0.00016999999991598969, -0.00016998126825380297, -0.00016998126825380297, 0.00016000000000000001,
+-0.00016000000000000001, 0.0001599999980834545, -0.00015998751216920199, -0.00015998751208519166,
+-0.00015998751208519166, -0.00015998126825380297, 0.00014999999999999999, -0.00014999999999999999,
+0.00014999999999999999, -0.00014999999991598966, -0.00014999999991598966, 0.00014999999991598966,
+-0.00014998126825380295, 0.00014000260199502649, -0.00013999999999999999, -0.00013999999999999999,
+0.00013999999999999999, 0.00013999999992999137, -0.00013999999992999137, -0.00013999999991598966,
+0.00012999999999999999, -0.00012999999999999999, -0.00012999999992999137, -0.00012999999992999137,
+0.00012999999816746481, -0.00012998751216920196, 0.00012, 0.00012,
+-0.00012, -0.00012, 0.00012, -0.00012,
+-0.0001199999999299914, -0.00011998751216920199, -0.00011997502433840396, -0.00011,
+-0.00011, 0.00011, 0.00011, -0.00011,
+0.00011, -0.00010999999994399311, 0.00010999999994399311, 0.00010999999994399311,
+-0.00010998751216920199, 0.0001, 0.0001, -0.0001,
+-0.0001, -0.0001, 9.9999999943993116e-05, 9.9999999943993116e-05,
+9.9987512113195102e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+-9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05, -9.0000000000000006e-05,
+-9.0000000000000006e-05, 8.9999999957994842e-05, -8.9999999957994842e-05, -8.9999999943993117e-05,
+-8.9987512169201992e-05, 8.9987512113195103e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+-8.0000000000000007e-05, 8.0000000000000007e-05, -7.9999999957994843e-05, 7.9999999957994843e-05,
+7.9999999957994843e-05, 7.9999999957994843e-05, 7.9999999957994843e-05, -7.9999999957994843e-05,
+-6.9999999999999994e-05, 6.9999999999999994e-05, -6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05, -6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.999999995799483e-05, 6.999999995799483e-05, 6.999999995799483e-05,
+-6.999999995799483e-05, 6.999999995799483e-05, -6.999999995799483e-05, -6.999999995799483e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, -6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, 6.0000000000000002e-05, -5.9999999971996557e-05, 5.9999999971996557e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05,
+-5.9999999971996557e-05, 5.9999999971996557e-05, -5.9999999971996557e-05, -5.9999999971996557e-05,
+5.9999999971996557e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, -4.9999999971996558e-05,
+4.9999999971996558e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+-4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 1.9979578224695575e-05, -2.6000644792951879e-09, 1.7346633510099198e-09,
+};
+
+const struct elp_table elp3 = {
+    arg, max_arg, amp, c, s, 704
 };
@@ -1,17 +1,36 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp30[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.001300, 99999.999000},
-{0.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 213.957200, 0.000030, 0.075000},
-{0.000000, {0.000000, 0.000000, 0.000000, 2.000000}, 270.037450, 0.000020, 0.037000},
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 90.075970, 0.000040, 0.075000},
-{0.000000, {0.000000, 0.000000, 3.000000, -2.000000}, 270.434290, 0.000020, 0.077000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 89.999190, 0.000130, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 270.000070, 0.000220, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 269.999030, 0.000110, 0.070000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 89.998150, 0.000020, 0.095000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 90.000520, 0.000030, 0.042000},
-{0.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 269.985850, 0.000050, 0.564000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 89.998630, 0.000130, 0.087000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 269.999820, 0.000020, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 269.999820, 0.000030, 0.039000},
+
+static const uint16_t arg[] = {
+25, 43, 106, 26, 123, 125, 63, 367, 101, 228,
+167, 430, 91, 216,
+};
+
+static const uint16_t max_arg[] = {
+25, 43, 106, 106, 123, 125, 125, 367, 367, 367,
+367, 430, 430, 430,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0012999999999999999, 0.00022000000000000001, 0.00012999999999999999, 0.00012999999999999999,
+0.00011, 5.0000000000000002e-05, 4.0000000000000003e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+7.9602041944577953e-20, 2.6878070485241011e-10, 1.8378317022893824e-09, 3.1084313975075781e-09,
+-1.8622663117474332e-09, -1.2348204332322003e-08, -5.3037049769023548e-08, -2.4883651764710679e-05,
+-2.7227136330296583e-10, -9.4247779612670774e-11, 1.3072515166609361e-08, 1.5159435656260002e-07,
+6.4577182312678901e-10, -6.2831853075113849e-11,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.0012999999999999999, -0.00021999999999983583, 0.00012999999998700913, 0.00012999999996283712,
+-0.00010999999998423621, -4.9999998475218481e-05, 3.9999964838376452e-05, -1.6757203670440101e-05,
+2.9999999998764471e-05, -2.9999999999851956e-05, -1.9999995727733227e-05, -1.9999425470524358e-05,
+1.9999999989574469e-05, -1.9999999999901305e-05,
+};
+
+const struct elp_table elp30 = {
+    arg, max_arg, amp, c, s, 14
 };
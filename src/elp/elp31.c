@@ -1,14 +1,33 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp31[] = {
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 179.934730, 0.000060, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 179.985320, 0.000810, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 179.963230, 0.000050, 0.070000},
-{0.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 0.000010, 0.000130, 0.081000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 180.022820, 0.000010, 0.075000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 0.022640, 0.000020, 0.095000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 359.988260, 0.000020, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 180.000190, 0.000550, 0.040000},
-{0.000000, {2.000000, 0.000000, 1.000000, 0.000000}, 180.000170, 0.000060, 0.026000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 180.749540, 0.000010, 0.080000},
-{0.000000, {4.000000, 0.000000, -1.000000, 0.000000}, 180.000350, 0.000010, 0.028000},
+
+static const uint16_t arg[] = {
+43, 109, 110, 106, 344, 123, 91, 26, 131, 216,
+222,
+};
+
+static const uint16_t max_arg[] = {
+43, 109, 110, 110, 344, 344, 344, 344, 344, 344,
+344,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00080999999999999996, 0.00055000000000000003, 0.00012999999999999999, 6.0000000000000002e-05,
+6.0000000000000002e-05, 5.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.0008099999734134572, -0.00054999999999697598, 0.00012999999999999801, -5.9999961068317911e-05,
+-5.9999999999735897e-05, -4.9999989703681022e-05, 1.9999998438623733e-05, 1.9999999580153125e-05,
+-9.9999992068487489e-06, -9.9991443263179005e-06, -9.9999999998134215e-06,
+};
+
+static const double ELP_ALIGNED s[] = {
+2.0753360842570808e-07, -1.8238690683917378e-09, 2.2689280275926171e-11, 6.8350569383252074e-08,
+-1.7802358370693921e-10, 3.2087876095318725e-08, 7.9028506473749283e-09, -4.0980330549973102e-09,
+-3.982841247750746e-09, -1.3081567744185552e-07, -6.1086523819925122e-11,
+};
+
+const struct elp_table elp31 = {
+    arg, max_arg, amp, c, s, 11
 };
@@ -1,7 +1,25 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp32[] = {
-{0.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 179.998030, 0.000040, 0.081000},
-{0.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 179.997980, 0.000040, 0.069000},
-{0.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 359.998100, 0.000020, 0.088000},
-{0.000000, {2.000000, 0.000000, 0.000000, 1.000000}, 180.000260, 0.000020, 0.026000},
+
+static const uint16_t arg[] = {
+284, 285, 83, 264,
+};
+
+static const uint16_t max_arg[] = {
+284, 285, 285, 285,
+};
+
+static const double ELP_ALIGNED amp[] = {
+4.0000000000000003e-05, 4.0000000000000003e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-3.999999997635621e-05, -3.9999999975140786e-05, 1.9999999989003315e-05, -1.9999999999794081e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+1.3753194503078148e-09, 1.4102260353046887e-09, -6.6322511563457538e-10, -9.0757121104526966e-11,
+};
+
+const struct elp_table elp32 = {
+    arg, max_arg, amp, c, s, 4
 };
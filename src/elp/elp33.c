@@ -1,13 +1,31 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp33[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.008280, 99999.999000},
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 89.999940, 0.000430, 0.075000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 269.932920, 0.000050, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 270.009080, 0.000090, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 89.957650, 0.000050, 0.070000},
-{0.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 270.000020, 0.000060, 0.081000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 89.970710, 0.000020, 0.042000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 269.993670, 0.000030, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 90.000140, 0.001060, 0.040000},
-{0.000000, {2.000000, 0.000000, 1.000000, 0.000000}, 90.000100, 0.000080, 0.026000},
+
+static const uint16_t arg[] = {
+25, 109, 63, 43, 344, 110, 106, 123, 26, 101,
+};
+
+static const uint16_t max_arg[] = {
+25, 109, 109, 109, 344, 344, 344, 344, 344, 344,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0082799999999999992, 0.00106, 0.00042999999999999999, 9.0000000000000006e-05,
+8.0000000000000007e-05, 6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-1.5210113245410124e-18, -2.590068610012448e-09, 4.5029494710262716e-10, 1.4262830587540649e-08,
+-1.396263401559893e-10, 2.0943951042431455e-11, -5.8538329738820869e-08, 3.6957343545783295e-08,
+-3.3143802427959198e-09, 1.0224138312868173e-08,
+};
+
+static const double ELP_ALIGNED s[] = {
+-0.0082799999999999992, 0.0010599999999968356, 0.00042999999999976423, -8.9999998869842582e-05,
+7.9999999999878156e-05, -5.9999999999996342e-05, -4.9999965732627771e-05, 4.9999986341545718e-05,
+-2.9999999816914727e-05, 1.9999997386674725e-05,
+};
+
+const struct elp_table elp33 = {
+    arg, max_arg, amp, c, s, 10
 };
@@ -1,31 +1,47 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp34[] = {
-{0.000000, {0.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.000070, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.001080, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 0.000000, 0.004870, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 0.000000, 0.000800, 0.070000},
-{0.000000, {0.000000, 1.000000, 2.000000, 0.000000}, 0.000000, 0.000060, 0.036000},
-{0.000000, {0.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.000040, 0.089000},
-{0.000000, {0.000000, 2.000000, 0.000000, 0.000000}, 0.000000, 0.000110, 0.500000},
-{0.000000, {0.000000, 2.000000, 1.000000, 0.000000}, 0.000000, 0.000020, 0.066000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000130, 0.075000},
-{0.000000, {2.000000, -2.000000, -1.000000, 0.000000}, 180.000000, 0.000110, 0.105000},
-{0.000000, {2.000000, -2.000000, 0.000000, 0.000000}, 180.000000, 0.000120, 0.044000},
-{0.000000, {2.000000, -2.000000, 1.000000, 0.000000}, 180.000000, 0.000010, 0.028000},
-{0.000000, {2.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.000060, 0.360000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.001500, 0.095000},
-{0.000000, {2.000000, -1.000000, 0.000000, -2.000000}, 180.000000, 0.000020, 0.322000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.001200, 0.042000},
-{0.000000, {2.000000, -1.000000, 1.000000, 0.000000}, 180.000000, 0.000110, 0.027000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000020, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000030, 0.040000},
-{0.000000, {2.000000, 1.000000, -2.000000, 0.000000}, 180.000000, 0.000020, 1.292000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.000210, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, -2.000000}, 0.000000, 0.000010, 0.903000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 0.000000, 0.000180, 0.039000},
-{0.000000, {2.000000, 1.000000, 1.000000, 0.000000}, 0.000000, 0.000020, 0.026000},
-{0.000000, {2.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.000040, 0.074000},
-{0.000000, {4.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.000020, 0.046000},
-{0.000000, {4.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.000030, 0.028000},
-{0.000000, {4.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.000010, 0.021000},
+
+static const uint16_t arg[] = {
+43, 91, 101, 106, 123, 216, 228, 131, 273, 276,
+277, 278, 321, 346, 345, 405, 287, 109, 456, 575,
+495, 26, 331, 576, 497, 678, 496, 679,
+};
+
+static const uint16_t max_arg[] = {
+43, 91, 101, 106, 123, 216, 228, 228, 273, 276,
+277, 278, 321, 346, 346, 405, 405, 405, 456, 575,
+575, 575, 575, 576, 576, 678, 678, 679,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0048700000000000002, 0.0015, 0.0011999999999999999, 0.00108,
+0.00080000000000000004, 0.00021000000000000001, 0.00018000000000000001, 0.00012999999999999999,
+0.00012, 0.00011, 0.00011, 0.00011,
+6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.0048700000000000002, -0.0015, -0.0011999999999999999, 0.00108,
+0.00080000000000000004, 0.00021000000000000001, 0.00018000000000000001, -0.00012999999999999999,
+-0.00012, 0.00011, -0.00011, -0.00011,
+6.9999999999999994e-05, 6.0000000000000002e-05, -6.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 1.8369701987210298e-19, 1.4695761589768237e-19, 0,
+0, 0, 0, 1.5920408388915591e-20,
+1.4695761589768238e-20, 0, 1.3471114790620885e-20, 1.3471114790620885e-20,
+0, 0, 7.347880794884119e-21, 0,
+0, 0, 3.6739403974420595e-21, 0,
+2.4492935982947065e-21, 0, 2.4492935982947065e-21, 0,
+2.4492935982947065e-21, 1.2246467991473532e-21, 0, 1.2246467991473532e-21,
+};
+
+const struct elp_table elp34 = {
+    arg, max_arg, amp, c, s, 28
 };
@@ -1,16 +1,36 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp35[] = {
-{0.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 0.000000, 0.000050, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.000040, 0.857000},
-{0.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.000040, 0.081000},
-{0.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 0.000000, 0.000050, 0.069000},
-{0.000000, {0.000000, 1.000000, 1.000000, -1.000000}, 0.000000, 0.000040, 1.200000},
-{0.000000, {0.000000, 1.000000, 1.000000, 1.000000}, 0.000000, 0.000040, 0.036000},
-{0.000000, {2.000000, -2.000000, 0.000000, -1.000000}, 180.000000, 0.000020, 0.107000},
-{0.000000, {2.000000, -1.000000, -1.000000, -1.000000}, 180.000000, 0.000050, 0.340000},
-{0.000000, {2.000000, -1.000000, -1.000000, 1.000000}, 180.000000, 0.000060, 0.042000},
-{0.000000, {2.000000, -1.000000, 0.000000, -1.000000}, 180.000000, 0.000220, 0.097000},
-{0.000000, {2.000000, -1.000000, 0.000000, 1.000000}, 180.000000, 0.000060, 0.027000},
-{0.000000, {2.000000, -1.000000, 1.000000, -1.000000}, 180.000000, 0.000010, 0.042000},
-{0.000000, {2.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.000090, 0.081000},
+
+static const uint16_t arg[] = {
+211, 295, 354, 355, 382, 285, 381, 422, 284, 424,
+423, 577, 680,
+};
+
+static const uint16_t max_arg[] = {
+211, 295, 354, 355, 382, 382, 382, 422, 422, 424,
+424, 577, 680,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00022000000000000001, 9.0000000000000006e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 2.0000000000000002e-05,
+1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.00022000000000000001, 9.0000000000000006e-05, -6.0000000000000002e-05, -6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, -5.0000000000000002e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, -2.0000000000000002e-05,
+-1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+2.6942229581241771e-20, 0, 7.347880794884119e-21, 7.347880794884119e-21,
+0, 0, 6.1232339957367663e-21, 0,
+0, 0, 0, 2.4492935982947065e-21,
+1.2246467991473532e-21,
+};
+
+const struct elp_table elp35 = {
+    arg, max_arg, amp, c, s, 13
 };
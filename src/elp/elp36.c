@@ -1,22 +1,39 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp36[] = {
-{0.000000, {0.000000, 1.000000, -2.000000, 0.000000}, 90.000000, 0.000050, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 90.000000, 0.000950, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 270.000000, 0.000360, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 270.000000, 0.000770, 0.070000},
-{0.000000, {0.000000, 1.000000, 2.000000, 0.000000}, 270.000000, 0.000040, 0.036000},
-{0.000000, {0.000000, 2.000000, -1.000000, 0.000000}, 90.000000, 0.000030, 0.089000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.000120, 0.075000},
-{0.000000, {2.000000, -2.000000, -1.000000, 0.000000}, 90.000000, 0.000070, 0.105000},
-{0.000000, {2.000000, -2.000000, 0.000000, 0.000000}, 90.000000, 0.000140, 0.044000},
-{0.000000, {2.000000, -1.000000, -2.000000, 0.000000}, 270.000000, 0.000070, 0.360000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 90.000000, 0.001110, 0.095000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.001490, 0.042000},
-{0.000000, {2.000000, -1.000000, 1.000000, 0.000000}, 90.000000, 0.000090, 0.027000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000040, 0.040000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.000180, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 270.000000, 0.000230, 0.039000},
-{0.000000, {2.000000, 1.000000, 1.000000, 0.000000}, 270.000000, 0.000020, 0.026000},
-{0.000000, {2.000000, 2.000000, -1.000000, 0.000000}, 270.000000, 0.000030, 0.074000},
-{0.000000, {4.000000, -1.000000, -1.000000, 0.000000}, 90.000000, 0.000030, 0.028000},
+
+static const uint16_t arg[] = {
+101, 91, 106, 123, 43, 228, 216, 273, 131, 278,
+277, 345, 321, 346, 109, 405, 287, 456, 576,
+};
+
+static const uint16_t max_arg[] = {
+101, 101, 106, 123, 123, 228, 228, 273, 273, 278,
+278, 345, 345, 346, 346, 405, 405, 456, 576,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00149, 0.0011100000000000001, 0.00095, 0.00076999999999999996,
+0.00036000000000000002, 0.00023000000000000001, 0.00018000000000000001, 0.00013999999999999999,
+0.00012, 9.0000000000000006e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+9.1236186536477818e-20, 6.7967897352678112e-20, 5.8170722959499279e-20, -1.4144670530151928e-19,
+-6.6130927153957068e-20, -4.2250314570583682e-20, -3.3065463576978534e-20, 8.5725275940314716e-21,
+7.347880794884119e-21, 5.51091059616309e-21, 4.2862637970157358e-21, -1.2858791391047206e-20,
+3.0616169978683832e-21, -7.347880794884119e-21, -7.347880794884119e-21, 1.8369701987210297e-21,
+-5.5109105961630892e-21, 1.8369701987210297e-21, -3.6739403974420595e-21,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.00149, 0.0011100000000000001, 0.00095, -0.00076999999999999996,
+-0.00036000000000000002, -0.00023000000000000001, -0.00018000000000000001, 0.00013999999999999999,
+0.00012, 9.0000000000000006e-05, 6.9999999999999994e-05, -6.9999999999999994e-05,
+5.0000000000000002e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, 3.0000000000000001e-05, -2.0000000000000002e-05,
+};
+
+const struct elp_table elp36 = {
+    arg, max_arg, amp, c, s, 19
 };
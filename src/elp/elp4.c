@@ -1,350 +1,351 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp4[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 270.000000, 0.000030, 0.075000},
-{0.000000, {0.000000, 0.000000, 0.000000, 2.000000}, 0.000000, 0.000370, 0.037000},
-{0.000000, {0.000000, 0.000000, 1.000000, -2.000000}, 180.000000, 0.004800, 0.074000},
-{0.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 90.000000, 0.000010, 5.997000},
-{0.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 0.000000, 0.000850, 2.998000},
-{0.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 180.000000, 0.000250, 0.038000},
-{0.000000, {0.000000, 0.000000, 3.000000, -2.000000}, 0.000000, 0.000030, 0.077000},
-{0.000000, {0.000000, 0.000000, 3.000000, 0.000000}, 180.000000, 0.000020, 0.025000},
-{0.000000, {0.000000, 0.000000, 4.000000, 0.000000}, 180.000000, 0.000010, 0.019000},
-{0.000000, {0.000000, 1.000000, -2.000000, 0.000000}, 180.000000, 0.000030, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 180.000000, 0.000480, 0.082000},
-{0.000000, {0.000000, 1.000000, -1.000000, 2.000000}, 180.000000, 0.000010, 0.069000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000470, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, -2.000000}, 180.000000, 0.000050, 0.079000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 180.000000, 0.000190, 0.070000},
-{0.000000, {0.000000, 1.000000, 2.000000, 0.000000}, 180.000000, 0.000010, 0.036000},
-{0.000000, {0.000000, 2.000000, -1.000000, 0.000000}, 180.000000, 0.000030, 0.089000},
-{0.000000, {1.000000, -1.000000, -1.000000, 0.000000}, 180.000000, 0.000010, 0.530000},
-{0.000000, {1.000000, -1.000000, 0.000000, 0.000000}, 180.000000, 0.000150, 0.088000},
-{0.000000, {1.000000, -1.000000, 1.000000, 0.000000}, 180.000000, 0.000010, 0.041000},
-{0.000000, {1.000000, 0.000000, -2.000000, 0.000000}, 180.000000, 0.000010, 0.071000},
-{0.000000, {1.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000040, 1.127000},
-{0.000000, {1.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000010, 0.069000},
-{0.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.001000, 0.081000},
-{0.000000, {1.000000, 0.000000, 1.000000, 0.000000}, 180.000000, 0.000060, 0.039000},
-{0.000000, {1.000000, 1.000000, -1.000000, 0.000000}, 0.000000, 0.000190, 8.850000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000700, 0.075000},
-{0.000000, {1.000000, 1.000000, 1.000000, 0.000000}, 180.000000, 0.000050, 0.038000},
-{0.000000, {2.000000, -1.000000, -2.000000, 0.000000}, 180.000000, 0.000020, 0.360000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 0.000000, 0.000610, 0.095000},
-{0.000000, {2.000000, -1.000000, 0.000000, -2.000000}, 0.000000, 0.000020, 0.322000},
-{0.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 0.000000, 0.000010, 0.042000},
-{0.000000, {2.000000, -1.000000, 1.000000, -2.000000}, 0.000000, 0.000040, 0.099000},
-{0.000000, {2.000000, 0.000000, -3.000000, 2.000000}, 180.000000, 0.000010, 0.085000},
-{0.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 180.000000, 0.000770, 0.564000},
-{0.000000, {2.000000, 0.000000, -2.000000, 2.000000}, 0.000000, 0.000060, 0.040000},
-{0.000000, {2.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.000050, 0.065000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.022060, 0.087000},
-{0.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000640, 0.474000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.001020, 0.040000},
-{0.000000, {2.000000, 0.000000, 1.000000, -2.000000}, 0.000000, 0.000890, 0.090000},
-{0.000000, {2.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000040, 0.026000},
-{0.000000, {2.000000, 0.000000, 2.000000, -2.000000}, 0.000000, 0.000070, 0.041000},
-{0.000000, {2.000000, 1.000000, -2.000000, 0.000000}, 0.000000, 0.000060, 1.292000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 180.000000, 0.000060, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, -2.000000}, 180.000000, 0.000020, 0.903000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000010, 0.039000},
-{0.000000, {2.000000, 2.000000, -1.000000, 0.000000}, 0.000000, 0.000090, 0.074000},
-{0.000000, {3.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000010, 0.042000},
-{0.000000, {4.000000, -1.000000, -2.000000, 0.000000}, 0.000000, 0.000020, 0.046000},
-{0.000000, {4.000000, -1.000000, -1.000000, 0.000000}, 0.000000, 0.000020, 0.028000},
-{0.000000, {4.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000260, 0.044000},
-{0.000000, {4.000000, 0.000000, -1.000000, -2.000000}, 0.000000, 0.000020, 0.107000},
-{0.000000, {4.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000190, 0.028000},
-{0.000000, {4.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000020, 0.044000},
-{0.000000, {4.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000020, 0.020000},
-{0.000000, {4.000000, 0.000000, 1.000000, -2.000000}, 0.000000, 0.000010, 0.028000},
-{1.000000, {-6.000000, 0.000000, 0.000000, -1.000000}, 0.001000, 0.000010, 0.013000},
-{1.000000, {-6.000000, 0.000000, 1.000000, -1.000000}, 0.001000, 0.000030, 0.016000},
-{1.000000, {-6.000000, 0.000000, 2.000000, -1.000000}, 0.000680, 0.000030, 0.021000},
-{1.000000, {-6.000000, 0.000000, 3.000000, -1.000000}, 0.000360, 0.000010, 0.029000},
-{1.000000, {-4.000000, -1.000000, 0.000000, -1.000000}, 180.001030, 0.000010, 0.020000},
-{1.000000, {-4.000000, -1.000000, 1.000000, -1.000000}, 180.000810, 0.000020, 0.027000},
-{1.000000, {-4.000000, -1.000000, 1.000000, 1.000000}, 180.000720, 0.000020, 0.096000},
-{1.000000, {-4.000000, 0.000000, -2.000000, -1.000000}, 0.000990, 0.000020, 0.013000},
-{1.000000, {-4.000000, 0.000000, -2.000000, 1.000000}, 180.000500, 0.000010, 0.020000},
-{1.000000, {-4.000000, 0.000000, -1.000000, -1.000000}, 0.001090, 0.000140, 0.016000},
-{1.000000, {-4.000000, 0.000000, -1.000000, 1.000000}, 180.000500, 0.000090, 0.028000},
-{1.000000, {-4.000000, 0.000000, 0.000000, -1.000000}, 0.001000, 0.000750, 0.020000},
-{1.000000, {-4.000000, 0.000000, 0.000000, 1.000000}, 180.000170, 0.000110, 0.044000},
-{1.000000, {-4.000000, 0.000000, 1.000000, -3.000000}, 180.000930, 0.000020, 0.016000},
-{1.000000, {-4.000000, 0.000000, 1.000000, -1.000000}, 0.000800, 0.001410, 0.028000},
-{1.000000, {-4.000000, 0.000000, 1.000000, 1.000000}, 0.000910, 0.000220, 0.106000},
-{1.000000, {-4.000000, 0.000000, 2.000000, -3.000000}, 180.000910, 0.000010, 0.020000},
-{1.000000, {-4.000000, 0.000000, 2.000000, -1.000000}, 0.000290, 0.000650, 0.043000},
-{1.000000, {-4.000000, 1.000000, -1.000000, -1.000000}, 0.000980, 0.000020, 0.016000},
-{1.000000, {-4.000000, 1.000000, 0.000000, -1.000000}, 0.000990, 0.000100, 0.021000},
-{1.000000, {-4.000000, 1.000000, 1.000000, -1.000000}, 0.000800, 0.000170, 0.028000},
-{1.000000, {-4.000000, 1.000000, 1.000000, 1.000000}, 0.000820, 0.000020, 0.119000},
-{1.000000, {-4.000000, 1.000000, 2.000000, -1.000000}, 0.000300, 0.000060, 0.045000},
-{1.000000, {-4.000000, 2.000000, 0.000000, -1.000000}, 0.000940, 0.000010, 0.021000},
-{1.000000, {-4.000000, 2.000000, 1.000000, -1.000000}, 0.000980, 0.000010, 0.029000},
-{1.000000, {-3.000000, 0.000000, 0.000000, -1.000000}, 0.000820, 0.000040, 0.027000},
-{1.000000, {-3.000000, 0.000000, 0.000000, 1.000000}, 180.000730, 0.000230, 0.097000},
-{1.000000, {-3.000000, 0.000000, 1.000000, -1.000000}, 180.000680, 0.000060, 0.042000},
-{1.000000, {-3.000000, 0.000000, 1.000000, 1.000000}, 180.000720, 0.000030, 0.340000},
-{1.000000, {-3.000000, 1.000000, 0.000000, 1.000000}, 180.000720, 0.000020, 0.107000},
-{1.000000, {-2.000000, -2.000000, 1.000000, -1.000000}, 180.000310, 0.000020, 0.074000},
-{1.000000, {-2.000000, -2.000000, 1.000000, 1.000000}, 180.000290, 0.000010, 0.075000},
-{1.000000, {-2.000000, -1.000000, -2.000000, -1.000000}, 180.001230, 0.000020, 0.019000},
-{1.000000, {-2.000000, -1.000000, -2.000000, 1.000000}, 0.000560, 0.000010, 0.039000},
-{1.000000, {-2.000000, -1.000000, -1.000000, -1.000000}, 180.001190, 0.000120, 0.026000},
-{1.000000, {-2.000000, -1.000000, -1.000000, 1.000000}, 0.000650, 0.000090, 0.082000},
-{1.000000, {-2.000000, -1.000000, 0.000000, -1.000000}, 180.001090, 0.000530, 0.039000},
-{1.000000, {-2.000000, -1.000000, 0.000000, 1.000000}, 180.000760, 0.001230, 0.949000},
-{1.000000, {-2.000000, -1.000000, 1.000000, -1.000000}, 180.000470, 0.000530, 0.080000},
-{1.000000, {-2.000000, -1.000000, 2.000000, -1.000000}, 180.001480, 0.000060, 1.388000},
-{1.000000, {-2.000000, 0.000000, -3.000000, -1.000000}, 0.001220, 0.000090, 0.015000},
-{1.000000, {-2.000000, 0.000000, -3.000000, 1.000000}, 180.000440, 0.000050, 0.027000},
-{1.000000, {-2.000000, 0.000000, -2.000000, -3.000000}, 180.000930, 0.000010, 0.013000},
-{1.000000, {-2.000000, 0.000000, -2.000000, -1.000000}, 0.001190, 0.000970, 0.019000},
-{1.000000, {-2.000000, 0.000000, -2.000000, 1.000000}, 180.000500, 0.000650, 0.041000},
-{1.000000, {-2.000000, 0.000000, -1.000000, -3.000000}, 180.001010, 0.000080, 0.015000},
-{1.000000, {-2.000000, 0.000000, -1.000000, -1.000000}, 0.001130, 0.009130, 0.026000},
-{1.000000, {-2.000000, 0.000000, -1.000000, 1.000000}, 180.000490, 0.008870, 0.089000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -3.000000}, 180.000920, 0.000370, 0.019000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -1.000000}, 0.001000, 0.065690, 0.040000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000060, 0.088000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 1.000000}, 0.000760, 0.047460, 0.487000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 3.000000}, 180.000770, 0.000130, 0.035000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -3.000000}, 180.000730, 0.000440, 0.026000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -1.000000}, 0.000290, 0.049620, 0.087000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 1.000000}, 0.000450, 0.000260, 0.065000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 3.000000}, 180.000760, 0.000010, 0.024000},
-{1.000000, {-2.000000, 0.000000, 2.000000, -3.000000}, 180.000430, 0.000010, 0.040000},
-{1.000000, {-2.000000, 0.000000, 2.000000, -1.000000}, 180.002080, 0.002490, 0.581000},
-{1.000000, {-2.000000, 0.000000, 2.000000, 1.000000}, 180.000700, 0.000480, 0.035000},
-{1.000000, {-2.000000, 0.000000, 3.000000, -1.000000}, 180.001550, 0.000450, 0.067000},
-{1.000000, {-2.000000, 0.000000, 3.000000, 1.000000}, 180.000730, 0.000080, 0.024000},
-{1.000000, {-2.000000, 0.000000, 4.000000, -1.000000}, 180.001450, 0.000050, 0.035000},
-{1.000000, {-2.000000, 1.000000, -2.000000, -1.000000}, 0.001180, 0.000080, 0.020000},
-{1.000000, {-2.000000, 1.000000, -2.000000, 1.000000}, 180.000490, 0.000040, 0.043000},
-{1.000000, {-2.000000, 1.000000, -1.000000, -1.000000}, 0.001110, 0.000720, 0.027000},
-{1.000000, {-2.000000, 1.000000, -1.000000, 1.000000}, 180.000520, 0.000490, 0.098000},
-{1.000000, {-2.000000, 1.000000, 0.000000, -3.000000}, 180.000910, 0.000030, 0.020000},
-{1.000000, {-2.000000, 1.000000, 0.000000, -1.000000}, 0.000980, 0.004820, 0.042000},
-{1.000000, {-2.000000, 1.000000, 0.000000, 1.000000}, 0.000750, 0.001870, 0.327000},
-{1.000000, {-2.000000, 1.000000, 1.000000, -3.000000}, 180.000890, 0.000020, 0.027000},
-{1.000000, {-2.000000, 1.000000, 1.000000, -1.000000}, 0.000310, 0.002250, 0.095000},
-{1.000000, {-2.000000, 1.000000, 1.000000, 1.000000}, 180.000780, 0.000050, 0.061000},
-{1.000000, {-2.000000, 1.000000, 2.000000, -1.000000}, 180.002250, 0.000090, 0.368000},
-{1.000000, {-2.000000, 1.000000, 2.000000, 1.000000}, 180.000710, 0.000030, 0.034000},
-{1.000000, {-2.000000, 1.000000, 3.000000, -1.000000}, 180.001640, 0.000010, 0.063000},
-{1.000000, {-2.000000, 2.000000, -1.000000, -1.000000}, 0.001110, 0.000040, 0.028000},
-{1.000000, {-2.000000, 2.000000, -1.000000, 1.000000}, 180.000540, 0.000020, 0.109000},
-{1.000000, {-2.000000, 2.000000, 0.000000, -1.000000}, 0.000970, 0.000240, 0.044000},
-{1.000000, {-2.000000, 2.000000, 0.000000, 1.000000}, 0.000720, 0.000060, 0.247000},
-{1.000000, {-2.000000, 2.000000, 1.000000, -1.000000}, 0.000310, 0.000080, 0.105000},
-{1.000000, {-2.000000, 3.000000, 0.000000, -1.000000}, 0.000940, 0.000010, 0.046000},
-{1.000000, {-1.000000, -1.000000, -1.000000, -1.000000}, 0.001220, 0.000040, 0.037000},
-{1.000000, {-1.000000, -1.000000, 0.000000, -1.000000}, 0.001070, 0.000190, 0.075000},
-{1.000000, {-1.000000, -1.000000, 0.000000, 1.000000}, 0.000000, 0.000010, 0.075000},
-{1.000000, {-1.000000, -1.000000, 1.000000, -1.000000}, 180.001490, 0.000010, 5.998000},
-{1.000000, {-1.000000, 0.000000, -2.000000, -1.000000}, 180.001310, 0.000030, 0.026000},
-{1.000000, {-1.000000, 0.000000, -1.000000, -1.000000}, 180.001310, 0.000230, 0.039000},
-{1.000000, {-1.000000, 0.000000, -1.000000, 1.000000}, 180.001220, 0.000020, 0.857000},
-{1.000000, {-1.000000, 0.000000, 0.000000, -3.000000}, 0.000930, 0.000010, 0.025000},
-{1.000000, {-1.000000, 0.000000, 0.000000, -1.000000}, 180.001340, 0.000750, 0.081000},
-{1.000000, {-1.000000, 0.000000, 0.000000, 1.000000}, 180.000670, 0.000560, 0.069000},
-{1.000000, {-1.000000, 0.000000, 1.000000, -1.000000}, 0.001270, 0.000280, 1.200000},
-{1.000000, {-1.000000, 0.000000, 1.000000, 1.000000}, 180.000720, 0.000020, 0.036000},
-{1.000000, {-1.000000, 0.000000, 2.000000, -1.000000}, 0.001290, 0.000060, 0.071000},
-{1.000000, {-1.000000, 1.000000, 0.000000, -1.000000}, 179.999900, 0.000040, 0.088000},
-{1.000000, {-1.000000, 1.000000, 0.000000, 1.000000}, 180.000720, 0.000010, 0.065000},
-{1.000000, {0.000000, -2.000000, -1.000000, -1.000000}, 180.001380, 0.000020, 0.065000},
-{1.000000, {0.000000, -2.000000, 0.000000, -1.000000}, 0.000720, 0.000030, 0.487000},
-{1.000000, {0.000000, -2.000000, 1.000000, -1.000000}, 0.001160, 0.000070, 0.089000},
-{1.000000, {0.000000, -1.000000, -3.000000, -1.000000}, 180.001330, 0.000030, 0.024000},
-{1.000000, {0.000000, -1.000000, -2.000000, -1.000000}, 180.001330, 0.000290, 0.036000},
-{1.000000, {0.000000, -1.000000, -2.000000, 1.000000}, 0.000250, 0.000030, 1.389000},
-{1.000000, {0.000000, -1.000000, -1.000000, -3.000000}, 0.000900, 0.000010, 0.024000},
-{1.000000, {0.000000, -1.000000, -1.000000, -1.000000}, 180.001410, 0.001870, 0.070000},
-{1.000000, {0.000000, -1.000000, -1.000000, 1.000000}, 359.999280, 0.000080, 0.080000},
-{1.000000, {0.000000, -1.000000, 0.000000, -3.000000}, 0.000920, 0.000010, 0.036000},
-{1.000000, {0.000000, -1.000000, 0.000000, -1.000000}, 0.000670, 0.002820, 0.949000},
-{1.000000, {0.000000, -1.000000, 0.000000, 1.000000}, 0.000450, 0.000100, 0.039000},
-{1.000000, {0.000000, -1.000000, 1.000000, -1.000000}, 0.001180, 0.003870, 0.082000},
-{1.000000, {0.000000, -1.000000, 1.000000, 1.000000}, 0.000700, 0.000260, 0.026000},
-{1.000000, {0.000000, -1.000000, 2.000000, -1.000000}, 0.001220, 0.000470, 0.039000},
-{1.000000, {0.000000, -1.000000, 2.000000, 1.000000}, 0.000700, 0.000040, 0.019000},
-{1.000000, {0.000000, -1.000000, 3.000000, -1.000000}, 0.001220, 0.000050, 0.026000},
-{1.000000, {0.000000, 0.000000, -5.000000, -1.000000}, 0.001270, 0.000010, 0.015000},
-{1.000000, {0.000000, 0.000000, -4.000000, -1.000000}, 0.001290, 0.000160, 0.019000},
-{1.000000, {0.000000, 0.000000, -3.000000, -3.000000}, 180.001130, 0.000030, 0.015000},
-{1.000000, {0.000000, 0.000000, -3.000000, -1.000000}, 0.001290, 0.002280, 0.025000},
-{1.000000, {0.000000, 0.000000, -3.000000, 1.000000}, 180.000290, 0.000130, 0.077000},
-{1.000000, {0.000000, 0.000000, -2.000000, -3.000000}, 180.001090, 0.000320, 0.019000},
-{1.000000, {0.000000, 0.000000, -2.000000, -1.000000}, 0.001280, 0.032790, 0.038000},
-{1.000000, {0.000000, 0.000000, -2.000000, 1.000000}, 180.000240, 0.003870, 3.574000},
-{1.000000, {0.000000, 0.000000, -1.000000, -3.000000}, 180.001020, 0.002610, 0.025000},
-{1.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 0.001270, 0.491410, 0.075000},
-{1.000000, {0.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000100, 8.847000},
-{1.000000, {0.000000, 0.000000, -1.000000, 1.000000}, 0.000510, 0.050360, 0.074000},
-{1.000000, {0.000000, 0.000000, -1.000000, 3.000000}, 180.000600, 0.000170, 0.025000},
-{1.000000, {0.000000, 0.000000, 0.000000, -5.000000}, 0.000860, 0.000030, 0.019000},
-{1.000000, {0.000000, 0.000000, 0.000000, -3.000000}, 180.000860, 0.014920, 0.037000},
-{1.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 0.000940, 7.063040, 18.613000},
-{1.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000270, 0.075000},
-{1.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 0.000710, 0.360610, 0.037000},
-{1.000000, {0.000000, 0.000000, 0.000000, 3.000000}, 180.000710, 0.000740, 0.019000},
-{1.000000, {0.000000, 0.000000, 1.000000, -3.000000}, 180.000540, 0.000500, 0.073000},
-{1.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 0.001270, 0.493310, 0.076000},
-{1.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 270.000000, 0.000020, 0.038000},
-{1.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 0.000700, 0.038380, 0.025000},
-{1.000000, {0.000000, 0.000000, 1.000000, 3.000000}, 180.000740, 0.000150, 0.015000},
-{1.000000, {0.000000, 0.000000, 2.000000, -3.000000}, 180.000610, 0.000040, 2.582000},
-{1.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 0.001260, 0.034020, 0.038000},
-{1.000000, {0.000000, 0.000000, 2.000000, 1.000000}, 0.000690, 0.003310, 0.019000},
-{1.000000, {0.000000, 0.000000, 2.000000, 3.000000}, 180.000730, 0.000020, 0.012000},
-{1.000000, {0.000000, 0.000000, 3.000000, -1.000000}, 0.001250, 0.002420, 0.025000},
-{1.000000, {0.000000, 0.000000, 3.000000, 1.000000}, 0.000670, 0.000270, 0.015000},
-{1.000000, {0.000000, 0.000000, 4.000000, -1.000000}, 0.001250, 0.000170, 0.019000},
-{1.000000, {0.000000, 0.000000, 4.000000, 1.000000}, 0.000670, 0.000020, 0.013000},
-{1.000000, {0.000000, 0.000000, 5.000000, -1.000000}, 0.001270, 0.000010, 0.015000},
-{1.000000, {0.000000, 1.000000, -3.000000, -1.000000}, 0.001330, 0.000040, 0.026000},
-{1.000000, {0.000000, 1.000000, -2.000000, -1.000000}, 0.001350, 0.000370, 0.039000},
-{1.000000, {0.000000, 1.000000, -2.000000, 1.000000}, 180.000500, 0.000030, 0.781000},
-{1.000000, {0.000000, 1.000000, -1.000000, -3.000000}, 180.000900, 0.000010, 0.026000},
-{1.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 0.001430, 0.002490, 0.081000},
-{1.000000, {0.000000, 1.000000, -1.000000, 1.000000}, 0.002720, 0.000020, 0.069000},
-{1.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 180.000790, 0.002400, 1.057000},
-{1.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 180.000760, 0.000340, 0.036000},
-{1.000000, {0.000000, 1.000000, 1.000000, -1.000000}, 180.001160, 0.002920, 0.070000},
-{1.000000, {0.000000, 1.000000, 1.000000, 1.000000}, 180.000730, 0.000220, 0.024000},
-{1.000000, {0.000000, 1.000000, 2.000000, -1.000000}, 180.001210, 0.000370, 0.036000},
-{1.000000, {0.000000, 1.000000, 2.000000, 1.000000}, 180.000710, 0.000040, 0.018000},
-{1.000000, {0.000000, 1.000000, 3.000000, -1.000000}, 180.001220, 0.000040, 0.025000},
-{1.000000, {0.000000, 2.000000, -1.000000, -1.000000}, 0.001460, 0.000040, 0.088000},
-{1.000000, {0.000000, 2.000000, 0.000000, -1.000000}, 180.000720, 0.000030, 0.514000},
-{1.000000, {0.000000, 2.000000, 1.000000, -1.000000}, 180.001190, 0.000030, 0.066000},
-{1.000000, {1.000000, -1.000000, 0.000000, -1.000000}, 180.000800, 0.000030, 0.088000},
-{1.000000, {1.000000, 0.000000, -2.000000, -1.000000}, 0.001820, 0.000030, 0.070000},
-{1.000000, {1.000000, 0.000000, -1.000000, -1.000000}, 179.999290, 0.000110, 1.063000},
-{1.000000, {1.000000, 0.000000, -1.000000, 1.000000}, 180.000520, 0.000020, 0.039000},
-{1.000000, {1.000000, 0.000000, 0.000000, -1.000000}, 180.000880, 0.003420, 0.081000},
-{1.000000, {1.000000, 0.000000, 0.000000, 1.000000}, 180.000720, 0.000210, 0.026000},
-{1.000000, {1.000000, 0.000000, 1.000000, -1.000000}, 180.001040, 0.000430, 0.039000},
-{1.000000, {1.000000, 0.000000, 1.000000, 1.000000}, 180.000710, 0.000040, 0.019000},
-{1.000000, {1.000000, 0.000000, 2.000000, -1.000000}, 180.001100, 0.000040, 0.026000},
-{1.000000, {1.000000, 1.000000, -1.000000, -1.000000}, 180.000070, 0.000060, 16.874000},
-{1.000000, {1.000000, 1.000000, 0.000000, -1.000000}, 0.000590, 0.000640, 0.075000},
-{1.000000, {1.000000, 1.000000, 0.000000, 1.000000}, 0.000720, 0.000030, 0.025000},
-{1.000000, {1.000000, 1.000000, 1.000000, -1.000000}, 0.000850, 0.000070, 0.038000},
-{1.000000, {2.000000, -3.000000, 0.000000, -1.000000}, 0.000940, 0.000010, 0.046000},
-{1.000000, {2.000000, -2.000000, -1.000000, -1.000000}, 0.000400, 0.000100, 0.106000},
-{1.000000, {2.000000, -2.000000, -1.000000, 1.000000}, 0.000720, 0.000010, 0.028000},
-{1.000000, {2.000000, -2.000000, 0.000000, -1.000000}, 0.000900, 0.000310, 0.044000},
-{1.000000, {2.000000, -2.000000, 0.000000, 1.000000}, 0.000720, 0.000020, 0.020000},
-{1.000000, {2.000000, -2.000000, 1.000000, -1.000000}, 0.001040, 0.000050, 0.028000},
-{1.000000, {2.000000, -1.000000, -3.000000, -1.000000}, 180.001620, 0.000010, 0.062000},
-{1.000000, {2.000000, -1.000000, -2.000000, -1.000000}, 180.002960, 0.000060, 0.354000},
-{1.000000, {2.000000, -1.000000, -2.000000, 1.000000}, 0.000510, 0.000030, 0.042000},
-{1.000000, {2.000000, -1.000000, -1.000000, -1.000000}, 0.000410, 0.002880, 0.096000},
-{1.000000, {2.000000, -1.000000, -1.000000, 1.000000}, 0.000690, 0.000370, 0.027000},
-{1.000000, {2.000000, -1.000000, 0.000000, -1.000000}, 0.000910, 0.006460, 0.042000},
-{1.000000, {2.000000, -1.000000, 0.000000, 1.000000}, 0.000720, 0.000310, 0.020000},
-{1.000000, {2.000000, -1.000000, 1.000000, -1.000000}, 0.001030, 0.000910, 0.027000},
-{1.000000, {2.000000, -1.000000, 1.000000, 1.000000}, 0.000690, 0.000060, 0.016000},
-{1.000000, {2.000000, -1.000000, 2.000000, -1.000000}, 0.001060, 0.000100, 0.020000},
-{1.000000, {2.000000, 0.000000, -4.000000, -1.000000}, 180.001530, 0.000050, 0.035000},
-{1.000000, {2.000000, 0.000000, -3.000000, -1.000000}, 180.001730, 0.000370, 0.066000},
-{1.000000, {2.000000, 0.000000, -3.000000, 1.000000}, 180.000030, 0.000050, 0.085000},
-{1.000000, {2.000000, 0.000000, -2.000000, -3.000000}, 0.001210, 0.000020, 0.035000},
-{1.000000, {2.000000, 0.000000, -2.000000, -1.000000}, 180.003220, 0.001420, 0.547000},
-{1.000000, {2.000000, 0.000000, -2.000000, 1.000000}, 0.000520, 0.000670, 0.040000},
-{1.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 0.000420, 0.064560, 0.088000},
-{1.000000, {2.000000, 0.000000, -1.000000, 1.000000}, 0.000710, 0.008150, 0.026000},
-{1.000000, {2.000000, 0.000000, -1.000000, 3.000000}, 180.000360, 0.000040, 0.015000},
-{1.000000, {2.000000, 0.000000, 0.000000, -3.000000}, 179.998270, 0.000060, 0.463000},
-{1.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 0.000900, 0.096420, 0.041000},
-{1.000000, {2.000000, 0.000000, 0.000000, 1.000000}, 0.000700, 0.004800, 0.019000},
-{1.000000, {2.000000, 0.000000, 0.000000, 3.000000}, 180.000380, 0.000020, 0.013000},
-{1.000000, {2.000000, 0.000000, 1.000000, -3.000000}, 180.001140, 0.000140, 0.090000},
-{1.000000, {2.000000, 0.000000, 1.000000, -1.000000}, 0.001020, 0.012340, 0.026000},
-{1.000000, {2.000000, 0.000000, 1.000000, 1.000000}, 0.000700, 0.000800, 0.015000},
-{1.000000, {2.000000, 0.000000, 2.000000, -3.000000}, 180.001180, 0.000020, 0.041000},
-{1.000000, {2.000000, 0.000000, 2.000000, -1.000000}, 0.001070, 0.001260, 0.020000},
-{1.000000, {2.000000, 0.000000, 2.000000, 1.000000}, 0.000730, 0.000090, 0.013000},
-{1.000000, {2.000000, 0.000000, 3.000000, -1.000000}, 0.001110, 0.000120, 0.016000},
-{1.000000, {2.000000, 0.000000, 3.000000, 1.000000}, 0.000620, 0.000010, 0.011000},
-{1.000000, {2.000000, 1.000000, -1.000000, -1.000000}, 180.000040, 0.000170, 0.080000},
-{1.000000, {2.000000, 1.000000, -1.000000, 1.000000}, 180.000730, 0.000060, 0.025000},
-{1.000000, {2.000000, 1.000000, 0.000000, -1.000000}, 180.000880, 0.001130, 0.039000},
-{1.000000, {2.000000, 1.000000, 0.000000, 1.000000}, 180.000730, 0.000050, 0.019000},
-{1.000000, {2.000000, 1.000000, 1.000000, -1.000000}, 180.000980, 0.000210, 0.026000},
-{1.000000, {2.000000, 1.000000, 1.000000, 1.000000}, 180.000990, 0.000010, 0.015000},
-{1.000000, {2.000000, 1.000000, 2.000000, -1.000000}, 180.001050, 0.000030, 0.019000},
-{1.000000, {2.000000, 2.000000, -1.000000, -1.000000}, 180.000330, 0.000050, 0.074000},
-{1.000000, {3.000000, 0.000000, -2.000000, -1.000000}, 179.999610, 0.000010, 0.095000},
-{1.000000, {3.000000, 0.000000, -1.000000, -1.000000}, 180.000700, 0.000130, 0.042000},
-{1.000000, {3.000000, 0.000000, -1.000000, 1.000000}, 180.000720, 0.000010, 0.020000},
-{1.000000, {3.000000, 1.000000, -1.000000, -1.000000}, 0.000730, 0.000010, 0.040000},
-{1.000000, {3.000000, 1.000000, 0.000000, -1.000000}, 0.000880, 0.000010, 0.026000},
-{1.000000, {4.000000, -2.000000, -1.000000, -1.000000}, 0.000910, 0.000020, 0.029000},
-{1.000000, {4.000000, -2.000000, 0.000000, -1.000000}, 0.000940, 0.000010, 0.021000},
-{1.000000, {4.000000, -1.000000, -2.000000, -1.000000}, 0.000410, 0.000080, 0.046000},
-{1.000000, {4.000000, -1.000000, -2.000000, 1.000000}, 0.000920, 0.000010, 0.021000},
-{1.000000, {4.000000, -1.000000, -1.000000, -1.000000}, 0.000770, 0.000240, 0.028000},
-{1.000000, {4.000000, -1.000000, -1.000000, 1.000000}, 0.000710, 0.000020, 0.016000},
-{1.000000, {4.000000, -1.000000, 0.000000, -1.000000}, 0.000900, 0.000150, 0.021000},
-{1.000000, {4.000000, -1.000000, 1.000000, -1.000000}, 0.000910, 0.000030, 0.016000},
-{1.000000, {4.000000, 0.000000, -3.000000, -1.000000}, 359.998180, 0.000010, 0.104000},
-{1.000000, {4.000000, 0.000000, -3.000000, 1.000000}, 0.000560, 0.000010, 0.027000},
-{1.000000, {4.000000, 0.000000, -2.000000, -1.000000}, 0.000420, 0.000880, 0.044000},
-{1.000000, {4.000000, 0.000000, -2.000000, 1.000000}, 0.000700, 0.000140, 0.020000},
-{1.000000, {4.000000, 0.000000, -1.000000, -1.000000}, 0.000780, 0.002170, 0.028000},
-{1.000000, {4.000000, 0.000000, -1.000000, 1.000000}, 0.000710, 0.000160, 0.016000},
-{1.000000, {4.000000, 0.000000, 0.000000, -1.000000}, 0.000900, 0.001150, 0.020000},
-{1.000000, {4.000000, 0.000000, 0.000000, 1.000000}, 0.000720, 0.000060, 0.013000},
-{1.000000, {4.000000, 0.000000, 1.000000, -1.000000}, 0.000980, 0.000210, 0.016000},
-{1.000000, {4.000000, 0.000000, 1.000000, 1.000000}, 0.000380, 0.000010, 0.011000},
-{1.000000, {4.000000, 0.000000, 2.000000, -1.000000}, 0.000930, 0.000030, 0.013000},
-{1.000000, {4.000000, 1.000000, -1.000000, -1.000000}, 180.000770, 0.000040, 0.027000},
-{1.000000, {4.000000, 1.000000, 0.000000, -1.000000}, 180.000890, 0.000030, 0.020000},
-{1.000000, {6.000000, 0.000000, -3.000000, -1.000000}, 0.000370, 0.000010, 0.029000},
-{1.000000, {6.000000, 0.000000, -2.000000, -1.000000}, 0.000670, 0.000040, 0.021000},
-{1.000000, {6.000000, 0.000000, -1.000000, -1.000000}, 0.000900, 0.000040, 0.016000},
-{1.000000, {6.000000, 0.000000, 0.000000, -1.000000}, 0.000900, 0.000020, 0.013000},
-{2.000000, {-2.000000, -1.000000, 0.000000, 0.000000}, 0.000000, 0.000010, 1.000000},
-{2.000000, {-2.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.000040, 0.026000},
-{2.000000, {-2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000130, 0.089000},
-{2.000000, {-2.000000, 0.000000, 0.000000, -2.000000}, 180.000000, 0.000270, 0.040000},
-{2.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000430, 0.500000},
-{2.000000, {-2.000000, 0.000000, 1.000000, -2.000000}, 180.000000, 0.000250, 0.086000},
-{2.000000, {-2.000000, 0.000000, 1.000000, 0.000000}, 180.000000, 0.000020, 0.066000},
-{2.000000, {-2.000000, 0.000000, 2.000000, -2.000000}, 0.000000, 0.000010, 0.600000},
-{2.000000, {-2.000000, 1.000000, 0.000000, -2.000000}, 180.000000, 0.000020, 0.042000},
-{2.000000, {-2.000000, 1.000000, 0.000000, 0.000000}, 180.000000, 0.000030, 0.333000},
-{2.000000, {-2.000000, 1.000000, 1.000000, -2.000000}, 180.000000, 0.000010, 0.094000},
-{2.000000, {0.000000, -1.000000, 0.000000, -2.000000}, 180.000000, 0.000030, 0.903000},
-{2.000000, {0.000000, -1.000000, 1.000000, -2.000000}, 180.000000, 0.000020, 0.082000},
-{2.000000, {0.000000, 0.000000, -2.000000, -2.000000}, 180.000000, 0.000160, 0.038000},
-{2.000000, {0.000000, 0.000000, -2.000000, 0.000000}, 0.000000, 0.000090, 4.424000},
-{2.000000, {0.000000, 0.000000, -1.000000, -4.000000}, 0.000000, 0.000010, 0.025000},
-{2.000000, {0.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.002390, 0.075000},
-{2.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 270.000000, 0.000010, 16.863000},
-{2.000000, {0.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000800, 0.074000},
-{2.000000, {0.000000, 0.000000, 0.000000, -4.000000}, 0.000000, 0.000070, 0.037000},
-{2.000000, {0.000000, 0.000000, 0.000000, -2.000000}, 180.000000, 0.036380, 9.307000},
-{2.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 90.000000, 0.000030, 0.075000},
-{2.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.002390, 0.037000},
-{2.000000, {0.000000, 0.000000, 1.000000, -2.000000}, 180.000000, 0.002410, 0.076000},
-{2.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 180.000000, 0.000250, 0.025000},
-{2.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 180.000000, 0.000170, 0.038000},
-{2.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 180.000000, 0.000020, 0.019000},
-{2.000000, {0.000000, 1.000000, 0.000000, -2.000000}, 0.000000, 0.000020, 1.120000},
-{2.000000, {0.000000, 1.000000, 1.000000, -2.000000}, 0.000000, 0.000010, 0.071000},
-{2.000000, {1.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000020, 0.082000},
-{2.000000, {1.000000, 1.000000, 0.000000, -2.000000}, 180.000000, 0.000040, 0.075000},
-{2.000000, {2.000000, -1.000000, -1.000000, -2.000000}, 180.000000, 0.000020, 0.096000},
-{2.000000, {2.000000, -1.000000, 0.000000, -2.000000}, 180.000000, 0.000040, 0.042000},
-{2.000000, {2.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.000390, 0.088000},
-{2.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000060, 0.026000},
-{2.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 180.000000, 0.000570, 0.041000},
-{2.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000030, 0.019000},
-{2.000000, {2.000000, 0.000000, 1.000000, -2.000000}, 180.000000, 0.000070, 0.026000},
-{2.000000, {4.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.000010, 0.028000},
+
+static const uint16_t arg[] = {
+1, 2, 3, 6, 9, 13, 14, 15, 16, 17,
+20, 21, 22, 23, 26, 29, 31, 33, 34, 36,
+38, 44, 45, 46, 51, 52, 55, 56, 61, 62,
+64, 67, 70, 71, 72, 73, 75, 76, 74, 78,
+80, 82, 88, 89, 94, 95, 98, 100, 102, 103,
+109, 110, 111, 113, 115, 116, 118, 121, 122, 125,
+126, 127, 128, 129, 131, 132, 134, 135, 136, 137,
+91, 140, 141, 145, 146, 139, 148, 106, 152, 43,
+154, 156, 157, 158, 159, 164, 167, 168, 169, 170,
+171, 172, 174, 181, 183, 184, 186, 190, 0, 192,
+193, 195, 50, 196, 199, 200, 194, 204, 205, 206,
+207, 209, 210, 213, 214, 215, 123, 221, 222, 223,
+231, 232, 233, 234, 235, 239, 240, 241, 244, 245,
+246, 249, 250, 251, 260, 261, 262, 263, 270, 271,
+212, 274, 279, 280, 4, 281, 282, 287, 288, 289,
+290, 291, 292, 293, 302, 303, 304, 305, 306, 307,
+316, 317, 318, 319, 320, 329, 330, 331, 216, 332,
+333, 334, 8, 335, 336, 337, 338, 339, 340, 341,
+342, 343, 356, 357, 358, 359, 360, 243, 361, 362,
+363, 364, 365, 366, 294, 385, 344, 383, 386, 387,
+388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+398, 399, 400, 401, 402, 403, 404, 367, 430, 321,
+405, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+450, 451, 452, 453, 454, 11, 455, 494, 345, 495,
+496, 497, 456, 498, 499, 500, 501, 502, 503, 504,
+505, 506, 507, 508, 509, 510, 511, 487, 490, 512,
+5, 513, 514, 259, 515, 516, 517, 518, 519, 520,
+521, 522, 523, 491, 524, 429, 525, 526, 527, 142,
+585, 586, 346, 587, 588, 589, 590, 101, 591, 228,
+592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+602, 603, 604, 582, 605, 606, 492, 607, 608, 609,
+610, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+630, 631, 632, 633, 47, 634, 635,
+};
+
+static const uint16_t max_arg[] = {
+1, 2, 3, 6, 9, 13, 14, 15, 16, 17,
+20, 21, 22, 23, 26, 29, 31, 33, 34, 36,
+38, 44, 45, 46, 51, 52, 55, 56, 61, 62,
+64, 67, 70, 71, 72, 73, 75, 76, 76, 78,
+80, 82, 88, 89, 94, 95, 98, 100, 102, 103,
+109, 110, 111, 113, 115, 116, 118, 121, 122, 125,
+126, 127, 128, 129, 131, 132, 134, 135, 136, 137,
+137, 140, 141, 145, 146, 146, 148, 148, 152, 152,
+154, 156, 157, 158, 159, 164, 167, 168, 169, 170,
+171, 172, 174, 181, 183, 184, 186, 190, 190, 192,
+193, 195, 195, 196, 199, 200, 200, 204, 205, 206,
+207, 209, 210, 213, 214, 215, 215, 221, 222, 223,
+231, 232, 233, 234, 235, 239, 240, 241, 244, 245,
+246, 249, 250, 251, 260, 261, 262, 263, 270, 271,
+271, 274, 279, 280, 280, 281, 282, 287, 288, 289,
+290, 291, 292, 293, 302, 303, 304, 305, 306, 307,
+316, 317, 318, 319, 320, 329, 330, 331, 331, 332,
+333, 334, 334, 335, 336, 337, 338, 339, 340, 341,
+342, 343, 356, 357, 358, 359, 360, 360, 361, 362,
+363, 364, 365, 366, 366, 385, 385, 385, 386, 387,
+388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+398, 399, 400, 401, 402, 403, 404, 404, 430, 430,
+430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+450, 451, 452, 453, 454, 454, 455, 494, 494, 495,
+496, 497, 497, 498, 499, 500, 501, 502, 503, 504,
+505, 506, 507, 508, 509, 510, 511, 511, 511, 512,
+512, 513, 514, 514, 515, 516, 517, 518, 519, 520,
+521, 522, 523, 523, 524, 524, 525, 526, 527, 527,
+585, 586, 586, 587, 588, 589, 590, 590, 591, 591,
+592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+602, 603, 604, 604, 605, 606, 606, 607, 608, 609,
+610, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+620, 621, 622, 623, 624, 625, 626, 627, 628, 629,
+630, 631, 632, 633, 633, 634, 635,
+};
+
+static const double ELP_ALIGNED amp[] = {
+7.06304, 0.49331000000000003, 0.49141000000000001, 0.36060999999999999,
+0.096420000000000006, 0.065689999999999998, 0.064560000000000006, 0.050360000000000002,
+0.049619999999999997, 0.047460000000000002, 0.038379999999999997, 0.036380000000000003,
+0.034020000000000002, 0.03279, 0.02206, 0.014919999999999999,
+0.01234, 0.0091299999999999992, 0.0088699999999999994, 0.0081499999999999993,
+0.0064599999999999996, 0.0048199999999999996, 0.0047999999999999996, 0.0047999999999999996,
+0.0038700000000000002, 0.0038700000000000002, 0.0034199999999999999, 0.00331,
+0.0029199999999999999, 0.0028800000000000002, 0.00282, 0.0026099999999999999,
+0.00249, 0.00249, 0.0024199999999999998, 0.0024099999999999998,
+0.0023999999999999998, 0.0023900000000000002, 0.0023900000000000002, 0.0022799999999999999,
+0.0022499999999999998, 0.0021700000000000001, 0.0018699999999999999, 0.0018699999999999999,
+0.00142, 0.00141, 0.0012600000000000001, 0.00123,
+0.00115, 0.0011299999999999999, 0.0010200000000000001, 0.001,
+0.00097000000000000005, 0.00091, 0.00088999999999999995, 0.00088000000000000003,
+0.00084999999999999995, 0.00080000000000000004, 0.00080000000000000004, 0.00076999999999999996,
+0.00075000000000000002, 0.00075000000000000002, 0.00073999999999999999, 0.00072000000000000005,
+0.00069999999999999999, 0.00067000000000000002, 0.00064999999999999997, 0.00064999999999999997,
+0.00064000000000000005, 0.00064000000000000005, 0.00060999999999999997, 0.00056999999999999998,
+0.00055999999999999995, 0.00052999999999999998, 0.00052999999999999998, 0.00050000000000000001,
+0.00048999999999999998, 0.00048000000000000001, 0.00048000000000000001, 0.00046999999999999999,
+0.00046999999999999999, 0.00044999999999999999, 0.00044000000000000002, 0.00042999999999999999,
+0.00042999999999999999, 0.00038999999999999999, 0.00036999999999999999, 0.00036999999999999999,
+0.00036999999999999999, 0.00036999999999999999, 0.00036999999999999999, 0.00036999999999999999,
+0.00034000000000000002, 0.00032000000000000003, 0.00031, 0.00031,
+0.00029, 0.00027999999999999998, 0.00027, 0.00027,
+0.00027, 0.00025999999999999998, 0.00025999999999999998, 0.00025999999999999998,
+0.00025000000000000001, 0.00025000000000000001, 0.00025000000000000001, 0.00024000000000000001,
+0.00024000000000000001, 0.00023000000000000001, 0.00023000000000000001, 0.00022000000000000001,
+0.00022000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00021000000000000001,
+0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001,
+0.00017000000000000001, 0.00016000000000000001, 0.00016000000000000001, 0.00016000000000000001,
+0.00014999999999999999, 0.00014999999999999999, 0.00014999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00012999999999999999, 0.00012999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012, 0.00012,
+0.00011, 0.00011, 0.0001, 0.0001,
+0.0001, 0.0001, 0.0001, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+7.0630399990494563, 0.49330999987881413, 0.49140999987928086, 0.3606099999723128,
+0.09641999998810466, 0.065689999989994835, 0.064559999998265449, 0.050359999998004966,
+0.049619999999364402, 0.04745999999582478, 0.03837999999713565, -0.036380000000000003,
+0.034019999991773783, 0.032789999991817496, 0.02206, -0.014919999998319299,
+0.012339999998044578, 0.0091299999982243692, -0.0088699999996756304, 0.0081499999993742515,
+0.0064599999991852199, 0.004819999999294943, -0.0047999999999999996, 0.0047999999996417696,
+0.0038699999991792713, -0.0038699999999660486, -0.0034199999995966181, 0.003309999999759978,
+-0.0029199999994015558, 0.0028799999999262632, 0.0028199999998071924, -0.0026099999995864141,
+-0.0024899999983592183, 0.0024899999992244745, 0.0024199999994240825, -0.0024099999999999998,
+-0.0023999999997718659, -0.0023900000000000002, -0.0023900000000000002, 0.002279999999422118,
+0.002249999999967067, 0.0021699999997989178, 0.0018699999998397902, -0.0018699999994337547,
+-0.0014199999977575393, 0.0014099999998625566, 0.0012599999997802834, -0.0012299999998917925,
+0.0011499999998581243, -0.0011299999998667187, 0.0010200000000000001, -0.001,
+0.00096999999979078622, 0.00090999999985295833, 0.00088999999999999995, 0.00087999999997635683,
+0.00084999999999999995, 0.00079999999994029498, -0.00080000000000000004, -0.00076999999999999996,
+0.00074999999988576847, -0.00074999999979488588, -0.00073999999994318368, 0.00071999999986488514,
+-0.00069999999999999999, 0.00066999999997240654, 0.00064999999999167395, -0.0006499999999752498,
+0.00064000000000000005, 0.0006399999999660681, 0.00060999999999999997, -0.00056999999999999998,
+-0.000559999999961712, -0.00052999999990409222, -0.00052999999998216811, -0.00049999999997779338,
+-0.00048999999997981973, -0.00048000000000000001, -0.000479999999964177, -0.00046999999999999999,
+0.00046999999989345273, -0.00044999999983533526, -0.00043999999996428726, -0.00042999999992916304,
+-0.00042999999999999999, -0.00038999999999999999, 0.00036999999999999999, -0.00036999999995230177,
+0.00036999999989729444, -0.00036999999991749178, 0.00036999999997316973, -0.00036999999983133744,
+-0.00033999999997008905, -0.00031999999994209344, 0.00030999999996175526, 0.00030999999997552338,
+-0.00028999999992186849, 0.00027999999993121553, -4.9598195365467804e-20, 0.00026999999998153973,
+-0.00027, 0.00025999999999999998, 0.00025999999999198089, 0.00025999999998059585,
+-0.00025000000000000001, -0.00025000000000000001, -0.00025000000000000001, 0.00023999999996560627,
+0.00023999999997832708, -0.000229999999981332, -0.0002299999999398833, 0.0002199999999722521,
+-0.00021999999998214363, -0.00020999999998341906, -0.00020999999996928177, 0.00020999999996928177,
+-0.00019000000000000001, 0.00019000000000000001, 0.00019000000000000001, 0.00018999999996686815,
+0.00016999999998342882, -0.00016999999999067872, 0.00016999999995954301, -0.0001699999999999586,
+-0.00017000000000000001, 0.00015999999995944689, 0.00015999999998771541, -0.00016000000000000001,
+-0.00014999999999999999, -0.00014999999998748935, 0.00014999999998149447, 0.00013999999997466587,
+-0.00013999999997228832, 0.00013999999998955161, -0.00012999999998826049, -0.00012999999999833479,
+-0.00012999999999029792, 0.00012999999999999999, -0.00011999999997411787, 0.00011999999997748085,
+-0.00010999999999951581, -0.00010999999999155434, 9.9999999985072221e-05, 9.9999999996915748e-05,
+6.1232339957367663e-21, 9.9999999997563071e-05, 9.9999999982886592e-05, 9.0000000000000006e-05,
+-8.9999999996573059e-05, 8.9999999994208469e-05, 8.999999997959734e-05, -8.9999999930604345e-05,
+8.9999999992695126e-05, 9.0000000000000006e-05, -7.9999999987570388e-05, -7.9999999993506787e-05,
+7.9999999983034031e-05, 7.9999999998829055e-05, 7.9999999993683458e-05, 7.9999999997951759e-05,
+6.9999999999999994e-05, 6.9999999985653736e-05, 6.9999999992296981e-05, 6.9999999999999994e-05,
+-6.9999999999999994e-05, -6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+-6.0000000000000002e-05, 5.9999999999177533e-05, -5.9999999995774351e-05, -5.999999997998298e-05,
+3.6739403974420595e-21, 5.9999999995262594e-05, 5.9999999984792589e-05, -5.9999999999955224e-05,
+-5.9999999919931922e-05, 5.9999999995649146e-05, -5.9999999972649321e-05, -5.9999999995130084e-05,
+5.9999999995262594e-05, -6.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, -4.9999999998525657e-05, -4.9999999983988552e-05, -4.9999999995366773e-05,
+4.9999999988665184e-05, 4.9999999991763149e-05, -4.9999999982173029e-05, -4.9999999999993145e-05,
+-4.9999999995941739e-05, -4.9999999999170683e-05, -4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.9999999995903508e-05, -3.9999999998537232e-05, 3.9999999992493624e-05,
+3.999999999093215e-05, -3.9999999999939078e-05, 3.9999999997014754e-05, -3.9999999997733038e-05,
+3.9999999989223244e-05, -3.9999999996928852e-05, -3.999999999093215e-05, 3.9999999987013552e-05,
+-3.9999999996928852e-05, -3.9999999992628262e-05, -3.9999999999210433e-05, -3.9999999996387848e-05,
+3.9999999997265144e-05, 3.9999999995065203e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, -5.5109105961630892e-21, 3.0000000000000001e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 2.9999999995430739e-05, 2.9999999997887175e-05, -2.9999999997631297e-05,
+-2.9999999996216193e-05, -2.9999999997696637e-05, -2.9999999992158692e-05, 2.9999999997631297e-05,
+-2.9999999991917433e-05, 2.9999999999714422e-05, -2.9999999994165512e-05, 2.9999999996620573e-05,
+-2.9999999998857685e-05, -2.9999999997631297e-05, -2.9999999993529469e-05, -2.9999999997075674e-05,
+2.9999999984864782e-05, 2.9999999997631297e-05, 2.9999999998811536e-05, -2.9999999994962391e-05,
+2.9999999996216193e-05, 2.9999999996048047e-05, -2.999999999638069e-05, -3.0000000000000001e-05,
+-3.0000000000000001e-05, 1.8369701987210297e-21, -3.0000000000000001e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-1.9999999998001407e-05, -1.9999999998420865e-05, 1.9999999997014444e-05, -1.9999999997365363e-05,
+1.9999999997074455e-05, 1.9999999997951754e-05, -1.9999999998420865e-05, -1.9999999999707264e-05,
+-1.9999999995391444e-05, -1.9999999997587127e-05, -1.9999999999111735e-05, -1.9999999995466075e-05,
+-1.9999999998420865e-05, -1.9999999994198866e-05, -3.6739403974420595e-21, -1.9999999998376697e-05,
+1.9999999998632572e-05, 1.9999999977463186e-05, -1.9999999999176316e-05, 1.9999999998420865e-05,
+1.9999999995540099e-05, -1.9999999999560134e-05, -1.9999999995758508e-05, 1.9999999997477463e-05,
+1.9999999998464426e-05, 1.9999999997532601e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 6.1232339957367661e-22, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05,
+-1.0000000000000001e-05, 1.0000000000000001e-05, 9.9999999984769136e-06, 9.9999999998026083e-06,
+-9.9999999983841584e-06, -9.999999999619229e-06, -9.9999999987387315e-06, 9.999999998654201e-06,
+9.9999999985372274e-06, -9.9999999998719091e-06, 9.9999999995223606e-06, -9.9999999986826816e-06,
+-9.9999999991202656e-06, -9.999999999718381e-06, -9.9999999959035055e-06, 9.999999998654201e-06,
+1.0000000000000001e-05, -9.9999999966185962e-06, 9.9999999986826816e-06, -9.9999999992104323e-06,
+9.9999999987663007e-06, 9.999999998710859e-06, 9.9999999975434138e-06, 9.9999999975434138e-06,
+-9.9999999987663007e-06, 9.999999998654201e-06, 9.9999999992104323e-06, -9.9999999960028117e-06,
+9.9999999994145266e-06, -9.9999999985072221e-06, -9.999999999768339e-06, -9.9999999992104323e-06,
+9.9999999991883484e-06, 9.9999999988205227e-06, 9.999999998654201e-06, 9.999999998710859e-06,
+9.9999999949549269e-06, 9.9999999995223606e-06, 9.999999999780067e-06, 9.9999999997914901e-06,
+1.0000000000000001e-05, 1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.8369701987210297e-21, 1.0000000000000001e-05, -1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+0.00011587690500285845, 1.0934552340031411e-05, 1.0892437545184238e-05, 4.4686205889735284e-06,
+1.5145618182333553e-06, 1.1465067855768677e-06, 4.7324951733252822e-07, 4.4826338375929633e-07,
+2.5114938870240766e-07, 6.295332798588861e-07, 4.6890015682913165e-07, 4.4552650552980715e-18,
+7.4813887446557205e-07, 7.3253563095211114e-07, 0, -2.239466869692875e-07,
+2.1968110227841861e-07, 1.8006387358732982e-07, -7.5857245281928052e-08, 1.0099347716406714e-07,
+1.0260092540342508e-07, 8.244237254318434e-08, 5.8783046359072947e-19, 5.8643062865550594e-08,
+7.9702205615938798e-08, -1.6210618092509695e-08, -5.2527429165157421e-08, 3.9861574785334974e-08,
+-5.9117792419494331e-08, 2.0608847807373161e-08, 3.297625088642932e-08, -4.6464155344405057e-08,
+-9.0394092599381277e-08, 6.2145938669310194e-08, 5.2796209868640277e-08, 2.9513987859451208e-19,
+-3.3091442616218597e-08, 2.9269058499621744e-19, 2.9269058499621744e-19, 5.1333623955320257e-08,
+1.2173671532601052e-08, 2.9541442918343538e-08, 2.4478242758521426e-08, -4.6019096382552346e-08,
+-7.9803434676246067e-08, 1.9687313961856347e-08, 2.3530528974019815e-08, -1.6315337847615943e-08,
+1.8064157757398451e-08, -1.7355554080885347e-08, 0, 1.2246467991473531e-19,
+2.0146335554322129e-08, 1.6358971078061734e-08, 0, 6.4507369153132711e-09,
+0, 9.7738438109251006e-09, 9.7971743931788261e-20, 9.4297803534346197e-20,
+1.3089969389292902e-08, -1.7540558980929649e-08, -9.1699598897620873e-09, 1.3948671381066149e-08,
+8.5725275940314722e-20, 6.0807271138647678e-09, 3.2899456399952638e-09, -5.6723200687430232e-09,
+0, 6.5903632554141194e-09, 0, 6.9804867551399132e-20,
+-6.5484753535425286e-09, -1.0082767088188374e-08, -4.3476151666128837e-09, -4.7123889802347486e-09,
+-4.4470989339184369e-09, 5.8783046359072952e-20, -5.8643062864490168e-09, 5.7558399559925593e-20,
+1.0007717930179247e-08, -1.2173671531293573e-08, -5.6059975572862493e-09, -7.8051124143635716e-09,
+5.2659812363336189e-20, 4.7761225166746772e-20, 0, -5.9411007734824606e-09,
+8.7179196129050299e-09, -7.8138390605575846e-09, 4.4558255802338188e-09, -1.1171852540410504e-08,
+-4.5099307871458712e-09, -6.0877084306043023e-09, 4.86946861286393e-09, 3.8955748903488164e-09,
+-6.7317349242606897e-09, 6.2063908195836184e-09, -0.00027, 3.157300616785786e-09,
+3.306546357697854e-20, 0, 2.0420352248123713e-09, 3.1764992385506574e-09,
+3.0616169978683829e-20, 3.0616169978683829e-20, 3.0616169978683829e-20, 4.0631264984487075e-09,
+3.2253684575884328e-09, -2.9304078140359937e-09, -5.2586770357287436e-09, 3.494149162345746e-09,
+-2.8029987786431246e-09, -2.6389378289096457e-09, -3.5918876004304836e-09, 3.5918876004291936e-09,
+2.3268289183799713e-20, 0, 0, 3.5482543690982262e-09,
+2.3736477826351625e-09, -1.7802358369988679e-09, 3.708824660193739e-09, -1.1868238913108535e-10,
+2.0818995585505007e-20, 3.6023595758119483e-09, 1.9826940302148154e-09, 1.9594348786357652e-20,
+1.8369701987210296e-20, -1.9373154696410888e-09, 2.3561944900954499e-09, 2.6633724383826942e-09,
+-2.7855454859915395e-09, 1.7104226669118925e-09, -1.7470745811579612e-09, -6.5798912798690168e-10,
+-1.5882496192466084e-09, 0, -2.4923301717032132e-09, 2.3247785635110249e-09,
+-3.2637657012938856e-10, 1.3631021457535381e-09, 1.7278759593884083e-09, 7.8539816338937367e-10,
+0.0001, 6.9813170079206077e-10, 1.8500490070084537e-09, 0,
+-7.8539816336441866e-10, 1.0210176123947819e-09, 1.9163715185449622e-09, -3.5342917343948683e-09,
+1.1466813185292508e-09, 0, -1.4102260355623908e-09, -1.0192722831429544e-09,
+1.6475908137661767e-09, 4.3284165449248189e-10, -1.005309649137828e-09, 5.7246799464925448e-10,
+0, 1.4172073525225784e-09, 1.0384709048985337e-09, 0,
+8.5725275940314716e-21, 7.347880794884119e-21, 0, 0,
+7.347880794884119e-21, 3.1415926535754387e-10, -7.1209433478083761e-10, -1.5498523755909549e-09,
+6.0000000000000002e-05, 7.5398223684170641e-10, 1.3508848409294806e-09, -7.3303828573140439e-11,
+-3.0997047501551433e-09, 7.2256631030818694e-10, 1.811651763297862e-09, -7.6445421235721578e-10,
+7.5398223684170641e-10, 7.347880794884119e-21, 6.1232339957367663e-21, 6.1232339957367663e-21,
+6.1232339957367663e-21, -3.8397243543718016e-10, -1.2653637075619458e-09, -6.806784082553054e-10,
+1.0646508436360902e-09, 9.0757121098721454e-10, -1.3351768776054901e-09, -2.6179938788488238e-11,
+-6.3704517696434654e-10, -2.8797932657759273e-10, 4.8985871965894129e-21, 0,
+0, 5.7246799463459757e-10, -3.4208453340215585e-10, 7.7492618783700833e-10,
+8.5172067490887214e-10, 6.9813170076460747e-11, 4.8869219054625501e-10, -4.2586033746998696e-10,
+9.285151619775968e-10, -4.9567350755470752e-10, -8.5172067489660205e-10, 1.0192722830543824e-09,
+-4.9567350755470752e-10, -7.6794487084208064e-10, -2.5132741227962084e-10, -5.3756140958706506e-10,
+4.6774823952382023e-10, 6.2831853069212003e-10, 4.8985871965894129e-21, 4.8985871965894129e-21,
+4.8985871965894129e-21, -3.0000000000000001e-05, 0, 3.6739403974420595e-21,
+3.6739403974420595e-21, 5.2359877557171607e-10, 3.560471673984848e-10, -3.7699111841566363e-10,
+-4.7647488577623193e-10, -3.7175513066603061e-10, -6.8591439596461874e-10, 3.769911184208532e-10,
+-6.9638637147524371e-10, 1.3089969389915937e-10, -5.9166661637870825e-10, 4.5029494699762878e-10,
+-2.6179938778813955e-10, -3.7699111841566363e-10, -6.230825429258033e-10, -4.1887902046559188e-10,
+9.5294977142864733e-10, 3.769911184208532e-10, 2.6703537555160623e-10, -5.4977871434599751e-10,
+4.7647488577441989e-10, 4.8694686128503587e-10, -4.6600291026411968e-10, 3.6739403974420595e-21,
+3.6739403974420595e-21, 3.0000000000000001e-05, 3.6739403974420595e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, 0, 2.4492935982947065e-21, 0,
+0, 0, 0, 0,
+-2.8274333881007726e-10, -2.513274122771091e-10, 3.4557519187768168e-10, -3.2463124085885738e-10,
+3.4208453337420893e-10, 2.8623399731729878e-10, -2.513274122771091e-10, -1.0821041362220989e-10,
+-4.2935099595641213e-10, -3.1066860684274651e-10, -1.8849555920938996e-10, -4.2586033744830103e-10,
+-2.513274122771091e-10, -4.8171087350539584e-10, -2.0000000000000002e-05, -2.5481807078573859e-10,
+2.3387411976191011e-10, 9.4945911272828579e-10, -1.8151424220075253e-10, 2.5132741228056879e-10,
+4.2236967895123231e-10, -1.3264502314860093e-10, -4.1189770344237326e-10, 3.1764992384961331e-10,
+2.4783675377685192e-10, 3.1415926534606002e-10, 2.4492935982947065e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, 2.4492935982947065e-21, 0, 0,
+2.4492935982947065e-21, 1.0000000000000001e-05, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21,
+0, 0, 1.2246467991473532e-21, 1.2246467991473532e-21,
+1.2246467991473532e-21, 0, 1.7453292519057204e-10, 6.283185307138245e-11,
+-1.7976891294477288e-10, -8.7266462596046522e-11, -1.5882496192541065e-10, 1.6406094968010723e-10,
+1.7104226668710447e-10, -5.0614548306684749e-11, 9.7738438110126322e-11, -1.6231562042942869e-10,
+-1.3264502315134914e-10, -7.5049157833031881e-11, -2.8623399729054378e-10, 1.6406094968010723e-10,
+0, -2.6005405851458653e-10, 1.6231562042834531e-10, -1.2566370613855455e-10,
+1.5707963267303001e-10, 1.6057029117657839e-10, 2.2165681498512927e-10, 2.2165681498512927e-10,
+-1.5707963267117389e-10, 1.6406094968010723e-10, 1.2566370614028439e-10, -2.8274333878748835e-10,
+1.0821041362153662e-10, -1.7278759593692157e-10, 6.8067840831164829e-11, -1.2566370613855455e-10,
+1.27409035392139e-10, 1.5358897416946253e-10, 1.6406094968010723e-10, 1.6057029117657839e-10,
+-3.1764992381565568e-10, 9.7738438110126322e-11, 6.6322511575298318e-11, 6.457718232334136e-11,
+0, 0, 1.2246467991473532e-21, 0,
+-1.0000000000000001e-05, 0, 1.2246467991473532e-21,
+};
+
+const struct elp_table elp4 = {
+    arg, max_arg, amp, c, s, 347
 };
@@ -1,319 +1,321 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp5[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 3.000000}, 0.000000, 0.000030, 0.025000},
-{0.000000, {0.000000, 0.000000, 1.000000, -3.000000}, 180.000000, 0.000210, 0.037000},
-{0.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000560, 5.997000},
-{0.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 0.000000, 0.000470, 0.037000},
-{0.000000, {0.000000, 0.000000, 2.000000, -3.000000}, 0.000000, 0.000040, 0.073000},
-{0.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 180.000000, 0.001440, 0.076000},
-{0.000000, {0.000000, 0.000000, 2.000000, 1.000000}, 0.000000, 0.000030, 0.025000},
-{0.000000, {0.000000, 0.000000, 3.000000, -1.000000}, 180.000000, 0.000070, 0.038000},
-{0.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000020, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 1.000000}, 180.000000, 0.000020, 0.857000},
-{0.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 180.000000, 0.000040, 0.081000},
-{0.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 180.000000, 0.000040, 0.069000},
-{0.000000, {0.000000, 1.000000, 1.000000, -1.000000}, 180.000000, 0.000010, 1.200000},
-{0.000000, {0.000000, 1.000000, 1.000000, 1.000000}, 180.000000, 0.000020, 0.036000},
-{0.000000, {1.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000040, 0.949000},
-{0.000000, {1.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000050, 0.039000},
-{0.000000, {1.000000, 1.000000, -1.000000, -1.000000}, 0.000000, 0.000010, 0.075000},
-{0.000000, {1.000000, 1.000000, -1.000000, 1.000000}, 0.000000, 0.000010, 0.074000},
-{0.000000, {1.000000, 1.000000, 0.000000, -1.000000}, 180.000000, 0.000030, 18.600000},
-{0.000000, {1.000000, 1.000000, 0.000000, 1.000000}, 180.000000, 0.000030, 0.037000},
-{0.000000, {2.000000, -1.000000, -1.000000, -1.000000}, 0.000000, 0.000030, 0.340000},
-{0.000000, {2.000000, -1.000000, -1.000000, 1.000000}, 0.000000, 0.000040, 0.042000},
-{0.000000, {2.000000, -1.000000, 0.000000, -1.000000}, 180.000000, 0.000060, 0.097000},
-{0.000000, {2.000000, 0.000000, -2.000000, -1.000000}, 180.000000, 0.000050, 0.066000},
-{0.000000, {2.000000, 0.000000, -2.000000, 1.000000}, 180.000000, 0.000210, 0.086000},
-{0.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.001260, 0.515000},
-{0.000000, {2.000000, 0.000000, -1.000000, 1.000000}, 0.000000, 0.001080, 0.040000},
-{0.000000, {2.000000, 0.000000, 0.000000, -3.000000}, 0.000000, 0.000040, 0.064000},
-{0.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.002170, 0.088000},
-{0.000000, {2.000000, 0.000000, 0.000000, 1.000000}, 0.000000, 0.000130, 0.026000},
-{0.000000, {2.000000, 0.000000, 1.000000, -3.000000}, 0.000000, 0.000030, 0.440000},
-{0.000000, {2.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000080, 0.041000},
-{0.000000, {2.000000, 0.000000, 2.000000, -1.000000}, 180.000000, 0.000020, 0.026000},
-{0.000000, {2.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000010, 1.063000},
-{0.000000, {2.000000, 1.000000, 0.000000, -1.000000}, 0.000000, 0.000090, 0.081000},
-{0.000000, {2.000000, 2.000000, 0.000000, -1.000000}, 0.000000, 0.000010, 0.075000},
-{0.000000, {4.000000, 0.000000, -2.000000, 1.000000}, 0.000000, 0.000030, 0.027000},
-{0.000000, {4.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.000010, 0.044000},
-{0.000000, {4.000000, 0.000000, -1.000000, 1.000000}, 0.000000, 0.000020, 0.020000},
-{0.000000, {4.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000010, 0.028000},
-{1.000000, {-6.000000, 0.000000, 0.000000, 0.000000}, 0.000760, 0.000020, 0.016000},
-{1.000000, {-6.000000, 0.000000, 1.000000, 0.000000}, 0.000750, 0.000050, 0.021000},
-{1.000000, {-6.000000, 0.000000, 2.000000, 0.000000}, 0.000750, 0.000040, 0.029000},
-{1.000000, {-4.000000, -1.000000, 0.000000, 0.000000}, 180.000750, 0.000060, 0.027000},
-{1.000000, {-4.000000, -1.000000, 1.000000, 0.000000}, 180.000740, 0.000080, 0.042000},
-{1.000000, {-4.000000, 0.000000, -2.000000, 0.000000}, 0.000760, 0.000030, 0.016000},
-{1.000000, {-4.000000, 0.000000, -1.000000, -2.000000}, 0.000950, 0.000020, 0.013000},
-{1.000000, {-4.000000, 0.000000, -1.000000, 0.000000}, 0.000750, 0.000250, 0.020000},
-{1.000000, {-4.000000, 0.000000, -1.000000, 2.000000}, 180.000460, 0.000010, 0.044000},
-{1.000000, {-4.000000, 0.000000, 0.000000, -2.000000}, 0.000940, 0.000090, 0.016000},
-{1.000000, {-4.000000, 0.000000, 0.000000, 0.000000}, 0.000730, 0.001880, 0.028000},
-{1.000000, {-4.000000, 0.000000, 0.000000, 2.000000}, 0.000720, 0.000090, 0.108000},
-{1.000000, {-4.000000, 0.000000, 1.000000, -2.000000}, 0.000830, 0.000170, 0.020000},
-{1.000000, {-4.000000, 0.000000, 1.000000, 0.000000}, 0.000710, 0.003220, 0.044000},
-{1.000000, {-4.000000, 0.000000, 2.000000, -2.000000}, 0.000550, 0.000090, 0.027000},
-{1.000000, {-4.000000, 0.000000, 2.000000, 0.000000}, 0.000700, 0.000290, 0.104000},
-{1.000000, {-4.000000, 1.000000, -1.000000, 0.000000}, 0.000750, 0.000030, 0.021000},
-{1.000000, {-4.000000, 1.000000, 0.000000, -2.000000}, 0.000940, 0.000010, 0.016000},
-{1.000000, {-4.000000, 1.000000, 0.000000, 0.000000}, 0.000750, 0.000210, 0.028000},
-{1.000000, {-4.000000, 1.000000, 1.000000, -2.000000}, 0.000940, 0.000020, 0.021000},
-{1.000000, {-4.000000, 1.000000, 1.000000, 0.000000}, 0.000720, 0.000290, 0.046000},
-{1.000000, {-4.000000, 1.000000, 2.000000, -2.000000}, 0.000930, 0.000010, 0.028000},
-{1.000000, {-4.000000, 1.000000, 2.000000, 0.000000}, 0.000720, 0.000020, 0.116000},
-{1.000000, {-4.000000, 2.000000, 0.000000, 0.000000}, 0.000720, 0.000010, 0.029000},
-{1.000000, {-4.000000, 2.000000, 1.000000, 0.000000}, 0.000720, 0.000020, 0.048000},
-{1.000000, {-3.000000, -1.000000, 0.000000, 0.000000}, 0.000720, 0.000020, 0.040000},
-{1.000000, {-3.000000, 0.000000, -1.000000, 0.000000}, 180.000720, 0.000020, 0.027000},
-{1.000000, {-3.000000, 0.000000, 0.000000, 0.000000}, 180.000740, 0.000170, 0.042000},
-{1.000000, {-3.000000, 0.000000, 0.000000, 2.000000}, 180.000720, 0.000010, 0.322000},
-{1.000000, {-3.000000, 0.000000, 1.000000, 0.000000}, 180.000730, 0.000140, 0.095000},
-{1.000000, {-3.000000, 0.000000, 2.000000, 0.000000}, 180.000720, 0.000020, 0.360000},
-{1.000000, {-3.000000, 1.000000, 0.000000, 0.000000}, 180.000720, 0.000010, 0.044000},
-{1.000000, {-2.000000, -2.000000, 0.000000, 0.000000}, 180.000370, 0.000130, 0.075000},
-{1.000000, {-2.000000, -2.000000, 1.000000, 0.000000}, 180.000720, 0.000050, 8.853000},
-{1.000000, {-2.000000, -1.000000, -2.000000, 0.000000}, 180.000750, 0.000030, 0.026000},
-{1.000000, {-2.000000, -1.000000, -1.000000, -2.000000}, 180.000950, 0.000010, 0.019000},
-{1.000000, {-2.000000, -1.000000, -1.000000, 0.000000}, 180.000730, 0.000410, 0.039000},
-{1.000000, {-2.000000, -1.000000, 0.000000, -2.000000}, 180.000940, 0.000060, 0.026000},
-{1.000000, {-2.000000, -1.000000, 0.000000, 0.000000}, 180.000710, 0.005890, 0.081000},
-{1.000000, {-2.000000, -1.000000, 0.000000, 2.000000}, 180.000790, 0.000070, 0.069000},
-{1.000000, {-2.000000, -1.000000, 1.000000, -2.000000}, 180.000660, 0.000050, 0.039000},
-{1.000000, {-2.000000, -1.000000, 1.000000, 0.000000}, 180.000740, 0.000340, 1.127000},
-{1.000000, {-2.000000, -1.000000, 2.000000, 0.000000}, 0.000720, 0.000030, 0.071000},
-{1.000000, {-2.000000, 0.000000, -3.000000, -2.000000}, 0.000940, 0.000010, 0.013000},
-{1.000000, {-2.000000, 0.000000, -3.000000, 0.000000}, 0.000770, 0.000070, 0.020000},
-{1.000000, {-2.000000, 0.000000, -2.000000, -2.000000}, 0.001110, 0.000140, 0.015000},
-{1.000000, {-2.000000, 0.000000, -2.000000, 0.000000}, 0.000770, 0.001100, 0.026000},
-{1.000000, {-2.000000, 0.000000, -2.000000, 2.000000}, 180.000470, 0.000020, 0.091000},
-{1.000000, {-2.000000, 0.000000, -1.000000, -2.000000}, 0.001040, 0.001040, 0.019000},
-{1.000000, {-2.000000, 0.000000, -1.000000, 0.000000}, 0.000750, 0.016470, 0.041000},
-{1.000000, {-2.000000, 0.000000, -1.000000, 2.000000}, 180.000590, 0.000480, 0.450000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -4.000000}, 180.000900, 0.000010, 0.015000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -2.000000}, 0.000930, 0.005620, 0.026000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 0.000720, 0.298540, 0.088000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 2.000000}, 0.000770, 0.002730, 0.065000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -4.000000}, 180.000880, 0.000020, 0.019000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -2.000000}, 0.000650, 0.005620, 0.040000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 0.000000}, 0.000710, 0.073320, 0.530000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 2.000000}, 0.000720, 0.000430, 0.035000},
-{1.000000, {-2.000000, 0.000000, 2.000000, -2.000000}, 179.999510, 0.000020, 0.085000},
-{1.000000, {-2.000000, 0.000000, 2.000000, 0.000000}, 0.000660, 0.006720, 0.066000},
-{1.000000, {-2.000000, 0.000000, 2.000000, 2.000000}, 0.000720, 0.000030, 0.024000},
-{1.000000, {-2.000000, 0.000000, 3.000000, 0.000000}, 0.000630, 0.000630, 0.035000},
-{1.000000, {-2.000000, 0.000000, 4.000000, 0.000000}, 0.000610, 0.000050, 0.024000},
-{1.000000, {-2.000000, 1.000000, -2.000000, -2.000000}, 0.000940, 0.000010, 0.016000},
-{1.000000, {-2.000000, 1.000000, -2.000000, 0.000000}, 0.000750, 0.000060, 0.027000},
-{1.000000, {-2.000000, 1.000000, -1.000000, -2.000000}, 0.001040, 0.000080, 0.020000},
-{1.000000, {-2.000000, 1.000000, -1.000000, 0.000000}, 0.000750, 0.000860, 0.042000},
-{1.000000, {-2.000000, 1.000000, -1.000000, 2.000000}, 180.000600, 0.000030, 0.311000},
-{1.000000, {-2.000000, 1.000000, 0.000000, -2.000000}, 0.000940, 0.000380, 0.027000},
-{1.000000, {-2.000000, 1.000000, 0.000000, 0.000000}, 0.000720, 0.014040, 0.096000},
-{1.000000, {-2.000000, 1.000000, 0.000000, 2.000000}, 0.000760, 0.000110, 0.061000},
-{1.000000, {-2.000000, 1.000000, 1.000000, -2.000000}, 0.000650, 0.000250, 0.042000},
-{1.000000, {-2.000000, 1.000000, 1.000000, 0.000000}, 0.000710, 0.003280, 0.346000},
-{1.000000, {-2.000000, 1.000000, 1.000000, 2.000000}, 0.000730, 0.000010, 0.034000},
-{1.000000, {-2.000000, 1.000000, 2.000000, 0.000000}, 0.000680, 0.000280, 0.062000},
-{1.000000, {-2.000000, 1.000000, 3.000000, 0.000000}, 0.000720, 0.000020, 0.034000},
-{1.000000, {-2.000000, 2.000000, -1.000000, 0.000000}, 0.000740, 0.000030, 0.044000},
-{1.000000, {-2.000000, 2.000000, 0.000000, -2.000000}, 0.000930, 0.000020, 0.028000},
-{1.000000, {-2.000000, 2.000000, 0.000000, 0.000000}, 0.000730, 0.000510, 0.107000},
-{1.000000, {-2.000000, 2.000000, 1.000000, -2.000000}, 0.000910, 0.000010, 0.044000},
-{1.000000, {-2.000000, 2.000000, 1.000000, 0.000000}, 0.000720, 0.000120, 0.257000},
-{1.000000, {-2.000000, 2.000000, 2.000000, 0.000000}, 0.000720, 0.000010, 0.058000},
-{1.000000, {-2.000000, 3.000000, 0.000000, 0.000000}, 0.000720, 0.000020, 0.119000},
-{1.000000, {-1.000000, -1.000000, -1.000000, 0.000000}, 0.000720, 0.000020, 0.075000},
-{1.000000, {-1.000000, -1.000000, 0.000000, -2.000000}, 0.000940, 0.000020, 0.037000},
-{1.000000, {-1.000000, -1.000000, 0.000000, 0.000000}, 0.000720, 0.000360, 25770.018000},
-{1.000000, {-1.000000, 0.000000, -2.000000, 0.000000}, 180.000720, 0.000020, 0.039000},
-{1.000000, {-1.000000, 0.000000, -1.000000, -2.000000}, 180.001120, 0.000030, 0.026000},
-{1.000000, {-1.000000, 0.000000, -1.000000, 0.000000}, 180.000720, 0.000290, 0.082000},
-{1.000000, {-1.000000, 0.000000, 0.000000, -2.000000}, 180.000990, 0.000130, 0.039000},
-{1.000000, {-1.000000, 0.000000, 0.000000, 0.000000}, 180.000730, 0.002120, 1.000000},
-{1.000000, {-1.000000, 0.000000, 0.000000, 2.000000}, 180.000690, 0.000050, 0.036000},
-{1.000000, {-1.000000, 0.000000, 1.000000, 0.000000}, 180.000740, 0.000170, 0.070000},
-{1.000000, {-1.000000, 0.000000, 2.000000, 0.000000}, 180.000710, 0.000040, 0.036000},
-{1.000000, {0.000000, -2.000000, -1.000000, 0.000000}, 180.000720, 0.000030, 0.530000},
-{1.000000, {0.000000, -2.000000, 1.000000, 0.000000}, 180.000710, 0.000050, 0.041000},
-{1.000000, {0.000000, -1.000000, -3.000000, 0.000000}, 180.000720, 0.000010, 0.036000},
-{1.000000, {0.000000, -1.000000, -2.000000, -2.000000}, 180.001190, 0.000040, 0.024000},
-{1.000000, {0.000000, -1.000000, -2.000000, 0.000000}, 180.000800, 0.000140, 0.071000},
-{1.000000, {0.000000, -1.000000, -1.000000, -2.000000}, 180.001140, 0.000180, 0.036000},
-{1.000000, {0.000000, -1.000000, -1.000000, 0.000000}, 180.000760, 0.002270, 1.127000},
-{1.000000, {0.000000, -1.000000, 0.000000, -2.000000}, 180.001920, 0.000020, 0.069000},
-{1.000000, {0.000000, -1.000000, 0.000000, 0.000000}, 180.000580, 0.002520, 0.081000},
-{1.000000, {0.000000, -1.000000, 1.000000, -2.000000}, 0.002020, 0.000040, 0.819000},
-{1.000000, {0.000000, -1.000000, 1.000000, 0.000000}, 180.000680, 0.002760, 0.039000},
-{1.000000, {0.000000, -1.000000, 2.000000, 0.000000}, 180.000650, 0.000310, 0.026000},
-{1.000000, {0.000000, -1.000000, 3.000000, 0.000000}, 180.000690, 0.000030, 0.019000},
-{1.000000, {0.000000, 0.000000, -4.000000, -2.000000}, 0.001210, 0.000030, 0.015000},
-{1.000000, {0.000000, 0.000000, -4.000000, 0.000000}, 0.000640, 0.000050, 0.025000},
-{1.000000, {0.000000, 0.000000, -3.000000, -2.000000}, 0.001190, 0.000330, 0.019000},
-{1.000000, {0.000000, 0.000000, -3.000000, 0.000000}, 0.000690, 0.000910, 0.038000},
-{1.000000, {0.000000, 0.000000, -2.000000, -4.000000}, 180.000890, 0.000010, 0.015000},
-{1.000000, {0.000000, 0.000000, -2.000000, -2.000000}, 0.001160, 0.003770, 0.025000},
-{1.000000, {0.000000, 0.000000, -2.000000, 0.000000}, 0.000670, 0.017450, 0.076000},
-{1.000000, {0.000000, 0.000000, -2.000000, 2.000000}, 180.000380, 0.000330, 0.073000},
-{1.000000, {0.000000, 0.000000, -1.000000, -4.000000}, 180.000980, 0.000080, 0.019000},
-{1.000000, {0.000000, 0.000000, -1.000000, -2.000000}, 0.001090, 0.039770, 0.037000},
-{1.000000, {0.000000, 0.000000, -1.000000, 0.000000}, 0.000750, 0.455860, 8.847000},
-{1.000000, {0.000000, 0.000000, -1.000000, 2.000000}, 0.000620, 0.004370, 0.037000},
-{1.000000, {0.000000, 0.000000, 0.000000, -4.000000}, 180.000860, 0.000340, 0.025000},
-{1.000000, {0.000000, 0.000000, 0.000000, -2.000000}, 0.000860, 0.326220, 0.074000},
-{1.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 270.000000, 0.000010, 18.613000},
-{1.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 180.000710, 8.045080, 0.075000},
-{1.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 270.000000, 0.000010, 0.037000},
-{1.000000, {0.000000, 0.000000, 0.000000, 2.000000}, 0.000710, 0.008340, 0.025000},
-{1.000000, {0.000000, 0.000000, 0.000000, 4.000000}, 180.000320, 0.000020, 0.015000},
-{1.000000, {0.000000, 0.000000, 1.000000, -4.000000}, 180.000670, 0.000090, 0.037000},
-{1.000000, {0.000000, 0.000000, 1.000000, -2.000000}, 0.004640, 0.002390, 4.536000},
-{1.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 180.000690, 0.415710, 0.038000},
-{1.000000, {0.000000, 0.000000, 1.000000, 2.000000}, 0.000700, 0.001330, 0.019000},
-{1.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 0.001470, 0.000790, 0.077000},
-{1.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 180.000660, 0.024030, 0.025000},
-{1.000000, {0.000000, 0.000000, 2.000000, 2.000000}, 0.000710, 0.000150, 0.015000},
-{1.000000, {0.000000, 0.000000, 3.000000, -2.000000}, 0.001370, 0.000070, 0.038000},
-{1.000000, {0.000000, 0.000000, 3.000000, 0.000000}, 180.000620, 0.001460, 0.019000},
-{1.000000, {0.000000, 0.000000, 3.000000, 2.000000}, 0.000750, 0.000020, 0.013000},
-{1.000000, {0.000000, 0.000000, 4.000000, 0.000000}, 180.000580, 0.000090, 0.015000},
-{1.000000, {0.000000, 1.000000, -3.000000, 0.000000}, 0.000720, 0.000010, 0.039000},
-{1.000000, {0.000000, 1.000000, -2.000000, -2.000000}, 0.001190, 0.000040, 0.026000},
-{1.000000, {0.000000, 1.000000, -2.000000, 0.000000}, 0.000770, 0.000140, 0.082000},
-{1.000000, {0.000000, 1.000000, -1.000000, -2.000000}, 0.001140, 0.000230, 0.039000},
-{1.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 0.000740, 0.002570, 0.898000},
-{1.000000, {0.000000, 1.000000, -1.000000, 2.000000}, 0.000870, 0.000010, 0.036000},
-{1.000000, {0.000000, 1.000000, 0.000000, -2.000000}, 0.000710, 0.000030, 0.080000},
-{1.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 0.000950, 0.002060, 0.070000},
-{1.000000, {0.000000, 1.000000, 0.000000, 2.000000}, 180.000720, 0.000020, 0.024000},
-{1.000000, {0.000000, 1.000000, 1.000000, -2.000000}, 180.002170, 0.000030, 1.283000},
-{1.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 0.000700, 0.002120, 0.036000},
-{1.000000, {0.000000, 1.000000, 2.000000, 0.000000}, 0.000650, 0.000250, 0.024000},
-{1.000000, {0.000000, 1.000000, 3.000000, 0.000000}, 0.000690, 0.000020, 0.018000},
-{1.000000, {0.000000, 2.000000, -1.000000, 0.000000}, 0.000720, 0.000040, 0.473000},
-{1.000000, {0.000000, 2.000000, 0.000000, 0.000000}, 0.000880, 0.000020, 0.065000},
-{1.000000, {0.000000, 2.000000, 1.000000, 0.000000}, 0.000720, 0.000020, 0.035000},
-{1.000000, {1.000000, 0.000000, -2.000000, 0.000000}, 0.000720, 0.000040, 1.292000},
-{1.000000, {1.000000, 0.000000, -1.000000, 0.000000}, 180.001370, 0.000030, 0.080000},
-{1.000000, {1.000000, 0.000000, 0.000000, -2.000000}, 180.001020, 0.000030, 0.903000},
-{1.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 0.000710, 0.002180, 0.039000},
-{1.000000, {1.000000, 0.000000, 1.000000, -2.000000}, 180.001310, 0.000010, 0.082000},
-{1.000000, {1.000000, 0.000000, 1.000000, 0.000000}, 0.000670, 0.000260, 0.026000},
-{1.000000, {1.000000, 0.000000, 2.000000, 0.000000}, 0.000680, 0.000020, 0.019000},
-{1.000000, {1.000000, 1.000000, -1.000000, 0.000000}, 0.000220, 0.000080, 0.074000},
-{1.000000, {1.000000, 1.000000, 0.000000, -2.000000}, 0.000280, 0.000010, 9.303000},
-{1.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 180.000730, 0.000320, 0.037000},
-{1.000000, {1.000000, 1.000000, 1.000000, 0.000000}, 180.000700, 0.000040, 0.025000},
-{1.000000, {2.000000, -2.000000, -1.000000, 0.000000}, 180.000710, 0.000130, 0.044000},
-{1.000000, {2.000000, -2.000000, 0.000000, -2.000000}, 0.001020, 0.000020, 0.108000},
-{1.000000, {2.000000, -2.000000, 0.000000, 0.000000}, 180.000700, 0.000150, 0.028000},
-{1.000000, {2.000000, -2.000000, 1.000000, 0.000000}, 180.000690, 0.000020, 0.020000},
-{1.000000, {2.000000, -1.000000, -2.000000, -2.000000}, 180.001460, 0.000020, 0.062000},
-{1.000000, {2.000000, -1.000000, -2.000000, 0.000000}, 0.000910, 0.000020, 0.094000},
-{1.000000, {2.000000, -1.000000, -1.000000, -2.000000}, 180.002530, 0.000030, 0.334000},
-{1.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 180.000730, 0.003710, 0.042000},
-{1.000000, {2.000000, -1.000000, -1.000000, 2.000000}, 0.000720, 0.000020, 0.020000},
-{1.000000, {2.000000, -1.000000, 0.000000, -2.000000}, 0.001010, 0.000490, 0.097000},
-{1.000000, {2.000000, -1.000000, 0.000000, 0.000000}, 180.000700, 0.003150, 0.027000},
-{1.000000, {2.000000, -1.000000, 0.000000, 2.000000}, 0.000730, 0.000010, 0.016000},
-{1.000000, {2.000000, -1.000000, 1.000000, -2.000000}, 0.001120, 0.000080, 0.043000},
-{1.000000, {2.000000, -1.000000, 1.000000, 0.000000}, 180.000660, 0.000430, 0.020000},
-{1.000000, {2.000000, -1.000000, 2.000000, 0.000000}, 180.000670, 0.000040, 0.016000},
-{1.000000, {2.000000, 0.000000, -4.000000, 0.000000}, 180.000720, 0.000010, 0.067000},
-{1.000000, {2.000000, 0.000000, -3.000000, -2.000000}, 180.001380, 0.000070, 0.035000},
-{1.000000, {2.000000, 0.000000, -3.000000, 0.000000}, 180.000740, 0.000130, 0.602000},
-{1.000000, {2.000000, 0.000000, -2.000000, -2.000000}, 180.001500, 0.000380, 0.066000},
-{1.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 0.001640, 0.000330, 0.086000},
-{1.000000, {2.000000, 0.000000, -2.000000, 2.000000}, 0.000620, 0.000100, 0.026000},
-{1.000000, {2.000000, 0.000000, -1.000000, -4.000000}, 180.000830, 0.000010, 0.035000},
-{1.000000, {2.000000, 0.000000, -1.000000, -2.000000}, 180.002400, 0.000660, 0.501000},
-{1.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 180.000730, 0.083500, 0.040000},
-{1.000000, {2.000000, 0.000000, -1.000000, 2.000000}, 0.000690, 0.000330, 0.019000},
-{1.000000, {2.000000, 0.000000, 0.000000, -4.000000}, 180.000720, 0.000040, 0.064000},
-{1.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 0.001020, 0.010050, 0.089000},
-{1.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 180.000700, 0.046380, 0.026000},
-{1.000000, {2.000000, 0.000000, 0.000000, 2.000000}, 0.000730, 0.000180, 0.015000},
-{1.000000, {2.000000, 0.000000, 1.000000, -2.000000}, 0.001120, 0.001390, 0.041000},
-{1.000000, {2.000000, 0.000000, 1.000000, 0.000000}, 180.000670, 0.005630, 0.019000},
-{1.000000, {2.000000, 0.000000, 1.000000, 2.000000}, 0.000720, 0.000040, 0.013000},
-{1.000000, {2.000000, 0.000000, 2.000000, -2.000000}, 0.001150, 0.000140, 0.026000},
-{1.000000, {2.000000, 0.000000, 2.000000, 0.000000}, 180.000620, 0.000540, 0.015000},
-{1.000000, {2.000000, 0.000000, 3.000000, -2.000000}, 0.000930, 0.000010, 0.020000},
-{1.000000, {2.000000, 0.000000, 3.000000, 0.000000}, 180.000660, 0.000050, 0.013000},
-{1.000000, {2.000000, 1.000000, -2.000000, 0.000000}, 180.000720, 0.000020, 0.079000},
-{1.000000, {2.000000, 1.000000, -1.000000, -2.000000}, 0.001210, 0.000010, 1.006000},
-{1.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 0.000740, 0.000550, 0.039000},
-{1.000000, {2.000000, 1.000000, 0.000000, -2.000000}, 180.001030, 0.000190, 0.082000},
-{1.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 0.000710, 0.000490, 0.026000},
-{1.000000, {2.000000, 1.000000, 1.000000, -2.000000}, 180.001140, 0.000030, 0.039000},
-{1.000000, {2.000000, 1.000000, 1.000000, 0.000000}, 0.000690, 0.000090, 0.019000},
-{1.000000, {2.000000, 1.000000, 2.000000, 0.000000}, 0.000670, 0.000010, 0.015000},
-{1.000000, {2.000000, 2.000000, -1.000000, 0.000000}, 0.000710, 0.000050, 0.037000},
-{1.000000, {3.000000, 0.000000, -2.000000, 0.000000}, 0.000720, 0.000020, 0.042000},
-{1.000000, {3.000000, 0.000000, -1.000000, 0.000000}, 0.000700, 0.000080, 0.027000},
-{1.000000, {3.000000, 0.000000, 0.000000, 0.000000}, 0.000720, 0.000010, 0.020000},
-{1.000000, {4.000000, -2.000000, -1.000000, 0.000000}, 180.000720, 0.000010, 0.021000},
-{1.000000, {4.000000, -1.000000, -2.000000, 0.000000}, 180.000700, 0.000080, 0.028000},
-{1.000000, {4.000000, -1.000000, -1.000000, -2.000000}, 0.000740, 0.000020, 0.046000},
-{1.000000, {4.000000, -1.000000, -1.000000, 0.000000}, 180.000690, 0.000130, 0.021000},
-{1.000000, {4.000000, -1.000000, 0.000000, -2.000000}, 0.000960, 0.000020, 0.029000},
-{1.000000, {4.000000, -1.000000, 0.000000, 0.000000}, 180.000670, 0.000060, 0.016000},
-{1.000000, {4.000000, -1.000000, 1.000000, 0.000000}, 180.000660, 0.000010, 0.013000},
-{1.000000, {4.000000, 0.000000, -3.000000, 0.000000}, 180.000340, 0.000010, 0.043000},
-{1.000000, {4.000000, 0.000000, -2.000000, 0.000000}, 180.000740, 0.000970, 0.028000},
-{1.000000, {4.000000, 0.000000, -1.000000, -2.000000}, 0.000740, 0.000190, 0.044000},
-{1.000000, {4.000000, 0.000000, -1.000000, 0.000000}, 180.000710, 0.001130, 0.020000},
-{1.000000, {4.000000, 0.000000, -1.000000, 2.000000}, 0.000560, 0.000010, 0.013000},
-{1.000000, {4.000000, 0.000000, 0.000000, -2.000000}, 0.000960, 0.000190, 0.028000},
-{1.000000, {4.000000, 0.000000, 0.000000, 0.000000}, 180.000670, 0.000430, 0.016000},
-{1.000000, {4.000000, 0.000000, 1.000000, -2.000000}, 0.001030, 0.000040, 0.020000},
-{1.000000, {4.000000, 0.000000, 1.000000, 0.000000}, 180.000660, 0.000070, 0.013000},
-{1.000000, {4.000000, 1.000000, -2.000000, 0.000000}, 0.000720, 0.000010, 0.027000},
-{1.000000, {4.000000, 1.000000, -1.000000, 0.000000}, 0.000690, 0.000020, 0.020000},
-{1.000000, {6.000000, 0.000000, -3.000000, 0.000000}, 180.000690, 0.000010, 0.021000},
-{1.000000, {6.000000, 0.000000, -2.000000, 0.000000}, 180.000670, 0.000020, 0.016000},
-{1.000000, {6.000000, 0.000000, -1.000000, 0.000000}, 180.000660, 0.000010, 0.013000},
-{2.000000, {-4.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000020, 0.028000},
-{2.000000, {-4.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000030, 0.044000},
-{2.000000, {-2.000000, -1.000000, 0.000000, -1.000000}, 0.000000, 0.000060, 0.081000},
-{2.000000, {-2.000000, 0.000000, -2.000000, -1.000000}, 180.000000, 0.000010, 0.026000},
-{2.000000, {-2.000000, 0.000000, -1.000000, -1.000000}, 180.000000, 0.000160, 0.041000},
-{2.000000, {-2.000000, 0.000000, 0.000000, -3.000000}, 180.000000, 0.000030, 0.026000},
-{2.000000, {-2.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.002930, 0.088000},
-{2.000000, {-2.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000140, 0.065000},
-{2.000000, {-2.000000, 0.000000, 1.000000, -3.000000}, 180.000000, 0.000030, 0.040000},
-{2.000000, {-2.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000720, 0.545000},
-{2.000000, {-2.000000, 0.000000, 1.000000, 1.000000}, 180.000000, 0.000010, 0.035000},
-{2.000000, {-2.000000, 0.000000, 2.000000, -1.000000}, 180.000000, 0.000070, 0.066000},
-{2.000000, {-2.000000, 1.000000, 0.000000, -1.000000}, 180.000000, 0.000140, 0.096000},
-{2.000000, {-2.000000, 1.000000, 1.000000, -1.000000}, 180.000000, 0.000030, 0.353000},
-{2.000000, {-1.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.000020, 1.057000},
-{2.000000, {0.000000, -1.000000, -1.000000, -1.000000}, 0.000000, 0.000020, 1.063000},
-{2.000000, {0.000000, -1.000000, 0.000000, -1.000000}, 0.000000, 0.000030, 0.081000},
-{2.000000, {0.000000, -1.000000, 1.000000, -1.000000}, 0.000000, 0.000030, 0.039000},
-{2.000000, {0.000000, 0.000000, -3.000000, -1.000000}, 180.000000, 0.000010, 0.038000},
-{2.000000, {0.000000, 0.000000, -2.000000, -3.000000}, 180.000000, 0.000020, 0.025000},
-{2.000000, {0.000000, 0.000000, -2.000000, -1.000000}, 180.000000, 0.000200, 0.076000},
-{2.000000, {0.000000, 0.000000, -2.000000, 1.000000}, 180.000000, 0.000050, 0.073000},
-{2.000000, {0.000000, 0.000000, -1.000000, -3.000000}, 180.000000, 0.000190, 0.037000},
-{2.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 180.000000, 0.004410, 16.863000},
-{2.000000, {0.000000, 0.000000, -1.000000, 1.000000}, 180.000000, 0.000060, 0.037000},
-{2.000000, {0.000000, 0.000000, 0.000000, -3.000000}, 180.000000, 0.001560, 0.074000},
-{2.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.080420, 0.075000},
-{2.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000030, 0.025000},
-{2.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.004250, 0.038000},
-{2.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 0.000000, 0.000260, 0.025000},
-{2.000000, {0.000000, 0.000000, 3.000000, -1.000000}, 0.000000, 0.000020, 0.019000},
-{2.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000020, 0.944000},
-{2.000000, {0.000000, 1.000000, 1.000000, -1.000000}, 180.000000, 0.000020, 0.036000},
-{2.000000, {1.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000020, 0.039000},
-{2.000000, {1.000000, 1.000000, -1.000000, -1.000000}, 180.000000, 0.000020, 0.074000},
-{2.000000, {2.000000, -1.000000, -1.000000, -1.000000}, 0.000000, 0.000040, 0.042000},
-{2.000000, {2.000000, -1.000000, 0.000000, -1.000000}, 0.000000, 0.000030, 0.027000},
-{2.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.000850, 0.040000},
-{2.000000, {2.000000, 0.000000, 0.000000, -3.000000}, 180.000000, 0.000050, 0.089000},
-{2.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.000490, 0.026000},
-{2.000000, {2.000000, 0.000000, 1.000000, -1.000000}, 0.000000, 0.000060, 0.019000},
-{2.000000, {4.000000, 0.000000, -1.000000, -1.000000}, 0.000000, 0.000010, 0.020000},
+
+static const uint16_t arg[] = {
+0, 4, 5, 7, 8, 10, 11, 12, 18, 19,
+24, 27, 28, 30, 32, 35, 37, 39, 40, 41,
+42, 47, 48, 49, 53, 54, 57, 58, 59, 60,
+65, 66, 68, 69, 77, 79, 81, 83, 84, 85,
+86, 87, 90, 92, 93, 96, 97, 99, 104, 105,
+107, 108, 112, 114, 117, 119, 124, 130, 133, 138,
+142, 143, 144, 147, 149, 150, 151, 153, 155, 160,
+161, 162, 163, 165, 166, 173, 175, 176, 177, 178,
+179, 180, 182, 185, 187, 188, 189, 191, 197, 198,
+201, 202, 203, 208, 217, 218, 219, 220, 224, 225,
+226, 227, 229, 230, 236, 237, 238, 242, 247, 248,
+252, 253, 254, 255, 256, 257, 258, 264, 265, 266,
+267, 268, 269, 272, 275, 283, 295, 296, 297, 298,
+299, 300, 301, 308, 309, 310, 311, 312, 313, 314,
+315, 322, 323, 324, 325, 326, 327, 328, 211, 347,
+348, 349, 350, 351, 352, 353, 368, 369, 370, 371,
+372, 373, 374, 375, 376, 377, 378, 379, 380, 406,
+284, 285, 407, 354, 408, 409, 410, 411, 412, 413,
+414, 415, 416, 417, 418, 419, 420, 421, 457, 458,
+120, 459, 381, 460, 461, 462, 463, 464, 465, 466,
+467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+382, 422, 423, 528, 529, 530, 531, 532, 533, 534,
+535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+555, 556, 557, 558, 559, 560, 561, 562, 563, 564,
+565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+424, 425, 636, 637, 638, 639, 640, 641, 642, 643,
+644, 645, 646, 647, 648, 649, 650, 651, 652, 653,
+654, 655, 1, 6, 656, 657, 658, 659, 660, 661,
+662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+672, 673, 674, 675, 676, 677,
+};
+
+static const uint16_t max_arg[] = {
+0, 4, 5, 7, 8, 10, 11, 12, 18, 19,
+24, 27, 28, 30, 32, 35, 37, 39, 40, 41,
+42, 47, 48, 49, 53, 54, 57, 58, 59, 60,
+65, 66, 68, 69, 77, 79, 81, 83, 84, 85,
+86, 87, 90, 92, 93, 96, 97, 99, 104, 105,
+107, 108, 112, 114, 117, 119, 124, 130, 133, 138,
+142, 143, 144, 147, 149, 150, 151, 153, 155, 160,
+161, 162, 163, 165, 166, 173, 175, 176, 177, 178,
+179, 180, 182, 185, 187, 188, 189, 191, 197, 198,
+201, 202, 203, 208, 217, 218, 219, 220, 224, 225,
+226, 227, 229, 230, 236, 237, 238, 242, 247, 248,
+252, 253, 254, 255, 256, 257, 258, 264, 265, 266,
+267, 268, 269, 272, 275, 283, 295, 296, 297, 298,
+299, 300, 301, 308, 309, 310, 311, 312, 313, 314,
+315, 322, 323, 324, 325, 326, 327, 328, 328, 347,
+348, 349, 350, 351, 352, 353, 368, 369, 370, 371,
+372, 373, 374, 375, 376, 377, 378, 379, 380, 406,
+406, 406, 407, 407, 408, 409, 410, 411, 412, 413,
+414, 415, 416, 417, 418, 419, 420, 421, 457, 458,
+458, 459, 459, 460, 461, 462, 463, 464, 465, 466,
+467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+477, 478, 479, 480, 481, 482, 483, 484, 485, 486,
+486, 486, 486, 528, 529, 530, 531, 532, 533, 534,
+535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+555, 556, 557, 558, 559, 560, 561, 562, 563, 564,
+565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+574, 574, 636, 637, 638, 639, 640, 641, 642, 643,
+644, 645, 646, 647, 648, 649, 650, 651, 652, 653,
+654, 655, 655, 655, 656, 657, 658, 659, 660, 661,
+662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+672, 673, 674, 675, 676, 677,
+};
+
+static const double ELP_ALIGNED amp[] = {
+8.0450800000000005, 0.45585999999999999, 0.41571000000000002, 0.32622000000000001,
+0.29854000000000003, 0.083500000000000005, 0.080420000000000005, 0.073319999999999996,
+0.046379999999999998, 0.03977, 0.024029999999999999, 0.01745,
+0.016469999999999999, 0.01404, 0.01005, 0.0083400000000000002,
+0.0067200000000000003, 0.0058900000000000003, 0.0056299999999999996, 0.00562,
+0.00562, 0.0044099999999999999, 0.0043699999999999998, 0.0042500000000000003,
+0.0037699999999999999, 0.0037100000000000002, 0.0032799999999999999, 0.0032200000000000002,
+0.00315, 0.0029299999999999999, 0.0027599999999999999, 0.0027299999999999998,
+0.0025699999999999998, 0.0025200000000000001, 0.0023900000000000002, 0.0022699999999999999,
+0.0021800000000000001, 0.0021700000000000001, 0.0021199999999999999, 0.0021199999999999999,
+0.0020600000000000002, 0.0018799999999999999, 0.00156, 0.0014599999999999999,
+0.0014400000000000001, 0.00139, 0.00133, 0.0012600000000000001,
+0.0011299999999999999, 0.0011000000000000001, 0.00108, 0.0010399999999999999,
+0.00097000000000000005, 0.00091, 0.00085999999999999998, 0.00084999999999999995,
+0.00079000000000000001, 0.00072000000000000005, 0.00066, 0.00063000000000000003,
+0.00055999999999999995, 0.00055000000000000003, 0.00054000000000000001, 0.00051000000000000004,
+0.00048999999999999998, 0.00048999999999999998, 0.00048999999999999998, 0.00048000000000000001,
+0.00046999999999999999, 0.00042999999999999999, 0.00042999999999999999, 0.00042999999999999999,
+0.00040999999999999999, 0.00038000000000000002, 0.00038000000000000002, 0.00036000000000000002,
+0.00034000000000000002, 0.00034000000000000002, 0.00033, 0.00033,
+0.00033, 0.00033, 0.00032000000000000003, 0.00031,
+0.00029, 0.00029, 0.00029, 0.00027999999999999998,
+0.00025999999999999998, 0.00025999999999999998, 0.00025000000000000001, 0.00025000000000000001,
+0.00025000000000000001, 0.00023000000000000001, 0.00021000000000000001, 0.00021000000000000001,
+0.00021000000000000001, 0.00020000000000000001, 0.00019000000000000001, 0.00019000000000000001,
+0.00019000000000000001, 0.00019000000000000001, 0.00018000000000000001, 0.00018000000000000001,
+0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001, 0.00016000000000000001,
+0.00014999999999999999, 0.00014999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00013999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012999999999999999, 0.00012,
+0.00011, 0.0001, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+9.0000000000000006e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+8.0000000000000007e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-8.0450799993823097, 0.45585999996094478, -0.41570999996985514, 0.32621999996325213,
+0.29853999997642827, -0.083499999993222704, 0.080420000000000005, 0.073319999994370569,
+-0.0463799999965386, 0.039769999992803298, -0.024029999998405712, 0.01744999999880692,
+0.016469999998588954, 0.014039999998891446, 0.010049999998407456, 0.0083399999993596652,
+0.0067199999995541573, -0.0058899999995477735, -0.0056299999996150688, 0.0056199999992596669,
+0.0056199999996383509, -0.0044099999999999999, 0.0043699999997441471, 0.0042500000000000003,
+0.003769999999227351, -0.0037099999996988769, 0.0032799999997481654, 0.0032199999997527726,
+-0.0031499999997649116, -0.0029299999999999999, -0.0027599999998056198, 0.00272999999975347,
+0.0025699999997856509, -0.0025199999998708838, 0.0023899999921628422, -0.0022699999998002998,
+0.0021799999998326222, -0.0021700000000000001, -0.0021199999998279297, 0.0021199999998417814,
+0.0020599999997168356, 0.0018799999998474091, -0.00156, -0.0014599999999145206,
+-0.0014400000000000001, 0.001389999999734432, 0.0013299999999007404, 0.0012600000000000001,
+-0.0011299999999132399, 0.0010999999999006659, 0.00108, 0.0010399999998286734,
+-0.00096999999991909786, 0.0009099999999340121, 0.00085999999992632063, 0.00084999999999999995,
+0.00078999999973999218, -0.00072000000000000005, -0.00065999999942098324, 0.00062999999996191569,
+0.00055999999999999995, 0.00054999999995412766, -0.00053999999996838435, 0.00050999999995860574,
+0.00048999999992386861, 0.00048999999996237839, 0.00048999999999999998, -0.00047999999997455102,
+0.00046999999999999999, 0.00042999999996604852, -0.00042999999997147132, -0.00042999999997060028,
+-0.00040999999996672219, 0.00037999999994885961, -0.00037999999986977606, 0.00035999999997157555,
+-0.00033999999997164255, -0.00033999999996169988, 0.00032999999992882419, -0.00032999999999274219,
+0.00032999999986481565, 0.0003299999999760703, -0.00031999999997402715, -0.00030999999998005138,
+0.00028999999997835694, 0.00028999999997710252, -0.00028999999997710252, 0.00027999999998028024,
+0.0002599999999822234, 0.00025999999999999998, 0.00024999999997858159, 0.0002499999999839124,
+0.0002499999999839124, 0.00022999999995447371, -0.00021000000000000001, -0.00021000000000000001,
+0.00020999999998200854, -0.00020000000000000001, -0.00018999999996929898, 0.0001899999999841532,
+0.00018999999997333015, -0.00019000000000000001, -0.00017999999996437074, 0.00017999999998539025,
+0.00016999999998216266, -0.00016999999998582128, -0.00016999999998582128, -0.00016000000000000001,
+0.00014999999998848316, -0.0001499999999888053, -0.00013999999998863684, 0.00013999999997372765,
+-0.00013999999998635313, 0.00013999999998735746, 0.00013999999997180002, -0.00013999999999999999,
+-0.00013999999999999999, 0.00012999999999999999, -0.00012999999999728935, -0.00012999999998059388,
+-0.00012999999999001874, -0.00012999999998915742, -0.00012999999999057315, 0.00011999999999052519,
+0.00010999999999032292, 9.9999999994145259e-05, 9.0000000000000006e-05, 8.99999999878878e-05,
+8.9999999992893887e-05, 8.9999999995853407e-05, -8.9999999993846576e-05, -8.9999999995388704e-05,
+8.9999999993473732e-05, -8.0000000000000007e-05, -7.9999999993327664e-05, 7.9999999986821041e-05,
+-7.9999999988297819e-05, 7.9999999999410268e-05, 7.9999999984715521e-05, 7.9999999994029508e-05,
+-7.9999999994029508e-05, -6.9999999999999994e-05, -6.9999999993346083e-05, 6.9999999993678729e-05,
+6.9999999979989213e-05, -6.9999999979696018e-05, -6.99999999953558e-05, -6.9999999999999994e-05,
+-6.0000000000000002e-05, -5.9999999994859582e-05, -5.9999999991925203e-05, 5.9999999994859582e-05,
+-5.9999999995897719e-05, 6.0000000000000002e-05, -6.0000000000000002e-05, 6.0000000000000002e-05,
+-5.0000000000000002e-05, -5.0000000000000002e-05, 4.999999999571632e-05, -4.9999999996052158e-05,
+-4.9999999996682716e-05, 4.9999999997166298e-05, -4.9999999996374295e-05, -4.9999999996161059e-05,
+4.9999999996880719e-05, -4.9999999996682716e-05, 4.9999999996161059e-05, -5.0000000000000002e-05,
+-5.0000000000000002e-05, 4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 3.9999999996573057e-05,
+-3.9999999996928852e-05, -3.9999999991372627e-05, 3.9999999975140786e-05, 3.9999999991372627e-05,
+3.9999999996841729e-05, 3.9999999996841729e-05, -3.9999999997014754e-05, -3.9999999997265144e-05,
+-3.9999999996841729e-05, 3.9999999996841729e-05, 3.9999999993536634e-05, 4.0000000000000003e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 2.9999999997360795e-05,
+2.9999999997429791e-05, -2.9999999997429791e-05, 2.9999999997631297e-05, 2.9999999997631297e-05,
+-2.9999999998355066e-05, 2.9999999997497872e-05, -2.9999999994268319e-05, -2.9999999997631297e-05,
+-2.9999999997824573e-05, 2.9999999993310145e-05, 2.9999999997696637e-05, -2.9999999978483805e-05,
+-2.9999999991423955e-05, -2.999999999524614e-05, -2.9999999970752617e-05, -2.9999999994061788e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+2.0000000000000002e-05, 1.9999999998240531e-05, 1.9999999997250831e-05, 1.9999999997308402e-05,
+1.9999999998420865e-05, 1.9999999998420865e-05, 1.9999999998420865e-05, -1.9999999998420865e-05,
+-1.9999999998420865e-05, -1.9999999999327102e-05, -1.9999999997641045e-05, -1.9999999999268616e-05,
+1.9999999998420865e-05, 1.9999999997365363e-05, 1.9999999998420865e-05, 1.9999999998420865e-05,
+1.9999999997308402e-05, -1.9999999998420865e-05, -1.9999999988770584e-05, -1.9999999999688073e-05,
+1.9999999998286529e-05, -1.9999999998420865e-05, 1.9999999998549719e-05, 1.9999999997641045e-05,
+1.9999999998420865e-05, 1.999999999859145e-05, 1.999999999683076e-05, -1.9999999998549719e-05,
+-1.9999999993506776e-05, 1.9999999997477463e-05, 1.9999999998420865e-05, -1.9999999998420865e-05,
+1.9999999998420865e-05, 1.9999999998331916e-05, 1.9999999997192646e-05, 1.9999999998549719e-05,
+-1.9999999998632572e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+-1.0000000000000001e-05, -9.9999999996777149e-06, 9.999999998654201e-06, 9.9999999986826816e-06,
+9.9999999992104323e-06, -9.9999999992104323e-06, -9.9999999992104323e-06, -9.9999999986254154e-06,
+9.999999998654201e-06, -9.9999999987663007e-06, 9.999999998654201e-06, 9.9999999991883484e-06,
+9.9999999987387315e-06, 9.9999999992104323e-06, -9.9999999992104323e-06, -9.9999999987935633e-06,
+-1.8369701987210297e-21, -1.8369701987210297e-21, 9.9999999992104323e-06, 9.9999999988471771e-06,
+-9.9999999973862299e-06, 9.9999999998805912e-06, 9.9999999991883484e-06, -9.9999999992104323e-06,
+-9.9999999989507455e-06, 9.9999999986826816e-06, 9.9999999977700494e-06, 9.999999999316286e-06,
+9.9999999992104323e-06, -9.9999999992104323e-06, -9.9999999993365436e-06, -9.9999999998239315e-06,
+9.9999999995223606e-06, 9.9999999992104323e-06, -9.9999999992748593e-06, -9.9999999993365436e-06,
+-1.0000000000000001e-05, -1.0000000000000001e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+-9.9693325553955656e-05, 5.967193445935603e-06, -5.0063006809607748e-06, 4.8965072536522158e-06,
+3.7515642831120505e-06, -1.0638654455304586e-06, 0, 9.0856953934593907e-07,
+-5.6663859492813617e-07, 7.5658801338914114e-07, -2.768057287047337e-07, 2.0405516949226653e-07,
+2.1559179584644271e-07, 1.764318434209593e-07, 1.789137016124884e-07, 1.0334792632494725e-07,
+7.7408842982740593e-08, -7.2987923987430673e-08, -6.583556471507935e-08, 9.1221378680730047e-08,
+6.3756877573985256e-08, 5.4006923842398276e-19, 4.7287950752611495e-08, 0,
+7.6326738843001727e-08, -4.7268752130754509e-08, 4.0645227619403709e-08, 3.9901717358073161e-08,
+-3.8484510004821668e-08, 3.5882151215017449e-19, -3.2756339399918524e-08, 3.6688566205068423e-08,
+3.3192671713505352e-08, -2.5509732347670075e-08, 1.9355003251760362e-07, -3.0110420255356251e-08,
+2.701420616167686e-08, 2.6574835541497567e-19, -2.7010715503288291e-08, 2.5900686098951514e-08,
+3.4156093459964015e-08, 2.3952898653722129e-08, 1.9104490066698709e-19, -1.5798720388790196e-08,
+1.7634913907721888e-19, 2.7171285793317308e-08, 1.6249015335662981e-08, 0,
+-1.4002776588420485e-08, 1.4782938763946985e-08, 0, 1.8877481188534061e-08,
+-1.252797337034571e-08, 1.0958922373007501e-08, 1.125737367504194e-08, 0,
+2.0268508601186531e-08, 8.817456953860944e-20, -2.764601534341131e-08, 6.9272118010259085e-09,
+0, 7.1034900554194349e-09, -5.8433623355799361e-09, 6.4978608049990883e-09,
+8.6376344676725925e-09, 6.0720004675328713e-09, 0, -4.942772441434564e-09,
+0, 5.4035393640322286e-09, -4.9532444171050974e-09, -5.028293575041585e-09,
+-5.2237704511076409e-09, 6.2343160878440743e-09, -9.9483767352009804e-09, 4.5238934210502383e-09,
+-4.3912483978531355e-09, -5.1033427325440856e-09, 6.8539079720889717e-09, -2.1886428819519151e-09,
+9.4457219105034994e-09, 3.9741147066950277e-09, -4.0770891325718175e-09, -3.5168384426563314e-09,
+3.5430183814603488e-09, 3.6442474780682475e-09, -3.6442474780180819e-09, 3.323106895719191e-09,
+3.0403635569048305e-09, 0, 3.2724923473959131e-09, 2.8361600344299494e-09,
+2.8361600344299494e-09, 4.5762532984271909e-09, 2.5717582782094418e-20, 2.5717582782094418e-20,
+2.7488935718125669e-09, 2.4492935982947065e-20, -3.4156093459506843e-09, 2.4539329282358045e-09,
+3.1834805554887053e-09, 2.3268289183799713e-20, -3.5814156248462653e-09, 2.2933626370585017e-09,
+2.4626595744778676e-09, -2.1956241989265677e-09, -2.1956241989265677e-09, 1.9594348786357652e-20,
+1.8587756533263891e-09, -1.8325957145153173e-09, -1.7837264955001701e-09, 2.7122416574295289e-09,
+-1.9547687621727621e-09, 1.8814649335932524e-09, 2.8099800955221999e-09, 1.7145055188062943e-20,
+1.7145055188062943e-20, 0, -8.3950337021621526e-10, -2.2462387471799799e-09,
+-1.6109388995527992e-09, -1.6790067403556105e-09, -1.5655603389981012e-09, 1.5079644736834128e-09,
+1.4590952546244725e-09, 1.0821041362153661e-09, 0, 1.476548547120965e-09,
+1.1309733552625596e-09, 8.6393797972392497e-10, -1.0524335389621922e-09, -9.1106186955964555e-10,
+1.0838494654622804e-09, 9.7971743931788258e-21, -1.0332349171419143e-09, 1.4521139375795432e-09,
+-1.3683381334973271e-09, 3.0717794835024724e-10, 1.5638150096873272e-09, 9.7738438109251002e-10,
+-9.7738438107483607e-10, 8.5725275940314716e-21, -9.6516707630637584e-10, 9.407324667966262e-10,
+1.6737707525030693e-09, -1.6859880572688851e-09, -8.0634211441245769e-10, 8.5725275940314716e-21,
+7.347880794884119e-21, -7.8539816338227718e-10, -9.8436569810190469e-10, 7.8539816337501908e-10,
+-7.0162235930812822e-10, 0, 7.347880794884119e-21, 0,
+6.1232339957367663e-21, 6.1232339957367663e-21, 6.5449846947918255e-10, -6.2831853069277278e-10,
+-5.7595865315175555e-10, 5.3232542184821413e-10, -6.0213859192234673e-10, -6.1959188444338432e-10,
+5.585053606265713e-10, -5.7595865315175555e-10, 6.195918844421298e-10, 6.1232339957367663e-21,
+6.1232339957367663e-21, 0, 4.8985871965894129e-21, 4.8985871965894129e-21,
+4.8985871965894129e-21, 0, 0, 5.2359877558334612e-10,
+-4.9567350755470752e-10, -8.3077672390107121e-10, 1.4102260353192758e-09, 8.3077672388957237e-10,
+5.0265482456113757e-10, 5.0265482456113757e-10, -4.8869219053741803e-10, -4.6774823953875218e-10,
+-5.0265482455421821e-10, 5.0265482456113757e-10, 7.1907565178293345e-10, 0,
+0, 0, 3.6739403974420595e-21, 3.6739403974420595e-21,
+0, 0, 0, 3.9793506944303798e-10,
+3.9269908168750954e-10, -3.9269908169113859e-10, 3.769911184208532e-10, 3.769911184208532e-10,
+-3.1415926535274136e-10, 3.8746309393196917e-10, -5.864306286296768e-10, -3.7699111841566363e-10,
+-3.61283155153408e-10, 6.3355451842684839e-10, 3.7175513066527788e-10, -1.1362093427758361e-09,
+-7.1733032250956064e-10, -5.3407075108511562e-10, -1.3247049018316073e-09, -5.9690260414104417e-10,
+3.6739403974420595e-21, 3.6739403974420595e-21, 3.6739403974420595e-21, 3.6739403974420595e-21,
+0, 0, 3.6739403974420595e-21, 0,
+2.4492935982947065e-21, 2.4492935982947065e-21, 2.4492935982947065e-21, 2.4492935982947065e-21,
+0, 2.6529004629535865e-10, 3.316125578637283e-10, 3.2812189936021445e-10,
+2.5132741228056879e-10, 2.5132741228056879e-10, 2.5132741228056879e-10, -2.513274122771091e-10,
+-2.513274122771091e-10, -1.6406094968350505e-10, -3.0717794833425396e-10, 1.7104226669709474e-10,
+2.5132741228056879e-10, 3.2463124085669063e-10, 2.5132741228056879e-10, 2.5132741228056879e-10,
+3.2812189936021445e-10, -2.513274122771091e-10, -6.7020643264116621e-10, -1.1170107212218429e-10,
+2.6179938779167306e-10, -2.513274122771091e-10, 2.4085543676939565e-10, 3.0717794833892505e-10,
+2.5132741228056879e-10, 2.3736477826565655e-10, 3.5604716738803668e-10, -2.4085543676893868e-10,
+-5.0963614153256175e-10, 3.1764992384961331e-10, 2.5132741228056879e-10, -2.513274122771091e-10,
+2.5132741228056879e-10, 2.5830872928797946e-10, 3.3510321636723216e-10, 2.4085543676939565e-10,
+-2.3387411976937609e-10, 2.4492935982947065e-21, 0, 0,
+2.4492935982947065e-21, 0, 2.4492935982947065e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, 2.4492935982947065e-21, 1.2246467991473532e-21, 0,
+0, 1.2246467991473532e-21, 0, 0,
+1.2246467991473532e-21, -8.0285145591796427e-11, 1.6406094968010723e-10, 1.6231562042834531e-10,
+1.2566370614028439e-10, -1.2566370613855455e-10, -1.2566370613855455e-10, -1.6580627892898605e-10,
+1.6406094968010723e-10, -1.5707963267117389e-10, 1.6406094968010723e-10, 1.27409035392139e-10,
+1.5882496192480665e-10, 1.2566370614028439e-10, -1.2566370613855455e-10, -1.5533430342137325e-10,
+-1.0000000000000001e-05, -1.0000000000000001e-05, 1.2566370614028439e-10, 1.5184364491767172e-10,
+-2.2863813198820625e-10, 4.8869219055646711e-11, 1.27409035392139e-10, -1.2566370613855455e-10,
+-1.4486232790914918e-10, 1.6231562042834531e-10, 2.1118483947561616e-10, 1.1693705988095506e-10,
+1.2566370614028439e-10, -1.2566370613855455e-10, -1.1519173063035111e-10, -5.93411945655023e-11,
+9.7738438110126322e-11, 1.2566370614028439e-10, -1.2042771838446934e-10, -1.1519173063035111e-10,
+1.2246467991473532e-21, 1.2246467991473532e-21, 1.2246467991473532e-21, 0,
+};
+
+const struct elp_table elp5 = {
+    arg, max_arg, amp, c, s, 316
 };
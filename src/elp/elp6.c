@@ -1,240 +1,248 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp6[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.043010, 99999.999000},
-{0.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000030, 0.075000},
-{0.000000, {0.000000, 0.000000, 0.000000, 2.000000}, 270.000000, 0.000040, 0.037000},
-{0.000000, {0.000000, 0.000000, 1.000000, -2.000000}, 270.000000, 0.004440, 0.074000},
-{0.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 90.000000, 0.005310, 0.075000},
-{0.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 90.000000, 0.000260, 2.998000},
-{0.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 90.000000, 0.000420, 0.038000},
-{0.000000, {0.000000, 0.000000, 2.000000, 2.000000}, 270.000000, 0.000040, 0.019000},
-{0.000000, {0.000000, 0.000000, 3.000000, -2.000000}, 270.000000, 0.000020, 0.077000},
-{0.000000, {0.000000, 0.000000, 3.000000, 0.000000}, 90.000000, 0.000030, 0.025000},
-{0.000000, {0.000000, 1.000000, -2.000000, 0.000000}, 270.000000, 0.000040, 0.039000},
-{0.000000, {0.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.000370, 0.082000},
-{0.000000, {0.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.000090, 1.000000},
-{0.000000, {0.000000, 1.000000, 1.000000, -2.000000}, 270.000000, 0.000050, 0.079000},
-{0.000000, {0.000000, 1.000000, 1.000000, 0.000000}, 90.000000, 0.000170, 0.070000},
-{0.000000, {0.000000, 1.000000, 2.000000, 0.000000}, 90.000000, 0.000020, 0.036000},
-{0.000000, {0.000000, 2.000000, 0.000000, 0.000000}, 270.000000, 0.000020, 0.500000},
-{0.000000, {1.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.000120, 0.088000},
-{0.000000, {1.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.000050, 1.127000},
-{0.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000880, 0.081000},
-{0.000000, {1.000000, 0.000000, 1.000000, 0.000000}, 90.000000, 0.000060, 0.039000},
-{0.000000, {1.000000, 1.000000, -1.000000, 0.000000}, 270.000000, 0.000040, 8.850000},
-{0.000000, {1.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.000640, 0.075000},
-{0.000000, {1.000000, 1.000000, 1.000000, 0.000000}, 90.000000, 0.000040, 0.038000},
-{0.000000, {2.000000, -1.000000, -1.000000, 0.000000}, 270.000000, 0.000530, 0.095000},
-{0.000000, {2.000000, -1.000000, 1.000000, -2.000000}, 270.000000, 0.000030, 0.099000},
-{0.000000, {2.000000, 0.000000, -3.000000, 0.000000}, 90.000000, 0.000030, 0.067000},
-{0.000000, {2.000000, 0.000000, -2.000000, 0.000000}, 90.000000, 0.000820, 0.564000},
-{0.000000, {2.000000, 0.000000, -2.000000, 2.000000}, 270.000000, 0.000030, 0.040000},
-{0.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.019610, 0.087000},
-{0.000000, {2.000000, 0.000000, -1.000000, 2.000000}, 270.000000, 0.000030, 0.026000},
-{0.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 90.000000, 0.000210, 0.474000},
-{0.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000470, 0.040000},
-{0.000000, {2.000000, 0.000000, 1.000000, -2.000000}, 270.000000, 0.000710, 0.090000},
-{0.000000, {2.000000, 0.000000, 2.000000, -2.000000}, 270.000000, 0.000050, 0.041000},
-{0.000000, {2.000000, 1.000000, -1.000000, 0.000000}, 90.000000, 0.000080, 0.080000},
-{0.000000, {2.000000, 1.000000, 0.000000, 0.000000}, 90.000000, 0.000030, 0.039000},
-{0.000000, {2.000000, 2.000000, -1.000000, 0.000000}, 270.000000, 0.000090, 0.074000},
-{0.000000, {4.000000, -1.000000, -1.000000, 0.000000}, 270.000000, 0.000020, 0.028000},
-{0.000000, {4.000000, 0.000000, -2.000000, 0.000000}, 270.000000, 0.000170, 0.044000},
-{0.000000, {4.000000, 0.000000, -1.000000, 0.000000}, 270.000000, 0.000170, 0.028000},
-{0.000000, {4.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000020, 0.020000},
-{1.000000, {-6.000000, 0.000000, 1.000000, -1.000000}, 90.000940, 0.000020, 0.016000},
-{1.000000, {-6.000000, 0.000000, 2.000000, -1.000000}, 90.000700, 0.000030, 0.021000},
-{1.000000, {-4.000000, -1.000000, 1.000000, -1.000000}, 270.000940, 0.000030, 0.027000},
-{1.000000, {-4.000000, 0.000000, -1.000000, -1.000000}, 90.001030, 0.000120, 0.016000},
-{1.000000, {-4.000000, 0.000000, -1.000000, 1.000000}, 270.000270, 0.000050, 0.028000},
-{1.000000, {-4.000000, 0.000000, 0.000000, -1.000000}, 90.000960, 0.000750, 0.020000},
-{1.000000, {-4.000000, 0.000000, 0.000000, 1.000000}, 90.000860, 0.000400, 0.044000},
-{1.000000, {-4.000000, 0.000000, 1.000000, -1.000000}, 90.000790, 0.001490, 0.028000},
-{1.000000, {-4.000000, 0.000000, 1.000000, 1.000000}, 90.000790, 0.000270, 0.106000},
-{1.000000, {-4.000000, 0.000000, 2.000000, -1.000000}, 90.000280, 0.000460, 0.043000},
-{1.000000, {-4.000000, 0.000000, 2.000000, 1.000000}, 90.000670, 0.000080, 0.261000},
-{1.000000, {-4.000000, 1.000000, 0.000000, -1.000000}, 90.000950, 0.000100, 0.021000},
-{1.000000, {-4.000000, 1.000000, 0.000000, 1.000000}, 90.000720, 0.000050, 0.046000},
-{1.000000, {-4.000000, 1.000000, 1.000000, -1.000000}, 90.000790, 0.000170, 0.028000},
-{1.000000, {-4.000000, 1.000000, 1.000000, 1.000000}, 90.000720, 0.000020, 0.119000},
-{1.000000, {-4.000000, 1.000000, 2.000000, -1.000000}, 90.000290, 0.000040, 0.045000},
-{1.000000, {-3.000000, 0.000000, 0.000000, -1.000000}, 90.000920, 0.000080, 0.027000},
-{1.000000, {-3.000000, 0.000000, 0.000000, 1.000000}, 270.000720, 0.000180, 0.097000},
-{1.000000, {-3.000000, 0.000000, 1.000000, -1.000000}, 270.000690, 0.000070, 0.042000},
-{1.000000, {-2.000000, -2.000000, 1.000000, -1.000000}, 270.000240, 0.000020, 0.074000},
-{1.000000, {-2.000000, -1.000000, -1.000000, -1.000000}, 270.001090, 0.000140, 0.026000},
-{1.000000, {-2.000000, -1.000000, -1.000000, 1.000000}, 90.000590, 0.000060, 0.082000},
-{1.000000, {-2.000000, -1.000000, 0.000000, -1.000000}, 270.000970, 0.000960, 0.039000},
-{1.000000, {-2.000000, -1.000000, 0.000000, 1.000000}, 90.000720, 0.000120, 0.949000},
-{1.000000, {-2.000000, -1.000000, 1.000000, -1.000000}, 270.000470, 0.000440, 0.080000},
-{1.000000, {-2.000000, -1.000000, 1.000000, 1.000000}, 90.000650, 0.000050, 0.070000},
-{1.000000, {-2.000000, -1.000000, 2.000000, -1.000000}, 90.000720, 0.000020, 1.388000},
-{1.000000, {-2.000000, 0.000000, -3.000000, -1.000000}, 90.001170, 0.000070, 0.015000},
-{1.000000, {-2.000000, 0.000000, -3.000000, 1.000000}, 270.000470, 0.000030, 0.027000},
-{1.000000, {-2.000000, 0.000000, -2.000000, -1.000000}, 90.001130, 0.000800, 0.019000},
-{1.000000, {-2.000000, 0.000000, -2.000000, 1.000000}, 270.000440, 0.000440, 0.041000},
-{1.000000, {-2.000000, 0.000000, -1.000000, -1.000000}, 90.001080, 0.009250, 0.026000},
-{1.000000, {-2.000000, 0.000000, -1.000000, 1.000000}, 270.000460, 0.006170, 0.089000},
-{1.000000, {-2.000000, 0.000000, -1.000000, 3.000000}, 90.000740, 0.000030, 0.064000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -1.000000}, 90.000960, 0.095540, 0.040000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000050, 0.088000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 1.000000}, 270.000790, 0.008540, 0.487000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -3.000000}, 270.000880, 0.000030, 0.026000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -1.000000}, 90.000280, 0.038550, 0.087000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 1.000000}, 270.000700, 0.007850, 0.065000},
-{1.000000, {-2.000000, 0.000000, 2.000000, -3.000000}, 270.000300, 0.000020, 0.040000},
-{1.000000, {-2.000000, 0.000000, 2.000000, -1.000000}, 90.002160, 0.002800, 0.581000},
-{1.000000, {-2.000000, 0.000000, 2.000000, 1.000000}, 270.000710, 0.000400, 0.035000},
-{1.000000, {-2.000000, 0.000000, 3.000000, -1.000000}, 90.001590, 0.000470, 0.067000},
-{1.000000, {-2.000000, 0.000000, 3.000000, 1.000000}, 270.000910, 0.000020, 0.024000},
-{1.000000, {-2.000000, 0.000000, 4.000000, -1.000000}, 90.001490, 0.000040, 0.035000},
-{1.000000, {-2.000000, 1.000000, -2.000000, -1.000000}, 90.001120, 0.000070, 0.020000},
-{1.000000, {-2.000000, 1.000000, -2.000000, 1.000000}, 270.000500, 0.000020, 0.043000},
-{1.000000, {-2.000000, 1.000000, -1.000000, -1.000000}, 90.001090, 0.000690, 0.027000},
-{1.000000, {-2.000000, 1.000000, -1.000000, 1.000000}, 270.000480, 0.000280, 0.098000},
-{1.000000, {-2.000000, 1.000000, 0.000000, -1.000000}, 90.000960, 0.006570, 0.042000},
-{1.000000, {-2.000000, 1.000000, 0.000000, 1.000000}, 270.000770, 0.000560, 0.327000},
-{1.000000, {-2.000000, 1.000000, 1.000000, -1.000000}, 90.000290, 0.001600, 0.095000},
-{1.000000, {-2.000000, 1.000000, 1.000000, 1.000000}, 270.000710, 0.000290, 0.061000},
-{1.000000, {-2.000000, 1.000000, 2.000000, -1.000000}, 90.002270, 0.000110, 0.368000},
-{1.000000, {-2.000000, 2.000000, -1.000000, -1.000000}, 90.000940, 0.000030, 0.028000},
-{1.000000, {-2.000000, 2.000000, 0.000000, -1.000000}, 90.000950, 0.000320, 0.044000},
-{1.000000, {-2.000000, 2.000000, 0.000000, 1.000000}, 270.000720, 0.000030, 0.247000},
-{1.000000, {-2.000000, 2.000000, 1.000000, -1.000000}, 90.000300, 0.000050, 0.105000},
-{1.000000, {-1.000000, -1.000000, -1.000000, -1.000000}, 90.001210, 0.000030, 0.037000},
-{1.000000, {-1.000000, -1.000000, 0.000000, -1.000000}, 90.001070, 0.000180, 0.075000},
-{1.000000, {-1.000000, -1.000000, 0.000000, 1.000000}, 270.000520, 0.000040, 0.075000},
-{1.000000, {-1.000000, 0.000000, -1.000000, -1.000000}, 270.001280, 0.000180, 0.039000},
-{1.000000, {-1.000000, 0.000000, -1.000000, 1.000000}, 270.000720, 0.000050, 0.857000},
-{1.000000, {-1.000000, 0.000000, 0.000000, -1.000000}, 270.001370, 0.000630, 0.081000},
-{1.000000, {-1.000000, 0.000000, 0.000000, 1.000000}, 90.000680, 0.000750, 0.069000},
-{1.000000, {-1.000000, 0.000000, 1.000000, -1.000000}, 270.001230, 0.000140, 1.200000},
-{1.000000, {-1.000000, 0.000000, 1.000000, 1.000000}, 90.000720, 0.000040, 0.036000},
-{1.000000, {-1.000000, 0.000000, 2.000000, -1.000000}, 270.001290, 0.000060, 0.071000},
-{1.000000, {-1.000000, 1.000000, 0.000000, -1.000000}, 269.999920, 0.000030, 0.088000},
-{1.000000, {0.000000, -2.000000, -1.000000, -1.000000}, 270.001370, 0.000020, 0.065000},
-{1.000000, {0.000000, -2.000000, 1.000000, -1.000000}, 270.001150, 0.000060, 0.089000},
-{1.000000, {0.000000, -1.000000, -3.000000, -1.000000}, 270.001270, 0.000020, 0.024000},
-{1.000000, {0.000000, -1.000000, -2.000000, -1.000000}, 270.001340, 0.000220, 0.036000},
-{1.000000, {0.000000, -1.000000, -2.000000, 1.000000}, 270.000730, 0.000030, 1.389000},
-{1.000000, {0.000000, -1.000000, -1.000000, -1.000000}, 270.001400, 0.001810, 0.070000},
-{1.000000, {0.000000, -1.000000, -1.000000, 1.000000}, 90.001620, 0.000100, 0.080000},
-{1.000000, {0.000000, -1.000000, 0.000000, -1.000000}, 90.000670, 0.000280, 0.949000},
-{1.000000, {0.000000, -1.000000, 0.000000, 1.000000}, 90.000870, 0.000130, 0.039000},
-{1.000000, {0.000000, -1.000000, 1.000000, -1.000000}, 270.001180, 0.003410, 0.082000},
-{1.000000, {0.000000, -1.000000, 1.000000, 1.000000}, 270.000000, 0.000030, 0.026000},
-{1.000000, {0.000000, -1.000000, 2.000000, -1.000000}, 270.001210, 0.000340, 0.039000},
-{1.000000, {0.000000, -1.000000, 3.000000, -1.000000}, 270.001270, 0.000030, 0.026000},
-{1.000000, {0.000000, 0.000000, -4.000000, -1.000000}, 90.001280, 0.000100, 0.019000},
-{1.000000, {0.000000, 0.000000, -3.000000, -1.000000}, 90.001280, 0.001500, 0.025000},
-{1.000000, {0.000000, 0.000000, -3.000000, 1.000000}, 270.000000, 0.000060, 0.077000},
-{1.000000, {0.000000, 0.000000, -2.000000, -1.000000}, 90.001280, 0.024690, 0.038000},
-{1.000000, {0.000000, 0.000000, -2.000000, 1.000000}, 90.000620, 0.004850, 3.574000},
-{1.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 90.001280, 0.452760, 0.075000},
-{1.000000, {0.000000, 0.000000, -1.000000, 1.000000}, 270.000610, 0.085080, 0.074000},
-{1.000000, {0.000000, 0.000000, 0.000000, -3.000000}, 90.000670, 0.000120, 0.037000},
-{1.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 90.000010, 0.028090, 18.613000},
-{1.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000250, 0.075000},
-{1.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 90.000500, 0.003900, 0.037000},
-{1.000000, {0.000000, 0.000000, 1.000000, -3.000000}, 270.000370, 0.001080, 0.073000},
-{1.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 270.001260, 0.456480, 0.076000},
-{1.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 90.000240, 0.000250, 0.025000},
-{1.000000, {0.000000, 0.000000, 2.000000, -3.000000}, 270.002800, 0.000040, 2.582000},
-{1.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 270.001260, 0.024880, 0.038000},
-{1.000000, {0.000000, 0.000000, 2.000000, 1.000000}, 90.000000, 0.000020, 0.019000},
-{1.000000, {0.000000, 0.000000, 3.000000, -1.000000}, 270.001260, 0.001530, 0.025000},
-{1.000000, {0.000000, 0.000000, 3.000000, 1.000000}, 270.000000, 0.000020, 0.015000},
-{1.000000, {0.000000, 0.000000, 4.000000, -1.000000}, 270.001260, 0.000100, 0.019000},
-{1.000000, {0.000000, 1.000000, -3.000000, -1.000000}, 90.001270, 0.000030, 0.026000},
-{1.000000, {0.000000, 1.000000, -2.000000, -1.000000}, 90.001340, 0.000270, 0.039000},
-{1.000000, {0.000000, 1.000000, -2.000000, 1.000000}, 90.000720, 0.000050, 0.781000},
-{1.000000, {0.000000, 1.000000, -1.000000, -1.000000}, 90.001430, 0.002180, 0.081000},
-{1.000000, {0.000000, 1.000000, -1.000000, 1.000000}, 270.000840, 0.000250, 0.069000},
-{1.000000, {0.000000, 1.000000, 0.000000, -1.000000}, 90.000800, 0.000240, 1.057000},
-{1.000000, {0.000000, 1.000000, 0.000000, 1.000000}, 90.000640, 0.000150, 0.036000},
-{1.000000, {0.000000, 1.000000, 1.000000, -1.000000}, 90.001160, 0.002790, 0.070000},
-{1.000000, {0.000000, 1.000000, 2.000000, -1.000000}, 90.001210, 0.000280, 0.036000},
-{1.000000, {0.000000, 1.000000, 3.000000, -1.000000}, 90.001270, 0.000020, 0.025000},
-{1.000000, {0.000000, 2.000000, -1.000000, -1.000000}, 90.001470, 0.000030, 0.088000},
-{1.000000, {0.000000, 2.000000, 1.000000, -1.000000}, 90.001200, 0.000030, 0.066000},
-{1.000000, {1.000000, -1.000000, 0.000000, -1.000000}, 90.000800, 0.000020, 0.088000},
-{1.000000, {1.000000, 0.000000, -2.000000, -1.000000}, 90.001800, 0.000030, 0.070000},
-{1.000000, {1.000000, 0.000000, -1.000000, -1.000000}, 269.999530, 0.000060, 1.063000},
-{1.000000, {1.000000, 0.000000, -1.000000, 1.000000}, 90.000720, 0.000020, 0.039000},
-{1.000000, {1.000000, 0.000000, 0.000000, -1.000000}, 90.000880, 0.002990, 0.081000},
-{1.000000, {1.000000, 0.000000, 0.000000, 1.000000}, 90.000510, 0.000020, 0.026000},
-{1.000000, {1.000000, 0.000000, 1.000000, -1.000000}, 90.001040, 0.000310, 0.039000},
-{1.000000, {1.000000, 0.000000, 2.000000, -1.000000}, 90.000900, 0.000020, 0.026000},
-{1.000000, {1.000000, 1.000000, 0.000000, -1.000000}, 270.000580, 0.000590, 0.075000},
-{1.000000, {1.000000, 1.000000, 1.000000, -1.000000}, 270.000850, 0.000050, 0.038000},
-{1.000000, {2.000000, -2.000000, -1.000000, -1.000000}, 270.000410, 0.000070, 0.106000},
-{1.000000, {2.000000, -2.000000, 0.000000, -1.000000}, 270.000930, 0.000360, 0.044000},
-{1.000000, {2.000000, -2.000000, 1.000000, -1.000000}, 270.000940, 0.000030, 0.028000},
-{1.000000, {2.000000, -1.000000, -2.000000, -1.000000}, 270.002810, 0.000080, 0.354000},
-{1.000000, {2.000000, -1.000000, -2.000000, 1.000000}, 270.000590, 0.000030, 0.042000},
-{1.000000, {2.000000, -1.000000, -1.000000, -1.000000}, 270.000420, 0.002180, 0.096000},
-{1.000000, {2.000000, -1.000000, -1.000000, 1.000000}, 270.000390, 0.000060, 0.027000},
-{1.000000, {2.000000, -1.000000, 0.000000, -1.000000}, 270.000920, 0.007450, 0.042000},
-{1.000000, {2.000000, -1.000000, 0.000000, 1.000000}, 270.000000, 0.000020, 0.020000},
-{1.000000, {2.000000, -1.000000, 1.000000, -1.000000}, 270.001050, 0.000750, 0.027000},
-{1.000000, {2.000000, -1.000000, 2.000000, -1.000000}, 270.001120, 0.000070, 0.020000},
-{1.000000, {2.000000, 0.000000, -4.000000, -1.000000}, 270.001480, 0.000040, 0.035000},
-{1.000000, {2.000000, 0.000000, -3.000000, -1.000000}, 270.001680, 0.000420, 0.066000},
-{1.000000, {2.000000, 0.000000, -3.000000, 1.000000}, 90.000240, 0.000060, 0.085000},
-{1.000000, {2.000000, 0.000000, -2.000000, -3.000000}, 270.001220, 0.000020, 0.035000},
-{1.000000, {2.000000, 0.000000, -2.000000, -1.000000}, 270.003000, 0.001770, 0.547000},
-{1.000000, {2.000000, 0.000000, -2.000000, 1.000000}, 270.000640, 0.000780, 0.040000},
-{1.000000, {2.000000, 0.000000, -1.000000, -3.000000}, 270.001200, 0.000180, 0.065000},
-{1.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 270.000430, 0.053430, 0.088000},
-{1.000000, {2.000000, 0.000000, -1.000000, 1.000000}, 270.000620, 0.000590, 0.026000},
-{1.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 270.000920, 0.106890, 0.041000},
-{1.000000, {2.000000, 0.000000, 0.000000, 1.000000}, 270.000950, 0.000020, 0.019000},
-{1.000000, {2.000000, 0.000000, 1.000000, -3.000000}, 90.001070, 0.000100, 0.090000},
-{1.000000, {2.000000, 0.000000, 1.000000, -1.000000}, 270.001050, 0.009920, 0.026000},
-{1.000000, {2.000000, 0.000000, 2.000000, -1.000000}, 270.001110, 0.000840, 0.020000},
-{1.000000, {2.000000, 0.000000, 3.000000, -1.000000}, 270.001150, 0.000070, 0.016000},
-{1.000000, {2.000000, 1.000000, -2.000000, -1.000000}, 90.000720, 0.000020, 1.208000},
-{1.000000, {2.000000, 1.000000, -1.000000, -1.000000}, 90.000080, 0.000160, 0.080000},
-{1.000000, {2.000000, 1.000000, 0.000000, -1.000000}, 90.000920, 0.001150, 0.039000},
-{1.000000, {2.000000, 1.000000, 1.000000, -1.000000}, 90.001040, 0.000160, 0.026000},
-{1.000000, {2.000000, 2.000000, -1.000000, -1.000000}, 90.000330, 0.000050, 0.074000},
-{1.000000, {3.000000, 0.000000, -1.000000, -1.000000}, 90.000700, 0.000120, 0.042000},
-{1.000000, {3.000000, 0.000000, 0.000000, -1.000000}, 270.000960, 0.000070, 0.027000},
-{1.000000, {4.000000, -1.000000, -2.000000, -1.000000}, 270.000420, 0.000060, 0.046000},
-{1.000000, {4.000000, -1.000000, -1.000000, -1.000000}, 270.000780, 0.000200, 0.028000},
-{1.000000, {4.000000, -1.000000, 0.000000, -1.000000}, 270.000930, 0.000110, 0.021000},
-{1.000000, {4.000000, 0.000000, -2.000000, -1.000000}, 270.000420, 0.000630, 0.044000},
-{1.000000, {4.000000, 0.000000, -1.000000, -1.000000}, 270.000780, 0.001760, 0.028000},
-{1.000000, {4.000000, 0.000000, 0.000000, -1.000000}, 270.000930, 0.000840, 0.020000},
-{1.000000, {4.000000, 0.000000, 1.000000, -1.000000}, 270.001050, 0.000130, 0.016000},
-{1.000000, {4.000000, 1.000000, -1.000000, -1.000000}, 90.000940, 0.000030, 0.027000},
-{1.000000, {6.000000, 0.000000, -2.000000, -1.000000}, 270.000700, 0.000030, 0.021000},
-{1.000000, {6.000000, 0.000000, -1.000000, -1.000000}, 270.000940, 0.000020, 0.016000},
-{2.000000, {-2.000000, 0.000000, -1.000000, -2.000000}, 270.000000, 0.000050, 0.026000},
-{2.000000, {-2.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000090, 0.089000},
-{2.000000, {-2.000000, 0.000000, 0.000000, -2.000000}, 270.000000, 0.000470, 0.040000},
-{2.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000040, 0.500000},
-{2.000000, {-2.000000, 0.000000, 1.000000, -2.000000}, 270.000000, 0.000190, 0.086000},
-{2.000000, {-2.000000, 1.000000, 0.000000, -2.000000}, 270.000000, 0.000040, 0.042000},
-{2.000000, {0.000000, -1.000000, 0.000000, 0.000000}, 90.000000, 0.000020, 0.039000},
-{2.000000, {0.000000, 0.000000, -2.000000, -2.000000}, 270.000000, 0.000120, 0.038000},
-{2.000000, {0.000000, 0.000000, -2.000000, 0.000000}, 270.000000, 0.000050, 4.424000},
-{2.000000, {0.000000, 0.000000, -1.000000, -2.000000}, 270.000000, 0.002190, 0.075000},
-{2.000000, {0.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000770, 0.074000},
-{2.000000, {0.000000, 0.000000, 0.000000, -2.000000}, 270.000000, 0.000280, 9.307000},
-{2.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 0.000000, 0.000030, 0.075000},
-{2.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.004480, 0.037000},
-{2.000000, {0.000000, 0.000000, 1.000000, -2.000000}, 90.000000, 0.002230, 0.076000},
-{2.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 90.000000, 0.000500, 0.025000},
-{2.000000, {0.000000, 0.000000, 2.000000, -2.000000}, 90.000000, 0.000120, 0.038000},
-{2.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 90.000000, 0.000060, 0.019000},
-{2.000000, {1.000000, 0.000000, 0.000000, -2.000000}, 270.000000, 0.000020, 0.082000},
-{2.000000, {1.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000030, 0.026000},
-{2.000000, {1.000000, 1.000000, 0.000000, -2.000000}, 90.000000, 0.000040, 0.075000},
-{2.000000, {2.000000, -1.000000, 0.000000, -2.000000}, 90.000000, 0.000040, 0.042000},
-{2.000000, {2.000000, 0.000000, -1.000000, -2.000000}, 90.000000, 0.000320, 0.088000},
-{2.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 90.000000, 0.000090, 0.026000},
-{2.000000, {2.000000, 0.000000, 0.000000, -2.000000}, 90.000000, 0.000560, 0.041000},
-{2.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 90.000000, 0.000050, 0.019000},
-{2.000000, {2.000000, 0.000000, 1.000000, -2.000000}, 90.000000, 0.000050, 0.026000},
+
+static const uint16_t arg[] = {
+2, 3, 9, 13, 15, 14, 25, 16, 1, 22,
+23, 26, 31, 33, 17, 50, 38, 44, 34, 63,
+52, 74, 45, 6, 51, 55, 70, 61, 73, 76,
+71, 62, 89, 94, 82, 80, 72, 78, 95, 103,
+139, 145, 110, 98, 102, 125, 111, 132, 122, 126,
+141, 113, 115, 129, 131, 127, 116, 137, 36, 88,
+140, 91, 194, 109, 156, 193, 134, 146, 135, 199,
+172, 212, 152, 106, 183, 154, 204, 164, 158, 243,
+148, 64, 170, 21, 209, 169, 118, 0, 20, 259,
+75, 186, 136, 205, 200, 206, 223, 207, 286, 123,
+195, 222, 231, 234, 214, 174, 270, 190, 280, 215,
+244, 249, 100, 29, 262, 241, 235, 291, 246, 279,
+306, 239, 233, 250, 43, 287, 263, 343, 216, 384,
+383, 338, 333, 290, 304, 281, 282, 271, 428, 329,
+289, 336, 317, 261, 274, 171, 364, 307, 429, 356,
+294, 316, 288, 488, 489, 8, 305, 487, 442, 318,
+366, 402, 293, 455, 320, 167, 493, 321, 221, 357,
+332, 360, 492, 490, 391, 363, 159, 491, 403, 404,
+367, 494, 385, 578, 330, 579, 228, 432, 501, 359,
+580, 157, 387, 335, 388, 389, 439, 196, 361, 392,
+395, 444, 446, 362, 448, 399, 400, 11, 581, 430,
+346, 276, 456, 500, 431, 506, 508, 334, 582, 303,
+386, 512, 438, 56, 192, 394, 445, 515, 213, 397,
+184, 517, 46, 583, 401, 584, 526,
+};
+
+static const uint16_t max_arg[] = {
+2, 3, 9, 13, 15, 15, 25, 25, 25, 25,
+25, 26, 31, 33, 33, 50, 50, 50, 50, 63,
+63, 74, 74, 74, 74, 74, 74, 74, 74, 76,
+76, 76, 89, 94, 94, 94, 94, 94, 95, 103,
+139, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 194, 194, 194, 194, 194, 194, 194, 199,
+199, 212, 212, 212, 212, 212, 212, 212, 212, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 259,
+259, 259, 259, 259, 259, 259, 259, 259, 286, 286,
+286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+286, 286, 286, 286, 286, 286, 286, 291, 291, 291,
+306, 306, 306, 306, 306, 306, 306, 343, 343, 384,
+384, 384, 384, 384, 384, 384, 384, 384, 428, 428,
+428, 428, 428, 428, 428, 428, 428, 428, 429, 429,
+429, 429, 429, 488, 489, 489, 489, 489, 489, 489,
+489, 489, 489, 489, 489, 489, 493, 493, 493, 493,
+493, 493, 493, 493, 493, 493, 493, 493, 493, 493,
+493, 494, 494, 578, 578, 579, 579, 579, 579, 579,
+580, 580, 580, 580, 580, 580, 580, 580, 580, 580,
+580, 580, 580, 580, 580, 580, 580, 580, 581, 581,
+581, 581, 581, 581, 581, 581, 581, 581, 582, 582,
+582, 582, 582, 582, 582, 582, 582, 582, 582, 582,
+582, 582, 582, 583, 583, 584, 584,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.45648, 0.45276, 0.10689, 0.09554,
+0.085080000000000003, 0.053429999999999998, 0.04301, 0.038550000000000001,
+0.02809, 0.024879999999999999, 0.02469, 0.019609999999999999,
+0.00992, 0.0092499999999999995, 0.0085400000000000007, 0.0078499999999999993,
+0.00745, 0.0065700000000000003, 0.0061700000000000001, 0.0053099999999999996,
+0.0048500000000000001, 0.0044799999999999996, 0.0044400000000000004, 0.0038999999999999998,
+0.0034099999999999998, 0.00299, 0.0028, 0.0027899999999999999,
+0.0022300000000000002, 0.0021900000000000001, 0.0021800000000000001, 0.0021800000000000001,
+0.00181, 0.0017700000000000001, 0.0017600000000000001, 0.0016000000000000001,
+0.0015299999999999999, 0.0015, 0.00149, 0.00115,
+0.00108, 0.00096000000000000002, 0.00088000000000000003, 0.00084000000000000003,
+0.00084000000000000003, 0.00081999999999999998, 0.00080000000000000004, 0.00077999999999999999,
+0.00076999999999999996, 0.00075000000000000002, 0.00075000000000000002, 0.00075000000000000002,
+0.00071000000000000002, 0.00068999999999999997, 0.00064000000000000005, 0.00063000000000000003,
+0.00063000000000000003, 0.00059000000000000003, 0.00059000000000000003, 0.00055999999999999995,
+0.00055999999999999995, 0.00052999999999999998, 0.00050000000000000001, 0.00046999999999999999,
+0.00046999999999999999, 0.00046999999999999999, 0.00046000000000000001, 0.00044000000000000002,
+0.00044000000000000002, 0.00042000000000000002, 0.00042000000000000002, 0.00040000000000000002,
+0.00040000000000000002, 0.00036999999999999999, 0.00036000000000000002, 0.00034000000000000002,
+0.00032000000000000003, 0.00032000000000000003, 0.00031, 0.00029,
+0.00027999999999999998, 0.00027999999999999998, 0.00027999999999999998, 0.00027999999999999998,
+0.00027, 0.00027, 0.00025999999999999998, 0.00025000000000000001,
+0.00025000000000000001, 0.00025000000000000001, 0.00024000000000000001, 0.00022000000000000001,
+0.00021000000000000001, 0.00020000000000000001, 0.00019000000000000001, 0.00018000000000000001,
+0.00018000000000000001, 0.00018000000000000001, 0.00018000000000000001, 0.00017000000000000001,
+0.00017000000000000001, 0.00017000000000000001, 0.00017000000000000001, 0.00016000000000000001,
+0.00016000000000000001, 0.00014999999999999999, 0.00013999999999999999, 0.00013999999999999999,
+0.00012999999999999999, 0.00012999999999999999, 0.00012, 0.00012,
+0.00012, 0.00012, 0.00012, 0.00012,
+0.00012, 0.00011, 0.00011, 0.0001,
+0.0001, 0.0001, 0.0001, 0.0001,
+9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05, 8.0000000000000007e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05,
+6.9999999999999994e-05, 6.9999999999999994e-05, 6.9999999999999994e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05, 6.0000000000000002e-05,
+6.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+1.0038519500641348e-05, -1.0114755482414392e-05, 1.7163358424126539e-06, -1.6007880645881245e-06,
+9.0580493783123577e-07, 4.0098765032234526e-07, 2.6336029415663831e-18, -1.8839083945735127e-07,
+-4.9026298678053468e-09, 5.471397764983279e-07, -5.5157989411788005e-07, -3.6022985596919388e-18,
+1.8179349488087444e-07, -1.7435839226469499e-07, 1.1775038331264746e-07, 9.590584239597371e-08,
+1.196248669283775e-07, -1.1008140657676344e-07, 4.9535934827020556e-08, 3.2514372517362227e-19,
+-5.2482050605817633e-08, 2.7432088300900709e-19, -8.1561476823213729e-19, -3.4033920413562917e-08,
+7.0228558435201476e-08, -4.5923103276154039e-08, -1.0555751313563951e-07, -5.6485835907838363e-08,
+1.365481181049299e-19, -4.0229647351990554e-19, -5.440889409610062e-08, 1.5980234631943082e-08,
+4.4226643240446473e-08, 9.2676983238378664e-08, 2.3959879971260578e-08, -8.0983277295228033e-09,
+3.3646457316818393e-08, -3.3510321635351155e-08, -2.054427062432695e-08, -1.8465583485218609e-08,
+6.9743356904812733e-09, 1.6252505993932096e-08, 5.3884459162483541e-20, 1.6273449944606134e-08,
+1.3634512116020574e-08, 5.0210518765041483e-20, -1.5777776436992171e-08, 8.7126836254422493e-09,
+4.7148901767173099e-20, -1.2566370613785781e-08, -8.9011791849729264e-09, 1.3744467858937079e-08,
+-1.3042488410919312e-19, -1.3126621303532773e-08, 3.9188697572715303e-20, 1.5063936772662198e-08,
+4.6181412009743773e-09, 5.9725167001484249e-09, 6.3844144036530629e-09, 7.5258597341846192e-09,
+3.4290110376125887e-20, -9.7359420532214576e-20, 3.0616169978683829e-20, -8.6337599339888396e-20,
+-1.3042845498363566e-08, -8.6337599339888396e-20, -2.2479840765338935e-09, 3.609340893205568e-09,
+3.3789574318202436e-09, 2.5717582782094418e-20, 1.231504320042937e-08, -6.0039326266357645e-09,
+4.9567350755225818e-09, -6.79678973526781e-20, 5.8433623354373888e-09, 7.1802845421131796e-09,
+-5.3058009258182027e-09, 1.9594348786357652e-20, -5.6269415081173666e-09, 3.5936329297538717e-09,
+2.3457225144262809e-09, -3.2742376766640646e-09, -5.9131755053039659e-09, -5.1435165564188824e-20,
+-3.7227872943411252e-09, -6.3146012331512053e-09, 1.5920408388915591e-20, -0.00025000000000000001,
+-1.0471975512110248e-09, 3.6651914290701495e-09, -3.3510321636861404e-09, 5.1452306345879574e-09,
+1.2858791391047209e-20, 2.7227136330977929e-09, -3.4902433775699566e-20, 2.2619467104829602e-09,
+-3.3615041391167112e-09, 4.0212385963000311e-09, 3.7699111840372098e-09, 1.0409497792752504e-20,
+-3.1228493378257508e-20, -3.1228493378257508e-20, -2.3439771853258936e-09, -2.2340214424055885e-10,
+-2.904227875157351e-09, -1.6755160819008002e-09, 2.6633724383186365e-09, 3.0054569717484849e-09,
+-1.9739673839330799e-09, 2.3823744288824269e-09, 7.347880794884119e-21, -2.1572269553446218e-09,
+-1.5079644736700024e-09, -1.4032447185703136e-09, -1.4660765716196023e-09, -2.2043642384652357e-20,
+7.347880794884119e-21, -4.358087141070891e-09, 1.7854718247169797e-09, -1.6580627893181883e-09,
+-2.8274333878588021e-09, -2.2340214423567438e-09, 2.1991148573083919e-09, -1.8675022995092841e-09,
+5.51091059616309e-21, -1.6532731788489267e-20, 5.51091059616309e-21, 5.51091059616309e-21,
+4.8985871965894129e-21, -9.3549647904687572e-10, -1.284562329406512e-09, 3.9235001569193993e-09,
+8.4299402871808529e-10, -1.429424657289523e-09, -1.3683381334735318e-09, 5.0090949529631699e-10,
+1.3683381334649593e-09, 1.4049900477702254e-09, 1.1728612573091865e-09, 3.6739403974420595e-21,
+-6.178465551963172e-10, 1.3508848409307916e-09, 1.2042771838030505e-09, -1.1021821192326178e-20,
+-4.9218284909553014e-10, 4.0840704491532851e-10, -2.5132741229064597e-10, 4.3982297152136923e-10,
+3.6739403974420595e-21, -9.1848509936051495e-21, -9.1848509936051495e-21, -9.1848509936051495e-21,
+2.3561944900823034e-10, -6.2831853069583439e-10, -5.6723200688311508e-10, -5.0000000000000002e-05,
+-2.6179938779753984e-10, 6.2831853068971118e-10, -6.2831853069583439e-10, 7.4176493206314879e-10,
+-2.8797932658065433e-10, -9.1848509936051495e-21, -9.1848509936051495e-21, 3.0616169978683832e-21,
+3.0616169978683832e-21, -7.347880794884119e-21, -7.347880794884119e-21, -7.347880794884119e-21,
+-7.347880794884119e-21, 2.4492935982947065e-21, -2.024581932380701e-10, -1.040216234069677e-09,
+3.6302848441681938e-10, -5.0265482455666749e-10, 1.9547687614324846e-09, 1.0332349170581873e-09,
+2.4492935982947065e-21, -7.347880794884119e-21, 2.4492935982947065e-21, 2.4492935982947065e-21,
+-3.0000000000000001e-05, 1.8369701987210297e-21, -5.5109105961630892e-21, 1.8369701987210297e-21,
+-5.5109105961630892e-21, -5.5109105961630892e-21, 1.8369701987210297e-21, -3.6651914290490056e-10,
+4.9218284903579261e-10, 2.460914245367433e-10, -3.8746309393005481e-10, 4.6076692251286658e-10,
+-4.9218284903946653e-10, 3.7699111841382667e-10, -6.3355451842542502e-10, -4.1887902059113998e-11,
+3.8222710616344826e-10, -5.5109105961630892e-21, 6.6497044494128222e-10, -6.6497044495827882e-10,
+-7.6969020004234732e-10, -6.2831853066988097e-10, -9.424777959229419e-10, 4.9218284903579261e-10,
+3.0892327758782329e-10, -4.9218284903946653e-10, 3.6651914291454926e-10, 3.0000000000000001e-05,
+1.8369701987210297e-21, -3.6739403974420595e-21, 1.2246467991473532e-21, -3.6739403974420595e-21,
+-3.6739403974420595e-21, -3.6739403974420595e-21, -3.2812189935964437e-10, -2.5132741227833374e-10,
+8.3775804103314472e-11, -2.5132741227833374e-10, 1.0471975510324398e-10, 3.1764992384071481e-10,
+1.745329251908684e-10, 4.7822021500514915e-10, 4.4331362996085485e-10, 1.2246467991473532e-21,
+-3.6739403974420595e-21, -4.4331362997218593e-10, -2.7925268030717837e-10, -2.5132741227833374e-10,
+-1.7802358370209105e-10, -3.141592653480133e-10, -3.6739403974420595e-21, 4.2586033744707644e-10,
+3.3161255785674746e-10, -2.5132741227833374e-10, 3.2812189935719509e-10, 1.2246467991473532e-21,
+-3.6739403974420595e-21,
+};
+
+static const double ELP_ALIGNED s[] = {
+-0.45647999988962068, 0.45275999988701709, -0.10688999998622037, 0.095539999986589269,
+-0.085079999995178165, -0.053429999998495306, 0.04301, 0.038549999999539675,
+0.028089999999999574, -0.024879999993983881, 0.024689999993838793, -0.019609999999999999,
+-0.00991999999833423, 0.0092499999983567099, -0.008539999999188223, -0.0078499999994141433,
+-0.0074499999990395903, 0.006569999999077784, -0.0061699999998011497, 0.0053099999999999996,
+0.004849999999716045, 0.0044799999999999996, -0.0044400000000000004, 0.0038999999998514988,
+-0.0034099999992768253, 0.002989999999647336, 0.0027999999980102878, 0.0027899999994281991,
+0.0022300000000000002, -0.0021900000000000001, 0.0021799999993210258, -0.0021799999999414293,
+-0.0018099999994596696, -0.0017699999975737224, -0.0017599999998369103, 0.0015999999999795054,
+-0.0015299999996300378, 0.0014999999996256862, 0.0014899999998583668, 0.0011499999998517488,
+-0.0010799999999774809, -0.00095999999986242507, 0.00088000000000000003, -0.00083999999984236604,
+-0.00083999999988934528, 0.00081999999999999998, 0.00079999999984441367, -0.00077999999995133915,
+0.00076999999999999996, 0.0007499999998947242, 0.00074999999994717931, -0.00074999999987405974,
+-0.00071000000000000002, 0.00068999999987513891, 0.00064000000000000005, -0.00062999999981990309,
+-0.00062999999998307368, -0.00058999999996977041, -0.00058999999996545702, -0.00055999999994942983,
+0.00055999999999999995, -0.00052999999999999998, 0.00050000000000000001, -0.00046999999999999999,
+0.00046999999981902572, -0.00046999999999999999, 0.00045999999999450717, -0.00043999999998519621,
+-0.00043999999998702575, 0.00042000000000000002, -0.00041999999981945206, 0.00039999999995494101,
+-0.00039999999996928847, -0.00036999999999999999, -0.00035999999995257653, -0.00033999999992418166,
+0.00031999999995601329, 0.00032000000000000003, 0.00030999999994893148, -0.00028999999997773412,
+-0.00027999999999017423, 0.000279999999980856, 0.00027999999993756131, -0.00027999999999999998,
+0.00026999999997433493, 0.0002699999999261589, 0.00025999999999999998, 3.0616169978683829e-20,
+0.00024999999999780677, -0.00024999999997313277, 0.00023999999997660539, -0.00021999999993983318,
+0.00021000000000000001, -0.00019999999998146709, -0.00019000000000000001, -0.00017999999998578777,
+0.00017999999996861192, -0.00017999999995508233, -0.00017999999996052158, 0.00017000000000000001,
+-0.00017000000000000001, -0.00017000000000000001, 0.00016999999998384052, 0.00015999999999984405,
+0.00015999999997364208, 0.00014999999999064213, -0.00013999999997466587, -0.00013999999996774009,
+0.00012999999998501328, -0.00012999999997817034, 0.00012, 0.00011999999998060989,
+0.00011999999999052519, 0.00011999999999179544, 0.00011999999999104425, -0.00012,
+0.00012, 0.00010999999991366854, -0.00010999999998550951, 9.9999999986254151e-05,
+9.9999999960028113e-05, 9.999999997504575e-05, -9.9999999975819464e-05, 9.9999999982562171e-05,
+9.0000000000000006e-05, -9.0000000000000006e-05, 9.0000000000000006e-05, 9.0000000000000006e-05,
+8.0000000000000007e-05, 7.9999999994530288e-05, 7.9999999989686872e-05, -7.9999999903788421e-05,
+-6.9999999994924003e-05, 6.9999999985405318e-05, 6.9999999986626075e-05, -6.9999999998207781e-05,
+-6.9999999986626075e-05, -6.9999999985900012e-05, -6.9999999990174249e-05, 6.0000000000000002e-05,
+5.9999999996818878e-05, -5.9999999984792589e-05, -5.9999999987914305e-05, -6.0000000000000002e-05,
+-5.9999999997981305e-05, -5.9999999998610034e-05, 5.9999999999473621e-05, -5.9999999998387962e-05,
+6.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, -5.0000000000000002e-05,
+-4.9999999999444837e-05, 4.9999999996052158e-05, 4.9999999996782483e-05, 6.1232339957367663e-21,
+4.999999999931461e-05, -4.9999999996052158e-05, 4.9999999996052158e-05, -4.9999999994497846e-05,
+4.9999999999170683e-05, -5.0000000000000002e-05, -5.0000000000000002e-05, 5.0000000000000002e-05,
+5.0000000000000002e-05, -4.0000000000000003e-05, -4.0000000000000003e-05, -4.0000000000000003e-05,
+-4.0000000000000003e-05, 4.0000000000000003e-05, 3.9999999999487636e-05, 3.9999999986474385e-05,
+-3.9999999998352633e-05, 3.9999999996841729e-05, -3.9999999952235992e-05, -3.9999999986655324e-05,
+4.0000000000000003e-05, -4.0000000000000003e-05, 4.0000000000000003e-05, 4.0000000000000003e-05,
+3.6739403974420595e-21, 3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05,
+-3.0000000000000001e-05, -3.0000000000000001e-05, 3.0000000000000001e-05, 2.9999999997761062e-05,
+-2.9999999995962601e-05, -2.9999999998990653e-05, 2.9999999997497872e-05, -2.9999999996461565e-05,
+2.9999999995962601e-05, -2.9999999997631297e-05, 2.9999999993310145e-05, -2.9999999999970758e-05,
+-2.9999999997565042e-05, -3.0000000000000001e-05, -2.9999999992630238e-05, 2.9999999992630238e-05,
+2.9999999990126287e-05, 2.9999999993420262e-05, 2.9999999985195593e-05, -2.9999999995962601e-05,
+-2.9999999998409439e-05, 2.9999999995962601e-05, -2.9999999997761062e-05, 0,
+3.0000000000000001e-05, -2.0000000000000002e-05, 2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, 1.9999999997308402e-05, 1.9999999998420865e-05,
+-1.999999999982454e-05, 1.9999999998420865e-05, -1.9999999999725844e-05, -1.9999999997477463e-05,
+-1.9999999999238458e-05, -1.9999999994282638e-05, -1.9999999995086828e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05, 1.9999999995086828e-05, 1.999999999805045e-05, 1.9999999998420865e-05,
+1.999999999920769e-05, 1.9999999997532601e-05, -2.0000000000000002e-05, -1.9999999995466075e-05,
+-1.9999999997250831e-05, 1.9999999998420865e-05, -1.9999999997308402e-05, 2.0000000000000002e-05,
+-2.0000000000000002e-05,
+};
+
+const struct elp_table elp6 = {
+    arg, max_arg, amp, c, s, 237
 };
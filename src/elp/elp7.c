@@ -1,17 +1,36 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp7[] = {
-{1.000000, {-2.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000030, 0.040000},
-{1.000000, {-2.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000020, 0.487000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000020, 0.087000},
-{1.000000, {0.000000, 0.000000, -2.000000, -1.000000}, 180.000000, 0.000010, 0.038000},
-{1.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 180.000000, 0.000210, 0.075000},
-{1.000000, {0.000000, 0.000000, -1.000000, 1.000000}, 180.000000, 0.000020, 0.074000},
-{1.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.003000, 18.613000},
-{1.000000, {0.000000, 0.000000, 0.000000, 1.000000}, 180.000000, 0.000150, 0.037000},
-{1.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 180.000000, 0.000210, 0.076000},
-{1.000000, {0.000000, 0.000000, 1.000000, 1.000000}, 180.000000, 0.000020, 0.025000},
-{1.000000, {0.000000, 0.000000, 2.000000, -1.000000}, 180.000000, 0.000020, 0.038000},
-{1.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 180.000000, 0.000030, 0.088000},
-{1.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000040, 0.041000},
-{2.000000, {0.000000, 0.000000, 0.000000, -2.000000}, 0.000000, 0.000040, 9.307000},
+
+static const uint16_t arg[] = {
+1, 3, 2, 6, 9, 21, 13, 14, 17, 16,
+15, 20, 22, 23,
+};
+
+static const uint16_t max_arg[] = {
+1, 3, 3, 6, 9, 21, 21, 21, 21, 21,
+21, 21, 22, 23,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0030000000000000001, 0.00021000000000000001, 0.00021000000000000001, 0.00014999999999999999,
+4.0000000000000003e-05, 4.0000000000000003e-05, 3.0000000000000001e-05, 3.0000000000000001e-05,
+2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-0.0030000000000000001, -0.00021000000000000001, -0.00021000000000000001, -0.00014999999999999999,
+-4.0000000000000003e-05, 4.0000000000000003e-05, -3.0000000000000001e-05, -3.0000000000000001e-05,
+-2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05, -2.0000000000000002e-05,
+-2.0000000000000002e-05, -1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+3.6739403974420597e-19, 2.5717582782094418e-20, 2.5717582782094418e-20, 1.8369701987210296e-20,
+4.8985871965894129e-21, 0, 3.6739403974420595e-21, 3.6739403974420595e-21,
+2.4492935982947065e-21, 2.4492935982947065e-21, 2.4492935982947065e-21, 2.4492935982947065e-21,
+2.4492935982947065e-21, 1.2246467991473532e-21,
+};
+
+const struct elp_table elp7 = {
+    arg, max_arg, amp, c, s, 14
 };
@@ -1,14 +1,33 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp8[] = {
-{1.000000, {-2.000000, 0.000000, 0.000000, 0.000000}, 180.000000, 0.000120, 0.088000},
-{1.000000, {-2.000000, 0.000000, 1.000000, 0.000000}, 180.000000, 0.000030, 0.530000},
-{1.000000, {0.000000, 0.000000, -1.000000, -2.000000}, 180.000000, 0.000010, 0.037000},
-{1.000000, {0.000000, 0.000000, -1.000000, 0.000000}, 180.000000, 0.000190, 8.847000},
-{1.000000, {0.000000, 0.000000, 0.000000, -2.000000}, 180.000000, 0.000140, 0.074000},
-{1.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.003420, 0.075000},
-{1.000000, {0.000000, 0.000000, 1.000000, 0.000000}, 0.000000, 0.000180, 0.038000},
-{1.000000, {0.000000, 0.000000, 2.000000, 0.000000}, 0.000000, 0.000010, 0.025000},
-{1.000000, {2.000000, 0.000000, -1.000000, 0.000000}, 0.000000, 0.000040, 0.040000},
-{1.000000, {2.000000, 0.000000, 0.000000, 0.000000}, 0.000000, 0.000020, 0.026000},
-{2.000000, {0.000000, 0.000000, 0.000000, -1.000000}, 180.000000, 0.000090, 0.075000},
+
+static const uint16_t arg[] = {
+0, 4, 5, 7, 8, 11, 10, 12, 18, 19,
+24,
+};
+
+static const uint16_t max_arg[] = {
+0, 4, 5, 7, 8, 11, 11, 12, 18, 19,
+24,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.0034199999999999999, 0.00019000000000000001, 0.00018000000000000001, 0.00013999999999999999,
+0.00012, 9.0000000000000006e-05, 4.0000000000000003e-05, 3.0000000000000001e-05,
+2.0000000000000002e-05, 1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+0.0034199999999999999, -0.00019000000000000001, 0.00018000000000000001, -0.00013999999999999999,
+-0.00012, -9.0000000000000006e-05, 4.0000000000000003e-05, -3.0000000000000001e-05,
+2.0000000000000002e-05, -1.0000000000000001e-05, 1.0000000000000001e-05,
+};
+
+static const double ELP_ALIGNED s[] = {
+0, 2.3268289183799713e-20, 0, 1.7145055188062943e-20,
+1.4695761589768238e-20, 1.102182119232618e-20, 0, 3.6739403974420595e-21,
+0, 1.2246467991473532e-21, 0,
+};
+
+const struct elp_table elp8 = {
+    arg, max_arg, amp, c, s, 11
 };
@@ -1,11 +1,28 @@
 #include "lunar-priv.h"
-const struct earth_pert  elp9[] = {
-{0.000000, {0.000000, 0.000000, 0.000000, 0.000000}, 270.000000, 0.000040, 99999.999000},
-{1.000000, {-2.000000, 0.000000, 0.000000, -1.000000}, 270.000000, 0.000040, 0.040000},
-{1.000000, {-2.000000, 0.000000, 1.000000, -1.000000}, 270.000000, 0.000020, 0.087000},
-{1.000000, {0.000000, 0.000000, -1.000000, -1.000000}, 270.000000, 0.000190, 0.075000},
-{1.000000, {0.000000, 0.000000, -1.000000, 1.000000}, 90.000000, 0.000030, 0.074000},
-{1.000000, {0.000000, 0.000000, 1.000000, -1.000000}, 90.000000, 0.000190, 0.076000},
-{1.000000, {2.000000, 0.000000, -1.000000, -1.000000}, 90.000000, 0.000020, 0.088000},
-{1.000000, {2.000000, 0.000000, 0.000000, -1.000000}, 90.000000, 0.000040, 0.041000},
+
+static const uint16_t arg[] = {
+3, 2, 25, 13, 9, 15, 16, 14,
+};
+
+static const uint16_t max_arg[] = {
+3, 3, 25, 25, 25, 25, 25, 25,
+};
+
+static const double ELP_ALIGNED amp[] = {
+0.00019000000000000001, 0.00019000000000000001, 4.0000000000000003e-05, 4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, 2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+static const double ELP_ALIGNED c[] = {
+-3.4902433775699566e-20, 1.1634144591899856e-20, -7.347880794884119e-21, -7.347880794884119e-21,
+2.4492935982947065e-21, 1.8369701987210297e-21, -3.6739403974420595e-21, 1.2246467991473532e-21,
+};
+
+static const double ELP_ALIGNED s[] = {
+-0.00019000000000000001, 0.00019000000000000001, -4.0000000000000003e-05, -4.0000000000000003e-05,
+4.0000000000000003e-05, 3.0000000000000001e-05, -2.0000000000000002e-05, 2.0000000000000002e-05,
+};
+
+const struct elp_table elp9 = {
+    arg, max_arg, amp, c, s, 8
 };
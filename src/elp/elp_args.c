@@ -0,0 +1,24132 @@
+#include "lunar-priv.h"
+
+static const int8_t main_arg[][4] = {
+{0, 0, 0, 0},
+{0, 0, 1, 0},
+{0, 0, 0, 1},
+{2, 0, -1, 0},
+{2, 0, 0, 0},
+{0, 0, 1, 1},
+{0, 0, 1, -1},
+{0, 0, 2, 0},
+{0, 1, 0, 0},
+{2, 0, 0, -1},
+{0, 0, 0, 2},
+{2, 0, -2, 0},
+{2, -1, -1, 0},
+{2, 0, -1, 1},
+{2, 0, 1, 0},
+{2, 0, -1, -1},
+{2, -1, 0, 0},
+{0, 1, -1, 0},
+{1, 0, 0, 0},
+{2, 0, 0, 1},
+{0, 1, 1, 0},
+{0, 0, 2, 1},
+{2, 0, 0, -2},
+{0, 0, 1, 2},
+{0, 0, 1, -2},
+{4, 0, -1, 0},
+{0, 0, 3, 0},
+{2, 0, 1, -1},
+{0, 0, 2, -1},
+{4, 0, -2, 0},
+{2, -1, 0, -1},
+{2, 1, -1, 0},
+{2, 1, 0, 0},
+{1, 0, -1, 0},
+{1, 1, 0, 0},
+{2, 0, -2, -1},
+{2, 0, 1, 1},
+{2, -1, 1, 0},
+{2, 0, 2, 0},
+{4, 0, 0, 0},
+{2, 0, -3, 0},
+{2, 1, 0, -1},
+{0, 1, -2, 0},
+{2, 0, -1, 2},
+{2, -1, -1, 1},
+{2, -1, -2, 0},
+{1, 0, 1, 0},
+{2, -2, 0, 0},
+{2, -1, 0, 1},
+{0, 1, 2, 0},
+{0, 2, 0, 0},
+{2, -1, -1, -1},
+{2, -2, -1, 0},
+{0, 1, -1, -1},
+{4, 0, -1, -1},
+{0, 1, 0, 1},
+{2, 0, 1, -2},
+{0, 0, 0, 3},
+{2, 0, 0, 2},
+{0, 1, -1, 1},
+{1, 0, 0, 1},
+{0, 1, 1, 1},
+{0, 1, 1, -1},
+{0, 1, 0, -1},
+{1, 0, 0, -1},
+{2, 0, -1, -2},
+{4, -1, -1, 0},
+{0, 0, 2, 2},
+{0, 0, 3, 1},
+{4, 0, 0, -1},
+{3, 0, -1, 0},
+{4, 0, -1, 1},
+{2, 1, 1, 0},
+{0, 0, 1, -3},
+{4, -1, -2, 0},
+{0, 2, -1, 0},
+{2, 2, -1, 0},
+{2, 1, -2, 0},
+{4, 0, -2, 1},
+{0, 0, 2, -2},
+{2, 0, 0, -3},
+{2, 0, 2, -1},
+{2, -1, 0, -2},
+{4, 0, 1, 0},
+{0, 0, 4, 0},
+{4, -1, 0, 0},
+{2, -1, 1, -1},
+{1, 0, -2, 0},
+{2, 0, -2, 1},
+{0, 0, 3, -1},
+{2, 0, 2, 1},
+{2, 0, -3, -1},
+{2, 1, 0, -2},
+{2, 1, -1, 1},
+{2, 1, 0, 1},
+{1, 1, 1, 0},
+{3, 0, -2, 0},
+{4, 0, 0, 1},
+{4, 0, -3, 0},
+{2, -1, 2, 0},
+{0, 2, 1, 0},
+{2, -1, 1, 1},
+{2, -2, 0, -1},
+{1, 1, -1, 0},
+{2, 0, 3, 0},
+{0, 0, 1, 3},
+{2, 0, 1, 2},
+{2, 0, -4, 0},
+{2, 1, 1, -1},
+{1, 1, 0, -1},
+{1, 1, 0, 1},
+{0, 1, -2, -1},
+{2, 1, -1, -1},
+{3, 0, 0, 0},
+{2, -2, 1, 0},
+{0, 1, -3, 0},
+{1, 0, 1, 1},
+{2, -1, -2, -1},
+{0, 1, 2, 1},
+{4, 1, -1, 0},
+{4, 0, -2, -1},
+{4, -1, -1, -1},
+{1, 0, 1, -1},
+{1, 0, 2, 0},
+{1, 0, 0, -2},
+{6, 0, -2, 0},
+{2, 0, -2, -2},
+{1, -1, 0, 0},
+{0, 1, 3, 0},
+{2, 0, -2, 2},
+{2, -1, -3, 0},
+{4, 0, 1, -1},
+{2, 0, 2, -2},
+{1, 0, -1, -1},
+{2, -1, -1, 2},
+{0, 0, 0, 4},
+{4, -1, 0, -1},
+{0, 1, 0, 2},
+{6, 0, -1, 0},
+{2, -2, 0, 1},
+{2, -1, 0, 2},
+{2, -1, 1, -2},
+{4, 1, -2, 0},
+{3, 0, 0, -1},
+{1, 1, -2, 0},
+{2, -3, 0, 0},
+{4, -1, -1, 1},
+{2, 0, -1, -3},
+{0, 0, 3, 2},
+{2, -2, -1, 1},
+{0, 1, 2, -1},
+{4, -2, -1, 0},
+{3, 0, -1, -1},
+{0, 1, -1, -2},
+{0, 1, -2, 1},
+{4, 0, -1, -2},
+{2, -2, -2, 0},
+{6, 0, -3, 0},
+{2, 0, 1, -3},
+{2, 1, 2, 0},
+{4, 1, 0, 0},
+{4, -1, 1, 0},
+{3, 1, -1, 0},
+{4, 0, 0, -2},
+{2, -2, -1, -1},
+{0, 1, 1, 2},
+{0, 0, 4, 1},
+{1, 0, 0, 2},
+{2, 0, -3, 1},
+{3, 0, 0, -2},
+{2, 2, -2, 0},
+{2, -3, -1, 0},
+{2, 0, -1, 3},
+{2, 1, 1, 1},
+{3, -1, -1, 0},
+{4, 0, 2, 0},
+{4, -1, -2, 1},
+{4, 0, 1, 1},
+{3, 0, -1, 1},
+{4, 0, -1, 2},
+{0, 2, -2, 0},
+{2, 2, 0, 0},
+{0, 1, -1, 2},
+{2, 1, -3, 0},
+{2, -1, -1, -2},
+{4, 1, -1, -1},
+{4, 0, -2, 2},
+{4, -1, 0, 1},
+{4, -2, -2, 0},
+{4, -2, 0, 0},
+{3, 1, 0, 0},
+{2, 0, 3, -1},
+{2, 0, 0, 3},
+{1, 0, -1, 1},
+{2, 0, 3, 1},
+{1, -1, -1, 0},
+{2, 2, 0, -1},
+{2, 0, -4, -1},
+{0, 1, 1, -2},
+{0, 0, 2, -3},
+{2, -1, 2, -1},
+{1, 0, -3, 0},
+{6, 0, 0, 0},
+{2, -1, 2, 1},
+{2, 0, 2, 2},
+{1, -1, 1, 0},
+{0, 0, 2, 3},
+{0, 2, -1, -1},
+{2, 2, -1, 1},
+{4, 1, 0, -1},
+{0, 0, 5, 0},
+{1, 0, -2, -1},
+{2, 2, -1, -1},
+{1, 1, 1, 1},
+{0, 3, 0, 0},
+{4, -1, -3, 0},
+{0, 1, 0, -2},
+{0, 2, -1, 1},
+{6, 0, -1, -1},
+{2, -1, 3, 0},
+{1, 1, 2, 0},
+{0, 0, 4, -1},
+{2, 0, -3, -2},
+{0, 0, 1, 4},
+{6, -1, -2, 0},
+{2, -1, 0, -3},
+{4, 0, 0, 2},
+{2, 1, 1, -2},
+{3, -1, 0, 0},
+{3, -1, -2, 0},
+{6, 0, -2, -1},
+{0, 0, 1, -4},
+{2, 1, -2, -1},
+{1, 0, -2, 1},
+{2, 0, 4, 0},
+{2, 0, 0, -4},
+{0, 1, -3, -1},
+{2, -1, 1, 2},
+{6, -1, -1, 0},
+{2, -2, 1, -1},
+{2, 0, -5, 0},
+{2, 1, -1, 2},
+{4, 0, 1, -2},
+{2, 0, -2, 3},
+{2, 1, 0, 2},
+{0, 2, 2, 0},
+{2, -2, 2, 0},
+{1, 0, 2, 1},
+{2, -2, 0, -2},
+{2, 1, 2, -1},
+{4, 0, 0, -3},
+{2, -1, -2, 1},
+{0, 2, 1, -1},
+{0, 1, 3, 1},
+{6, 0, -2, 1},
+{2, -2, 1, 1},
+{0, 2, 0, 1},
+{5, 0, -2, 0},
+{4, -1, 1, -1},
+{0, 0, 3, -2},
+{1, 1, -1, 1},
+{0, 2, 1, 1},
+{2, -1, -3, -1},
+{2, 1, 0, -3},
+{2, 1, -2, 1},
+{4, -1, -2, -1},
+{0, 1, -2, -2},
+{0, 3, -1, 0},
+{4, 1, -1, 1},
+{4, 1, 1, 0},
+{3, 0, -2, 1},
+{4, 0, 2, -1},
+{0, 1, -4, 0},
+{1, 0, 1, 2},
+{3, 0, -3, 0},
+{0, 1, 2, 2},
+{1, -2, 0, 0},
+{4, 0, -2, -2},
+{6, 0, -1, 1},
+{3, 1, -2, 0},
+{1, 0, 3, 0},
+{1, 0, 1, -2},
+{1, 2, 0, 0},
+{0, 1, 4, 0},
+{3, 0, -2, -1},
+{6, -1, -3, 0},
+{6, 0, 0, -1},
+{2, -3, 0, -1},
+{1, 0, 2, -1},
+{3, 0, 1, -1},
+{1, 1, 0, 2},
+{4, 2, -2, 0},
+{3, 0, 1, 0},
+{1, 1, 1, -1},
+{4, -2, -1, -1},
+{3, 1, 0, -1},
+{2, 0, 3, -2},
+{2, -3, 1, 0},
+{4, -1, 2, 0},
+{1, 0, 0, -3},
+{2, 1, 2, 1},
+{6, 0, -3, 1},
+{4, -1, 0, -2},
+{2, 0, 1, 3},
+{4, -1, 1, 1},
+{3, 0, -1, -2},
+{4, 1, -2, 1},
+{2, -1, -4, 0},
+{4, -2, 0, -1},
+{2, -1, 2, -2},
+{3, 0, 0, 1},
+{4, 0, 2, 1},
+{2, -1, -2, -2},
+{0, 1, -2, 2},
+{4, 1, -3, 0},
+{0, 1, 2, -2},
+{2, 1, 3, 0},
+{0, 0, 4, 2},
+{3, -1, 0, -1},
+{4, 1, 0, 1},
+{2, 1, -1, -2},
+{6, -1, 0, 0},
+{2, 0, -4, 1},
+{0, 1, 3, -1},
+{4, -2, 1, 0},
+{4, -2, -1, 1},
+{1, 0, -1, -2},
+{0, 1, -3, 1},
+{2, 2, 0, -2},
+{1, 1, -3, 0},
+{4, -1, -1, -2},
+{6, 0, 1, 0},
+{2, -2, -2, -1},
+{4, -1, -1, 2},
+{3, 1, 1, 0},
+{4, 0, -3, 1},
+{4, 2, -1, 0},
+{2, -1, -2, 2},
+{4, 0, 3, 0},
+{3, -1, -1, -1},
+{3, 1, -1, 1},
+{2, 0, -2, -3},
+{1, -1, 1, -1},
+{2, 0, -1, 4},
+{3, -1, 0, -2},
+{4, 1, -1, -2},
+{1, -1, 0, 1},
+{2, 1, -4, 0},
+{2, 1, -3, -1},
+{2, -2, 0, 2},
+{1, 1, 0, -2},
+{0, 2, 0, -1},
+{0, 3, 1, 0},
+{4, 0, 1, 2},
+{0, 0, 5, 1},
+{4, -3, -1, 0},
+{4, 1, 1, -1},
+{5, 0, -3, 0},
+{1, 1, -2, 1},
+{2, -1, 1, -3},
+{2, -2, 1, -2},
+{2, 1, 1, 2},
+{2, -3, 0, 1},
+{1, 0, -1, 2},
+{1, 1, -2, -1},
+{4, 0, -4, 0},
+{0, 2, -2, -1},
+{2, -2, -3, 0},
+{2, -2, -1, 2},
+{4, -1, -2, 2},
+{0, 2, -3, 0},
+{6, -1, -1, -1},
+{1, -1, 2, 0},
+{2, 2, 0, 1},
+{6, 0, 0, 1},
+{6, 0, -4, 0},
+{2, 0, 0, 4},
+{3, -1, -1, 1},
+{3, 1, 0, 1},
+{5, 0, -1, 0},
+{1, -1, 0, -1},
+{2, 2, 1, 0},
+{2, 0, 3, 2},
+{2, -4, 0, 0},
+{3, 1, -1, -1},
+{0, 0, 2, 4},
+{6, 1, -2, 0},
+{1, -1, 0, -2},
+{4, -2, 0, 1},
+{2, 2, -2, -1},
+{1, 0, -3, -1},
+{4, -2, -2, 1},
+{3, 0, -1, 2},
+{2, -1, 3, 1},
+{2, 0, 4, 1},
+{3, -2, -1, 0},
+{0, 0, 3, 3},
+{2, -1, -1, 3},
+{0, 1, 0, 3},
+{2, 0, -5, -1},
+{4, -1, 0, 2},
+{6, -1, -2, -1},
+{2, 0, -4, -2},
+{2, 0, -3, 2},
+{6, 1, -1, 0},
+{3, 0, 1, -2},
+{4, 1, 0, -2},
+{5, 0, -1, -1},
+{2, -3, -1, 1},
+{2, -1, -1, -3},
+{1, -1, -1, -1},
+{2, 0, 4, -1},
+{1, 1, 2, 1},
+{3, 0, 0, -3},
+{2, -1, 2, 2},
+{2, 0, 1, -4},
+{2, 0, 2, -3},
+{2, -1, 3, -1},
+{4, 0, 2, -2},
+{4, -3, 0, 0},
+{2, -3, -2, 0},
+{1, 0, -4, 0},
+{2, -1, 0, 3},
+{2, 2, -3, 0},
+{6, -1, -2, 1},
+{2, -1, -3, 1},
+{4, 0, -3, 2},
+{2, -3, -1, -1},
+{0, 1, -1, 3},
+{3, 1, 0, -2},
+{2, 1, 2, -2},
+{8, 0, -2, 0},
+{2, 0, -1, -4},
+{1, 2, 1, 0},
+{1, -1, 1, 1},
+{8, 0, -3, 0},
+{6, -2, -2, 0},
+{2, -4, -1, 0},
+{4, 0, -3, -1},
+{6, -1, -1, 1},
+{4, -3, -2, 0},
+{6, -2, -1, 0},
+{4, -1, 1, -2},
+{2, -1, 4, 0},
+{0, 1, 1, -3},
+{6, 0, -3, -1},
+{1, -1, -2, 0},
+{5, -1, -2, 0},
+{4, 0, -4, -1},
+{1, 1, 3, 0},
+{0, 1, -1, -3},
+{2, -2, 2, 1},
+{4, 1, 2, 0},
+{0, 1, 1, 3},
+{0, 0, 6, 0},
+{4, 0, -1, 3},
+{1, 1, 1, 2},
+{3, 0, 1, 1},
+{6, 0, 1, -1},
+{2, 2, -1, -2},
+{6, -1, 0, -1},
+{0, 1, -4, -1},
+{1, 0, 0, 3},
+{1, 1, -1, -1},
+{4, 0, -2, 3},
+{3, 1, -3, 0},
+{0, 1, -3, -2},
+{2, 2, 1, -1},
+{4, -1, 2, -1},
+{0, 0, 0, 5},
+{2, 0, 5, 0},
+{0, 0, 5, -1},
+{3, -2, 0, 0},
+{4, -2, -3, 0},
+{4, 1, 1, 1},
+{2, -2, 2, -1},
+{4, 0, -1, -3},
+{1, 0, 3, 1},
+{4, 0, 1, -3},
+{0, 1, 4, 1},
+{1, 0, 2, 2},
+{2, -2, 3, 0},
+{1, 0, -3, 1},
+{0, 2, -2, 1},
+{4, -1, 0, -3},
+{0, 2, 2, 1},
+{0, 1, 3, 2},
+{5, 0, -2, 1},
+{0, 2, 0, 2},
+{2, 2, -1, 2},
+{2, -2, -1, -2},
+{6, 0, -2, 2},
+{5, 0, -2, -1},
+{2, 2, -2, 1},
+{2, 0, -6, 0},
+{2, 1, 3, -1},
+{6, 1, -3, 0},
+{6, -1, 1, 0},
+{3, -1, 1, 0},
+{5, 1, -1, 0},
+{0, 2, -1, -2},
+{2, 1, 1, -3},
+{8, 0, -1, 0},
+{1, -2, -1, 0},
+{2, 0, 2, 3},
+{4, 0, 3, -1},
+{0, 0, 2, -4},
+{5, 0, 0, 0},
+{4, 2, -1, -1},
+{4, 0, -5, 0},
+{3, 1, 1, -1},
+{4, -1, 2, 1},
+{6, 0, -1, -2},
+{4, -2, 1, -1},
+{2, -1, -4, -1},
+{0, 3, -2, 0},
+{6, -1, -3, 1},
+{3, -2, -2, 0},
+{4, 0, -3, -2},
+{6, 1, 0, 0},
+{5, 1, -2, 0},
+{4, 0, -2, -3},
+{3, 0, 2, 0},
+{2, -2, 1, 2},
+{3, 0, 0, 2},
+{1, 0, -1, -3},
+{4, 2, -3, 0},
+{2, -1, -3, -2},
+{6, 0, -2, -2},
+{1, 2, -2, 0},
+{6, 0, -1, 2},
+{2, 1, 3, 1},
+{0, 2, 0, -2},
+{4, -1, -2, -2},
+{0, 0, 4, -2},
+{4, 1, -1, 2},
+{6, 1, -1, -1},
+{2, 1, -2, -2},
+{2, 0, 1, 4},
+{2, 1, -1, -3},
+{0, 2, 3, 0},
+{4, -1, 3, 0},
+{5, 0, -1, -2},
+{0, 1, -5, 0},
+{3, -1, -2, 1},
+{8, 0, -4, 0},
+{4, 0, 3, 1},
+{3, 0, 2, -1},
+{6, 0, 2, 0},
+{1, 1, 2, -1},
+{6, -2, -3, 0},
+{6, 0, 1, 1},
+{4, 1, 0, -3},
+{1, 1, 1, -2},
+{1, 2, -1, 0},
+{3, 0, -2, 2},
+{3, -1, -3, 0},
+{2, -3, 2, 0},
+{4, -2, 2, 0},
+{1, 0, -2, -2},
+{4, 0, 0, 3},
+{6, -1, 0, 1},
+{3, 0, -3, -1},
+{6, 0, -3, 2},
+{0, 1, 5, 0},
+{2, -1, 0, -4},
+{1, 0, 4, 0},
+{6, -2, 0, 0},
+{0, 2, 2, -1},
+{4, -2, -2, -1},
+{2, 0, -2, 4},
+{3, -1, -2, -1},
+{4, 2, -2, 1},
+{3, -1, 1, -1},
+{4, 0, 2, 2},
+{2, -2, 0, -3},
+{0, 2, 1, 2},
+{2, -1, -2, 3},
+{2, 1, 2, 2},
+{3, 1, -2, 1},
+{3, 1, 1, 1},
+{3, 1, 2, 0},
+{6, 1, -2, -1},
+{2, -3, 1, 1},
+{4, -2, 1, 1},
+{5, 0, 0, -1},
+{1, -3, 0, 0},
+{4, -1, 1, 2},
+{1, 0, 3, -1},
+{2, 0, 4, -2},
+{2, 1, -4, -1},
+{5, 0, -1, 1},
+{1, 0, -2, 2},
+{0, 2, -1, 2},
+{2, -3, 1, -1},
+{2, 1, 4, 0},
+{0, 0, 1, -5},
+{1, 0, -1, 3},
+{2, 0, -3, 3},
+{2, -1, 3, -2},
+{2, 0, -5, 1},
+{2, -1, 1, 3},
+{2, 0, 0, -5},
+{4, 1, -2, 2},
+{4, -2, 0, -2},
+{0, 3, -1, -1},
+{6, 0, 0, -2},
+{1, -2, 0, 1},
+{1, -1, 1, -2},
+{4, 2, 0, 0},
+{1, 2, 0, 1},
+{1, -2, 0, -1},
+{4, 1, -2, -1},
+{0, 0, 5, 2},
+{2, 2, 1, -2},
+{4, 0, 4, 0},
+{2, 1, 0, -4},
+{8, -1, -2, 0},
+{4, 1, 2, -1},
+{4, 1, -3, 1},
+{2, 1, -1, 3},
+{2, -2, -2, 1},
+{0, 1, 4, -1},
+{4, -1, -3, 1},
+{0, 1, -2, 3},
+{3, 2, 0, 0},
+{0, 3, -1, 1},
+{8, 0, -2, -1},
+{5, -1, -3, 0},
+{3, -1, -1, -2},
+{2, 3, -1, 0},
+{0, 1, -4, 1},
+{1, 1, -3, -1},
+{4, 1, 0, 2},
+{4, 1, 1, -2},
+{5, 1, 0, 0},
+{4, 2, -1, 1},
+{2, -1, -5, 0},
+{2, -2, -3, -1},
+{1, 1, -1, 2},
+{2, 1, 0, 3},
+{6, -1, -4, 0},
+{1, -1, 2, -1},
+{3, 0, -4, 0},
+{2, 1, -5, 0},
+{8, -1, -3, 0},
+{1, 2, 0, -1},
+{0, 2, -3, -1},
+{0, 1, 3, -2},
+{4, -3, -1, -1},
+{2, -3, 0, -2},
+{2, 1, -3, 1},
+{4, -3, 0, -1},
+{4, -2, -1, 2},
+{4, -3, 1, 0},
+{0, 0, 1, 5},
+{1, 1, -4, 0},
+{1, -1, 0, 2},
+{5, -1, -1, 0},
+{0, 1, -2, -3},
+{0, 0, 3, 4},
+{6, 1, 0, -1},
+{3, 1, -2, -1},
+{1, -1, 3, 0},
+{0, 0, 3, -3},
+{1, -1, 2, 1},
+{2, 2, 1, 1},
+{1, 0, 1, 3},
+{0, 1, 2, -3},
+{8, 0, 0, 0},
+{3, 1, -1, 2},
+{5, 0, 0, -2},
+{6, 1, -2, 1},
+{1, -1, -2, 1},
+{6, -2, -1, -1},
+{0, 1, 2, 3},
+{4, -3, -1, 1},
+{2, -2, 2, -2},
+{2, -4, 1, 0},
+{6, 0, 0, 2},
+{2, 0, 4, 2},
+{3, -2, 0, -1},
+{8, 0, -1, -1},
+{3, 0, -1, -3},
+{0, 4, 0, 0},
+{0, 2, 1, -2},
+{4, 0, -3, 3},
+{5, -1, -1, -1},
+{3, 2, -1, 0},
+{5, 0, -3, 1},
+{4, -1, -4, 0},
+{1, 0, 0, -4},
+{1, 0, -4, -1},
+{6, -1, 1, -1},
+{4, -1, 2, -2},
+{0, 0, 6, 1},
+{0, 2, -4, 0},
+{2, -4, 0, -1},
+{2, 0, 2, -4},
+{2, -1, 3, 2},
+{4, 0, -5, -1},
+{6, 1, -1, 1},
+{2, 1, -3, -2},
+{3, 1, -1, -2},
+{4, 2, -2, -1},
+{8, -1, -1, 0},
+{8, 0, -2, 1},
+{2, 0, -5, -2},
+{2, -1, 4, 1},
+{2, -2, -2, -2},
+{3, 0, -2, -2},
+{4, 0, 3, -2},
+{0, 0, 4, 3},
+{0, 3, 1, -1},
+{1, 0, 2, -2},
+{2, 1, -2, 2},
+{3, 0, 2, 1},
+{8, 0, -3, 1},
+{4, -2, -1, -2},
+{0, 4, -1, 0},
+{8, 0, -3, -1},
+{6, 0, -1, -3},
+{0, 1, -3, 2},
+{2, 2, 0, -3},
+{5, -1, 0, 0},
+{1, 2, 2, 0},
+{2, 2, -3, -1},
+{3, -2, 0, -2},
+{3, -2, -1, -1},
+{1, -1, -1, -2},
+{0, 2, -2, -2},
+{2, 0, 5, 1},
+{7, 0, -3, 0},
+{5, 1, -1, -1},
+{1, -1, -2, -1},
+{3, 1, 0, 2},
+{2, 2, 0, 2},
+{0, 3, 2, 0},
+{6, 0, 1, -2},
+{2, 0, 3, -3},
+{1, 1, -3, 1},
+{1, 1, 3, 1},
+{2, -1, -1, 4},
+{2, 3, -2, 0},
+{2, 0, -6, -1},
+{4, 0, 2, -3},
+{4, -1, -3, -1},
+{4, -2, -2, 2},
+{4, 2, -1, -2},
+{6, -1, -3, -1},
+{2, -1, 0, 4},
+{4, -2, 0, 2},
+{6, 0, 2, -1},
+{4, 1, 2, 1},
+{2, -2, -4, 0},
+{6, -2, -2, -1},
+{6, -2, -2, 1},
+{4, -4, -1, 0},
+{1, -2, 1, 0},
+{2, 1, 3, -2},
+{1, 1, 2, 2},
+{3, -1, 1, -2},
+{1, 1, -1, -2},
+{3, 0, 1, 2},
+{6, 1, 1, 0},
+{1, 1, 0, 3},
+{0, 1, 0, 4},
+{0, 3, 1, 1},
+{2, -1, -4, 1},
+{1, -1, -1, 1},
+{6, -1, -2, 2},
+{1, 1, 0, -3},
+{4, -3, 0, 1},
+{1, 1, -2, 2},
+{4, -1, -3, 2},
+{6, -2, -1, 1},
+{4, 1, 3, 0},
+{2, -3, -2, -1},
+{2, -1, 4, -1},
+{3, -1, 0, -3},
+{2, 0, 1, -5},
+{3, -1, -1, 2},
+{4, -1, -1, 3},
+{2, -3, 0, 2},
+{2, 0, 5, -1},
+{1, 0, -5, 0},
+{6, 0, -4, 1},
+{4, 0, -1, 4},
+{1, 2, 1, 1},
+{2, -2, -2, 2},
+{2, -2, 1, -3},
+{1, 1, -2, -2},
+{2, -2, 3, 1},
+{1, 0, -3, -2},
+{1, -1, -3, 0},
+{6, -1, 2, 0},
+{7, 0, -2, 0},
+{4, 0, 1, 3},
+{6, -2, 0, -1},
+{4, 0, -3, -3},
+{2, 2, 2, 0},
+{0, 3, 0, -1},
+{4, -1, -1, -3},
+{2, -3, 1, -2},
+{6, -1, -1, -2},
+{4, 1, -4, 0},
+{0, 1, -4, -2},
+{6, -1, -1, 2},
+{1, -2, -1, -1},
+{4, 1, -3, -1},
+{6, -1, 1, 1},
+{0, 1, -1, -4},
+{3, -2, -1, 1},
+{4, 0, -6, 0},
+{3, 0, 3, 0},
+{4, -1, 1, -3},
+{0, 1, 1, 4},
+{2, -4, 0, 1},
+{4, 0, -2, 4},
+{4, 0, 1, -4},
+{5, -1, -2, 1},
+{2, -1, 2, -3},
+{6, 2, -2, 0},
+{8, 0, -1, 1},
+{6, 0, 0, -3},
+{4, -1, 3, -1},
+{1, -1, 1, 2},
+{4, -1, -2, 3},
+{1, -2, 1, -1},
+{0, 2, -2, 2},
+{2, 2, -2, 2},
+{5, 0, -4, 0},
+{2, 0, 2, 4},
+{3, 1, -4, 0},
+{0, 0, 0, 6},
+{6, -3, -2, 0},
+{6, -3, -1, 0},
+{4, -3, -2, 1},
+{8, -1, -4, 0},
+{4, -1, -4, -1},
+{2, -1, 5, 0},
+{5, -1, -2, -1},
+{1, 0, 3, 2},
+{2, 0, 3, 3},
+{6, -2, 1, 0},
+{4, 2, 0, -1},
+{3, 2, 0, -1},
+{1, 3, 0, 0},
+{0, 1, 4, 2},
+{2, -2, 2, 2},
+{2, 0, -4, 2},
+{1, 0, 0, 4},
+{6, 1, -3, 1},
+{4, -4, 0, 0},
+{0, 1, -5, -1},
+{5, 1, -1, 1},
+{3, -3, -1, 0},
+{2, 1, 1, 3},
+{1, -1, 0, -3},
+{5, -2, -2, 0},
+{4, -2, 1, -2},
+{2, -3, -1, 2},
+{3, 0, 2, -2},
+{5, 1, 0, -1},
+{6, 2, -3, 0},
+{5, 0, 1, 0},
+{1, 1, 4, 0},
+{4, -1, 3, 1},
+{2, -5, 0, 0},
+{2, 2, -4, 0},
+{0, 2, -3, 1},
+{2, -3, -3, 0},
+{6, 0, 2, 1},
+{4, 1, 1, 2},
+{6, 1, 0, 1},
+{4, -2, 2, -1},
+{5, 1, -3, 0},
+{0, 1, 5, 1},
+{2, 0, -1, -5},
+{2, -2, 3, -1},
+{2, 2, -1, -3},
+{2, -1, 1, -4},
+{1, 0, 4, 1},
+{8, 0, 0, -1},
+{5, 0, 1, -1},
+{2, -2, -1, 3},
+{3, 1, 2, -1},
+{3, 1, -3, -1},
+{0, 0, 2, -5},
+{6, -1, -2, -2},
+{2, -2, 4, 0},
+{2, -2, 0, 3},
+{1, 0, -4, 1},
+{4, 0, -1, -4},
+{8, 0, -4, 1},
+{3, -1, 0, 1},
+{4, 0, -4, -2},
+{0, 0, 7, 0},
+{2, 0, 6, 0},
+{5, 1, -2, 1},
+{5, 0, 0, -3},
+{4, -1, 2, 2},
+{4, 0, 4, -1},
+{2, 1, 4, -1},
+{5, -1, -1, -2},
+{0, 2, 2, -2},
+{5, 0, -2, 2},
+{6, -1, -3, 2},
+{4, 1, -2, -2},
+{3, 2, 1, 0},
+{1, 2, -1, 1},
+{6, 0, 3, 0},
+{1, 0, -3, 2},
+{3, 0, -1, 3},
+{8, -1, -2, -1},
+{2, 0, -1, 5},
+{1, 2, -3, 0},
+{2, 3, 0, 0},
+{2, 1, 4, 1},
+{2, 0, -2, -4},
+{8, -1, 0, 0},
+{4, -1, 0, 3},
+{0, 2, 3, 1},
+{4, -2, 2, 1},
+{1, -2, 2, 0},
+{3, -2, 1, 0},
+{2, 3, 0, -1},
+{2, 0, -7, 0},
+{0, 0, 6, -1},
+{4, 0, 3, 2},
+{2, -1, -4, -2},
+{2, -1, 2, 3},
+{3, 2, -2, 0},
+{3, 1, 2, 1},
+{5, 1, 1, 0},
+{4, 0, 0, 4},
+{2, 1, 3, 2},
+{0, 2, 2, 2},
+{0, 3, -3, 0},
+{4, 0, 4, 1},
+{4, -1, -5, 0},
+{2, 1, -4, 1},
+{2, -4, -1, 1},
+{5, 0, -3, -1},
+{2, -1, -2, -3},
+{4, -1, -2, -3},
+{6, -2, -3, 1},
+{0, 3, -2, -1},
+{4, -4, -2, 0},
+{4, -1, 4, 0},
+{5, -1, 0, -1},
+{4, 1, 2, -2},
+{6, -2, 0, 1},
+{1, -2, 0, -2},
+{2, -4, -2, 0},
+{0, 4, 1, 0},
+{4, -1, -3, -2},
+{5, 0, -2, -2},
+{6, 0, 1, 2},
+{6, 1, 1, -1},
+{3, 1, 0, -3},
+{4, -2, 3, 0},
+{2, -3, 2, 1},
+{0, 3, 0, 1},
+{2, -4, -1, -1},
+{3, -1, 1, 1},
+{2, -2, -3, 1},
+{3, -3, 0, 0},
+{2, 2, -2, -2},
+{4, 0, -4, 1},
+{8, 0, 1, 0},
+{2, -1, -5, -1},
+{8, 1, -2, 0},
+{5, -1, -1, 1},
+{8, -1, -1, -1},
+{4, -2, 0, -3},
+{2, 1, -5, -1},
+{6, 1, -4, 0},
+{1, 1, 2, -2},
+{5, 0, 0, 1},
+{3, 0, 3, -1},
+{1, 1, 3, -1},
+{3, -1, 2, -1},
+{4, -3, -3, 0},
+{2, -5, -1, 0},
+{6, -1, 0, -2},
+{3, 1, 3, 0},
+{0, 0, 2, 5},
+{2, 0, 0, 5},
+{6, 1, -2, -2},
+{6, -1, 0, 2},
+{2, -3, 3, 0},
+{7, 0, -4, 0},
+{8, -1, -2, 1},
+{3, 0, 0, -4},
+{1, 0, -2, -3},
+{2, 2, 2, -1},
+{1, -2, -2, 0},
+{4, 2, 0, 1},
+{8, -2, -2, 0},
+{2, -1, 1, 4},
+{2, -1, -3, 2},
+{7, 0, -2, -1},
+{0, 1, -6, 0},
+{5, 0, -1, 2},
+{8, 1, -3, 0},
+{2, 0, -3, -4},
+{2, 1, -3, 2},
+{4, -3, 1, -1},
+{6, -3, 0, 0},
+{2, -2, -1, -3},
+{0, 0, 5, -2},
+{2, 0, -3, -3},
+{5, 1, 0, 1},
+{0, 1, -3, -3},
+{0, 1, 0, -4},
+{4, 3, -1, 0},
+{6, 1, -1, -2},
+{3, -1, -3, -1},
+{8, -1, -3, 1},
+{3, 1, 1, 2},
+{1, 2, 1, -1},
+{2, 1, 1, -4},
+{1, 0, 2, 3},
+{6, 0, -2, 3},
+{0, 1, 6, 0},
+{5, -1, 0, -2},
+{1, 1, 1, -3},
+{2, 1, 2, -3},
+{1, 1, -1, 3},
+{4, -2, 1, 2},
+{6, 2, -1, 0},
+{2, -3, -1, -2},
+{2, -3, 2, -1},
+{2, 0, -6, 1},
+{1, 0, 5, 0},
+{6, 0, -5, 0},
+{8, 0, 0, 1},
+{1, 0, -2, 3},
+{2, 1, 5, 0},
+{4, 1, 3, -1},
+{2, 1, -4, -2},
+{3, -1, -2, 2},
+{3, 1, 1, -2},
+{3, -1, 0, 2},
+{0, 1, 3, 3},
+{1, 1, 1, 3},
+{3, 2, -3, 0},
+{4, 2, -3, 1},
+{6, -3, -3, 0},
+{4, 3, -2, 0},
+{1, -3, -1, 0},
+{4, -3, 2, 0},
+{4, -2, -2, -2},
+{5, 0, 1, -2},
+{1, 0, 1, -3},
+{2, -1, 4, -2},
+{8, -1, -3, -1},
+{0, 0, 1, 6},
+{1, 0, -1, -4},
+{8, -2, -3, 0},
+{4, 2, -2, 2},
+{2, 0, 5, -2},
+{8, 0, -5, 0},
+{6, 0, -3, -2},
+{6, 0, 2, -2},
+{1, -1, -3, -1},
+{1, -1, 3, 1},
+{0, 0, 3, -4},
+{4, 0, 0, -4},
+{4, 0, 5, 0},
+{6, 0, -4, 2},
+{1, 0, 4, -1},
+{10, 0, -3, 0},
+{2, 1, -2, 3},
+{1, 1, -4, -1},
+{6, -1, 2, -1},
+{8, 1, -1, 0},
+{1, 2, -2, -1},
+{0, 1, -2, -4},
+{2, 1, -1, -4},
+{2, 1, 0, 4},
+{3, -3, -2, 0},
+{4, -3, 1, 1},
+{3, -1, 2, 0},
+{3, 0, -4, -1},
+{6, -1, 1, -2},
+{5, 1, -1, -2},
+{0, 0, 4, 4},
+{2, 1, -1, 4},
+{3, 0, -2, 3},
+{3, 0, 0, 3},
+{7, -1, -3, 0},
+{0, 0, 1, -6},
+{0, 2, -4, -1},
+{0, 2, 3, -1},
+{1, 2, -2, 1},
+{3, -2, -2, 1},
+{3, 2, 0, 1},
+{0, 2, 0, 3},
+{0, 3, 0, -2},
+{2, -3, 1, 2},
+{0, 0, 6, 2},
+{4, 0, -6, -1},
+{2, 1, -6, 0},
+{0, 1, 5, -1},
+{2, 1, -2, -3},
+{1, -1, 3, -1},
+{3, 0, -3, 1},
+{4, 1, -1, -3},
+{8, -1, -1, 1},
+{0, 1, 2, 4},
+{2, -1, -1, -4},
+{1, 0, 1, 4},
+{2, 0, 0, -6},
+{0, 2, 4, 0},
+{8, -2, -1, 0},
+{0, 1, 4, -2},
+{0, 1, -5, 1},
+{2, 0, -4, -3},
+{6, 0, -4, -1},
+{1, -1, -4, 0},
+{1, -1, 4, 0},
+{4, -1, 3, -2},
+{6, -1, -1, -3},
+{6, 0, -3, 3},
+{3, 0, 2, 2},
+{5, -1, 1, 0},
+{3, 0, 3, 1},
+{5, -1, -3, 1},
+{5, 1, -2, -1},
+{6, 0, -1, 3},
+{0, 2, -3, -2},
+{2, 2, 2, -2},
+{6, -2, -4, 0},
+{0, 2, 0, -3},
+{3, 3, -1, 0},
+{3, -2, -3, 0},
+{3, -2, -2, -1},
+{3, -2, 1, -1},
+{1, -1, -2, 2},
+{1, -1, -1, 2},
+{3, -1, -4, 0},
+{6, 1, 2, 0},
+{7, 0, -1, -1},
+{10, 0, -2, 0},
+{0, 1, -1, 4},
+{4, 0, -2, -4},
+{4, 0, 0, -5},
+{2, -2, -3, -2},
+{4, -3, -2, -1},
+{6, -2, 1, -1},
+{5, -2, -3, 0},
+{2, 0, 5, 2},
+{2, -1, 4, 2},
+{6, 1, -2, 2},
+{4, 0, 2, 3},
+{4, 1, -1, 3},
+{4, 1, 3, 1},
+{1, -1, 2, -2},
+{1, -1, 2, 2},
+{1, 1, -3, -2},
+{10, 0, -4, 0},
+{7, -1, -2, 0},
+{2, -1, -2, 4},
+{2, 0, -2, 5},
+{2, 2, 1, 2},
+{4, 2, -1, 2},
+{2, 2, -1, 3},
+{5, -2, 0, 0},
+{1, 2, 2, 1},
+{2, -2, -4, -1},
+{1, -3, 0, 1},
+{2, -4, 2, 0},
+{4, -3, 0, -2},
+{4, 2, -2, -2},
+{2, 0, -6, -2},
+{1, 1, -5, 0},
+{1, 0, -5, -1},
+{4, 0, 4, -2},
+{8, 0, -3, 2},
+{4, -1, -3, 3},
+{4, 1, 1, -3},
+{6, 1, 1, 1},
+{1, -1, -2, -2},
+{1, 0, -1, 4},
+{1, 0, 1, -4},
+{3, 0, -3, -2},
+{3, 0, -3, 2},
+{7, 1, -2, 0},
+{5, 0, -1, -3},
+{7, 0, -3, 1},
+{8, 0, -2, 2},
+{8, -1, 0, -1},
+{0, 1, 1, -4},
+{2, -2, 3, -2},
+{2, -2, 1, 3},
+{4, -2, -3, 1},
+{1, 2, 0, 2},
+{1, 2, 3, 0},
+{5, -2, -1, 0},
+{0, 3, -2, 1},
+{1, 3, -1, 0},
+{1, -3, 0, -1},
+{1, -4, 0, 0},
+{0, 1, 0, -3},
+{2, -1, -6, 0},
+{4, 0, -5, -2},
+{6, 1, -1, 2},
+{0, 0, 5, 3},
+{2, -1, 5, 1},
+{2, 1, 2, 3},
+{4, -1, 2, -3},
+{4, 0, 3, -3},
+{6, -1, 0, -3},
+{6, -1, 2, 1},
+{6, 0, 3, -1},
+{5, 0, -3, 2},
+{5, 1, 1, -1},
+{7, 0, -2, 1},
+{0, 2, -1, -3},
+{3, 2, -1, 1},
+{5, -2, -1, -1},
+{2, -4, 1, 1},
+{6, -3, -1, -1},
+{2, 0, -3, 4},
+{4, 0, 1, 4},
+{4, 1, 2, 2},
+{6, -1, 3, 0},
+{2, -1, 0, -5},
+{4, -1, -5, -1},
+{4, -1, 1, 3},
+{4, 1, -2, 3},
+{6, -1, -4, 1},
+{8, 0, -4, -1},
+{8, 0, 1, -1},
+{7, 0, -3, -1},
+{1, 0, -4, -2},
+{1, 1, 3, 2},
+{3, -1, -1, -3},
+{0, 2, -5, 0},
+{4, -2, 2, -2},
+{0, 2, -1, 3},
+{2, -2, -2, 3},
+{2, 2, 2, 1},
+{6, 2, -2, -1},
+{3, 2, 1, -1},
+{0, 4, -2, 0},
+{2, 3, -3, 0},
+{4, -4, 1, 0},
+{4, -3, -1, 2},
+{2, 3, -1, -1},
+{1, 3, 1, 0},
+{3, 2, 0, -2},
+{6, 1, 0, -2},
+{0, 0, 7, 1},
+{2, -2, 0, -4},
+{2, 0, 3, 4},
+{2, 1, 4, -2},
+{4, -1, -1, 4},
+{4, 1, 4, 0},
+{6, -2, 2, 0},
+{6, 0, 0, -4},
+{8, -1, 1, 0},
+{2, 0, 2, -5},
+{2, 0, 4, -3},
+{2, 0, 6, 1},
+{8, 1, -2, -1},
+{1, -2, 1, -2},
+{3, -2, -1, -2},
+{1, -1, 1, -3},
+{1, 1, 4, 1},
+{3, -2, 0, 1},
+{3, 0, -2, -3},
+{4, 2, 1, 0},
+{0, 3, -1, -2},
+{0, 3, 2, 1},
+{2, -3, 0, -3},
+{5, 2, -1, 0},
+{1, 2, -1, -1},
+{2, -4, 1, -1},
+{4, -4, 0, -1},
+{4, 3, -1, -1},
+{1, 1, -3, 2},
+{3, -1, -2, -2},
+{0, 1, -4, 2},
+{2, -2, 3, 2},
+{2, 0, -5, 2},
+{4, 0, -7, 0},
+{4, 0, -3, 4},
+{6, -2, -2, 2},
+{6, -2, -1, 2},
+{8, 1, -4, 0},
+{0, 2, 1, -3},
+{0, 2, 1, 3},
+{2, -2, 4, 1},
+{2, -1, -3, 3},
+{2, 0, -7, -1},
+{2, 0, 1, 5},
+{2, 2, -4, -1},
+{4, 0, -4, -3},
+{4, 1, 0, 3},
+{6, -2, -3, -1},
+{6, -2, 1, 1},
+{6, 0, -2, -3},
+{6, 1, -1, -3},
+{8, -1, -4, 1},
+{5, -1, -4, 0},
+{1, -2, 0, 2},
+{1, 1, 0, 4},
+{3, 0, 4, 0},
+{3, 1, -2, 2},
+{7, 1, -1, 0},
+{1, -2, -2, -1},
+{1, 1, -4, 1},
+{1, 1, -1, -3},
+{3, -1, 2, 1},
+{3, 1, -4, -1},
+{0, 3, 0, 2},
+{1, -3, 1, 0},
+{1, 3, -2, 0},
+{2, 3, 0, -2},
+{4, -4, -1, -1},
+{4, -4, -1, 1},
+{2, -1, 2, -4},
+{4, -2, -4, 0},
+{8, 0, -2, -2},
+{0, 1, -5, -2},
+{2, 1, 1, 4},
+{4, -3, 0, 2},
+{4, -1, -2, 4},
+{4, -1, 1, -4},
+{4, -1, 3, 2},
+{6, -1, 1, 2},
+{6, 2, -4, 0},
+{8, -2, -4, 0},
+{8, 0, -1, 2},
+{8, 1, 0, 0},
+{10, 0, -1, 0},
+{0, 0, 4, -3},
+{2, -1, -5, 1},
+{2, -1, 3, -3},
+{2, -1, 5, -1},
+{2, 0, 4, 3},
+{2, 2, 1, -3},
+{4, -2, -3, -1},
+{4, -1, 4, -1},
+{6, 0, 3, 1},
+{6, 2, -2, 1},
+{8, 1, -1, -1},
+{1, 0, 3, -2},
+{3, 0, -1, -4},
+{3, 1, -5, 0},
+{3, 2, 2, 0},
+{5, 0, 0, 2},
+{5, 1, -4, 0},
+{7, 1, -3, 0},
+{1, -1, 0, 3},
+{3, -3, 0, -1},
+{5, -1, 1, -1},
+{5, 0, 2, -1},
+{1, -2, 2, -1},
+{1, 1, -2, 3},
+{5, 0, 1, 1},
+{2, -3, -3, -1},
+{2, 3, -2, -1},
+{2, 3, 1, -1},
+{6, -3, -2, 1},
+{6, -3, -1, 1},
+{6, -2, -1, -2},
+{0, 1, 5, 2},
+{0, 3, 3, 0},
+{2, -2, -5, 0},
+{2, -1, -2, -4},
+{2, -1, 2, 4},
+{2, 0, -4, -4},
+{4, -1, -6, 0},
+{4, 2, -4, 0},
+{4, 3, 0, 0},
+{6, -3, 1, 0},
+{6, 0, 2, 2},
+{6, 1, -3, 2},
+{8, -2, 0, 0},
+{8, 0, -4, 2},
+{8, 0, -3, -2},
+{8, 0, -1, -2},
+{8, 0, 2, 0},
+{10, -1, -3, 0},
+{2, -3, -2, 1},
+{2, -1, 3, 3},
+{2, 0, -2, -5},
+{2, 0, 6, -1},
+{2, 1, -5, 1},
+{2, 1, 0, -5},
+{2, 3, -1, 1},
+{4, -2, -1, -3},
+{4, -2, -1, 3},
+{4, -2, 3, -1},
+{4, -2, 3, 1},
+{4, -1, -3, -3},
+{4, -1, 4, 1},
+{4, 2, -1, -3},
+{6, -3, -2, -1},
+{6, -3, 0, -1},
+{6, 0, 0, 3},
+{6, 0, 1, -3},
+{6, 1, 2, -1},
+{6, 2, -3, 1},
+{6, 2, -1, -1},
+{8, -1, 0, 1},
+{1, -2, -3, 0},
+{1, -2, 3, 0},
+{1, 0, -6, 0},
+{1, 0, 4, 2},
+{1, 2, 1, 2},
+{3, -3, 0, -2},
+{3, -1, 1, 2},
+{3, -1, 3, 0},
+{3, 0, -5, 0},
+{3, 0, 1, -4},
+{5, 1, -1, 2},
+{5, 1, 0, -2},
+{5, 1, 2, 0},
+{7, 0, -2, -2},
+{7, 0, 0, 0},
+{1, -2, 1, 1},
+{3, 1, -1, 3},
+{3, 2, -1, -1},
+{5, -1, 0, -3},
+{5, 1, -3, 1},
+{5, 1, 1, 1},
+{7, 0, -1, 0},
+{2, -5, 1, 0},
+{2, -3, 2, -2},
+{4, 0, -4, 2},
+{3, 1, -2, -2},
+{0, 0, 2, 6},
+{0, 1, -2, 4},
+{0, 3, 1, 2},
+{2, -4, 0, -2},
+{2, -3, -2, -2},
+{2, -2, 0, 4},
+{2, -2, 5, 0},
+{2, -1, 6, 0},
+{2, 0, -1, 6},
+{2, 1, 4, 2},
+{2, 2, -3, -2},
+{2, 2, 0, -4},
+{2, 3, 1, 0},
+{4, -3, -2, 2},
+{4, -3, -1, -2},
+{4, -2, -3, 2},
+{4, -2, 2, 2},
+{4, -1, -4, -2},
+{4, -1, 0, 4},
+{4, 0, 4, 2},
+{4, 1, -5, 0},
+{4, 1, -3, -2},
+{4, 1, 1, -4},
+{4, 1, 3, -2},
+{6, -4, -2, 0},
+{6, -4, -1, 0},
+{6, 0, 4, 0},
+{6, 1, 0, 2},
+{6, 1, 1, -2},
+{8, 0, 0, -2},
+{10, -1, -2, 0},
+{10, 0, -5, 0},
+{0, 0, 3, 5},
+{0, 1, -6, -1},
+{0, 1, 6, 1},
+{0, 2, -4, 1},
+{0, 2, -2, 3},
+{0, 3, -3, -1},
+{0, 3, 2, -1},
+{0, 4, -1, 1},
+{0, 4, 0, -1},
+{2, -2, 4, -1},
+{2, -1, -3, -3},
+{2, 1, 5, 1},
+{2, 2, -2, -3},
+{2, 2, -2, 3},
+{2, 3, 0, 1},
+{4, -2, -2, 3},
+{4, -2, 1, -3},
+{4, 0, -1, -5},
+{6, 1, 0, -3},
+{8, -2, -2, -1},
+{8, -2, -1, -1},
+{8, 0, 1, 1},
+{8, 1, -3, -1},
+{8, 1, -2, 1},
+{1, 1, 5, 0},
+{1, 2, -4, 0},
+{3, 0, -1, 4},
+{3, 1, 2, 2},
+{3, 3, -2, 0},
+{5, 1, -2, 2},
+{7, -1, -4, 0},
+{1, -1, -3, 1},
+{1, 0, -5, 1},
+{1, 0, 5, 1},
+{3, 1, -3, 1},
+{5, -1, -3, -1},
+{1, -2, -1, -2},
+{3, -2, 1, -2},
+{3, -1, 2, -2},
+{5, -1, -2, 2},
+{5, 2, 0, 0},
+{7, 0, -1, -2},
+{3, -3, -1, -1},
+{3, -2, 0, -3},
+{3, 0, 1, 3},
+{3, 1, 3, -1},
+{3, 1, 3, 1},
+{3, 2, 1, 1},
+{5, -2, -2, -1},
+{5, -2, -2, 1},
+{7, -1, -2, -1},
+{4, -5, -1, 0},
+{0, 4, -1, -1},
+{2, -5, 0, -1},
+{4, -4, 0, 1},
+{0, 3, -1, 2},
+{4, 1, -3, 2},
+{4, -1, -1, -4},
+{5, 0, 2, 0},
+{2, 1, -4, 2},
+{0, 0, 8, 0},
+{0, 1, -3, -4},
+{0, 1, 2, -4},
+{0, 1, 3, 4},
+{0, 2, -3, 2},
+{0, 2, 3, 2},
+{0, 3, -4, 0},
+{2, -4, 0, 2},
+{2, -3, -4, 0},
+{2, -3, 2, 2},
+{2, -2, -1, 4},
+{2, -1, -5, -2},
+{2, 0, -8, 0},
+{2, 0, -1, -6},
+{2, 0, 0, 6},
+{2, 0, 7, 0},
+{2, 1, -5, -2},
+{2, 3, -1, -2},
+{4, -5, 0, 0},
+{4, -3, 1, -2},
+{4, -2, 4, 0},
+{4, -1, 5, 0},
+{6, -2, -3, 2},
+{6, -2, -2, -2},
+{6, -2, 0, 2},
+{6, -1, 2, -2},
+{6, 0, -2, 4},
+{6, 0, 3, -2},
+{8, -1, -5, 0},
+{8, -1, -2, 2},
+{10, -1, -4, 0},
+{0, 0, 3, -5},
+{0, 1, -4, -3},
+{0, 1, 3, -3},
+{0, 2, -2, -3},
+{2, -4, -2, -1},
+{2, -3, 1, -3},
+{2, -3, 3, 1},
+{2, -2, 2, -3},
+{2, -1, 1, -5},
+{2, 0, -5, -3},
+{2, 1, -6, -1},
+{2, 1, 5, -1},
+{2, 2, -3, 1},
+{2, 2, 0, 3},
+{4, -4, -2, 1},
+{4, -3, 2, -1},
+{4, -3, 2, 1},
+{4, -2, -4, -1},
+{4, -2, 0, 3},
+{4, 0, -4, 3},
+{4, 0, 5, -1},
+{4, 0, 5, 1},
+{4, 1, -2, -3},
+{4, 1, 2, -3},
+{4, 2, -3, -1},
+{5, 1, 0, -3},
+{6, -3, 0, 1},
+{6, -1, -2, 3},
+{6, -1, -1, 3},
+{6, 1, -4, 1},
+{6, 1, -3, -1},
+{7, 0, -4, 1},
+{8, -2, -2, 1},
+{8, 1, -3, 1},
+{10, 0, -3, -1},
+{10, 0, -3, 1},
+{10, 0, -2, -1},
+{1, 0, 2, 4},
+{3, -3, 1, 0},
+{3, -2, -1, 2},
+{5, -3, -2, 0},
+{5, -2, -1, -2},
+{5, -1, -2, -2},
+{5, -1, -1, 2},
+{5, -1, 1, -2},
+{7, 1, 0, 0},
+{1, -3, -1, -1},
+{1, -2, -2, 1},
+{1, -2, 2, 1},
+{1, -1, -4, -1},
+{1, -1, -1, -3},
+{1, 0, 0, -5},
+{1, 1, 2, 3},
+{1, 2, -3, -1},
+{1, 2, 2, -1},
+{1, 3, 0, -1},
+{1, 3, 0, 1},
+{3, -3, -1, 1},
+{3, 0, -4, 1},
+{3, 1, -1, -3},
+{3, 1, 0, 3},
+{5, 0, 1, -3},
+{7, 0, -1, 1},
+{7, 0, 0, -1},
+{1, 2, 0, -2},
+{6, -2, 0, -2},
+{4, 2, 0, -2},
+{2, 1, 2, -4},
+{5, 0, -3, -2},
+{1, 2, 1, -2},
+{0, 0, 5, 4},
+{0, 0, 6, -2},
+{0, 1, -7, 0},
+{0, 1, 7, 0},
+{0, 2, -4, -2},
+{0, 2, 3, -2},
+{0, 3, -2, -2},
+{0, 3, -2, 2},
+{0, 4, 2, 0},
+{0, 5, -1, 0},
+{1, -3, -2, 0},
+{1, -1, -5, 0},
+{1, -1, -3, -2},
+{1, -1, -3, 2},
+{1, -1, 0, -4},
+{1, -1, 3, 2},
+{1, 0, -4, 2},
+{1, 1, 1, 4},
+{1, 1, 3, -2},
+{2, -6, 0, 0},
+{2, -4, -3, 0},
+{2, -4, -1, 2},
+{2, -4, 1, -2},
+{2, -3, -2, 2},
+{2, -3, 4, 0},
+{2, -1, -4, 2},
+{2, 0, 3, -4},
+{2, 1, -2, -4},
+{2, 1, 6, 0},
+{2, 2, -5, 0},
+{2, 2, -3, 2},
+{2, 2, -1, -4},
+{2, 3, 1, -2},
+{3, -4, -1, 0},
+{3, -4, 0, 0},
+{3, -1, 0, -4},
+{3, 0, 0, 4},
+{3, 0, 3, -2},
+{3, 0, 3, 2},
+{3, 1, -3, -2},
+{3, 1, -3, 2},
+{3, 1, 4, 0},
+{3, 2, -4, 0},
+{3, 3, 0, 0},
+{4, -3, 3, 0},
+{4, -2, -5, 0},
+{4, 0, -3, -4},
+{4, 0, 2, 4},
+{4, 2, -3, 2},
+{4, 2, 0, 2},
+{4, 2, 1, -2},
+{5, -2, 0, -2},
+{5, -2, 1, 0},
+{5, 0, 0, -4},
+{5, 0, 2, -2},
+{5, 1, 0, 2},
+{6, -4, 0, 0},
+{6, -2, 1, -2},
+{6, -1, -5, 0},
+{6, -1, -4, 2},
+{6, -1, -3, -2},
+{6, 0, -3, 4},
+{6, 0, -1, 4},
+{6, 1, 3, 0},
+{6, 2, 0, 0},
+{7, -2, -3, 0},
+{7, -1, 0, 0},
+{8, -3, -3, 0},
+{8, -3, -2, 0},
+{8, -3, -1, 0},
+{8, -1, -3, 2},
+{8, 0, 0, 2},
+{9, 0, -4, 0},
+{9, 0, -3, 0},
+{10, -1, -1, 0},
+{10, 0, 0, 0},
+{0, 0, 7, -1},
+{0, 1, -3, 3},
+{0, 1, 0, 5},
+{0, 1, 4, 3},
+{0, 2, 4, 1},
+{0, 4, 1, -1},
+{1, -3, 1, -1},
+{1, -1, 1, 3},
+{1, -1, 4, 1},
+{1, 0, -3, 3},
+{1, 0, 3, 3},
+{1, 1, 4, -1},
+{2, -5, 0, 1},
+{2, -3, -1, 3},
+{2, -3, 0, 3},
+{2, -3, 3, -1},
+{2, -2, -4, 1},
+{2, -2, 2, 3},
+{2, -1, -6, -1},
+{2, -1, -1, 5},
+{2, -1, 0, 5},
+{2, 0, -7, 1},
+{2, 0, -4, 3},
+{2, 0, -3, 5},
+{2, 1, -3, -3},
+{2, 1, 1, -5},
+{2, 1, 3, -3},
+{2, 1, 3, 3},
+{2, 3, -2, 1},
+{3, -1, -1, 3},
+{3, -1, 3, -1},
+{3, 0, 1, -3},
+{3, 0, 4, -1},
+{3, 0, 4, 1},
+{3, 2, -2, -1},
+{4, -2, -2, -3},
+{4, -1, -4, 1},
+{4, -1, 2, 3},
+{4, 0, -7, -1},
+{4, 0, -1, 5},
+{4, 0, 3, 3},
+{4, 1, 1, 3},
+{4, 1, 4, -1},
+{4, 2, 1, 1},
+{4, 3, -2, 1},
+{4, 3, -1, 1},
+{4, 3, 0, -1},
+{5, -2, -1, 1},
+{5, -2, 0, -1},
+{5, 0, -2, 3},
+{5, 2, -1, -1},
+{6, -3, -3, 1},
+{6, -2, 2, -1},
+{6, -1, -4, -1},
+{6, -1, -3, 3},
+{6, -1, 3, -1},
+{6, 0, -4, 3},
+{6, 0, 2, -3},
+{6, 1, 2, 1},
+{6, 2, -3, -1},
+{6, 2, -1, 1},
+{7, -1, -3, 1},
+{7, -1, -2, 1},
+{7, -1, -1, -1},
+{7, 1, -2, -1},
+{7, 1, -1, -1},
+{8, -2, -3, -1},
+{8, -2, -3, 1},
+{8, -2, -1, 1},
+{8, -1, -4, -1},
+{8, -1, 1, -1},
+{8, 0, -5, 1},
+{8, 0, -2, -3},
+{8, 0, -1, -3},
+{8, 1, -1, 1},
+{8, 1, 0, -1},
+{10, 0, -4, 1},
+{10, 0, -2, 1},
+{10, 0, -1, -1},
+{3, 3, 0, -2},
+{2, -2, 1, -4},
+{4, -1, 0, -4},
+{0, 3, 1, -2},
+{3, -2, 2, 0},
+{4, -2, -3, -2},
+{2, 4, -1, 0},
+{0, 0, 4, -4},
+{4, 2, -3, -2},
+{7, -1, -1, 0},
+{8, -1, -2, -2},
+{8, -1, -1, -2},
+{3, 3, -1, -3},
+{0, 0, 7, 2},
+{0, 1, 5, -2},
+{0, 2, 0, 4},
+{1, -3, 2, 0},
+{1, -1, 3, -2},
+{1, -1, 5, 0},
+{1, 0, -5, -2},
+{1, 0, -2, -4},
+{1, 0, 6, 0},
+{1, 1, -4, -2},
+{1, 2, -1, 2},
+{1, 2, 2, 2},
+{1, 2, 4, 0},
+{1, 4, 0, 0},
+{2, -5, -2, 0},
+{2, -4, 3, 0},
+{2, -2, -4, -2},
+{2, -2, 1, 4},
+{2, -1, -3, -4},
+{2, -1, 5, -2},
+{2, -1, 5, 2},
+{2, 0, 1, -6},
+{2, 0, 1, 6},
+{2, 0, 4, 4},
+{2, 0, 6, -2},
+{2, 0, 6, 2},
+{2, 1, -7, 0},
+{2, 1, 2, 4},
+{2, 2, -1, 4},
+{2, 2, 3, -2},
+{2, 4, -2, 0},
+{3, -1, 2, 2},
+{3, 0, -4, -2},
+{3, 0, -2, 4},
+{3, 1, 2, -2},
+{3, 2, -1, -2},
+{3, 2, 0, 2},
+{4, -5, -2, 0},
+{4, -4, -3, 0},
+{4, -4, 2, 0},
+{4, -3, 1, 2},
+{4, -2, 3, -2},
+{4, -1, -2, -4},
+{4, -1, 1, 4},
+{4, -1, 4, -2},
+{4, 0, -6, -2},
+{4, 0, 2, -4},
+{4, 0, 6, 0},
+{4, 1, -6, 0},
+{4, 1, -1, 4},
+{4, 1, 3, 2},
+{4, 2, 2, 0},
+{5, -3, 0, 0},
+{5, -1, -3, 2},
+{5, 0, 1, 2},
+{5, 1, -2, -2},
+{5, 2, -3, 0},
+{5, 2, -2, 0},
+{5, 2, 1, 0},
+{6, -4, -3, 0},
+{6, -2, 3, 0},
+{6, -1, 2, 2},
+{6, 0, 1, -4},
+{6, 1, -5, 0},
+{6, 1, 1, 2},
+{6, 2, -2, -2},
+{6, 2, -1, -2},
+{6, 3, -2, 0},
+{7, -2, -2, 0},
+{7, 0, -5, 0},
+{7, 0, -3, 2},
+{7, 0, -2, 2},
+{7, 0, 0, -2},
+{8, -2, 1, 0},
+{8, -1, -1, 2},
+{8, -1, 2, 0},
+{8, 0, 1, -2},
+{8, 1, 1, 0},
+{8, 2, -3, 0},
+{0, 1, -6, 1},
+{0, 1, -1, -5},
+{0, 1, 1, 5},
+{0, 1, 6, -1},
+{0, 2, -5, -1},
+{0, 2, 2, -3},
+{0, 2, 2, 3},
+{0, 3, -3, 1},
+{0, 4, 0, 1},
+{0, 4, 1, 1},
+{1, -2, -1, 1},
+{1, -1, 4, -1},
+{1, 0, 0, 5},
+{1, 0, 1, -5},
+{1, 0, 5, -1},
+{1, 1, -5, -1},
+{1, 1, -2, -3},
+{1, 1, 2, -3},
+{1, 2, -3, 1},
+{1, 2, 3, 1},
+{2, -5, -1, -1},
+{2, -5, -1, 1},
+{2, -4, 2, 1},
+{2, -1, -1, -5},
+{2, 0, 2, 5},
+{2, 2, -4, 1},
+{3, -2, -3, -1},
+{3, -2, 2, -1},
+{3, -1, -4, -1},
+{3, -1, 0, 3},
+{3, -1, 3, 1},
+{3, 0, -3, 3},
+{3, 1, -4, 1},
+{3, 2, -2, 1},
+{3, 2, 2, -1},
+{3, 3, -1, 1},
+{4, -4, 1, -1},
+{4, -3, 0, -3},
+{4, -1, -6, -1},
+{4, -1, 0, -5},
+{4, -1, 3, -3},
+{4, 0, -6, 1},
+{4, 0, -2, 5},
+{4, 1, -5, -1},
+{4, 1, -4, -1},
+{4, 1, -4, 1},
+{4, 1, 4, 1},
+{4, 2, -2, -3},
+{4, 2, 1, -1},
+{5, -1, -1, -3},
+{5, 0, -4, 1},
+{5, 0, -1, 3},
+{5, 0, 2, 1},
+{5, 1, -3, -1},
+{5, 1, 2, -1},
+{5, 2, 0, -1},
+{6, -3, 1, -1},
+{6, -2, -1, -3},
+{6, -2, 2, 1},
+{6, -1, 0, 3},
+{6, -1, 3, 1},
+{6, 0, 1, 3},
+{6, 0, 4, -1},
+{7, -1, -3, -1},
+{7, 0, -1, -3},
+{7, 1, -2, 1},
+{7, 1, -1, 1},
+{8, -2, 0, -1},
+{8, -1, 1, 1},
+{8, 0, 2, -1},
+{10, 0, -4, -1},
+{4, 4, -2, -2},
+{3, 3, -3, 0},
+{3, 3, -1, -1},
+{1, 3, 0, -2},
+{3, 3, -2, -2},
+{5, 3, -2, -2},
+};
+
+static const int8_t earth_arg[][5] = {
+{1, 0, 0, 0, 0},
+{1, 0, 0, 0, -1},
+{1, 0, 0, 1, -1},
+{1, 0, 0, -1, -1},
+{1, 0, 0, -1, 0},
+{1, 0, 0, 1, 0},
+{1, 0, 0, 0, 1},
+{1, 0, 0, 0, -2},
+{1, -2, 0, 0, 0},
+{1, 2, 0, 0, -1},
+{1, 2, 0, -1, 0},
+{2, 0, 0, 0, -1},
+{1, -2, 0, 1, 0},
+{1, -2, 0, 0, -1},
+{1, 2, 0, -1, -1},
+{1, 0, 0, -1, 1},
+{1, -2, 0, 1, -1},
+{1, -2, 0, 0, 1},
+{1, 2, 0, 0, 0},
+{1, 0, 0, -1, -2},
+{1, 0, 0, 1, 1},
+{2, 0, 0, 0, -2},
+{1, 0, 0, 2, -1},
+{1, 0, 0, -2, -1},
+{1, 0, 0, 2, 0},
+{0, 0, 0, 0, 0},
+{0, 2, 0, -1, 0},
+{1, 0, 0, -2, 0},
+{1, -2, 0, -1, 0},
+{1, 0, 0, 0, -3},
+{1, -2, 1, 0, 0},
+{1, 2, 0, 1, -1},
+{1, 2, 0, 0, -2},
+{1, -2, 0, -1, -1},
+{1, -2, 0, -1, 1},
+{1, 0, 0, 0, 2},
+{1, 2, 0, -1, 1},
+{1, -2, 0, 2, 0},
+{1, 2, -1, 0, -1},
+{1, -2, -1, 0, 0},
+{1, 2, 0, 1, 0},
+{1, -2, 0, 0, -2},
+{1, -2, 0, 1, -2},
+{0, 0, 1, 0, 0},
+{1, -2, 1, 0, -1},
+{0, 0, 0, 1, -2},
+{1, 2, 0, 0, 1},
+{2, 0, 0, -1, -1},
+{1, 0, 0, -1, 2},
+{2, 0, 0, 1, -1},
+{1, -2, 0, 1, 1},
+{1, 0, -1, 1, -1},
+{1, 0, 0, -2, 1},
+{1, 0, 0, -2, -2},
+{1, 2, -1, -1, 0},
+{1, 1, 0, 0, -1},
+{1, 0, 0, 2, 1},
+{1, -2, 1, 1, 0},
+{1, -4, 0, 1, 0},
+{1, 2, -1, 0, 0},
+{2, -2, 0, 0, -1},
+{1, 0, 1, 1, -1},
+{1, 2, -1, -1, -1},
+{0, 0, 0, 1, 0},
+{1, 0, -1, 0, -1},
+{1, 0, -1, 1, 0},
+{1, -2, 0, 0, 2},
+{1, 0, 0, -1, -3},
+{1, 0, 1, -1, 0},
+{1, 0, -1, 0, 0},
+{1, -2, 0, 2, -1},
+{1, 0, 1, -1, -1},
+{1, 0, 0, 3, -1},
+{2, 0, 0, 1, -2},
+{2, 0, 0, 0, 0},
+{1, 0, 1, 0, -1},
+{2, 0, 0, -1, -2},
+{1, 0, 0, 1, -2},
+{1, 0, 0, -3, -1},
+{1, 0, -1, -1, 0},
+{1, -2, 1, 1, -1},
+{1, 1, 0, 0, 0},
+{1, 4, 0, -1, -1},
+{0, 2, 0, 0, -1},
+{1, -1, 0, 0, 0},
+{1, 0, 1, 1, 0},
+{1, 0, 1, 0, 0},
+{1, -4, 0, 0, 0},
+{1, -2, 1, 0, 1},
+{1, 0, -1, -1, -1},
+{2, 0, 0, 0, -3},
+{0, 2, -1, -1, 0},
+{1, 0, 0, 3, 0},
+{0, 0, 0, 2, -1},
+{1, 2, 0, -2, -1},
+{1, -4, 0, 1, -1},
+{1, 2, 0, 1, -2},
+{1, 0, 0, 1, 2},
+{1, 2, 0, 2, -1},
+{0, 2, 0, -1, -1},
+{1, -2, -1, 0, 1},
+{0, 2, -1, 0, 0},
+{1, 4, 0, 0, -1},
+{1, 2, 1, 0, -1},
+{1, 4, 0, -1, 0},
+{1, -2, 0, -2, 0},
+{0, 0, 1, -1, 0},
+{0, 2, 0, -1, 1},
+{1, -2, 0, -1, -2},
+{0, 2, 0, 0, 0},
+{0, 1, 0, 0, 0},
+{1, -2, 0, -2, -1},
+{1, 4, 0, -2, 0},
+{1, 2, -1, 1, -1},
+{1, 0, 0, -3, 0},
+{0, 2, 0, 1, -2},
+{1, 4, 0, -2, -1},
+{1, -2, 1, -1, 0},
+{0, 0, 0, 2, -2},
+{2, 2, 0, -1, -1},
+{0, 1, 1, 0, -1},
+{1, 2, 0, 1, 1},
+{2, 0, 0, -1, 0},
+{0, 0, 1, 1, 0},
+{1, 0, 0, 2, -2},
+{0, 2, 0, -2, 0},
+{1, -4, 0, 0, -1},
+{1, -1, 0, 0, -1},
+{1, 0, 0, 0, 3},
+{1, -2, 1, -1, -1},
+{2, -2, 0, 1, -1},
+{0, 1, 1, 0, 0},
+{1, 2, 0, -2, 1},
+{1, 2, 0, -1, -2},
+{1, -4, 0, 2, -1},
+{1, -2, 0, -2, 1},
+{0, 2, 0, 0, -2},
+{1, 1, 1, 0, -1},
+{1, -2, 0, 3, 0},
+{1, 0, 0, 1, -3},
+{2, 2, 0, 0, -2},
+{1, -1, 0, 0, 1},
+{0, 0, 0, 1, -1},
+{1, 2, 1, -1, 0},
+{1, 2, 0, 2, 0},
+{1, -2, -1, 0, -1},
+{1, -2, -1, 1, -1},
+{1, -2, 2, 0, 0},
+{1, -2, 1, -1, 1},
+{1, 2, -1, 0, -2},
+{1, 2, 1, 0, 0},
+{2, 2, 0, 0, -1},
+{1, -2, 0, 2, 1},
+{1, -2, 0, -1, 2},
+{1, 0, -1, 2, -1},
+{0, 0, 0, 1, 1},
+{1, -2, 0, 3, -1},
+{1, -2, 0, 1, -3},
+{1, 1, 0, 1, -1},
+{2, -2, 0, 0, 0},
+{1, -2, 0, 1, 2},
+{1, 2, -1, 1, 0},
+{1, 4, 0, 0, 0},
+{1, -2, -1, -1, 0},
+{2, 2, 0, -1, -2},
+{1, -2, 1, 0, -2},
+{1, 2, 0, -2, -2},
+{0, 0, 0, 0, 2},
+{1, -2, 0, 0, -3},
+{1, 0, 1, -2, -1},
+{1, 0, 1, 2, -1},
+{1, 2, -1, -1, 1},
+{1, 2, 0, -3, -1},
+{1, -1, -1, 0, 0},
+{1, 0, 1, 0, 1},
+{1, -2, -1, 1, 0},
+{1, 0, 0, 0, -4},
+{1, 0, 0, -3, -2},
+{1, 0, 0, -2, 2},
+{1, 2, 0, -2, 0},
+{1, 2, 0, -1, 2},
+{1, 0, 0, -2, -3},
+{1, 1, 1, 0, 0},
+{1, 2, -2, 0, -1},
+{1, 2, -1, 0, 1},
+{1, 0, -1, 2, 0},
+{1, 0, -1, -2, -1},
+{1, -4, 0, 2, 0},
+{1, -4, 1, 1, 0},
+{1, -1, 0, -1, 0},
+{1, -1, 0, 1, -1},
+{1, -2, 1, 2, 0},
+{1, 0, 0, 3, 1},
+{2, -2, 0, 0, -2},
+{2, 0, 0, 1, 0},
+{0, 4, 0, -2, 0},
+{1, 0, -1, 1, 1},
+{1, 1, 0, 1, 0},
+{2, 0, 0, 2, -1},
+{0, 0, 0, 2, 0},
+{2, -2, 0, 1, -2},
+{1, -4, 0, -1, 0},
+{1, -2, 1, 1, -2},
+{1, 0, 1, 2, 0},
+{1, -2, 2, 0, -1},
+{1, 4, -1, -1, -1},
+{1, -3, 0, 0, 1},
+{1, -1, 0, -1, -1},
+{1, 0, 1, -1, -2},
+{1, -4, 0, 1, 1},
+{1, 0, 1, 1, 1},
+{0, 2, -1, 0, -1},
+{1, -4, 0, 0, 1},
+{1, 1, 0, 0, 1},
+{1, 2, 1, 1, -1},
+{1, 4, 0, 1, -1},
+{0, 2, 1, -1, 0},
+{0, 0, 0, 1, -3},
+{0, 2, 0, -2, 1},
+{1, -4, 1, 0, 0},
+{2, 0, 0, -2, -1},
+{0, 1, 1, -1, 0},
+{0, 4, 0, -1, 0},
+{1, -1, -1, 0, -1},
+{1, 2, 1, 0, -2},
+{1, 4, 0, -1, -2},
+{1, 4, 0, 0, -2},
+{2, 0, 0, -1, -3},
+{0, 2, 1, 0, 0},
+{1, 0, -1, -1, -2},
+{1, 2, 0, 0, 2},
+{1, -4, 1, 1, -1},
+{1, 0, 0, -1, 3},
+{1, 0, 0, 4, -1},
+{1, 2, 1, -1, -1},
+{2, 0, 0, 2, -2},
+{1, -4, 0, 1, -2},
+{1, -3, 0, 0, 0},
+{1, -1, 0, 1, 0},
+{1, 0, 0, -4, -1},
+{1, 4, 0, -1, 1},
+{2, 0, 0, -2, -2},
+{2, -2, 0, -1, -1},
+{1, -2, 1, 1, 1},
+{0, 1, -1, 0, 0},
+{1, 0, 0, 1, 3},
+{1, 4, -1, 0, -1},
+{1, 0, 0, 2, 2},
+{1, 2, -2, 0, 0},
+{1, -4, 0, -1, -1},
+{1, 2, 0, 1, -3},
+{1, 4, 0, -2, 1},
+{1, -3, 0, 1, 0},
+{1, -2, 0, -2, -2},
+{1, 0, -1, -2, 0},
+{1, 0, 1, -2, 0},
+{1, 2, 0, 2, -2},
+{2, -2, 0, 0, 1},
+{2, -2, 1, 0, -1},
+{1, 0, 1, -1, 1},
+{1, -2, 0, 0, 3},
+{1, 0, 0, -3, 1},
+{1, 3, 0, -1, -1},
+{2, -2, 0, -1, 0},
+{0, 2, 0, 0, 1},
+{1, -2, -2, 0, 0},
+{1, -1, 0, 0, -2},
+{1, 2, -2, -1, 0},
+{1, 2, 0, -3, 0},
+{1, 4, -1, -1, 0},
+{1, -2, -1, -1, -1},
+{1, 2, 0, 3, -1},
+{1, -2, 2, 1, 0},
+{0, 2, -2, 0, 0},
+{1, 1, 0, -1, -1},
+{1, -2, 1, 0, 2},
+{0, 0, 2, 0, 0},
+{0, 2, -2, -1, 0},
+{0, 2, -1, 1, 0},
+{1, -4, 1, 0, -1},
+{1, 0, -1, 0, 1},
+{1, 2, -2, -1, -1},
+{1, 2, -1, 2, -1},
+{1, 2, 0, -2, 2},
+{0, 0, 1, 0, -1},
+{0, 0, 1, 0, 1},
+{1, 2, 0, -1, -3},
+{0, 2, 2, -1, 0},
+{1, -4, 0, -1, 1},
+{1, -2, -1, -1, 1},
+{1, -2, 0, -3, -1},
+{1, -2, 1, 2, -1},
+{1, 2, 0, 2, 1},
+{2, 0, 0, -2, 0},
+{0, 1, 0, -1, 0},
+{0, 2, 1, 0, -1},
+{1, -4, 0, 0, -2},
+{1, -4, 0, 0, 2},
+{1, -4, 0, 2, -2},
+{1, 0, 0, 1, -4},
+{1, 0, 0, 4, 0},
+{1, 2, 1, 1, 0},
+{1, -2, 0, -1, -3},
+{1, -2, 0, 3, 1},
+{1, -2, 1, -2, -1},
+{1, -2, 2, 1, -1},
+{1, 0, -1, -1, 1},
+{1, 4, -1, -2, -1},
+{0, 2, 0, 1, -1},
+{1, -4, -1, 1, 0},
+{1, -2, 1, -1, -2},
+{1, 0, 0, -1, -4},
+{1, 1, 1, -1, 0},
+{1, 2, -1, 1, -2},
+{1, 3, 0, -1, 0},
+{1, 4, -1, -2, 0},
+{0, 2, 0, 2, -2},
+{1, 0, -2, 1, -1},
+{1, 1, 1, 1, -1},
+{2, 0, 0, 0, -4},
+{2, 2, 0, 1, -2},
+{0, 0, 1, -2, 0},
+{0, 0, 0, 3, -1},
+{1, -2, -1, 0, 2},
+{1, -2, 0, -3, 0},
+{1, 0, 0, 3, -2},
+{1, 2, 0, -3, -2},
+{1, 4, 0, 1, 0},
+{2, -2, 0, 2, -1},
+{0, 1, 0, 1, 0},
+{0, 2, 0, -2, 2},
+{0, 2, 1, -2, 0},
+{1, -4, 1, 2, -1},
+{1, -3, 0, 1, -1},
+{1, -2, -1, 2, -1},
+{1, -2, 2, 0, 1},
+{1, -1, 0, 2, -1},
+{1, 1, 1, -1, -1},
+{1, 2, -1, -2, -1},
+{1, 2, -1, 1, 1},
+{1, 2, 0, 0, -3},
+{1, 2, 1, -1, 1},
+{1, 4, 0, 0, 1},
+{2, 2, 0, -1, 0},
+{0, 2, 0, 1, 0},
+{0, 2, -1, -2, 0},
+{0, 0, 1, 2, 0},
+{1, -4, -1, 0, 0},
+{1, -2, -1, 0, -2},
+{1, -2, 1, -2, 0},
+{1, 4, -1, 0, 0},
+{2, -2, -1, 0, -1},
+{2, 0, 0, -1, 1},
+{2, 2, 0, 1, -1},
+{0, 2, -1, -1, 1},
+{0, 2, -1, 0, 1},
+{0, 0, 1, 1, -2},
+{0, 1, 1, 1, 0},
+{0, 2, 0, -1, -2},
+{1, -2, 0, -3, 1},
+{1, -2, 0, 4, -1},
+{1, 0, -1, 3, -1},
+{1, 2, -2, 1, -1},
+{1, 2, 0, -4, -1},
+{1, 2, 0, -3, 1},
+{1, 2, 1, 0, 1},
+{1, 2, 2, -1, -1},
+{0, 0, 0, 0, 1},
+{0, 1, 0, 0, 1},
+{0, 2, 0, -2, -1},
+{1, -6, 0, 1, 0},
+{1, -2, -2, 1, 0},
+{1, -2, -1, 1, -2},
+{1, -2, 0, 4, 0},
+{1, -1, 0, 0, 2},
+{1, 0, -2, 1, 0},
+{1, 0, 0, -4, 0},
+{1, 2, 0, 3, 0},
+{1, 2, 2, -1, 0},
+{2, 0, 0, -2, 1},
+{2, 2, 0, 0, -3},
+{0, 2, -1, -1, -1},
+{0, 0, 1, -1, -1},
+{1, -3, 0, 0, -1},
+{1, -4, 0, 2, 1},
+{0, 2, -1, 1, -2},
+{1, -2, 1, -2, 1},
+{1, -2, 2, -1, -1},
+{1, -1, -1, -1, -1},
+{1, -1, 1, 0, -1},
+{1, 0, -1, 2, 1},
+{1, 0, 0, 2, -3},
+{1, 0, 1, -3, -1},
+{1, 0, 1, 2, 1},
+{1, 0, 1, 3, -1},
+{1, 0, 2, -1, -1},
+{1, 1, 0, 1, 1},
+{1, 1, 0, 2, -1},
+{1, 2, 0, -1, 3},
+{1, 4, 1, -1, -1},
+{1, 6, 0, -2, -1},
+{1, 6, 0, -1, -1},
+{2, -2, 0, -1, -2},
+{2, 1, 1, 0, -2},
+{2, 2, -1, 0, -2},
+{0, 0, 2, -1, 0},
+{0, 0, 0, 2, -3},
+{0, 1, 0, 0, -1},
+{0, 2, 0, 0, -3},
+{1, -6, 0, 2, 0},
+{1, -1, 0, 2, 0},
+{1, 0, -1, -2, -2},
+{1, 0, -1, 1, -2},
+{1, 0, 1, -2, -2},
+{1, 0, 2, -1, 0},
+{1, 1, 0, -2, 0},
+{1, 1, 1, 1, 0},
+{1, 2, -1, 2, 0},
+{1, 2, 0, 0, -4},
+{1, 2, 0, 1, 2},
+{1, 4, 0, 1, -2},
+{2, 2, -1, -1, -1},
+{0, 0, 1, -1, 1},
+{0, 0, 1, 1, 1},
+{0, 0, 1, 1, -1},
+{0, 1, 1, -1, -1},
+{0, 1, 1, 1, -1},
+{0, 1, 1, 0, -2},
+{1, 3, 0, 0, -1},
+{2, 0, 0, 2, 0},
+{0, 0, 0, 3, -2},
+{1, -6, 0, 1, -1},
+{1, -6, 0, 2, -1},
+{1, -3, 0, 1, 1},
+{1, -2, 1, 0, -3},
+{1, -2, 1, 2, 1},
+{1, -1, 0, -2, -1},
+{1, 0, -2, 0, -1},
+{1, 0, -1, -3, -1},
+{1, 0, -1, -2, 1},
+{1, 0, 0, -3, -3},
+{1, 0, 0, 0, -5},
+{1, 0, 1, -2, 1},
+{1, 0, 2, 0, -1},
+{1, 0, 2, 1, -1},
+{1, 1, -1, 0, -1},
+{1, 1, 0, -2, -1},
+{1, 1, 1, 0, 1},
+{1, 2, -1, -2, 1},
+{1, 2, 1, 2, -1},
+{1, 4, -1, 1, -1},
+{1, 4, 0, 2, -1},
+{1, 4, 1, 0, -1},
+{2, -2, 1, 0, 0},
+{2, 0, -1, 0, -2},
+{2, 2, 0, 0, 0},
+{0, 4, -1, -1, 0},
+{0, 0, 0, 0, 3},
+{0, 0, 0, 2, 1},
+{0, 1, 1, 0, 1},
+{0, 2, 0, 1, -3},
+{0, 4, 0, -2, 1},
+{1, -4, 0, -2, 0},
+{1, -4, 1, -1, 0},
+{1, -2, -1, -2, 0},
+{1, -2, -1, 2, 0},
+{1, -2, 0, 2, 2},
+{1, -2, 1, -1, 2},
+{1, -2, 2, -1, 0},
+{1, -1, 0, -1, -2},
+{1, 0, -2, -1, 0},
+{1, 0, -1, 3, 0},
+{1, 0, 0, -4, -2},
+{1, 0, 1, 0, -2},
+{1, 0, 1, 1, -2},
+{1, 1, 0, -1, 0},
+{1, 1, 0, 0, -2},
+{1, 2, -1, -1, -2},
+{1, 2, 1, 1, -2},
+{2, -4, 0, 1, -1},
+{2, -2, 0, 0, -3},
+{2, -2, 0, 1, -3},
+{2, -2, 1, 1, -1},
+{2, 0, -1, 0, -1},
+{2, 0, -1, 1, -1},
+{2, 0, 0, 0, 1},
+{2, 2, -1, 0, -1},
+{1, -1, 0, -1, 1},
+{1, -4, 1, 0, 1},
+{1, -2, -1, 1, 1},
+{1, -1, 0, 1, 1},
+{2, -2, 1, 0, -2},
+{1, -1, -1, 0, 1},
+{0, 0, 0, 2, 2},
+{0, 0, 0, 3, 0},
+{0, 2, -1, 0, -2},
+{0, 2, 1, 0, -2},
+{0, 4, -1, -2, 0},
+{0, 4, 0, -1, -2},
+{0, 4, 0, 0, -2},
+{0, 4, 0, 0, 0},
+{1, -4, -1, 1, -1},
+{1, -4, -1, 1, 1},
+{1, -4, 0, -2, -1},
+{1, -4, 0, 1, -3},
+{1, -4, 1, -1, -1},
+{1, -4, 1, 1, 1},
+{1, -3, 1, 0, 1},
+{1, -2, -2, 1, -1},
+{1, -2, -1, -2, -1},
+{1, -2, 1, 1, -3},
+{1, -2, 2, -1, 1},
+{1, 0, -2, -1, -1},
+{1, 0, 0, 2, 3},
+{1, 0, 0, 4, 1},
+{1, 1, 0, -1, 1},
+{1, 2, -2, 0, 1},
+{1, 2, 0, -2, -3},
+{1, 2, 0, 0, 3},
+{1, 2, 0, 2, -3},
+{1, 4, -2, -1, -1},
+{1, 4, -1, -1, 1},
+{1, 6, 0, 0, -1},
+{2, -2, 0, 1, 0},
+{2, 0, -1, 1, -2},
+{2, 0, 1, 0, -2},
+{2, 1, 0, 0, -2},
+{2, 2, -1, -1, -2},
+{0, 2, 0, 2, -1},
+{0, 4, 0, -1, 1},
+{1, -6, 0, 0, 0},
+{1, -4, 0, -1, -2},
+{1, -4, 1, 1, -2},
+{1, -4, 1, 2, 0},
+{1, -4, 2, 1, 0},
+{1, -3, -1, 0, 0},
+{1, -3, 0, -1, 0},
+{1, -3, 0, 2, 0},
+{1, -2, 0, -2, 2},
+{1, -2, 0, 1, -4},
+{1, -2, 0, 2, -2},
+{1, -2, 1, 3, 0},
+{1, -2, 2, 0, -2},
+{1, -2, 3, 0, 0},
+{1, -1, -1, -1, 0},
+{1, -1, -1, 0, -2},
+{1, -1, 0, -2, 0},
+{1, 0, -1, 0, -2},
+{1, 0, 0, 0, 4},
+{1, 0, 0, 3, 2},
+{1, 0, 1, 0, 2},
+{1, 0, 1, 3, 0},
+{1, 0, 2, 0, 0},
+{1, 0, 2, 1, 0},
+{1, 1, 0, 2, 0},
+{1, 2, -2, 0, -2},
+{1, 2, -2, 1, 0},
+{1, 2, -1, -2, -2},
+{1, 2, -1, -2, 0},
+{1, 2, -1, -1, 2},
+{1, 2, 1, -2, 0},
+{1, 3, 0, -2, 0},
+{1, 4, -1, -1, -2},
+{1, 4, -1, 0, -2},
+{1, 4, 1, -1, 0},
+{1, 6, 0, -2, 0},
+{2, -4, 0, 0, -1},
+{2, -1, 0, 0, -1},
+{2, 0, -1, -1, -1},
+{2, 0, 0, -2, -3},
+{2, 0, 0, 3, -1},
+{2, 0, 1, -1, -1},
+{2, 0, 1, 1, -1},
+{2, 1, 0, 0, -1},
+{2, 1, 1, -1, -1},
+{0, 0, 2, 1, 0},
+{0, 2, 1, 1, 0},
+{0, 2, -2, 0, -1},
+{0, 2, 0, -3, 0},
+{0, 2, 0, -1, 2},
+{1, -2, 0, -1, 3},
+{2, 1, 0, 0, 0},
+{1, -2, 0, 2, -3},
+{1, 2, 1, -2, -1},
+{2, 0, -1, 0, 0},
+{0, 0, 0, 4, 0},
+{0, 0, 1, -1, 2},
+{0, 1, -1, -1, 0},
+{0, 1, -1, 1, 0},
+{0, 1, 0, -2, 0},
+{0, 1, 0, 0, -2},
+{0, 2, 0, -3, 2},
+{0, 3, 0, -1, 0},
+{0, 4, 0, 1, -2},
+{1, -6, 0, 0, -1},
+{1, -6, 0, 3, -1},
+{1, -4, -1, 0, -1},
+{1, -4, 0, -2, 1},
+{1, -4, 0, 2, -3},
+{1, -4, 2, 0, -1},
+{1, -4, 2, 1, -1},
+{1, -2, -2, 1, 1},
+{1, -2, -1, -2, 1},
+{1, -2, 0, -2, -3},
+{1, -2, 0, 1, 3},
+{1, -2, 1, 3, -1},
+{1, -2, 3, 0, -1},
+{1, -1, -1, 1, -1},
+{1, -1, 0, 0, -3},
+{1, -1, 1, 0, 1},
+{1, 0, -1, -1, -3},
+{1, 0, -1, 0, -3},
+{1, 0, 0, -5, -1},
+{1, 0, 0, 5, -1},
+{1, 0, 1, -1, -3},
+{1, 2, -3, 0, -1},
+{1, 2, -2, -1, 1},
+{1, 2, -1, -3, -1},
+{1, 2, 0, 3, 1},
+{1, 2, 1, 1, 1},
+{1, 3, 0, -2, -1},
+{1, 3, 0, -1, 1},
+{1, 3, 1, -1, -1},
+{1, 3, 1, 0, -1},
+{1, 4, -2, 0, -1},
+{1, 4, -1, -2, 1},
+{1, 4, 0, -3, -1},
+{1, 4, 0, -3, 1},
+{1, 4, 0, 1, 1},
+{1, 6, 0, -3, -1},
+{2, -2, -1, 0, 0},
+{2, -2, 0, 2, -2},
+{2, -2, 1, 1, -2},
+{2, 0, 0, -1, -4},
+{2, 0, 1, 1, -2},
+{2, 4, 0, -1, -2},
+{0, 1, 1, -1, 1},
+{0, 2, 1, -1, -1},
+{0, 2, 2, 0, -1},
+{0, 4, 0, -1, -1},
+{0, 4, 0, 0, -1},
+{1, -4, 0, -1, 2},
+{1, -4, 1, 0, -2},
+{1, -4, 1, 2, -2},
+{1, -4, 2, 0, 0},
+{1, -3, 0, 0, 2},
+{1, -3, 1, 0, 0},
+{1, -2, -1, -1, -2},
+{1, -2, 0, -3, -2},
+{1, -2, 0, 0, -4},
+{1, -2, 1, -2, -2},
+{1, -2, 1, 1, 2},
+{1, -2, 2, 1, -2},
+{1, -2, 2, 2, 0},
+{1, 0, -1, -3, 0},
+{1, 0, 0, -2, -4},
+{1, 0, 1, -3, 0},
+{1, 0, 1, -1, 2},
+{1, 1, 0, 1, -2},
+{1, 1, 1, 0, -2},
+{1, 2, -1, 0, 2},
+{1, 2, 0, -4, 0},
+{1, 2, 0, -1, -4},
+{1, 2, 0, 3, -2},
+{1, 2, 1, -1, -2},
+{1, 2, 1, 2, 0},
+{1, 3, 0, 0, 0},
+{1, 4, -2, -1, 0},
+{1, 4, -1, 1, 0},
+{1, 4, 0, -3, 0},
+{1, 4, 0, -1, 2},
+{1, 4, 1, -2, 0},
+{1, 6, 0, -3, 0},
+{1, 6, 0, -1, 0},
+{2, -2, 0, -2, -1},
+{2, -2, 0, 1, 1},
+{2, 0, 0, -3, -1},
+{2, 4, 0, -1, -1},
+{0, 2, -2, 1, 0},
+{0, 4, -1, 0, 0},
+{0, 2, -1, 1, -1},
+};
+
+static const int8_t planet_arg[][12] = {
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -3, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -1, -1},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -2, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -2},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -3, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -2},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 1, -2},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 1, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 44, -42, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -2, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 0, -1},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 0, 2},
+{3, 0, 7, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -1, -1},
+{0, 0, 20, -16, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -2, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 35, -31, 0, 0, -3, 0, 0, -1, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -2, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -2, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -3, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -2, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, 2},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 0, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 2},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 2, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, -28, 26, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 0, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -1, 1},
+{0, 0, 2, 0, -5, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -22, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 0, 0, 1, 0, -2, 0, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -4, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 7, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 1, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 1},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 0, 1},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 15, -14, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{2, -2, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -3, 0, 0, -3, 0, 0, 2, 0, -2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{4, -15, 6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 1, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 47, -52, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -2, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, 3},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 38, -37, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, -2, 1, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 7, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, -24, 21, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -3, -2},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -4, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 4, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -4, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 4, 0, 0, -4},
+{0, 2, -7, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 20, -15, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{5, 0, -13, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 1, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 29, -33, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 2, -2},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 41, -42, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 20, -19, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 28, -31, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 2},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 0, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 0, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{3, 0, -2, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -2},
+{0, 0, 0, 0, 0, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 0, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -1, -1},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, -1},
+{0, 0, 0, 0, 1, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, 0, 1, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -4, 4, -2, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, 1, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, -2, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 4, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 2, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -2, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, -1, -3},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 2, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 4, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -3, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 3, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, -2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 8, -13, 0, -1, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 27, -20, -20, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 2, -6, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 2, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 4, -15, 14, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 0, -4},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, -1, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 32, -28, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 0, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1, 1},
+{0, 0, 0, 0, 2, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, -2, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -5, 0},
+{0, 24, -27, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, -1},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -4, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 2, -2, -1, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -6, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, 0, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 1, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 10, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, -2, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{6, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -3, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, 7, -19, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 1, -3},
+{0, 9, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -3, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 2, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, 0, -2, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, 43, -59, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 21, -23, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -28, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{4, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{6, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, -2, 3, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 8, -13, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 5, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 3, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 7, -10, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -1, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -3, 0, 3, -1},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 34, -41, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 13, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -2, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, 2, -7, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -3, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -3},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, 2},
+{0, 4, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, 0, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 0, 2},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 0, -2},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 10, -15, 1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 42, -54, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 20, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{5, -4, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 10, -17, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, -2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -4, 4, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 2, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 34, -41, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -18, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 20, -18, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, -2, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, -4, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 2, 0, -2, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 23, -25, -4, 0, 0, 0, 0, -3, 0, 0, 2},
+{0, 23, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -26, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -2, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 2, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 11, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, -3},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 2},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -1, 2},
+{0, 6, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -5, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -3, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 3, 0, -3, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 34, -39, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 1, -2, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -4, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{2, 16, -20, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, -3},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 4, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, -2},
+{0, 12, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 11, -19, 0, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -6, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, 0, 0, 0, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 5, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -7, -3, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -2, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 24, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{4, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{12, 0, -12, 0, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -1, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -1, -1},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 0, 0, 1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, 2, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, -2, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 37, -48, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 17, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 20, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 23, -22, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -34, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 38, -37, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -1, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, -3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -9, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 14, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, -1},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 1, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 0, 0, -1, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -4, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, -2, -4, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{2, -2, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 1, 0, 0, -4, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, -2},
+{0, 0, 1, 0, 2, -5, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 1, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 9, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 0, -1},
+{0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 5, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 2, 0, -1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -4, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 21, -18, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 30, -33, -3, 0, 0, 0, -1, 0, -1, 1},
+{0, 2, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 7, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 13, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 25, -25, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 28, -33, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, -1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, 3},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -1, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 1, -2},
+{0, 0, 6, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -1, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 1, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 4, 0, -1, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -4, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 4, -10, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -3, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, 0, -6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, -1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 1, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 28, -31, 0, 0, -3, 0, -2, 0, 1, 0},
+{0, 0, 44, -56, 1, 0, 0, 0, 1, 0, -1, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -5, 0, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 3, 5, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 5, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 6, -8, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 2, 0, 0, 0, 4, 0, -4, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 10, -6, 0, 0, 0, 0, 0, -3, 0, 0, 2},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 14, -11, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 37, -37, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 2, -3, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 4, -10, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -3, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 0, 1},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 3},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -4, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -1, 1},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 7, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, -4, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -4, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -4, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -4, 4, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -4, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, 0, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -16, 6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -16, 6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 1, 2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 2, 1, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 9, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 2, 2},
+{0, 16, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 26, -26, 0, 0, 0, 0, 0, 3, 0, -2, -2},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, -2, -1},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 31, -36, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 49, -55, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -12, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 1, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, -1, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -1, 1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, -1},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, -2, 0, 0, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 4, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 3, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 1, 0, 0, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, -2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 2, -4, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 2, 0, -2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, -4, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 6, -8, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, 0, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, -5, 0, 0, 0, -2, 0, -2, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 0, -2},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 2, -2},
+{0, 15, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 18, -13, -7, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 24, -24, 0, 0, 0, 0, 0, 4, 0, -4, 0},
+{0, 34, -30, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -39, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, 1, -3, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -3, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 0, -3},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -4, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -2, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 17, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 17, -16, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 1, 2},
+{0, 8, -8, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 1, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 0, 0, 2, -4, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 2, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -8, 1, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -7, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, 0, -6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -4, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, 6, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 3, -2, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, 30, -44, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -8, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 1, -2},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 8, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -13, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 21, -20, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -23, 0, -1, 0, 0, 0, 1, 0, -1, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 33, -39, 0, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 39, -36, -5, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, -15, 6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{4, -15, 6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{7, 0, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 16, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 13, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, -1, 3, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -12, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -10, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 10, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 13, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -4, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, -1, -2},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -3, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, 2, 0, 0, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, 2, 0, 0, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, -2},
+{0, 8, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 0, 0, 3, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, -4, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 2, -6, 3, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -4, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 2, 0, -2, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -8, 1, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -6, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 6, -8, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, 0, -6, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 20, -16, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 23, -20, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -5, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 1, 0, -1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -7, 7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -7, 7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -7, 7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 2, -3, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 2, -2},
+{0, 2, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, 1, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, 1, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, -6, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -6, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -6, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 6, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 8, -16, 0, 0, 0, 0, 0, -3, 0, 1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 8, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -9, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -8, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, -1, 2},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 1, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -22, 0, -1, 0, 0, 0, -3, 0, 1, 1},
+{0, 20, -22, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 1, -3},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 21, -23, 2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 23, -24, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 24, -30, 6, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 24, -25, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 46, -49, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{1, 0, -10, 11, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 2, 0, 0, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{5, -32, 18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 22, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 1, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 2, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, -2, 4, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -3, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -3, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -3, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 1, -3},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 1, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 1, 3},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, 1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, -1},
+{0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 2, -4, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, 0, -7, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 0, 0, 2, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 1, 0, -3, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, -2, 2, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 2, -6, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -2, -2},
+{0, 0, 2, 0, -1, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 7, -10, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 4, 0, -1, -4},
+{0, 0, 9, -9, 0, 0, 0, 0, 4, 0, 1, -4},
+{0, 0, 10, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -16, 4, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 23, -20, 2, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 37, -46, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 48, -67, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 2, -7, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -6, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 5, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 6, -6, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 6, -2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -8, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -6, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 8, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -9, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -2, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -11, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -6, -11, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 17, -16, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 17, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -8, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -17, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 18, -17, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -18, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 19, -18, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 20, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -20, -3, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 22, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 23, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 25, -25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 28, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -34, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 30, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -42, 0, 0, 0, 0, 0, -1, 0, 0, -3},
+{0, 43, -42, 0, 0, 0, 0, 0, 3, 0, 0, -3},
+{0, 46, -50, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{3, 13, -20, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{4, -5, 3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{4, 3, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 0, 2, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 10, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, 0, -2, 6, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, 0, 1, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 8, -17, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 1, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 3, -4, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 7, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 14, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 39, -36, -5, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 39, -36, -5, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 44, -42, -9, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 44, -42, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{1, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 10, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 2, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -4, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 1, 1},
+{0, 0, 1, 0, 0, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -8, 1, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -16, 6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -16, 6, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, 1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 0, 0, 0, 0, 1, -2, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -5, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 1, 0, -3, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, -2, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 1, 0, -1, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, -3, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, -6, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -5, 6, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 2, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -2, 2},
+{0, 0, 2, 0, -1, -5, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 0, 0, 0, -2, 2, 0, -1, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 2, -8, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -8, 1, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -8, 1, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 5, 0, -4, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 5, -8, 1, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -16, 4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, -2, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -12, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 8, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 14, -23, 4, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 20, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 26, -22, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 44, -61, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -5, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 1, -1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -5, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 27, -28, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 3, -3, 0, 0, -1, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 4, -49, 55, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 4, -3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 5, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -9, 3, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, -4},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 6, -10, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 6, -8, 0, 0, 1, 0, 0, 2, 0, -2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -19, 11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 7, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 7, -5, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -12, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -8, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -8, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 9, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 9, -9, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -9, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -3, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -18, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -11, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 12, -8, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -11, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -20, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 15, -9, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -5, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -20, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -15, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -21, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 21, -23, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 22, -22, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 23, -26, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 24, -26, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 26, -31, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -26, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -30, 0, 0, 0, 0, 0, 4, 0, -3, -2},
+{0, 31, -39, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 33, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -32, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -31, 0, 0, -3, 0, 0, -1, 0, -1, -1},
+{0, 35, -31, 0, 0, -3, 0, 0, -1, 0, 1, -1},
+{0, 40, -40, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -42, 0, 0, 0, 0, 0, -1, 0, 1, -3},
+{0, 43, -42, 0, 0, 0, 0, 0, 3, 0, -1, -3},
+{0, 44, -45, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{1, -35, 28, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, 21, -25, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 12, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 5, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 31, -37, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 34, -42, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -28, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 3, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -4, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -3, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -5, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 2, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -2, -1},
+{0, 0, 8, -9, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -14, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 0, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 0, 1},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 20, -16, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 20, -16, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 11, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 0, 3},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -2, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{3, 0, 7, -15, 0, 0, 0, 0, -2, 0, 1, -1},
+{3, 0, 7, -15, 0, 0, 0, 0, -2, 0, 1, 1},
+{4, -5, 3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{4, -5, 3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 0, 6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -16, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -14, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 1, 0, 1, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{1, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 0, 2},
+{0, 25, -26, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 27, -27, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -3, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 2},
+{0, 0, 1, 0, -4, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -7, 7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -7, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 11, -11, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 15, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 4, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, -3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 1, -2, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -2, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -3, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -2, 1},
+{0, 0, 1, 0, -2, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, -2, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 1, -2, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, 1, -1, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 1, -1},
+{0, 0, 1, 0, 2, -6, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, 2, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -6, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -4, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, -4, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -4, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -4, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 4, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -4, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -4, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -4, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, 0, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 4, -3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, 0, -6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -6, 0, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -16, 4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 6, -10, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 3, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 8, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -4, 0, 1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -1, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 4, 0, -1, 0},
+{0, 0, 10, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -16, 4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -8, 12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -4, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -3, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 1, -3, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 1, -1, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -7, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 2, 4, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 4, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 21, -26, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 3, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 2, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -12, 7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -8, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -4, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -10, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 8, -14, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 8, -12, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, 0, 0, 3, 0, 0, 2, 0, 0, -2},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -15, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -12, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 10, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 10, -10, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 11, -11, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -10, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 12, -9, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 12, -6, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -10, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 14, -11, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -7, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -15, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -10, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 16, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 16, -17, 8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -16, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, -1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -17, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -14, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -21, 6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -17, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, -1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 18, -16, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -4, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, -4},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -1, 4},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -16, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -29, 15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 20, -19, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 20, -19, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 21, -20, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 22, -26, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, -2, 0, 0, 0, 0, 0, 1, -2},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 23, -26, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -24, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -24, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 24, -28, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -29, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -32, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 30, -24, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 36, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -38, 0, -1, 0, 0, 0, -3, 0, 0, 1},
+{0, 43, -45, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{5, 0, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{6, -39, 27, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{9, -1, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 13, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 26, -24, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 31, -37, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 3, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 1, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 1, 0, -1, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -6, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -8, 1, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, 0, -6, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, -1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 1, 1},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 9, -11, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 1, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, -1, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 35, -31, 0, 0, -3, 0, 0, -1, 0, 0, -2},
+{0, 35, -31, 0, 0, -3, 0, 0, -1, 0, 0, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 7, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -18, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -26, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 15, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 34, -42, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 30, -36, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -2, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 1},
+{0, 0, 3, 0, 0, -4, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -13, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 2, 1, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 1, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 13, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 25, -25, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -1, -2},
+{0, 12, -12, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 3, -4, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 0, 1, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 1, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -6, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 11, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 14, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 28, -28, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 2, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 3, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 4, -11, 3, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 3, -1},
+{0, 0, 0, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, -2, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -2, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, -5, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -4, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, -2, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, -3, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, -2, 1},
+{0, 0, 1, 0, -2, 1, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 1, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 2, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 1, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, 0, 2, -7, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 2, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 2, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -6, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -4, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -6, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -5, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -2, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, 0, -2, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -1, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, 1, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, -6, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, 0, -6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -6, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 5, 0, -3, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 3, 0, -3, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 3, 0, -3, 1, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, 0, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -4, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 4, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, 0, 0, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, 0, -7, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -12, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 6, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -17, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 8, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -1, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 1, 0, -1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 8, -15, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -4, 0, 2, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, 0, 2},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 0, -2},
+{0, 0, 10, -19, 0, 3, 0, 0, 4, 0, -2, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 17, -28, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 32, -35, 0, -4, 0, 0, 0, 0, -1, 0},
+{0, 0, 48, -69, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -11, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 1, -7, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -6, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -5, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 3, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -7, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -5, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, -4, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 2, -3, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 4, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 2, 3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 4, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -8, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -8, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -3, 0, 0, -3, 0, 0, 2, 0, -3, 0},
+{0, 3, -3, 0, 0, -3, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 2, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -4, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -2, 2},
+{0, 3, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, 1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 4, -6, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -5, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 4, -4, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 4, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 5, -8, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 5, -5, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -12, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -11, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 6, -6, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -19, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -19, 11, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -11, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -7, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 8, -12, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -9, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -17, 0, 3, 0, 0, 0, -2, 0, 0, 2},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 9, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 9, -7, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -4, 0, 0, -1, 0, 0, -3, 0, 2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -17, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 11, -6, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -5, 0, -4, 0, 0, 0, -1, 0, 1, -1},
+{0, 12, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 12, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -8, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 12, -7, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 13, -12, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 14, -12, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -12, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -11, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -9, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 15, -14, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 15, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 16, -21, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -13, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -16, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 3, -1},
+{0, 17, -16, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -15, 0, 0, -2, 0, 0, -1, 0, 1, -1},
+{0, 17, -14, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -14, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -14, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 17, -13, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -22, 8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -18, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, -2, 0, 0, -1, 0, -1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 18, -16, -2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 18, -13, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -20, 3, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -19, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 20, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -21, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 20, -19, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -12, -15, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 20, -12, -15, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 20, -12, -15, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 20, -12, -15, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 21, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, 4, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 21, -21, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -16, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -24, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 22, -20, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -14, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -27, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -27, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 23, -24, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 23, -19, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 25, -30, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 2, -3},
+{0, 25, -21, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -31, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -32, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -30, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 29, -34, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 29, -34, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 30, -35, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -37, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -35, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 38, -28, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -36, -3, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 45, -50, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 55, -65, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 61, -61, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{1, -28, 26, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{1, -28, 26, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{2, -56, 58, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, -7, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{4, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{4, 0, -3, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{4, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{4, 0, -3, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{6, 0, -3, 0, 0, 0, 0, 0, -5, 0, 2, 1},
+{11, 0, -22, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 24, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -29, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 4, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 9, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -32, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 3, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 1, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, -4, 2, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, 1, -1, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, -2},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, -3},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -1, 3},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 3, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 2, -2},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, -1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, -5, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, 0, -1, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 1, -1},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 1, 1},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 2, -4, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 2, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, -1, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -3, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -2, -3},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -5, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -4, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 4, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, -5, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 4, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 26, -20, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 1, -5, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -10, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 3, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, -1, 1},
+{0, 0, 1, 0, 0, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 8, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, -2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -5, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 2, -7, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 6, -11, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 14, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 15, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 0, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, -2, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 0, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 0, 2},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 0, 3, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 2, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, -4, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 1, -2, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, -6, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -5, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -5, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -5, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 0, -4, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, -3, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 1, 0, -2, 3, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -2, 5, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 4, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -4, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 4, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, 5, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, -4, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, -2, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, -1, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 2, -7, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, 2, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -3, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 3, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 4, -10, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 4, -10, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 2, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 2, -8, 3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, -6, 0, 4, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 2, -3, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 2, 0, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -4, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -4, 4, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, 0, -3, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -2, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -3, -2},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -2, -2},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, -1, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, -1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -3, 0, -1, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 2, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 2, 0, -2, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -1, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 0, -7, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, 2, -8, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, -9, 0, 0, 1, 0, -2, 0, 2, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, 0, -4, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -4, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, 0, -1, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, 3, 0, -2, -1},
+{0, 0, 3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -6, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -6, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -6, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -7, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, -2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -8, 3, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 5, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 0, 6, -7, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 6, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, 0, -7, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -17, 0, -2, 0, 0, -2, 0, 0, 2},
+{0, 0, 7, -16, 4, 5, 0, 0, 4, 0, -1, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -12, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 9, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -15, 1, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 10, -15, 1, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 10, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 17, -32, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 30, -35, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 31, -34, 0, 0, 0, 0, 0, 0, -3, 2},
+{0, 0, 33, -40, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -3, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 1, -2, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 4, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 1, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 5, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -8, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -7, 3, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 2, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -5, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, -4, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 2, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -1, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, 0, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 2, 0, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 1, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -8, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -6, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -6, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -5, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 3, -5, 0, 0, 2, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 2, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 5, 0, -2, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 3, -3, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 4, -5, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -5, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -5, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -5, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 4, -3, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, 1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -13, 6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -13, 6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -11, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -11, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 5, -8, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, -4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 5, -7, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 3, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -12, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -12, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -11, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -10, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 6, -4, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -13, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -13, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -8, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, 4, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -14, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 8, -6, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -15, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -14, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -14, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 9, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 9, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -1, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -12, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 10, -11, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -11, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 10, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -17, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 11, -11, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -9, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -8, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -12, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 12, -9, 0, -1, 0, 0, 0, -3, 0, 1, 1},
+{0, 12, -8, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, -1, 0, -2, 0, 1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 13, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -22, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 13, -19, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -18, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 13, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 13, -10, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -21, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 14, -21, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 14, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -3, 0, 2, 1},
+{0, 15, -13, 0, -3, 0, 0, 0, -2, 0, -1, 2},
+{0, 15, -13, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -15, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 16, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -22, 11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -22, 11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 17, -16, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 17, -15, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -15, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -14, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 18, -18, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, -2, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 18, -17, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -3, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -4, 0},
+{0, 18, -16, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 18, -15, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -3, 0, -1, 1},
+{0, 19, -24, 10, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 19, -24, 10, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 19, -24, 10, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 19, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -20, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 19, -7, -20, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, -1, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 20, -19, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -19, 0, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 21, -29, 15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 21, -23, 0, 0, 0, 1, 0, -2, 0, -2, 2},
+{0, 21, -23, 0, 0, 0, 1, 0, -2, 0, 0, 2},
+{0, 21, -22, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, 0, 2, 0, 0, -1, 0, -1, 1},
+{0, 21, -22, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -21, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 22, -27, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -24, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 23, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -27, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -24, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 23, -22, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 23, -22, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 23, -22, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 24, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -26, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -5, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 26, -32, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -32, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -32, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -29, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 26, -28, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 27, -33, 0, 7, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -31, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 28, -30, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 29, -36, 0, 4, 0, 0, 0, -2, 0, 1, 0},
+{0, 30, -36, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -39, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -31, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -29, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -35, 0, 2, 0, 0, 0, -3, 0, 0, 1},
+{0, 36, -32, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 38, -37, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, 0, 0, -2, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -36, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 39, -39, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -41, 0, -2, 0, 0, 0, -3, 0, 1, 0},
+{0, 40, -38, 0, -2, 0, 0, 0, 0, 0, 0, -2},
+{0, 41, -43, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 41, -42, 0, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 41, -42, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 42, -42, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -45, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 47, -52, 0, 4, 0, 0, 0, -2, 0, -1, 0},
+{0, 47, -52, 0, 4, 0, 0, 0, -2, 0, 1, 0},
+{1, -43, 41, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, -20, 16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{1, -20, 17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 1, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{1, 18, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, -22, 16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -8, 3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{2, -4, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{2, -4, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, 0, 17, -26, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 19, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{4, 0, -6, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{4, 0, -2, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{4, 11, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 17, -30, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 4, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 10, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 31, -37, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 5, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 29, -31, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -41, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 29, -29, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -33, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 1, -1, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 1, -1, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -2, 2},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -2, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, 0, 0, -3, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 2, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 2, -6, 3, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 2, 0, -5, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -5, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -3, 1},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 3, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -4, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -2, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, -6, 2, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 3, 0, -6, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 3, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, -5, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -11, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 5, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -6, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, -1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 9, -10, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 4, 0, 0, -5},
+{0, 0, 9, -9, 0, 0, 0, 0, 4, 0, 0, -3},
+{0, 0, 10, -16, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 11, -16, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 11, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 11, -14, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 11, -12, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 2, -2, 0, -3, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 2, -1, 0, -2, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -1, 0, -2, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 1, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 1, 1},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, -1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 3, -4, 0, 2, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 0, -3},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 5, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, -1, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 1, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 6, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 17, -22, 11, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 17, -22, 11, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 19, -20, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 1, -2},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 2, -2},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 21, -23, 0, 0, 0, 1, 0, -2, 0, -1, 1},
+{0, 21, -23, 0, 0, 0, 1, 0, -2, 0, -1, 3},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 1, -4},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{1, -28, 26, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{1, -28, 26, 0, 0, 0, 0, 0, -2, 0, 1, 3},
+{1, -7, 9, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{1, -7, 9, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 6, -13, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -14, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -16, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -16, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 7, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -18, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -18, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 15, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 15, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 15, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 22, -20, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 33, -40, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 38, -50, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 39, -52, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 42, -54, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -13, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -17, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 21, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -29, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -32, 0, 0, 0, 0, 0, -3, 0, 0, 2},
+{0, 26, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -39, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -39, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 31, -37, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 39, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -45, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -50, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 4, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, 4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, 3, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, 0, 3, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 1, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, -2, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -2, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -2, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -1, -1},
+{0, 0, 0, 0, 2, -6, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -2, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, -6, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, 0, -4, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, 0, -7, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, -6, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 2, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 13, -13, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, -6, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -8, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 2, -4, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 2, 0, -2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, -2, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 5, -5, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -2, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 7, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 17, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 15, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 7, -7, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 12, -13, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 27, -28, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0},
+{0, 0, 0, 0, 0, 2, -3, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 0, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 4, -8, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -7, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 4, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 1, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, -1, -3},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 3, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, -4, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, -1, 3, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -5, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -4, 3, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -4, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, -3, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 1, 0, -2, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 6, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 2, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 1, 0, -1, 4, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 0, -4, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -4, 0, 0, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 2, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, -2},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -2},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 2},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 3, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 1, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 1, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, -3, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 1, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, -3},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, 0, 2, -8, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 2, -7, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 2, -7, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -6, 3, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, 2, -3, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, -3, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 3, -5, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -8, 5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, -4, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, -2, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -7, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -7, 10, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -6, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -6, 8, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -5, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, -4, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, 0, -4, 2, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -4, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -4, 6, -3, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, -5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -3, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, 0, 0},
+{0, 0, 2, 0, -2, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, -1, -3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -1, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -1, 2},
+{0, 0, 2, 0, 0, -6, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -6, 3, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 0, 0, -3, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, -3, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, -3, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, -1, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, 0, 2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 3, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 4, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 4, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -9, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 3, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -6, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -6, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -2, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, 0, -6, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, 0, -4, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -4, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -4, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 3, 0, -3, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 5, 0, -3, -1},
+{0, 0, 3, 0, -1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, 2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 2, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, 0, -4, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, 0, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -10, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 5, -6, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -6, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 5, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -16, 4, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 6, -8, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 7, -12, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, 0, -7, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -19, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 8, -19, 0, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 1, -2},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -1, 2},
+{0, 0, 8, -15, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -4, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 9, -14, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -4, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, -2, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, 2, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 4, 0, 0, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -16, 4, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -15, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, -2, 0, -1, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -19, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 14, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -17, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -21, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 19, -17, -3, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 28, -31, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 29, -33, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 29, -33, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 29, -32, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 30, -33, -1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 37, -48, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 37, -45, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 40, -48, -2, 0, 0, 0, 1, 0, -1, -1},
+{0, 1, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -6, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 1, -5, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -5, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -4, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, -4, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -4, 0, 3, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, -4, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -4, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -4, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -3, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -2, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 1, 0, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 1, 0, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 1, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 1, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 1, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 1, 1, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 3, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 1, 4, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 4, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 4, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 5, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -8, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -8, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -6, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -6, 8, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -5, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -5, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -4, 4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -4, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 2, -3, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -3, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -2, 0, 0, -1, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -6, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 2, -2, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -2, 1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, 0, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 2, 1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, 2, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 4, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -9, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 0, 0, 1, 0, 0, -2, 0, 3, 0},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -7, 0, 4, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, -6, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, -6, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -6, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, 2, 0, -1, 0},
+{0, 3, -5, 0, 4, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 5, 0, -1, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -1, 2},
+{0, 3, -3, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -2, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -2, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 5, 0, -2, -1},
+{0, 3, -1, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -1, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, 1, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 1, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 1, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, 5, -15, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 5, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -10, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -9, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -9, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 4, -8, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -6, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -6, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -6, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 4, -5, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 4, -4, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -3, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 4, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -2, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -1, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 0, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -11, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -11, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -10, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, 0, 3, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -9, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -9, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -8, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -8, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -8, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -8, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -8, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -8, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 5, -7, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -7, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -7, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -7, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -6, -2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -1, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -12, 0, 0, 4, 0, 0, -2, 0, 0, 2},
+{0, 6, -12, 0, 4, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -11, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -10, 0, -1, 0, 0, 0, 0, 0, -2, 2},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -10, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -10, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -10, 0, 4, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -9, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -9, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -9, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -4, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 6, -8, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -8, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -6, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 6, -6, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 6, -4, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, 0, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -14, 5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -14, 5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -13, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -13, 0, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -13, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -12, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -11, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -11, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -11, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -11, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -11, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 7, -10, 0, 4, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 7, -9, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -9, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -8, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -8, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 7, -7, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 7, -6, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 7, -5, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -4, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 8, -15, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -14, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -13, 2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -12, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -11, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -10, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -10, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -9, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -9, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -1, 0, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -15, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -15, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -15, 0, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -15, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -14, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -14, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -13, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -13, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -3, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 9, 8, -21, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -14, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -12, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 10, -11, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -7, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -6, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 11, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -20, 0, 4, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -17, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -15, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -15, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 11, -12, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 11, -12, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -9, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -3, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -18, 0, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -18, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -15, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 12, -12, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -12, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -10, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -9, 0, -3, 0, 0, 0, -3, 0, 0, 2},
+{0, 12, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, -2, 0, -2, 0, 0, 0},
+{0, 12, -8, 0, 0, 0, -2, 0, -2, 0, 2, 0},
+{0, 12, -8, 0, 0, 0, 0, -2, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -8, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -7, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -7, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -6, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -19, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 13, -16, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -14, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 13, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -13, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 13, -11, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -11, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -10, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 13, -10, 2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 13, -8, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -7, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 14, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 14, -13, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 14, -12, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -11, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -11, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 14, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -10, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -9, 3, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 15, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -19, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 15, -13, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 15, -12, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, 0, -2, 0, 0, 0, -1, 0, 1, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 15, -11, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -11, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -11, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -10, 0, 0, -2, 0, 0, 1, 0, -1, -1},
+{0, 15, -9, -6, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 15, -6, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -5, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -18, 6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -17, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 16, -16, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 16, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 16, -13, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -13, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -13, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -12, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -12, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -12, 0, -5, 0, 0, 0, 0, 0, 1, -2},
+{0, 16, -8, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -23, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 17, -21, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 17, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -18, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -17, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -17, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -16, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -16, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 17, -16, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, 0, 0, -3, 0, 0, -1, 0, 1, -1},
+{0, 17, -15, 0, 0, -1, 0, 0, -1, 0, 1, -1},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -14, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -14, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -14, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -14, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -14, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 17, -13, 0, -4, 0, 0, 0, 1, 0, -1, -1},
+{0, 17, -5, -19, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -20, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -19, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -18, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 18, -18, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -17, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 18, -16, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -16, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, -1, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 0, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -3, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -3, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -2, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -4, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 18, -16, 2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 18, -14, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 19, -24, 8, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 19, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -21, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -21, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -21, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 19, -21, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -20, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -20, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -20, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -18, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -18, -1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -18, 0, -4, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -18, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 19, -18, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 19, -17, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 19, -16, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -16, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -15, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 19, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -25, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -23, 7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -21, 0, 0, 0, -3, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, -2, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 4, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 20, -21, 0, 0, 0, 0, 2, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 1, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 2, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 20, -20, 0, 0, 0, 2, 0, -1, 0, 1, -1},
+{0, 20, -20, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -19, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -19, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -19, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -19, -2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 20, -19, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 20, -18, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -18, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -18, 0, -2, 0, 0, 0, 1, 0, -1, -1},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 20, -17, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 20, -15, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -15, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -26, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -25, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 21, -24, 6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -23, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 21, -22, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, 1, 0, 0, 0, -1, 0, -1, 1},
+{0, 21, -22, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 21, -21, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -21, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -21, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 21, -21, 0, 0, 3, 0, 0, 0, 0, -1, 0},
+{0, 21, -20, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 21, -20, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 21, -20, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 21, -20, 0, 2, 0, 0, 0, 1, 0, -1, -1},
+{0, 21, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -19, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 21, -19, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 22, -28, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -28, 7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -27, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -27, 5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -25, 0, -2, 0, 0, 0, -3, 0, 2, 0},
+{0, 22, -25, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -25, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -24, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -23, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -23, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 22, -23, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -22, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -21, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 23, -28, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -28, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -28, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -27, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -26, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -26, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -25, 0, -2, 0, 0, 0, -1, 0, -1, 1},
+{0, 23, -25, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -24, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 23, -22, -2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 23, -22, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 23, -22, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 23, -21, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -30, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -30, 8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -29, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -29, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -28, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -27, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -27, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -26, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -22, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -31, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -31, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -30, 5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -29, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -27, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 25, -26, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 25, -25, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 25, -21, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -35, 8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -31, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 26, -30, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -29, -4, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 26, -29, 0, 0, 0, 0, -2, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, -1, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 26, -29, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 26, -29, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 27, -34, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -33, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -33, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -32, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -32, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 27, -31, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -31, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -19, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -35, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -35, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 28, -34, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 28, -34, 0, 0, 0, -1, 0, -2, 0, 1, 0},
+{0, 28, -32, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -31, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 29, -36, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -36, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -34, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 29, -34, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 29, -33, 0, 2, 0, 0, 0, -1, 0, -1, -1},
+{0, 29, -33, 0, 2, 0, 0, 0, -1, 0, 0, -1},
+{0, 29, -33, 0, 2, 0, 0, 0, 3, 0, -2, -1},
+{0, 29, -33, 0, 2, 0, 0, 0, 3, 0, -1, -1},
+{0, 29, -24, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 30, -37, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 30, -25, 0, -1, 0, 0, 0, -3, 0, 0, 1},
+{0, 31, -39, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 31, -39, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -37, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -39, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 32, -27, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -42, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 33, -30, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -46, 0, 7, 0, 0, 0, -2, 0, 1, 0},
+{0, 35, -40, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -33, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -30, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -34, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -29, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 37, -35, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -45, 15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, 0, 0, -3, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 38, -37, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 38, -36, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -43, 5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -40, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -40, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -40, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 41, -42, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 41, -42, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 41, -41, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 42, -44, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -51, 11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -43, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 43, -42, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -51, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 50, -56, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 51, -58, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 52, -60, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 59, -58, 0, 1, 0, 0, 0, -2, 0, -1, 0},
+{1, -30, 33, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -25, 25, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{1, -25, 25, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -25, 25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 0, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{1, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 1, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{1, 1, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 10, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 15, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 15, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{1, 15, -16, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{1, 15, -16, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{1, 15, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{1, 15, -16, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{1, 23, -30, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 23, -29, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{1, 36, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{2, -42, 37, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{2, -33, 32, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{2, -28, 24, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{2, -27, 22, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{2, -27, 24, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -25, 20, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{2, -24, 21, 0, 0, 0, 0, 0, 4, 0, -4, 0},
+{2, -24, 21, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{2, -4, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{2, -2, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, -2, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{2, 0, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{2, 8, -7, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{2, 13, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{2, 13, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{2, 14, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 14, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 18, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 34, -39, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, -29, 18, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{4, 0, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{4, 5, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{5, -12, 12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{5, 0, -13, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{5, 0, -13, 7, 0, 0, 0, 0, -2, 0, 2, 0},
+{5, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{5, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{7, 0, -4, 0, -4, 0, 0, 0, -2, 0, 0, 0},
+{7, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{8, -4, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 3, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 3, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -22, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -20, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 14, -15, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 15, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 22, -27, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -28, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 24, -29, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -27, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -19, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 14, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 2, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 24, -27, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 37, -36, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -3, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 3, 1},
+{0, 0, 0, 0, 2, -3, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, -5, 5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -4, 5, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, -1, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, 0, -2},
+{0, 0, 1, 0, -1, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, -2, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, -1, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 3},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 1, 0, -1, 2, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 1, 0, 0, -5, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 3, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 1, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, -2},
+{0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 1, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -2, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 1, 0},
+{0, 0, 1, 0, 2, -8, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, -4, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, -2, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -5, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -4, 2, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -3, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -2, -3},
+{0, 0, 2, 0, -2, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -1, -1},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 3, -2},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 3, 0, -5, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -2, -2},
+{0, 0, 3, 0, 0, -4, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, 0, -2, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, 0, -3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -12, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 0, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -2, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 2, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 8, -14, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -13, 0, -1, 0, 0, 1, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 8, -7, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -15, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -9, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 10, -11, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -19, 0, 3, 0, 0, -2, 0, 0, 1},
+{0, 0, 11, -15, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 12, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 1, 0, 0, -2, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, 1, -3, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 2, -3},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 2, -1},
+{0, 2, -3, 0, 2, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, -3, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -1, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -7, 2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -6, 4, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 0, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 3, -3, 0, 0, -3, 0, 0, 2, 0, -2, -1},
+{0, 3, -3, 0, 0, -3, 0, 0, 2, 0, -2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -1, 3},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 1, -3},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 1, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 4, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 2, -1},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 2, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -1, -3},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -12, 0, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -12, 0, 2, 0, 0, 0, -2, 0, 0, 3},
+{0, 6, -10, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -5, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 8, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 10, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, -3},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -1, 3},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 11, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 12, -8, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 13, -16, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 15, -14, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -3, 0, 1, 2},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 17, -19, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -20, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -4, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, -1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 19, -19, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 19, -18, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 20, -18, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 38, -37, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 38, -37, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, -1, -4},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 47, -52, 0, 4, 0, 0, 0, -2, 0, 0, -1},
+{0, 47, -52, 0, 4, 0, 0, 0, -2, 0, 0, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{2, -24, 21, 0, 0, 0, 0, 0, 4, 0, -3, -1},
+{2, -24, 21, 0, 0, 0, 0, 0, 4, 0, -3, 1},
+{2, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{4, -15, 6, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{4, -15, 6, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 7, -5, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 8, -19, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -13, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -18, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 7, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -21, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -18, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 9, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -18, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -22, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -18, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 10, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -20, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -20, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -18, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 12, -23, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -22, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -23, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 13, -21, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 13, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -24, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 15, -24, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -23, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 16, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 16, -20, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 17, -22, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 18, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 18, -20, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 24, -24, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 25, -22, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 28, -32, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 30, -35, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 32, -38, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 46, -65, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, 2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 5, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -16, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 14, -13, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 16, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 18, -19, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 21, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 21, -17, 0, 0, 0, 0, 0, 4, 0, -3, -2},
+{0, 22, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -28, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 22, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -29, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 25, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -30, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 25, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -33, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -31, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 27, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -32, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -32, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 30, -36, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 30, -35, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 31, -38, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -37, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 34, -42, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 34, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -31, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 36, -47, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 38, -38, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 49, -55, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 52, -58, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{8, 0, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 0, 3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -6, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 2, 3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, -8, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 4, -10, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, 1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, -12, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 6, -14, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 10, -17, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 7, -14, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 9, -15, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -2, -3},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 3},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 3},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, -3},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 1, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -3, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -2, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, -1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, 1, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, 1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, 3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0},
+{0, 0, 0, 0, 3, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -4, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 6, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -3, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 3, 0, 0, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -19, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -22, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -22, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 3, -6, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 13, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{3, 0, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 5, -8, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 14, -14, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 5, -6, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 11, -8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, -2},
+{0, 0, 0, 0, 4, -10, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 0, 1, -2, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -3, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 2, -2, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -5, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, -4, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -6, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -4, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -7, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, 0, 0, -3, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, 0, -8, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, 0, -8, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -22, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 2, -8, 9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -3, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -9, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 3, -5, 0, 0, 3, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 3, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -6, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{3, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 9, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -6, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 1, 1, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, -8, 3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 4, -7, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 3, -8, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 12, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -2, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, -2, 0, 2, 0},
+{0, 0, 0, 0, 0, 0, 1, -2, 2, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 2, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -2},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1},
+{0, 0, 0, 0, 0, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 1, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -4, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -1, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -4, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -2, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 2, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 4, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 1, 0, 1, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 1, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 4, 0, 0, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 2, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 2, -1, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 0, 0, 2, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 0, 0, 2, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 2, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 2, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 2, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 3, -6, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 3, -4, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 3, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 4, -9, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -6, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 4, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 0, 0, 6, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 6, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 6, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 6, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 1, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -2, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 2, -1},
+{0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 0, 4, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -6, 1, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, -5, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -5, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, -4, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, -3, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, -1, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 3, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -5, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -5, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -5, 7, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -5, 10, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -4, 3, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -4, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -4, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 3, 0, -3, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 3, 0, -2, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 6, 0, -3, 0},
+{0, 0, 1, 0, -3, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, -3, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -3, 6, -3, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 2, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 6, 0, -3, 0},
+{0, 0, 1, 0, -2, 1, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -2, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -1, -2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 1, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -2, 0, -2, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 1, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 0, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 5, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 1, 0, -1, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 1, 0, -1, 1},
+{0, 0, 1, 0, 0, -4, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -2, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, 3, 0, -1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, -1, 2},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 1, 2},
+{0, 0, 1, 0, 0, -1, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 2},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 1, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, -2, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 1, -2, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, -3, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 1, -6, 3, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 1, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 1, 0, 1, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 1, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 2, -6, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 2, -6, 3, 0, -2, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -1, 0, -1, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 2, -4, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, 0, 1},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -2, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, -2, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 3, -10, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 3, -7, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 3, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 4, -10, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 4, -10, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 5, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 5, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 5, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 5, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 10, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 14, -12, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 1, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 1, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 2, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 2, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 3, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 4, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 4, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 5, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -8, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -6, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 2, -5, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, -4, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 2, -4, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -3, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, -2, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, -1, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -7, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -7, 10, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -7, 10, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -6, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -6, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -6, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -6, 4, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 4, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -6, 10, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -6, 10, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -5, 6, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -5, 6, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -4, 1, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -4, 0},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, 0, -4, 4, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 2, 0, -3, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 1, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 3, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -3, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 4, 0, -1, 2},
+{0, 0, 2, 0, -3, 0, 1, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 2, 0, -4, 0},
+{0, 0, 2, 0, -3, 3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -3, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, -3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -2, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 1, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -2, 0, 4, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -5, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -3, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 0, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 5, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 8, 0, -3, 0},
+{0, 0, 2, 0, -2, 1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, 1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, -2, 5, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, -2, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, -4, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -1, -1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, 1, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 2, 0, -1, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 0, -7, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 0, -6, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, -2, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, -1, -2, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 2, 0, 0, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 1, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 1, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 1, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 1, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 1, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 1, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 2, -10, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 2, -10, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 2, -8, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, 3, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 3, -1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 3, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 4, -3, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 4, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 4, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 4, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 5, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 5, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 2, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 3, -8, 5, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, -6, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -6, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -5, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -5, -4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, -5, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -2, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -2, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 3, -1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -6, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, 0, -4, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -4, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 3, 0, -3, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 3, 0, -2, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 5, 0, -2, -1},
+{0, 0, 3, 0, -1, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 3, 0, 0, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, 0, 0, -4, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, -2, 0, -1, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 3, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -11, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -11, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -10, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -8, 1, 5, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -8, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -6, 0, 0, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -6, 0, 3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, 1, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 2, -2},
+{0, 0, 4, -8, 3, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, -1, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, 6, 0, -3, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 6, 0, 0, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -8, 5, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 4, -7, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 4, -6, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 4, -4, 0, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 4, -4, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, 0, -2, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, -2, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -2, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, 0, 2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, 2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, 2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 1, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 1, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 2, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -14, 4, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, -10, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -10, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -9, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, -9, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 5, -9, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -9, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, -8, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, -8, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, -2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -8, 5, -5, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, -7, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -7, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 0, 5, -6, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 5, -6, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 0, -7, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 6, -11, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 6, -8, 0, 1, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -7, -6, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -7, -2, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 6, -7, -2, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 6, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -5, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, 0, -8, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, 0, -6, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, 0, -5, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 4, 0, 0, 0},
+{0, 0, 7, -14, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 7, -13, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -12, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 7, -10, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 7, -10, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 7, -8, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 7, -8, 3, 0, 0, 0, 3, 0, -1, -2},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 7, -6, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 0, -2},
+{0, 0, 8, -16, 4, 5, 0, 0, -1, 0, -1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, -3, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 0, 0, 3, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 1, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 0, 2},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, 1, 0},
+{0, 0, 8, -16, 6, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 8, -13, 0, -1, 0, 0, 1, 0, -1, -1},
+{0, 0, 8, -13, 0, -1, 0, 0, 1, 0, 1, -1},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 8, -13, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 8, -12, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 9, -19, 0, 3, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -4, 0, 2, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 9, -14, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 9, -13, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -13, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 9, -12, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 9, -11, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 2, 0, 1, -4},
+{0, 0, 9, -9, 0, 0, 0, 0, 6, 0, -1, -4},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, -2, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 2, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 10, -15, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -11, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 12, -21, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -21, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -21, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -20, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 13, -12, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 14, -22, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -21, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -21, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 14, -19, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 15, -25, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -22, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -21, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 15, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -16, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -22, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -19, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 16, -18, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 16, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -5, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 17, -24, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -22, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 17, -21, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 17, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 18, -23, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 18, -22, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 20, -26, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 20, -23, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 20, -16, 0, 0, -1, 0, -2, 0, 1, 0},
+{0, 0, 20, -16, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 20, -16, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 20, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 20, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 20, -13, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 27, -29, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 28, -31, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 30, -35, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -43, 4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -37, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 35, -44, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 35, -44, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 40, -48, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -37, 45, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -8, 10, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -7, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -7, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -7, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -7, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -7, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -6, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -6, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -6, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -5, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, -5, 5, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 1, -4, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -4, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 1, -4, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -4, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -4, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -4, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -4, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -3, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -1, 0, -2, 3},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 1, -3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -3, 6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -3, 6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 4, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -2, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -1, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -6, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -6, 0, 3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 3, 0, 2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 1, 0, -2, 1},
+{0, 1, -1, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -1, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 1, 0, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 1, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, -1, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 1, 1, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 1, 2, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 2, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 2, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, 4, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 4, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 4, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 5, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 5, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, 6, -11, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 6, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 37, -51, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 2, -9, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -8, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -8, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -8, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -8, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -8, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -8, 7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -8, 9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -7, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -7, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -7, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -6, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -6, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -6, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -6, 5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -6, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -6, 8, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -5, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -5, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, -5, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -5, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -5, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -4, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -4, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -4, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, -4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -3, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -6, 0, 3, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 3, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 2, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -2, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -1, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 2, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 0, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 0, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 1, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 1, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, 1, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 1, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 1, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 1, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, 1, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 2, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 2, -8, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 2, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 2, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, 3, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 3, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 3, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 3, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, 4, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 4, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 4, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 4, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 4, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 38, -56, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -10, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -9, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -9, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -9, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -9, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -9, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -9, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -9, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -8, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -8, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 3, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 3, -7, 6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, -6, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -6, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, -1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -6, 0, 0, 2, 0, 0, -1, 0, 0, 1},
+{0, 3, -6, 0, 1, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -6, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -6, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -6, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -6, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -6, 4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -5, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 3, -5, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 3, -5, 0, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 0, 2, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -5, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -5, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -4, -5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -4, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 5, 0, -3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -4, 0, 2, 0, 0, 0, 1, 0, 1, -1},
+{0, 3, -4, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 3, -3, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -4, 0},
+{0, 3, -2, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -2, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -2, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 5, 0, -1, -1},
+{0, 3, -1, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, 0, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 3, 2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 7, -19, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 7, -19, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -15, 14, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 4, -15, 14, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 4, -11, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -11, 5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -10, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -10, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -10, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -10, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -10, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -9, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -9, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -9, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -9, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -9, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 8, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -9, 8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -8, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 4, -7, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -7, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 4, -6, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 4, -6, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 1, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 0, 1},
+{0, 4, -5, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -5, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -5, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -5, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -4, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 4, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -4, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 4, -2, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -2, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 4, 0, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 0, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 4, 1, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 1, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, 7, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -14, 15, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 5, -12, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -11, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 5, -10, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -10, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -10, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 5, -9, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 5, -9, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, 5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -9, 5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -8, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -8, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -8, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -8, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, -8, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -8, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -7, 0, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 5, -7, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, 0, 1},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 5, -7, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -7, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -7, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -7, 2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 0, -1, 0, 0, 2, 0, 0, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 0, 0, 1, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -6, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -6, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -6, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -6, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -6, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -5, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -5, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 5, -5, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -4, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -4, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -4, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 5, -4, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -3, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -3, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -3, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -3, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -3, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, 31, -52, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -14, 4, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 6, -13, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -13, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -12, 0, 2, 0, 0, 0, -2, 0, 0, 2},
+{0, 6, -11, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, -1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -11, -1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -11, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -11, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -10, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -10, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -10, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -9, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -9, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -9, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -9, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -8, 0, 4, 0, 0, 0, 2, 0, 0, -2},
+{0, 6, -8, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -8, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 2, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 6, -7, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -7, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -7, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 6, -6, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -5, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 6, -4, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -4, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -4, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 6, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, 0, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, 4, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -14, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -14, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -14, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -14, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -14, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -12, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -12, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -12, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -12, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -12, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 7, -11, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 7, -10, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -10, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 7, -10, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -10, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -10, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -10, 0, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 7, -9, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -9, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -8, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 7, -8, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -8, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -7, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -7, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -7, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 7, -7, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 7, -5, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -4, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -3, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -15, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -15, 0, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -14, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -14, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -14, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -14, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -14, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 8, -13, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, 0, 1, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -13, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -12, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -12, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 8, -11, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -11, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 3, 0, -2, -2},
+{0, 8, -10, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -9, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -1, 2},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 8, -8, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 2, 1},
+{0, 8, -6, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -3, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -1, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -16, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -16, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 9, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -15, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -15, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -15, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -15, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -15, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 9, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -13, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -12, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -12, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -12, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 9, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 9, -11, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -11, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -11, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -11, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -11, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -10, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 9, -10, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 9, -9, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -9, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -8, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -8, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -8, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -8, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -7, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -6, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -3, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -19, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -16, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -15, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -13, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 10, -11, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -11, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -10, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 10, -10, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 10, -10, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -10, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -9, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -9, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -9, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -9, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 10, -8, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -8, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -8, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -8, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -4, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -4, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 10, -3, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -3, -2},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{0, 10, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 10, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 11, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -20, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 11, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -18, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -18, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -18, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -18, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -17, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -17, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -16, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 11, -14, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 11, -13, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 11, -13, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 11, -12, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 11, -11, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -11, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -11, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -10, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 11, -9, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -9, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 11, -8, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -8, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -8, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -7, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -6, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -6, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -21, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -18, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -18, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -17, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -17, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 12, -15, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 12, -13, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 12, -12, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 12, -11, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -11, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 12, -10, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -10, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -9, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -9, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -9, 0, 0, -2, 0, 0, -3, 0, 1, 1},
+{0, 12, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -9, 0, 1, 0, 0, 0, -3, 0, 2, 0},
+{0, 12, -8, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 12, -7, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -7, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -7, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -7, 0, 0, -4, 0, 0, -1, 0, 0, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 12, -6, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -6, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, 1, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -23, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 13, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 13, -15, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 13, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -12, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 13, -11, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -11, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -11, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -11, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -11, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 13, -10, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -10, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -10, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -10, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -9, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 13, -9, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -6, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -20, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 14, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -17, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 14, -15, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -15, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -15, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -15, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 14, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -14, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -13, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -13, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 14, -13, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -12, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -12, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -12, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -12, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -12, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -12, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 14, -11, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 14, -10, 0, -2, 0, 0, 0, -1, 0, 1, -1},
+{0, 14, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 14, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 14, -9, 0, -2, 0, 0, 0, -2, 0, 1, -2},
+{0, 14, -9, 0, -2, 0, 0, 0, -2, 0, 2, -2},
+{0, 14, -9, 0, -2, 0, 0, 0, 2, 0, 0, -2},
+{0, 14, -9, 0, -2, 0, 0, 0, 2, 0, 1, -2},
+{0, 14, -8, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -6, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -1, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 15, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -16, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 15, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -15, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -6, 0, 1, 2},
+{0, 15, -15, 0, 0, 0, 0, 0, -6, 0, 2, 2},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 15, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -15, 2, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 15, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -14, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -14, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 15, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -13, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -13, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -13, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, 0, 0, -2, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, 0, 0, -2, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -13, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -12, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -12, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, 0, -2, 0, 0, 0, -1, 0, -1, 1},
+{0, 15, -12, 0, 0, -1, 0, 0, -1, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 15, -11, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -11, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -11, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -10, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -10, 0, -1, 0, 0, 0, 1, 0, -1, -1},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -26, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -22, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 16, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -22, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -22, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -22, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -22, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -20, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -20, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 16, -17, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 6, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 16, -16, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 16, -16, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -15, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -15, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -15, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -15, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 16, -15, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, -3, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 16, -14, 0, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -14, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 16, -14, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 16, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, 1, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 16, -13, 0, -2, 0, 0, 0, -1, 0, 1, -1},
+{0, 16, -13, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 16, -13, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -21, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -18, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -17, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -3, 0, 3, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 17, -17, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 17, -17, 3, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 17, -16, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -16, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 17, -16, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -15, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -15, 0, -1, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 17, -14, -2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -14, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 17, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -14, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 17, -13, -4, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 17, -12, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -12, 0, -3, 0, 0, 0, 2, 0, -1, -2},
+{0, 18, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -24, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 18, -24, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 18, -22, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 18, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -20, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -20, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -19, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -5, 0, 0, 2},
+{0, 18, -19, 0, 0, 0, 0, 0, -5, 0, 1, 2},
+{0, 18, -19, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 18, -19, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 18, -19, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 18, -19, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -19, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -19, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 18, -18, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 18, -18, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -17, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -17, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, -1, 0, 0, 0, -1, 0, -1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -3, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 18, -16, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -16, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -16, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -16, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -16, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -5, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -6, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -2, -4},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 0, 4},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 4, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -3, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -1, 2},
+{0, 18, -16, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -15, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -15, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -15, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -4, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 18, -14, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 18, -14, 0, 0, 3, 0, 0, 2, 0, -1, -2},
+{0, 18, -13, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -13, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -13, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 18, -12, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -8, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 19, -24, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -24, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -22, 5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 19, -21, 3, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 19, -21, 5, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -20, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 19, -20, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -19, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -19, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 19, -19, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 19, -18, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -18, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -18, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -18, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 19, -16, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 19, -15, -3, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 19, -14, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -29, 15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -29, 15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -25, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -23, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 20, -23, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -22, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -22, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -22, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, -1, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -6, 0, 3, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 20, -21, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -21, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -19, -2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 20, -19, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, -1, 0, 0, 0, 0, 0, 0, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 20, -18, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -18, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 20, -18, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -18, 0, -1, 0, 0, 0, 1, 0, -1, -1},
+{0, 20, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -16, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -15, -6, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 20, -14, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -12, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 21, -28, 10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -25, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -24, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -23, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 21, -23, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -23, 0, 4, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -23, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 6, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 21, -22, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -22, 0, 2, 0, 0, 0, -1, 0, -1, 1},
+{0, 21, -21, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -21, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -21, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -21, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 21, -21, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -20, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -20, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 21, -20, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 21, -20, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 21, -19, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -19, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -17, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 21, -17, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -15, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -14, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -29, 9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -26, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 22, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -26, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 22, -25, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -24, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -23, 0, -2, 0, 0, 0, -1, 0, 1, -1},
+{0, 22, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 22, -23, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -23, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -22, -3, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 22, -22, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 22, -22, 3, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 22, -21, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 22, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -33, 15, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 23, -31, 13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -28, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 23, -27, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -27, 4, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -26, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 23, -24, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -24, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -24, 0, 0, -3, 0, 0, 0, 0, -1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -23, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 23, -23, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 23, -23, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 23, -22, -6, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 23, -19, -11, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 24, -28, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -28, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -27, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -27, -1, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -27, 0, 2, 0, 0, 0, -1, 0, -1, 1},
+{0, 24, -27, 3, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 24, -26, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -26, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 24, -25, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -3, 2},
+{0, 24, -23, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 24, -21, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -35, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -33, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -30, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -30, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -29, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -29, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 25, -29, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -29, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -29, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -28, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -28, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -28, 0, -1, 0, 0, 0, -1, 0, 1, -1},
+{0, 25, -27, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -27, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 25, -27, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 25, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 26, -33, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -33, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -32, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -31, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -31, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -31, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 26, -31, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 26, -31, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -31, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 26, -29, -2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 26, -29, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 26, -29, 2, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 26, -28, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -28, 0, 1, 0, 0, 0, 1, 0, -1, -1},
+{0, 26, -27, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 26, -26, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -26, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 27, -36, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -34, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -33, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -33, 0, 3, 0, 0, 0, -2, 0, -1, 2},
+{0, 27, -33, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -32, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -32, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -32, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -31, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -31, 0, 4, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -29, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 27, -29, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 27, -28, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -28, -3, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 27, -28, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 27, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -27, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 27, -20, -20, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 27, -20, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 28, -42, 15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -39, 11, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 28, -37, 9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -35, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -35, 5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -34, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 28, -34, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 28, -34, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -34, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 28, -33, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -33, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -33, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 28, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -30, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -29, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 28, -28, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 29, -41, 10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -36, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 29, -36, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -35, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -35, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -34, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -34, 0, 0, 2, 0, 0, 0, 0, -1, 0},
+{0, 29, -34, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -34, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 29, -34, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 30, -40, 5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 30, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 30, -38, 3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 30, -36, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 30, -35, 3, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 30, -31, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 30, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -43, 11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -32, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 31, -31, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 32, -43, 8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -40, -1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 32, -40, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 32, -39, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -32, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 32, -28, 0, -2, 0, 0, 0, -3, 0, 1, 0},
+{0, 32, -28, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 32, -28, 0, 0, 0, 0, 0, -3, 0, 3, -1},
+{0, 32, -25, 0, -2, 0, 0, 0, 0, 0, 0, -2},
+{0, 33, -42, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -42, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 33, -40, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 33, -38, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 33, -37, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 33, -30, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 34, -44, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 34, -40, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 34, -32, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -47, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 35, -32, 0, 0, -3, 0, 0, -2, 0, 0, 0},
+{0, 35, -31, 0, 0, -3, 0, 0, -3, 0, 0, -1},
+{0, 35, -31, 0, 0, -3, 0, 0, -3, 0, 1, -1},
+{0, 35, -31, 0, 0, -3, 0, 0, 1, 0, -1, -1},
+{0, 35, -31, 0, 0, -3, 0, 0, 1, 0, 0, -1},
+{0, 36, -41, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -40, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -37, 6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 37, -35, 0, -5, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -35, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 39, -40, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 39, -36, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 40, -45, 9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -44, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -40, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -39, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -39, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 41, -42, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 42, -43, -1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -45, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -44, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -43, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -43, 0, -1, 0, 0, 0, 0, 0, 0, -2},
+{0, 43, -42, -2, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, -2, -3},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 2, -3},
+{0, 44, -47, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 44, -42, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 46, -50, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -48, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -41, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 49, -56, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 51, -55, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 53, -63, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 61, -64, 2, 0, 0, 0, 0, -4, 0, 1, 0},
+{1, -23, 20, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, -23, 22, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -6, 4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, -6, 4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{1, -6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -5, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, -3, 0, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, -2, 0, -1, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 2, 0, 1, 0},
+{1, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, 27, -37, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 3, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 3, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, 15, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 18, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, -45, 38, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{2, -36, 37, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{2, -30, 29, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{2, -30, 29, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, -28, 25, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{2, -20, 12, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{2, -12, 13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{2, -2, -4, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{2, -2, -4, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{2, -2, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{2, -2, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -5, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 0, 3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{2, 1, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 1, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{2, 5, -6, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{2, 8, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 10, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 11, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 13, -19, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{2, 14, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 15, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 16, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 19, -28, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 31, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, -27, 20, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -3, 0, 2, 1},
+{3, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{3, 0, 0, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, -4, 0, 1, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, -4, 0, 2, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, 7, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{3, 2, -6, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{3, 2, -6, 0, 0, 0, 0, 0, -4, 0, 4, 0},
+{4, -29, 19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{4, -5, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{4, 0, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, 0, -6, 3, 0, 0, 0, 0, -1, 0, -1, 1},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{4, 0, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 3, -2},
+{4, 0, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{4, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{4, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{4, 3, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, 13, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{4, 29, -39, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{5, 0, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{5, 0, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{5, 4, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{7, 0, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{8, 0, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{8, 0, -9, 1, 0, 0, 0, 0, -2, 0, 0, 0},
+{9, -19, 5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{17, 0, -22, 0, 0, 0, 0, 0, -5, 0, 1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 3, -2},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -13, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 26, -27, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -43, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 1, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -21, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 19, -18, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -27, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 26, -30, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 28, -33, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 28, -33, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 44, -47, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 45, -48, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0},
+{0, 0, 0, 0, 1, -5, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 1, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -6, 3, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, -4, 0, 1, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 4, 0, -1, -1},
+{0, 0, 0, 0, 2, -4, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 2, -4, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 2, -3, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 0, 2, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 2, -2},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 1, -2},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -5, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -4, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -1, 0, -1, 2},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, 1, 0, -3, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 1, 0, -3, 2, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, -1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, -2, 0, 3, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, -2, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 1, -1},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 1, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -3, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 3},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 3, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 0, -3, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 3, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 0, -2, 0, 0, -2, 0, -1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -1, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, -1, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 0, 2},
+{0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 1, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 0, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -2, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, -2, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, -2, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, -1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, 1, 0, -2, 0},
+{0, 0, 1, 0, 0, 2, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 0, 0, 3, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 0, 1, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 1, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 1, -1, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -2},
+{0, 0, 1, 0, 1, 0, 0, 0, 3, 0, -1, -2},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, 0, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 2, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 2, -4, 0, 0, 1, 0, 1, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, -5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -5, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -5, 5, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, -3, -1},
+{0, 0, 2, 0, -4, 3, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -4, 4, -2, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -4, 4, -2, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 0, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -1, 3},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -2, -1},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, 0, -3, 1, 0, 0, 4, 0, -2, -1},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -3, 2, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -3, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, 1, -3},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 1, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 6, 0, -3, 1},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, 0, 1},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, -2, 0, -2, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 2, 0, -1, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, -1, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, -2, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 2, 0, 0, 1, 0, 0, -1, 0, 0, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, 2, -7, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, 2, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, 2, -5, 0, 0, 1, 0, 0, 0},
+{0, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 2, -2},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 3, -2},
+{0, 0, 3, -7, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 3, -2, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -5, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, -5, 2, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 3, 0, -4, 0, 0, 0, 3, 0, -4, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -1, -2},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 3, 0, -1, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, -1, -1},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, -1, 1},
+{0, 0, 3, 0, 0, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 4, -8, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -4, 0, -1, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -3, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, -1, 3},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 1, -3},
+{0, 0, 4, -8, 3, 0, 0, 0, 0, 0, 3, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 4, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -6, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 4, -4, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 4, -3, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -10, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 5, -8, 3, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 5, -8, 3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 5, -6, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 6, -9, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 6, -8, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -7, -2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 6, -6, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 6, 0, -6, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 0, -1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 0, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -8, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 0, 7, -6, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 8, -13, 0, -1, 0, 0, 1, 0, 0, -2},
+{0, 0, 8, -13, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 8, -7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 9, -17, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 9, -17, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 0, -1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 0, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -14, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 9, -13, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 9, -9, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 9, -8, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, -1, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 1, -1},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 10, -12, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 11, -21, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 11, -21, 2, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 11, -18, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 12, -17, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 12, -16, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 12, -15, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 13, -17, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 13, -15, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 14, -23, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 17, -28, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 28, -31, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 28, -31, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 29, -33, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 29, -33, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 1, -3, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 1, -3, 0, 1, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, -3},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 3, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, 0, -3},
+{0, 1, -1, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -1, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 2, -6, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -6, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -5, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -5, 0, -1, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -5, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, -4, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, -4, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 2, -2, 0, -1, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, -2, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -1, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 2, 1, -4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -7, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 1, 2},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -6, 0, 0, 2, 0, 0, -1, 0, 0, 0},
+{0, 3, -6, 0, 0, 2, 0, 0, -1, 0, 0, 2},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 3, -5, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, 0, -1},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+{0, 3, -5, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 3, -4, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -4, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, 0, -3},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -2, 1},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 3, -2, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 4, -8, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -6, 3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 4, -6, 3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 4, -5, 0, 2, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -5, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 2, 0, 0, -3},
+{0, 4, -4, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -9, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 5, -7, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 5, -7, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 5, -6, -4, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 5, -6, -4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -6, 0, -1, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -6, 0, -1, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 1, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, -2, 0, 1, 1},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, -1, 1},
+{0, 6, -10, 0, 3, 0, 0, 0, 0, 0, 1, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, -1, -1},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, -1, 1},
+{0, 6, -10, 0, 3, 0, 0, 0, 2, 0, 0, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 6, -9, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 6, -9, 0, 3, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -9, 0, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -4, -1},
+{0, 6, -8, 0, 0, 0, 0, 0, 4, 0, -3, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 8, -12, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 8, -9, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 8, -7, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 9, -14, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 10, -7, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -4, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 10, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 10, -2, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 11, -15, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 12, -14, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 12, -8, 0, 0, 0, -2, 0, -2, 0, 1, -1},
+{0, 12, -8, 0, 0, 0, -2, 0, -2, 0, 1, 1},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, 1, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, -1, 3},
+{0, 14, -16, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 14, -15, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 17, -15, 0, -1, 0, 0, 0, -1, 0, 1, -2},
+{0, 17, -15, 0, -1, 0, 0, 0, -1, 0, 1, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 17, -15, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 4, 0, -3, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, -1, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -4, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, -1, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, -3, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, 0, 0, 1, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, -3},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -1, 3},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -3, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -3, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 18, -14, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -2, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 19, -21, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 19, -17, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, -1, -2},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 3, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 20, -19, 0, -3, 0, 0, 0, 0, 0, -1, -1},
+{0, 20, -19, 0, -3, 0, 0, 0, 0, 0, -1, 1},
+{0, 20, -15, -8, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 20, -15, -8, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 20, -12, -15, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 21, -23, 0, 0, 0, 0, 0, -2, 0, -1, 3},
+{0, 21, -22, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 1, -3},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 23, -26, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 23, -26, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 24, -26, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 24, -24, 0, 0, 0, 0, 0, 4, 0, -3, -1},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 1, -3},
+{0, 25, -27, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -2, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -1, -3},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 41, -42, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 41, -42, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{1, 0, -10, 11, 0, 0, 0, 0, -2, 0, 0, 1},
+{1, 0, -10, 11, 0, 0, 0, 0, 2, 0, 0, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{1, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{1, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{1, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{2, -2, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{2, -2, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{2, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -3, 0, 1, 2},
+{3, 0, -1, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{4, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{4, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -3},
+{4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{5, 0, -13, 7, 0, 0, 0, 0, -2, 0, 1, -1},
+{5, 0, -13, 7, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 8, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 0, 4, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 4, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 0, 2, -5, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 4, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, 6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -8, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 3, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, -5, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -13, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 5, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -14, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 6, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -5, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -14, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -19, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 9, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 9, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 10, -20, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -20, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -20, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -8, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 10, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -20, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 11, -11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -9, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -9, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -6, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 12, -23, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -23, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 12, -21, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 12, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 13, -24, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 13, -24, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -24, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 13, -22, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 13, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 13, -10, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -26, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -22, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -22, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 14, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 14, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 14, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 14, -11, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -25, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -22, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -19, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 15, -18, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 15, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 15, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 16, -25, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 16, -24, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 16, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 16, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 18, -23, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 18, -17, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -21, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 19, -21, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 23, -27, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 23, -22, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 24, -23, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 25, -26, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 25, -25, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 28, -29, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 28, -28, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 30, -32, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 32, -39, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -43, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -39, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 36, -46, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 37, -44, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 43, -56, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 44, -61, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -3, 2},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 2, -5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 3, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 2, 5, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 5, 2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 9, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 11, -10, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 11, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 11, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 12, -11, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 12, -6, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 12, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -21, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 13, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -20, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 14, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 15, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 15, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 16, -15, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 16, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 16, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -23, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 18, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 18, -13, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 19, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 19, -20, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -24, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 20, -19, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -27, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 22, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 22, -21, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -27, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 24, -23, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 25, -28, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 27, -32, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -36, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 29, -34, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 30, -38, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -36, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -34, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 36, -36, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -35, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -38, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 41, -43, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 42, -43, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 42, -42, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 43, -44, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -44, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 45, -49, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -51, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 48, -54, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 50, -56, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 52, -60, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 0, 7, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 1, -5, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, 0, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 2, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -5, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 2, -3, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, -1, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 3, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -8, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 3, -5, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 3, -1, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 3, 2, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 4, -7, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 4, -6, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 4, -5, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 4, -3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, -2, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 4, -1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 5, -11, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -11, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 5, -1, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 5, 0, -2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -13, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 6, -6, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 7, -11, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 7, -9, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 8, -10, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 9, -14, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 1, -4, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -5, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 5, -9, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 7, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 7, -2, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 8, -6, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 9, -11, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 9, -11, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -15, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 10, -9, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 10, -9, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 10, -5, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 12, -12, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 13, -14, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 14, -16, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 14, -15, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 15, -17, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 16, -15, 0, 0, 0, 0, 0, -2, 0, -1, 3},
+{0, 16, -15, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 17, -18, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 18, -19, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 3},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -4, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 4, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -2, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 2, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -2, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 2, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 4, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -2, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -2, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 2, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, -1, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -2, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 1, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 5, -1, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -2, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -4, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 3},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, 0, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, 0, -5, 2, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -5, -4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -5, -4, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -2, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, 0, -5, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -17, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 19, -24, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 20, -24, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -1, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 1, 1, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -2, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 10, -12, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -10, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -12, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -13, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -14, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 0, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -8, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -3, 2},
+{0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 2, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 4, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 12, -14, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 26, -28, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 7, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -7, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 3, 0, -1, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, -4, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -3, 0, 1, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 2},
+{0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, -2},
+{0, 0, 1, 0, 0, 2, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, 0, 0, 2, 0, 0, 3, 0, -1, -1},
+{0, 0, 2, -6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 0, 2, 0, 1, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 3, 0, -4, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 4, 0, -2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, -6, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, 0, -4, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, -1, 2},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, 1, -2},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 37, -48, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 1, -1, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -2, 0, 4, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 2, -1, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -3, 0, 0, 1, 0, 0, 2, 0, -3, 0},
+{0, 3, -3, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 1, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, 0, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -9, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -6, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -8, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -9, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 12, -10, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -15, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -16, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -15, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 16, -15, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -14, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -14, 0, -3, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 22, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 26, -29, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 1, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -2, 2},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 2, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -1, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 1, 0, -2, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -3, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 2, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -6, 0, 2, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -4, 0},
+{0, 0, 2, 0, -4, 4, -2, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -4, 4, -2, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -3, 2},
+{0, 0, 2, 0, -2, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -4, 0, -2, 0},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 0, 3, 0, -6, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 3, 0, -2, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 1, 2},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -1, -2},
+{0, 0, 11, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, 3, 2},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 4, -8, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 4, -5, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, 2, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, 2, 0},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 8, -8, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 9, -11, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 20, -21, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 22, -21, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -17, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 11, -12, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 13, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 14, -16, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 25, -28, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 2, -4, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 3, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, -2, 0, 1, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, 2, 0, -1, 0},
+{0, 0, 0, 0, 0, 1, -3, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -3, 0, 0, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -1, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, -2},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -1, -2},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 2},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, -2},
+{0, 0, 0, 0, 0, 1, 0, 0, 3, 0, -2, 0},
+{0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 1, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -6, 0, 0, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, -4, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -4, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 2, 0},
+{0, 0, 0, 0, 2, -7, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 2, -7, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, -2, 0, 2, 0},
+{0, 0, 0, 0, 2, -6, 3, 0, 2, 0, -2, 0},
+{0, 0, 0, 0, 2, -6, 4, -2, 0, 0, 0, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 1, -2},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 4, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -4, 0},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -1, 2},
+{0, 0, 0, 0, 2, -4, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 0, 2, -4, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 0, 0, 2, 0},
+{0, 0, 0, 0, 2, -3, 0, 0, 2, 0, 1, 0},
+{0, 0, 0, 0, 2, -2, 0, 0, -4, 0, 1, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 0, 0, 2, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 0, 0, 4, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 0, 4, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 1, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 1, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 0, 2, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 2, 0, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 0, 2, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 2, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, 5, 0, -2, -1},
+{0, 0, 0, 3, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 3, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 3, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 0, 4, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -8, 3, 0, 0, 0, -3, 0, 1, 2},
+{0, 0, 1, -8, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -7, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, -7, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -5, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -5, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -4, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 1, -4, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, -4, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, -4, 0, 2, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, -4, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, -4, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -4, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, -3, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 4, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 1, 2},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 1, -2, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, -2, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -2, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, -1, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, -1, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, -1, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 1, -1, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 0, 1, -1, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -4, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 1, 0, -4, 2, 0, 0, 1, 0, -3, 1},
+{0, 0, 1, 0, -4, 2, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -4, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, -3, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, 0, -3, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, 0, -3, 2, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, -3, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, -3, 5, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 1, 2},
+{0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, -3},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 1, 0, -2, 0, 0, 0, 6, 0, -1, 0},
+{0, 0, 1, 0, -2, 2, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 0, -2, 4, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -2, 4, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 0, -2, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, -2, 7, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, -1, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 0, -1, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -1, -1, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, -1, -1, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, -1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -5, 0, 1, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, -1, 2},
+{0, 0, 1, 0, -1, 0, 0, 0, -4, 0, 2, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, -3, 0, -2, 0},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 2, -2},
+{0, 0, 1, 0, -1, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, -1, 2, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, -1, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, -1, 5, 0, 0, -2, 0, 0, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 0, -4, 0, 0, 1, 0, -1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 0, -3, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 3, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, 0, -2, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, -2, 0},
+{0, 0, 1, 0, 0, 0, -3, 2, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 2, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, -2, 2, 0, 0, 0},
+{0, 0, 1, 0, 0, 0, 0, -1, 2, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 2, -1},
+{0, 0, 1, 0, 0, 1, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, 0, 0, 2, 0, 0, -1, 0, 0, -1},
+{0, 0, 1, 0, 0, 2, 0, 0, 3, 0, 0, -1},
+{0, 0, 1, 0, 0, 3, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 1, -3, 0, 0, 1, 0, 0, -1},
+{0, 0, 1, 0, 1, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 1, -2, 0, 0, -4, 0, 1, 0},
+{0, 0, 1, 0, 1, -1, 0, 0, -1, 0, 2, -1},
+{0, 0, 1, 0, 1, -1, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -3, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 3, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 1, 0, 1, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 1, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 2, -6, 3, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 2, -6, 3, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, -1, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, -2, 0, 0, -2},
+{0, 0, 1, 0, 2, -5, 0, 0, 0, 0, -3, 0},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, -5, 0, 0, 4, 0, -2, 0},
+{0, 0, 1, 0, 2, -3, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 2, -3, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 2, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 1, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 2, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 2, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 0, 3, -5, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 0, 4, -1, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 4, -1, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 5, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 5, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 5, -3, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 5, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 0, 6, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 0, 6, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 0, 6, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 0, 6, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 1, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 1, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, 1, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 1, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 2, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 1, 2, 1, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 4, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 1, 5, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -8, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 0, 2, -6, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -6, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, -6, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 2, -4, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 0, 2, -4, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -4, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 2, -3, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -3, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, -3, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -3, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -3, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -6, 0, 0, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 2, -2, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -2, 1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, -2, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, -2, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, -2, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -7, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -7, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -6, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -6, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -6, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -6, 7, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -6, 10, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -5, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, -5, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -5, 3, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -4, 1, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, -4, 5, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, 0, -4, 6, -3, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 2, 0, -3, 0, 1, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -3, 0, 1, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -3, 1, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, -3, 2, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, -3, 3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, -3, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -2, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, 0, -2, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, -6, 0, 3, 0},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 2, 2},
+{0, 0, 2, 0, -2, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -5, 0},
+{0, 0, 2, 0, -2, 2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -1, -5, 0, 0, -2, 0, -1, 0},
+{0, 0, 2, 0, -1, -3, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, -1, -3, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, -3, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, -1, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, -1, -1, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -6, 0, 2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -6, 0, 3, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, -1, 0, -2, 0},
+{0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 2, 0, -1, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 2, 0, 0, -6, 3, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 0, -5, 0, 0, 2, 0, 2, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -2, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 0, -4, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -4, 0, -1, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, 0, -2, 0, 0, -1, 0, 0, 1},
+{0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 3, 0},
+{0, 0, 2, 0, 0, -2, 0, 0, 1, 0, 0, -1},
+{0, 0, 2, 0, 0, -2, 0, 0, 4, 0, -3, 0},
+{0, 0, 2, 0, 0, -1, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, 0, 0, -1, 0, 0, 4, 0, -2, 0},
+{0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0},
+{0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 2, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 0, 1, -9, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 1, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 1, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, -4, 0, 0, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 2, 0, 2, -10, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 2, -7, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 0, 2, -6, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 2, -6, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, -4, 0, 1, 0},
+{0, 0, 2, 0, 2, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 3, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 0, 3, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 0, 4, -3, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 0, 4, -2, 0, 0, 2, 0, 0, -2},
+{0, 0, 2, 0, 5, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 0, 5, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, 1, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, 2, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 2, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -10, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -10, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 3, -9, 0, 0, 0, 2, -2, 0, 2, 0},
+{0, 0, 3, -8, 1, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -8, 1, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 3, -8, 3, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 3, -8, 3, 0, 0, 0, 3, 0, -1, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 2, -3},
+{0, 0, 3, -7, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 0, 3, -7, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -7, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 3, -6, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, -6, 2, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -6, 2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -6, 2, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, -5, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 3, -5, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 3, -4, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, -4, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, -3, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -3, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 0, 3, -3, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -3, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -2, 2, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -1, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -1, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -1, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -6, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 0, -6, 2, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, -6, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -6, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -6, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -5, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 3, 0, -5, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -5, 3, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -5, 3, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, -5, 3, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -5, 3, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -5, 5, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 3, 0, -4, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, 0, -4, 1, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -4, 1, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -4, 2, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -4, 2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, -3, 0, 0, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -1, -2},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, 2, 0},
+{0, 0, 3, 0, -2, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -2, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -3, 0, 3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, -2, 0, -3, 0},
+{0, 0, 3, 0, -2, 0, 0, 0, 3, 0, -3, -1},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 3, 0, -2, 5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, -2, 5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 0, 0, 2, 0},
+{0, 0, 3, 0, -1, -5, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, 0, 0, -2, 0, 0, -4, 0, 1, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, 0, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 2, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, 0, 2, -5, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, 2, -5, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 3, -2, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, 3, -2, 0, 0, 2, 0, -2, 0},
+{0, 0, 3, 0, 3, -2, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, 0, 3, -2, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 0, 4, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -11, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -11, 0, 2, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -10, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -10, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -10, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, -8, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, -8, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -4, 0, 0, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, -4, 0, 2, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 4, 0, -2, 0},
+{0, 0, 4, -8, 1, 5, 0, 0, 4, 0, 0, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 4, -8, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, -2, 2},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 4, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -4, 0},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, 2, -2},
+{0, 0, 4, -8, 5, -5, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -7, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -7, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, -3, 0, 3, -1},
+{0, 0, 4, -7, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 4, -7, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -6, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -6, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -5, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, -4, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -4, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 4, -3, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, -3, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 4, 0, -7, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -7, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -7, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -6, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -6, 2, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -6, 2, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -6, 5, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 4, 0, -5, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, 0, -4, 0, 0, 0, 4, 0, 1, 0},
+{0, 0, 4, 0, -3, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -3, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 4, 0, -3, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, 0, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 4, 0, 0, -4, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, 0, -2, 0, 0, 0, 0, 0, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -11, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -9, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 5, -9, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -9, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 5, -8, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -8, 1, 5, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -8, 1, 5, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -6, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -3, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -3, 0, 3, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 5, -8, 3, 0, 0, 0, -2, 0, 1, 2},
+{0, 0, 5, -8, 3, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 5, -8, 3, 0, 0, 0, 4, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -7, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, -6, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 5, -6, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 5, -6, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -5, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, -5, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, -4, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -3, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -8, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -7, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 0, -7, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 0, -3, -5, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 0, -3, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 5, 0, -3, 5, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 5, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 5, 0, 1, -5, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -12, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -12, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -11, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -11, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -11, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 6, -11, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 6, -11, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 6, -11, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 6, -11, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, -10, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -10, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 0, 6, -8, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 6, -8, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -8, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, -8, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 0, 6, -6, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 6, 0, -7, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, 0, -6, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 6, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -16, 4, 5, 0, 0, 2, 0, 0, -2},
+{0, 0, 7, -14, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 7, -13, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 7, -13, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 7, -13, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 7, -13, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -11, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -11, -1, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 7, -10, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -10, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -9, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 7, -9, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 7, -9, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 7, -8, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 7, -8, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -17, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, -3, 0, 3, 0},
+{0, 0, 8, -16, 4, 5, 0, 0, 3, 0, -3, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 0, 8, -15, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 0, 8, -15, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -15, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 8, -15, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 8, -14, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -11, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -11, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 8, -8, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 8, -7, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, -2, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 0, 9, -17, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 9, -17, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -16, 4, 5, 0, 0, -2, 0, 0, 2},
+{0, 0, 9, -16, 4, 5, 0, 0, 2, 0, -2, 0},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 0, 9, -13, 0, 0, 0, 0, 2, 0, 2, -2},
+{0, 0, 9, -13, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 0, 9, -12, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -12, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 9, -12, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -12, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -11, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 9, -10, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -10, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 9, -9, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -9, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -21, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -21, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -19, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -15, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -14, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -14, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 10, -13, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 10, -11, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 11, -21, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 11, -21, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 11, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 0, 11, -14, 0, 0, 0, 0, 4, 0, -4, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -19, 0, 3, 0, 0, -2, 0, 0, 0},
+{0, 0, 12, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 12, -16, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 13, -18, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 0, 14, -23, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 15, -14, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -22, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -18, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 18, -24, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -25, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -21, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 20, -25, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 21, -26, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 21, -25, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 21, -24, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 22, -19, -5, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 23, -21, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 26, -27, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 26, -27, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 26, -27, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 26, -27, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 29, -29, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 31, -37, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 32, -39, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 32, -39, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 33, -41, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 33, -37, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 34, -42, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 34, -41, 2, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 34, -41, 2, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 35, -41, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 36, -46, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 36, -44, 0, -2, 0, 0, -1, 0, 1, -1},
+{0, 0, 38, -47, 3, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 40, -53, -4, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 40, -50, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 41, -56, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 42, -54, 0, -1, 0, 0, 0, 0, -2, 0},
+{0, 0, 42, -54, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 0, 43, -55, -2, 0, 0, 0, 0, 0, 1, -2},
+{0, 0, 43, -52, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 45, -63, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -42, 51, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -36, 43, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -8, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -8, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -8, 13, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -7, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -7, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -7, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -6, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -6, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -6, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -6, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -6, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -6, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -6, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -6, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -6, 8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -5, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -5, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 1, -5, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -5, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -5, 3, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 1, -5, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, -5, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -5, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -5, 8, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -4, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -4, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -4, 4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -4, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -3, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -3, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -3, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 1, -3, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 1, -3, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -3, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -3, 0, 2, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, -3, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, -2, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -2, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, -2, 0, 0, 1, 0, 0, 0, 0, -2, 2},
+{0, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 0, 1, 0, 0, 0, 2, 0, 2, 0},
+{0, 1, -2, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, -2, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -2, 4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 3, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 4, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 1, -1, 0, 0, 0, 0, 0, 5, 0, -2, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, -1, 0, 2, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, 0, -7, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 0, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 4, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 1, -1},
+{0, 1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 0, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 1, -3, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 1, 1, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 1, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 1, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 1, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 1, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 1, 1, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 1, 1, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 2, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 2, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 1, 2, -4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 2, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 2, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, 2, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 2, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 2, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 2, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 3, -8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 3, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 3, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 1, 3, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 1, 5, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 5, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 5, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, 5, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, 5, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 1, 9, -20, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 1, 29, -36, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 1, 43, -59, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, 43, -59, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 2, -13, 15, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 2, -11, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -9, 8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -9, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -8, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 2, -8, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -8, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -8, 0, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -8, 5, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 2, -8, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -7, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -7, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -7, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -7, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -7, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, -3, 0, 4, 0},
+{0, 2, -6, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -6, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -6, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -6, 5, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -5, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -5, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -5, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -5, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -5, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -5, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 2, -5, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -5, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -5, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -5, 4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -5, 4, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -5, 6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 2, -4, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -4, 0, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, -4, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -4, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -4, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, -1, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -2, 0, -2, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 0, 0, 4, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 2, -3, 0, 0, 0, 0, 0, 5, 0, -2, 0},
+{0, 2, -3, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 2, -3, 0, 0, 1, 0, 0, 0, 0, -1, 0},
+{0, 2, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 0, 1, 0, 0, 0, 0, 1, 0},
+{0, 2, -3, 0, 0, 2, 0, 0, 0, 0, 0, 0},
+{0, 2, -3, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -3, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, -3, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 2, -3, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -3, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -2, -1, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 2, -2, -1, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 2, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, -2, 0, 0, 0, 1, 0, 0, -1},
+{0, 2, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -2, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -5, 0, 2, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -1, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 0, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, 1, -2},
+{0, 2, -2, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 2, 0, 1, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, 5, 0, -3, 0},
+{0, 2, -2, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, -2, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -1, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, -1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -1, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 2, -1, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 2, -1, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 2, -1, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, -1, 0, 1, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 0, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 0, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, 0, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 1, -5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 1, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 2, 1, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 1, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 1, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 2, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 2, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 2, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 2, 2, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 2, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 2, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 2, 3, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 3, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 3, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 2, 4, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 2, 18, -19, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 2, 21, -24, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -15, 23, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -12, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 3, -9, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -9, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -9, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -9, 0, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -9, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -9, 4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -9, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -8, 0, 1, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -8, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -8, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -8, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -8, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -8, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -8, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -8, 8, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -7, 0, 0, -1, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 0, 0, 1, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 0, 1, 0, 0, -2, 0, 0, 2},
+{0, 3, -7, 0, 4, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -7, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -7, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -7, 4, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 3, -7, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -7, 7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -7, 7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -6, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -6, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -6, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -6, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -6, 0, -1, 0, 0, 0, -4, 0, 3, 0},
+{0, 3, -6, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -6, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -6, 0, 0, 2, 0, 0, -1, 0, -1, 1},
+{0, 3, -6, 0, 0, 2, 0, 0, -1, 0, 1, 1},
+{0, 3, -6, 0, 2, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, -6, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -6, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -5, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 3, -5, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -5, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 0, -2},
+{0, 3, -5, 0, 2, 0, 0, 0, 0, 0, 0, 2},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -5, 0, 2, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, -5, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -5, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, -3, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 3, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -4, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -6, 0, 2, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -5, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, -3, -2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 1, 2},
+{0, 3, -4, 0, 0, 0, 0, 0, 1, 0, 3, 0},
+{0, 3, -4, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -4, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -4, 3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -4, 3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 3, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -3, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, -4, 0, 2, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 4, 0, -3, 0},
+{0, 3, -3, 0, 0, -1, 0, 0, 2, 0, -3, 0},
+{0, 3, -3, 0, 0, -1, 0, 0, 2, 0, -2, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 3, -3, 0, 0, 0, 0, 0, 4, 0, 0, -2},
+{0, 3, -3, 0, 0, 0, 0, 0, 5, 0, -2, 0},
+{0, 3, -3, 0, 0, 1, 0, 0, 2, 0, -2, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -3, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -2, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -2, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -2, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -2, 0, -2, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, -2, 0, -2, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -2, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 3, -2, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -1, -6, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 3, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 3, -1, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 3, 0, -8, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 3, 1, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, 1, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 2, -9, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, 2, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 2, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 3, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 3, 3, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 3, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 3, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 3, 3, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, 27, -37, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 4, -16, 15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -16, 15, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -10, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 4, -10, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -10, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -10, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -9, 0, 1, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -9, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -9, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -9, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -9, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -9, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -8, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -8, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -8, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -8, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -8, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 4, -8, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -8, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -8, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -7, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -7, -3, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 4, -7, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -7, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 4, -7, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 4, -7, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -7, 0, 6, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -7, 0, 6, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -7, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -6, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -6, 0, -2, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -6, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -6, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -6, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -6, 3, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 4, -5, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, -5, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -5, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, -5, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -5, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 3, 0, 1, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 4, -5, 0, 0, 2, 0, 0, 2, 0, -3, 0},
+{0, 4, -5, 0, 0, 2, 0, 0, 2, 0, -1, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -5, 0, 1, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -5, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -5, 0, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -5, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -4, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, -2, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 4, -4, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 4, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -3, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -3, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -3, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, -3, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -3, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -3, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 4, -3, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, -3, 0, 1, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 4, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -2, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 4, -2, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -2, 0, -1, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, -1, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -1, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, -1, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, -1, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 4, -1, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 4, 0, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 1, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 1, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 1, 0, -1, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 4, 2, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 2, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 2, 0, -3, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, 2, 0, -3, 0, 0, 0, 2, 0, 0, 0},
+{0, 4, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 4, 2, 0, -2, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, 22, -32, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -14, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -14, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -13, 6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -12, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -12, 4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -11, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -11, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -11, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -11, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -10, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -10, 0, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -10, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -10, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -10, 7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -10, 7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -9, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -9, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -9, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 5, -9, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 5, -9, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -9, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -9, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -8, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -8, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 5, -8, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 5, -8, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 5, -8, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -8, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -8, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -7, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -7, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -7, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 5, -7, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+{0, 5, -7, 0, 2, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -7, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -7, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 5, -6, -4, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -6, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 1, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, -2, 0, 2, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, -1, -4},
+{0, 5, -6, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 6, 0, -2, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 6, 0, -1, -2},
+{0, 5, -6, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -6, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -5, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -5, -3, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 5, -5, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -5, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, 4, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 5, -5, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 5, -5, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -5, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -4, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -4, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -4, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -4, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 5, -4, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 5, -4, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 5, -3, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 5, -3, -13, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -3, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -3, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -3, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -3, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -3, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, -3, 0, -2, 0, 0, 0, -2, 0, -2, 0},
+{0, 5, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 5, -3, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 5, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -2, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -2, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 5, -1, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -1, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 5, -1, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -14, 6, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -14, 8, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -14, 8, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -14, 8, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -13, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -13, 4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 6, -12, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -12, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -12, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -12, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -12, 0, 3, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -12, 0, 3, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -12, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -12, 1, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -12, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -12, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 6, -11, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 6, -11, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -11, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -11, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -11, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -11, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -11, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -11, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 6, -10, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -10, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, -4, 0, 1, 0},
+{0, 6, -10, 0, 3, 0, 0, 0, 4, 0, -1, 0},
+{0, 6, -9, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -9, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -9, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -9, -3, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -9, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 6, -9, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -9, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -9, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -9, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 6, -9, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -9, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -9, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -8, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -8, 0, 0, 0, 0, 0, 6, 0, -4, 0},
+{0, 6, -8, 0, 0, 0, 1, 0, 2, 0, -2, 0},
+{0, 6, -8, 0, 0, 1, 0, 0, 2, 0, -3, 0},
+{0, 6, -8, 0, 0, 1, 0, 0, 2, 0, -1, 0},
+{0, 6, -8, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -8, 0, 2, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -8, 0, 3, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -8, 0, 3, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -8, 0, 3, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -8, 0, 3, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -7, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -7, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -7, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -7, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -7, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -7, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -7, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -6, -7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -6, -7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -6, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -6, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -6, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -6, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 6, -6, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 6, -5, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -5, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, -2, 0, -2, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -5, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, -5, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 6, -5, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 6, -5, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 6, -5, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -5, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 6, -4, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -4, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -4, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -4, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -4, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -4, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -4, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -4, 0, -2, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 6, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 6, -3, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 6, -3, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 6, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 6, -2, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 6, 0, -15, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, 0, -15, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 6, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -42, 36, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -13, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -13, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -12, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -12, -2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -12, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -12, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -12, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -12, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 7, -11, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -11, -4, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -10, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 2, -3},
+{0, 7, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -10, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -10, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -10, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -10, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -10, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -9, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -9, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -9, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -9, 0, 2, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -9, 0, 2, 0, 0, 0, 2, 0, -1, 0},
+{0, 7, -9, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 7, -8, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -8, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -7, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, -4, 0},
+{0, 7, -7, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 7, -7, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -7, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -6, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -6, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -6, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -6, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -6, 0, -1, 0, 0, 0, -2, 0, -2, 0},
+{0, 7, -6, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -6, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 7, -6, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 7, -6, 0, 0, -1, 0, 0, 0, 0, 0, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 1, 1},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 7, -5, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -5, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -5, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -5, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -5, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 7, -5, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -5, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -5, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -5, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 7, -4, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 7, -4, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, -4, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 7, -2, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 7, -2, -2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -47, 39, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -21, 19, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -17, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -15, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 8, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -15, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -15, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -14, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 8, -14, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 8, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -14, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -14, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -14, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -14, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -14, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -14, 2, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -13, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 8, -13, 0, 0, -1, 0, 0, 0, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, -1, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, 1, 2},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -1, -2},
+{0, 8, -13, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -13, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -13, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -13, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -13, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -12, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -12, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -12, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -12, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -12, 0, -1, 0, 0, 0, 0, 0, 1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 8, -12, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 8, -12, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 8, -12, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -11, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 8, -11, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -11, 0, 2, 0, 0, 0, 2, 0, 0, -2},
+{0, 8, -11, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -10, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -10, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -10, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -10, 2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -10, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -10, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -10, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -10, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -9, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 8, -9, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 8, -9, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -9, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -9, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -9, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -9, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -9, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -8, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -8, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -8, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 8, -8, 0, 0, 0, 0, 0, 3, 0, -4, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 3, 0, 1, 0},
+{0, 8, -8, 0, 0, 0, 0, 0, 6, 0, -1, 0},
+{0, 8, -8, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -8, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -7, 0, -1, 0, 0, 0, -2, 0, 3, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -7, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 8, -6, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -6, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -6, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -6, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -6, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -6, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -5, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 8, -5, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -3, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -3, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, -3, 0, -1, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -3, 0, -1, 0, 0, 0, 2, 0, -1, 0},
+{0, 8, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 8, -2, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 8, -2, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -16, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -15, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 9, -15, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -15, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -15, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -15, 0, 4, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -15, 0, 4, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -15, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -15, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 9, -14, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 9, -14, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -14, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -13, 0, 1, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -13, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -12, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -12, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 9, -11, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -11, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -11, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -11, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -11, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -11, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -11, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -10, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -10, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -10, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -10, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -10, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -9, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 9, -9, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 9, -9, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -9, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -9, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -8, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -8, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -8, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 9, -7, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -7, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -7, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -7, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -7, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -7, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -6, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 9, -6, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -6, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -5, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -4, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -4, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -3, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -3, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -3, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 9, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 9, -3, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 9, -2, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 9, -1, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -19, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -18, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 10, -18, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -18, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -18, 0, 2, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 10, -16, 0, 1, 0, 0, 0, 0, 0, 2, -2},
+{0, 10, -15, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -15, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 10, -15, 0, 1, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -15, 1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -15, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -15, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 10, -14, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 10, -14, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 10, -14, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 10, -13, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -13, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -13, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -13, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 10, -12, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 10, -12, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -12, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -12, 0, 2, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -12, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -12, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -12, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 10, -12, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -12, 2, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 10, -11, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -11, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -10, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -10, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 10, -10, 0, 0, 0, 0, 0, 4, 0, 2, 0},
+{0, 10, -10, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -10, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -9, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -9, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 10, -8, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -8, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -8, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -8, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -7, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -7, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -7, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -7, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -6, 0, 1, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -6, 0, 1, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -5, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -5, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -4, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -4, 0, -9, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -4, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, -4, 0, -2, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, -5, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 10, -3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 10, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 10, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, 0, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, 8, -24, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 11, -18, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 11, -16, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -16, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -16, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -16, 0, 1, 0, 0, 0, -2, 0, 3, 0},
+{0, 11, -16, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -16, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -15, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -13, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 11, -13, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -13, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -13, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -13, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 11, -12, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -12, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -12, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -12, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 11, -11, 0, 0, 0, 0, 0, 0, 0, 2, -2},
+{0, 11, -11, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, -5, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 11, -11, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, 3, 0, 2, 0},
+{0, 11, -10, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -10, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -10, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -10, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -10, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 11, -9, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -9, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -9, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -9, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -9, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -8, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -8, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -8, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -8, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -7, 0, -1, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -7, 0, -1, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -6, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 11, -5, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 11, 6, -20, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -19, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -17, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -16, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 12, -16, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 12, -16, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -15, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -14, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -14, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -14, 0, 2, 0, 0, 0, 2, 0, -2, 0},
+{0, 12, -14, 0, 2, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -14, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -14, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 12, -13, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 12, -13, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -13, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -13, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -13, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -13, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -12, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -12, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 1, 0, 2, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 12, -12, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 12, -11, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -11, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -11, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -11, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 12, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 12, -10, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -10, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -10, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -10, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -10, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 12, -9, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -9, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -8, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 12, -8, 0, 0, -3, 0, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, -3, 0, -2, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -3, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 0, -2},
+{0, 12, -8, 0, 0, 0, 0, 0, -2, 0, 2, 2},
+{0, 12, -8, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -8, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -6, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -6, -2, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 12, -6, 0, 1, 0, 0, 0, 0, 0, 0, -2},
+{0, 12, -6, 0, 1, 0, 0, 0, 0, 0, 2, -2},
+{0, 12, -3, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -22, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 13, -19, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 13, -19, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -19, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -19, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -19, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -16, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 13, -15, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 13, -15, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -15, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 13, -14, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 13, -14, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 13, -14, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -14, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 13, -13, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 13, -13, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -12, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -12, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -12, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -12, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 13, -12, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 13, -11, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -11, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 13, -10, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -10, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 13, -10, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 13, -9, 0, -7, 0, 0, 0, -2, 0, 1, 0},
+{0, 13, -9, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -9, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 13, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -20, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -20, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 14, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -18, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 14, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 14, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -16, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 14, -15, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 14, -15, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -15, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -14, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -14, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 3, 0, -1, 0},
+{0, 14, -14, 0, 0, 0, 0, 0, 4, 0, 1, 0},
+{0, 14, -14, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -13, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -13, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -13, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -13, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -13, 0, 0, -1, 0, 0, -4, 0, 3, 0},
+{0, 14, -13, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 14, -13, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 14, -13, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 14, -12, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -12, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -12, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -12, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -12, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 14, -12, 0, 0, 0, 0, 0, -3, 0, 4, -1},
+{0, 14, -12, 3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -11, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -11, 0, 0, -4, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 14, -9, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 14, -8, 0, -2, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -8, 0, -2, 0, 0, 0, 2, 0, 0, 0},
+{0, 14, -7, -4, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 15, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -24, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -23, 19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -20, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 15, -19, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -18, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -18, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -17, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -17, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -17, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -17, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -17, 11, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 15, -16, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 15, -16, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -16, 3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -15, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 15, -14, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -14, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -14, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 15, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -14, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 15, -13, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -13, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 15, -13, 0, 0, 0, 0, 0, 1, 0, 0, 0},
+{0, 15, -13, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 15, -13, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 15, -13, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -12, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -12, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -12, 0, -2, 0, 0, 0, -1, 0, -2, 1},
+{0, 15, -12, 0, -2, 0, 0, 0, -1, 0, 0, 1},
+{0, 15, -12, 0, 0, 0, -1, 0, -1, 0, 0, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 15, -11, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -11, 0, 0, -5, 0, 0, 0, 0, -1, 0},
+{0, 15, -11, 0, 0, -4, 0, 0, 0, 0, -1, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, -3, 0, 0, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 15, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 15, -9, -8, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 15, -9, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 15, -9, -4, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 15, -9, 0, -2, 0, 0, 0, 2, 0, -1, -2},
+{0, 15, -9, 0, 0, -2, 0, 0, 2, 0, -1, -2},
+{0, 15, -9, 0, 0, -1, 0, 0, 2, 0, -1, -2},
+{0, 16, -21, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -20, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 16, -20, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -20, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -19, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 16, -18, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 16, -18, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 16, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -18, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -17, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 16, -17, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 16, -17, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 16, -17, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -17, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -16, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 16, -16, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 16, -16, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 16, -16, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -16, 6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -15, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 16, -15, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 16, -14, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -14, -1, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -14, -1, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 16, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 16, -14, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 16, -13, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -13, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -13, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 16, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 16, -11, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 17, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -23, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -22, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -22, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -21, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -21, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -20, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 17, -19, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -19, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -19, 6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -18, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 17, -18, 0, 0, 2, 0, 0, -4, 0, 3, 0},
+{0, 17, -18, 3, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 17, -17, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 17, -17, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 17, -17, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 17, -17, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -17, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -16, 0, 0, -5, 0, 0, -2, 0, 1, 0},
+{0, 17, -16, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, 0, -2, 0, 0, -2, 0, 2, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 17, -16, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 17, -16, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 17, -16, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -16, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 17, -15, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -15, 0, -3, 0, 0, 0, -1, 0, 0, 0},
+{0, 17, -15, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -15, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 17, -15, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 17, -14, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -14, -4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 17, -14, -4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -14, 0, -4, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -14, 0, -4, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -14, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -27, 17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -24, 15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -23, 9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -21, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 18, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 18, -20, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -20, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -20, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -20, 4, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 18, -19, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, -1, 0, 0, 0, -2, 0, -1, 2},
+{0, 18, -18, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, -1, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 18, -18, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 18, -18, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 0, 1, 0, 0, -2, 0, 2, 0},
+{0, 18, -18, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -18, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -17, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -17, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -1, 3},
+{0, 18, -17, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 0, 2},
+{0, 18, -17, 0, 0, 0, 0, 0, 6, 0, -3, 0},
+{0, 18, -17, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 18, -16, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -16, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -16, 0, 0, 0, 0, -1, 0, 0, -1, 0},
+{0, 18, -16, 0, 0, 0, 0, 0, -4, 0, 0, 2},
+{0, 18, -16, 0, 0, 0, 0, 0, 4, 0, -2, -2},
+{0, 18, -15, -6, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -15, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -6, 0, 0, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -2, -2},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 18, -14, -7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 18, -14, -7, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 18, -13, -5, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 18, -10, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -10, -13, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -24, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 19, -24, 9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, -3, 1},
+{0, 19, -24, 10, 0, 0, 0, 0, -1, 0, 1, 1},
+{0, 19, -22, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -22, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 19, -21, 3, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 19, -20, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 19, -20, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -20, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -20, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -19, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -19, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -19, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -19, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -19, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 19, -19, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 19, -19, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 19, -19, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 19, -19, 0, 0, 1, 0, 0, -2, 0, 2, 0},
+{0, 19, -19, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -19, 2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -19, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -18, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -18, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -18, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 19, -17, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 19, -17, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -17, -2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -17, -2, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -17, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 19, -17, 0, -3, 0, 0, 0, 0, 0, 1, -2},
+{0, 19, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 19, -16, -3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -16, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 19, -14, -10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -11, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -28, 13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -27, 11, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -25, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -25, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 20, -23, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -23, 11, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 20, -22, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 20, -22, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -22, 5, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -21, 0, 0, -1, 0, 0, -2, 0, 2, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -6, 0, 1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 20, -21, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 20, -21, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -20, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -20, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -20, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 20, -20, 0, 0, -1, 0, 0, -2, 0, 1, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -5, 0, 2, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, -2, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 0, -3},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 20, -20, 0, 0, 0, 0, 0, -1, 0, 4, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 20, -20, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 3, 0, -2, 0},
+{0, 20, -20, 0, 0, 0, 0, 0, 3, 0, 0, -1},
+{0, 20, -20, 0, 0, 0, 0, 0, 3, 0, 0, 0},
+{0, 20, -20, 0, 0, 1, 0, 0, -1, 0, 1, -1},
+{0, 20, -20, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -20, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -20, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -20, 2, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 20, -19, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -19, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 20, -19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 20, -19, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -17, 0, -1, 0, 0, 0, 2, 0, -1, -2},
+{0, 20, -15, -4, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 20, -13, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -26, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 21, -24, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -24, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -24, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 21, -24, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -24, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -24, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -23, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -23, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 21, -23, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -22, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -22, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 21, -22, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -22, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -22, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -21, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -2, -2},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+{0, 21, -21, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 21, -20, -1, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 21, -19, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -19, -3, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 21, -19, -2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 21, -19, -2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -19, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 21, -19, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 21, -19, 0, 0, -3, 0, 0, 2, 0, -3, 0},
+{0, 22, -27, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 22, -27, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -26, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -26, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -26, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 22, -25, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -25, 3, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 22, -24, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -24, 0, -3, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 22, -24, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 22, -24, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -23, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -23, 0, -3, 0, 0, 0, -1, 0, 1, -1},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 22, -23, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 22, -23, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 22, -22, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -22, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -22, 0, -1, 0, 0, 0, 0, 0, -2, 0},
+{0, 22, -22, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 22, -22, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 22, -22, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 22, -22, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -22, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -22, 1, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 22, -20, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 22, -20, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -20, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 22, -19, -6, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 22, -18, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 22, -18, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -36, 19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -28, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -28, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -27, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -27, 0, -1, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -27, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 23, -27, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -27, 6, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 23, -26, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 23, -26, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -26, 2, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 23, -26, 4, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 23, -25, -4, 0, 0, 0, 0, -3, 0, -1, 2},
+{0, 23, -25, -4, 0, 0, 0, 0, -3, 0, 1, 2},
+{0, 23, -25, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 23, -25, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -25, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -25, 0, 1, 0, 0, 0, -1, 0, 0, 0},
+{0, 23, -24, 0, -2, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -24, 0, -2, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -1, -2},
+{0, 23, -24, 0, 0, 0, 0, 0, 0, 0, -1, 2},
+{0, 23, -24, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, -2, 0, 2, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 23, -24, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 23, -23, 0, 0, -2, 0, 0, 1, 0, -1, -1},
+{0, 23, -23, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 23, -23, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 23, -22, 0, -1, 0, 0, 0, 2, 0, -1, -2},
+{0, 23, -22, 0, 0, -1, 0, 0, 2, 0, -1, -2},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -3, -2},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, 1, -2},
+{0, 23, -21, -2, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 23, -21, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 24, -29, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -29, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -29, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -29, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -29, 6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -27, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -26, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -26, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -26, 0, 1, 0, 0, 0, 0, 0, -2, 0},
+{0, 24, -26, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+{0, 24, -26, 0, 3, 0, 0, 0, 0, 0, -2, 0},
+{0, 24, -26, 0, 3, 0, 0, 0, 0, 0, 0, 0},
+{0, 24, -25, -5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 24, -25, 0, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 24, -25, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 24, -24, -7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, -4, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 24, -24, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 24, -23, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 24, -22, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 25, -31, 3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 0, -1, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 0, -3, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 0, -2, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -29, 0, 0, -2, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 25, -29, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 25, -29, 3, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 25, -29, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -29, 3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 25, -28, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -27, 0, -4, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -27, 0, -3, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -27, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 25, -26, -2, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 25, -26, 0, 0, 0, 0, 0, -1, 0, 1, -3},
+{0, 25, -26, 0, 0, 0, 0, 0, -1, 0, 2, -3},
+{0, 25, -26, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 25, -26, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 25, -26, 0, 0, 0, 0, 0, 3, 0, 0, -3},
+{0, 25, -26, 0, 0, 0, 0, 0, 3, 0, 1, -3},
+{0, 25, -25, -8, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -25, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 25, -25, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 25, -25, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 25, -24, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 25, -24, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 25, -18, -21, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -37, 15, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -36, 10, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -34, 6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -34, 6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -33, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -32, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -32, 4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 26, -31, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -31, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -30, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -29, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -29, -3, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -29, -2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -29, 0, 0, -1, 0, 0, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, -1, 0, 0, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -4, 0, -1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 26, -29, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 26, -29, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, -3, -1},
+{0, 26, -28, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{0, 26, -28, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 26, -28, 0, 0, 1, 0, 0, 1, 0, -1, -1},
+{0, 26, -28, 2, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 26, -27, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 26, -27, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 26, -27, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 26, -27, 0, 1, 0, 0, 0, 2, 0, -1, -2},
+{0, 26, -26, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -25, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -25, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 26, -24, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -23, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -37, 8, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 27, -35, 5, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -32, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -32, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -31, -1, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 27, -30, -4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 27, -30, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 27, -30, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 27, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -29, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 27, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 27, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 27, -28, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 27, -27, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 27, -25, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 28, -36, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -36, 7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -35, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 0, 0, 2, 0, 0, -2, 0, 1, 0},
+{0, 28, -34, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -33, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -32, -3, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 28, -32, 0, -1, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -32, 0, 1, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -32, 0, 1, 0, 0, 0, 0, 0, 1, -2},
+{0, 28, -31, -4, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 28, -31, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -30, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 28, -29, -6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 28, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 28, -28, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 28, -25, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -37, 6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -36, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -36, 0, 4, 0, 0, 0, -2, 0, 2, 0},
+{0, 29, -36, 2, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 29, -36, 4, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 29, -36, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 29, -35, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -35, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 29, -35, 0, 2, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -35, 0, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 29, -34, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 29, -33, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -33, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 29, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -29, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 29, -27, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 30, -41, 7, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 30, -37, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 30, -37, 0, 1, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -41, 4, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -40, 2, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -39, 0, 0, 1, 0, 0, -2, 0, 1, 0},
+{0, 31, -39, 0, 0, 3, 0, 0, -2, 0, 1, 0},
+{0, 31, -39, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -39, 0, 2, 0, 0, 0, -2, 0, 2, 0},
+{0, 31, -39, 0, 3, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -38, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -37, 0, -2, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -37, 0, 2, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -36, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 31, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -31, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 31, -29, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -23, -5, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 32, -33, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 32, -32, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -33, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -33, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 34, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 35, -32, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 36, -36, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -35, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -34, 0, -3, 0, 0, 0, -2, 0, 0, 0},
+{0, 36, -34, 0, 2, 0, 0, 0, -2, 0, 0, 0},
+{0, 37, -36, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 37, -35, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -42, 6, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 38, -39, 3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -37, 0, 0, -2, 0, 0, -2, 0, 0, 0},
+{0, 38, -35, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -41, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -39, 0, -2, 0, 0, 0, -2, 0, 0, 0},
+{0, 39, -39, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 40, -41, 1, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -40, 0, 0, -1, 0, 0, -2, 0, 0, 0},
+{0, 40, -39, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -39, 0, -1, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -38, -4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -37, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 41, -45, 6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 41, -42, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 41, -41, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 41, -35, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 42, -43, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 42, -43, 0, 1, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -46, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -44, 0, -1, 0, 0, 0, -1, 0, 0, -1},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 0, -5},
+{0, 43, -42, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 44, -48, 2, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 44, -47, 0, 3, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -58, 15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 46, -50, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 46, -50, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 46, -49, 2, 0, 0, 0, 0, 0, 0, 0, -2},
+{0, 47, -50, -3, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 47, -49, 0, 0, 0, 0, 0, 1, 0, -3, 0},
+{0, 48, -57, 7, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 49, -57, 4, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 49, -55, 0, 0, 1, 0, 0, -2, 0, 0, 0},
+{0, 49, -55, 0, 0, 2, 0, 0, -2, 0, 0, 0},
+{0, 49, -48, -13, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, -51, 54, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, -33, 38, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -31, 33, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{1, -28, 26, 0, 0, 0, 0, 0, -4, 0, 1, 2},
+{1, -28, 26, 0, 0, 0, 0, 0, 0, 0, 1, 2},
+{1, -28, 30, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -21, 19, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{1, -20, 13, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{1, -10, 10, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{1, -9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 4, 0, -3, 0},
+{1, -7, 9, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{1, -5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -11, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -11, 11, 0, 0, 0, 0, 2, 0, 0, 0},
+{1, 0, -10, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -9, 11, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 0, -9, 11, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 0, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{1, 0, -3, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{1, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{1, 13, -15, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 13, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 14, -16, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{1, 14, -16, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{1, 16, -19, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{1, 16, -17, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{1, 26, -35, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{1, 41, -45, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{2, -48, 45, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, -33, 34, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -32, 32, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -30, 29, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -25, 21, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -24, 19, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{2, -24, 19, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, -12, 13, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{2, -12, 13, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, -11, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, -10, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, -9, 8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{2, -8, 3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, -8, 3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, -3, -2, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{2, -3, -2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{2, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{2, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{2, 0, 3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 10, -14, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 11, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{2, 11, -15, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{2, 11, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 16, -21, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{2, 16, -20, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{2, 16, -20, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{2, 20, -29, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{2, 24, -34, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, -9, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{3, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{3, 0, -2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{3, 0, 0, 0, -3, 0, 0, 0, -1, 0, -1, 1},
+{3, 0, 0, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{3, 6, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{4, -15, 6, 0, 0, 0, 0, 0, -4, 0, 3, 0},
+{4, -15, 6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{4, -7, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{4, -7, -7, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{4, 0, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{4, 0, -4, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{4, 0, -4, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{4, 0, -4, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{4, 0, -4, 0, 0, 0, 0, 0, 1, 0, 1, -1},
+{4, 6, -11, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{4, 17, -31, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{4, 21, -26, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{5, -14, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{5, -4, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{5, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{5, 0, -6, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{5, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{5, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{6, -31, 14, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{6, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, 0},
+{6, 0, 0, 0, -2, 0, 0, 0, -2, 0, 1, 0},
+{6, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{6, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{8, 4, -15, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{9, -3, -21, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{10, 0, -12, -9, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 1, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 2, 1},
+{0, 0, 0, 0, 0, 1, 0, 0, 2, 0, -2, -1},
+{0, 0, 0, 0, 0, 1, 0, 0, 4, 0, -1, 1},
+{0, 0, 0, 0, 0, 2, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 1, -2, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 2},
+{0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 0, 0, 2, -5, 0, 0, -4, 0, 2, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, -2, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, -2, 0, 3, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, -3, 1},
+{0, 0, 0, 0, 2, -5, 0, 0, 0, 0, 3, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, -3, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 2, 0, 2, -1},
+{0, 0, 0, 0, 2, -5, 0, 0, 4, 0, -2, 1},
+{0, 0, 0, 0, 2, -4, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 2, -4, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 2, -2, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -2},
+{0, 0, 0, 0, 3, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 3, -5, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 3, -5, 0, 0, 2, 0, 0, 1},
+{0, 0, 0, 0, 3, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 0, 0, 3, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 0, -1},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 0, 1},
+{0, 0, 0, 0, 4, -10, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 0, 2, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, -4, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, -2, 0, -2, 1},
+{0, 0, 1, -2, 0, 0, 0, 0, 2, 0, 2, -1},
+{0, 0, 1, -2, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, -2, 0, 2, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, -2, 0, 2, 0, 0, 2, 0, 0, 1},
+{0, 0, 1, -2, 1, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, -2, 1, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, -1, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, -1, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 1, 0, -3, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 1, 0, -3, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -3, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -4, 0, 2, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 1, -2},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 3},
+{0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -3, 1},
+{0, 0, 1, 0, -2, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 1, 0, -2, 4, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, -2, 4, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, -2, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 1, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 1, 1},
+{0, 0, 1, 0, -1, 0, 0, 0, -6, 0, 3, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, -3},
+{0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, -3},
+{0, 0, 1, 0, -1, 0, 0, 0, 3, 0, -2, -1},
+{0, 0, 1, 0, -1, 0, 0, 0, 5, 0, -2, -1},
+{0, 0, 1, 0, 0, -5, 0, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 0, -2, 0, 0, 2, 0, -1, -1},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 0, 1},
+{0, 0, 1, 0, 0, -1, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 0, 0, 0, -1, 0, -2, 0, 0, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 1, -5, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 1, -5, 0, 0, 1, 0, 0, -2},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, -1, -1},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, -1, 1},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 1, -1},
+{0, 0, 1, 0, 1, -2, 0, 0, 0, 0, 1, 1},
+{0, 0, 1, 0, 1, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 0, 1, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 1, 0, 2, -6, 0, 0, 0, 0, 0, -1},
+{0, 0, 1, 0, 2, -6, 0, 0, 0, 0, 0, 1},
+{0, 0, 1, 0, 2, -5, 0, 0, -4, 0, 1, -1},
+{0, 0, 1, 2, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, -1, -1},
+{0, 0, 2, -8, 3, 0, 0, 0, 2, 0, -1, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 2, -4, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 2, -4, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, -4, 2, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, -3, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -4, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 2, -2, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 2, -2, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -4, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 2, 0, -3, -1},
+{0, 0, 2, 0, -4, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 2, 0, -4, 2, 0, 0, -2, 0, 0, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, -4, 2, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, -4, 3, 0, 0, 0, 0, -2, 1},
+{0, 0, 2, 0, -4, 3, 0, 0, 4, 0, -2, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, -4, 5, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 0, 0, 1, -3},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -4, 1},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, -3},
+{0, 0, 2, 0, -3, 0, 0, 0, 2, 0, -2, 3},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -3, -1},
+{0, 0, 2, 0, -3, 0, 0, 0, 6, 0, -2, 1},
+{0, 0, 2, 0, -3, 0, 2, 0, 2, 0, -2, -1},
+{0, 0, 2, 0, -3, 0, 2, 0, 2, 0, -2, 1},
+{0, 0, 2, 0, -3, 1, 0, 0, 4, 0, -3, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 3, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 2, 0, -4, 1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, -4, -1},
+{0, 0, 2, 0, -2, 0, 0, 0, 4, 0, 0, -1},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 0, -1, -5, 0, 0, 2, 0, 0, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 1, 0, -2, -1},
+{0, 0, 2, 0, -1, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, 0, -5, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, -4, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 0, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, 1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 1, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 2, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 2, 0, 1, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, -1, 1},
+{0, 0, 3, -8, 3, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 3, -6, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, -5, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, -4, 0, 2, -1},
+{0, 0, 3, -4, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, -3, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 3, -3, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 0, 3, -2, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 0, 3, 0, -5, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 3, 0, -4, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -3, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, -2, -1},
+{0, 0, 3, 0, -3, 0, 0, 0, 4, 0, 0, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, -4, 0, 0, 1},
+{0, 0, 3, 0, -2, 0, 0, 0, 4, 0, -2, 1},
+{0, 0, 3, 0, 0, -3, 0, 0, -2, 0, 0, -1},
+{0, 0, 3, 0, 0, -3, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, 0, 0, -3, 0, 0, 2, 0, 0, 1},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, -8, 3, 0, 0, 0, -6, 0, 3, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, 0, -1},
+{0, 0, 4, -8, 3, 0, 0, 0, 3, 0, 0, 1},
+{0, 0, 4, -8, 3, 0, 0, 0, 6, 0, -3, 1},
+{0, 0, 4, -7, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 0, 4, -6, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 4, -4, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 4, -4, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 4, -4, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 4, -2, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, -2, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, -5, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, 0, -5, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, -1, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 4, 0, -4, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 4, 0, -4, 0, 0, 0, 2, 0, 1, 1},
+{0, 0, 4, 0, -3, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 4, 0, -2, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 5, -8, 2, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 5, -8, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 0, 5, -7, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 5, -6, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 5, -5, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 5, 0, -6, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 6, -12, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -12, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 6, -10, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 6, -10, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 6, -9, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 6, -8, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 1, -1},
+{0, 0, 6, -8, 3, 0, 0, 0, -2, 0, 1, 1},
+{0, 0, 6, -8, 3, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 6, -8, 3, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 6, -7, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 6, -6, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, -2, 0, 0, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, -2, 0, 0, 3},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 7, -16, 4, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 7, -15, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 7, -11, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 7, -10, 1, 0, 0, 0, 2, 0, -2, -1},
+{0, 0, 7, -10, 1, 0, 0, 0, 2, 0, -2, 1},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 7, -7, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 8, -19, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 1, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, -4, 0, 2, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, -2, 0, 2, -1},
+{0, 0, 8, -16, 4, 5, 0, 0, 2, 0, -2, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, -2, 1},
+{0, 0, 8, -16, 4, 5, 0, 0, 4, 0, -1, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 8, -15, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 8, -14, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -14, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 8, -13, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 8, -13, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 8, -11, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 8, -9, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 8, -8, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, 0, -1},
+{0, 0, 9, -19, 0, 3, 0, 0, 0, 0, 0, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, -1, -1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, -1, 1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 1, -1},
+{0, 0, 9, -16, 4, 5, 0, 0, 0, 0, 1, 1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 0, 9, -15, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 0, 9, -11, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 9, -10, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 0, 10, -19, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 0, 10, -19, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, -2, 0, -1, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, -1, -1},
+{0, 0, 10, -19, 0, 3, 0, 0, 0, 0, 1, 1},
+{0, 0, 10, -19, 0, 3, 0, 0, 2, 0, 1, 1},
+{0, 0, 11, -19, 0, 3, 0, 0, 0, 0, 0, -1},
+{0, 0, 11, -19, 0, 3, 0, 0, 0, 0, 0, 1},
+{0, 0, 14, -23, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 0, 14, -23, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 1, -6, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 1, -6, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 1, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 1, -2, 0, 0, 0, 0, 0, 3, 0, 0, -2},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 3},
+{0, 1, -1, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 1, -1, 0, 0, 0, 0, 0, 3, 0, -1, 1},
+{0, 1, -1, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 1, 43, -59, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 1, 43, -59, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 2, -13, 15, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 2, -13, 15, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 2, -7, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -7, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -6, 0, -1, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -4, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 2, -3, 0, 0, 0, 0, 0, -6, 0, 2, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, -4, 0, -1, -1},
+{0, 2, -3, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 2, -3, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 0, -1},
+{0, 2, -3, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+{0, 2, -3, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -3, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -2, -1, 0, 0, 0, 0, 1, 0, -2, 0},
+{0, 2, -2, -1, 0, 0, 0, 0, 1, 0, -2, 2},
+{0, 2, -2, 0, 0, 0, 0, 0, -6, 0, 1, 1},
+{0, 2, -2, 0, 0, 0, 0, 0, -4, 0, -2, -1},
+{0, 2, -2, 0, 0, 0, 0, 0, -3, 0, 0, 3},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, 1, -3},
+{0, 2, -2, 0, 0, 0, 0, 0, 6, 0, -3, 1},
+{0, 2, -2, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, -2, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 2, -1, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 2, 0, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -8, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -8, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -8, 4, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, -7, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -7, 0, 0, 0, 1, 0, -2, 0, 0, 1},
+{0, 3, -7, 0, 0, 0, 1, 0, -2, 0, 0, 3},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 3, -7, 4, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -6, 0, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 3, -6, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 3, -5, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 3, -5, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 3, -5, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 3, -5, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 3, -4, 0, 0, 0, 0, 0, 0, 0, 3, 1},
+{0, 3, -4, 0, 3, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -4, 0, 3, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, -3, 0, -1, 0, 0, 0, 2, 0, -2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, -4, 0, 0, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 1, 3},
+{0, 3, -3, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -4, -1},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, -3},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, -2, 3},
+{0, 3, -3, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 3, 0, -2, 1},
+{0, 3, -3, 0, 0, 0, 0, 0, 6, 0, -3, 1},
+{0, 3, -3, 0, 1, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -3, 0, 1, 0, 0, 0, 1, 0, 0, 0},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 3, -1, -3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 3, -1, -3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 3, -1, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 3, 7, -19, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 3, 7, -19, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 4, -15, 14, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 4, -15, 14, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -10, 0, 2, 0, 0, 0, -2, 0, 0, 3},
+{0, 4, -8, 0, -1, 0, 0, 0, -2, 0, 0, 1},
+{0, 4, -8, 0, -1, 0, 0, 0, -2, 0, 0, 3},
+{0, 4, -7, 0, 2, 0, 0, 0, -1, 0, 0, 0},
+{0, 4, -7, 0, 2, 0, 0, 0, -1, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 4, -6, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 4, -5, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 4, -5, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 4, -5, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, -4, 0, 1, -1},
+{0, 4, -4, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 4, -4, 0, 0, 0, 0, 0, 3, 0, -1, -3},
+{0, 4, -4, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 4, -4, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 4, -2, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -8, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 5, -7, 0, -1, 0, 0, 0, 1, 0, 0, -2},
+{0, 5, -7, 0, -1, 0, 0, 0, 1, 0, 0, 0},
+{0, 5, -7, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 5, -7, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 5, -7, 0, 0, 0, 0, 0, 3, 0, -1, -2},
+{0, 5, -6, 0, 0, -1, 0, 0, 2, 0, 0, -3},
+{0, 5, -6, 0, 0, -1, 0, 0, 2, 0, 0, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 5, -6, 0, 0, 0, 0, 0, 1, 0, 1, -2},
+{0, 5, -6, 0, 0, 0, 0, 0, 2, 0, 2, -3},
+{0, 5, -6, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 5, -6, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 5, -6, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 0, 0, -1, 3},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 1, -3},
+{0, 5, -5, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 5, -5, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 5, -3, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 6, -11, 0, 1, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -11, 0, 1, 0, 0, 0, -2, 0, 0, 3},
+{0, 6, -8, 0, 0, 0, 0, 0, 2, 0, -3, 1},
+{0, 6, -8, 0, 1, 0, 0, 0, 2, 0, 0, -3},
+{0, 6, -8, 0, 1, 0, 0, 0, 2, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 6, -6, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, -2, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 6, -6, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 6, -6, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 6, -5, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 6, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -13, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 0, 1},
+{0, 7, -13, 0, 2, 0, 0, 0, -2, 0, 0, 3},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 7, -12, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 7, -10, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -9, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 7, -9, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 7, -8, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{0, 7, -7, 0, 0, 0, 0, 0, -2, 0, 3, -1},
+{0, 7, -7, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -14, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 8, -13, 0, 0, 0, 0, 0, 2, 0, -3, -1},
+{0, 8, -13, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -11, 0, 0, 3, 0, 0, 2, 0, 0, -3},
+{0, 8, -11, 0, 0, 3, 0, 0, 2, 0, 0, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 8, -9, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, -2, 1},
+{0, 8, -8, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 8, -6, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 9, -17, 0, 3, 0, 0, 0, -2, 0, 0, 1},
+{0, 9, -17, 0, 3, 0, 0, 0, -2, 0, 0, 3},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 9, -14, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 9, -10, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 9, -9, 0, 0, 0, 0, 0, 4, 0, 0, 1},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 9, -7, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 10, -11, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 10, -11, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 10, -10, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 10, -10, 0, 0, 0, 0, 0, 2, 0, -2, -1},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 10, -4, 0, 0, 0, 0, 0, 0, 0, -2, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, -2, 0, -3, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, -1, 0, -1, -1},
+{0, 10, -3, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 10, -3, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 10, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 11, -13, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 11, -12, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 11, -12, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 11, -11, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 11, -11, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 12, -14, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 12, -13, 0, 0, 0, 0, 0, 1, 0, -1, 0},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 12, -12, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 12, -12, 0, 0, 0, 0, 0, 4, 0, -1, 1},
+{0, 12, -6, 0, 1, 0, 0, 0, 0, 0, 1, -3},
+{0, 12, -6, 0, 1, 0, 0, 0, 0, 0, 1, -1},
+{0, 13, -15, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 13, -13, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 13, -11, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 13, -10, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 14, -15, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 14, -14, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 14, -13, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 14, -12, 0, 0, 0, 0, 0, -3, 0, 3, -2},
+{0, 14, -12, 0, 0, 0, 0, 0, -3, 0, 3, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 14, -11, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 0, -3},
+{0, 14, -9, 0, -2, 0, 0, 0, 0, 0, 2, -1},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 15, -17, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 15, -16, 0, 0, 0, 0, 0, 2, 0, -1, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, -4, 0, 2, 3},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 15, -15, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 15, -15, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{0, 15, -13, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 15, -12, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 16, -16, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, -1, 1},
+{0, 16, -16, 0, 0, 0, 0, 0, 2, 0, 1, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, -3, 0, 2, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, -3, 0, 2, 1},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 17, -17, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 17, -15, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 18, -19, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, -4, 0, -1, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -4, 0, 0, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, -1, 0, -2, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 18, -17, 0, 0, 0, 0, 0, 0, 0, 2, 1},
+{0, 18, -17, 0, 0, 0, 0, 0, 2, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -6, 0, 1, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 2, 0, -5, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 3, 0, -2, -1},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -3, 1},
+{0, 18, -16, 0, 0, 0, 0, 0, 6, 0, -2, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, -2, 0, -3, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -4, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, -3, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 18, -15, 0, 0, 0, 0, 0, 4, 0, -2, -1},
+{0, 18, -15, 0, 0, 0, 0, 0, 4, 0, -1, -1},
+{0, 19, -21, 3, 0, 0, 0, 0, -4, 0, 1, 1},
+{0, 19, -21, 3, 0, 0, 0, 0, 0, 0, 1, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 19, -20, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 19, -20, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -4, 0, 2, 1},
+{0, 20, -21, 0, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 20, -21, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{0, 21, -23, 4, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 21, -23, 4, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 21, -22, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, -3, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 0, 0, 1, 1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 21, -21, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 1, 0, -2, -2},
+{0, 22, -28, 7, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 22, -28, 7, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 22, -24, 0, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 22, -24, 0, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 22, -21, 0, 0, 0, 0, 0, 1, 0, -1, -2},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, 0, -1},
+{0, 23, -25, 0, 0, 0, 0, 0, -3, 0, 1, -1},
+{0, 23, -25, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, -1, 1},
+{0, 23, -25, 0, 0, 0, 0, 0, 1, 0, 0, 1},
+{0, 23, -23, 0, 0, 0, 0, 0, 1, 0, 0, -3},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, -2, -3},
+{0, 23, -22, 0, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 24, -27, -1, 0, 0, 0, 0, -2, 0, 1, -1},
+{0, 24, -27, -1, 0, 0, 0, 0, -2, 0, 1, 1},
+{0, 27, -20, -20, 0, 0, 0, 0, 0, 0, -1, -1},
+{0, 27, -20, -20, 0, 0, 0, 0, 0, 0, -1, 1},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, -2, -2},
+{0, 29, -33, 0, 2, 0, 0, 0, 1, 0, 0, 0},
+{0, 32, -28, 0, 0, 0, 0, 0, -3, 0, 2, -2},
+{0, 32, -28, 0, 0, 0, 0, 0, -3, 0, 2, 0},
+{1, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 1},
+{1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{1, 15, -16, 0, 0, 0, 0, 0, -1, 0, 2, 0},
+{2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1},
+{2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{2, 0, -2, 0, 0, 0, 0, 0, 2, 0, -2, 1},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, -1},
+{3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 3, 1},
+{3, 2, -6, 0, 0, 0, 0, 0, -4, 0, 3, -1},
+{3, 2, -6, 0, 0, 0, 0, 0, -4, 0, 3, 1},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{4, 0, -5, 0, 0, 0, 0, 0, -2, 0, 2, 1},
+{6, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1},
+{6, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 1},
+{6, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{6, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1},
+{7, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 5, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 0, 5, 0, 0, 0, 0, 3, 0, -3, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 0, 7, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, -8, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 1, -7, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, -7, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 1, -6, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 1, -5, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 1, -5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, -5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, -4, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 1, 2, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 1, 3, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 1, 5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 1, 8, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 2, -12, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 2, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -11, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 2, -10, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 2, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 2, -5, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, -4, 0, 3, 0},
+{0, 0, 2, -5, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 2, 2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 2, 5, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 2, 6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 2, 6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 3, -11, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -10, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 3, -10, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 3, -9, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 3, -7, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, -6, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 3, -5, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 3, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, -2, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 3, -1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 0, 3, 1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, -14, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 4, -14, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -12, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 4, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -12, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -12, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 4, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -9, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, -7, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 4, -6, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 0, 4, -2, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, -2, 0, 0, 0, 0, 4, 0, -3, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 4, -1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 4, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 4, 1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 4, 2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 4, 2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 5, -13, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 5, -13, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -13, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 5, -11, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 0, 5, -11, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 5, -10, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 5, -9, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 5, -8, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 5, -7, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 5, -6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 5, -5, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 5, -4, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 5, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 5, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 5, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 0, 5, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 5, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 0, 5, 1, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 5, 1, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 6, -16, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 6, -15, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 6, -15, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 6, -9, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 6, -8, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 0, 6, -7, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 6, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 6, -3, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 6, -1, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -17, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 7, -17, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 0, 7, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 7, -17, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 7, -16, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -16, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -14, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 7, -10, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -9, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -8, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 7, -6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 7, -4, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 7, -3, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -3, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -3, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 7, -2, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 7, -2, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 7, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 7, -2, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -18, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -12, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 8, -10, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -9, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 8, -7, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 8, -6, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 8, -4, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 8, -3, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 8, -3, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 8, -3, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 8, -2, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 8, -2, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -19, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -13, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 9, -9, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 9, -7, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 9, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 9, -5, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 9, -5, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 0, 10, -22, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -22, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 10, -20, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 10, -20, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 10, -16, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 10, -13, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 10, -12, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 10, -10, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -21, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 11, -19, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 0, 11, -15, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 11, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 11, -13, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 11, -10, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -10, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 11, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -7, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 11, -7, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 0, 11, -7, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 11, -6, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 11, -6, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 12, -15, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 12, -14, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 12, -12, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 12, -8, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 12, -8, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 13, -20, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 13, -17, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 13, -16, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 13, -14, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 13, -11, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 13, -11, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 0, 14, -22, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 0, 14, -17, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 14, -15, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 14, -15, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 14, -9, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 15, -28, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 15, -18, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 16, -30, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 0, 16, -22, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 16, -19, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 16, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 16, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 16, -12, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -26, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 17, -26, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 17, -20, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 17, -19, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 17, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 17, -15, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 17, -11, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 0, 18, -21, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 18, -16, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 0, 18, -16, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 0, 19, -24, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 19, -24, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 20, -25, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 20, -25, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 20, -18, 0, 0, 0, 0, -3, 0, 0, 1},
+{0, 0, 20, -18, 0, 0, 0, 0, -3, 0, 2, 1},
+{0, 0, 21, -24, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 22, -26, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 22, -26, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 22, -25, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 23, -23, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 24, -28, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 24, -28, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 24, -27, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 24, -27, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 25, -29, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 25, -28, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 25, -28, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 27, -32, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 27, -31, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 27, -31, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 27, -30, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 27, -26, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 29, -35, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 29, -34, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 29, -34, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 29, -34, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 31, -36, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 31, -36, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 31, -36, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 31, -35, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 0, 31, -34, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 32, -39, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 0, 32, -39, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 0, 33, -37, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 0, 34, -41, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 0, 34, -41, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 0, 35, -44, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 40, -54, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 0, 51, -71, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 1, -7, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 1, -6, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 1, -4, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 1, -2, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 1, 2, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 1, 3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 1, 4, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, -8, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 2, -7, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 2, -2, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 2, 2, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 2, 3, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 2, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 3, -8, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 3, -7, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 3, -6, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 3, -2, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 3, 2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 3, 2, 0, 0, 0, 0, 0, 4, 0, -1, 0},
+{0, 3, 3, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, -1, 2},
+{0, 4, -9, 0, 0, 0, 0, 0, -2, 0, 1, 2},
+{0, 4, -9, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 4, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 4, -5, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 4, -3, 0, 0, 0, 0, 0, -2, 0, -3, 0},
+{0, 4, -3, 0, 0, 0, 0, 0, 1, 0, -2, 1},
+{0, 4, -3, 0, 0, 0, 0, 0, 3, 0, -3, -1},
+{0, 4, -2, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 4, -2, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 4, -1, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 4, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 4, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -12, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -11, 0, 0, 0, 0, 0, -2, 0, 0, 2},
+{0, 5, -10, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, -10, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 5, -6, 0, 0, 0, 0, 0, 0, 0, 3, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, -4, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -2, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 5, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 6, -12, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 6, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 6, -9, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 6, -8, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 6, -7, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 6, -7, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 6, -5, 0, 0, 0, 0, 0, 1, 0, -2, -1},
+{0, 6, -3, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 6, -1, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 7, -13, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 7, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 7, -9, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 7, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 2, 1},
+{0, 7, -8, 0, 0, 0, 0, 0, -1, 0, 3, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, -4, 0, 1, 0},
+{0, 7, -6, 0, 0, 0, 0, 0, 1, 0, 2, -1},
+{0, 7, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 7, -5, 0, 0, 0, 0, 0, 1, 0, 0, -1},
+{0, 7, -4, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 7, -3, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 7, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 7, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 8, -12, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -11, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 8, -10, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 8, -10, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 8, -7, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 8, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 8, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 8, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 9, -11, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 9, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 9, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 9, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 9, -4, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 9, -1, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 10, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -15, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -11, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, -3, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 10, -9, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -8, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 10, -7, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -6, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, 4, 0, -2, 0},
+{0, 10, -5, 0, 0, 0, 0, 0, 4, 0, 0, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 11, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -14, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 11, -12, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 11, -9, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 11, -8, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 2, 0, 0, 0},
+{0, 11, -7, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 11, -6, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 11, -5, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 12, -18, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 12, -14, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -13, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 12, -11, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 12, -11, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 12, -9, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 12, -7, 0, 0, 0, 0, 0, 2, 0, 1, 0},
+{0, 12, -6, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 12, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 12, -6, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 13, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 13, -18, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 13, -15, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 13, -15, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 13, -15, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 13, -12, 0, 0, 0, 0, 0, -4, 0, 0, 0},
+{0, 13, -12, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 13, -11, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 13, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 13, -6, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 14, -16, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 14, -16, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 14, -14, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 14, -13, 0, 0, 0, 0, 0, 0, 0, 1, 0},
+{0, 14, -13, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 14, -11, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 14, -10, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 14, -9, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 15, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 15, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -18, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 15, -17, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 15, -17, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 15, -16, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 15, -15, 0, 0, 0, 0, 0, -2, 0, -2, 0},
+{0, 15, -12, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 15, -9, 0, 0, 0, 0, 0, 2, 0, -2, -2},
+{0, 15, -9, 0, 0, 0, 0, 0, 2, 0, 0, -2},
+{0, 16, -17, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 16, -15, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 17, -22, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 17, -21, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -20, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 17, -19, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 17, -16, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 2, 0, -3, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 2, 0, -1, 0},
+{0, 17, -12, 0, 0, 0, 0, 0, 2, 0, 2, 0},
+{0, 18, -24, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -24, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, -2, 0, 3, 0},
+{0, 18, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 18, -22, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 18, -20, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 18, -19, 0, 0, 0, 0, 0, -3, 0, 2, 1},
+{0, 18, -19, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 18, -18, 0, 0, 0, 0, 0, -2, 0, -2, 2},
+{0, 18, -14, 0, 0, 0, 0, 0, 2, 0, -1, -2},
+{0, 19, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -21, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, -4, 0, 2, 0},
+{0, 19, -18, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 19, -16, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 19, -14, 0, 0, 0, 0, 0, 2, 0, -2, 0},
+{0, 20, -23, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -23, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 20, -22, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 20, -22, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 20, -22, 0, 0, 0, 0, 0, -1, 0, 2, -1},
+{0, 20, -22, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 20, -18, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 20, -17, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 20, -17, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 21, -23, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 21, -20, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 21, -20, 0, 0, 0, 0, 0, 0, 0, 1, -2},
+{0, 22, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 22, -26, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 22, -24, 0, 0, 0, 0, 0, -1, 0, -2, 1},
+{0, 22, -24, 0, 0, 0, 0, 0, -1, 0, 0, 1},
+{0, 22, -23, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 22, -20, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 23, -24, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 23, -21, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 24, -26, 0, 0, 0, 0, 0, -1, 0, -1, 1},
+{0, 24, -25, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 24, -25, 0, 0, 0, 0, 0, 1, 0, -3, 1},
+{0, 24, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 24, -23, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 25, -31, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -30, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -28, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 25, -27, 0, 0, 0, 0, 0, -1, 0, 1, -1},
+{0, 25, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -24, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 25, -24, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -33, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -32, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -31, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 26, -26, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 26, -25, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 26, -25, 0, 0, 0, 0, 0, -2, 0, 2, 0},
+{0, 26, -25, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 26, -25, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+{0, 28, -29, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 29, -35, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 29, -35, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -34, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 29, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 30, -35, 0, 0, 0, 0, 0, 0, 0, -2, 0},
+{0, 30, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 31, -38, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 31, -37, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{0, 31, -36, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -38, 0, 0, 0, 0, 0, 0, 0, -1, 0},
+{0, 32, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 32, -28, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -34, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 33, -31, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 34, -35, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 34, -30, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 37, -38, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 38, -36, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 40, -41, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 42, -44, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 43, -46, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 45, -47, 0, 0, 0, 0, 0, -1, 0, 0, -1},
+{0, 47, -52, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 48, -53, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 50, -57, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{0, 51, -58, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{5, 0, -9, 0, 0, 0, 0, 0, -2, 0, 1, 0},
+{9, 0, -13, 0, 0, 0, 0, 0, -2, 0, 0, 0},
+{13, 0, -16, 0, 0, 0, 0, 0, -2, 0, -1, 0},
+{0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 1, -5, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 1, -3, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 2, -1},
+{0, 0, 2, -7, 0, 0, 0, 0, -2, 0, 2, 1},
+{0, 0, 2, -6, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 2, -6, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 2, -6, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 2, -4, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 2, 4, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 2, 4, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 3, -11, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -11, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 3, -10, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 3, -10, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 3, -6, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 3, -3, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 3, -3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 3, 3, 0, 0, 0, 0, 2, 0, 0, -1},
+{0, 0, 4, -9, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 4, -9, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 4, -6, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 4, -5, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 4, -4, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 5, -12, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 5, -8, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 5, -7, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 0, 5, -6, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 6, -9, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 6, -8, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 6, -7, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 6, -5, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 7, -11, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 7, -8, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 7, -7, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 9, -21, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 0, 9, -21, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 0, 9, -15, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 0, 11, -17, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 11, -16, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 34, -41, 0, 0, 0, 0, -1, 0, -1, 0},
+{0, 0, 34, -41, 0, 0, 0, 0, -1, 0, -1, 2},
+{0, 1, -4, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 1, -3, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 2},
+{0, 2, -8, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 2, -8, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 2, -4, 0, 0, 0, 0, 0, -1, 0, 2, -2},
+{0, 2, -4, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 3, -7, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 4, -8, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 4, -6, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 5, -10, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 5, -8, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 5, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 5, -4, 0, 0, 0, 0, 0, 1, 0, -1, 2},
+{0, 6, -12, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 6, -9, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 6, -7, 0, 0, 0, 0, 0, 1, 0, 0, 2},
+{0, 6, -5, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+{0, 8, -15, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 8, -11, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 8, -9, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 9, -11, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 9, -9, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 10, -13, 0, 0, 0, 0, 0, -1, 0, 0, 0},
+{0, 10, -13, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, 0, 1},
+{0, 10, -9, 0, 0, 0, 0, 0, -2, 0, 0, 3},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 1, -2},
+{0, 11, -12, 0, 0, 0, 0, 0, -1, 0, 1, 0},
+{0, 11, -10, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 14, -15, 0, 0, 0, 0, 0, -1, 0, 0, 2},
+{0, 14, -15, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 14, -13, 0, 0, 0, 0, 0, 1, 0, 0, -2},
+{0, 15, -16, 0, 0, 0, 0, 0, -1, 0, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 1, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 3, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, 1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, -3},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 3, -1},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 1, -1, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 0, 1},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, -1, 1, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 4, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, -1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -4},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 3, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, -1, -1, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, -3, -2},
+{0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 3, 0},
+{0, 0, 1, 0, 0, 0, 0, 0, 5, -1, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -4, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -3, 0, -2},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 3, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 5, 1, -1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -2, 0, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, 1, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, 0, -2, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, 1, -3, 0},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -4, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -4, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 3, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, -1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, -1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -3, 0, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, -2, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, -3},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 1, -1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 1, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -2, 1},
+{0, 0, 0, 0, 0, 0, 0, 0, 6, -1, -3, 1},
+};
+
+const struct elp_args elp_main_args = {
+    main_arg[0], 4, 1953
+};
+
+const struct elp_args elp_earth_args = {
+    earth_arg[0], 5, 681
+};
+
+const struct elp_args elp_planet_args = {
+    planet_arg[0], 12, 21476
+};
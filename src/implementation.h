@@ -19,9 +19,50 @@
 #ifndef _LN_IMPLEMENTATION_H
 #define _LN_IMPLEMENTATION_H
 
+#include <math.h>
+
 #if !HAVE_STRTOK_R
 /* Catches calls to the POSIX strtok_r and converts them to a related WIN32 version. */
 char *strtok_r(char *str, const char *sep, char **last);
 #endif
 
+/* Storage class of the position caches, every thread keeps its own copy. */
+#if defined(_MSC_VER)
+#define LN_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define LN_THREAD_LOCAL _Thread_local
+#else
+#define LN_THREAD_LOCAL __thread
+#endif
+
+/* C11 atomics, used to publish tables built on first use. */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_ATOMICS__)
+#define LN_HAVE_ATOMICS 1
+#else
+#define LN_HAVE_ATOMICS 0
+#endif
+
+/* cosines and sines of k * angle for k = -n .. n using the angle addition
+ * formulas, c and s point to multiple 0 */
+static inline void get_multiples(double angle, double *c, double *s, int n)
+{
+    int k;
+
+    c[0] = 1.0;
+    s[0] = 0.0;
+    c[1] = cos(angle);
+    s[1] = sin(angle);
+
+    for (k = 2; k <= n; k++) {
+        c[k] = c[k - 1] * c[1] - s[k - 1] * s[1];
+        s[k] = s[k - 1] * c[1] + c[k - 1] * s[1];
+    }
+
+    for (k = 1; k <= n; k++) {
+        c[-k] = c[k];
+        s[-k] = -s[k];
+    }
+}
+
 #endif /* _LN_IMPLEMENTATION_H */
@@ -41,6 +41,22 @@ extern "C" {
 void LIBNOVA_EXPORT ln_get_equ_aber(struct ln_equ_posn *mean_position,
 	double JD, struct ln_equ_posn *position);
 
+/*! \fn void ln_get_earth_bary_vel(double JD, struct ln_rect_posn *velocity);
+* \brief Calculate the barycentric velocity of the Earth used for aberration.
+* \ingroup aberration
+*/
+/* Ron-Vondrak expression */
+void LIBNOVA_EXPORT ln_get_earth_bary_vel(double JD,
+	struct ln_rect_posn *velocity);
+
+/*! \fn void ln_get_equ_aber_earth_vel(struct ln_equ_posn *mean_position, const struct ln_rect_posn *velocity, struct ln_equ_posn *position);
+* \brief Calculate equatorial coordinates with the effects of aberration for a velocity of the Earth.
+* \ingroup aberration
+*/
+/* Equ 22.3, 22.4 */
+void LIBNOVA_EXPORT ln_get_equ_aber_earth_vel(struct ln_equ_posn *mean_position,
+	const struct ln_rect_posn *velocity, struct ln_equ_posn *position);
+
 /*! \fn void ln_get_ecl_aber(struct ln_lnlat_posn *mean_position, double JD, struct ln_lnlat_posn *position);
 * \brief Calculate ecliptical coordinates with the effects of aberration.
 * \ingroup aberration
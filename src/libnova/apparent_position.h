@@ -40,6 +40,15 @@ extern "C" {
 void LIBNOVA_EXPORT ln_get_apparent_posn(struct ln_equ_posn *mean_position,
 	struct ln_equ_posn *proper_motion, double JD, struct ln_equ_posn *position);
 
+/*! \fn void ln_get_apparent_posn_batch(const struct ln_equ_posn *mean_position, const struct ln_equ_posn *proper_motion, double JD, struct ln_equ_posn *position, int n, int threads);
+* \brief Calculate the apparent positions of many stars at one julian day.
+* \ingroup apparent
+*/
+void LIBNOVA_EXPORT ln_get_apparent_posn_batch(
+	const struct ln_equ_posn *mean_position,
+	const struct ln_equ_posn *proper_motion, double JD,
+	struct ln_equ_posn *position, int n, int threads);
+
 #ifdef __cplusplus
 };
 #endif
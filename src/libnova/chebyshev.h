@@ -0,0 +1,134 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_CHEBYSHEV_H
+#define _LN_CHEBYSHEV_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup chebyshev Chebyshev Ephemeris
+*
+* Chebyshev polynomial approximations of body positions over a range of
+* julian days.
+*
+* The window is split into segments of equal length and every coordinate
+* is fitted with a Chebyshev series on each segment. Evaluating a position
+* then costs a few dozen floating point operations instead of summing
+* the full theory. The maximum error of the fit against the theory is
+* measured when the ephemeris is built.
+*
+* All angles are expressed in degrees.
+*/
+
+/*! \struct ln_helio_cheb
+* \brief Chebyshev ephemeris of heliocentric coordinates.
+*
+* Holds the Chebyshev coefficients of heliocentric L, B, R and of the
+* rectangular coordinates returned by ln_get_rect_from_helio().
+*/
+struct ln_helio_cheb {
+	double JD_start;	/*!< First julian day of the ephemeris */
+	double JD_end;		/*!< Last julian day of the ephemeris */
+	double span;		/*!< Length of a segment in days */
+	int segments;		/*!< Number of segments */
+	int order;		/*!< Number of coefficients per coordinate */
+	double *coeff;		/*!< Coefficients, allocated by ln_helio_cheb_init() */
+	struct ln_helio_posn max_error;	/*!< Largest sampled fit error of L, B (degrees) and R (AU) */
+	double max_rect_error;	/*!< Largest sampled fit error of the rectangular coordinates (AU) */
+};
+
+/*! \fn int ln_helio_cheb_init(struct ln_helio_cheb *cheb, void (*get_helio_coords)(double, struct ln_helio_posn *), double JD_start, double JD_end, double span, int order);
+* \brief Fit a Chebyshev ephemeris to a heliocentric position function.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_helio_cheb_init(struct ln_helio_cheb *cheb,
+	void (*get_helio_coords)(double, struct ln_helio_posn *),
+	double JD_start, double JD_end, double span, int order);
+
+/*! \fn void ln_helio_cheb_free(struct ln_helio_cheb *cheb);
+* \brief Release the coefficients of a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+void LIBNOVA_EXPORT ln_helio_cheb_free(struct ln_helio_cheb *cheb);
+
+/*! \fn int ln_get_helio_cheb_coords(const struct ln_helio_cheb *cheb, double JD, struct ln_helio_posn *position);
+* \brief Calculate heliocentric coordinates from a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_get_helio_cheb_coords(const struct ln_helio_cheb *cheb,
+	double JD, struct ln_helio_posn *position);
+
+/*! \fn int ln_get_helio_cheb_rect(const struct ln_helio_cheb *cheb, double JD, struct ln_rect_posn *position);
+* \brief Calculate rectangular heliocentric coordinates from a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_get_helio_cheb_rect(const struct ln_helio_cheb *cheb,
+	double JD, struct ln_rect_posn *position);
+
+/*! \struct ln_lunar_cheb
+* \brief Chebyshev ephemeris of the geocentric lunar position.
+*
+* Holds the Chebyshev coefficients of the rectangular geocentric lunar
+* coordinates returned by ln_get_lunar_geo_posn().
+*/
+struct ln_lunar_cheb {
+	double JD_start;	/*!< First julian day of the ephemeris */
+	double JD_end;		/*!< Last julian day of the ephemeris */
+	double span;		/*!< Length of a segment in days */
+	int segments;		/*!< Number of segments */
+	int order;		/*!< Number of coefficients per coordinate */
+	double *coeff;		/*!< Coefficients, allocated by ln_lunar_cheb_init() */
+	double max_error;	/*!< Largest sampled fit error of the position (km) */
+	double max_vel_error;	/*!< Largest sampled fit error of the velocity (km/day) */
+};
+
+/*! \fn int ln_lunar_cheb_init(struct ln_lunar_cheb *cheb, double JD_start, double JD_end, double span, int order, double precision);
+* \brief Fit a Chebyshev ephemeris to the geocentric lunar position.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_lunar_cheb_init(struct ln_lunar_cheb *cheb,
+	double JD_start, double JD_end, double span, int order,
+	double precision);
+
+/*! \fn void ln_lunar_cheb_free(struct ln_lunar_cheb *cheb);
+* \brief Release the coefficients of a lunar Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+void LIBNOVA_EXPORT ln_lunar_cheb_free(struct ln_lunar_cheb *cheb);
+
+/*! \fn int ln_get_lunar_cheb_posn(const struct ln_lunar_cheb *cheb, double JD, struct ln_rect_posn *position);
+* \brief Calculate the geocentric lunar position from a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_get_lunar_cheb_posn(const struct ln_lunar_cheb *cheb,
+	double JD, struct ln_rect_posn *position);
+
+/*! \fn int ln_get_lunar_cheb_vel(const struct ln_lunar_cheb *cheb, double JD, struct ln_rect_posn *velocity);
+* \brief Calculate the geocentric lunar velocity from a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_get_lunar_cheb_vel(const struct ln_lunar_cheb *cheb,
+	double JD, struct ln_rect_posn *velocity);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
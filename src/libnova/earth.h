@@ -45,6 +45,27 @@ extern "C" {
 void LIBNOVA_EXPORT ln_get_earth_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_earth_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Earth heliocentric coordinates for an array of julian days
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_earth_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Earth heliocentric coordinates to a given precision
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_earth_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Earth heliocentric coordinates and their rates of change
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_earth_solar_dist(double JD);
 * \brief Calculate the distance between Earth and the Sun.
 * \ingroup earth
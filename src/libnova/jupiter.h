@@ -60,6 +60,27 @@ int LIBNOVA_EXPORT ln_get_jupiter_rst(double JD,
 void LIBNOVA_EXPORT ln_get_jupiter_helio_coords(double JD,
 		struct ln_helio_posn *position);
 
+/*! \fn void ln_get_jupiter_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Jupiter heliocentric coordinates for an array of julian days
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_jupiter_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Jupiter heliocentric coordinates to a given precision
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_jupiter_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Jupiter heliocentric coordinates and their rates of change
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_jupiter_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Jupiter's equatorial coordinates.
 * \ingroup jupiter
@@ -130,5 +130,8 @@
 #include <libnova/airmass.h>
 #include <libnova/heliocentric_time.h>
 #include <libnova/constellation.h>
+#include <libnova/chebyshev.h>
+#include <libnova/planets.h>
+#include <libnova/rotation.h>
 
 #endif
@@ -260,6 +260,17 @@ struct ln_gal_posn {
     double b;   /*!< Galactic latitude (degrees) */
 };
 
+/*!
+* \struct ln_rot_matrix
+* \brief Rotation matrix
+*
+* A 3 x 3 rotation between two frames of rectangular coordinates. A vector
+* v is rotated to m * v, the inverse rotation is the transpose.
+*/
+struct ln_rot_matrix {
+    double m[3][3]; /*!< Elements by row and column */
+};
+
 /*!
 * \struct ln_ell_orbit
 * \brief Elliptic Orbital elements
@@ -336,6 +347,44 @@ struct ln_nutation {
     double ecliptic;    /*!< Mean obliquity of the ecliptic, in degrees */
 };
 
+/*!
+* \enum ln_nutation_model
+* \brief Nutation models.
+*/
+enum ln_nutation_model {
+    LN_NUTATION_IAU1980 = 0,    /*!< IAU 1980, 63 terms of Meeus table 21A */
+    LN_NUTATION_IAU2000B        /*!< IAU 2000B, 77 luni-solar terms */
+};
+
+/*!
+* \enum ln_planet
+* \brief Planets with VSOP87 or Meeus theories.
+*
+* Identifies a planet in functions working on any of the planets.
+*/
+enum ln_planet {
+    LN_MERCURY = 0,     /*!< Mercury */
+    LN_VENUS,           /*!< Venus */
+    LN_EARTH,           /*!< Earth */
+    LN_MARS,            /*!< Mars */
+    LN_JUPITER,         /*!< Jupiter */
+    LN_SATURN,          /*!< Saturn */
+    LN_URANUS,          /*!< Uranus */
+    LN_NEPTUNE,         /*!< Neptune */
+    LN_PLUTO,           /*!< Pluto */
+    LN_PLANET_COUNT     /*!< Number of planets */
+};
+
+/*!
+* \struct ln_cache_stats
+* \brief Cache size and usage counters.
+*/
+struct ln_cache_stats {
+    int size;               /*!< Maximum number of cached entries */
+    unsigned long hits;     /*!< Lookups served from the cache */
+    unsigned long misses;   /*!< Lookups that had to be calculated */
+};
+
 #ifdef __cplusplus
 };
 #endif
@@ -56,6 +56,32 @@ int LIBNOVA_EXPORT ln_get_lunar_rst(double JD, struct ln_lnlat_posn *observer,
 void LIBNOVA_EXPORT ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon,
 	double precision);
 
+/*! \fn void ln_get_lunar_geo_posn_vel(double JD, struct ln_rect_posn *moon, struct ln_rect_posn *velocity, double precision);
+* \brief Calculate the rectangular geocentric lunar cordinates and velocity.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_geo_posn_vel(double JD,
+	struct ln_rect_posn *moon, struct ln_rect_posn *velocity,
+	double precision);
+
+/*! \fn int ln_set_lunar_threads(int threads);
+* \brief Set the number of threads summing the series of a lunar position.
+* \ingroup lunar
+*/
+int LIBNOVA_EXPORT ln_set_lunar_threads(int threads);
+
+/*! \fn int ln_lunar_load_tables(const char *filename);
+* \brief Use the ELP 2000-82B tables of a binary coefficient file.
+* \ingroup lunar
+*/
+int LIBNOVA_EXPORT ln_lunar_load_tables(const char *filename);
+
+/*! \fn void ln_lunar_unload_tables(void);
+* \brief Go back to the compiled in ELP 2000-82B tables.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_lunar_unload_tables(void);
+
 /*! \fn void ln_get_lunar_equ_coords_prec(double JD, struct ln_equ_posn *position, double precision);
 * \brief Calculate lunar equatorial coordinates.
 * \ingroup lunar
@@ -77,6 +103,14 @@ void LIBNOVA_EXPORT ln_get_lunar_equ_coords(double JD,
 void LIBNOVA_EXPORT ln_get_lunar_ecl_coords(double JD,
 	struct ln_lnlat_posn *position, double precision);
 
+/*! \fn void ln_get_lunar_ecl_coords_vel(double JD, struct ln_lnlat_posn *position, struct ln_lnlat_posn *velocity, double precision);
+* \brief Calculate lunar ecliptical coordinates and their rates of change.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_ecl_coords_vel(double JD,
+	struct ln_lnlat_posn *position, struct ln_lnlat_posn *velocity,
+	double precision);
+
 /*! \fn double ln_get_lunar_phase(double JD);
 * \brief Calculate the phase angle of the Moon.
 * \ingroup lunar
@@ -53,6 +53,27 @@ int LIBNOVA_EXPORT ln_get_mars_rst(double JD, struct ln_lnlat_posn *observer,
 void LIBNOVA_EXPORT ln_get_mars_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_mars_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Mars heliocentric coordinates for an array of julian days
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_mars_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Mars heliocentric coordinates to a given precision
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_mars_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Mars heliocentric coordinates and their rates of change
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_mars_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Mars equatorial coordinates
 * \ingroup mars
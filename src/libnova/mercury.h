@@ -53,6 +53,27 @@ int LIBNOVA_EXPORT ln_get_mercury_rst(double JD,
 void LIBNOVA_EXPORT ln_get_mercury_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_mercury_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Mercury heliocentric coordinates for an array of julian days
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_mercury_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Mercury heliocentric coordinates to a given precision
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_mercury_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Mercury heliocentric coordinates and their rates of change
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_mercury_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Mercury's equatorial coordinates
 * \ingroup mercury
@@ -53,6 +53,27 @@ int LIBNOVA_EXPORT ln_get_neptune_rst(double JD,
 void LIBNOVA_EXPORT ln_get_neptune_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_neptune_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Neptune heliocentric coordinates for an array of julian days
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_neptune_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Neptune heliocentric coordinates to a given precision
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_neptune_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Neptune heliocentric coordinates and their rates of change
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_neptune_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Neptune's equatorial coordinates.
 * \ingroup neptune
@@ -35,6 +35,67 @@ extern "C" {
 * All angles are expressed in degrees.
 */
 
+/*! \def LN_NUTATION_SPAN
+* \brief Length in days of the window interpolated by a nutation context.
+* \ingroup nutation
+*/
+#define LN_NUTATION_SPAN	1.0
+
+/*! \def LN_NUTATION_ORDER
+* \brief Number of Chebyshev coefficients of a nutation context.
+* \ingroup nutation
+*/
+#define LN_NUTATION_ORDER	8
+
+/*! \def LN_NUTATION_HITS
+* \brief Consecutive close julian days before a nutation context is fitted.
+* \ingroup nutation
+*/
+#define LN_NUTATION_HITS	2
+
+/*! \struct ln_nutation_ctx
+* \brief Nutation context.
+*
+* Chebyshev polynomials of the nutation over a short window, refitted by
+* ln_get_nutation_ctx() when close julian days leave the window. A context
+* filled with zeros is empty.
+*/
+struct ln_nutation_ctx {
+	double JD_start;	/*!< First julian day of the window */
+	double JD_end;		/*!< Last julian day of the window */
+	double JD_last;		/*!< Previous julian day */
+	int fitted;		/*!< Non zero when the window is fitted */
+	int last;		/*!< Non zero when JD_last is set */
+	int hits;		/*!< Consecutive julian days close to the previous one */
+	enum ln_nutation_model model;	/*!< Nutation model of the coefficients */
+	double coeff[3][LN_NUTATION_ORDER];	/*!< Coefficients of longitude, obliquity and ecliptic */
+};
+
+/*! \fn int ln_set_nutation_model(enum ln_nutation_model model);
+* \ingroup nutation
+* \brief Select the nutation model.
+*/
+int LIBNOVA_EXPORT ln_set_nutation_model(enum ln_nutation_model model);
+
+/*! \fn enum ln_nutation_model ln_get_nutation_model(void);
+* \ingroup nutation
+* \brief Get the selected nutation model.
+*/
+enum ln_nutation_model LIBNOVA_EXPORT ln_get_nutation_model(void);
+
+/*! \fn void ln_nutation_ctx_init(struct ln_nutation_ctx *ctx);
+* \ingroup nutation
+* \brief Initialise an empty nutation context.
+*/
+void LIBNOVA_EXPORT ln_nutation_ctx_init(struct ln_nutation_ctx *ctx);
+
+/*! \fn void ln_get_nutation_ctx(struct ln_nutation_ctx *ctx, double JD, struct ln_nutation *nutation);
+* \ingroup nutation
+* \brief Calculate nutation using a nutation context.
+*/
+void LIBNOVA_EXPORT ln_get_nutation_ctx(struct ln_nutation_ctx *ctx,
+	double JD, struct ln_nutation *nutation);
+
 /*! \fn void ln_get_nutation(double JD, struct ln_nutation *nutation);
 * \ingroup nutation
 * \brief Calculate nutation. 
@@ -46,6 +107,13 @@ void LIBNOVA_EXPORT ln_get_nutation(double JD, struct ln_nutation *nutation);
 * \ingroup nutation
 */
 void LIBNOVA_EXPORT ln_get_equ_nut(struct ln_equ_posn *mean_position, double JD, struct ln_equ_posn *position);
+
+/*! \fn void ln_get_nutation_matrix(double JD, struct ln_rot_matrix *matrix);
+* \brief Get the nutation as a rotation matrix.
+* \ingroup nutation
+*/
+void LIBNOVA_EXPORT ln_get_nutation_matrix(double JD,
+	struct ln_rot_matrix *matrix);
 	
 #ifdef __cplusplus
 };
@@ -0,0 +1,91 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_PLANETS_H
+#define _LN_PLANETS_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup planets Planets
+*
+* Functions common to all planets.
+*
+* Every planet keeps a small cache of heliocentric positions keyed by
+* julian day, so positions requested again shortly after are not summed
+* again. Each thread has its own cache and counters.
+*
+* The positions of all planets for a single julian day can be calculated
+* in one call, sharing the position of the Earth between them.
+*/
+
+/* largest number of cached positions per planet */
+#define LN_HELIO_CACHE_MAX	16
+
+/* number of cached positions per planet unless changed */
+#define LN_HELIO_CACHE_DEFAULT	4
+
+/*! \struct ln_planet_posn
+* \brief Geocentric position of a planet.
+*
+* Geometric position of a planet as seen from the centre of the Earth,
+* corrected for light time and referred to the FK5 frame and the J2000
+* ecliptic.
+*
+* Angles are expressed in degrees, distances in AU.
+*/
+struct ln_planet_posn {
+	struct ln_equ_posn equ;		/*!< Equatorial coordinates */
+	struct ln_lnlat_posn ecl;	/*!< Ecliptical coordinates */
+	double earth_dist;		/*!< Distance from the Earth */
+	double solar_dist;		/*!< Distance from the Sun */
+	double light_time;		/*!< Light time the position was calculated for, in days */
+};
+
+/*! \fn int ln_set_helio_cache_size(enum ln_planet planet, int size);
+* \brief Set the number of heliocentric positions cached for a planet.
+* \ingroup planets
+*/
+int LIBNOVA_EXPORT ln_set_helio_cache_size(enum ln_planet planet, int size);
+
+/*! \fn int ln_get_helio_cache_stats(enum ln_planet planet, struct ln_cache_stats *stats);
+* \brief Get size and hit and miss counters of a planet cache.
+* \ingroup planets
+*/
+int LIBNOVA_EXPORT ln_get_helio_cache_stats(enum ln_planet planet,
+	struct ln_cache_stats *stats);
+
+/*! \fn int ln_reset_helio_cache(enum ln_planet planet);
+* \brief Empty a planet cache and clear its counters.
+* \ingroup planets
+*/
+int LIBNOVA_EXPORT ln_reset_helio_cache(enum ln_planet planet);
+
+/*! \fn void ln_get_planets_posn(double JD, struct ln_planet_posn *positions, int threads);
+* \brief Calculate geocentric positions of all planets.
+* \ingroup planets
+*/
+void LIBNOVA_EXPORT ln_get_planets_posn(double JD,
+	struct ln_planet_posn *positions, int threads);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -59,6 +59,20 @@ void LIBNOVA_EXPORT ln_get_equ_prec2(struct ln_equ_posn *mean_position,
 void LIBNOVA_EXPORT ln_get_ecl_prec(struct ln_lnlat_posn *mean_position,
 	double JD, struct ln_lnlat_posn *position);
 
+/*! \fn void ln_get_prec_matrix(double JD, struct ln_rot_matrix *matrix);
+* \brief Get the precession from J2000 as a rotation matrix.
+* \ingroup precession
+*/
+void LIBNOVA_EXPORT ln_get_prec_matrix(double JD,
+	struct ln_rot_matrix *matrix);
+
+/*! \fn void ln_get_prec2_matrix(double fromJD, double toJD, struct ln_rot_matrix *matrix);
+* \brief Get the precession between arbitary epochs as a rotation matrix.
+* \ingroup precession
+*/
+void LIBNOVA_EXPORT ln_get_prec2_matrix(double fromJD, double toJD,
+	struct ln_rot_matrix *matrix);
+
 #ifdef __cplusplus
 };
 #endif
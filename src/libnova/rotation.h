@@ -0,0 +1,98 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_ROTATION_H
+#define _LN_ROTATION_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup rotation Rotation matrices
+*
+* Rotation matrices between frames of rectangular coordinates.
+*
+* Precession, nutation and the ecliptical and galactic frames are also
+* available as rotation matrices, see ln_get_prec_matrix(),
+* ln_get_prec2_matrix(), ln_get_nutation_matrix(), ln_get_ecl_matrix() and
+* ln_get_gal_matrix(). The matrices of one epoch can be multiplied into a
+* single rotation and applied to many positions with a matrix vector
+* product each.
+*/
+
+/*! \fn void ln_get_rot_matrix_identity(struct ln_rot_matrix *matrix);
+* \brief Get the identity rotation.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_get_rot_matrix_identity(struct ln_rot_matrix *matrix);
+
+/*! \fn void ln_rot_matrix_mul(const struct ln_rot_matrix *a, const struct ln_rot_matrix *b, struct ln_rot_matrix *product);
+* \brief Combine two rotations.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_rot_matrix_mul(const struct ln_rot_matrix *a,
+	const struct ln_rot_matrix *b, struct ln_rot_matrix *product);
+
+/*! \fn void ln_rot_matrix_transpose(const struct ln_rot_matrix *matrix, struct ln_rot_matrix *inverse);
+* \brief Get the inverse rotation.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_rot_matrix_transpose(const struct ln_rot_matrix *matrix,
+	struct ln_rot_matrix *inverse);
+
+/*! \fn void ln_rot_matrix_apply(const struct ln_rot_matrix *matrix, const struct ln_rect_posn *vector, struct ln_rect_posn *result);
+* \brief Rotate a vector.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_rot_matrix_apply(const struct ln_rot_matrix *matrix,
+	const struct ln_rect_posn *vector, struct ln_rect_posn *result);
+
+/*! \fn void ln_rot_matrix_apply_batch(const struct ln_rot_matrix *matrix, const struct ln_rect_posn *vectors, struct ln_rect_posn *result, int n);
+* \brief Rotate an array of vectors.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_rot_matrix_apply_batch(
+	const struct ln_rot_matrix *matrix, const struct ln_rect_posn *vectors,
+	struct ln_rect_posn *result, int n);
+
+/*! \fn void ln_rot_matrix_apply_equ(const struct ln_rot_matrix *matrix, const struct ln_equ_posn *position, struct ln_equ_posn *result);
+* \brief Rotate spherical coordinates.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_rot_matrix_apply_equ(const struct ln_rot_matrix *matrix,
+	const struct ln_equ_posn *position, struct ln_equ_posn *result);
+
+/*! \fn void ln_get_rect_from_equ(const struct ln_equ_posn *position, struct ln_rect_posn *vector);
+* \brief Get the unit vector of spherical coordinates.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_get_rect_from_equ(const struct ln_equ_posn *position,
+	struct ln_rect_posn *vector);
+
+/*! \fn void ln_get_equ_from_rect(const struct ln_rect_posn *vector, struct ln_equ_posn *position);
+* \brief Get the spherical coordinates of a vector.
+* \ingroup rotation
+*/
+void LIBNOVA_EXPORT ln_get_equ_from_rect(const struct ln_rect_posn *vector,
+	struct ln_equ_posn *position);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -59,6 +59,27 @@ int LIBNOVA_EXPORT ln_get_saturn_rst(double JD, struct ln_lnlat_posn *observer,
 void LIBNOVA_EXPORT ln_get_saturn_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_saturn_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Saturn heliocentric coordinates for an array of julian days
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_saturn_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Saturn heliocentric coordinates to a given precision
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_saturn_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Saturn heliocentric coordinates and their rates of change
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_saturn_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Saturn's equatorial coordinates.
 * \ingroup saturn
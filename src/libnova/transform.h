@@ -119,6 +119,25 @@ void LIBNOVA_EXPORT ln_get_gal_from_equ(struct ln_equ_posn *equ,
 void LIBNOVA_EXPORT ln_get_gal_from_equ2000(struct ln_equ_posn *equ,
 	struct ln_gal_posn *gal);
 
+/*! \fn void ln_get_ecl_matrix(double JD, struct ln_rot_matrix *matrix);
+* \ingroup transform
+* \brief Get the rotation from equatorial to ecliptical coordinates.
+*/
+void LIBNOVA_EXPORT ln_get_ecl_matrix(double JD,
+	struct ln_rot_matrix *matrix);
+
+/*! \fn void ln_get_gal_matrix(struct ln_rot_matrix *matrix);
+* \ingroup transform
+* \brief Get the rotation from B1950 equatorial to galactic coordinates.
+*/
+void LIBNOVA_EXPORT ln_get_gal_matrix(struct ln_rot_matrix *matrix);
+
+/*! \fn void ln_get_gal2000_matrix(struct ln_rot_matrix *matrix);
+* \ingroup transform
+* \brief Get the rotation from J2000 equatorial to galactic coordinates.
+*/
+void LIBNOVA_EXPORT ln_get_gal2000_matrix(struct ln_rot_matrix *matrix);
+
 #ifdef __cplusplus
 };
 #endif
@@ -54,6 +54,27 @@ int LIBNOVA_EXPORT ln_get_uranus_rst(double JD, struct ln_lnlat_posn *observer,
 void LIBNOVA_EXPORT ln_get_uranus_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_uranus_helio_coords_batch(const double *JD, struct ln_helio_posn *position, int n);
+* \brief Calculate Uranus heliocentric coordinates for an array of julian days
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_batch(const double *JD,
+	struct ln_helio_posn *position, int n);
+
+/*! \fn void ln_get_uranus_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Uranus heliocentric coordinates to a given precision
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_uranus_helio_coords_vel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Uranus heliocentric coordinates and their rates of change
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_vel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
 /*! \fn void ln_get_uranus_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Uranus equatorial coordinates.
 * \ingroup uranus
@@ -51,6 +51,58 @@ struct ln_vsop
 double LIBNOVA_EXPORT ln_calc_series(const struct ln_vsop *data, int terms,
 	double t);
 
+/*! \fn int ln_vsop87_load_tables(const char *filename);
+* \ingroup VSOP87
+* \brief Use the VSOP87 series of a binary coefficient file.
+*/
+int LIBNOVA_EXPORT ln_vsop87_load_tables(const char *filename);
+
+/*! \fn void ln_vsop87_unload_tables(void);
+* \ingroup VSOP87
+* \brief Go back to the compiled in VSOP87 series.
+*/
+void LIBNOVA_EXPORT ln_vsop87_unload_tables(void);
+
+/* default number of steps between exact evaluations of a stepper */
+#define LN_VSOP87_STEPPER_RESYNC	256
+
+/*! \struct ln_vsop87_stepper
+* \brief VSOP87 evaluator for positions at a constant step.
+*
+* Keeps the cosine and sine of every VSOP87 term and advances them by a
+* rotation of the term angle on every step, so only multiplications and
+* additions are needed between the exact evaluations.
+*/
+struct ln_vsop87_stepper {
+	double JD0;		/*!< First julian day */
+	double step;		/*!< Step in days */
+	long steps;		/*!< Number of positions returned */
+	int resync;		/*!< Number of steps between exact evaluations */
+	int terms;		/*!< Number of terms of the planet */
+	const void *planet;	/*!< VSOP87 series of the planet */
+	double *state;		/*!< Term angles and step rotations, allocated by ln_vsop87_stepper_init() */
+};
+
+/*! \fn int ln_vsop87_stepper_init(struct ln_vsop87_stepper *stepper, enum ln_planet planet, double JD, double step, int resync);
+* \ingroup VSOP87
+* \brief Initialise a VSOP87 stepper for a planet.
+*/
+int LIBNOVA_EXPORT ln_vsop87_stepper_init(struct ln_vsop87_stepper *stepper,
+	enum ln_planet planet, double JD, double step, int resync);
+
+/*! \fn void ln_vsop87_stepper_free(struct ln_vsop87_stepper *stepper);
+* \ingroup VSOP87
+* \brief Release the state of a VSOP87 stepper.
+*/
+void LIBNOVA_EXPORT ln_vsop87_stepper_free(struct ln_vsop87_stepper *stepper);
+
+/*! \fn double ln_vsop87_stepper_next(struct ln_vsop87_stepper *stepper, struct ln_helio_posn *position);
+* \ingroup VSOP87
+* \brief Calculate the next heliocentric position of a VSOP87 stepper.
+*/
+double LIBNOVA_EXPORT ln_vsop87_stepper_next(struct ln_vsop87_stepper *stepper,
+	struct ln_helio_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
@@ -1,28 +1,46 @@
-/* used for elp1 - 3 */
-struct main_problem
-{
-	double ilu[4];
-	double A;
-	double B[6];
-};
+#ifndef _LN_LUNAR_PRIV_H
+#define _LN_LUNAR_PRIV_H
+
+#include <stdint.h>
 
-/* used for elp 4 - 9 */
-struct earth_pert
+/* alignment of the coefficient arrays of the ELP tables */
+#if defined(_MSC_VER)
+#define ELP_ALIGNED	__declspec(align(64))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define ELP_ALIGNED	_Alignas(64)
+#else
+#define ELP_ALIGNED	__attribute__((aligned(64)))
+#endif
+
+/* unique arguments of all ELP tables of a row type, generated by
+ * tools/elp82. Argument i has the integer multipliers arg[i * args] of the
+ * fundamental arguments, the Delaunay arguments for the main problem
+ * (elp1 - 3), zeta and the linear Delaunay arguments for the Earth figure
+ * like perturbations and the 8 planetary and 4 linear Delaunay arguments
+ * for the planetary perturbations (elp10 - 21). Arguments are numbered by
+ * decreasing importance. */
+struct elp_args
 {
-	double iz;
-	double ilu[4];
-	double O;
-	double A;
-	double P;
-}; 
+	const int8_t *arg;
+	int args;
+	int size;
+};
 
-/* used for elp 10 - 21 */
-struct planet_pert
+/* ELP series in packed form, generated by tools/elp82. Row j is the term
+ * c[j] * sin(x) + s[j] * cos(x) of argument x number arg[j] of the
+ * dictionary of its row type. Rows are sorted by decreasing |amp|. */
+struct elp_table
 {
-	double ipla[11];
-	double theta;
-	double O;
-	double P;
+	const uint16_t *arg;
+	const uint16_t *max_arg;	/* largest argument of rows 0 - j */
+	const double *amp;	/* amplitude, corrected for DE200/LE200 in elp1 - 3 */
+	const double *c;
+	const double *s;
+	int size;
 };
 
+extern const struct elp_args elp_main_args;
+extern const struct elp_args elp_earth_args;
+extern const struct elp_args elp_planet_args;
 
+#endif
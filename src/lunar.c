@@ -28,11 +28,19 @@
 #include <libnova/transform.h>
 #include <libnova/rise_set.h>
 #include <libnova/utility.h>
+#include "implementation.h"
 #include "lunar-priv.h"
+#include "coeff-file-priv.h"
+#include "elp-file.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
 #ifdef HAVE_LIBsunmath
 #include <sunmath.h>
 #endif
@@ -86,20 +94,12 @@
 #define     PIS2    (M_PI / 2.0)
 #define     ATH     384747.9806743165
 #define     A0      384747.9806448954
-#define     AM      0.074801329518
-#define     ALPHA   0.002571881335
-#define     DTASM   (2.0 * ALPHA / (3.0 * AM))
-#define     W12     (1732559343.73604 / RAD)
 #define     PRECES  (5029.0966 / RAD)
 #define     C1      60.0
 #define     C2      3600.0
 
-/* Corrections of the constants for DE200/LE200 */
-#define     DELNU   ((0.55604 / RAD) / W12)
-#define     DELE    (0.01789 / RAD)
-#define     DELG    (-0.08066 / RAD)
-#define     DELNP   ((-0.06424 / RAD) / W12)
-#define     DELEP   (-0.12879 / RAD)
+/* Corrections of the constants for DE200/LE200 are applied to the main
+ * problem amplitudes by tools/elp82 */
 
 /*     Precession matrix */
 #define     P1      0.10180391e-4
@@ -191,851 +191,761 @@ static const double p[8][2] =
     {(304.0 + 20.0 / C1 + 55.19575 / C2) * DEG, 786550.32074 / RAD }
 };
 
-extern const struct main_problem elp1[];
-extern const struct main_problem elp2[];
-extern const struct main_problem elp3[];
-extern const struct earth_pert elp4[];
-extern const struct earth_pert elp5[];
-extern const struct earth_pert elp6[];
-extern const struct earth_pert elp7[];
-extern const struct earth_pert elp8[];
-extern const struct earth_pert elp9[];
-extern const struct planet_pert elp10[];
-extern const struct planet_pert elp11[];
-extern const struct planet_pert elp12[];
-extern const struct planet_pert elp13[];
-extern const struct planet_pert elp14[];
-extern const struct planet_pert elp15[];
-extern const struct planet_pert elp16[];
-extern const struct planet_pert elp17[];
-extern const struct planet_pert elp18[];
-extern const struct planet_pert elp19[];
-extern const struct planet_pert elp20[];
-extern const struct planet_pert elp21[];
-extern const struct earth_pert elp22[];
-extern const struct earth_pert elp23[];
-extern const struct earth_pert elp24[];
-extern const struct earth_pert elp25[];
-extern const struct earth_pert elp26[];
-extern const struct earth_pert elp27[];
-extern const struct earth_pert elp28[];
-extern const struct earth_pert elp29[];
-extern const struct earth_pert elp30[];
-extern const struct earth_pert elp31[];
-extern const struct earth_pert elp32[];
-extern const struct earth_pert elp33[];
-extern const struct earth_pert elp34[];
-extern const struct earth_pert elp35[];
-extern const struct earth_pert elp36[];
-
-/* sum lunar elp1 series */
-static double sum_series_elp1 (double* t)
-{
-    double result = 0;
-    double x,y;
-    double tgv;
-    int i,j,k;
-
-    for (j = 0; j < ELP1_SIZE; j++) {
-        /* derivatives of A */
-        tgv = elp1[j].B[0] + DTASM * elp1[j].B[4];
-        x = elp1[j].A + tgv * (DELNP - AM * DELNU) +
-            elp1[j].B[1] * DELG + elp1[j].B[2] *
-            DELE + elp1[j].B[3] * DELEP;
-
-        y = 0;
-        for (k = 0; k < 5; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp1[j].ilu[i] * del[i][k] * t[k];
-        }
+/* rows of every table are sorted by decreasing amplitude */
+extern const struct elp_table elp1;
+extern const struct elp_table elp2;
+extern const struct elp_table elp3;
+extern const struct elp_table elp4;
+extern const struct elp_table elp5;
+extern const struct elp_table elp6;
+extern const struct elp_table elp7;
+extern const struct elp_table elp8;
+extern const struct elp_table elp9;
+extern const struct elp_table elp10;
+extern const struct elp_table elp11;
+extern const struct elp_table elp12;
+extern const struct elp_table elp13;
+extern const struct elp_table elp14;
+extern const struct elp_table elp15;
+extern const struct elp_table elp16;
+extern const struct elp_table elp17;
+extern const struct elp_table elp18;
+extern const struct elp_table elp19;
+extern const struct elp_table elp20;
+extern const struct elp_table elp21;
+extern const struct elp_table elp22;
+extern const struct elp_table elp23;
+extern const struct elp_table elp24;
+extern const struct elp_table elp25;
+extern const struct elp_table elp26;
+extern const struct elp_table elp27;
+extern const struct elp_table elp28;
+extern const struct elp_table elp29;
+extern const struct elp_table elp30;
+extern const struct elp_table elp31;
+extern const struct elp_table elp32;
+extern const struct elp_table elp33;
+extern const struct elp_table elp34;
+extern const struct elp_table elp35;
+extern const struct elp_table elp36;
+
+/* row types of the ELP tables, the tables of a type share a dictionary of
+ * arguments */
+enum elp_type {
+    ELP_MAIN,       /* main problem, 4 multipliers */
+    ELP_EARTH,      /* Earth figure like perturbations, 5 multipliers */
+    ELP_PLANET      /* planetary perturbations, 12 multipliers */
+};
 
-        /* y in correct quad */
-        y = ln_range_radians2(y);
-        result += x * sin(y);
-    }
-    return result;
-}
+#define ELP_TYPES   3
 
-/* sum lunar elp2 series */
-static double sum_series_elp2 (double* t)
-{
-    double result = 0;
-    double x,y;
-    double tgv;
-    int i,j,k;
-
-    for (j = 0; j < ELP2_SIZE; j++) {
-        /* derivatives of A */
-        tgv = elp2[j].B[0] + DTASM * elp2[j].B[4];
-        x = elp2[j].A + tgv * (DELNP - AM * DELNU) +
-            elp2[j].B[1] * DELG + elp2[j].B[2] *
-            DELE + elp2[j].B[3] * DELEP;
-
-        y = 0;
-        for (k = 0; k < 5; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp2[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* y in correct quad */
-        y = ln_range_radians2(y);
-        result += x * sin(y);
-    }
-    return result;
-}
+/* unique arguments of every row type */
+#define ELP_MAIN_ARGS   1953
+#define ELP_EARTH_ARGS  681
+#define ELP_PLANET_ARGS 21476
 
-/* sum lunar elp3 series */
-static double sum_series_elp3 (double* t)
-{
-    double result = 0;
-    double x,y;
-    double tgv;
-    int i,j,k;
-
-    for (j = 0; j < ELP3_SIZE; j++) {
-        /* derivatives of A */
-        tgv = elp3[j].B[0] + DTASM * elp3[j].B[4];
-        x = elp3[j].A + tgv * (DELNP - AM * DELNU) +
-            elp3[j].B[1] * DELG + elp3[j].B[2] *
-            DELE + elp3[j].B[3] * DELEP;
-
-        y = 0;
-        for (k = 0; k < 5; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp3[j].ilu[i] * del[i][k] * t[k];
-        }
-        y += (M_PI_2);
-        /* y in correct quad */
-        y = ln_range_radians2(y);
-        result += x * sin(y);
-    }
-    return result;
-}
+/* largest number of multipliers of an argument */
+#define ELP_MAX_MULT    12
 
+/* compiled in dictionary of arguments of every row type */
+static const struct elp_args *const elp_dict_builtin[ELP_TYPES] = {
+    &elp_main_args, &elp_earth_args, &elp_planet_args
+};
 
-/* sum lunar elp4 series */
-static double sum_series_elp4(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP4_SIZE; j++) {
-        y = elp4[j].O * DEG;
-        for (k = 0; k < 2; k++)  {
-            y += elp4[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp4[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp4[j].A * sin(y);
-    }
-    return result;
-}
+/* dictionaries in use, either compiled in or loaded from a file */
+static const struct elp_args *elp_dict[ELP_TYPES] = {
+    &elp_main_args, &elp_earth_args, &elp_planet_args
+};
 
-/* sum lunar elp5 series */
-static double sum_series_elp5(double *t)
+/* coordinate a series contributes to */
+enum elp_coord {
+    ELP_LONGITUDE,
+    ELP_LATITUDE,
+    ELP_DISTANCE
+};
+
+/* description of an ELP series */
+struct elp_series
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP5_SIZE; j++) {
-        y = elp5[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp5[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp5[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp5[j].A * sin(y);
-    }
-    return result;
-}
+    enum elp_type type;
+    int power;              /* amplitudes are multiplied by t^power */
+    enum elp_coord coord;
+};
 
+#define ELP_SERIES  36
+
+/* all series of the ELP 2000-82B theory, series i sums table elp<i + 1> */
+static const struct elp_series elp_series[ELP_SERIES] = {
+    {ELP_MAIN, 0, ELP_LONGITUDE},
+    {ELP_MAIN, 0, ELP_LATITUDE},
+    {ELP_MAIN, 0, ELP_DISTANCE},
+    {ELP_EARTH, 0, ELP_LONGITUDE},
+    {ELP_EARTH, 0, ELP_LATITUDE},
+    {ELP_EARTH, 0, ELP_DISTANCE},
+    {ELP_EARTH, 1, ELP_LONGITUDE},
+    {ELP_EARTH, 1, ELP_LATITUDE},
+    {ELP_EARTH, 1, ELP_DISTANCE},
+    {ELP_PLANET, 0, ELP_LONGITUDE},
+    {ELP_PLANET, 0, ELP_LATITUDE},
+    {ELP_PLANET, 0, ELP_DISTANCE},
+    {ELP_PLANET, 1, ELP_LONGITUDE},
+    {ELP_PLANET, 1, ELP_LATITUDE},
+    {ELP_PLANET, 1, ELP_DISTANCE},
+    {ELP_PLANET, 0, ELP_LONGITUDE},
+    {ELP_PLANET, 0, ELP_LATITUDE},
+    {ELP_PLANET, 0, ELP_DISTANCE},
+    {ELP_PLANET, 1, ELP_LONGITUDE},
+    {ELP_PLANET, 1, ELP_LATITUDE},
+    {ELP_PLANET, 1, ELP_DISTANCE},
+    {ELP_EARTH, 0, ELP_LONGITUDE},
+    {ELP_EARTH, 0, ELP_LATITUDE},
+    {ELP_EARTH, 0, ELP_DISTANCE},
+    {ELP_EARTH, 1, ELP_LONGITUDE},
+    {ELP_EARTH, 1, ELP_LATITUDE},
+    {ELP_EARTH, 1, ELP_DISTANCE},
+    {ELP_EARTH, 0, ELP_LONGITUDE},
+    {ELP_EARTH, 0, ELP_LATITUDE},
+    {ELP_EARTH, 0, ELP_DISTANCE},
+    {ELP_EARTH, 0, ELP_LONGITUDE},
+    {ELP_EARTH, 0, ELP_LATITUDE},
+    {ELP_EARTH, 0, ELP_DISTANCE},
+    {ELP_EARTH, 2, ELP_LONGITUDE},
+    {ELP_EARTH, 2, ELP_LATITUDE},
+    {ELP_EARTH, 2, ELP_DISTANCE},
+};
 
-/* sum lunar elp6 series */
-static double sum_series_elp6(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP6_SIZE; j++) {
-        y = elp6[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp6[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp6[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp6[j].A * sin(y);
-    }
-    return result;
-}
+/* compiled in tables of all series */
+static const struct elp_table *const elp_builtin[ELP_SERIES] = {
+    &elp1, &elp2, &elp3, &elp4, &elp5, &elp6, &elp7, &elp8, &elp9,
+    &elp10, &elp11, &elp12, &elp13, &elp14, &elp15, &elp16, &elp17, &elp18,
+    &elp19, &elp20, &elp21, &elp22, &elp23, &elp24, &elp25, &elp26, &elp27,
+    &elp28, &elp29, &elp30, &elp31, &elp32, &elp33, &elp34, &elp35, &elp36
+};
 
-/* sum lunar elp7 series */
-static double sum_series_elp7(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP7_SIZE; j++) {
-        A = elp7[j].A * t[1];
-        y = elp7[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp7[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp7[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
-    }
-    return result;
-}
+/* tables in use, either compiled in or loaded from a file */
+static const struct elp_table *elp_tables[ELP_SERIES] = {
+    &elp1, &elp2, &elp3, &elp4, &elp5, &elp6, &elp7, &elp8, &elp9,
+    &elp10, &elp11, &elp12, &elp13, &elp14, &elp15, &elp16, &elp17, &elp18,
+    &elp19, &elp20, &elp21, &elp22, &elp23, &elp24, &elp25, &elp26, &elp27,
+    &elp28, &elp29, &elp30, &elp31, &elp32, &elp33, &elp34, &elp35, &elp36
+};
 
-/* sum lunar elp8 series */
-static double sum_series_elp8(double *t)
+/* tables and dictionaries loaded from a coefficient file and the file
+ * contents */
+static struct elp_table elp_loaded[ELP_SERIES];
+static struct elp_args elp_loaded_args[ELP_TYPES];
+static struct coeff_file elp_file;
+
+/* rows of all series */
+#define ELP_ROWS    (ELP1_SIZE + ELP2_SIZE + ELP3_SIZE + ELP4_SIZE + \
+    ELP5_SIZE + ELP6_SIZE + ELP7_SIZE + ELP8_SIZE + ELP9_SIZE + ELP10_SIZE + \
+    ELP11_SIZE + ELP12_SIZE + ELP13_SIZE + ELP14_SIZE + ELP15_SIZE + \
+    ELP16_SIZE + ELP17_SIZE + ELP18_SIZE + ELP19_SIZE + ELP20_SIZE + \
+    ELP21_SIZE + ELP22_SIZE + ELP23_SIZE + ELP24_SIZE + ELP25_SIZE + \
+    ELP26_SIZE + ELP27_SIZE + ELP28_SIZE + ELP29_SIZE + ELP30_SIZE + \
+    ELP31_SIZE + ELP32_SIZE + ELP33_SIZE + ELP34_SIZE + ELP35_SIZE + \
+    ELP36_SIZE)
+
+/* arguments of all dictionaries */
+#define ELP_ARGS    (ELP_MAIN_ARGS + ELP_EARTH_ARGS + ELP_PLANET_ARGS)
+
+/* series and dictionaries are evaluated in chunks of rows, the unit of
+ * work of a thread */
+#define ELP_CHUNK   1024
+#define ELP_MAX_CHUNKS  (ELP_ROWS / ELP_CHUNK + ELP_SERIES)
+#define ELP_MAX_ARG_CHUNKS  (ELP_ARGS / ELP_CHUNK + ELP_TYPES)
+
+/* a range of rows of a series, or of arguments of a dictionary */
+struct elp_chunk
+{
+    int series;     /* series, or row type of a dictionary */
+    int first;
+    int count;
+};
+
+/* number of threads summing the series of a position */
+static int lunar_threads = 0;
+
+/* cosines and sines of the dictionary arguments of sum_elp_series(), one
+ * buffer per thread grown as needed and kept for the next position. The
+ * buffer is freed when its thread exits, or for the calling thread by
+ * ln_lunar_unload_tables(). */
+static LN_THREAD_LOCAL double *elp_work;
+static LN_THREAD_LOCAL size_t elp_work_size;
+
+#if HAVE_PTHREAD_H
+static pthread_key_t elp_work_key;
+static pthread_once_t elp_work_once = PTHREAD_ONCE_INIT;
+static int elp_work_keyed;
+
+static void elp_work_key_create(void)
 {
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP8_SIZE; j++) {
-        y = elp8[j].O * DEG;
-        A = elp8[j].A * t[1];
-        for (k = 0; k < 2; k++) {
-            y += elp8[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp8[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
-    }
-    return result;
+    elp_work_keyed = pthread_key_create(&elp_work_key, free) == 0;
 }
+#endif
+
+/* largest multipliers of the fundamental arguments in the ELP tables */
+#define DEL_MULT    10
+#define DEL1_MULT   8
+#define ZETA_MULT   2
+#define PLA_MULT    71
+
+/* cosines and sines of the multiples of the fundamental arguments of an
+ * epoch, evaluated once for all series. The tables hold the multiples
+ * -n .. n of an argument so negative multipliers need no special case. */
+struct lunar_args
+{
+    double t[5];                    /* powers of julian centuries */
+    double del_c[4][2 * DEL_MULT + 1];  /* Delaunay arguments */
+    double del_s[4][2 * DEL_MULT + 1];
+    double del1_c[4][2 * DEL1_MULT + 1];    /* linear terms only */
+    double del1_s[4][2 * DEL1_MULT + 1];
+    double zeta_c[2 * ZETA_MULT + 1];   /* mean longitude plus precession */
+    double zeta_s[2 * ZETA_MULT + 1];
+    double p_c[8][2 * PLA_MULT + 1];    /* mean longitudes of the planets */
+    double p_s[8][2 * PLA_MULT + 1];
+
+    /* multiple 0 of every multiplier of the arguments of a row type */
+    const double *mc[ELP_TYPES][ELP_MAX_MULT];
+    const double *ms[ELP_TYPES][ELP_MAX_MULT];
+
+    /* rates of the fundamental arguments in radians per century, in the
+     * order of the multipliers */
+    double rate[ELP_TYPES][ELP_MAX_MULT];
+};
 
-/* sum lunar elp9 series */
-static double sum_series_elp9(double *t)
+/* evaluate the multiples of the arguments used by the series terms, t must
+ * be set */
+static void get_lunar_args(struct lunar_args *arg)
 {
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP9_SIZE; j++) {
-        A = elp9[j].A * t[1];
-        y = elp9[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp9[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp9[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
+    const double *t = arg->t;
+    double angle;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        angle = del[i][0] + del[i][1] * t[1] + del[i][2] * t[2] +
+            del[i][3] * t[3] + del[i][4] * t[4];
+        get_multiples(ln_range_radians2(angle), arg->del_c[i] + DEL_MULT,
+            arg->del_s[i] + DEL_MULT, DEL_MULT);
+        angle = del[i][0] + del[i][1] * t[1];
+        get_multiples(ln_range_radians2(angle), arg->del1_c[i] + DEL1_MULT,
+            arg->del1_s[i] + DEL1_MULT, DEL1_MULT);
     }
-    return result;
-}
 
-/* sum lunar elp10 series */
-static double sum_series_elp10(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP10_SIZE; j++) {
-        y = elp10[j].theta * DEG;
-
-        for (k = 0; k < 2; k++) {
-            y += (elp10[j].ipla[8] * del[0][k]
-            + elp10[j].ipla[9] * del[2][k]
-            + elp10[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp10[j].ipla[i] * p[i][k] * t[k];
-        }
+    angle = zeta[0] + zeta[1] * t[1];
+    get_multiples(ln_range_radians2(angle), arg->zeta_c + ZETA_MULT,
+        arg->zeta_s + ZETA_MULT, ZETA_MULT);
 
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp10[j].O * sin(y);
+    for (i = 0; i < 8; i++) {
+        angle = p[i][0] + p[i][1] * t[1];
+        get_multiples(ln_range_radians2(angle), arg->p_c[i] + PLA_MULT,
+            arg->p_s[i] + PLA_MULT, PLA_MULT);
     }
-    return result;
-}
 
-/* sum lunar elp11 series */
-static double sum_series_elp11(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP11_SIZE; j++) {
-        y = elp11[j].theta * DEG;
-        for (k = 0; k < 2; k++)  {
-            y += (elp11[j].ipla[8] * del[0][k]
-            + elp11[j].ipla[9] * del[2][k]
-            + elp11[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp11[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp11[j].O * sin(y);
+    /* multipliers in the order of the dictionaries */
+    for (i = 0; i < 4; i++) {
+        arg->mc[ELP_MAIN][i] = arg->del_c[i] + DEL_MULT;
+        arg->ms[ELP_MAIN][i] = arg->del_s[i] + DEL_MULT;
+        arg->mc[ELP_EARTH][i + 1] = arg->del1_c[i] + DEL1_MULT;
+        arg->ms[ELP_EARTH][i + 1] = arg->del1_s[i] + DEL1_MULT;
+        arg->mc[ELP_PLANET][i + 8] = arg->del1_c[i] + DEL1_MULT;
+        arg->ms[ELP_PLANET][i + 8] = arg->del1_s[i] + DEL1_MULT;
+    }
+    arg->mc[ELP_EARTH][0] = arg->zeta_c + ZETA_MULT;
+    arg->ms[ELP_EARTH][0] = arg->zeta_s + ZETA_MULT;
+    for (i = 0; i < 8; i++) {
+        arg->mc[ELP_PLANET][i] = arg->p_c[i] + PLA_MULT;
+        arg->ms[ELP_PLANET][i] = arg->p_s[i] + PLA_MULT;
     }
-    return result;
-}
 
-/* sum lunar elp12 series */
-static double sum_series_elp12(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP12_SIZE; j++) {
-        y = elp12[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            y += (elp12[j].ipla[8] * del[0][k]
-            + elp12[j].ipla[9] * del[2][k]
-            + elp12[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp12[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp12[j].O * sin(y);
+    /* derivatives of the fundamental arguments */
+    for (i = 0; i < 4; i++) {
+        arg->rate[ELP_MAIN][i] = del[i][1] + 2.0 * del[i][2] * t[1] +
+            3.0 * del[i][3] * t[2] + 4.0 * del[i][4] * t[3];
+        arg->rate[ELP_EARTH][i + 1] = del[i][1];
+        arg->rate[ELP_PLANET][i + 8] = del[i][1];
     }
-    return result;
+    arg->rate[ELP_EARTH][0] = zeta[1];
+    for (i = 0; i < 8; i++)
+        arg->rate[ELP_PLANET][i] = p[i][1];
 }
 
-/* sum lunar elp13 series */
-static double sum_series_elp13(double *t)
+/* rotate the vector (c, s) by k times an argument, mc and ms point to the
+ * cosine and sine of multiple 0 of the argument. A multiplier of 0 is an
+ * exact identity so the rotation needs no branches. */
+static inline void rotate(double *c, double *s, const double *mc,
+    const double *ms, int k)
 {
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP13_SIZE; j++) {
-        y = elp13[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            y += (elp13[j].ipla[8] * del[0][k]
-            + elp13[j].ipla[9] * del[2][k]
-            + elp13[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp13[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp13[j].O * t[1];
-        result += x * sin(y);
-    }
-    return result;
+    double x;
+
+    x = *c * mc[k] - *s * ms[k];
+    *s = *s * mc[k] + *c * ms[k];
+    *c = x;
 }
 
-/* sum lunar elp14 series */
-static double sum_series_elp14(double *t)
+/* cosine and sine of the argument with the n multipliers m. When rate
+ * holds the rates of the fundamental arguments the rate of the argument is
+ * stored in cs[2]. */
+static inline void get_arg(const double *const *mc, const double *const *ms,
+    const double *rate, const int8_t *m, int n, double *cs)
 {
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP14_SIZE; j++) {
-        y = elp14[j].theta * DEG;
-        for (k = 0; k < 2; k++)  {
-            y += (elp14[j].ipla[8] * del[0][k]
-            + elp14[j].ipla[9] * del[2][k]
-            + elp14[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp14[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp14[j].O * t[1];
-        result += x * sin(y);
-    }
-    return result;
-}
+    double c = 1.0, s = 0.0, r = 0.0;
+    int i;
 
+    for (i = 0; i < n; i++)
+        rotate(&c, &s, mc[i], ms[i], m[i]);
 
-/* sum lunar elp15 series */
-static double sum_series_elp15(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP15_SIZE; j++) {
-        y = elp15[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            y += (elp15[j].ipla[8] * del[0][k]
-            + elp15[j].ipla[9] * del[2][k]
-            + elp15[j].ipla[10] * del [3][k]) * t[k];
-            for (i = 0; i < 8; i++)
-                y += elp15[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp15[j].O * t[1];
-        result += x * sin(y);
-    }
-    return result;
-}
+    cs[0] = c;
+    cs[1] = s;
 
-/* sum lunar elp16 series */
-static double sum_series_elp16(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP16_SIZE; j++) {
-        y = elp16[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp16[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp16[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp16[j].O * sin(y);
+    if (rate) {
+        for (i = 0; i < n; i++)
+            r += m[i] * rate[i];
+        cs[2] = r;
     }
-    return result;
 }
 
-static double sum_series_elp17(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP17_SIZE; j++) {
-        y = elp17[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp17[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp17[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp17[j].O * sin(y);
+/* cosine and sine of argument id of the dictionary of a row type, and its
+ * rate in radians per century when vel is set */
+static inline void get_elp_arg(const struct lunar_args *arg,
+    enum elp_type type, int id, double *cs, int vel)
+{
+    const int8_t *m = elp_dict[type]->arg;
+    const double *rate = vel ? arg->rate[type] : NULL;
+
+    switch (type) {
+    case ELP_MAIN:
+        get_arg(arg->mc[ELP_MAIN], arg->ms[ELP_MAIN], rate, m + id * 4, 4,
+            cs);
+        break;
+    case ELP_EARTH:
+        get_arg(arg->mc[ELP_EARTH], arg->ms[ELP_EARTH], rate, m + id * 5, 5,
+            cs);
+        break;
+    case ELP_PLANET:
+        get_arg(arg->mc[ELP_PLANET], arg->ms[ELP_PLANET], rate, m + id * 12,
+            12, cs);
+        break;
     }
-    return result;
 }
 
-static double sum_series_elp18(double *t)
+/* number of leading rows with an amplitude of at least limit, the rows
+ * are sorted by decreasing amplitude */
+static int elp_prefix(const struct elp_table *table, double limit)
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP18_SIZE; j++) {
-        y = elp18[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp18[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp18[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp18[j].O * sin(y);
-    }
-    return result;
-}
+    int low = 0, high = table->size, mid;
 
-static double sum_series_elp19(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP19_SIZE; j++) {
-        y = elp19[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp19[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp19[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp19[j].O * t[1];
-        result += x * sin(y);
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (fabs(table->amp[mid]) >= limit)
+            low = mid + 1;
+        else
+            high = mid;
     }
-    return result;
+
+    return low;
 }
 
-static double sum_series_elp20(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP20_SIZE; j++) {
-        y = elp20[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp20[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp20[j].ipla[i] * p[i][k] * t[k];
+/* sum rows first to last - 1 of a table, cs holds the cosines and sines
+ * of the arguments of the dictionary. When deriv is not NULL cs also holds
+ * the rates of the arguments, every third value, and the sum of the
+ * derivatives of the terms is stored in deriv. */
+static double sum_rows(const struct elp_table *table, int first, int last,
+    const double *cs, double *deriv)
+{
+    const double *x;
+    double result = 0, d = 0;
+    int j;
+
+    if (deriv == NULL) {
+        for (j = first; j < last; j++) {
+            x = cs + 2 * table->arg[j];
+            result += table->c[j] * x[1] + table->s[j] * x[0];
         }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp20[j].O * t[1];
-        result += x * sin(y);
+        return result;
     }
-    return result;
-}
 
-static double sum_series_elp21(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y,x;
-
-    for (j = 0; j < ELP21_SIZE; j++) {
-        y = elp21[j].theta * DEG;
-        for (k = 0; k < 2; k++) {
-            for (i = 0; i < 4; i++)
-                y += elp21[j].ipla[i + 7] * del[i][k] * t[k];
-            for (i = 0; i < 7; i++)
-                y += elp21[j].ipla[i] * p[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        x = elp21[j].O * t[1];
-        result += x * sin(y);
+    for (j = first; j < last; j++) {
+        x = cs + 3 * table->arg[j];
+        result += table->c[j] * x[1] + table->s[j] * x[0];
+        d += (table->c[j] * x[0] - table->s[j] * x[1]) * x[2];
     }
+    *deriv = d;
     return result;
 }
 
-/* sum lunar elp22 series */
-static double sum_series_elp22(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP22_SIZE; j++) {
-        y = elp22[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp22[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp22[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp22[j].A * sin(y);
+/* sum rows first to last - 1 of a table of a row type, evaluating the
+ * argument of every row. The sum of the derivatives of the terms is
+ * stored in deriv unless it is NULL. */
+static double sum_rows_direct(const struct elp_table *table, int first,
+    int last, const struct lunar_args *arg, enum elp_type type,
+    double *deriv)
+{
+    double result = 0, d = 0;
+    double x[3] = {0.0, 0.0, 0.0};
+    int j;
+
+    for (j = first; j < last; j++) {
+        get_elp_arg(arg, type, table->arg[j], x, deriv != NULL);
+        result += table->c[j] * x[1] + table->s[j] * x[0];
+        if (deriv)
+            d += (table->c[j] * x[0] - table->s[j] * x[1]) * x[2];
     }
+    if (deriv)
+        *deriv = d;
     return result;
 }
 
-/* sum lunar elp23 series */
-static double sum_series_elp23(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP23_SIZE; j++) {
-        y = elp23[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp23[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp23[j].ilu[i] * del[i][k] * t[k];
+/* split ranges of size rows of every series, or of every dictionary, into
+ * chunks of at most ELP_CHUNK rows. Returns the number of chunks. */
+static int get_elp_chunks(struct elp_chunk *chunk, const int *size,
+    int count)
+{
+    int i, first, n = 0;
+
+    for (i = 0; i < count; i++) {
+        for (first = 0; first < size[i]; first += ELP_CHUNK) {
+            chunk[n].series = i;
+            chunk[n].first = first;
+            chunk[n].count = size[i] - first;
+            if (chunk[n].count > ELP_CHUNK)
+                chunk[n].count = ELP_CHUNK;
+            n++;
         }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp23[j].A * sin(y);
     }
-    return result;
+
+    return n;
 }
 
-/* sum lunar elp24 series */
-static double sum_series_elp24(double *t)
+/* workspace of at least n doubles for the calling thread, or NULL when it
+ * cannot be grown */
+static double *get_elp_work(size_t n)
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP24_SIZE; j++) {
-        y = elp24[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp24[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp24[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp24[j].A * sin(y);
-    }
-    return result;
+    double *work;
+
+    if (n <= elp_work_size)
+        return elp_work;
+
+    work = realloc(elp_work, sizeof(double) * n);
+    if (work == NULL)
+        return NULL;
+
+    elp_work = work;
+    elp_work_size = n;
+
+#if HAVE_PTHREAD_H
+    /* have the thread exit free the buffer */
+    pthread_once(&elp_work_once, elp_work_key_create);
+    if (elp_work_keyed)
+        pthread_setspecific(elp_work_key, work);
+#endif
+    return work;
 }
 
-/* sum lunar elp25 series */
-static double sum_series_elp25(double *t)
+/* release the workspace of the calling thread */
+static void free_elp_work(void)
 {
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP25_SIZE; j++) {
-        A = elp25[j].A * t[1];
-        y = elp25[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp25[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp25[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
-    }
-    return result;
+#if HAVE_PTHREAD_H
+    if (elp_work_keyed)
+        pthread_setspecific(elp_work_key, NULL);
+#endif
+    free(elp_work);
+    elp_work = NULL;
+    elp_work_size = 0;
 }
 
-/* sum lunar elp26 series */
-static double sum_series_elp26(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP26_SIZE; j++) {
-        A = elp26[j].A * t[1];
-        y = elp26[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp26[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp26[j].ilu[i] * del[i][k] * t[k];
+/* sum all series into the longitude, latitude and distance sums. Terms
+ * with an amplitude, multiplied by t^n, below pre of their coordinate are
+ * skipped. When dsum is not NULL the derivatives of the sums by t are
+ * added to it.
+ *
+ * The cosine and sine of every argument used by the kept terms are
+ * evaluated once from the dictionaries and shared by all series. The
+ * chunks of rows are then summed independently, possibly by several
+ * threads, and added in a fixed order so the result does not depend on
+ * the number of threads. */
+static void sum_elp_series(const struct lunar_args *arg, const double *pre,
+    double *sum, double *dsum)
+{
+    struct elp_chunk chunk[ELP_MAX_CHUNKS];
+    struct elp_chunk arg_chunk[ELP_MAX_ARG_CHUNKS];
+    double partial[ELP_MAX_CHUNKS], dpartial[ELP_MAX_CHUNKS];
+    double *cs[ELP_TYPES], *work;
+    int kept[ELP_SERIES], used[ELP_TYPES] = {0, 0, 0};
+    int i, n, chunks, threads = lunar_threads;
+    int stride = dsum ? 3 : 2;
+
+    /* the kept terms are a prefix of every table and use a prefix of the
+     * dictionary */
+    for (i = 0; i < ELP_SERIES; i++) {
+        const struct elp_series *series = &elp_series[i];
+        double tn = arg->t[series->power];
+
+        /* the derivative of a t^n series does not vanish at t = 0, for
+         * the velocity the series are truncated one day further from
+         * J2000 */
+        if (dsum)
+            tn = pow(fabs(arg->t[1]) + 1.0 / 36525.0, series->power);
+
+        kept[i] = tn == 0.0 ? 0 :
+            elp_prefix(elp_tables[i], pre[series->coord] / fabs(tn));
+        if (kept[i] > 0) {
+            n = elp_tables[i]->max_arg[kept[i] - 1] + 1;
+            if (n > used[series->type])
+                used[series->type] = n;
         }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
     }
-    return result;
-}
 
-/* sum lunar elp27 series */
-static double sum_series_elp27(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP27_SIZE; j++) {
-        A = elp27[j].A * t[1];
-        y = elp27[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp27[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp27[j].ilu[i] * del[i][k] * t[k];
+    /* the rows evaluate their own argument when out of memory */
+    n = used[0] + used[1] + used[2];
+    work = get_elp_work((size_t)stride * n);
+    if (work) {
+        cs[0] = work;
+        for (i = 1; i < ELP_TYPES; i++)
+            cs[i] = cs[i - 1] + stride * used[i - 1];
+
+        chunks = get_elp_chunks(arg_chunk, used, ELP_TYPES);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(threads > 1) num_threads(threads > 1 ? threads : 1)
+#endif
+        for (i = 0; i < chunks; i++) {
+            int type = arg_chunk[i].series, j;
+            int last = arg_chunk[i].first + arg_chunk[i].count;
+
+            for (j = arg_chunk[i].first; j < last; j++)
+                get_elp_arg(arg, type, j, cs[type] + stride * j, dsum != NULL);
         }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
     }
-    return result;
-}
 
-/* sum lunar elp28 series */
-static double sum_series_elp28(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP28_SIZE; j++) {
-        y = elp28[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp28[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp28[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp28[j].A * sin(y);
+    chunks = get_elp_chunks(chunk, kept, ELP_SERIES);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(threads > 1) num_threads(threads > 1 ? threads : 1)
+#endif
+    for (i = 0; i < chunks; i++) {
+        const struct elp_series *series = &elp_series[chunk[i].series];
+        const struct elp_table *table = elp_tables[chunk[i].series];
+        int first = chunk[i].first, last = first + chunk[i].count;
+        int power = series->power;
+        double deriv = 0.0;
+
+        if (work)
+            partial[i] = sum_rows(table, first, last,
+                cs[series->type], dsum ? &deriv : NULL);
+        else
+            partial[i] = sum_rows_direct(table, first, last, arg,
+                series->type, dsum ? &deriv : NULL);
+
+        /* d(S * t^n) / dt = S' * t^n + n * S * t^(n - 1) */
+        dpartial[i] = deriv * arg->t[power] +
+            (power ? power * partial[i] * arg->t[power - 1] : 0.0);
+        partial[i] *= arg->t[power];
     }
-    return result;
-}
 
-/* sum lunar elp29 series */
-static double sum_series_elp29(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP29_SIZE; j++) {
-        y = elp29[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp29[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp29[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp29[j].A * sin(y);
+    for (i = 0; i < chunks; i++) {
+        sum[elp_series[chunk[i].series].coord] += partial[i];
+        if (dsum)
+            dsum[elp_series[chunk[i].series].coord] += dpartial[i];
     }
-    return result;
 }
 
-
-/* sum lunar elp30 series */
-static double sum_series_elp30(double *t)
+/*! \fn int ln_set_lunar_threads(int threads)
+* \param threads Number of threads, 0 or 1 to use the calling thread only
+* \return 0 for success, -1 for a negative number of threads.
+*
+* Set the number of threads used to sum the ELP series of a single lunar
+* position. The series are split into fixed chunks of rows whose partial
+* sums are added in the same order for any number of threads, so the
+* results are bit for bit identical to a single thread.
+*
+* The setting is shared by all threads and should be made before
+* calculating positions. It has no effect when libnova is built without
+* OpenMP support.
+*/
+int ln_set_lunar_threads(int threads)
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP30_SIZE; j++) {
-        y = elp30[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp30[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp30[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp30[j].A * sin(y);
-    }
-    return result;
-}
+    if (threads < 0)
+        return -1;
 
+    lunar_threads = threads;
+    return 0;
+}
 
-/* sum lunar elp31 series */
-static double sum_series_elp31(double *t)
+/* largest multiplier of column i of the arguments of a row type */
+static int elp_mult_limit(enum elp_type type, int i)
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP31_SIZE; j++) {
-        y = elp31[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp31[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp31[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp31[j].A * sin(y);
+    switch (type) {
+    case ELP_MAIN:
+        return DEL_MULT;
+    case ELP_EARTH:
+        return i == 0 ? ZETA_MULT : DEL1_MULT;
+    case ELP_PLANET:
+        return i < 8 ? PLA_MULT : DEL1_MULT;
     }
-    return result;
+    return 0;
 }
 
-/* sum lunar elp32 series */
-static double sum_series_elp32(double *t)
+/* check that an array of count elements of size bytes at offset lies in
+ * the file and is aligned */
+static int elp_file_array(uint64_t offset, size_t count, size_t size,
+    size_t file_size)
 {
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP32_SIZE; j++) {
-        y = elp32[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp32[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp32[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp32[j].A * sin(y);
-    }
-    return result;
+    return offset % ELP_FILE_ALIGN == 0 && offset <= file_size &&
+        count <= (file_size - offset) / size;
 }
 
-/* sum lunar elp33 series */
-static double sum_series_elp33(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y;
-
-    for (j = 0; j < ELP33_SIZE; j++) {
-        y = elp33[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp33[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp33[j].ilu[i] * del[i][k] * t[k];
+/* check a dictionary of the file and point args at it. The multipliers
+ * must fit the multiples of the fundamental arguments of lunar_args, and
+ * the dictionary must not be larger than the compiled in one so the
+ * chunks of sum_elp_series() still fit. */
+static int elp_file_args(const struct elp_file_args *fa, enum elp_type type,
+    const char *data, size_t size, struct elp_args *args)
+{
+    const struct elp_args *builtin = elp_dict_builtin[type];
+    const int8_t *m;
+    int i, j;
+
+    if (fa->args != (uint32_t)builtin->args ||
+        fa->size > (uint32_t)builtin->size ||
+        !elp_file_array(fa->offset, (size_t)fa->size * fa->args, 1, size))
+        return -1;
+
+    m = (const int8_t *)(data + fa->offset);
+    for (i = 0; i < (int)fa->size; i++) {
+        for (j = 0; j < builtin->args; j++) {
+            if (abs(m[i * builtin->args + j]) > elp_mult_limit(type, j))
+                return -1;
         }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += elp33[j].A * sin(y);
     }
-    return result;
+
+    args->arg = m;
+    args->args = builtin->args;
+    args->size = fa->size;
+    return 0;
 }
 
-/* sum lunar elp34 series */
-static double sum_series_elp34(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP34_SIZE; j++) {
-        A = elp34[j].A * t[2];
-        y = elp34[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp34[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp34[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
+/* check a table of the file and point table at it. Every row must use an
+ * argument of the dictionary of its row type and max_arg must be the
+ * largest argument of the leading rows. */
+static int elp_file_table(const struct elp_file_table *ft, int series,
+    const char *data, size_t size, const struct elp_args *args,
+    struct elp_table *table)
+{
+    int j, max_arg = 0;
+
+    if (ft->size > (uint32_t)elp_builtin[series]->size ||
+        !elp_file_array(ft->arg, ft->size, sizeof(uint16_t), size) ||
+        !elp_file_array(ft->max_arg, ft->size, sizeof(uint16_t), size) ||
+        !elp_file_array(ft->amp, ft->size, sizeof(double), size) ||
+        !elp_file_array(ft->c, ft->size, sizeof(double), size) ||
+        !elp_file_array(ft->s, ft->size, sizeof(double), size))
+        return -1;
+
+    table->arg = (const uint16_t *)(data + ft->arg);
+    table->max_arg = (const uint16_t *)(data + ft->max_arg);
+    table->amp = (const double *)(data + ft->amp);
+    table->c = (const double *)(data + ft->c);
+    table->s = (const double *)(data + ft->s);
+    table->size = ft->size;
+
+    for (j = 0; j < table->size; j++) {
+        if (table->arg[j] > max_arg)
+            max_arg = table->arg[j];
+        if (table->arg[j] >= args->size || table->max_arg[j] != max_arg)
+            return -1;
     }
-    return result;
+
+    return 0;
 }
-/* sum lunar elp35 series */
-static double sum_series_elp35(double *t)
-{
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP35_SIZE; j++) {
-        A = elp35[j].A * t[2];
-        y = elp35[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp35[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp35[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
+
+/*! \fn int ln_lunar_load_tables(const char *filename)
+* \param filename Binary coefficient file written by tools/elp82 -b
+* \return 0 for success, -1 when the file cannot be read or is invalid.
+*
+* Replace the compiled in ELP 2000-82B tables and argument dictionaries by
+* those of a binary coefficient file. Where available the file is mapped
+* read only, so the tables are used in place and their pages are shared by
+* all processes using the same file. Otherwise the file is read into
+* memory.
+* A loaded file must not be modified, install new files under a new name
+* or by renaming them over the old one.
+*
+* Files can hold truncated tables, e.g. written with the -a option of
+* elp82, but no table or dictionary can be larger than the compiled in
+* one.
+*
+* Tables must not be loaded or unloaded while other threads are
+* calculating lunar positions.
+*/
+int ln_lunar_load_tables(const char *filename)
+{
+    struct elp_table loaded[ELP_SERIES];
+    struct elp_args loaded_args[ELP_TYPES];
+    const struct elp_file_header *hdr;
+    struct coeff_file file;
+    const char *data;
+    size_t size;
+    int i, err = 0;
+
+    if (coeff_file_open(filename, &file) != 0)
+        return -1;
+    data = file.data;
+    size = file.size;
+
+    /* check the header */
+    hdr = file.data;
+    if (size < sizeof(*hdr) ||
+        memcmp(hdr->magic, ELP_FILE_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->version != ELP_FILE_VERSION ||
+        hdr->byte_order != ELP_FILE_BYTE_ORDER ||
+        hdr->tables != ELP_SERIES ||
+        hdr->types != ELP_TYPES)
+        err = -1;
+
+    for (i = 0; i < ELP_TYPES && !err; i++)
+        err = elp_file_args(&hdr->dict[i], i, data, size, &loaded_args[i]);
+
+    for (i = 0; i < ELP_SERIES && !err; i++)
+        err = elp_file_table(&hdr->table[i], i, data, size,
+            &loaded_args[elp_series[i].type], &loaded[i]);
+
+    if (err) {
+        coeff_file_close(&file);
+        return -1;
     }
-    return result;
+
+    ln_lunar_unload_tables();
+
+    memcpy(elp_loaded, loaded, sizeof(loaded));
+    memcpy(elp_loaded_args, loaded_args, sizeof(loaded_args));
+    for (i = 0; i < ELP_SERIES; i++)
+        elp_tables[i] = &elp_loaded[i];
+    for (i = 0; i < ELP_TYPES; i++)
+        elp_dict[i] = &elp_loaded_args[i];
+
+    elp_file = file;
+    return 0;
 }
 
-/* sum lunar elp36 series */
-static double sum_series_elp36(double *t)
+/*! \fn void ln_lunar_unload_tables(void)
+*
+* Go back to the compiled in ELP 2000-82B tables and release the
+* coefficient file loaded by ln_lunar_load_tables(), along with the
+* series workspace of the calling thread. The workspace of other threads
+* is released when they exit.
+*/
+void ln_lunar_unload_tables(void)
 {
-    double result = 0;
-    int i,j,k;
-    double y, A;
-
-    for (j = 0; j < ELP36_SIZE; j++) {
-        A = elp36[j].A * t[2];
-        y = elp36[j].O * DEG;
-        for (k = 0; k < 2; k++) {
-            y += elp36[j].iz * zeta[k] * t[k];
-            for (i = 0; i < 4; i++)
-                y += elp36[j].ilu[i] * del[i][k] * t[k];
-        }
-        /* put y in correct quad */
-        y = ln_range_radians2(y);
-        result += A * sin(y);
-    }
-    return result;
+    int i;
+
+    for (i = 0; i < ELP_SERIES; i++)
+        elp_tables[i] = elp_builtin[i];
+    for (i = 0; i < ELP_TYPES; i++)
+        elp_dict[i] = elp_dict_builtin[i];
+
+    coeff_file_close(&elp_file);
+    free_elp_work();
 }
 
 /* internal function used for find_max/find zero lunar phase calculations */
@@ -1076,29 +986,21 @@ static double _lunar_ecl_lat(double jd, double *arg)
     return pos.lat;
 }
 
-/*! \fn void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *pos, double precision);
-* \param JD Julian day.
-* \param pos Pointer to a geocentric position structure to held result.
-* \param precision The truncation level of the series in radians for longitude
-* and latitude and in km for distance. (Valid range 0 - 0.01, 0 being highest accuracy)
-* \ingroup lunar
-*
-* Calculate the rectangular geocentric lunar coordinates to the inertial mean
-* ecliptic and equinox of J2000.
-* The geocentric coordinates returned are in units of km.
-*
-* This function is based upon the Lunar Solution ELP2000-82B by
-* Michelle Chapront-Touze and Jean Chapront of the Bureau des Longitudes,
-* Paris.
-*/
-/* ELP 2000-82B theory */
-void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precision)
-{
-    double t[5];
-    double elp[36];
-    double a,b,c;
-    double x,y,z;
+/* rectangular geocentric lunar coordinates and, unless vel is NULL, their
+ * rates of change in km per day */
+static void lunar_geo_posn(double JD, struct ln_rect_posn *moon,
+    struct ln_rect_posn *vel, double precision)
+{
+    struct lunar_args arg;
+    double *t = arg.t;
+    double pre[3];
+    double sum[3] = {0.0, 0.0, 0.0};
+    double dsum[3] = {0.0, 0.0, 0.0};
+    double a,b,c, da,db,dc;
+    double x,y,z, dx,dy,dz;
     double pw,qw, pwqw, pw2, qw2, ra;
+    double dpw,dqw, dpwqw, dpw2, dqw2, dra;
+    double cb, sb, ca, sa;
 
     /* calc julian centuries */
     t[0] = 1.0;
@@ -1106,54 +1008,20 @@ void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precisio
     t[2] = t[1] * t[1];
     t[3] = t[2] * t[1];
     t[4] = t[3] * t[1];
+    get_lunar_args(&arg);
+
+    /* truncation level of the series in arcsecs for longitude and latitude
+     * and in km at the mean lunar distance for distance */
+    pre[ELP_LONGITUDE] = precision * RAD;
+    pre[ELP_LATITUDE] = precision * RAD;
+    pre[ELP_DISTANCE] = precision * ATH;
 
-    /* sum elp series */
-    elp[0] = sum_series_elp1(t);
-    elp[1] = sum_series_elp2(t);
-    elp[2] = sum_series_elp3(t);
-    elp[3] = sum_series_elp4(t);
-    elp[4] = sum_series_elp5(t);
-    elp[5] = sum_series_elp6(t);
-    elp[6] = sum_series_elp7(t);
-    elp[7] = sum_series_elp8(t);
-    elp[8] = sum_series_elp9(t);
-    elp[9] = sum_series_elp10(t);
-    elp[10] = sum_series_elp11(t);
-    elp[11] = sum_series_elp12(t);
-    elp[12] = sum_series_elp13(t);
-    elp[13] = sum_series_elp14(t);
-    elp[14] = sum_series_elp15(t);
-    elp[15] = sum_series_elp16(t);
-    elp[16] = sum_series_elp17(t);
-    elp[17] = sum_series_elp18(t);
-    elp[18] = sum_series_elp19(t);
-    elp[19] = sum_series_elp20(t);
-    elp[20] = sum_series_elp21(t);
-    elp[21] = sum_series_elp22(t);
-    elp[22] = sum_series_elp23(t);
-    elp[23] = sum_series_elp24(t);
-    elp[24] = sum_series_elp25(t);
-    elp[25] = sum_series_elp26(t);
-    elp[26] = sum_series_elp27(t);
-    elp[27] = sum_series_elp28(t);
-    elp[28] = sum_series_elp29(t);
-    elp[29] = sum_series_elp30(t);
-    elp[30] = sum_series_elp31(t);
-    elp[31] = sum_series_elp32(t);
-    elp[32] = sum_series_elp33(t);
-    elp[33] = sum_series_elp34(t);
-    elp[34] = sum_series_elp35(t);
-    elp[35] = sum_series_elp36(t);
-
-    a = elp[0] + elp[3] + elp[6] + elp[9] + elp[12] +
-        elp[15] + elp[18] + elp[21] + elp[24] +
-        elp[27] + elp[30] + elp[33];
-    b = elp[1] + elp[4] + elp[7] + elp[10] + elp[13] +
-        elp[16] + elp[19] + elp[22] + elp[25] +
-        elp[28] + elp[31] + elp[34];
-    c = elp[2] + elp[5] + elp[8] + elp[11] + elp[14] +
-        elp[17] + elp[20] + elp[23] + elp[26] +
-        elp[29] + elp[32] + elp[35];
+    /* sum elp series of every coordinate */
+    sum_elp_series(&arg, pre, sum, vel ? dsum : NULL);
+
+    a = sum[ELP_LONGITUDE];
+    b = sum[ELP_LATITUDE];
+    c = sum[ELP_DISTANCE];
 
     /* calculate geocentric coords */
     a = a / RAD + W1[0] + W1[1] * t[1] + W1[2] * t[2] + W1[3] * t[3]
@@ -1161,10 +1029,15 @@ void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precisio
     b = b / RAD;
     c = c * A0 / ATH;
 
-    x = c * cos(b);
-    y = x * sin(a);
-    x = x * cos(a);
-    z = c * sin(b);
+    cb = cos(b);
+    sb = sin(b);
+    ca = cos(a);
+    sa = sin(a);
+
+    x = c * cb;
+    y = x * sa;
+    x = x * ca;
+    z = c * sb;
 
     /* Laskars series */
     pw = (P1 + P2 * t[1] + P3 * t[2] + P4 * t[3] + P5 * t[4]) * t[1];
@@ -1173,6 +1046,38 @@ void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precisio
     pwqw = 2.0 * pw * qw;
     pw2 = 1.0 - 2.0 * pw * pw;
     qw2 = 1.0 - 2.0 * qw * qw;
+
+    if (vel) {
+        /* rates per century of the spherical coordinates */
+        da = dsum[ELP_LONGITUDE] / RAD + W1[1] + 2.0 * W1[2] * t[1] +
+            3.0 * W1[3] * t[2] + 4.0 * W1[4] * t[3];
+        db = dsum[ELP_LATITUDE] / RAD;
+        dc = dsum[ELP_DISTANCE] * A0 / ATH;
+
+        dx = dc * cb * ca - c * sb * ca * db - c * cb * sa * da;
+        dy = dc * cb * sa - c * sb * sa * db + c * cb * ca * da;
+        dz = dc * sb + c * cb * db;
+
+        /* rates of the precession matrix */
+        dpw = P1 + 2.0 * P2 * t[1] + 3.0 * P3 * t[2] + 4.0 * P4 * t[3] +
+            5.0 * P5 * t[4];
+        dqw = Q1 + 2.0 * Q2 * t[1] + 3.0 * Q3 * t[2] + 4.0 * Q4 * t[3] +
+            5.0 * Q5 * t[4];
+        dra = -4.0 * (pw * dpw + qw * dqw) / ra;
+        dpwqw = 2.0 * (dpw * qw + pw * dqw);
+        dpw2 = -4.0 * pw * dpw;
+        dqw2 = -4.0 * qw * dqw;
+        dpw = dpw * ra + pw * dra;
+        dqw = dqw * ra + qw * dra;
+
+        vel->X = (dpw2 * x + dpwqw * y + dpw * z +
+            pw2 * dx + pwqw * dy + pw * ra * dz) / 36525.0;
+        vel->Y = (dpwqw * x + dqw2 * y - dqw * z +
+            pwqw * dx + qw2 * dy - qw * ra * dz) / 36525.0;
+        vel->Z = (-dpw * x + dqw * y + (dpw2 + dqw2) * z -
+            pw * ra * dx + qw * ra * dy + (pw2 + qw2 - 1.0) * dz) / 36525.0;
+    }
+
     pw = pw * ra;
     qw = qw * ra;
     a = pw2 * x + pwqw * y + pw * z;
@@ -1185,11 +1090,72 @@ void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precisio
     moon->Z = c;
 }
 
+/*! \fn void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *pos, double precision);
+* \param JD Julian day.
+* \param pos Pointer to a geocentric position structure to held result.
+* \param precision The truncation level of the series in radians. (Valid range 0 - 0.01, 0 being highest accuracy)
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates to the inertial mean
+* ecliptic and equinox of J2000.
+* The geocentric coordinates returned are in units of km.
+*
+* Terms of the longitude and latitude series with an amplitude, multiplied
+* by t^n, smaller than precision are skipped. The distance series are
+* truncated at the same angle seen from the mean lunar distance. The tables
+* are sorted by decreasing amplitude so the kept terms are a prefix of each
+* table and the cost drops with precision, about 15 times faster at 1e-8
+* and 100 times faster at 1e-4.
+*
+* The skipped terms add up to an error of about 50 times precision at 1e-8,
+* 20 times at 1e-6 and 5 times at 1e-4, in radians for the direction and
+* relative to the mean lunar distance for the distance.
+*
+* The series can be summed by several threads, see ln_set_lunar_threads().
+*
+* This function is based upon the Lunar Solution ELP2000-82B by
+* Michelle Chapront-Touze and Jean Chapront of the Bureau des Longitudes,
+* Paris.
+*/
+/* ELP 2000-82B theory */
+void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precision)
+{
+    lunar_geo_posn(JD, moon, NULL, precision);
+}
+
+/*! \fn void ln_get_lunar_geo_posn_vel(double JD, struct ln_rect_posn *moon, struct ln_rect_posn *velocity, double precision);
+* \param JD Julian day.
+* \param moon Pointer to a geocentric position structure to held result.
+* \param velocity Pointer to a structure to held the geocentric velocity.
+* \param precision The truncation level of the series in radians, see
+* ln_get_lunar_geo_posn(). (Valid range 0 - 0.01, 0 being highest accuracy)
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates, as
+* ln_get_lunar_geo_posn(), and their rates of change in km per day.
+*
+* The derivative of every term A * sin(x) of the ELP series is
+* A * cos(x) * dx/dt, where the rate dx/dt follows from the rates of the
+* fundamental arguments. Both are summed in the same pass over the tables,
+* so the velocity costs about half a position on top of the position
+* itself, instead of two more positions for a difference.
+*
+* Series multiplied by t^n are truncated as if the date was a day further
+* from J2000, so with a non zero precision the position can differ
+* slightly from ln_get_lunar_geo_posn(). The velocity error is then about
+* precision times the distance per day.
+*/
+void ln_get_lunar_geo_posn_vel(double JD, struct ln_rect_posn *moon,
+    struct ln_rect_posn *velocity, double precision)
+{
+    lunar_geo_posn(JD, moon, velocity, precision);
+}
+
 /*! \fn void ln_get_lunar_equ_coords_prec(double JD, struct ln_equ_posn *position, double precision);
 * \param JD Julian Day
 * \param position Pointer to a struct ln_lnlat_posn to store result.
-* \param precision The truncation level of the series in radians for longitude
-* and latitude and in km for distance. (Valid range 0 - 0.01, 0 being highest accuracy)
+* \param precision The truncation level of the series in radians, see
+* ln_get_lunar_geo_posn(). (Valid range 0 - 0.01, 0 being highest accuracy)
 * \ingroup lunar
 *
 * Calculate the lunar RA and DEC for Julian day JD.
@@ -1220,8 +1186,8 @@ void ln_get_lunar_equ_coords(double JD, struct ln_equ_posn *position)
 /*! \fn void ln_get_lunar_ecl_coords(double JD, struct ln_lnlat_posn *position, double precision);
 * \param JD Julian Day
 * \param position Pointer to a struct ln_lnlat_posn to store result.
-* \param precision The truncation level of the series in radians for longitude
-* and latitude and in km for distance. (Valid range 0 - 0.01, 0 being highest accuracy)
+* \param precision The truncation level of the series in radians, see
+* ln_get_lunar_geo_posn(). (Valid range 0 - 0.01, 0 being highest accuracy)
 * \ingroup lunar
 *
 * Calculate the lunar longitude and latitude for Julian day JD.
@@ -1243,6 +1209,43 @@ void ln_get_lunar_ecl_coords(double JD, struct ln_lnlat_posn *position,
     position->lat = ln_rad_to_deg(position->lat);
 }
 
+/*! \fn void ln_get_lunar_ecl_coords_vel(double JD, struct ln_lnlat_posn *position, struct ln_lnlat_posn *velocity, double precision);
+* \param JD Julian Day
+* \param position Pointer to a struct ln_lnlat_posn to store result.
+* \param velocity Pointer to a struct ln_lnlat_posn to store the rates.
+* \param precision The truncation level of the series in radians, see
+* ln_get_lunar_geo_posn(). (Valid range 0 - 0.01, 0 being highest accuracy)
+* \ingroup lunar
+*
+* Calculate the lunar longitude and latitude for Julian day JD, as
+* ln_get_lunar_ecl_coords(), and their rates of change in degrees per day
+* from the velocity of ln_get_lunar_geo_posn_vel(). The rates allow Newton
+* steps when searching for lunar events.
+*/
+void ln_get_lunar_ecl_coords_vel(double JD, struct ln_lnlat_posn *position,
+    struct ln_lnlat_posn *velocity, double precision)
+{
+    struct ln_rect_posn moon, vel;
+    double rho2, r2;
+
+    /* get lunar geocentric position and velocity */
+    ln_get_lunar_geo_posn_vel(JD, &moon, &vel, precision);
+
+    /* convert to long and lat */
+    position->lng = atan2(moon.Y, moon.X);
+    position->lat = atan2(moon.Z,
+        (sqrt((moon.X * moon.X) + (moon.Y * moon.Y))));
+    position->lng = ln_range_degrees(ln_rad_to_deg(position->lng));
+    position->lat = ln_rad_to_deg(position->lat);
+
+    /* derivatives of the angles */
+    rho2 = moon.X * moon.X + moon.Y * moon.Y;
+    r2 = rho2 + moon.Z * moon.Z;
+    velocity->lng = ln_rad_to_deg((moon.X * vel.Y - moon.Y * vel.X) / rho2);
+    velocity->lat = ln_rad_to_deg((vel.Z * rho2 -
+        moon.Z * (moon.X * vel.X + moon.Y * vel.Y)) / (r2 * sqrt(rho2)));
+}
+
 /*! \fn double ln_get_lunar_earth_dist(double JD);
 * \param JD Julian Day
 * \return The distance between the Earth and Moon in km.
@@ -1255,7 +1258,7 @@ double ln_get_lunar_earth_dist(double JD)
 {
     struct ln_rect_posn moon;
 
-    ln_get_lunar_geo_posn(JD, &moon, 0.00001);
+    ln_get_lunar_geo_posn(JD, &moon, 0);
     return sqrt((moon.X * moon.X) + (moon.Y * moon.Y) + (moon.Z * moon.Z));
 }
 
@@ -1275,7 +1278,7 @@ double ln_get_lunar_phase(double JD)
     double R, delta;
 
     /* get lunar and solar long + lat */
-    ln_get_lunar_ecl_coords(JD, &moon, 0.0001);
+    ln_get_lunar_ecl_coords(JD, &moon, 0);
     ln_get_solar_ecl_coords(JD, &sunlp);
 
     /* calc lunar geocentric elongation equ 48.2 */
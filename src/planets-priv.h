@@ -0,0 +1,14 @@
+#ifndef _LN_PLANETS_PRIV_H
+#define _LN_PLANETS_PRIV_H
+
+#include <libnova/planets.h>
+
+int helio_cache_get(enum ln_planet planet, double JD,
+	struct ln_helio_posn *position);
+
+void helio_cache_put(enum ln_planet planet, double JD,
+	const struct ln_helio_posn *position);
+
+void helio_cache_invalidate(void);
+
+#endif
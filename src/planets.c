@@ -0,0 +1,311 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <libnova/planets.h>
+#include <libnova/mercury.h>
+#include <libnova/venus.h>
+#include <libnova/mars.h>
+#include <libnova/jupiter.h>
+#include <libnova/saturn.h>
+#include <libnova/uranus.h>
+#include <libnova/neptune.h>
+#include <libnova/pluto.h>
+#include <libnova/solar.h>
+#include <libnova/transform.h>
+#include <libnova/utility.h>
+#include "implementation.h"
+#include "planets-priv.h"
+
+#include <math.h>
+#include <stddef.h>
+
+/* cached heliocentric position */
+struct helio_cache_entry
+{
+    double JD;
+    struct ln_helio_posn position;
+};
+
+/* positions of a planet, replaced in round robin order */
+struct helio_cache
+{
+    struct helio_cache_entry entry[LN_HELIO_CACHE_MAX];
+    int generation;
+    int used;
+    int next;
+    unsigned long hits;
+    unsigned long misses;
+};
+
+/* cache size of every planet, shared by all threads */
+static int cache_size[LN_PLANET_COUNT] = {
+    LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT,
+    LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT,
+    LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT, LN_HELIO_CACHE_DEFAULT
+};
+
+/* changed when the VSOP87 tables are replaced, older entries are stale */
+static int cache_generation = 0;
+
+/* cached positions, one set per thread */
+static LN_THREAD_LOCAL struct helio_cache helio_cache[LN_PLANET_COUNT];
+
+/* heliocentric coordinates of every planet, the Earth is not used */
+static void (*const helio_coords[LN_PLANET_COUNT])(double,
+    struct ln_helio_posn *) = {
+    ln_get_mercury_helio_coords, ln_get_venus_helio_coords, NULL,
+    ln_get_mars_helio_coords, ln_get_jupiter_helio_coords,
+    ln_get_saturn_helio_coords, ln_get_uranus_helio_coords,
+    ln_get_neptune_helio_coords, ln_get_pluto_helio_coords
+};
+
+/* forget the entries of a cache calculated with older tables */
+static struct helio_cache *helio_cache_current(enum ln_planet planet)
+{
+    struct helio_cache *cache = &helio_cache[planet];
+
+    if (cache->generation != cache_generation) {
+        cache->generation = cache_generation;
+        cache->used = 0;
+        cache->next = 0;
+    }
+
+    return cache;
+}
+
+/* look up JD in the planet cache, returns 1 and the position on a hit */
+int helio_cache_get(enum ln_planet planet, double JD,
+    struct ln_helio_posn *position)
+{
+    struct helio_cache *cache = helio_cache_current(planet);
+    int i, used = cache->used;
+
+    if (used > cache_size[planet])
+        used = cache_size[planet];
+
+    for (i = 0; i < used; i++) {
+        if (cache->entry[i].JD == JD) {
+            *position = cache->entry[i].position;
+            cache->hits++;
+            return 1;
+        }
+    }
+
+    cache->misses++;
+    return 0;
+}
+
+/* store a calculated position, replacing the oldest entry when full */
+void helio_cache_put(enum ln_planet planet, double JD,
+    const struct ln_helio_posn *position)
+{
+    struct helio_cache *cache = helio_cache_current(planet);
+    int size = cache_size[planet];
+
+    if (size == 0)
+        return;
+
+    if (cache->next >= size)
+        cache->next = 0;
+
+    cache->entry[cache->next].JD = JD;
+    cache->entry[cache->next].position = *position;
+    cache->next++;
+
+    if (cache->used < cache->next)
+        cache->used = cache->next;
+}
+
+/* invalidate the cached positions of all planets in all threads */
+void helio_cache_invalidate(void)
+{
+    cache_generation++;
+}
+
+/*! \fn int ln_set_helio_cache_size(enum ln_planet planet, int size)
+* \param planet Planet
+* \param size Number of cached positions, 0 - LN_HELIO_CACHE_MAX
+* \return 0 for success, -1 for an invalid planet or size.
+*
+* Set the number of heliocentric positions remembered for the planet. A
+* size of 0 disables the cache. The size is shared by all threads and
+* should be set before the threads start calculating positions.
+*
+* The cache is keyed by exact julian day. The default size of
+* LN_HELIO_CACHE_DEFAULT covers the light time iteration of the equatorial
+* coordinate functions and the three days used by the rise and set
+* functions.
+*/
+int ln_set_helio_cache_size(enum ln_planet planet, int size)
+{
+    if (planet < 0 || planet >= LN_PLANET_COUNT ||
+        size < 0 || size > LN_HELIO_CACHE_MAX)
+        return -1;
+
+    cache_size[planet] = size;
+    return 0;
+}
+
+/*! \fn int ln_get_helio_cache_stats(enum ln_planet planet, struct ln_cache_stats *stats)
+* \param planet Planet
+* \param stats Pointer to store the cache size and counters
+* \return 0 for success, -1 for an invalid planet.
+*
+* Get the cache size of the planet and the number of lookups served by the
+* cache (hits) and calculated (misses) in the calling thread. The stats are
+* zeroed for an invalid planet.
+*/
+int ln_get_helio_cache_stats(enum ln_planet planet,
+    struct ln_cache_stats *stats)
+{
+    if (planet < 0 || planet >= LN_PLANET_COUNT) {
+        stats->size = 0;
+        stats->hits = 0;
+        stats->misses = 0;
+        return -1;
+    }
+
+    stats->size = cache_size[planet];
+    stats->hits = helio_cache[planet].hits;
+    stats->misses = helio_cache[planet].misses;
+    return 0;
+}
+
+/*! \fn int ln_reset_helio_cache(enum ln_planet planet)
+* \param planet Planet
+* \return 0 for success, -1 for an invalid planet.
+*
+* Forget the cached positions of the planet and clear the hit and miss
+* counters of the calling thread.
+*/
+int ln_reset_helio_cache(enum ln_planet planet)
+{
+    if (planet < 0 || planet >= LN_PLANET_COUNT)
+        return -1;
+
+    helio_cache[planet].used = 0;
+    helio_cache[planet].next = 0;
+    helio_cache[planet].hits = 0;
+    helio_cache[planet].misses = 0;
+    return 0;
+}
+
+/* ecliptical coordinates from equatorial rectangular coordinates */
+static void planet_ecl_from_rect(double a, double b, double c,
+    struct ln_lnlat_posn *position)
+{
+    double sin_e, cos_e, x, y, z;
+
+    /* ecliptic J2000, as used by ln_get_rect_from_helio() */
+    sin_e = 0.397777156;
+    cos_e = 0.917482062;
+
+    x = a;
+    y = b * cos_e + c * sin_e;
+    z = c * cos_e - b * sin_e;
+
+    position->lng = ln_range_degrees(ln_rad_to_deg(atan2(y, x)));
+    position->lat = ln_rad_to_deg(atan2(z, sqrt(x * x + y * y)));
+}
+
+/* geocentric position of a planet, same iteration as the
+ * ln_get_<planet>_equ_coords() functions */
+static void planet_posn(enum ln_planet planet, double JD,
+    struct ln_rect_posn *g_sol, struct ln_planet_posn *position)
+{
+    struct ln_helio_posn h_planet;
+    struct ln_rect_posn g_planet;
+    double a,b,c;
+    double ra, dec, delta, diff, last, t = 0;
+
+    do {
+        last = t;
+        helio_coords[planet](JD - t, &h_planet);
+        ln_get_rect_from_helio(&h_planet, &g_planet);
+
+        /* equ 33.10 pg 229 */
+        a = g_sol->X + g_planet.X;
+        b = g_sol->Y + g_planet.Y;
+        c = g_sol->Z + g_planet.Z;
+
+        delta = a*a + b*b + c*c;
+        delta = sqrt(delta);
+        t = delta * 0.0057755183;
+        diff = t - last;
+    } while (diff > 0.0001 || diff < -0.0001);
+
+    ra = atan2(b,a);
+    dec = c / delta;
+    dec = asin(dec);
+
+    /* back to hours, degrees */
+    position->equ.ra = ln_range_degrees(ln_rad_to_deg(ra));
+    position->equ.dec = ln_rad_to_deg(dec);
+
+    planet_ecl_from_rect(a, b, c, &position->ecl);
+    position->earth_dist = delta;
+    position->solar_dist = h_planet.R;
+    position->light_time = last;
+}
+
+/*! \fn void ln_get_planets_posn(double JD, struct ln_planet_posn *positions, int threads)
+* \param JD Julian day
+* \param positions Array of LN_PLANET_COUNT positions, indexed by enum ln_planet
+* \param threads Number of threads to use, 0 or 1 to use the calling thread
+*
+* Calculate the geocentric positions of all planets for the given julian
+* day. The equatorial coordinates are the same as returned by the
+* ln_get_<planet>_equ_coords() functions and include light time, but not
+* nutation or aberration. The ecliptical coordinates are referred to the
+* J2000 ecliptic.
+*
+* The position of the Earth is calculated once and shared by the light
+* time iterations of all planets. positions[LN_EARTH] holds the geometric
+* position of the Sun, its solar_dist is the Earth radius vector.
+*
+* When libnova is built with OpenMP support the planets are spread over
+* up to threads threads, otherwise threads is ignored.
+*/
+void ln_get_planets_posn(double JD, struct ln_planet_posn *positions,
+    int threads)
+{
+    struct ln_helio_posn h_sol;
+    struct ln_rect_posn g_sol;
+    int planet;
+
+    /* geocentric position of the Sun, shared by all planets */
+    ln_get_solar_geom_coords(JD, &h_sol);
+    ln_get_rect_from_helio(&h_sol, &g_sol);
+
+    positions[LN_EARTH].equ.ra =
+        ln_range_degrees(ln_rad_to_deg(atan2(g_sol.Y, g_sol.X)));
+    positions[LN_EARTH].equ.dec = ln_rad_to_deg(asin(g_sol.Z / h_sol.R));
+    positions[LN_EARTH].ecl.lng = h_sol.L;
+    positions[LN_EARTH].ecl.lat = h_sol.B;
+    positions[LN_EARTH].earth_dist = h_sol.R;
+    positions[LN_EARTH].solar_dist = h_sol.R;
+    positions[LN_EARTH].light_time = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(threads > 1) num_threads(threads > 1 ? threads : 1)
+#endif
+    for (planet = 0; planet < LN_PLANET_COUNT; planet++) {
+        if (planet != LN_EARTH)
+            planet_posn(planet, JD, &g_sol, &positions[planet]);
+    }
+}
@@ -25,6 +25,7 @@
 #include <libnova/transform.h>
 #include <libnova/rise_set.h>
 #include <libnova/utility.h>
+#include "planets-priv.h"
 
 #include <stdlib.h>
 #include <math.h>
@@ -47,9 +48,6 @@ struct pluto_radius {
     double A, B;
 };
 
-/* cache variables */
-static double cJD = 0.0, cL = 0.0, cB = 0.0, cR = 0.0;
-
 static const struct pluto_argument argument[PLUTO_COEFFS] = {
     {0, 0, 1},
     {0, 0, 2},
@@ -300,13 +298,8 @@ void ln_get_pluto_helio_coords(double JD, struct ln_helio_posn *position)
     int i;
 
     /* check cache first */
-    if(JD == cJD) {
-        /* cache hit */
-        position->L = cL;
-        position->B = cB;
-        position->R = cR;
+    if (helio_cache_get(LN_PLUTO, JD, position))
         return;
-    }
 
     /* get julian centuries since J2000 */
     t =(JD - 2451545.0) / 36525.0;
@@ -338,10 +331,7 @@ void ln_get_pluto_helio_coords(double JD, struct ln_helio_posn *position)
     position->R = 40.7241346 + sum_radius * 0.0000001;
 
     /* save cache */
-    cJD = JD;
-    cL = position->L;
-    cB = position->B;
-    cR = position->R;
+    helio_cache_put(LN_PLUTO, JD, position);
 }
 
 /*! \fn double ln_get_pluto_earth_dist(double JD);
@@ -19,6 +19,7 @@
 #include "config.h"
 
 #include <libnova/precession.h>
+#include <libnova/rotation.h>
 #include <libnova/utility.h>
 
 #include <math.h>
@@ -82,7 +83,7 @@ void ln_get_equ_prec(struct ln_equ_posn *mean_position, double JD,
     t2 = t * t;
     t3 = t2 *t;
     zeta  = 2306.2181 * t + 0.30188 * t2 + 0.017998 * t3;
-    eta   = 2306.2181 * t + 1.09468 * t2 + 0.041833 * t3;
+    eta   = 2306.2181 * t + 1.09468 * t2 + 0.018203 * t3;
     theta = 2004.3109 * t - 0.42665 * t2 - 0.041833 * t3;
     zeta  = ln_deg_to_rad(zeta  / 3600.0);
     eta   = ln_deg_to_rad(eta   / 3600.0);
@@ -196,3 +197,87 @@ void ln_get_ecl_prec(struct ln_lnlat_posn *mean_position, double JD,
 {
 
 }
+
+/* rotation of Equ 20.4 for the angles zeta, z and theta in arcsec */
+static void prec_matrix(double zeta, double eta, double theta,
+    struct ln_rot_matrix *matrix)
+{
+    double cz, sz, ce, se, ct, st;
+
+    zeta  = ln_deg_to_rad(zeta  / 3600.0);
+    eta   = ln_deg_to_rad(eta   / 3600.0);
+    theta = ln_deg_to_rad(theta / 3600.0);
+
+    cz = cos(zeta);
+    sz = sin(zeta);
+    ce = cos(eta);
+    se = sin(eta);
+    ct = cos(theta);
+    st = sin(theta);
+
+    matrix->m[0][0] = ce * ct * cz - se * sz;
+    matrix->m[0][1] = -ce * ct * sz - se * cz;
+    matrix->m[0][2] = -ce * st;
+    matrix->m[1][0] = se * ct * cz + ce * sz;
+    matrix->m[1][1] = -se * ct * sz + ce * cz;
+    matrix->m[1][2] = -se * st;
+    matrix->m[2][0] = st * cz;
+    matrix->m[2][1] = -st * sz;
+    matrix->m[2][2] = ct;
+}
+
+/*! \fn void ln_get_prec_matrix(double JD, struct ln_rot_matrix *matrix)
+* \param JD Julian day
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation of equatorial rectangular coordinates from the mean
+* equator and equinox of J2000.0 to those of JD, the precession of
+* ln_get_equ_prec2() from J2000.0.
+*/
+/* Equ 20.3 pg 126
+*/
+void ln_get_prec_matrix(double JD, struct ln_rot_matrix *matrix)
+{
+    double t, t2, t3;
+
+    t = (JD - JD2000) / 36525.0;
+    t2 = t * t;
+    t3 = t2 * t;
+
+    prec_matrix(2306.2181 * t + 0.30188 * t2 + 0.017998 * t3,
+        2306.2181 * t + 1.09468 * t2 + 0.018203 * t3,
+        2004.3109 * t - 0.42665 * t2 - 0.041833 * t3, matrix);
+}
+
+/*! \fn void ln_get_prec2_matrix(double fromJD, double toJD, struct ln_rot_matrix *matrix)
+* \param fromJD Julian day (start)
+* \param toJD Julian day (end)
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation of equatorial rectangular coordinates from the mean
+* equator and equinox of fromJD to those of toJD, the precession of
+* ln_get_equ_prec2().
+*/
+/* Equ 20.2 pg 126
+*/
+void ln_get_prec2_matrix(double fromJD, double toJD,
+    struct ln_rot_matrix *matrix)
+{
+    double t, t2, t3, T, T2;
+
+    T = (fromJD - JD2000) / 36525.0;
+    t = (toJD - fromJD) / 36525.0;
+    T2 = T * T;
+    t2 = t * t;
+    t3 = t2 * t;
+
+    prec_matrix((2306.2181 + 1.39656 * T - 0.000139 * T2) * t
+            + (0.30188 - 0.000344 * T) * t2
+            + 0.017998 * t3,
+        (2306.2181 + 1.39656 * T - 0.000139 * T2) * t
+            + (1.09468 + 0.000066 * T) * t2
+            + 0.018203 * t3,
+        (2004.3109 - 0.85330 * T - 0.000217 * T2) * t
+            - (0.42665 + 0.000217 * T) * t2
+            - 0.041833 * t3, matrix);
+}
@@ -0,0 +1,177 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <libnova/rotation.h>
+#include <libnova/utility.h>
+
+#include <math.h>
+
+/*! \fn void ln_get_rot_matrix_identity(struct ln_rot_matrix *matrix)
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation that leaves every vector unchanged.
+*/
+void ln_get_rot_matrix_identity(struct ln_rot_matrix *matrix)
+{
+    int i, j;
+
+    for (i = 0; i < 3; i++)
+        for (j = 0; j < 3; j++)
+            matrix->m[i][j] = i == j ? 1.0 : 0.0;
+}
+
+/*! \fn void ln_rot_matrix_mul(const struct ln_rot_matrix *a, const struct ln_rot_matrix *b, struct ln_rot_matrix *product)
+* \param a Rotation applied second
+* \param b Rotation applied first
+* \param product Pointer to store the rotation a * b
+*
+* Combine two rotations into one, rotating by b and then by a. The product
+* may be stored in a or b.
+*/
+void ln_rot_matrix_mul(const struct ln_rot_matrix *a,
+    const struct ln_rot_matrix *b, struct ln_rot_matrix *product)
+{
+    struct ln_rot_matrix p;
+    int i, j;
+
+    for (i = 0; i < 3; i++)
+        for (j = 0; j < 3; j++)
+            p.m[i][j] = a->m[i][0] * b->m[0][j] + a->m[i][1] * b->m[1][j] +
+                a->m[i][2] * b->m[2][j];
+
+    *product = p;
+}
+
+/*! \fn void ln_rot_matrix_transpose(const struct ln_rot_matrix *matrix, struct ln_rot_matrix *inverse)
+* \param matrix Rotation
+* \param inverse Pointer to store the inverse rotation
+*
+* Get the inverse of a rotation, its transpose. The inverse may be stored
+* in matrix.
+*/
+void ln_rot_matrix_transpose(const struct ln_rot_matrix *matrix,
+    struct ln_rot_matrix *inverse)
+{
+    struct ln_rot_matrix t;
+    int i, j;
+
+    for (i = 0; i < 3; i++)
+        for (j = 0; j < 3; j++)
+            t.m[i][j] = matrix->m[j][i];
+
+    *inverse = t;
+}
+
+/*! \fn void ln_rot_matrix_apply(const struct ln_rot_matrix *matrix, const struct ln_rect_posn *vector, struct ln_rect_posn *result)
+* \param matrix Rotation
+* \param vector Vector to rotate
+* \param result Pointer to store the rotated vector
+*
+* Rotate a vector of rectangular coordinates. The result may be stored in
+* vector.
+*/
+void ln_rot_matrix_apply(const struct ln_rot_matrix *matrix,
+    const struct ln_rect_posn *vector, struct ln_rect_posn *result)
+{
+    double x = vector->X, y = vector->Y, z = vector->Z;
+
+    result->X = matrix->m[0][0] * x + matrix->m[0][1] * y + matrix->m[0][2] * z;
+    result->Y = matrix->m[1][0] * x + matrix->m[1][1] * y + matrix->m[1][2] * z;
+    result->Z = matrix->m[2][0] * x + matrix->m[2][1] * y + matrix->m[2][2] * z;
+}
+
+/*! \fn void ln_rot_matrix_apply_batch(const struct ln_rot_matrix *matrix, const struct ln_rect_posn *vectors, struct ln_rect_posn *result, int n)
+* \param matrix Rotation
+* \param vectors Array of n vectors to rotate
+* \param result Array to store the n rotated vectors
+* \param n Number of vectors
+*
+* Rotate an array of vectors of rectangular coordinates. The result may be
+* stored in vectors.
+*/
+void ln_rot_matrix_apply_batch(const struct ln_rot_matrix *matrix,
+    const struct ln_rect_posn *vectors, struct ln_rect_posn *result, int n)
+{
+    const struct ln_rot_matrix m = *matrix;
+    double x, y, z;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        x = vectors[i].X;
+        y = vectors[i].Y;
+        z = vectors[i].Z;
+        result[i].X = m.m[0][0] * x + m.m[0][1] * y + m.m[0][2] * z;
+        result[i].Y = m.m[1][0] * x + m.m[1][1] * y + m.m[1][2] * z;
+        result[i].Z = m.m[2][0] * x + m.m[2][1] * y + m.m[2][2] * z;
+    }
+}
+
+/*! \fn void ln_get_rect_from_equ(const struct ln_equ_posn *position, struct ln_rect_posn *vector)
+* \param position Spherical coordinates, right ascension or longitude and declination or latitude
+* \param vector Pointer to store the unit vector
+*
+* Get the unit vector pointing to spherical coordinates.
+*/
+void ln_get_rect_from_equ(const struct ln_equ_posn *position,
+    struct ln_rect_posn *vector)
+{
+    double ra, dec, cos_dec;
+
+    ra = ln_deg_to_rad(position->ra);
+    dec = ln_deg_to_rad(position->dec);
+    cos_dec = cos(dec);
+
+    vector->X = cos_dec * cos(ra);
+    vector->Y = cos_dec * sin(ra);
+    vector->Z = sin(dec);
+}
+
+/*! \fn void ln_get_equ_from_rect(const struct ln_rect_posn *vector, struct ln_equ_posn *position)
+* \param vector Vector of rectangular coordinates
+* \param position Pointer to store the spherical coordinates
+*
+* Get the spherical coordinates of the direction of a vector, of any
+* length. The right ascension is in the range 0 - 360 degrees.
+*/
+void ln_get_equ_from_rect(const struct ln_rect_posn *vector,
+    struct ln_equ_posn *position)
+{
+    double x = vector->X, y = vector->Y, z = vector->Z, ra;
+
+    ra = ln_rad_to_deg(atan2(y, x));
+    position->ra = ra < 0.0 ? ra + 360.0 : ra;
+    position->dec = ln_rad_to_deg(atan2(z, sqrt(x * x + y * y)));
+}
+
+/*! \fn void ln_rot_matrix_apply_equ(const struct ln_rot_matrix *matrix, const struct ln_equ_posn *position, struct ln_equ_posn *result)
+* \param matrix Rotation
+* \param position Spherical coordinates to rotate
+* \param result Pointer to store the rotated coordinates
+*
+* Rotate spherical coordinates, e.g. equatorial coordinates to the
+* equator of another epoch. The result may be stored in position.
+*/
+void ln_rot_matrix_apply_equ(const struct ln_rot_matrix *matrix,
+    const struct ln_equ_posn *position, struct ln_equ_posn *result)
+{
+    struct ln_rect_posn vector;
+
+    ln_get_rect_from_equ(position, &vector);
+    ln_rot_matrix_apply(matrix, &vector, &vector);
+    ln_get_equ_from_rect(&vector, result);
+}
@@ -23,6 +23,7 @@
 #include <libnova/sidereal_time.h>
 #include <libnova/nutation.h>
 #include <libnova/precession.h>
+#include <libnova/rotation.h>
 
 #include <math.h>
 
@@ -368,6 +369,84 @@ void ln_get_gal_from_equ2000(struct ln_equ_posn *equ, struct ln_gal_posn *gal)
     ln_get_gal_from_equ(&equ_1950, gal);
 }
 
+/*! \fn void ln_get_ecl_matrix(double JD, struct ln_rot_matrix *matrix)
+* \param JD Julian Day
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation of rectangular coordinates from the mean equator to the
+* mean ecliptic of JD, using the obliquity of ln_get_ecl_from_equ(). The
+* transpose rotates ecliptical to equatorial coordinates.
+*/
+void ln_get_ecl_matrix(double JD, struct ln_rot_matrix *matrix)
+{
+    struct ln_nutation nutation;
+    double ce, se;
+
+    ln_get_nutation(JD, &nutation);
+    ce = cos(ln_deg_to_rad(nutation.ecliptic));
+    se = sin(ln_deg_to_rad(nutation.ecliptic));
+
+    matrix->m[0][0] = 1.0;
+    matrix->m[0][1] = 0.0;
+    matrix->m[0][2] = 0.0;
+    matrix->m[1][0] = 0.0;
+    matrix->m[1][1] = ce;
+    matrix->m[1][2] = se;
+    matrix->m[2][0] = 0.0;
+    matrix->m[2][1] = -se;
+    matrix->m[2][2] = ce;
+}
+
+/*! \fn void ln_get_gal_matrix(struct ln_rot_matrix *matrix)
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation of rectangular coordinates from the B1950 equator to
+* the galactic frame of ln_get_gal_from_equ(). The transpose rotates
+* galactic to B1950 equatorial coordinates.
+*/
+/* Pg 94 */
+void ln_get_gal_matrix(struct ln_rot_matrix *matrix)
+{
+    struct ln_gal_posn origin;
+    struct ln_equ_posn x_axis, pole;
+    struct ln_rect_posn x, z;
+
+    origin.l = 0.0;
+    origin.b = 0.0;
+    pole.ra = 192.25;
+    pole.dec = 27.4;
+
+    /* rows are the galactic axes in B1950 equatorial coordinates */
+    ln_get_equ_from_gal(&origin, &x_axis);
+    ln_get_rect_from_equ(&x_axis, &x);
+    ln_get_rect_from_equ(&pole, &z);
+
+    matrix->m[0][0] = x.X;
+    matrix->m[0][1] = x.Y;
+    matrix->m[0][2] = x.Z;
+    matrix->m[1][0] = z.Y * x.Z - z.Z * x.Y;
+    matrix->m[1][1] = z.Z * x.X - z.X * x.Z;
+    matrix->m[1][2] = z.X * x.Y - z.Y * x.X;
+    matrix->m[2][0] = z.X;
+    matrix->m[2][1] = z.Y;
+    matrix->m[2][2] = z.Z;
+}
+
+/*! \fn void ln_get_gal2000_matrix(struct ln_rot_matrix *matrix)
+* \param matrix Pointer to store the rotation
+*
+* Get the rotation of rectangular coordinates from the J2000 equator to
+* the galactic frame of ln_get_gal_from_equ2000().
+*/
+void ln_get_gal2000_matrix(struct ln_rot_matrix *matrix)
+{
+    struct ln_rot_matrix prec;
+
+    ln_get_prec2_matrix(JD2000, B1950, &prec);
+    ln_get_gal_matrix(matrix);
+    ln_rot_matrix_mul(matrix, &prec, matrix);
+}
+
 /*! \example transforms.c
  *
  * Examples of how to use transformation functions.
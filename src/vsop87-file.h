@@ -0,0 +1,47 @@
+#ifndef _LN_VSOP87_FILE_H
+#define _LN_VSOP87_FILE_H
+
+#include <stdint.h>
+
+/* Binary VSOP87 coefficient file written by tools/vsop87bin and mapped by
+ * ln_vsop87_load_tables(). The file holds a header followed by the term
+ * tables, every table starts at a multiple of VSOP87_FILE_ALIGN bytes and
+ * is an array of struct ln_vsop in native byte order, sorted by decreasing
+ * amplitude. */
+
+#define VSOP87_FILE_MAGIC	"LNVSOP87"
+#define VSOP87_FILE_VERSION	1
+#define VSOP87_FILE_BYTE_ORDER	0x01020304
+
+/* alignment of every table in the file */
+#define VSOP87_FILE_ALIGN	32
+
+/* Mercury to Neptune, in enum ln_planet order without Pluto */
+#define VSOP87_FILE_PLANETS	8
+
+/* L, B and R */
+#define VSOP87_FILE_VARIABLES	3
+
+/* maximum power of t, same as VSOP87_POWERS */
+#define VSOP87_FILE_POWERS	6
+
+/* location of a table, size is the number of terms */
+struct vsop87_file_series
+{
+	uint64_t offset;
+	uint32_t size;
+	uint32_t reserved;
+};
+
+struct vsop87_file_header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t planets;
+	uint32_t powers;
+	struct vsop87_file_series
+		series[VSOP87_FILE_PLANETS][VSOP87_FILE_VARIABLES][VSOP87_FILE_POWERS];
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef _LN_VSOP87_PRIV_H
+#define _LN_VSOP87_PRIV_H
+
+#include <libnova/vsop87.h>
+
+/* maximum power of t in a VSOP87 series */
+#define VSOP87_POWERS	6
+
+/* number of epochs evaluated together by the batch functions */
+#define VSOP87_BATCH_SIZE	128
+
+/* a single VSOP87 series, the sum is multiplied by t^n */
+struct vsop87_series
+{
+	const struct ln_vsop *terms;
+	int size;
+};
+
+/* all VSOP87 series for a planet, unused powers have zero size. The terms
+ * of every series are sorted by decreasing amplitude. */
+struct vsop87_planet
+{
+	struct vsop87_series L[VSOP87_POWERS];
+	struct vsop87_series B[VSOP87_POWERS];
+	struct vsop87_series R[VSOP87_POWERS];
+};
+
+/* a series split into aligned arrays of A, B and C for the SIMD kernel */
+struct vsop87_soa_series
+{
+	const double *A;
+	const double *B;
+	const double *C;
+	int size;
+};
+
+/* structure of arrays copy of all series of a planet */
+struct vsop87_soa
+{
+	struct vsop87_soa_series L[VSOP87_POWERS];
+	struct vsop87_soa_series B[VSOP87_POWERS];
+	struct vsop87_soa_series R[VSOP87_POWERS];
+	void *data;
+};
+
+extern const struct vsop87_planet vsop87_mercury;
+extern const struct vsop87_planet vsop87_venus;
+extern const struct vsop87_planet vsop87_earth;
+extern const struct vsop87_planet vsop87_mars;
+extern const struct vsop87_planet vsop87_jupiter;
+extern const struct vsop87_planet vsop87_saturn;
+extern const struct vsop87_planet vsop87_uranus;
+extern const struct vsop87_planet vsop87_neptune;
+
+const struct vsop87_planet *vsop87_get_planet(enum ln_planet planet);
+
+void vsop87_get_helio_coords(const struct vsop87_planet *planet, double JD,
+	struct ln_helio_posn *position);
+
+void vsop87_get_helio_coords_batch(const struct vsop87_planet *planet,
+	const double *JD, struct ln_helio_posn *position, int n);
+
+void vsop87_get_helio_coords_prec(const struct vsop87_planet *planet,
+	double JD, struct ln_helio_posn *position, double precision);
+
+void vsop87_get_helio_coords_vel(const struct vsop87_planet *planet,
+	double JD, struct ln_helio_posn *position,
+	struct ln_helio_posn *velocity);
+
+#endif
@@ -23,8 +23,57 @@
 
 #include <libnova/vsop87.h>
 #include <libnova/utility.h>
+#include "implementation.h"
+#include "planets-priv.h"
+#include "coeff-file-priv.h"
+#include "vsop87-file.h"
+#include "vsop87-priv.h"
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#if LN_HAVE_ATOMICS
+#include <stdatomic.h>
+#endif
+
+/* compiled in VSOP87 series of every planet, Pluto is not part of VSOP87 */
+static const struct vsop87_planet *const vsop87_builtin[LN_PLANET_COUNT] = {
+    &vsop87_mercury, &vsop87_venus, &vsop87_earth, &vsop87_mars,
+    &vsop87_jupiter, &vsop87_saturn, &vsop87_uranus, &vsop87_neptune, NULL
+};
+
+/* series in use, either compiled in or loaded from a file */
+static const struct vsop87_planet *vsop87_planets[LN_PLANET_COUNT] = {
+    &vsop87_mercury, &vsop87_venus, &vsop87_earth, &vsop87_mars,
+    &vsop87_jupiter, &vsop87_saturn, &vsop87_uranus, &vsop87_neptune, NULL
+};
+
+/* series loaded from a coefficient file and the file contents */
+static struct vsop87_planet vsop87_loaded[VSOP87_FILE_PLANETS];
+static struct coeff_file vsop87_file;
+
+/* structure of arrays copies of the compiled in and loaded series, built
+ * on first use */
+#if LN_HAVE_ATOMICS
+static struct vsop87_soa *_Atomic vsop87_soa_builtin[VSOP87_FILE_PLANETS];
+static struct vsop87_soa *_Atomic vsop87_soa_loaded[VSOP87_FILE_PLANETS];
+#endif
+
+/* alignment in doubles of every array of a structure of arrays copy */
+#define SOA_ALIGN		8
+
+/* pi split in three parts for the argument reduction of vsop87_cos, the
+ * first two hold 33 bits each so that q * part is exact */
+#define PI_1			3.14159265346825122834e+00
+#define PI_2			1.21542010126079319532e-10
+#define PI_3			4.04453249759190126308e-21
+
+/* values kept for every term by a stepper, cos and sin of the term angle
+ * and of its change over one step */
+#define STEPPER_STATE		4
 
 double ln_calc_series(const struct ln_vsop *data, int terms, double t)
 {
@@ -68,3 +117,824 @@ void ln_vsop87_to_fk5(struct ln_helio_posn *position, double JD)
     position->L += delta_L;
     position->B += delta_B;
 }
+
+/* cosine for the SIMD kernel, branch free so that it vectorises. The
+ * argument is reduced to -pi/2 .. pi/2 and the Taylor series is summed up
+ * to r^20. The error is below 5e-16 for |x| < 3e6. */
+#ifdef _OPENMP
+#pragma omp declare simd notinbranch
+#endif
+static inline double vsop87_cos(double x)
+{
+    double q, r, z, c;
+
+    /* nearest multiple of pi and remainder, cos(x) = (-1)^q cos(r) */
+    q = floor(x * M_1_PI + 0.5);
+    r = ((x - q * PI_1) - q * PI_2) - q * PI_3;
+    z = r * r;
+
+    c = 1.0 + z * (-0.5 +
+        z * (4.16666666666666643537e-02 +
+        z * (-1.38888888888888894189e-03 +
+        z * (2.48015873015873015658e-05 +
+        z * (-2.75573192239858925110e-07 +
+        z * (2.08767569878680989792e-09 +
+        z * (-1.14707455977297249359e-11 +
+        z * (4.77947733238738525743e-14 +
+        z * (-1.56192069685862249037e-16 +
+        z * 4.11031762331216484676e-19)))))))));
+
+    return q - 2.0 * floor(q * 0.5) == 0.0 ? c : -c;
+}
+
+/* sum the first n terms of a structure of arrays series */
+static double calc_series_simd(const struct vsop87_soa_series *series,
+    int n, double t)
+{
+    const double *A = series->A, *B = series->B, *C = series->C;
+    double value = 0.0;
+    int i;
+
+#ifdef _OPENMP
+#pragma omp simd aligned(A, B, C : 64) reduction(+ : value)
+#endif
+    for (i = 0; i < n; i++)
+        value += A[i] * vsop87_cos(B[i] + C[i] * t);
+
+    return value;
+}
+
+/* number of doubles of an array of n terms, keeping the next one aligned */
+static int soa_length(int n)
+{
+    return (n + SOA_ALIGN - 1) / SOA_ALIGN * SOA_ALIGN;
+}
+
+/* copy the series of a variable into aligned arrays */
+static double *soa_copy_variable(const struct vsop87_series *series,
+    struct vsop87_soa_series *soa, double *data)
+{
+    int i, j, len;
+
+    for (i = 0; i < VSOP87_POWERS; i++) {
+        len = soa_length(series[i].size);
+        soa[i].size = series[i].size;
+        soa[i].A = data;
+        soa[i].B = data + len;
+        soa[i].C = data + 2 * len;
+
+        for (j = 0; j < series[i].size; j++) {
+            data[j] = series[i].terms[j].A;
+            data[len + j] = series[i].terms[j].B;
+            data[2 * len + j] = series[i].terms[j].C;
+        }
+        for (; j < len; j++)
+            data[j] = data[len + j] = data[2 * len + j] = 0.0;
+
+        data += 3 * len;
+    }
+
+    return data;
+}
+
+/* number of doubles used by the arrays of a variable */
+static int soa_variable_length(const struct vsop87_series *series)
+{
+    int i, len = 0;
+
+    for (i = 0; i < VSOP87_POWERS; i++)
+        len += 3 * soa_length(series[i].size);
+
+    return len;
+}
+
+/* build the structure of arrays copy of a planet */
+static struct vsop87_soa *soa_build(const struct vsop87_planet *planet)
+{
+    struct vsop87_soa *soa;
+    double *data;
+    size_t len;
+
+    len = soa_variable_length(planet->L) + soa_variable_length(planet->B) +
+        soa_variable_length(planet->R);
+
+    soa = malloc(sizeof(*soa));
+    if (soa == NULL)
+        return NULL;
+
+    soa->data = malloc(sizeof(double) * (len + SOA_ALIGN));
+    if (soa->data == NULL) {
+        free(soa);
+        return NULL;
+    }
+
+    /* align the first array */
+    data = (double *)(((uintptr_t)soa->data + sizeof(double) * SOA_ALIGN - 1) &
+        ~(uintptr_t)(sizeof(double) * SOA_ALIGN - 1));
+
+    data = soa_copy_variable(planet->L, soa->L, data);
+    data = soa_copy_variable(planet->B, soa->B, data);
+    soa_copy_variable(planet->R, soa->R, data);
+    return soa;
+}
+
+static void soa_free(struct vsop87_soa *soa)
+{
+    if (soa == NULL)
+        return;
+
+    free(soa->data);
+    free(soa);
+}
+
+/* structure of arrays copy of a planet, built by the first thread that
+ * needs it. Returns NULL when the scalar series have to be used. */
+static const struct vsop87_soa *vsop87_get_soa(
+    const struct vsop87_planet *planet)
+{
+#if LN_HAVE_ATOMICS
+    struct vsop87_soa *_Atomic *slot = NULL;
+    struct vsop87_soa *soa, *expected = NULL;
+    int p;
+
+    for (p = 0; p < VSOP87_FILE_PLANETS; p++) {
+        if (planet == vsop87_builtin[p])
+            slot = &vsop87_soa_builtin[p];
+        else if (planet == &vsop87_loaded[p])
+            slot = &vsop87_soa_loaded[p];
+        else
+            continue;
+        break;
+    }
+
+    if (slot == NULL)
+        return NULL;
+
+    soa = atomic_load(slot);
+    if (soa != NULL)
+        return soa;
+
+    soa = soa_build(planet);
+    if (soa == NULL)
+        return NULL;
+
+    /* another thread may have been faster */
+    if (!atomic_compare_exchange_strong(slot, &expected, soa)) {
+        soa_free(soa);
+        soa = expected;
+    }
+
+    return soa;
+#else
+    return NULL;
+#endif
+}
+
+/*! \fn const struct vsop87_planet *vsop87_get_planet(enum ln_planet planet)
+* \param planet Planet
+* \return VSOP87 series of the planet in use
+*
+* Get the series of the planet, either compiled in or loaded by
+* ln_vsop87_load_tables().
+*/
+const struct vsop87_planet *vsop87_get_planet(enum ln_planet planet)
+{
+    return vsop87_planets[planet];
+}
+
+/* sum the first n terms of a series, with the SIMD kernel when the
+ * structure of arrays copy is available */
+static double calc_series(const struct vsop87_series *series,
+    const struct vsop87_soa_series *soa, int n, double t)
+{
+    if (soa != NULL)
+        return calc_series_simd(soa, n, t);
+
+    return ln_calc_series(series->terms, n, t);
+}
+
+/* sum all powers of a variable, X0 + X1 * t + X2 * t2 + ... */
+static double calc_variable(const struct vsop87_series *series,
+    const struct vsop87_soa_series *soa, double t)
+{
+    double value, tn = t;
+    int i;
+
+    value = calc_series(&series[0], soa, series[0].size, t);
+
+    for (i = 1; i < VSOP87_POWERS && series[i].size > 0; i++) {
+        value += calc_series(&series[i], soa ? &soa[i] : NULL,
+            series[i].size, t) * tn;
+        tn *= t;
+    }
+
+    return value;
+}
+
+/*! \fn void vsop87_get_helio_coords(const struct vsop87_planet *planet, double JD, struct ln_helio_posn *position)
+* \param planet VSOP87 series of the planet
+* \param JD Julian Day
+* \param position Pointer to store heliocentric position
+*
+* Calculate heliocentric coordinates in the FK5 reference frame.
+*
+* The series are summed by a SIMD kernel over structure of arrays copies
+* of the tables, using an inline cosine that vectorises. The positions
+* differ from summing with ln_calc_series() by less than 1e-13 degrees and
+* 1e-14 AU. Without C11 atomics ln_calc_series() is used.
+*/
+/* Chapter 31 Pg 206-207 Equ 31.1 31.2 , 31.3 using VSOP 87
+*/
+void vsop87_get_helio_coords(const struct vsop87_planet *planet, double JD,
+    struct ln_helio_posn *position)
+{
+    const struct vsop87_soa *soa = vsop87_get_soa(planet);
+    double t;
+
+    /* get julian ephemeris millennia */
+    t = (JD - 2451545.0) / 365250.0;
+
+    position->L = calc_variable(planet->L, soa ? soa->L : NULL, t);
+    position->B = calc_variable(planet->B, soa ? soa->B : NULL, t);
+    position->R = calc_variable(planet->R, soa ? soa->R : NULL, t);
+
+    /* change to degrees in correct quadrant */
+    position->L = ln_range_degrees(ln_rad_to_deg(position->L));
+    position->B = ln_rad_to_deg(position->B);
+
+    /* change to fk5 reference frame */
+    ln_vsop87_to_fk5(position, JD);
+}
+
+/* sum a series for n epochs, every term is read once for the whole block */
+static void calc_series_batch(const struct vsop87_series *series,
+    const double *t, double *value, int n)
+{
+    const struct ln_vsop *data = series->terms;
+    double A, B, C;
+    int i, j;
+
+    for (j = 0; j < n; j++)
+        value[j] = 0.0;
+
+    for (i = 0; i < series->size; i++) {
+        A = data->A;
+        B = data->B;
+        C = data->C;
+
+        for (j = 0; j < n; j++)
+            value[j] += A * cos(B + C * t[j]);
+
+        data++;
+    }
+}
+
+/* sum all powers of a variable, X0 + X1 * t + X2 * t2 + ... */
+static void calc_variable_batch(const struct vsop87_series *series,
+    const double *t, double *value, int n)
+{
+    double sum[VSOP87_BATCH_SIZE], tn[VSOP87_BATCH_SIZE];
+    int i, j;
+
+    calc_series_batch(&series[0], t, value, n);
+
+    for (j = 0; j < n; j++)
+        tn[j] = t[j];
+
+    for (i = 1; i < VSOP87_POWERS && series[i].size > 0; i++) {
+        calc_series_batch(&series[i], t, sum, n);
+
+        for (j = 0; j < n; j++) {
+            value[j] += sum[j] * tn[j];
+            tn[j] *= t[j];
+        }
+    }
+}
+
+/*! \fn void vsop87_get_helio_coords_batch(const struct vsop87_planet *planet, const double *JD, struct ln_helio_posn *position, int n)
+* \param planet VSOP87 series of the planet
+* \param JD Array of Julian Days
+* \param position Array to store the heliocentric positions
+* \param n Number of epochs
+*
+* Calculate heliocentric coordinates for n epochs. The epochs are processed
+* in blocks of VSOP87_BATCH_SIZE so that every table row is loaded once per
+* block and applied to all of its epochs instead of streaming the whole
+* table through the cache again for every epoch.
+*/
+void vsop87_get_helio_coords_batch(const struct vsop87_planet *planet,
+    const double *JD, struct ln_helio_posn *position, int n)
+{
+    double t[VSOP87_BATCH_SIZE];
+    double L[VSOP87_BATCH_SIZE], B[VSOP87_BATCH_SIZE], R[VSOP87_BATCH_SIZE];
+    int i, j, block;
+
+    for (i = 0; i < n; i += block) {
+        block = n - i;
+        if (block > VSOP87_BATCH_SIZE)
+            block = VSOP87_BATCH_SIZE;
+
+        /* get julian ephemeris millennia */
+        for (j = 0; j < block; j++)
+            t[j] = (JD[i + j] - 2451545.0) / 365250.0;
+
+        calc_variable_batch(planet->L, t, L, block);
+        calc_variable_batch(planet->B, t, B, block);
+        calc_variable_batch(planet->R, t, R, block);
+
+        for (j = 0; j < block; j++) {
+            /* change to degrees in correct quadrant */
+            position[i + j].L = ln_range_degrees(ln_rad_to_deg(L[j]));
+            position[i + j].B = ln_rad_to_deg(B[j]);
+            position[i + j].R = R[j];
+
+            /* change to fk5 reference frame */
+            ln_vsop87_to_fk5(&position[i + j], JD[i + j]);
+        }
+    }
+}
+
+/* number of leading terms with amplitude of at least limit, the tables are
+ * sorted by decreasing amplitude */
+static int calc_series_prefix(const struct vsop87_series *series, double limit)
+{
+    int low = 0, high = series->size, mid;
+
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (fabs(series->terms[mid].A) >= limit)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return low;
+}
+
+/* sum all powers of a variable skipping terms whose A * t^n is below limit */
+static double calc_variable_prec(const struct vsop87_series *series,
+    const struct vsop87_soa_series *soa, double t, double limit)
+{
+    double value, tn = t;
+    int i, terms;
+
+    value = calc_series(&series[0], soa,
+        calc_series_prefix(&series[0], limit), t);
+
+    for (i = 1; i < VSOP87_POWERS && series[i].size > 0; i++) {
+        if (tn != 0.0) {
+            terms = calc_series_prefix(&series[i], limit / fabs(tn));
+            value += calc_series(&series[i], soa ? &soa[i] : NULL,
+                terms, t) * tn;
+        }
+        tn *= t;
+    }
+
+    return value;
+}
+
+/*! \fn void vsop87_get_helio_coords_prec(const struct vsop87_planet *planet, double JD, struct ln_helio_posn *position, double precision)
+* \param planet VSOP87 series of the planet
+* \param JD Julian Day
+* \param position Pointer to store heliocentric position
+* \param precision Truncation level in arc seconds
+*
+* Calculate heliocentric coordinates skipping every term whose amplitude,
+* multiplied by t^n, is smaller than precision. The tables are sorted by
+* decreasing amplitude so the kept terms are a prefix of each table. The
+* radius vector terms are truncated at the same angular level relative to
+* the mean distance of the planet.
+*
+* The skipped terms add up to an error of about 5 to 15 times precision,
+* so precision should be about a tenth of the required accuracy.
+*/
+void vsop87_get_helio_coords_prec(const struct vsop87_planet *planet,
+    double JD, struct ln_helio_posn *position, double precision)
+{
+    const struct vsop87_soa *soa = vsop87_get_soa(planet);
+    double t, limit;
+
+    /* get julian ephemeris millennia */
+    t = (JD - 2451545.0) / 365250.0;
+    limit = ln_deg_to_rad(precision / 3600.0);
+
+    position->L = calc_variable_prec(planet->L, soa ? soa->L : NULL, t, limit);
+    position->B = calc_variable_prec(planet->B, soa ? soa->B : NULL, t, limit);
+    position->R = calc_variable_prec(planet->R, soa ? soa->R : NULL, t,
+        limit * planet->R[0].terms[0].A);
+
+    /* change to degrees in correct quadrant */
+    position->L = ln_range_degrees(ln_rad_to_deg(position->L));
+    position->B = ln_rad_to_deg(position->B);
+
+    /* change to fk5 reference frame */
+    ln_vsop87_to_fk5(position, JD);
+}
+
+/* sum a series and its derivative with respect to t */
+static double calc_series_vel(const struct vsop87_series *series, double t,
+    double *rate)
+{
+    const struct ln_vsop *data = series->terms;
+    double value = 0.0, arg;
+    int i;
+
+    *rate = 0.0;
+    for (i = 0; i < series->size; i++) {
+        arg = data->B + data->C * t;
+        value += data->A * cos(arg);
+        *rate -= data->A * data->C * sin(arg);
+        data++;
+    }
+
+    return value;
+}
+
+/* sum all powers of a variable and its derivative, d(Xn * t^n)/dt is
+ * Xn' * t^n + n * Xn * t^(n-1) */
+static double calc_variable_vel(const struct vsop87_series *series,
+    double t, double *rate)
+{
+    double value, sum, sum_rate, tn = t, tn1 = 1.0;
+    int i;
+
+    value = calc_series_vel(&series[0], t, rate);
+
+    for (i = 1; i < VSOP87_POWERS && series[i].size > 0; i++) {
+        sum = calc_series_vel(&series[i], t, &sum_rate);
+        value += sum * tn;
+        *rate += sum_rate * tn + i * sum * tn1;
+        tn1 = tn;
+        tn *= t;
+    }
+
+    return value;
+}
+
+/* rate of change of the FK5 correction of ln_vsop87_to_fk5(), added to the
+ * VSOP87 rates before the position is corrected */
+static void vsop87_to_fk5_rate(const struct ln_helio_posn *position,
+    struct ln_helio_posn *velocity, double JD)
+{
+    double LL, LL_rate, cos_LL, sin_LL, T, B, cos_B, k = 0.03916 / 3600.0;
+
+    /* get julian centuries from 2000 */
+    T = (JD - 2451545.0) / 36525.0;
+
+    LL = ln_deg_to_rad(position->L + (- 1.397 - 0.00031 * T) * T);
+    LL_rate = ln_deg_to_rad(velocity->L + (- 1.397 - 0.00062 * T) / 36525.0);
+    cos_LL = cos(LL);
+    sin_LL = sin(LL);
+    B = ln_deg_to_rad(position->B);
+    cos_B = cos(B);
+
+    velocity->L += k * ((cos_LL - sin_LL) * LL_rate * tan(B) +
+        (cos_LL + sin_LL) * ln_deg_to_rad(velocity->B) / (cos_B * cos_B));
+    velocity->B -= k * (cos_LL + sin_LL) * LL_rate;
+}
+
+/*! \fn void vsop87_get_helio_coords_vel(const struct vsop87_planet *planet, double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity)
+* \param planet VSOP87 series of the planet
+* \param JD Julian Day
+* \param position Pointer to store heliocentric position
+* \param velocity Pointer to store rate of change of the position
+*
+* Calculate heliocentric coordinates and their rates of change. The
+* derivative of every term A * cos(B + C * t) is -A * C * sin(B + C * t),
+* so it shares the argument with the position and both are summed in one
+* pass over the tables. The rates are in degrees per day and AU per day.
+*
+* The rate of change of the FK5 correction is included in the rates.
+*/
+void vsop87_get_helio_coords_vel(const struct vsop87_planet *planet,
+    double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity)
+{
+    double t;
+
+    /* get julian ephemeris millennia */
+    t = (JD - 2451545.0) / 365250.0;
+
+    position->L = calc_variable_vel(planet->L, t, &velocity->L);
+    position->B = calc_variable_vel(planet->B, t, &velocity->B);
+    position->R = calc_variable_vel(planet->R, t, &velocity->R);
+
+    /* change to degrees in correct quadrant */
+    position->L = ln_range_degrees(ln_rad_to_deg(position->L));
+    position->B = ln_rad_to_deg(position->B);
+
+    /* change rates to degrees and AU per day */
+    velocity->L = ln_rad_to_deg(velocity->L) / 365250.0;
+    velocity->B = ln_rad_to_deg(velocity->B) / 365250.0;
+    velocity->R /= 365250.0;
+
+    /* change to fk5 reference frame */
+    vsop87_to_fk5_rate(position, velocity, JD);
+    ln_vsop87_to_fk5(position, JD);
+}
+
+/* number of terms of all series of a variable */
+static int stepper_variable_terms(const struct vsop87_series *series)
+{
+    int i, terms = 0;
+
+    for (i = 0; i < VSOP87_POWERS; i++)
+        terms += series[i].size;
+
+    return terms;
+}
+
+/* set the angles of all terms of a variable exactly, returns the next
+ * unused state */
+static double *stepper_variable_sync(const struct vsop87_series *series,
+    double t, double dt, double *state, int rotation)
+{
+    const struct ln_vsop *data;
+    int i, j;
+
+    for (i = 0; i < VSOP87_POWERS; i++) {
+        data = series[i].terms;
+
+        for (j = 0; j < series[i].size; j++) {
+            state[0] = cos(data->B + data->C * t);
+            state[1] = sin(data->B + data->C * t);
+            if (rotation) {
+                state[2] = cos(data->C * dt);
+                state[3] = sin(data->C * dt);
+            }
+            state += STEPPER_STATE;
+            data++;
+        }
+    }
+
+    return state;
+}
+
+/* sum all powers of a variable from the term angles, in the same order as
+ * ln_calc_series() */
+static double *stepper_variable_sum(const struct vsop87_series *series,
+    double t, double *state, double *value)
+{
+    const struct ln_vsop *data;
+    double sum, tn = 1.0;
+    int i, j;
+
+    *value = 0.0;
+    for (i = 0; i < VSOP87_POWERS; i++) {
+        data = series[i].terms;
+        sum = 0.0;
+
+        for (j = 0; j < series[i].size; j++) {
+            sum += data->A * state[0];
+            state += STEPPER_STATE;
+            data++;
+        }
+
+        *value += sum * tn;
+        tn *= t;
+    }
+
+    return state;
+}
+
+/* rotate all term angles by one step */
+static void stepper_advance(double *state, int terms)
+{
+    double c, s;
+    int i;
+
+    for (i = 0; i < terms; i++) {
+        c = state[0];
+        s = state[1];
+        state[0] = c * state[2] - s * state[3];
+        state[1] = s * state[2] + c * state[3];
+        state += STEPPER_STATE;
+    }
+}
+
+/* set the angles of all terms of a planet exactly */
+static void stepper_sync(struct ln_vsop87_stepper *stepper, double t,
+    int rotation)
+{
+    const struct vsop87_planet *planet = stepper->planet;
+    double dt = stepper->step / 365250.0;
+    double *state = stepper->state;
+
+    state = stepper_variable_sync(planet->L, t, dt, state, rotation);
+    state = stepper_variable_sync(planet->B, t, dt, state, rotation);
+    stepper_variable_sync(planet->R, t, dt, state, rotation);
+}
+
+/*! \fn int ln_vsop87_stepper_init(struct ln_vsop87_stepper *stepper, enum ln_planet planet, double JD, double step, int resync)
+* \param stepper Stepper to initialise
+* \param planet Planet, any planet but LN_PLUTO
+* \param JD Julian day of the first position
+* \param step Step between positions in days
+* \param resync Number of steps between exact evaluations, 0 for LN_VSOP87_STEPPER_RESYNC
+* \return 0 for success, -1 for invalid arguments or when out of memory.
+*
+* Prepare to calculate heliocentric positions of a planet at JD, JD + step,
+* JD + 2 * step and so on with ln_vsop87_stepper_next().
+*
+* Every VSOP87 term A * cos(B + C * t) advances by the constant angle
+* C * step on every step. The stepper keeps the cosine and sine of every
+* term and rotates them by that angle, replacing two calls to cos() and
+* sin() per term with four multiplications. The rounding errors of the
+* rotations grow with the number of steps, so every resync steps the
+* angles are calculated exactly again. With the default resync the
+* positions differ from ln_get_<planet>_helio_coords() by less than
+* 1e-9 degrees.
+*
+* The state must be released with ln_vsop87_stepper_free().
+*/
+int ln_vsop87_stepper_init(struct ln_vsop87_stepper *stepper,
+    enum ln_planet planet, double JD, double step, int resync)
+{
+    const struct vsop87_planet *series;
+
+    stepper->state = NULL;
+    if (planet < 0 || planet >= LN_PLANET_COUNT || resync < 0)
+        return -1;
+
+    series = vsop87_planets[planet];
+    if (series == NULL)
+        return -1;
+
+    stepper->JD0 = JD;
+    stepper->step = step;
+    stepper->steps = 0;
+    stepper->resync = resync > 0 ? resync : LN_VSOP87_STEPPER_RESYNC;
+    stepper->planet = series;
+    stepper->terms = stepper_variable_terms(series->L) +
+        stepper_variable_terms(series->B) + stepper_variable_terms(series->R);
+
+    stepper->state = malloc(sizeof(double) * STEPPER_STATE * stepper->terms);
+    if (stepper->state == NULL)
+        return -1;
+
+    stepper_sync(stepper, (JD - 2451545.0) / 365250.0, 1);
+    return 0;
+}
+
+/*! \fn void ln_vsop87_stepper_free(struct ln_vsop87_stepper *stepper)
+* \param stepper Stepper
+*
+* Release the state allocated by ln_vsop87_stepper_init().
+*/
+void ln_vsop87_stepper_free(struct ln_vsop87_stepper *stepper)
+{
+    free(stepper->state);
+    stepper->state = NULL;
+}
+
+/*! \fn double ln_vsop87_stepper_next(struct ln_vsop87_stepper *stepper, struct ln_helio_posn *position)
+* \param stepper Stepper
+* \param position Pointer to store heliocentric position
+* \return Julian day of the position
+*
+* Calculate the heliocentric position of the planet for the next julian
+* day of the stepper, starting with the julian day passed to
+* ln_vsop87_stepper_init(), and advance the stepper by one step.
+* Longitude and Latitude are in degrees, whilst radius vector is in AU,
+* in the FK5 reference frame.
+*/
+double ln_vsop87_stepper_next(struct ln_vsop87_stepper *stepper,
+    struct ln_helio_posn *position)
+{
+    const struct vsop87_planet *planet = stepper->planet;
+    double *state = stepper->state;
+    double JD, t;
+
+    /* get julian ephemeris millennia */
+    JD = stepper->JD0 + stepper->steps * stepper->step;
+    t = (JD - 2451545.0) / 365250.0;
+
+    if (stepper->steps > 0 && stepper->steps % stepper->resync == 0)
+        stepper_sync(stepper, t, 0);
+
+    state = stepper_variable_sum(planet->L, t, state, &position->L);
+    state = stepper_variable_sum(planet->B, t, state, &position->B);
+    stepper_variable_sum(planet->R, t, state, &position->R);
+
+    /* change to degrees in correct quadrant */
+    position->L = ln_range_degrees(ln_rad_to_deg(position->L));
+    position->B = ln_rad_to_deg(position->B);
+
+    /* change to fk5 reference frame */
+    ln_vsop87_to_fk5(position, JD);
+
+    stepper_advance(stepper->state, stepper->terms);
+    stepper->steps++;
+    return JD;
+}
+
+/* check one table of the file and point the series at it */
+static int vsop87_file_series(const struct vsop87_file_series *fs,
+    const char *data, size_t size, struct vsop87_series *series)
+{
+    series->terms = NULL;
+    series->size = fs->size;
+
+    if (fs->size == 0)
+        return 0;
+
+    if (fs->offset % VSOP87_FILE_ALIGN != 0 || fs->offset > size ||
+        fs->size > (size - fs->offset) / sizeof(struct ln_vsop))
+        return -1;
+
+    series->terms = (const struct ln_vsop *)(data + fs->offset);
+    return 0;
+}
+
+/*! \fn int ln_vsop87_load_tables(const char *filename)
+* \param filename Binary coefficient file written by tools/vsop87bin
+* \return 0 for success, -1 when the file cannot be read or is invalid.
+*
+* Replace the compiled in VSOP87 series of Mercury to Neptune by the series
+* of a binary coefficient file. Where available the file is mapped read
+* only, so the tables are used in place and their pages are shared by all
+* processes using the same file. Otherwise the file is read into memory.
+* A loaded file must not be modified, install new files under a new name
+* or by renaming them over the old one.
+*
+* Files can hold truncated series, e.g. written with the -a option of
+* vsop87bin, to trade accuracy for speed without relinking. The cached
+* positions of all threads are invalidated.
+*
+* Tables must not be loaded or unloaded while other threads are
+* calculating positions, and steppers created before must be freed.
+*/
+int ln_vsop87_load_tables(const char *filename)
+{
+    struct vsop87_planet loaded[VSOP87_FILE_PLANETS];
+    const struct vsop87_file_header *hdr;
+    struct coeff_file file;
+    const char *data;
+    size_t size;
+    int p, i, err = 0;
+
+    if (coeff_file_open(filename, &file) != 0)
+        return -1;
+    data = file.data;
+    size = file.size;
+
+    /* check the header */
+    hdr = file.data;
+    if (size < sizeof(*hdr) ||
+        memcmp(hdr->magic, VSOP87_FILE_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->version != VSOP87_FILE_VERSION ||
+        hdr->byte_order != VSOP87_FILE_BYTE_ORDER ||
+        hdr->planets != VSOP87_FILE_PLANETS ||
+        hdr->powers != VSOP87_POWERS)
+        err = -1;
+
+    for (p = 0; p < VSOP87_FILE_PLANETS && !err; p++) {
+        for (i = 0; i < VSOP87_POWERS && !err; i++) {
+            err |= vsop87_file_series(&hdr->series[p][0][i], data, size,
+                &loaded[p].L[i]);
+            err |= vsop87_file_series(&hdr->series[p][1][i], data, size,
+                &loaded[p].B[i]);
+            err |= vsop87_file_series(&hdr->series[p][2][i], data, size,
+                &loaded[p].R[i]);
+        }
+
+        /* the radius vector scales the truncation of the prec functions */
+        if (loaded[p].L[0].size == 0 || loaded[p].R[0].size == 0)
+            err = -1;
+    }
+
+    if (err) {
+        coeff_file_close(&file);
+        return -1;
+    }
+
+    ln_vsop87_unload_tables();
+
+    memcpy(vsop87_loaded, loaded, sizeof(loaded));
+    for (p = 0; p < VSOP87_FILE_PLANETS; p++)
+        vsop87_planets[p] = &vsop87_loaded[p];
+
+    vsop87_file = file;
+    return 0;
+}
+
+/*! \fn void ln_vsop87_unload_tables(void)
+*
+* Go back to the compiled in VSOP87 series and release the coefficient file
+* loaded by ln_vsop87_load_tables(). The cached positions of all threads
+* are invalidated.
+*/
+void ln_vsop87_unload_tables(void)
+{
+    int p;
+
+    for (p = 0; p < LN_PLANET_COUNT; p++)
+        vsop87_planets[p] = vsop87_builtin[p];
+
+#if LN_HAVE_ATOMICS
+    for (p = 0; p < VSOP87_FILE_PLANETS; p++)
+        soa_free(atomic_exchange(&vsop87_soa_loaded[p], NULL));
+#endif
+
+    coeff_file_close(&vsop87_file);
+    helio_cache_invalidate();
+}
@@ -16,7 +16,14 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 Copyright (C) 2015 Liam Girdwood <lgirdwood@gmail.com>
 */
 
-/* Build ELP C data structures from ELP82 data files */
+/* Build ELP C data structures from ELP82 data files, the rows of every
+ * table are sorted by decreasing amplitude. Rows refer to a dictionary of
+ * the unique arguments of all tables of the same row type.
+ *
+ * With -b the tables and dictionaries are written instead to a binary
+ * coefficient file for ln_lunar_load_tables(). -a drops the rows below an
+ * amplitude in arcsecs, or the same fraction of the mean distance for the
+ * distance tables, to build truncated tables. */
 /* ftp://ftp.imcce.fr/pub/ephem/moon/elp82b/ */
 
 #include <stdlib.h>
@@ -27,175 +34,551 @@ Copyright (C) 2015 Liam Girdwood <lgirdwood@gmail.com>
 #include <fcntl.h>
 #include <errno.h>
 #include <math.h>
+#include <stdint.h>
+
+#include "elp-file.h"
 
 #define HEADER "#include \"lunar-priv.h\"\n"
 
+#ifndef M_PI
+#define M_PI            3.1415926535897932384626433832795
+#endif
+
+/* Chapront theory lunar constants, as used by lunar.c */
+#define     RAD     (648000.0 / M_PI)
+#define     DEG     (M_PI / 180.0)
+#define     AM      0.074801329518
+#define     ALPHA   0.002571881335
+#define     DTASM   (2.0 * ALPHA / (3.0 * AM))
+#define     W12     (1732559343.73604 / RAD)
+#define     ATH     384747.9806743165
+
+/* Corrections of the constants for DE200/LE200 */
+#define     DELNU   ((0.55604 / RAD) / W12)
+#define     DELE    (0.01789 / RAD)
+#define     DELG    (-0.08066 / RAD)
+#define     DELNP   ((-0.06424 / RAD) / W12)
+#define     DELEP   (-0.12879 / RAD)
+
 const char hdr_fname[] = "elp.h";
 const char dat_fname[] = "ELP%d";
 const char c_fname[]   = "elp%d.c";
+const char args_fname[] = "elp_args.c";
+const char bin_fname[] = "elp82.bin";
 
 struct elp {
     int i;
     FILE *fdi, *fdo, *fdh;
     int size;
+    int type;
+    struct row *rows;
+    double *amp, *c, *s;
+    int *id;        /* index of the argument in the dictionary */
+};
+
+/* maximum number of values in a row */
+#define ELP_COLUMNS 14
+
+struct row {
+    double d[ELP_COLUMNS];
 };
 
-/* elp 1 - 3 */
-static void main_parse(struct elp *elp, const char *prefix)
+/* column of the amplitude used to sort the rows */
+static int amplitude_column;
+
+/* sort by decreasing amplitude, rows of equal amplitude keep file order */
+static int row_cmp(const void *a, const void *b)
+{
+    const struct row *ra = a, *rb = b;
+    double A = fabs(ra->d[amplitude_column]);
+    double B = fabs(rb->d[amplitude_column]);
+
+    if (A != B)
+        return A < B ? 1 : -1;
+    return ra < rb ? -1 : ra > rb;
+}
+
+/* read all rows of columns values, skipping the first line of input */
+static struct row *read_rows(struct elp *elp, int columns)
 {
-    char line[1024], out[256], hdr[256];
-    double d[11];
-    int match;
+    char line[1024];
+    struct row *rows = NULL, *tmp;
+    int i, count = 0, alloc = 0;
 
     /* ignore first line of inpput */
     fgets(line, 1024, elp->fdi);
 
-    /* write header */
-    fputs(HEADER, elp->fdo);
-    sprintf(hdr, "const struct %s elp%d[] = {\n", prefix, elp->i);
-    fputs(hdr, elp->fdo);
-
-    elp->size = 0;
-
-    /* read input line by line for coefficients */
-    match = fscanf(
-        elp->fdi, "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf",
-        &d[0], &d[1], &d[2], &d[3], &d[4],
-        &d[5], &d[6], &d[7], &d[8], &d[9], &d[10]
-    );
-    while (match == 11)
-    {
-        sprintf(
-            out, "{{%f, %f, %f, %f}, %f, {%f, %f, %f, %f, %f, %f}},\n",
-            d[0], d[1], d[2], d[3], d[4], d[5], d[6],
-            d[7], d[8], d[9], d[10]
-        );
-        fputs(out, elp->fdo);
-        elp->size++;
-
-        match = fscanf(
-            elp->fdi, "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf",
-            &d[0], &d[1], &d[2], &d[3], &d[4],
-            &d[5], &d[6], &d[7], &d[8], &d[9], &d[10]
-        );
+    for (;;) {
+        if (count == alloc) {
+            alloc = alloc ? alloc * 2 : 1024;
+            tmp = realloc(rows, sizeof(struct row) * alloc);
+            if (!tmp) {
+                fprintf(stderr, "error: out of memory\n");
+                exit(-ENOMEM);
+            }
+            rows = tmp;
+        }
+
+        for (i = 0; i < columns; i++) {
+            if (fscanf(elp->fdi, "%lf", &rows[count].d[i]) != 1)
+                break;
+        }
+        if (i < columns)
+            break;
+        count++;
     }
 
-    fputs("};\n", elp->fdo);
+    elp->size = count;
+    return rows;
 }
 
-/* elp 4 - 9 and the rest*/
-static void earth_parse(struct elp *elp, const char *prefix)
+/* sort rows by decreasing amplitude so the series can be truncated */
+static void sort_rows(struct elp *elp, struct row *rows, int column)
 {
-    char line[1024], out[256], hdr[256];
-    double d[8];
-    int match;
+    amplitude_column = column;
+    qsort(rows, elp->size, sizeof(struct row), row_cmp);
+}
 
-    /* ignore first line of inpput */
-    fgets(line, 1024, elp->fdi);
+/* tables of a row type share one dictionary of arguments */
+enum elp_type {
+    ELP_MAIN,       /* Delaunay arguments */
+    ELP_EARTH,      /* zeta and the linear Delaunay arguments */
+    ELP_PLANET,     /* planetary and linear Delaunay arguments */
+    ELP_TYPES
+};
 
-    /* write header */
-    fputs(HEADER, elp->fdo);
-    sprintf(hdr, "const struct %s elp%d[] = {\n", prefix, elp->i);
-    fputs(hdr, elp->fdo);
+/* multipliers of an argument of each row type */
+static const int type_args[ELP_TYPES] = {4, 5, 12};
+static const char *type_name[ELP_TYPES] = {"main", "earth", "planet"};
+
+/* largest number of multipliers of an argument */
+#define ELP_ARGS    12
+
+/* an argument of the dictionary. Its importance is the largest amplitude
+ * of the rows using it, in radians for longitude and latitude and relative
+ * to the mean distance for distance. */
+struct arg {
+    signed char m[ELP_ARGS];
+    double key;
+    int order;      /* first use, breaks ties of importance */
+    int id;
+};
 
-    elp->size = 0;
+static int nargs[ELP_TYPES];
 
-    match = fscanf(
-        elp->fdi, "%lf %lf %lf %lf %lf %lf %lf %lf",
-        &d[0], &d[1], &d[2], &d[3], &d[4],
-        &d[5], &d[6], &d[7]
-    );
+static int arg_vec_cmp(const void *a, const void *b)
+{
+    return memcmp(((const struct arg *)a)->m, ((const struct arg *)b)->m,
+        ELP_ARGS);
+}
 
-    /* read input line by line for coefficients */
-    while (match == 8)
-    {
-        sprintf(
-            out, "{%f, {%f, %f, %f, %f}, %f, %f, %f},\n",
-            d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7]
-        );
-        fputs(out, elp->fdo);
-        elp->size++;
-
-        match = fscanf(
-            elp->fdi, "%lf %lf %lf %lf %lf %lf %lf %lf",
-            &d[0], &d[1], &d[2], &d[3], &d[4], &d[5], &d[6], &d[7]
-        );
+/* sort by decreasing importance */
+static int arg_key_cmp(const void *a, const void *b)
+{
+    const struct arg *ra = *(struct arg * const *)a;
+    const struct arg *rb = *(struct arg * const *)b;
+
+    if (ra->key != rb->key)
+        return ra->key < rb->key ? 1 : -1;
+    return ra->order - rb->order;
+}
+
+static void *xmalloc(size_t size)
+{
+    void *p = malloc(size ? size : 1);
+
+    if (!p) {
+        fprintf(stderr, "error: out of memory\n");
+        exit(-ENOMEM);
     }
+    return p;
+}
+
+/* multipliers of the argument of row j in the layout of the dictionary of
+ * its row type. Table 1 of the planetary perturbations has no multiplier
+ * of the second Delaunay argument and table 2 none of Neptune. */
+static void row_arg(const struct elp *elp, int j, signed char *m)
+{
+    const double *d = elp->rows[j].d;
+    int i;
 
-    fputs("};\n", elp->fdo);
+    memset(m, 0, ELP_ARGS);
+
+    switch (elp->type) {
+    case ELP_MAIN:
+        for (i = 0; i < 4; i++)
+            m[i] = (signed char)d[i];
+        break;
+    case ELP_EARTH:
+        for (i = 0; i < 5; i++)
+            m[i] = (signed char)d[i];
+        break;
+    case ELP_PLANET:
+        if (elp->i <= 15) {
+            for (i = 0; i < 9; i++)
+                m[i] = (signed char)d[i];
+            m[10] = (signed char)d[9];
+            m[11] = (signed char)d[10];
+        } else {
+            for (i = 0; i < 7; i++)
+                m[i] = (signed char)d[i];
+            for (i = 7; i < 11; i++)
+                m[i + 1] = (signed char)d[i];
+        }
+        break;
+    }
 }
 
-/* used for elp 10 - 21 */
-static void planet_parse(struct elp *elp, const char *prefix)
+/* build the dictionary of all arguments of a row type and the argument
+ * index of every row. Arguments are numbered by decreasing importance so a
+ * truncated series only needs a prefix of the dictionary. */
+static struct arg *build_args(struct elp *elps, int type)
 {
-    char line[1024], out[256], hdr[256];
-    double d[14];
-    int match;
+    struct arg *args, key, *found, **order;
+    int i, j, n = 0, count = 0;
 
-    /* ignore first line of inpput */
-    fgets(line, 1024, elp->fdi);
+    for (i = 1; i <= 36; i++) {
+        if (elps[i].type == type)
+            count += elps[i].size;
+    }
+
+    args = xmalloc(sizeof(struct arg) * count);
+
+    for (i = 1; i <= 36; i++) {
+        if (elps[i].type != type)
+            continue;
+        for (j = 0; j < elps[i].size; j++, n++) {
+            row_arg(&elps[i], j, args[n].m);
+            args[n].key = fabs(elps[i].amp[j]) /
+                ((i - 1) % 3 == 2 ? ATH : RAD);
+            args[n].order = n;
+        }
+    }
+
+    /* merge identical arguments */
+    qsort(args, count, sizeof(struct arg), arg_vec_cmp);
+    for (i = 0, n = 0; i < count; i++) {
+        if (n > 0 && !arg_vec_cmp(&args[n - 1], &args[i])) {
+            if (args[i].key > args[n - 1].key)
+                args[n - 1].key = args[i].key;
+            if (args[i].order < args[n - 1].order)
+                args[n - 1].order = args[i].order;
+        } else
+            args[n++] = args[i];
+    }
+
+    if (n > 65536) {
+        fprintf(stderr, "error: %d %s arguments do not fit 16 bits\n",
+            n, type_name[type]);
+        exit(-EINVAL);
+    }
+
+    /* number by importance */
+    order = xmalloc(sizeof(struct arg *) * n);
+    for (i = 0; i < n; i++)
+        order[i] = &args[i];
+    qsort(order, n, sizeof(struct arg *), arg_key_cmp);
+    for (i = 0; i < n; i++)
+        order[i]->id = i;
+    free(order);
+
+    for (i = 1; i <= 36; i++) {
+        if (elps[i].type != type)
+            continue;
+        for (j = 0; j < elps[i].size; j++) {
+            row_arg(&elps[i], j, key.m);
+            found = bsearch(&key, args, n, sizeof(struct arg), arg_vec_cmp);
+            elps[i].id[j] = found->id;
+        }
+    }
+
+    nargs[type] = n;
+    return args;
+}
+
+/* write the dictionary of every row type, in order of argument index */
+static void write_args(FILE *fdo, struct arg **args)
+{
+    struct arg **order;
+    int type, i, j, n;
+
+    fputs(HEADER, fdo);
+
+    for (type = 0; type < ELP_TYPES; type++) {
+        n = nargs[type];
+        order = xmalloc(sizeof(struct arg *) * n);
+        for (i = 0; i < n; i++)
+            order[args[type][i].id] = &args[type][i];
+
+        fprintf(fdo, "\nstatic const int8_t %s_arg[][%d] = {\n",
+            type_name[type], type_args[type]);
+        for (i = 0; i < n; i++) {
+            fputs("{", fdo);
+            for (j = 0; j < type_args[type]; j++)
+                fprintf(fdo, "%s%d", j ? ", " : "", order[i]->m[j]);
+            fputs("},\n", fdo);
+        }
+        fputs("};\n", fdo);
+        free(order);
+    }
+
+    for (type = 0; type < ELP_TYPES; type++)
+        fprintf(fdo, "\nconst struct elp_args elp_%s_args = {\n"
+            "    %s_arg[0], %d, %d\n};\n", type_name[type], type_name[type],
+            type_args[type], nargs[type]);
+}
+
+/* write an array of doubles, a few per line */
+static void write_values(struct elp *elp, const char *name,
+    const double *values)
+{
+    int j;
+
+    fprintf(elp->fdo, "\nstatic const double ELP_ALIGNED %s[] = {", name);
+    for (j = 0; j < elp->size; j++)
+        fprintf(elp->fdo, "%s%.17g,", j % 4 ? " " : "\n", values[j]);
+    fputs("\n};\n", elp->fdo);
+}
+
+/* write an array of argument indexes, a few per line */
+static void write_ids(struct elp *elp, const char *name, const int *values)
+{
+    int j;
+
+    fprintf(elp->fdo, "\nstatic const uint16_t %s[] = {", name);
+    for (j = 0; j < elp->size; j++)
+        fprintf(elp->fdo, "%s%d,", j % 10 ? " " : "\n", values[j]);
+    fputs("\n};\n", elp->fdo);
+}
+
+/* largest argument index of rows 0 - j of every row j */
+static int *max_ids(struct elp *elp)
+{
+    int *max_id;
+    int j;
+
+    max_id = xmalloc(sizeof(int) * elp->size);
+    for (j = 0; j < elp->size; j++)
+        max_id[j] = j && max_id[j - 1] > elp->id[j] ?
+            max_id[j - 1] : elp->id[j];
+
+    return max_id;
+}
+
+/* write the sorted rows as a packed struct elp_table */
+static void write_table(struct elp *elp)
+{
+    int *max_id = max_ids(elp);
 
-    /* write header */
     fputs(HEADER, elp->fdo);
-    sprintf(hdr, "const struct %s elp%d[] = {\n", prefix, elp->i);
-    fputs(hdr, elp->fdo);
+    write_ids(elp, "arg", elp->id);
+    write_ids(elp, "max_arg", max_id);
+    write_values(elp, "amp", elp->amp);
+    write_values(elp, "c", elp->c);
+    write_values(elp, "s", elp->s);
 
-    elp->size = 0;
+    fprintf(elp->fdo, "\nconst struct elp_table elp%d = {\n", elp->i);
+    fprintf(elp->fdo, "    arg, max_arg, amp, c, s, %d\n};\n", elp->size);
 
-    match = fscanf(
-        elp->fdi,
-        "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf",
-        &d[0], &d[1], &d[2], &d[3], &d[4],
-        &d[5], &d[6], &d[7], &d[8], &d[9],
-        &d[10], &d[11], &d[12], &d[13]
-    );
+    free(max_id);
+}
 
-    /* read input line by line for coefficients */
-    while (match == 14)
-    {
-        sprintf(
-            out,
-            "{{%f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f}, %f, %f, %f},\n",
-            d[0], d[1], d[2], d[3], d[4], d[5], d[6],
-            d[7], d[8], d[9], d[10], d[11], d[12], d[13]
-        );
-        fputs(out, elp->fdo);
-        elp->size++;
-
-        match = fscanf(
-            elp->fdi,
-            "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf",
-            &d[0], &d[1], &d[2], &d[3], &d[4],
-            &d[5], &d[6], &d[7], &d[8], &d[9],
-            &d[10], &d[11], &d[12], &d[13]
-        );
+/* pad the binary file to the alignment of its arrays and return the
+ * offset of the next array */
+static uint64_t bin_align(FILE *fdo)
+{
+    static const char pad[ELP_FILE_ALIGN];
+    long offset = ftell(fdo);
+
+    fwrite(pad, (ELP_FILE_ALIGN - offset % ELP_FILE_ALIGN) % ELP_FILE_ALIGN,
+        1, fdo);
+    return ftell(fdo);
+}
+
+/* write an array of argument indexes to the binary file */
+static uint64_t bin_ids(FILE *fdo, const int *values, int size)
+{
+    uint64_t offset = bin_align(fdo);
+    uint16_t id;
+    int j;
+
+    for (j = 0; j < size; j++) {
+        id = values[j];
+        fwrite(&id, sizeof(id), 1, fdo);
+    }
+    return offset;
+}
+
+/* write an array of doubles to the binary file */
+static uint64_t bin_values(FILE *fdo, const double *values, int size)
+{
+    uint64_t offset = bin_align(fdo);
+
+    fwrite(values, sizeof(double), size, fdo);
+    return offset;
+}
+
+/* write all tables and dictionaries to a binary coefficient file, the
+ * header is written again once all offsets are known */
+static void write_binary(FILE *fdo, struct elp *elps, struct arg **args)
+{
+    struct elp_file_header hdr;
+    struct elp_file_table *ft;
+    struct arg **order;
+    int type, i, *max_id;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, ELP_FILE_MAGIC, sizeof(hdr.magic));
+    hdr.version = ELP_FILE_VERSION;
+    hdr.byte_order = ELP_FILE_BYTE_ORDER;
+    hdr.tables = ELP_FILE_TABLES;
+    hdr.types = ELP_FILE_TYPES;
+    fwrite(&hdr, sizeof(hdr), 1, fdo);
+
+    for (i = 1; i <= 36; i++) {
+        ft = &hdr.table[i - 1];
+        max_id = max_ids(&elps[i]);
+        ft->size = elps[i].size;
+        ft->arg = bin_ids(fdo, elps[i].id, elps[i].size);
+        ft->max_arg = bin_ids(fdo, max_id, elps[i].size);
+        ft->amp = bin_values(fdo, elps[i].amp, elps[i].size);
+        ft->c = bin_values(fdo, elps[i].c, elps[i].size);
+        ft->s = bin_values(fdo, elps[i].s, elps[i].size);
+        free(max_id);
+    }
+
+    /* dictionaries in order of argument index */
+    for (type = 0; type < ELP_TYPES; type++) {
+        order = xmalloc(sizeof(struct arg *) * nargs[type]);
+        for (i = 0; i < nargs[type]; i++)
+            order[args[type][i].id] = &args[type][i];
+
+        hdr.dict[type].offset = bin_align(fdo);
+        hdr.dict[type].args = type_args[type];
+        hdr.dict[type].size = nargs[type];
+        for (i = 0; i < nargs[type]; i++)
+            fwrite(order[i]->m, 1, type_args[type], fdo);
+        free(order);
+    }
+
+    fprintf(stdout, "wrote %ld bytes\n", ftell(fdo));
+    rewind(fdo);
+    fwrite(&hdr, sizeof(hdr), 1, fdo);
+}
+
+/* drop the rows of a sorted table below amplitude in arcsecs, the
+ * distance tables are in km */
+static void truncate_rows(struct elp *elp, double amplitude)
+{
+    if ((elp->i - 1) % 3 == 2)
+        amplitude *= ATH / RAD;
+
+    while (elp->size > 0 && fabs(elp->amp[elp->size - 1]) < amplitude)
+        elp->size--;
+}
+
+/* split the amplitudes of the sorted rows by the phase in degrees of
+ * column phase, or -1 for terms without phase. The term is
+ * c * sin(arg) + s * cos(arg). */
+static void split_rows(struct elp *elp, int amp, int phase)
+{
+    int j;
+
+    elp->amp = xmalloc(sizeof(double) * elp->size);
+    elp->c = xmalloc(sizeof(double) * elp->size);
+    elp->s = xmalloc(sizeof(double) * elp->size);
+    elp->id = xmalloc(sizeof(int) * elp->size);
+
+    for (j = 0; j < elp->size; j++) {
+        elp->amp[j] = elp->rows[j].d[amp];
+        if (phase < 0) {
+            elp->c[j] = elp->amp[j];
+            elp->s[j] = 0.0;
+        } else {
+            elp->c[j] = elp->amp[j] * cos(elp->rows[j].d[phase] * DEG);
+            elp->s[j] = elp->amp[j] * sin(elp->rows[j].d[phase] * DEG);
+        }
+    }
+}
+
+/* elp 1 - 3, the amplitude includes the corrections for DE200/LE200. The
+ * distance elp3 is a cosine series. */
+static void main_parse(struct elp *elp)
+{
+    double *d, tgv;
+    int j;
+
+    elp->rows = read_rows(elp, 11);
+
+    /* derivatives of A */
+    for (j = 0; j < elp->size; j++) {
+        d = elp->rows[j].d;
+        tgv = d[5] + DTASM * d[9];
+        d[4] = d[4] + tgv * (DELNP - AM * DELNU) +
+            d[6] * DELG + d[7] * DELE + d[8] * DELEP;
+    }
+
+    sort_rows(elp, elp->rows, 4);
+    split_rows(elp, 4, -1);
+
+    if (elp->i == 3) {
+        for (j = 0; j < elp->size; j++) {
+            elp->s[j] = elp->c[j];
+            elp->c[j] = 0.0;
+        }
     }
+    elp->type = ELP_MAIN;
+}
+
+/* elp 4 - 9 and the rest */
+static void earth_parse(struct elp *elp)
+{
+    elp->rows = read_rows(elp, 8);
+    sort_rows(elp, elp->rows, 6);
+    split_rows(elp, 6, 5);
+    elp->type = ELP_EARTH;
+}
 
-    fputs("};\n", elp->fdo);
+/* used for elp 10 - 21 */
+static void planet_parse(struct elp *elp)
+{
+    elp->rows = read_rows(elp, 14);
+    sort_rows(elp, elp->rows, 12);
+    split_rows(elp, 12, 11);
+    elp->type = ELP_PLANET;
 }
 
 int main(int argc, char *argv[])
 {
-    struct elp elp;
+    struct elp elps[37], *elp;
+    struct arg *args[ELP_TYPES];
+    const char *binary = NULL;
     char file[256];
+    double amplitude = 0.0;
+    FILE *fdo;
+    int i;
 
-    memset(&elp, 0, sizeof(elp));
+    memset(elps, 0, sizeof(elps));
 
-    /* open output header file */
-    elp.fdh = fopen(hdr_fname, "w");
-    if (!elp.fdh)
-    {
-        fprintf(stderr, "error: cannot open ouput file %s\n", hdr_fname);
-        exit(-errno);
+    /* optional truncation amplitude and binary output file */
+    if (argc > 2 && !strcmp(argv[1], "-a")) {
+        amplitude = atof(argv[2]);
+        argc -= 2;
+        argv += 2;
     }
-    fprintf(stdout, "opened output header %s\n", hdr_fname);
+    if (argc > 1 && !strcmp(argv[1], "-b"))
+        binary = argc > 2 ? argv[2] : bin_fname;
 
-    for (elp.i = 1; elp.i <= 36; elp.i++)
+    /* read all tables, the dictionaries need the rows of every table */
+    for (i = 1; i <= 36; i++)
     {
+        elp = &elps[i];
+        elp->i = i;
+
         /* open input file */
-        sprintf(file, dat_fname, elp.i);
-        elp.fdi = fopen(file, "r");
-        if (!elp.fdi)
+        sprintf(file, dat_fname, elp->i);
+        elp->fdi = fopen(file, "r");
+        if (!elp->fdi)
         {
             fprintf(stderr, "error: cannot open input file %s\n", file);
             fprintf(stderr, "error: please download ELP data from ftp://ftp.imcce.fr/pub/ephem/moon/elp82b/\n");
@@ -203,80 +586,82 @@ int main(int argc, char *argv[])
         }
         fprintf(stdout, "opened input %s\n", file);
 
+        if (i <= 3)
+            main_parse(elp);
+        else if (i >= 10 && i <= 21)
+            planet_parse(elp);
+        else
+            earth_parse(elp);
+
+        fclose(elp->fdi);
+        truncate_rows(elp, amplitude);
+    }
+
+    for (i = 0; i < ELP_TYPES; i++)
+        args[i] = build_args(elps, i);
+
+    if (binary) {
+        fdo = fopen(binary, "wb");
+        if (!fdo)
+        {
+            fprintf(stderr, "error: cannot open ouput file %s\n", binary);
+            exit(-errno);
+        }
+        fprintf(stdout, "opened output %s\n", binary);
+        write_binary(fdo, elps, args);
+        fclose(fdo);
+        return 0;
+    }
+
+    /* open output header file */
+    elps[0].fdh = fopen(hdr_fname, "w");
+    if (!elps[0].fdh)
+    {
+        fprintf(stderr, "error: cannot open ouput file %s\n", hdr_fname);
+        exit(-errno);
+    }
+    fprintf(stdout, "opened output header %s\n", hdr_fname);
+
+    for (i = 1; i <= 36; i++)
+    {
+        elp = &elps[i];
+
         /* open output file */
-        sprintf(file, c_fname, elp.i);
-        elp.fdo = fopen(file, "w");
-        if (!elp.fdo)
+        sprintf(file, c_fname, elp->i);
+        elp->fdo = fopen(file, "w");
+        if (!elp->fdo)
         {
             fprintf(stderr, "error: cannot open ouput file %s\n", file);
             exit(-errno);
         }
         fprintf(stdout, "opened output %s\n", file);
 
-        switch (elp.i) {
-            case 1:
-            case 2:
-            case 3:
-                main_parse(&elp, "main_problem ");
-                break;
-            case 4:
-            case 5:
-            case 6:
-            case 7:
-            case 8:
-            case 9:
-                earth_parse(&elp, "earth_pert ");
-                break;
-            case 10:
-            case 11:
-            case 12:
-            case 13:
-            case 14:
-            case 15:
-            case 16:
-            case 17:
-            case 18:
-            case 19:
-            case 20:
-            case 21:
-                planet_parse(&elp, "planet_pert ");
-                break;
-            case 22:
-            case 23:
-            case 24:
-            case 25:
-            case 26:
-            case 27:
-                earth_parse(&elp, "earth_pert ");
-                break;
-            case 28:
-            case 29:
-            case 30:
-                earth_parse(&elp, "earth_pert ");
-                break;
-            case 31:
-            case 32:
-            case 33:
-                earth_parse(&elp, "earth_pert ");
-                break;
-            case 34:
-            case 35:
-            case 36:
-                earth_parse(&elp, "earth_pert ");
-                break;
-            default:
-                exit(-EINVAL);
-                break;
-        }
-
-        fclose(elp.fdo);
-        fclose(elp.fdi);
+        write_table(elp);
+        fclose(elp->fdo);
 
         /* write header */
-        sprintf(file, "#define ELP%d_SIZE       %d\n", elp.i, elp.size);
-        fputs(file, elp.fdh);
+        sprintf(file, "#define ELP%d_SIZE\t%d\n", elp->i, elp->size);
+        fputs(file, elps[0].fdh);
+    }
+
+    for (i = 0; i < ELP_TYPES; i++) {
+        sprintf(file, "#define ELP_%s_ARGS\t%d\n",
+            i == ELP_MAIN ? "MAIN" : i == ELP_EARTH ? "EARTH" : "PLANET",
+            nargs[i]);
+        fputs(file, elps[0].fdh);
+    }
+    fclose(elps[0].fdh);
+
+    /* open dictionary file */
+    fdo = fopen(args_fname, "w");
+    if (!fdo)
+    {
+        fprintf(stderr, "error: cannot open ouput file %s\n", args_fname);
+        exit(-errno);
     }
+    fprintf(stdout, "opened output %s\n", args_fname);
+    write_args(fdo, args);
+    fclose(fdo);
 
-    fclose(elp.fdh);
     return 0;
 }
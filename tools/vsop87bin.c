@@ -0,0 +1,197 @@
+/*
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU Library General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+/* Build a binary VSOP87 coefficient file from VSOP87D data files */
+/* ftp://ftp.imcce.fr/pub/ephem/planets/vsop87/ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+#include "vsop87-file.h"
+
+const char dat_fname[] = "VSOP87D.%s";
+const char bin_fname[] = "vsop87.bin";
+
+static const char *planets[VSOP87_FILE_PLANETS] = {
+    "mer", "ven", "ear", "mar", "jup", "sat", "ura", "nep"
+};
+
+struct term {
+    double A;
+    double B;
+    double C;
+};
+
+struct series {
+    struct term *terms;
+    int size;
+};
+
+/* sort by decreasing amplitude */
+static int term_cmp(const void *a, const void *b)
+{
+    double A = fabs(((const struct term *)a)->A);
+    double B = fabs(((const struct term *)b)->A);
+
+    return A < B ? 1 : A > B ? -1 : 0;
+}
+
+/* read columns first to last (1 based) of a term line as a number */
+static double column(const char *line, int first, int last)
+{
+    char buf[32];
+    int len = last - first + 1;
+
+    memcpy(buf, line + first - 1, len);
+    buf[len] = 0;
+    return atof(buf);
+}
+
+/* read all series of a VSOP87D file, keeping terms of at least amplitude */
+static int planet_parse(FILE *fdi, struct series *series, double amplitude)
+{
+    char line[1024];
+    struct series *s = NULL;
+    struct term term;
+    int variable, power, count, i = 0;
+
+    while (fgets(line, sizeof(line), fdi)) {
+
+        if (line[0] == '\n' || line[0] == '\r')
+            continue;
+
+        /* series header, e.g. VARIABLE 1 (LBR) *T**0 1449 TERMS */
+        if (strstr(line, "VSOP87")) {
+            if (sscanf(strstr(line, "VARIABLE"), "VARIABLE %d", &variable) != 1 ||
+                sscanf(strstr(line, "*T**"), "*T**%d %d", &power, &count) != 2 ||
+                variable < 1 || variable > VSOP87_FILE_VARIABLES ||
+                power < 0 || power >= VSOP87_FILE_POWERS) {
+                fprintf(stderr, "error: invalid series header %s", line);
+                return -EINVAL;
+            }
+
+            s = &series[(variable - 1) * VSOP87_FILE_POWERS + power];
+            s->terms = malloc(sizeof(struct term) * count);
+            if (!s->terms)
+                return -ENOMEM;
+            s->size = 0;
+            i = count;
+            continue;
+        }
+
+        if (!s || i-- <= 0 || strlen(line) < 131) {
+            fprintf(stderr, "error: unexpected line %s", line);
+            return -EINVAL;
+        }
+
+        /* A, B and C of the term */
+        term.A = column(line, 80, 97);
+        term.B = column(line, 98, 111);
+        term.C = column(line, 112, 131);
+
+        if (fabs(term.A) >= amplitude)
+            s->terms[s->size++] = term;
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    struct vsop87_file_header hdr;
+    struct series series[VSOP87_FILE_VARIABLES * VSOP87_FILE_POWERS];
+    struct vsop87_file_series *fs;
+    const char *output = bin_fname;
+    char file[256], pad[VSOP87_FILE_ALIGN];
+    double amplitude = 0.0;
+    FILE *fdi, *fdo;
+    long offset;
+    int p, i, err;
+
+    /* optional truncation amplitude and output file */
+    if (argc > 2 && !strcmp(argv[1], "-a")) {
+        amplitude = atof(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc > 1)
+        output = argv[1];
+
+    fdo = fopen(output, "wb");
+    if (!fdo) {
+        fprintf(stderr, "error: cannot open output file %s\n", output);
+        exit(-errno);
+    }
+    fprintf(stdout, "opened output %s\n", output);
+
+    /* header is written again once all offsets are known */
+    memset(&hdr, 0, sizeof(hdr));
+    memset(pad, 0, sizeof(pad));
+    memcpy(hdr.magic, VSOP87_FILE_MAGIC, sizeof(hdr.magic));
+    hdr.version = VSOP87_FILE_VERSION;
+    hdr.byte_order = VSOP87_FILE_BYTE_ORDER;
+    hdr.planets = VSOP87_FILE_PLANETS;
+    hdr.powers = VSOP87_FILE_POWERS;
+    fwrite(&hdr, sizeof(hdr), 1, fdo);
+    offset = sizeof(hdr);
+
+    for (p = 0; p < VSOP87_FILE_PLANETS; p++) {
+        sprintf(file, dat_fname, planets[p]);
+        fdi = fopen(file, "r");
+        if (!fdi) {
+            fprintf(stderr, "error: cannot open input file %s\n", file);
+            fprintf(stderr, "error: please download VSOP87D data from ftp://ftp.imcce.fr/pub/ephem/planets/vsop87/\n");
+            exit(-errno);
+        }
+        fprintf(stdout, "opened input %s\n", file);
+
+        memset(series, 0, sizeof(series));
+        err = planet_parse(fdi, series, amplitude);
+        if (err < 0)
+            exit(err);
+        fclose(fdi);
+
+        for (i = 0; i < VSOP87_FILE_VARIABLES * VSOP87_FILE_POWERS; i++) {
+            fs = &hdr.series[p][i / VSOP87_FILE_POWERS][i % VSOP87_FILE_POWERS];
+            if (series[i].size == 0) {
+                free(series[i].terms);
+                continue;
+            }
+
+            /* align every table */
+            fwrite(pad, (VSOP87_FILE_ALIGN - offset % VSOP87_FILE_ALIGN) %
+                VSOP87_FILE_ALIGN, 1, fdo);
+            offset = ftell(fdo);
+
+            qsort(series[i].terms, series[i].size, sizeof(struct term),
+                term_cmp);
+            fs->offset = offset;
+            fs->size = series[i].size;
+            fwrite(series[i].terms, sizeof(struct term), series[i].size, fdo);
+            offset = ftell(fdo);
+            free(series[i].terms);
+        }
+    }
+
+    rewind(fdo);
+    fwrite(&hdr, sizeof(hdr), 1, fdo);
+    fclose(fdo);
+    fprintf(stdout, "wrote %ld bytes\n", offset);
+    return 0;
+}